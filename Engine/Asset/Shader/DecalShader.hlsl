@@ -1,4 +1,5 @@
 #include "LightingCommon.hlsli"
+#include "VertexFormat.hlsli"
 
 cbuffer DecalConstants : register(b2)
 {
@@ -20,10 +21,17 @@ SamplerState GBufferNormalSampler : register(s2);
 
 struct VS_INPUT
 {
+#ifdef PACKED_VERTEX
+	// FPackedNormalVertex, World already contains the bounds scale/offset
+	float4 PackedPosition : POSITION;
+	float2 PackedNormal : NORMAL;
+	float2 Tex : TEXCOORD0;
+#else
 	float3 Position : POSITION;
 	float3 Normal : NORMAL;
 	float4 Color : COLOR;
 	float2 Tex : TEXCOORD0;
+#endif
 };
 
 struct PS_INPUT
@@ -38,10 +46,17 @@ PS_INPUT mainVS(VS_INPUT Input)
 {
 	PS_INPUT Output;
 
-	float4 Pos = mul(float4(Input.Position, 1.0f), World);
+#ifdef PACKED_VERTEX
+	float3 Position = Input.PackedPosition.xyz;
+	float3 Normal = DecodeOctahedral(Input.PackedNormal);
+#else
+	float3 Position = Input.Position;
+	float3 Normal = Input.Normal;
+#endif
+	float4 Pos = mul(float4(Position, 1.0f), World);
 	Output.Position = mul(mul(Pos, View), Projection);
 	Output.WorldPos = Pos;
-	Output.Normal = normalize(mul(float4(Input.Normal, 0.0f), WorldInverseTranspose));
+	Output.Normal = normalize(mul(float4(Normal, 0.0f), WorldInverseTranspose));
 	Output.Tex = Input.Tex;
 	return Output;
 }
@@ -86,7 +86,7 @@ float NDCDepthToViewZ(float ndcDepth, matrix proj)
 }
 
 // 클러스터 인덱스 계산 (픽셀 SV_Position과 뷰 공간 Z 기반)
-// 선형 분포를 사용
+// 지수 분포를 사용 (FClusteredLightCuller의 슬라이스 경계 Near * (Far / Near)^(k / CLUSTER_SIZE_Z)와 동일)
 uint3 GetClusterIndexFromSVPos(float4 svPosition, float viewZ, uint2 viewportOffset, uint2 viewportSize, float nearClip, float farClip)
 {
     // 화면 좌표 -> 뷰포트 상대 좌표
@@ -94,8 +94,12 @@ uint3 GetClusterIndexFromSVPos(float4 svPosition, float viewZ, uint2 viewportOff
     uint clusterX = (uint)floor(viewportRelativePos.x / CLUSTER_SIZE_X);
     uint clusterY = (uint)floor(viewportRelativePos.y / CLUSTER_SIZE_Y);
 
-    // 뷰 공간 Z를 선형 분포로 클러스터 Z 인덱스 계산
-    float t = (viewZ - nearClip) / (farClip - nearClip);
+    // 뷰 공간 Z를 로그 분포로 클러스터 Z 인덱스 계산, 가까운 슬라이스가 얇아 깊이 방향 해상도가 원근과 맞는다
+    // 직교 투영은 CPU에서 모든 슬라이스를 같은 범위로 채우므로 어느 슬라이스가 골라져도 결과가 같다
+    // Near/Far는 FClusteredLightCuller와 같은 방식으로 보정해야 슬라이스 경계가 CPU와 일치한다
+    nearClip = max(nearClip, CLUSTER_MIN_NEAR_CLIP);
+    farClip = max(farClip, nearClip);
+    float t = saturate(log(max(viewZ, nearClip) / nearClip) / log(farClip / nearClip));
     uint clusterZ = (uint)min((uint)(t * CLUSTER_SIZE_Z), CLUSTER_SIZE_Z - 1);
     
     return uint3(clusterX, clusterY, clusterZ);
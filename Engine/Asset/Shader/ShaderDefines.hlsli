@@ -57,9 +57,13 @@
 // CLUSTERED LIGHTING / LIGHT CULLING
 // ============================================================================
 // Defines the 3D cluster grid size for the clustered light culling algorithm.
+// Must match FClusteredLightCuller::CLUSTER_SIZE_X/Y/Z, which builds the per-cluster light lists on the CPU.
 
 #define CLUSTER_SIZE_X 32
 #define CLUSTER_SIZE_Y 32
 #define CLUSTER_SIZE_Z 16
 
+// Lower bound for the near plane used by the logarithmic depth slices; matches FClusteredLightCuller::MIN_NEAR_CLIP.
+#define CLUSTER_MIN_NEAR_CLIP 1e-4
+
 #endif // SHADER_DEFINES_HLSLI
\ No newline at end of file
@@ -9,11 +9,14 @@
 //   VMI_Unlit        : No lighting calculations (outputs raw texture/color)
 
 // Normal mapping supported via HAS_NORMAL_MAP (TBN)
+// Instanced drawing supported via INSTANCED (per-instance matrices in vertex buffer slot 1)
+// Compressed static mesh vertices supported via PACKED_VERTEX (FPackedNormalVertex, see VertexFormat.hlsli)
 // =============================================================================
 #include "ShaderDefines.hlsli"
 #include "LightingCommon.hlsli"
 #include "CommonBuffers.hlsli"
 #include "MaterialCommon.hlsli"
+#include "VertexFormat.hlsli"
 
 cbuffer MaterialConstants : register(b2) // b0, b1 is in VS
 {
@@ -31,12 +34,30 @@ cbuffer MaterialConstants : register(b2) // b0, b1 is in VS
 
 struct VS_INPUT
 {
+#ifdef PACKED_VERTEX
+    float4 PackedPosition : POSITION;
+    float2 PackedNormal : NORMAL;
+    float2 PackedTangent : TANGENT;
+    float2 Tex : TEXCOORD0;
+#else
     float3 Position : POSITION;
     float3 Normal : NORMAL;
     float4 Color : COLOR;
     float2 Tex : TEXCOORD0;
     float3 Tangent : TANGENT;
     float3 Bitangent : BITANGENT;
+#endif
+#ifdef INSTANCED
+    // FInstanceData: World, WorldInverseTranspose (row vectors)
+    float4 InstanceWorld0 : INSTANCE_WORLD0;
+    float4 InstanceWorld1 : INSTANCE_WORLD1;
+    float4 InstanceWorld2 : INSTANCE_WORLD2;
+    float4 InstanceWorld3 : INSTANCE_WORLD3;
+    float4 InstanceNormal0 : INSTANCE_NORMAL0;
+    float4 InstanceNormal1 : INSTANCE_NORMAL1;
+    float4 InstanceNormal2 : INSTANCE_NORMAL2;
+    float4 InstanceNormal3 : INSTANCE_NORMAL3;
+#endif
 };
 
 struct PS_INPUT
@@ -354,17 +375,36 @@ float3 GetMaterialProperty(uint TextureFlag,Texture2D Texture, float2 UV, float3
 PS_INPUT mainVS(VS_INPUT Input)
 {
     PS_INPUT Output;
-    Output.WorldPosition = mul(float4(Input.Position, 1.0f), World).xyz;
-    Output.Position = mul(mul(mul(float4(Input.Position, 1.0f), World), View), Projection);
+#ifdef INSTANCED
+    float4x4 WorldMatrix = float4x4(Input.InstanceWorld0, Input.InstanceWorld1, Input.InstanceWorld2, Input.InstanceWorld3);
+    float4x4 NormalMatrix = float4x4(Input.InstanceNormal0, Input.InstanceNormal1, Input.InstanceNormal2, Input.InstanceNormal3);
+#else
+    float4x4 WorldMatrix = World;
+    float4x4 NormalMatrix = WorldInverseTranspose;
+#endif
+#ifdef PACKED_VERTEX
+    // WorldMatrix already maps [0,1] bounds to local space; NormalMatrix is the plain inverse transpose
+    float3 Position = Input.PackedPosition.xyz;
+    float3 Normal = DecodeOctahedral(Input.PackedNormal);
+    float3 Tangent = DecodeOctahedral(Input.PackedTangent);
+    float3 Bitangent = DecodeBitangent(Normal, Tangent, Input.PackedPosition.w);
+#else
+    float3 Position = Input.Position;
+    float3 Normal = Input.Normal;
+    float3 Tangent = Input.Tangent;
+    float3 Bitangent = Input.Bitangent;
+#endif
+    Output.WorldPosition = mul(float4(Position, 1.0f), WorldMatrix).xyz;
+    Output.Position = mul(mul(mul(float4(Position, 1.0f), WorldMatrix), View), Projection);
     
     // Do NOT normalize here - let GPU interpolate, then normalize in PS
-    Output.WorldNormal = mul(Input.Normal, (float3x3)WorldInverseTranspose);
+    Output.WorldNormal = mul(Normal, (float3x3)NormalMatrix);
 
     // Transform tangent to world space using inverse transpose
-    Output.WorldTangent = mul(Input.Tangent, (float3x3)WorldInverseTranspose);
+    Output.WorldTangent = mul(Tangent, (float3x3)NormalMatrix);
 
     // Transform bitangent to world space using inverse transpose
-    Output.WorldBitangent = mul(Input.Bitangent, (float3x3)WorldInverseTranspose);
+    Output.WorldBitangent = mul(Bitangent, (float3x3)NormalMatrix);
 
     Output.Tex = Input.Tex;
     Output.Ambient = float3(1.0f, 1.0f, 1.0f);
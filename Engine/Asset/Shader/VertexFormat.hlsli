@@ -0,0 +1,28 @@
+// VertexFormat.hlsli
+// : FPackedNormalVertex decoding for the PACKED_VERTEX permutation.
+//
+//   POSITION  : R16G16B16A16_UNORM  xyz = position inside the mesh bounds [0,1], w = bitangent sign (0 = -1, 1 = +1)
+//                                   The bounds scale/offset is folded into World on the CPU (FStaticMesh::PackedPositionToLocal).
+//   NORMAL    : R16G16_SNORM        octahedral unit vector
+//   TANGENT   : R16G16_SNORM        octahedral unit vector
+//   TEXCOORD0 : R16G16_FLOAT
+
+#ifndef VERTEX_FORMAT_HLSLI
+#define VERTEX_FORMAT_HLSLI
+
+// Same math as FVertexQuantizer::DecodeOctahedral
+float3 DecodeOctahedral(float2 Encoded)
+{
+    float3 N = float3(Encoded, 1.0f - abs(Encoded.x) - abs(Encoded.y));
+    float Fold = saturate(-N.z);
+    N.xy += (N.xy >= 0.0f) ? -Fold : Fold;
+    return normalize(N);
+}
+
+// FObjManager builds the bitangent as N.Cross(T) with the engine's FVector::Cross, which is cross(T, N) in HLSL
+float3 DecodeBitangent(float3 Normal, float3 Tangent, float SignBit)
+{
+    return normalize(cross(Tangent, Normal)) * (SignBit * 2.0f - 1.0f);
+}
+
+#endif // VERTEX_FORMAT_HLSLI
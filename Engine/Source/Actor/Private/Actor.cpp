@@ -31,109 +31,8 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle); 
 
-    // 불러오기 (Load)
-    if (bInIsLoading)
-    {
-    	// 컴포넌트 포인터와 JSON 데이터를 임시 저장할 구조체
-        struct FSceneCompData
-        {
-            USceneComponent* Component = nullptr;
-            FString ParentName; // ParentName을 임시 저장
-        };
-
-        JSON ComponentsJson;
-        if (FJsonSerializer::ReadArray(InOutHandle, "Components", ComponentsJson))
-        {
-			TMap<FString, FSceneCompData> ComponentMap;
-	        TArray<FSceneCompData*> LoadList;
-	        // --- [PASS 1: Component Creation & Data Load] ---
-            for (JSON& ComponentData : ComponentsJson.ArrayRange())
-            {
-                FString TypeString;
-                FString NameString;
-        
-                FJsonSerializer::ReadString(ComponentData, "Type", TypeString);
-                FJsonSerializer::ReadString(ComponentData, "Name", NameString);
-        
-            	UClass* ComponentClass = UClass::FindClass(TypeString);
-                UActorComponent* NewComp = Cast<UActorComponent>(NewObject(ComponentClass));
-            	NewComp->SetName(NameString);
-                
-                if (NewComp)
-                {
-                	NewComp->SetOwner(this);
-                	OwnedComponents.push_back(NewComp);
-                    NewComp->Serialize(bInIsLoading, ComponentData);
-                	
-                	if (USceneComponent* NewSceneComp = Cast<USceneComponent>(NewComp))
-                	{
-                		FString ParentNameStd;
-                		FJsonSerializer::ReadString(ComponentData, "ParentName", ParentNameStd, ""); // 부모 이름 로드
-
-                		FSceneCompData LoadData;
-                		LoadData.Component = NewSceneComp;
-                		LoadData.ParentName = ParentNameStd;
-                    
-                		ComponentMap[NameString] = LoadData;
-                		LoadList.push_back(&ComponentMap[NameString]);
-                	}
-                }
-            }
-            
-            // --- [PASS 2: Hierarchy Rebuild] ---
-            for (FSceneCompData* LoadDataPtr : LoadList)
-            {
-                USceneComponent* ChildComp = LoadDataPtr->Component;
-                const FString& ParentName = LoadDataPtr->ParentName;
-                
-                if (!ParentName.empty())
-                {
-                    // 5. ParentName을 키로 부모 컴포넌트 포인터 검색
-                    auto ParentIt = ComponentMap.find(ParentName);
-                    if (ParentIt != ComponentMap.end())
-                    {
-                        USceneComponent* ParentComp = ParentIt->second.Component;
-                        // 6. 부착 함수 호출
-                        if (ParentComp)
-                        {
-                            ChildComp->AttachToComponent(ParentComp, true);
-                        }
-                    }
-                    else
-                    {
-                        UE_LOG("Failed to find parent component: %s", ParentName.c_str());
-                    }
-                }
-                // ParentName이 비어있으면 루트 컴포넌트
-                else
-                {
-                	SetRootComponent(ChildComp);
-                }
-            }
-
-        	if (RootComponent)
-        	{
-    			FVector Location, RotationEuler, Scale;
-    	        
-    		    FJsonSerializer::ReadVector(InOutHandle, "Location", Location, GetActorLocation());
-    		    FJsonSerializer::ReadVector(InOutHandle, "Rotation", RotationEuler, GetActorRotation().ToEuler());
-    		    FJsonSerializer::ReadVector(InOutHandle, "Scale", Scale, GetActorScale3D());
-    	        
-    		    SetActorLocation(Location);
-    		    SetActorRotation(FQuaternion::FromEuler(RotationEuler));	    		SetActorScale3D(Scale); 
-        	}
-
-			FString bCanEverTickString;
-			FJsonSerializer::ReadString(InOutHandle, "bCanEverTick", bCanEverTickString, "false");
-			bCanEverTick = bCanEverTickString == "true" ? true : false;
-
-			FString bTickInEditorString;
-			FJsonSerializer::ReadString(InOutHandle, "bTickInEditor", bTickInEditorString, "false");
-			bTickInEditor = bTickInEditorString == "true" ? true : false;
-        }
-    }
     // 저장 (Save)
-    else
+    if (!bInIsLoading)
     {
 		InOutHandle["Location"] = FJsonSerializer::VectorToJson(GetActorLocation());
         InOutHandle["Rotation"] = FJsonSerializer::VectorToJson(GetActorRotation().ToEuler());
@@ -164,6 +63,99 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
     }
 }
 
+void AActor::Deserialize(const FJsonValue& InHandle)
+{
+	Super::Deserialize(InHandle);
+
+	// 컴포넌트 포인터와 부모 이름을 임시 저장할 구조체, 이름은 문서 버퍼를 그대로 가리킨다
+	struct FSceneCompData
+	{
+		USceneComponent* Component = nullptr;
+		std::string_view ParentName;
+	};
+
+	FJsonValue ComponentsJson;
+	if (!FJsonSerializer::ReadArray(InHandle, "Components", ComponentsJson))
+	{
+		return;
+	}
+
+	TMap<std::string_view, FSceneCompData> ComponentMap;
+	TArray<FSceneCompData*> LoadList;
+	ComponentMap.reserve(ComponentsJson.Size());
+	OwnedComponents.reserve(OwnedComponents.size() + ComponentsJson.Size());
+
+	// --- [PASS 1: Component Creation & Data Load] ---
+	for (const FJsonValue& ComponentData : ComponentsJson.ArrayRange())
+	{
+		std::string_view TypeString;
+		std::string_view NameString;
+		FJsonSerializer::ReadStringView(ComponentData, "Type", TypeString);
+		FJsonSerializer::ReadStringView(ComponentData, "Name", NameString);
+
+		UClass* ComponentClass = UClass::FindClass(FString(TypeString));
+		UActorComponent* NewComp = Cast<UActorComponent>(NewObject(ComponentClass));
+		if (NewComp)
+		{
+			NewComp->SetName(FString(NameString));
+			NewComp->SetOwner(this);
+			OwnedComponents.push_back(NewComp);
+			NewComp->Deserialize(ComponentData);
+
+			if (USceneComponent* NewSceneComp = Cast<USceneComponent>(NewComp))
+			{
+				FSceneCompData& LoadData = ComponentMap[NameString];
+				LoadData.Component = NewSceneComp;
+				FJsonSerializer::ReadStringView(ComponentData, "ParentName", LoadData.ParentName, ""); // 부모 이름 로드
+				LoadList.push_back(&LoadData);
+			}
+		}
+	}
+
+	// --- [PASS 2: Hierarchy Rebuild] ---
+	for (FSceneCompData* LoadDataPtr : LoadList)
+	{
+		USceneComponent* ChildComp = LoadDataPtr->Component;
+		const std::string_view ParentName = LoadDataPtr->ParentName;
+
+		// ParentName이 비어있으면 루트 컴포넌트
+		if (ParentName.empty())
+		{
+			SetRootComponent(ChildComp);
+			continue;
+		}
+
+		auto ParentIt = ComponentMap.find(ParentName);
+		if (ParentIt != ComponentMap.end())
+		{
+			if (USceneComponent* ParentComp = ParentIt->second.Component)
+			{
+				ChildComp->AttachToComponent(ParentComp, true);
+			}
+		}
+		else
+		{
+			UE_LOG("Failed to find parent component: %.*s", static_cast<int>(ParentName.size()), ParentName.data());
+		}
+	}
+
+	if (RootComponent)
+	{
+		FVector Location, RotationEuler, Scale;
+
+		FJsonSerializer::ReadVector(InHandle, "Location", Location, GetActorLocation());
+		FJsonSerializer::ReadVector(InHandle, "Rotation", RotationEuler, GetActorRotation().ToEuler());
+		FJsonSerializer::ReadVector(InHandle, "Scale", Scale, GetActorScale3D());
+
+		SetActorLocation(Location);
+		SetActorRotation(FQuaternion::FromEuler(RotationEuler));
+		SetActorScale3D(Scale);
+	}
+
+	FJsonSerializer::ReadBool(InHandle, "bCanEverTick", bCanEverTick, false);
+	FJsonSerializer::ReadBool(InHandle, "bTickInEditor", bTickInEditor, false);
+}
+
 
 void AActor::SetActorLocation(const FVector& InLocation) const
 {
@@ -21,6 +21,7 @@ public:
 	~AActor() override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void Deserialize(const FJsonValue& InHandle) override;
 
 	void SetActorLocation(const FVector& InLocation) const;
 	void SetActorRotation(const FQuaternion& InRotation) const;
@@ -0,0 +1,63 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Core/Public/JobSystem.h"
+#include "Manager/Asset/Public/AssetLoader.h"
+#include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Path/Public/PathManager.h"
+
+namespace
+{
+	/**
+	 * @brief 시작 로딩의 CPU 단계(메시 빌드, 텍스처 디코딩)만 직렬과 병렬로 각각 실행해 비교, 디바이스 업로드는 하지 않는다
+	 * @note 인자: [워커 수] (기본: 하드웨어 스레드 - 1) [쿠킹 캐시 사용 0/1] (기본 0, 캐시 없이 콜드 빌드)
+	 */
+	void RunAssetLoadBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 WorkerCount = std::max(0, FBenchmarkRegistry::GetIntArg(InArgs, 0, static_cast<int32>(FJobSystem::GetDefaultWorkerCount())));
+		const bool bIsCacheEnabled = FBenchmarkRegistry::GetIntArg(InArgs, 1, 0) != 0;
+
+		FObjImporter::Configuration MeshConfig = UAssetManager::GetStaticMeshImportConfig();
+		MeshConfig.bIsBinaryEnabled = bIsCacheEnabled;
+
+		const path MeshDirectory = "Data/";
+		const path TextureDirectory = UPathManager::GetInstance().GetDataPath();
+
+		FAssetLoader SerialLoader;
+		SerialLoader.Gather(MeshDirectory, TextureDirectory);
+		if (SerialLoader.GetStaticMeshTasks().empty() && SerialLoader.GetTextureTasks().empty())
+		{
+			UE_LOG_WARNING("AssetLoad: 로드할 에셋이 없습니다");
+			return;
+		}
+		SerialLoader.Cook(MeshConfig, nullptr);
+
+		FJobSystem JobSystem(static_cast<uint32>(WorkerCount));
+		FAssetLoader ParallelLoader;
+		ParallelLoader.Gather(MeshDirectory, TextureDirectory);
+		ParallelLoader.Cook(MeshConfig, &JobSystem);
+		ParallelLoader.PrintReport();
+
+		auto CountFailures = [](FAssetLoader& InLoader)
+		{
+			int32 FailureCount = 0;
+			for (const FStaticMeshLoadTask& Task : InLoader.GetStaticMeshTasks())
+			{
+				FailureCount += Task.bIsCooked ? 0 : 1;
+			}
+			for (const FTextureLoadTask& Task : InLoader.GetTextureTasks())
+			{
+				FailureCount += Task.bIsCooked ? 0 : 1;
+			}
+			return FailureCount;
+		};
+
+		const double SerialMilliseconds = SerialLoader.GetCookMilliseconds();
+		const double ParallelMilliseconds = ParallelLoader.GetCookMilliseconds();
+		UE_LOG_SUCCESS("AssetLoad: %zu meshes, %zu textures, cache %s | Serial %.3fms | Parallel %.3fms (%d workers, x%.1f) | %d failed",
+			ParallelLoader.GetStaticMeshTasks().size(), ParallelLoader.GetTextureTasks().size(), bIsCacheEnabled ? "on" : "off",
+			SerialMilliseconds, ParallelMilliseconds, WorkerCount,
+			ParallelMilliseconds > 0.0 ? SerialMilliseconds / ParallelMilliseconds : 0.0, CountFailures(ParallelLoader));
+	}
+}
+
+IMPLEMENT_BENCHMARK("assetload", "Cook every startup mesh and texture serially and on the job system without device upload, report per-asset times", RunAssetLoadBenchmark)
@@ -0,0 +1,90 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Core/Public/ObjectIterator.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Global/BVH.h"
+
+namespace
+{
+	/**
+	 * @brief Leaf 노드가 가진 삼각형 수의 합 (모든 삼각형이 정확히 한 Leaf에 들어가면 메시 삼각형 수와 같다)
+	 */
+	size_t SumLeafTriangles(const FBVH& InBVH)
+	{
+		size_t Sum = 0;
+		for (int32 i = 0; i < InBVH.GetNodeCount(); ++i)
+		{
+			const FNode& Node = InBVH.GetNode(i);
+			if (Node.bIsLeaf)
+			{
+				Sum += Node.TriangleCount;
+			}
+		}
+		return Sum;
+	}
+
+	/**
+	 * @brief 로드된 모든 스태틱 메시에 대해 BVH를 다시 빌드하고 빌드 시간과 트리 품질을 출력
+	 * 빌드할 때마다 트리 유효성과 Leaf 삼각형 수를 검사하고, 하나라도 실패하면 오류로 보고한다.
+	 * @note 인자: [반복 횟수] (기본 1회, 평균 빌드 시간 출력)
+	 */
+	void RunBVHBuildBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 Iterations = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 1));
+
+		double TotalMilliseconds = 0.0;
+		size_t TotalTriangles = 0;
+		int32 FailedMeshCount = 0;
+		for (TObjectIterator<UStaticMesh> It; It; ++It)
+		{
+			FStaticMesh* Mesh = It->GetStaticMeshAsset();
+			if (!Mesh || Mesh->Indices.empty())
+			{
+				continue;
+			}
+
+			const size_t TriangleCount = Mesh->Indices.size() / 3;
+			double Milliseconds = 0.0;
+			int32 BuildCount = 0;
+			bool bIsValid = true;
+			size_t LeafTriangles = 0;
+			while (bIsValid && BuildCount < Iterations)
+			{
+				FScopeCycleCounter Counter;
+				Mesh->BVH.Build(Mesh);
+				Milliseconds += Counter.Finish();
+				++BuildCount;
+
+				// 검사는 측정 구간 밖에서 수행하고, 실패하면 해당 트리를 남긴 채 중단
+				LeafTriangles = SumLeafTriangles(Mesh->BVH);
+				bIsValid = Mesh->BVH.CheckValidity() && LeafTriangles == TriangleCount;
+			}
+			Milliseconds /= BuildCount;
+
+			const FBVH& BVH = Mesh->BVH;
+			UE_LOG_INFO("BVH: %s | Tris %zu | Nodes %d | Leaves %d | Depth %d | SAH Cost %.3f | Build %.3fms",
+				Mesh->PathFileName.ToString().c_str(), TriangleCount, BVH.GetNodeCount(), BVH.GetLeafCount(),
+				BVH.GetMaxDepth(), BVH.GetCost(BVH.GetRootIndex()), Milliseconds);
+
+			if (!bIsValid)
+			{
+				UE_LOG_ERROR("BVH: %s | Invalid tree (CheckValidity %s, leaf tris %zu / %zu)",
+					Mesh->PathFileName.ToString().c_str(), BVH.CheckValidity() ? "ok" : "failed", LeafTriangles, TriangleCount);
+				++FailedMeshCount;
+			}
+
+			TotalMilliseconds += Milliseconds;
+			TotalTriangles += TriangleCount;
+		}
+
+		if (FailedMeshCount > 0)
+		{
+			UE_LOG_ERROR("BVH: %d meshes built an invalid tree", FailedMeshCount);
+			return;
+		}
+		UE_LOG_SUCCESS("BVH: Total %zu tris, %.3fms (%.2f MTris/s)", TotalTriangles, TotalMilliseconds,
+			TotalMilliseconds > 0.0 ? static_cast<double>(TotalTriangles) / TotalMilliseconds / 1000.0 : 0.0);
+	}
+}
+
+IMPLEMENT_BENCHMARK("bvh", "Rebuild BVH of every loaded static mesh, report build time / node count / SAH cost", RunBVHBuildBenchmark)
@@ -0,0 +1,147 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Core/Public/ObjectIterator.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Global/BVH.h"
+
+#include <random>
+
+namespace
+{
+	/**
+	 * @brief 이진 BVH 후보 수집 + 후보 전체 삼각형 검사 (기존 피킹 경로와 동일한 방식)
+	 */
+	bool RaycastBinaryBVH(const FStaticMesh& InMesh, const FRay& InRay, TArray<int32>& InOutCandidates, float& OutDistance, int32& OutTriangleIndex)
+	{
+		const FVector Origin(InRay.Origin.X, InRay.Origin.Y, InRay.Origin.Z);
+		const FVector Direction(InRay.Direction.X, InRay.Direction.Y, InRay.Direction.Z);
+
+		OutDistance = FLT_MAX;
+		OutTriangleIndex = -1;
+		InMesh.BVH.TraverseRay(InRay, InOutCandidates);
+		for (int32 TriIndex : InOutCandidates)
+		{
+			float T, U, V;
+			if (IntersectRayTriangle(Origin, Direction,
+				InMesh.Vertices[InMesh.Indices[TriIndex * 3]].Position,
+				InMesh.Vertices[InMesh.Indices[TriIndex * 3 + 1]].Position,
+				InMesh.Vertices[InMesh.Indices[TriIndex * 3 + 2]].Position, T, U, V) && T < OutDistance)
+			{
+				OutDistance = T;
+				OutTriangleIndex = TriIndex;
+			}
+		}
+		return OutDistance < FLT_MAX;
+	}
+
+	/**
+	 * @brief 로드된 모든 스태틱 메시에 무작위 Ray를 발사하여 이진 BVH와 BVH4 SIMD 순회의 처리량을 비교
+	 * BVH4 최근접 충돌이 이진 BVH 기준 결과와 다르면 메시와 첫 번째 어긋난 Ray를 오류로 보고한다.
+	 * @note 인자: [메시당 Ray 개수] (기본 1000000)
+	 */
+	void RunBVHRayBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 RayCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 1000000));
+		std::mt19937 Random(7);
+		std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+		int32 MeshCount = 0;
+		int32 FailedMeshCount = 0;
+		int64 TotalRays = 0;
+		int64 TotalMismatches = 0;
+		double TotalBinaryMilliseconds = 0.0;
+		double TotalWideMilliseconds = 0.0;
+
+		for (TObjectIterator<UStaticMesh> It; It; ++It)
+		{
+			FStaticMesh* Mesh = It->GetStaticMeshAsset();
+			if (!Mesh || !Mesh->BVH.HasWideNodes())
+			{
+				continue;
+			}
+
+			// 메시 경계를 감싸는 구 표면에서 경계 내부의 임의 지점을 향하는 Ray 생성
+			const FAABB& Bounds = Mesh->BVH.GetNode(Mesh->BVH.GetRootIndex()).Box;
+			const FVector Center = Bounds.GetCenter();
+			const FVector HalfExtent = (Bounds.Max - Bounds.Min) * 0.5f;
+			const float Radius = std::max(HalfExtent.Length() * 2.0f, 1.0f);
+
+			TArray<FRay> Rays(RayCount);
+			for (FRay& Ray : Rays)
+			{
+				FVector OnSphere(Unit(Random), Unit(Random), Unit(Random));
+				OnSphere.Normalize();
+				const FVector Origin = Center + OnSphere * Radius;
+				const FVector Target = Center + FVector(Unit(Random) * HalfExtent.X, Unit(Random) * HalfExtent.Y, Unit(Random) * HalfExtent.Z);
+				FVector Direction = Target - Origin;
+				Direction.Normalize();
+				Ray.Origin = FVector4(Origin.X, Origin.Y, Origin.Z, 1.0f);
+				Ray.Direction = FVector4(Direction.X, Direction.Y, Direction.Z, 0.0f);
+			}
+
+			// 1. 기존 경로: 이진 BVH 후보 수집 후 재검사
+			TArray<float> BinaryDistances(RayCount);
+			TArray<int32> BinaryTriangles(RayCount);
+			TArray<int32> Candidates;
+			FScopeCycleCounter BinaryCounter;
+			for (int32 i = 0; i < RayCount; ++i)
+			{
+				RaycastBinaryBVH(*Mesh, Rays[i], Candidates, BinaryDistances[i], BinaryTriangles[i]);
+			}
+			const double BinaryMilliseconds = BinaryCounter.Finish();
+
+			// 2. BVH4 SIMD 최근접 순회
+			int32 HitCount = 0;
+			int32 MismatchCount = 0;
+			int32 FirstMismatch = -1;
+			FBVHRayHit FirstMismatchHit;
+			FScopeCycleCounter WideCounter;
+			for (int32 i = 0; i < RayCount; ++i)
+			{
+				FBVHRayHit Hit;
+				const bool bIsHit = Mesh->BVH.RaycastNearest(Rays[i], Hit);
+				HitCount += bIsHit ? 1 : 0;
+				const bool bIsMismatch = bIsHit ?
+					std::fabs(Hit.Distance - BinaryDistances[i]) > 1e-3f * std::max(1.0f, Hit.Distance) :
+					BinaryDistances[i] < FLT_MAX;
+				if (bIsMismatch && MismatchCount++ == 0)
+				{
+					FirstMismatch = i;
+					FirstMismatchHit = bIsHit ? Hit : FBVHRayHit();
+				}
+			}
+			const double WideMilliseconds = WideCounter.Finish();
+
+			UE_LOG_INFO("BVHRay: %s | Tris %zu | Binary %.2f MRays/s | BVH4 %.2f MRays/s | x%.2f | Hits %d | Mismatch %d",
+				Mesh->PathFileName.ToString().c_str(), Mesh->Indices.size() / 3,
+				RayCount / std::max(BinaryMilliseconds, 1e-3) / 1000.0,
+				RayCount / std::max(WideMilliseconds, 1e-3) / 1000.0,
+				BinaryMilliseconds / std::max(WideMilliseconds, 1e-3), HitCount, MismatchCount);
+
+			if (MismatchCount > 0)
+			{
+				// 놓친 충돌은 삼각형 -1, 거리 FLT_MAX로 찍힌다
+				UE_LOG_ERROR("BVHRay: %s | %d rays differ, first ray #%d: BVH4 tri %d dist %.6f vs binary tri %d dist %.6f",
+					Mesh->PathFileName.ToString().c_str(), MismatchCount, FirstMismatch,
+					FirstMismatchHit.TriangleIndex, FirstMismatchHit.Distance, BinaryTriangles[FirstMismatch], BinaryDistances[FirstMismatch]);
+				++FailedMeshCount;
+			}
+
+			++MeshCount;
+			TotalRays += RayCount;
+			TotalMismatches += MismatchCount;
+			TotalBinaryMilliseconds += BinaryMilliseconds;
+			TotalWideMilliseconds += WideMilliseconds;
+		}
+
+		if (FailedMeshCount > 0)
+		{
+			UE_LOG_ERROR("BVHRay: %d / %d meshes failed, %lld mismatched rays", FailedMeshCount, MeshCount, TotalMismatches);
+			return;
+		}
+		UE_LOG_SUCCESS("BVHRay: %d meshes, %lld rays | BVH4 matches binary BVH on every ray | x%.2f",
+			MeshCount, TotalRays, TotalBinaryMilliseconds / std::max(TotalWideMilliseconds, 1e-3));
+	}
+}
+
+IMPLEMENT_BENCHMARK("bvhray", "Fire random rays at every loaded static mesh, compare binary BVH vs BVH4 SIMD nearest-hit", RunBVHRayBenchmark)
@@ -0,0 +1,63 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+
+TMap<FString, FBenchmarkRegistry::FBenchmarkEntry>& FBenchmarkRegistry::GetEntries()
+{
+	// 정적 초기화 순서 문제를 피하기 위해 함수 내 static으로 보관
+	static TMap<FString, FBenchmarkEntry> Entries;
+	return Entries;
+}
+
+void FBenchmarkRegistry::Register(const FString& InName, const FString& InDescription, FBenchmarkFunction InFunction)
+{
+	GetEntries()[InName] = FBenchmarkEntry{ InDescription, std::move(InFunction) };
+}
+
+bool FBenchmarkRegistry::Run(const FString& InName, const TArray<FString>& InArgs)
+{
+	auto It = GetEntries().find(InName);
+	if (It == GetEntries().end())
+	{
+		return false;
+	}
+
+	UE_LOG_SYSTEM("Benchmark: %s 시작", InName.c_str());
+	FScopeCycleCounter TotalCounter;
+	It->second.Function(InArgs);
+	UE_LOG_SYSTEM("Benchmark: %s 종료 (총 %.3fms)", InName.c_str(), TotalCounter.Finish());
+	return true;
+}
+
+void FBenchmarkRegistry::PrintList()
+{
+	TArray<FString> Names;
+	Names.reserve(GetEntries().size());
+	for (const auto& Pair : GetEntries())
+	{
+		Names.push_back(Pair.first);
+	}
+	std::sort(Names.begin(), Names.end());
+
+	UE_LOG_SYSTEM("Available Benchmarks:");
+	for (const FString& Name : Names)
+	{
+		UE_LOG_INFO("  BENCH %s - %s", Name.c_str(), GetEntries()[Name].Description.c_str());
+	}
+}
+
+int32 FBenchmarkRegistry::GetIntArg(const TArray<FString>& InArgs, size_t InIndex, int32 InDefault)
+{
+	if (InIndex >= InArgs.size())
+	{
+		return InDefault;
+	}
+
+	try
+	{
+		return std::stoi(InArgs[InIndex]);
+	}
+	catch (const std::exception&)
+	{
+		return InDefault;
+	}
+}
@@ -0,0 +1,147 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Optimization/Public/PrimitiveBoundsSoA.h"
+#include "Physics/Public/AABB.h"
+
+#include <random>
+
+namespace
+{
+	/** @brief TransformAABB 이전의 UPrimitiveComponent::GetWorldAABB, 꼭짓점 8개를 FVector4로 변환하고 성분별로 min/max */
+	void TransformAABBByCorners(const FMatrix& InMatrix, const FVector& InMin, const FVector& InMax, FVector& OutMin, FVector& OutMax)
+	{
+		const FVector LocalCorners[8] =
+		{
+			FVector(InMin.X, InMin.Y, InMin.Z), FVector(InMax.X, InMin.Y, InMin.Z),
+			FVector(InMin.X, InMax.Y, InMin.Z), FVector(InMax.X, InMax.Y, InMin.Z),
+			FVector(InMin.X, InMin.Y, InMax.Z), FVector(InMax.X, InMin.Y, InMax.Z),
+			FVector(InMin.X, InMax.Y, InMax.Z), FVector(InMax.X, InMax.Y, InMax.Z)
+		};
+
+		FVector WorldMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+		FVector WorldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (int32 Idx = 0; Idx < 8; Idx++)
+		{
+			const FVector4 WorldCorner = FVector4(LocalCorners[Idx].X, LocalCorners[Idx].Y, LocalCorners[Idx].Z, 1.0f) * InMatrix;
+			WorldMin.X = min(WorldMin.X, WorldCorner.X);
+			WorldMin.Y = min(WorldMin.Y, WorldCorner.Y);
+			WorldMin.Z = min(WorldMin.Z, WorldCorner.Z);
+			WorldMax.X = max(WorldMax.X, WorldCorner.X);
+			WorldMax.Y = max(WorldMax.Y, WorldCorner.Y);
+			WorldMax.Z = max(WorldMax.Z, WorldCorner.Z);
+		}
+
+		OutMin = WorldMin;
+		OutMax = WorldMax;
+	}
+
+	float GetMaxError(const FVector& InA, const FVector& InB)
+	{
+		return std::max(std::abs(InA.X - InB.X), std::max(std::abs(InA.Y - InB.Y), std::abs(InA.Z - InB.Z)));
+	}
+
+	/**
+	 * @brief 임의의 위치/회전/비균등 스케일을 가진 박스들의 월드 AABB를 세 가지 방식으로 계산해 비교
+	 * - 꼭짓점 8개 변환 (기존 GetWorldAABB)
+	 * - 박스 하나씩 TransformAABB (현재 GetWorldAABB)
+	 * - FPrimitiveBoundsSoA::TransformBounds로 슬롯 배열에 일괄 기록 (UpdateOctree 경로)
+	 * 중심/반경 방식은 꼭짓점 방식과 수학적으로 같은 박스이므로 부동소수 오차 안에서 결과가 일치해야 한다.
+	 * @note 인자: [박스 수] (기본 1000000), [반복 횟수] (기본 5)
+	 */
+	void RunBoundsTransformBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 BoxCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 1000000));
+		const int32 RepeatCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 5));
+
+		std::mt19937 Random(0x18018);
+		std::uniform_real_distribution<float> PositionDistribution(-500.0f, 500.0f);
+		std::uniform_real_distribution<float> AngleDistribution(-180.0f, 180.0f);
+		std::uniform_real_distribution<float> ScaleDistribution(0.1f, 4.0f);
+		std::uniform_real_distribution<float> ExtentDistribution(0.1f, 10.0f);
+
+		TArray<FMatrix> WorldMatrices(BoxCount);
+		TArray<const FMatrix*> WorldMatrixPointers(BoxCount);
+		TArray<FVector> LocalMins(BoxCount);
+		TArray<FVector> LocalMaxs(BoxCount);
+		TArray<int32> Slots(BoxCount);
+		for (int32 Index = 0; Index < BoxCount; ++Index)
+		{
+			const FVector Location(PositionDistribution(Random), PositionDistribution(Random), PositionDistribution(Random));
+			const FVector Rotation(AngleDistribution(Random), AngleDistribution(Random), AngleDistribution(Random));
+			const FVector Scale(ScaleDistribution(Random), ScaleDistribution(Random), ScaleDistribution(Random));
+			WorldMatrices[Index] = FMatrix::GetModelMatrix(Location, FQuaternion::FromEuler(Rotation), Scale);
+			WorldMatrixPointers[Index] = &WorldMatrices[Index];
+
+			const FVector Center(PositionDistribution(Random) * 0.01f, PositionDistribution(Random) * 0.01f, PositionDistribution(Random) * 0.01f);
+			const FVector Extent(ExtentDistribution(Random), ExtentDistribution(Random), ExtentDistribution(Random));
+			LocalMins[Index] = Center - Extent;
+			LocalMaxs[Index] = Center + Extent;
+			Slots[Index] = Index;
+		}
+
+		TArray<FVector> CornerMins(BoxCount), CornerMaxs(BoxCount);
+		FScopeCycleCounter CornerCounter;
+		for (int32 Repeat = 0; Repeat < RepeatCount; ++Repeat)
+		{
+			for (int32 Index = 0; Index < BoxCount; ++Index)
+			{
+				TransformAABBByCorners(WorldMatrices[Index], LocalMins[Index], LocalMaxs[Index], CornerMins[Index], CornerMaxs[Index]);
+			}
+		}
+		const double CornerMilliseconds = CornerCounter.Finish() / RepeatCount;
+
+		TArray<FVector> ExtentMins(BoxCount), ExtentMaxs(BoxCount);
+		FScopeCycleCounter ExtentCounter;
+		for (int32 Repeat = 0; Repeat < RepeatCount; ++Repeat)
+		{
+			for (int32 Index = 0; Index < BoxCount; ++Index)
+			{
+				TransformAABB(WorldMatrices[Index], LocalMins[Index], LocalMaxs[Index], ExtentMins[Index], ExtentMaxs[Index]);
+			}
+		}
+		const double ExtentMilliseconds = ExtentCounter.Finish() / RepeatCount;
+
+		// 슬롯 인덱스를 보관할 자리, 컴포넌트 없이 저수준 API로 슬롯만 만든다
+		TArray<int32> SlotRefs(BoxCount, -1);
+		FPrimitiveBoundsSoA Bounds;
+		for (int32 Index = 0; Index < BoxCount; ++Index)
+		{
+			Bounds.Add(nullptr, FVector(), FVector(), SlotRefs[Index]);
+		}
+
+		FScopeCycleCounter BatchCounter;
+		for (int32 Repeat = 0; Repeat < RepeatCount; ++Repeat)
+		{
+			Bounds.TransformBounds(Slots.data(), WorldMatrixPointers.data(), LocalMins.data(), LocalMaxs.data(), BoxCount);
+		}
+		const double BatchMilliseconds = BatchCounter.Finish() / RepeatCount;
+
+		float MaxError = 0.0f;
+		FVector BatchMin, BatchMax;
+		for (int32 Index = 0; Index < BoxCount; ++Index)
+		{
+			Bounds.GetBounds(SlotRefs[Index], BatchMin, BatchMax);
+			// 좌표 크기에 비례하는 오차를 허용하도록 박스 크기로 나눈다
+			const float Scale = std::max(1.0f, GetMaxError(CornerMaxs[Index], CornerMins[Index]));
+			MaxError = std::max(MaxError, GetMaxError(CornerMins[Index], ExtentMins[Index]) / Scale);
+			MaxError = std::max(MaxError, GetMaxError(CornerMaxs[Index], ExtentMaxs[Index]) / Scale);
+			MaxError = std::max(MaxError, GetMaxError(CornerMins[Index], BatchMin) / Scale);
+			MaxError = std::max(MaxError, GetMaxError(CornerMaxs[Index], BatchMax) / Scale);
+		}
+
+		UE_LOG_INFO("BoundsTransform: %d boxes x %d | 8 corners %.2fms (%.1f ns/box) | center-extent %.2fms (%.1f ns/box, x%.1f) | batched SoA %.2fms (%.1f ns/box, x%.1f)",
+			BoxCount, RepeatCount,
+			CornerMilliseconds, CornerMilliseconds * 1.0e6 / BoxCount,
+			ExtentMilliseconds, ExtentMilliseconds * 1.0e6 / BoxCount, ExtentMilliseconds > 0.0 ? CornerMilliseconds / ExtentMilliseconds : 0.0,
+			BatchMilliseconds, BatchMilliseconds * 1.0e6 / BoxCount, BatchMilliseconds > 0.0 ? CornerMilliseconds / BatchMilliseconds : 0.0);
+
+		if (MaxError > 1.0e-4f)
+		{
+			UE_LOG_ERROR("BoundsTransform: center-extent bounds differ from the 8-corner bounds (max relative error %g)", MaxError);
+			return;
+		}
+		UE_LOG_SUCCESS("BoundsTransform: all methods agree (max relative error %g)", MaxError);
+	}
+}
+
+IMPLEMENT_BENCHMARK("boundstransform", "Transform 1M local AABBs to world space with 8 corners, SSE center-extent, and the batched SoA kernel", RunBoundsTransformBenchmark)
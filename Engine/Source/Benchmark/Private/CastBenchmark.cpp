@@ -0,0 +1,128 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Core/Public/ObjectIterator.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Public/BillBoardComponent.h"
+#include "Component/Public/DecalComponent.h"
+#include "Component/Public/TextComponent.h"
+
+#include <random>
+
+namespace
+{
+	/** @brief 클래스 트리 번호를 쓰기 전의 IsChildOf, 부모 체인을 거슬러 올라가며 이름을 비교한다 */
+	bool IsChildOfLegacy(const UClass* InClass, const UClass* InSuperClass)
+	{
+		for (const UClass* Class = InClass; Class; Class = Class->GetSuperClass())
+		{
+			if (Class->GetName() == InSuperClass->GetName())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	template <typename T>
+	T* CastLegacy(UObject* InObject)
+	{
+		return InObject && IsChildOfLegacy(InObject->GetClass(), T::StaticClass()) ? static_cast<T*>(InObject) : nullptr;
+	}
+
+	/** @brief URenderer::RenderLevel의 프리미티브 분기와 같은 순서로 캐스팅해 어느 분기에 걸렸는지 합산한다 */
+	template <typename FCastPolicy>
+	uint64 RunCastChain(const TArray<UObject*>& InObjects, int32 InRepeatCount)
+	{
+		uint64 Checksum = 0;
+		for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			for (UObject* Object : InObjects)
+			{
+				if (FCastPolicy::template Cast<UStaticMeshComponent>(Object)) { Checksum += 1; }
+				else if (FCastPolicy::template Cast<UBillBoardComponent>(Object)) { Checksum += 2; }
+				else if (FCastPolicy::template Cast<UTextComponent>(Object)) { Checksum += 3; }
+				else if (FCastPolicy::template Cast<UDecalComponent>(Object)) { Checksum += 4; }
+				else if (FCastPolicy::template Cast<UPrimitiveComponent>(Object)) { Checksum += 5; }
+			}
+		}
+		return Checksum;
+	}
+
+	struct FLegacyCast
+	{
+		template <typename T>
+		static T* Cast(UObject* InObject) { return CastLegacy<T>(InObject); }
+	};
+
+	struct FIntervalCast
+	{
+		template <typename T>
+		static T* Cast(UObject* InObject) { return ::Cast<T>(InObject); }
+	};
+
+	/**
+	 * @brief 현재 살아 있는 모든 UObject에 렌더러의 Cast 체인을 돌려, 부모 체인 탐색과 클래스 트리 구간 비교의 처리량을 비교
+	 * 두 방식이 같은 분기를 고르는지 체크섬으로 확인하고, FindClass 해시 검색 시간도 함께 출력한다.
+	 * @note 인자: [반복 횟수] (기본 200)
+	 */
+	void RunCastBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 RepeatCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 200));
+
+		TArray<UObject*> Objects;
+		for (TObjectIterator<UObject> It; It; ++It)
+		{
+			Objects.push_back(*It);
+		}
+
+		if (Objects.empty())
+		{
+			UE_LOG_WARNING("Cast: 살아 있는 UObject가 없습니다");
+			return;
+		}
+
+		// 버킷 순서대로 모인 객체를 섞어 프레임마다 여러 클래스가 섞여 들어오는 상황과 비슷하게 만든다
+		std::shuffle(Objects.begin(), Objects.end(), std::mt19937(12345));
+
+		FScopeCycleCounter LegacyCounter;
+		const uint64 LegacyChecksum = RunCastChain<FLegacyCast>(Objects, RepeatCount);
+		const double LegacyMilliseconds = LegacyCounter.Finish();
+
+		FScopeCycleCounter IntervalCounter;
+		const uint64 IntervalChecksum = RunCastChain<FIntervalCast>(Objects, RepeatCount);
+		const double IntervalMilliseconds = IntervalCounter.Finish();
+
+		const TArray<UClass*> Classes = UClass::FindClasses(UObject::StaticClass());
+		int32 MissingClassCount = 0;
+		FScopeCycleCounter FindCounter;
+		for (int32 Repeat = 0; Repeat < RepeatCount; ++Repeat)
+		{
+			for (UClass* Class : Classes)
+			{
+				if (UClass::FindClass(Class->GetName()) != Class)
+				{
+					++MissingClassCount;
+				}
+			}
+		}
+		const double FindMilliseconds = FindCounter.Finish();
+
+		const double CastCount = static_cast<double>(Objects.size()) * RepeatCount;
+		UE_LOG_INFO("Cast: %zu objects x %d | Parent chain %.2fms (%.1f M objects/s) | Interval %.2fms (%.1f M objects/s, x%.1f)",
+			Objects.size(), RepeatCount,
+			LegacyMilliseconds, LegacyMilliseconds > 0.0 ? CastCount / (LegacyMilliseconds * 1000.0) : 0.0,
+			IntervalMilliseconds, IntervalMilliseconds > 0.0 ? CastCount / (IntervalMilliseconds * 1000.0) : 0.0,
+			IntervalMilliseconds > 0.0 ? LegacyMilliseconds / IntervalMilliseconds : 0.0);
+		UE_LOG_INFO("Cast: FindClass %zu classes x %d | %.1f ns/lookup",
+			Classes.size(), RepeatCount, FindMilliseconds * 1.0e6 / (static_cast<double>(Classes.size()) * RepeatCount));
+
+		if (LegacyChecksum != IntervalChecksum || MissingClassCount > 0)
+		{
+			UE_LOG_ERROR("Cast: 결과가 다릅니다 (checksum %llu / %llu, FindClass miss %d)", LegacyChecksum, IntervalChecksum, MissingClassCount);
+			return;
+		}
+		UE_LOG_SUCCESS("Cast: parent chain and interval casts agree (checksum %llu)", IntervalChecksum);
+	}
+}
+
+IMPLEMENT_BENCHMARK("cast", "Time the renderer's Cast chain over all live objects with parent-chain and interval IsChildOf, and FindClass lookups", RunCastBenchmark)
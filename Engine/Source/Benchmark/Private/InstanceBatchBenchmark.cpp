@@ -0,0 +1,237 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Optimization/Public/InstanceBatchBuilder.h"
+#include "Texture/Public/Material.h"
+
+#include <random>
+
+namespace
+{
+	struct FBenchmarkComponent
+	{
+		const FStaticMesh* Mesh;
+		TArray<UMaterial*> Materials;
+		FMatrix World;
+		FMatrix WorldInverse;
+	};
+
+	/** @brief FInstanceBatchBuilder 이전의 FStaticMeshPass가 매 프레임 컴포넌트마다 채우던 b0 상수 */
+	struct FLegacyModelConstants
+	{
+		FMatrix World;
+		FMatrix WorldInverseTranspose;
+	};
+
+	bool IsSameMatrix(const FMatrix& InA, const FMatrix& InB)
+	{
+		return memcmp(InA.Data, InB.Data, sizeof(InA.Data)) == 0;
+	}
+
+	/**
+	 * @brief 메시 종류가 적고 같은 메시가 많이 반복되는 레벨을 만들어 인스턴스 배치 빌드 처리량과 드로우 호출 수를 비교
+	 * - 예전 경로: 컴포넌트마다 FModelConstants 업로드 1회 + 섹션마다 DrawIndexed, Material이 바뀔 때마다 상수 업로드
+	 * - 배치 경로: FInstanceBatchBuilder로 (메시, 머티리얼 세트) 배치를 만들고 배치의 섹션마다 DrawIndexedInstanced 1회
+	 * D3D 호출은 하지 않고 CPU 준비 비용과 호출 횟수만 잰다. 마지막에 모든 인스턴스가 자기 배치 구간에 정확히 한 번,
+	 * 올바른 행렬로 들어갔는지와 머티리얼 세트가 내용별로 하나씩만 등록됐는지, 인스턴스 드로우가 모든 컴포넌트의 모든 섹션을 덮는지 확인한다.
+	 * @note 인자: [컴포넌트 수] (기본 100000), [메시 종류] (기본 32), [프레임 수] (기본 20)
+	 */
+	void RunInstanceBatchBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 ComponentCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 100000));
+		const int32 MeshCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 32));
+		const int32 FrameCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 2, 20));
+		constexpr int32 MATERIAL_COUNT = 8;
+		constexpr int32 MAX_SECTION_COUNT = 4;
+		// 컴포넌트 열 개 중 하나는 슬롯 하나의 Material을 덮어쓴다
+		constexpr int32 OVERRIDE_PERCENT = 10;
+
+		std::mt19937 Random(0x19019);
+		std::uniform_int_distribution<int32> SectionDistribution(1, MAX_SECTION_COUNT);
+		std::uniform_int_distribution<int32> MaterialDistribution(0, MATERIAL_COUNT - 1);
+		std::uniform_int_distribution<int32> MeshDistribution(0, MeshCount - 1);
+		std::uniform_int_distribution<int32> PercentDistribution(0, 99);
+		std::uniform_real_distribution<float> PositionDistribution(-1000.0f, 1000.0f);
+		std::uniform_real_distribution<float> AngleDistribution(-180.0f, 180.0f);
+		std::uniform_real_distribution<float> ScaleDistribution(0.5f, 2.0f);
+
+		TArray<UMaterial*> Materials(MATERIAL_COUNT);
+		for (UMaterial*& Material : Materials)
+		{
+			Material = new UMaterial();
+		}
+
+		// 메시마다 섹션 수와 기본 Material 목록
+		TArray<FStaticMesh> Meshes(MeshCount);
+		TArray<TArray<UMaterial*>> DefaultMaterials(MeshCount);
+		for (int32 Mesh = 0; Mesh < MeshCount; ++Mesh)
+		{
+			const int32 SectionCount = SectionDistribution(Random);
+			for (int32 Section = 0; Section < SectionCount; ++Section)
+			{
+				Meshes[Mesh].Sections.push_back({ 0, 0, static_cast<uint32>(Section) });
+				DefaultMaterials[Mesh].push_back(Materials[MaterialDistribution(Random)]);
+			}
+		}
+
+		TArray<FBenchmarkComponent> Components(ComponentCount);
+		for (FBenchmarkComponent& Component : Components)
+		{
+			const int32 Mesh = MeshDistribution(Random);
+			Component.Mesh = &Meshes[Mesh];
+			Component.Materials = DefaultMaterials[Mesh];
+			if (PercentDistribution(Random) < OVERRIDE_PERCENT)
+			{
+				Component.Materials[Random() % Component.Materials.size()] = Materials[MaterialDistribution(Random)];
+			}
+
+			const FVector Location(PositionDistribution(Random), PositionDistribution(Random), PositionDistribution(Random));
+			const FQuaternion Rotation = FQuaternion::FromEuler(FVector(AngleDistribution(Random), AngleDistribution(Random), AngleDistribution(Random)));
+			const FVector Scale(ScaleDistribution(Random), ScaleDistribution(Random), ScaleDistribution(Random));
+			Component.World = FMatrix::GetModelMatrix(Location, Rotation, Scale);
+			Component.WorldInverse = FMatrix::GetModelMatrixInverse(Location, Rotation, Scale);
+		}
+
+		// FStaticMeshPass처럼 메시 순으로 정렬해서 넘긴다
+		std::sort(Components.begin(), Components.end(), [](const FBenchmarkComponent& A, const FBenchmarkComponent& B)
+		{
+			return A.Mesh < B.Mesh;
+		});
+
+		int64 LegacyModelUploads = 0, LegacyMaterialUploads = 0, LegacyDraws = 0;
+		FLegacyModelConstants LegacyConstants;
+		float LegacySum = 0.0f;
+		FScopeCycleCounter LegacyCounter;
+		for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+		{
+			const UMaterial* CurrentMaterial = nullptr;
+			for (const FBenchmarkComponent& Component : Components)
+			{
+				LegacyConstants = { Component.World, Component.WorldInverse.Transpose() };
+				LegacySum += LegacyConstants.WorldInverseTranspose.Data[0][3];
+				++LegacyModelUploads;
+				for (const UMaterial* Material : Component.Materials)
+				{
+					if (CurrentMaterial != Material)
+					{
+						CurrentMaterial = Material;
+						++LegacyMaterialUploads;
+					}
+					++LegacyDraws;
+				}
+			}
+		}
+		const double LegacyMilliseconds = LegacyCounter.Finish();
+
+		FInstanceBatchBuilder Builder;
+		TArray<int32> MaterialSetIndices(ComponentCount);
+		TArray<int32> BatchIndices(ComponentCount);
+		int64 BatchedMaterialUploads = 0, BatchedDraws = 0;
+		FScopeCycleCounter BatchedCounter;
+		for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+		{
+			Builder.Reset();
+			for (int32 Index = 0; Index < ComponentCount; ++Index)
+			{
+				const FBenchmarkComponent& Component = Components[Index];
+				MaterialSetIndices[Index] = Builder.FindOrAddMaterialSet(Component.Materials.data(), static_cast<int32>(Component.Materials.size()));
+				BatchIndices[Index] = Builder.AddInstance(Component.Mesh, MaterialSetIndices[Index], &Component.World, &Component.WorldInverse);
+			}
+			Builder.Build();
+
+			const UMaterial* CurrentMaterial = nullptr;
+			for (const FInstanceBatch& Batch : Builder.GetBatches())
+			{
+				UMaterial* const* BatchMaterials = Builder.GetMaterialSet(Batch.MaterialSetIndex);
+				for (int32 Section = 0; Section < Builder.GetMaterialSetSize(Batch.MaterialSetIndex); ++Section)
+				{
+					if (CurrentMaterial != BatchMaterials[Section])
+					{
+						CurrentMaterial = BatchMaterials[Section];
+						++BatchedMaterialUploads;
+					}
+					++BatchedDraws;
+				}
+			}
+		}
+		const double BatchedMilliseconds = BatchedCounter.Finish();
+
+		// 마지막 프레임의 결과 검증
+		const TArray<FInstanceBatch>& Batches = Builder.GetBatches();
+		const TArray<FInstanceData>& Instances = Builder.GetInstanceData();
+		int32 BadInstances = 0;
+		int32 BadMaterialSets = 0;
+		int32 DuplicateBatches = 0;
+		TArray<uint32> NextSlots(Batches.size());
+		uint32 TotalInstances = 0;
+		// 배치의 섹션마다 InstanceCount개를 그리므로, 합이 예전 경로의 컴포넌트별 섹션 드로우 수와 같아야 빠진 섹션이 없다
+		int64 InstancedSectionDraws = 0;
+		for (size_t BatchIndex = 0; BatchIndex < Batches.size(); ++BatchIndex)
+		{
+			NextSlots[BatchIndex] = Batches[BatchIndex].FirstInstance;
+			TotalInstances += Batches[BatchIndex].InstanceCount;
+			InstancedSectionDraws += static_cast<int64>(Batches[BatchIndex].InstanceCount) * Builder.GetMaterialSetSize(Batches[BatchIndex].MaterialSetIndex);
+			for (size_t Other = 0; Other < BatchIndex; ++Other)
+			{
+				DuplicateBatches += Batches[Other].Mesh == Batches[BatchIndex].Mesh && Batches[Other].MaterialSetIndex == Batches[BatchIndex].MaterialSetIndex ? 1 : 0;
+			}
+		}
+		for (int32 Index = 0; Index < ComponentCount; ++Index)
+		{
+			const FBenchmarkComponent& Component = Components[Index];
+			const FInstanceBatch& Batch = Batches[BatchIndices[Index]];
+			const uint32 Slot = NextSlots[BatchIndices[Index]]++;
+			const bool bInRange = Slot < Batch.FirstInstance + Batch.InstanceCount && Slot < Instances.size();
+			if (!bInRange || Batch.Mesh != Component.Mesh || Batch.MaterialSetIndex != MaterialSetIndices[Index] ||
+				!IsSameMatrix(Instances[Slot].World, Component.World) ||
+				!IsSameMatrix(Instances[Slot].WorldInverseTranspose, Component.WorldInverse.Transpose()))
+			{
+				++BadInstances;
+			}
+
+			UMaterial* const* SetMaterials = Builder.GetMaterialSet(MaterialSetIndices[Index]);
+			if (Builder.GetMaterialSetSize(MaterialSetIndices[Index]) != static_cast<int32>(Component.Materials.size()) ||
+				!std::equal(Component.Materials.begin(), Component.Materials.end(), SetMaterials))
+			{
+				++BadMaterialSets;
+			}
+		}
+		for (int32 Set = 0; Set < Builder.GetMaterialSetCount(); ++Set)
+		{
+			for (int32 Other = 0; Other < Set; ++Other)
+			{
+				const int32 Size = Builder.GetMaterialSetSize(Set);
+				if (Builder.GetMaterialSetSize(Other) == Size &&
+					std::equal(Builder.GetMaterialSet(Set), Builder.GetMaterialSet(Set) + Size, Builder.GetMaterialSet(Other)))
+				{
+					++BadMaterialSets;
+				}
+			}
+		}
+
+		for (UMaterial* Material : Materials)
+		{
+			delete Material;
+		}
+
+		UE_LOG_INFO("InstanceBatch: %d components, %d meshes, %d frames | %zu batches, %d material sets",
+			ComponentCount, MeshCount, FrameCount, Batches.size(), Builder.GetMaterialSetCount());
+		UE_LOG_INFO("InstanceBatch: Per-component %.3fms/frame | Batch build %.3fms/frame (%.0f components/ms) | checksum %.3f",
+			LegacyMilliseconds / FrameCount, BatchedMilliseconds / FrameCount,
+			BatchedMilliseconds > 0.0 ? static_cast<double>(ComponentCount) * FrameCount / BatchedMilliseconds : 0.0, LegacySum);
+		UE_LOG_INFO("InstanceBatch: per frame draws %lld -> %lld, model uploads %lld -> 1 instance buffer, material uploads %lld -> %lld",
+			LegacyDraws / FrameCount, BatchedDraws / FrameCount, LegacyModelUploads / FrameCount,
+			LegacyMaterialUploads / FrameCount, BatchedMaterialUploads / FrameCount);
+
+		if (BadInstances > 0 || BadMaterialSets > 0 || DuplicateBatches > 0 || TotalInstances != static_cast<uint32>(ComponentCount) ||
+			InstancedSectionDraws != LegacyDraws / FrameCount)
+		{
+			UE_LOG_ERROR("InstanceBatch: %d bad instances, %d bad material sets, %d duplicate batches, %u / %d instances, %lld / %lld section draws",
+				BadInstances, BadMaterialSets, DuplicateBatches, TotalInstances, ComponentCount, InstancedSectionDraws, LegacyDraws / FrameCount);
+			return;
+		}
+		UE_LOG_SUCCESS("InstanceBatch: every instance is in its (mesh, material set) batch with matching matrices");
+	}
+}
+
+IMPLEMENT_BENCHMARK("instancebatch", "Build (mesh, material set) instance batches for 100k static mesh components and compare draw and upload counts with the per-component loop", RunInstanceBatchBenchmark)
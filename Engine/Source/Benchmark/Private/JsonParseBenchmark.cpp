@@ -0,0 +1,228 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Utility/Public/JsonReader.h"
+
+#include <json.hpp>
+
+namespace
+{
+	/** @brief 저장소 루트 기준 .scene 파일, 작업 디렉터리(Engine/)와 저장소 루트 모두에서 찾는다 */
+	constexpr const char* SCENE_FILES[] =
+	{
+		"Engine/Data/Scene/alley_final.scene",
+		"DecalPomTest.scene",
+		"Light.scene",
+		"test1.scene",
+	};
+
+	/** @brief 두 파서가 같은 문서를 만들었는지 비교하기 위한 값 개수와 숫자 합 */
+	struct FJsonSummary
+	{
+		uint64 ObjectCount = 0;
+		uint64 ArrayCount = 0;
+		uint64 MemberCount = 0;
+		uint64 StringCount = 0;
+		uint64 NumberCount = 0;
+		uint64 LiteralCount = 0;
+		double NumberSum = 0.0;
+
+		bool IsSame(const FJsonSummary& InOther) const
+		{
+			return ObjectCount == InOther.ObjectCount && ArrayCount == InOther.ArrayCount &&
+				MemberCount == InOther.MemberCount && StringCount == InOther.StringCount &&
+				NumberCount == InOther.NumberCount && LiteralCount == InOther.LiteralCount &&
+				fabs(NumberSum - InOther.NumberSum) <= 1e-9 * std::max(1.0, fabs(NumberSum));
+		}
+	};
+
+	void Summarize(const JSON& InJson, FJsonSummary& OutSummary)
+	{
+		switch (InJson.JSONType())
+		{
+		case JSON::Class::Object:
+			++OutSummary.ObjectCount;
+			for (const auto& Pair : InJson.ObjectRange())
+			{
+				++OutSummary.MemberCount;
+				Summarize(Pair.second, OutSummary);
+			}
+			break;
+		case JSON::Class::Array:
+			++OutSummary.ArrayCount;
+			for (const JSON& Element : InJson.ArrayRange())
+			{
+				Summarize(Element, OutSummary);
+			}
+			break;
+		case JSON::Class::String:
+			++OutSummary.StringCount;
+			break;
+		case JSON::Class::Floating:
+			++OutSummary.NumberCount;
+			OutSummary.NumberSum += InJson.ToFloat();
+			break;
+		case JSON::Class::Integral:
+			++OutSummary.NumberCount;
+			OutSummary.NumberSum += static_cast<double>(InJson.ToInt());
+			break;
+		default:
+			++OutSummary.LiteralCount;
+			break;
+		}
+	}
+
+	void Summarize(const FJsonValue& InJson, FJsonSummary& OutSummary)
+	{
+		switch (InJson.GetType())
+		{
+		case EJsonType::Object:
+			++OutSummary.ObjectCount;
+			for (const FJsonValue& Member : InJson.ObjectRange())
+			{
+				++OutSummary.MemberCount;
+				Summarize(Member, OutSummary);
+			}
+			break;
+		case EJsonType::Array:
+			++OutSummary.ArrayCount;
+			for (const FJsonValue& Element : InJson.ArrayRange())
+			{
+				Summarize(Element, OutSummary);
+			}
+			break;
+		case EJsonType::String:
+			++OutSummary.StringCount;
+			break;
+		case EJsonType::Integer:
+		case EJsonType::Float:
+			++OutSummary.NumberCount;
+			OutSummary.NumberSum += InJson.GetNumber();
+			break;
+		default:
+			++OutSummary.LiteralCount;
+			break;
+		}
+	}
+
+	bool ReadTextFile(const FString& InFilePath, FString& OutText)
+	{
+		std::ifstream File(InFilePath, std::ios::binary);
+		if (!File.is_open())
+		{
+			return false;
+		}
+		std::ostringstream Stream;
+		Stream << File.rdbuf();
+		OutText = Stream.str();
+		return true;
+	}
+
+	/**
+	 * @brief 저장소의 .scene 파일을 각각 배열로 N번 이어 붙인 문서를 json::JSON(DOM)과 FJsonDocument(테이프)로 파싱해 처리량(MB/s)을 비교
+	 * 두 결과의 값 개수와 숫자 합이 같은지도 확인한다.
+	 * @note 인자: [반복 배수] (기본 1000), [측정 횟수] (기본 3회, 가장 빠른 값 사용)
+	 */
+	void RunJsonParseBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 Scale = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 1000));
+		const int32 Iterations = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 3));
+
+		auto ToMegabytesPerSecond = [](size_t InBytes, double InMilliseconds)
+		{
+			return InMilliseconds > 0.0 ? static_cast<double>(InBytes) / (1024.0 * 1024.0) / (InMilliseconds / 1000.0) : 0.0;
+		};
+
+		double TotalDomMilliseconds = 0.0;
+		double TotalTapeMilliseconds = 0.0;
+		size_t TotalBytes = 0;
+		int32 FileCount = 0;
+		int32 MismatchCount = 0;
+
+		for (const char* SceneFile : SCENE_FILES)
+		{
+			FString SceneText;
+			if (!ReadTextFile(FString("../") + SceneFile, SceneText) && !ReadTextFile(SceneFile, SceneText))
+			{
+				UE_LOG_WARNING("JsonParse: %s 파일이 없어 건너뜀", SceneFile);
+				continue;
+			}
+
+			// 객체로 이어 붙이면 DOM이 같은 키를 합쳐 버리므로 배열 원소로 복제한다
+			FString ScaledText;
+			ScaledText.reserve((SceneText.size() + 2) * Scale + 2);
+			ScaledText += '[';
+			for (int32 Index = 0; Index < Scale; ++Index)
+			{
+				if (Index > 0)
+				{
+					ScaledText += ",\n";
+				}
+				ScaledText += SceneText;
+			}
+			ScaledText += ']';
+
+			double DomMilliseconds = DBL_MAX;
+			FJsonSummary DomSummary;
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				FScopeCycleCounter Counter;
+				JSON Json = JSON::Load(ScaledText);
+				DomMilliseconds = std::min(DomMilliseconds, static_cast<double>(Counter.Finish()));
+
+				if (Iteration == 0)
+				{
+					Summarize(Json, DomSummary);
+				}
+			}
+
+			double TapeMilliseconds = DBL_MAX;
+			FJsonSummary TapeSummary;
+			size_t StructuralCount = 0;
+			bool bIsParsed = true;
+			for (int32 Iteration = 0; Iteration < Iterations && bIsParsed; ++Iteration)
+			{
+				// Parse는 문자열을 문서로 옮겨 오므로 복사는 측정 구간 밖에서 한다
+				FString Text = ScaledText;
+				FJsonDocument Document;
+				FScopeCycleCounter Counter;
+				bIsParsed = Document.Parse(std::move(Text));
+				TapeMilliseconds = std::min(TapeMilliseconds, static_cast<double>(Counter.Finish()));
+
+				if (!bIsParsed)
+				{
+					UE_LOG_ERROR("JsonParse: %s 파싱 실패: %s", SceneFile, Document.GetError().c_str());
+				}
+				else if (Iteration == 0)
+				{
+					Summarize(Document.GetRoot(), TapeSummary);
+					StructuralCount = Document.GetStructuralCount();
+				}
+			}
+
+			if (!bIsParsed || !DomSummary.IsSame(TapeSummary))
+			{
+				UE_LOG_ERROR("JsonParse: %s 테이프 결과가 DOM과 다릅니다", SceneFile);
+				++MismatchCount;
+				continue;
+			}
+
+			UE_LOG_INFO("JsonParse: %s x%d | %.2f MB, %zu structurals | DOM %.1fms (%.1f MB/s) | Tape %.1fms (%.1f MB/s, x%.1f)",
+				SceneFile, Scale, static_cast<double>(ScaledText.size()) / (1024.0 * 1024.0), StructuralCount,
+				DomMilliseconds, ToMegabytesPerSecond(ScaledText.size(), DomMilliseconds),
+				TapeMilliseconds, ToMegabytesPerSecond(ScaledText.size(), TapeMilliseconds),
+				TapeMilliseconds > 0.0 ? DomMilliseconds / TapeMilliseconds : 0.0);
+
+			TotalDomMilliseconds += DomMilliseconds;
+			TotalTapeMilliseconds += TapeMilliseconds;
+			TotalBytes += ScaledText.size();
+			++FileCount;
+		}
+
+		UE_LOG_SUCCESS("JsonParse: %d files, %.2f MB | DOM %.1f MB/s | Tape %.1f MB/s (x%.1f) | %d mismatch",
+			FileCount, static_cast<double>(TotalBytes) / (1024.0 * 1024.0),
+			ToMegabytesPerSecond(TotalBytes, TotalDomMilliseconds), ToMegabytesPerSecond(TotalBytes, TotalTapeMilliseconds),
+			TotalTapeMilliseconds > 0.0 ? TotalDomMilliseconds / TotalTapeMilliseconds : 0.0, MismatchCount);
+	}
+}
+
+IMPLEMENT_BENCHMARK("jsonparse", "Parse the repo .scene files scaled 1000x with json::JSON and FJsonDocument, report MB/s", RunJsonParseBenchmark)
@@ -0,0 +1,254 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+namespace
+{
+	struct FLODInstance
+	{
+		const FStaticMesh* Mesh = nullptr;
+		FVector Min;
+		FVector Max;
+		int32 LOD = 0;
+		int32 LODWithoutHysteresis = 0;
+	};
+
+	/** @brief UCamera::UpdateMatrixByPers와 같은 View / Projection, 카메라는 +X를 본다 */
+	FCameraConstants MakeCamera(const FVector& InEye, float InFovY, float InAspect)
+	{
+		FCameraConstants Camera;
+		Camera.View = FMatrix::TranslationMatrixInverse(InEye) *
+			FMatrix(FVector(0.0f, 1.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f), FVector(1.0f, 0.0f, 0.0f)).Transpose();
+
+		constexpr float NearZ = 0.1f;
+		constexpr float FarZ = 5000.0f;
+		const float F = 1.0f / tanf(FVector::GetDegreeToRadian(InFovY) * 0.5f);
+		FMatrix Projection = FMatrix::Identity();
+		Projection.Data[0][0] = F / InAspect;
+		Projection.Data[1][1] = F;
+		Projection.Data[2][2] = FarZ / (FarZ - NearZ);
+		Projection.Data[2][3] = 1.0f;
+		Projection.Data[3][2] = (-NearZ * FarZ) / (FarZ - NearZ);
+		Projection.Data[3][3] = 0.0f;
+		Camera.Projection = Projection;
+
+		Camera.ViewWorldLocation = InEye;
+		Camera.NearClip = NearZ;
+		Camera.FarClip = FarZ;
+		return Camera;
+	}
+
+	/** @brief ViewVolumeCuller::Cull과 같은 방식으로 View * Projection에서 절두체 평면을 뽑는다 */
+	FFrustum ExtractFrustum(const FMatrix& InViewProj)
+	{
+		FFrustum Frustum;
+		Frustum.Planes[0] = InViewProj[3] + InViewProj[0];
+		Frustum.Planes[1] = InViewProj[3] - InViewProj[0];
+		Frustum.Planes[2] = InViewProj[3] + InViewProj[1];
+		Frustum.Planes[3] = InViewProj[3] - InViewProj[1];
+		Frustum.Planes[4] = InViewProj[2];
+		Frustum.Planes[5] = InViewProj[3] - InViewProj[2];
+
+		for (FVector4& Plane : Frustum.Planes)
+		{
+			const float Length = sqrtf(Plane.X * Plane.X + Plane.Y * Plane.Y + Plane.Z * Plane.Z);
+			Plane /= -Length;
+		}
+		return Frustum;
+	}
+
+	/** @brief 히스테리시스 없이 전환 화면 크기만으로 고른 LOD */
+	int32 SelectLODWithoutHysteresis(const FStaticMesh& InMesh, float InScreenSize)
+	{
+		int32 LOD = 0;
+		while (LOD + 1 < InMesh.GetNumLODs() && InScreenSize < InMesh.LODs[LOD].ScreenSize)
+		{
+			++LOD;
+		}
+		return LOD;
+	}
+
+	/**
+	 * @brief LOD 체인이 갈수록 거칠어지는지, 화면 크기를 한 방향으로만 바꿀 때 고른 LOD가 되돌아가지 않는지 검사
+	 * @note 화면 크기를 첫 전환점보다 충분히 큰 값에서 0으로 줄였다가 다시 키우며 히스테리시스를 포함한 SelectLOD를 따라간다
+	 */
+	bool IsLODSelectionMonotonic(const FStaticMesh& InMesh)
+	{
+		const int32 LODCount = InMesh.GetNumLODs();
+		for (int32 LOD = 1; LOD < LODCount; ++LOD)
+		{
+			if (InMesh.GetLODIndexCount(LOD) >= InMesh.GetLODIndexCount(LOD - 1) ||
+				(LOD >= 2 && InMesh.LODs[LOD - 1].ScreenSize >= InMesh.LODs[LOD - 2].ScreenSize))
+			{
+				return false;
+			}
+		}
+
+		constexpr int32 Steps = 1024;
+		const float MaxScreenSize = 2.0f * std::max(1.0f, InMesh.LODs.empty() ? 1.0f : InMesh.LODs[0].ScreenSize);
+		int32 CurrentLOD = 0;
+		for (int32 Step = 0; Step <= 2 * Steps; ++Step)
+		{
+			const bool bIsShrinking = Step <= Steps;
+			const float ScreenSize = MaxScreenSize * static_cast<float>(bIsShrinking ? Steps - Step : Step - Steps) / Steps;
+			const int32 LOD = UStaticMeshComponent::SelectLOD(InMesh, ScreenSize, CurrentLOD);
+			if (LOD < 0 || LOD >= LODCount || (bIsShrinking ? LOD < CurrentLOD : LOD > CurrentLOD))
+			{
+				return false;
+			}
+			CurrentLOD = LOD;
+		}
+		return CurrentLOD == 0;
+	}
+
+	/**
+	 * @brief LOD가 있는 Data/ 메시를 격자로 늘어놓고 카메라가 격자를 가로질러 왕복할 때 프레임당 그리는 삼각형 수와 LOD 전환 횟수를 측정
+	 * 매 프레임 절두체 컬링 후 ViewVolumeCuller::ComputeScreenSize와 UStaticMeshComponent::SelectLOD로 고르고,
+	 * LOD0만 그릴 때와 히스테리시스 없이 고를 때를 함께 보고한다.
+	 * 메시마다 LOD 단조성을, 프레임마다 히스테리시스가 이전 LOD와 목표 LOD 사이에서만 고르는지를 검증한다.
+	 * @note 인자: [격자 한 변의 인스턴스 수=32] [프레임 수=600]
+	 */
+	void RunLODSelectBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 GridSize = std::clamp(FBenchmarkRegistry::GetIntArg(InArgs, 0, 32), 1, 512);
+		const int32 Frames = std::max(2, FBenchmarkRegistry::GetIntArg(InArgs, 1, 600));
+		constexpr float Aspect = 16.0f / 9.0f;
+		constexpr float FovY = 90.0f;
+
+		TArray<std::unique_ptr<FStaticMesh>> Meshes;
+		const FString DataDirectory = "Data/";
+		if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
+		{
+			// UAssetManager::LoadAllObjStaticMesh와 같은 설정, 캐시 없이 LOD까지 빌드한다
+			FObjImporter::Configuration Config;
+			Config.bFlipWindingOrder = false;
+			Config.bIsBinaryEnabled = false;
+			Config.bPositionToUEBasis = true;
+			Config.bNormalToUEBasis = true;
+			Config.bUVToUEBasis = true;
+
+			for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+			{
+				if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+				{
+					std::unique_ptr<FStaticMesh> Mesh = FObjManager::ImportStaticMesh(FName(Entry.path().generic_string()), Config);
+					if (Mesh && !Mesh->LODs.empty())
+					{
+						Meshes.push_back(std::move(Mesh));
+					}
+				}
+			}
+		}
+
+		if (Meshes.empty())
+		{
+			UE_LOG_WARNING("LODSelect: %s 아래에 LOD가 만들어진 .obj 파일이 없습니다", DataDirectory.c_str());
+			return;
+		}
+
+		int32 NonMonotonicMeshCount = 0;
+		for (const std::unique_ptr<FStaticMesh>& Mesh : Meshes)
+		{
+			NonMonotonicMeshCount += IsLODSelectionMonotonic(*Mesh) ? 0 : 1;
+		}
+
+		// 메시마다 크기가 다르므로 AABB 대각선을 1로 맞춘 셀에 하나씩 놓는다고 보고 배율을 곱해 월드 경계를 만든다
+		TArray<FLODInstance> Instances;
+		constexpr float CellSize = 2.0f;
+		for (int32 CellY = 0; CellY < GridSize; ++CellY)
+		{
+			for (int32 CellX = 0; CellX < GridSize; ++CellX)
+			{
+				const FStaticMesh* Mesh = Meshes[(CellX + CellY * GridSize) % Meshes.size()].get();
+				FVector LocalMin(FLT_MAX, FLT_MAX, FLT_MAX);
+				FVector LocalMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+				for (const FNormalVertex& Vertex : Mesh->Vertices)
+				{
+					LocalMin = FVector(std::min(LocalMin.X, Vertex.Position.X), std::min(LocalMin.Y, Vertex.Position.Y), std::min(LocalMin.Z, Vertex.Position.Z));
+					LocalMax = FVector(std::max(LocalMax.X, Vertex.Position.X), std::max(LocalMax.Y, Vertex.Position.Y), std::max(LocalMax.Z, Vertex.Position.Z));
+				}
+				const FVector HalfExtent = (LocalMax - LocalMin) * (0.5f / std::max((LocalMax - LocalMin).Length(), MATH_EPSILON));
+				const FVector Center(CellX * CellSize, (CellY - GridSize * 0.5f) * CellSize, 0.0f);
+
+				FLODInstance Instance;
+				Instance.Mesh = Mesh;
+				Instance.Min = Center - HalfExtent;
+				Instance.Max = Center + HalfExtent;
+				Instances.push_back(Instance);
+			}
+		}
+
+		// 격자 앞에서 출발해 끝까지 갔다가 돌아오며, 눈높이에서 +X를 본다
+		TArray<FCameraConstants> Cameras;
+		const float PathLength = GridSize * CellSize + 4.0f;
+		for (int32 Frame = 0; Frame < Frames; ++Frame)
+		{
+			const float Phase = 2.0f * static_cast<float>(Frame) / static_cast<float>(Frames - 1);
+			const float Progress = Phase <= 1.0f ? Phase : 2.0f - Phase;
+			Cameras.push_back(MakeCamera(FVector(-4.0f + Progress * PathLength, 0.0f, 0.5f), FovY, Aspect));
+		}
+
+		uint64 VisibleTotal = 0;
+		uint64 LOD0Triangles = 0;
+		uint64 LODTriangles = 0;
+		uint64 MaxLOD0Triangles = 0;
+		uint64 MaxLODTriangles = 0;
+		uint64 Switches = 0;
+		uint64 SwitchesWithoutHysteresis = 0;
+		uint64 OvershootCount = 0;
+
+		FScopeCycleCounter Counter;
+		for (const FCameraConstants& Camera : Cameras)
+		{
+			const FFrustum Frustum = ExtractFrustum(Camera.View * Camera.Projection);
+			uint64 FrameLOD0Triangles = 0;
+			uint64 FrameLODTriangles = 0;
+			for (FLODInstance& Instance : Instances)
+			{
+				if (Frustum.CheckIntersection(FAABB(Instance.Min, Instance.Max)) == EBoundCheckResult::Outside)
+				{
+					continue;
+				}
+
+				const float ScreenSize = ViewVolumeCuller::ComputeScreenSize(Instance.Min, Instance.Max, Camera);
+				const int32 LOD = UStaticMeshComponent::SelectLOD(*Instance.Mesh, ScreenSize, Instance.LOD);
+				const int32 LODWithoutHysteresis = SelectLODWithoutHysteresis(*Instance.Mesh, ScreenSize);
+				// 히스테리시스는 전환을 늦출 뿐이므로 결과는 이전 LOD와 목표 LOD 사이에 있어야 한다
+				OvershootCount += LOD < std::min(Instance.LOD, LODWithoutHysteresis) || LOD > std::max(Instance.LOD, LODWithoutHysteresis) ? 1 : 0;
+				Switches += LOD != Instance.LOD ? 1 : 0;
+				SwitchesWithoutHysteresis += LODWithoutHysteresis != Instance.LODWithoutHysteresis ? 1 : 0;
+				Instance.LOD = LOD;
+				Instance.LODWithoutHysteresis = LODWithoutHysteresis;
+
+				++VisibleTotal;
+				FrameLOD0Triangles += Instance.Mesh->Indices.size() / 3;
+				FrameLODTriangles += Instance.Mesh->GetLODIndexCount(LOD) / 3;
+			}
+			LOD0Triangles += FrameLOD0Triangles;
+			LODTriangles += FrameLODTriangles;
+			MaxLOD0Triangles = std::max(MaxLOD0Triangles, FrameLOD0Triangles);
+			MaxLODTriangles = std::max(MaxLODTriangles, FrameLODTriangles);
+		}
+		const double TotalMs = Counter.Finish();
+
+		UE_LOG_INFO("LODSelect: %zu meshes with LODs | %dx%d grid, %zu instances, %d frames | %.1f visible/frame",
+			Meshes.size(), GridSize, GridSize, Instances.size(), Frames, static_cast<double>(VisibleTotal) / Frames);
+		UE_LOG_INFO("LODSelect:   LOD0 only      %.0f tris/frame (max %llu)", static_cast<double>(LOD0Triangles) / Frames, MaxLOD0Triangles);
+		UE_LOG_INFO("LODSelect:   screen size    %.0f tris/frame (max %llu) | switches %llu with hysteresis, %llu without",
+			static_cast<double>(LODTriangles) / Frames, MaxLODTriangles, Switches, SwitchesWithoutHysteresis);
+
+		if (NonMonotonicMeshCount > 0 || OvershootCount > 0)
+		{
+			UE_LOG_ERROR("LODSelect: %d meshes with non-monotonic LODs | %llu selections outside [previous, target]",
+				NonMonotonicMeshCount, OvershootCount);
+			return;
+		}
+		UE_LOG_SUCCESS("LODSelect: x%.2f fewer triangles | cull + select %.4fms/frame",
+			LODTriangles > 0 ? static_cast<double>(LOD0Triangles) / LODTriangles : 0.0, TotalMs / Frames);
+	}
+}
+
+IMPLEMENT_BENCHMARK("lodselect", "Fly a camera over a grid of LOD meshes and report triangles per frame and LOD switches with and without hysteresis", RunLODSelectBenchmark)
@@ -0,0 +1,197 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Actor/Public/Actor.h"
+#include "Core/Public/NewObject.h"
+#include "Level/Public/Level.h"
+#include "Level/Public/LevelBinary.h"
+#include "Manager/Config/Public/ConfigManager.h"
+#include "Editor/Public/Viewport.h"
+#include "Render/Renderer/Public/Renderer.h"
+#include "Utility/Public/JsonSerializer.h"
+
+#include <json.hpp>
+
+namespace
+{
+	constexpr const char* SOURCE_SCENE = "Data/Scene/alley_final.scene";
+	constexpr const char* JSON_SCENE = "Data/Scene/levelio_bench.scene";
+	constexpr const char* BINARY_SCENE = "Data/Scene/levelio_bench.scenebin";
+
+	/** @brief 원본 .scene의 액터를 InActorCount개가 될 때까지 격자로 옮겨 복제한 JSON을 만든다 */
+	bool BuildReplicatedScene(int32 InActorCount, JSON& OutSceneJson)
+	{
+		JSON SourceJson;
+		if (!FJsonSerializer::LoadJsonFromFile(SourceJson, SOURCE_SCENE) &&
+			!FJsonSerializer::LoadJsonFromFile(SourceJson, FString("../") + SOURCE_SCENE))
+		{
+			return false;
+		}
+
+		JSON SourceActors;
+		if (!FJsonSerializer::ReadObject(SourceJson, "Actors", SourceActors, nullptr, false) || SourceActors.size() == 0)
+		{
+			return false;
+		}
+
+		TArray<JSON> Templates;
+		for (auto& Pair : SourceActors.ObjectRange())
+		{
+			Templates.push_back(Pair.second);
+		}
+
+		const int32 CopyCount = (InActorCount + static_cast<int32>(Templates.size()) - 1) / static_cast<int32>(Templates.size());
+		const int32 GridSize = std::max(1, static_cast<int32>(ceilf(sqrtf(static_cast<float>(CopyCount)))));
+		constexpr float CellSize = 100.0f;
+
+		JSON Actors = json::Object();
+		for (int32 Index = 0; Index < InActorCount; ++Index)
+		{
+			const int32 Copy = Index / static_cast<int32>(Templates.size());
+			const FVector Offset(static_cast<float>(Copy % GridSize) * CellSize, static_cast<float>(Copy / GridSize) * CellSize, 0.0f);
+
+			// 루트 컴포넌트와 액터 위치가 같은 값으로 저장되어 있으므로 둘 다 옮긴다
+			JSON Actor = Templates[Index % Templates.size()];
+			FVector Location;
+			FJsonSerializer::ReadVector(Actor, "Location", Location, FVector::Zero(), false);
+			Actor["Location"] = FJsonSerializer::VectorToJson(Location + Offset);
+
+			for (JSON& Component : Actor["Components"].ArrayRange())
+			{
+				FString ParentName;
+				FJsonSerializer::ReadString(Component, "ParentName", ParentName, "", false);
+				if (ParentName.empty())
+				{
+					FJsonSerializer::ReadVector(Component, "Location", Location, FVector::Zero(), false);
+					Component["Location"] = FJsonSerializer::VectorToJson(Location + Offset);
+				}
+			}
+
+			Actors[std::to_string(Index)] = Actor;
+		}
+
+		OutSceneJson = SourceJson;
+		OutSceneJson["Actors"] = Actors;
+		return true;
+	}
+
+	/** @brief 두 레벨의 액터를 순서대로 JSON으로 저장해 비교, 바이너리 왕복이 JSON 로드와 같은 상태를 만드는지 확인한다 */
+	int32 CountMismatchedActors(ULevel& InA, ULevel& InB)
+	{
+		const TArray<AActor*>& ActorsA = InA.GetLevelActors();
+		const TArray<AActor*>& ActorsB = InB.GetLevelActors();
+		int32 MismatchCount = static_cast<int32>(std::max(ActorsA.size(), ActorsB.size()) - std::min(ActorsA.size(), ActorsB.size()));
+
+		for (size_t Index = 0; Index < std::min(ActorsA.size(), ActorsB.size()); ++Index)
+		{
+			JSON JsonA, JsonB;
+			ActorsA[Index]->Serialize(false, JsonA);
+			ActorsB[Index]->Serialize(false, JsonB);
+			if (ActorsA[Index]->GetClass() != ActorsB[Index]->GetClass() || JsonA.dump() != JsonB.dump())
+			{
+				++MismatchCount;
+			}
+		}
+		return MismatchCount;
+	}
+
+	/**
+	 * @brief alley_final.scene의 액터를 복제한 레벨을 JSON(.scene)과 바이너리(.scenebin)로 저장/로드하는 시간을 비교
+	 * 바이너리로 다시 읽은 레벨은 JSON으로 읽은 레벨과 액터 단위로 같은 JSON을 만드는지 확인한다.
+	 * @note 인자: [액터 수] (기본 50000), 임시 파일은 Data/Scene 아래에 만들고 끝나면 지운다
+	 */
+	void RunLevelIOBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 ActorCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 50000));
+
+		JSON SceneJson;
+		if (!BuildReplicatedScene(ActorCount, SceneJson) || !FJsonSerializer::SaveJsonToFile(SceneJson, JSON_SCENE))
+		{
+			UE_LOG_ERROR("LevelIO: %s를 읽거나 임시 레벨을 쓰지 못했습니다", SOURCE_SCENE);
+			return;
+		}
+
+		// 레벨 로드가 뷰포트 카메라를 덮어쓰므로 끝나면 되돌린다
+		FViewportCameraData Cameras[4];
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			Cameras[Index] = UConfigManager::GetInstance().GetViewportCameraData(Index);
+		}
+
+		ULevel* JsonLevel = NewObject<ULevel>();
+		ULevel* BinaryLevel = NewObject<ULevel>();
+
+		// 문서가 파일 매핑을 쥐고 있으므로 임시 파일을 다시 쓰기 전에 해제한다
+		double JsonLoadMilliseconds = 0.0;
+		{
+			FScopeCycleCounter JsonLoadCounter;
+			FJsonDocument LoadedDocument;
+			if (FJsonSerializer::LoadJsonFromFile(LoadedDocument, JSON_SCENE))
+			{
+				JsonLevel->Deserialize(LoadedDocument.GetRoot());
+			}
+			JsonLoadMilliseconds = JsonLoadCounter.Finish();
+		}
+
+		FScopeCycleCounter JsonSaveCounter;
+		JSON SavedJson;
+		JsonLevel->Serialize(false, SavedJson);
+		FJsonSerializer::SaveJsonToFile(SavedJson, JSON_SCENE);
+		const double JsonSaveMilliseconds = JsonSaveCounter.Finish();
+
+		FScopeCycleCounter BinarySaveCounter;
+		const bool bIsSaved = FLevelBinary::Save(*JsonLevel, BINARY_SCENE);
+		const double BinarySaveMilliseconds = BinarySaveCounter.Finish();
+
+		// 매핑이 남아 있으면 임시 파일을 지울 수 없으므로 리더는 측정 구간 안에서만 산다
+		bool bIsOpened = false;
+		double BinaryLoadMilliseconds = 0.0;
+		{
+			FScopeCycleCounter BinaryLoadCounter;
+			FLevelBinaryReader Reader;
+			bIsOpened = bIsSaved && Reader.Open(BINARY_SCENE);
+			if (bIsOpened)
+			{
+				Reader.Load(*BinaryLevel);
+			}
+			BinaryLoadMilliseconds = BinaryLoadCounter.Finish();
+		}
+
+		const size_t LoadedActorCount = JsonLevel->GetLevelActors().size();
+		size_t LoadedComponentCount = 0;
+		for (AActor* Actor : BinaryLevel->GetLevelActors())
+		{
+			LoadedComponentCount += Actor->GetOwnedComponents().size();
+		}
+		const int32 MismatchCount = bIsOpened ? CountMismatchedActors(*JsonLevel, *BinaryLevel) : static_cast<int32>(LoadedActorCount);
+
+		std::error_code Error;
+		const double JsonMegabytes = static_cast<double>(std::filesystem::file_size(JSON_SCENE, Error)) / (1024.0 * 1024.0);
+		const double BinaryMegabytes = bIsSaved ? static_cast<double>(std::filesystem::file_size(BINARY_SCENE, Error)) / (1024.0 * 1024.0) : 0.0;
+
+		SafeDelete(JsonLevel);
+		SafeDelete(BinaryLevel);
+		std::filesystem::remove(JSON_SCENE, Error);
+		std::filesystem::remove(BINARY_SCENE, Error);
+
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			UConfigManager::GetInstance().SetViewportCameraData(Index, Cameras[Index]);
+		}
+		URenderer::GetInstance().GetViewportClient()->ApplyAllCameraDataToViewportClients();
+
+		UE_LOG_INFO("LevelIO: JSON   %.2f MB | Load %.1fms | Save %.1fms", JsonMegabytes, JsonLoadMilliseconds, JsonSaveMilliseconds);
+		UE_LOG_INFO("LevelIO: Binary %.2f MB | Load %.1fms (x%.1f) | Save %.1fms (x%.1f)",
+			BinaryMegabytes,
+			BinaryLoadMilliseconds, BinaryLoadMilliseconds > 0.0 ? JsonLoadMilliseconds / BinaryLoadMilliseconds : 0.0,
+			BinarySaveMilliseconds, BinarySaveMilliseconds > 0.0 ? JsonSaveMilliseconds / BinarySaveMilliseconds : 0.0);
+
+		if (!bIsOpened || MismatchCount > 0)
+		{
+			UE_LOG_ERROR("LevelIO: 바이너리 왕복 결과가 JSON 로드와 다릅니다 (%d / %zu actors)", MismatchCount, LoadedActorCount);
+			return;
+		}
+		UE_LOG_SUCCESS("LevelIO: %zu actors, %zu components | binary round trip matches JSON", LoadedActorCount, LoadedComponentCount);
+	}
+}
+
+IMPLEMENT_BENCHMARK("levelio", "Save and load a replicated alley_final.scene as JSON and as .scenebin, verify the binary round trip", RunLevelIOBenchmark)
@@ -0,0 +1,201 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Core/Public/JobSystem.h"
+#include "Optimization/Public/ClusteredLightCuller.h"
+
+#include <random>
+
+namespace
+{
+	constexpr uint32 VIEWPORT_WIDTH = 1920;
+	constexpr uint32 VIEWPORT_HEIGHT = 1080;
+
+	/** @brief 브루트포스 기준 구현은 (라이트 수 x 클러스터 수)가 이보다 작을 때만 돌린다 */
+	constexpr uint64 MAX_REFERENCE_PAIRS = 1ull << 28;
+
+	/** @brief UCamera::UpdateMatrixByPers와 같은 View / Projection, 원점에서 +X를 바라본다 */
+	FCullingParams MakeCullingParams()
+	{
+		constexpr float NearZ = 0.1f;
+		constexpr float FarZ = 1000.0f;
+		constexpr float FovY = 90.0f;
+		const float Aspect = static_cast<float>(VIEWPORT_WIDTH) / static_cast<float>(VIEWPORT_HEIGHT);
+
+		FCullingParams Params = {};
+		Params.View = FMatrix::TranslationMatrixInverse(FVector(0.0f, 0.0f, 0.0f)) *
+			FMatrix(FVector(0.0f, 1.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f), FVector(1.0f, 0.0f, 0.0f)).Transpose();
+
+		const float F = 1.0f / tanf(FVector::GetDegreeToRadian(FovY) * 0.5f);
+		Params.Projection = FMatrix::Identity();
+		Params.Projection.Data[0][0] = F / Aspect;
+		Params.Projection.Data[1][1] = F;
+		Params.Projection.Data[2][2] = FarZ / (FarZ - NearZ);
+		Params.Projection.Data[2][3] = 1.0f;
+		Params.Projection.Data[3][2] = (-NearZ * FarZ) / (FarZ - NearZ);
+		Params.Projection.Data[3][3] = 0.0f;
+
+		Params.ViewportSize[0] = VIEWPORT_WIDTH;
+		Params.ViewportSize[1] = VIEWPORT_HEIGHT;
+		Params.NearClip = NearZ;
+		Params.FarClip = FarZ;
+		return Params;
+	}
+
+	/** @brief 카메라 앞 상자에 점 광원 70%, 스포트라이트 30%를 흩뿌리고 앞의 두 개는 앰비언트/디렉셔널 */
+	TArray<FLightParams> MakeLights(int32 InLightCount)
+	{
+		std::mt19937 Random(0x11647);
+		std::uniform_real_distribution<float> DepthDistribution(1.0f, 400.0f);
+		std::uniform_real_distribution<float> SideDistribution(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> RadiusDistribution(2.0f, 12.0f);
+		std::uniform_real_distribution<float> AngleDistribution(10.0f, 60.0f);
+		std::uniform_real_distribution<float> UnitDistribution(0.0f, 1.0f);
+
+		TArray<FLightParams> Lights(InLightCount);
+		for (int32 Index = 0; Index < InLightCount; ++Index)
+		{
+			FLightParams& Light = Lights[Index];
+			Light.Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+			if (Index < 2)
+			{
+				Light.Position = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+				Light.Direction = FVector4(0.0f, 0.0f, -1.0f, static_cast<float>(Index == 0 ? ELightType::Ambient : ELightType::Directional));
+				Light.Angles = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+				continue;
+			}
+
+			// 원근 절두체 모양에 맞춰 옆 범위를 깊이에 비례시켜 화면 밖 라이트도 일부 섞는다
+			const float Depth = DepthDistribution(Random);
+			const float Radius = RadiusDistribution(Random);
+			Light.Position = FVector4(Depth, SideDistribution(Random) * Depth * 1.9f, SideDistribution(Random) * Depth * 1.1f, Radius);
+
+			if (UnitDistribution(Random) < 0.7f)
+			{
+				Light.Direction = FVector4(0.0f, 0.0f, 0.0f, static_cast<float>(ELightType::Point));
+				Light.Angles = FVector4(0.0f, 0.0f, 1.0f, 0.0f);
+				continue;
+			}
+
+			FVector Direction(SideDistribution(Random), SideDistribution(Random), SideDistribution(Random));
+			if (Direction.Length() < 1e-3f)
+			{
+				Direction = FVector(0.0f, 0.0f, -1.0f);
+			}
+			Direction.Normalize();
+
+			const float OuterCos = cosf(FVector::GetDegreeToRadian(AngleDistribution(Random)));
+			Light.Direction = FVector4(Direction.X, Direction.Y, Direction.Z, static_cast<float>(ELightType::Spot));
+			Light.Angles = FVector4(std::min(OuterCos + 0.05f, 1.0f), OuterCos, 1.0f, 1.0f / (Radius * Radius));
+		}
+		return Lights;
+	}
+
+	bool IsSameResult(const FClusteredLightCuller& InA, const FClusteredLightCuller& InB)
+	{
+		const TArray<FClusterLightInfo>& InfoA = InA.GetClusterLightInfo();
+		const TArray<FClusterLightInfo>& InfoB = InB.GetClusterLightInfo();
+		if (InfoA.size() != InfoB.size() || InA.GetLightIndices() != InB.GetLightIndices())
+		{
+			return false;
+		}
+
+		for (size_t Index = 0; Index < InfoA.size(); ++Index)
+		{
+			if (InfoA[Index].Offset != InfoB[Index].Offset || InfoA[Index].Count != InfoB[Index].Count)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief 1920x1080 뷰포트에 라이트를 1k ~ 64k개 배치하고 CPU 클러스터 라이트 배정을 직렬/병렬로 측정
+	 * 병렬 결과는 직렬 결과와, 쌍 수가 작으면 브루트포스 스칼라 구현(BuildReference)과도 비트 단위로 비교한다.
+	 * @note 인자: [라이트 수] (기본 0 = 1k, 4k, 16k, 64k 모두) [워커 수] (기본: 하드웨어 스레드 - 1) [반복 횟수] (기본 5회, 가장 빠른 값 사용)
+	 */
+	void RunLightClusterBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 RequestedLightCount = std::max(0, FBenchmarkRegistry::GetIntArg(InArgs, 0, 0));
+		const int32 WorkerCount = std::max(0, FBenchmarkRegistry::GetIntArg(InArgs, 1, static_cast<int32>(FJobSystem::GetDefaultWorkerCount())));
+		const int32 Iterations = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 2, 5));
+
+		TArray<int32> LightCounts;
+		if (RequestedLightCount > 0)
+		{
+			LightCounts.push_back(RequestedLightCount);
+		}
+		else
+		{
+			LightCounts = { 1024, 4096, 16384, 65536 };
+		}
+
+		const FCullingParams Params = MakeCullingParams();
+		FJobSystem JobSystem(static_cast<uint32>(WorkerCount));
+		int32 MismatchCount = 0;
+
+		for (const int32 LightCount : LightCounts)
+		{
+			const TArray<FLightParams> Lights = MakeLights(LightCount);
+
+			auto Measure = [&](FClusteredLightCuller& OutCuller, FJobSystem* InJobSystem)
+			{
+				double Milliseconds = DBL_MAX;
+				for (int32 i = 0; i < Iterations; ++i)
+				{
+					FScopeCycleCounter Counter;
+					OutCuller.Build(Params, Lights, InJobSystem);
+					Milliseconds = std::min(Milliseconds, static_cast<double>(Counter.Finish()));
+				}
+				return Milliseconds;
+			};
+
+			FClusteredLightCuller SerialCuller;
+			FClusteredLightCuller ParallelCuller;
+			const double SerialMilliseconds = Measure(SerialCuller, nullptr);
+			const double ParallelMilliseconds = Measure(ParallelCuller, &JobSystem);
+
+			bool bIsSame = IsSameResult(SerialCuller, ParallelCuller);
+			const uint32 ClusterCount = ParallelCuller.GetClusterCount();
+			const bool bIsReferenceChecked = static_cast<uint64>(LightCount) * ClusterCount <= MAX_REFERENCE_PAIRS;
+			if (bIsReferenceChecked)
+			{
+				FClusteredLightCuller ReferenceCuller;
+				ReferenceCuller.BuildReference(Params, Lights);
+				bIsSame = bIsSame && IsSameResult(ReferenceCuller, ParallelCuller);
+			}
+
+			if (!bIsSame)
+			{
+				UE_LOG_ERROR("LightCluster: %d lights 병렬 결과가 %s 결과와 다릅니다", LightCount, bIsReferenceChecked ? "직렬/기준" : "직렬");
+				++MismatchCount;
+				continue;
+			}
+
+			uint32 MaxCount = 0;
+			uint32 OccupiedCount = 0;
+			for (const FClusterLightInfo& Info : ParallelCuller.GetClusterLightInfo())
+			{
+				MaxCount = std::max(MaxCount, Info.Count);
+				OccupiedCount += Info.Count > 0 ? 1 : 0;
+			}
+
+			// 기존 URenderer::CreateLightCullBuffers의 고정 크기: 1024 * 클러스터 수 * 8 (+ 카운터 1개)
+			const size_t IndexCount = ParallelCuller.GetLightIndices().size();
+			const double CompactMegabytes = static_cast<double>(sizeof(uint32) * IndexCount + sizeof(FClusterLightInfo) * ClusterCount) / (1024.0 * 1024.0);
+			const double FixedMegabytes = static_cast<double>(sizeof(uint32) * (1024ull * ClusterCount * 8 + 1) + sizeof(FClusterLightInfo) * ClusterCount) / (1024.0 * 1024.0);
+
+			UE_LOG_INFO("LightCluster: %d lights | %u clusters (%u occupied, max %u, %u overflow) | %zu indices | %.2f MB (fixed %.1f MB) | Serial %.3fms | Parallel %.3fms (x%.1f)%s",
+				LightCount, ClusterCount, OccupiedCount, MaxCount, ParallelCuller.GetOverflowClusterCount(), IndexCount,
+				CompactMegabytes, FixedMegabytes, SerialMilliseconds, ParallelMilliseconds,
+				ParallelMilliseconds > 0.0 ? SerialMilliseconds / ParallelMilliseconds : 0.0,
+				bIsReferenceChecked ? " | reference ok" : "");
+		}
+
+		UE_LOG_SUCCESS("LightCluster: %zu runs, %ux%u viewport, %d workers | %d mismatch",
+			LightCounts.size(), VIEWPORT_WIDTH, VIEWPORT_HEIGHT, WorkerCount, MismatchCount);
+	}
+}
+
+IMPLEMENT_BENCHMARK("lightcluster", "Assign 1k-64k random point/spot lights to exponential depth clusters on the CPU, compare serial, parallel and brute-force results", RunLightClusterBenchmark)
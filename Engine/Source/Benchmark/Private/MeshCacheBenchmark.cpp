@@ -0,0 +1,187 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Manager/Asset/Public/StaticMeshCache.h"
+
+namespace
+{
+	/** @brief FVector4 정렬로 생기는 패딩은 비교하지 않도록 멤버별로 비트 단위 비교 */
+	bool IsSameVertex(const FNormalVertex& InA, const FNormalVertex& InB)
+	{
+		return memcmp(&InA.Position, &InB.Position, sizeof(FVector)) == 0 &&
+			memcmp(&InA.Normal, &InB.Normal, sizeof(FVector)) == 0 &&
+			memcmp(&InA.Color, &InB.Color, sizeof(FVector4)) == 0 &&
+			memcmp(&InA.TexCoord, &InB.TexCoord, sizeof(FVector2)) == 0 &&
+			memcmp(&InA.Tangent, &InB.Tangent, sizeof(FVector)) == 0 &&
+			memcmp(&InA.Bitangent, &InB.Bitangent, sizeof(FVector)) == 0;
+	}
+
+	bool IsSameSections(const TArray<FMeshSection>& InA, const TArray<FMeshSection>& InB)
+	{
+		return std::equal(InA.begin(), InA.end(), InB.begin(), InB.end(), [](const FMeshSection& A, const FMeshSection& B)
+		{
+			return A.StartIndex == B.StartIndex && A.IndexCount == B.IndexCount && A.MaterialSlot == B.MaterialSlot;
+		});
+	}
+
+	/** @brief LOD 인덱스와 LOD별 구간, 섹션, 전환 화면 크기까지 비트 단위로 같은지 */
+	bool IsSameLODChain(const FStaticMesh& InBuilt, const FStaticMesh& InCached)
+	{
+		if (InBuilt.LODIndices != InCached.LODIndices || InBuilt.LODs.size() != InCached.LODs.size())
+		{
+			return false;
+		}
+
+		for (size_t Index = 0; Index < InBuilt.LODs.size(); ++Index)
+		{
+			const FStaticMeshLOD& Built = InBuilt.LODs[Index];
+			const FStaticMeshLOD& Cached = InCached.LODs[Index];
+			if (memcmp(&Built.ScreenSize, &Cached.ScreenSize, sizeof(float)) != 0 || memcmp(&Built.Error, &Cached.Error, sizeof(float)) != 0 ||
+				Built.FirstIndex != Cached.FirstIndex || Built.IndexCount != Cached.IndexCount || !IsSameSections(Built.Sections, Cached.Sections))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** @brief 메시렛 구간, 섹션, 경계 구와 노멀 콘이 비트 단위로 같은지 */
+	bool IsSameMeshlets(const TArray<FMeshlet>& InA, const TArray<FMeshlet>& InB)
+	{
+		return std::equal(InA.begin(), InA.end(), InB.begin(), InB.end(), [](const FMeshlet& A, const FMeshlet& B)
+		{
+			return memcmp(&A.Center, &B.Center, sizeof(FVector)) == 0 && memcmp(&A.Radius, &B.Radius, sizeof(float)) == 0 &&
+				memcmp(&A.ConeApex, &B.ConeApex, sizeof(FVector)) == 0 && memcmp(&A.ConeAxis, &B.ConeAxis, sizeof(FVector)) == 0 &&
+				memcmp(&A.ConeCutoff, &B.ConeCutoff, sizeof(float)) == 0 &&
+				A.SectionIndex == B.SectionIndex && A.FirstIndex == B.FirstIndex && A.IndexCount == B.IndexCount;
+		});
+	}
+
+	/** @brief 쿠킹 캐시에서 읽은 메시가 .obj에서 새로 빌드한 메시와 같은지 확인 */
+	bool IsSameStaticMesh(const FStaticMesh& InBuilt, const FStaticMesh& InCached)
+	{
+		if (InBuilt.Vertices.size() != InCached.Vertices.size() ||
+			InBuilt.Indices != InCached.Indices ||
+			InBuilt.Sections.size() != InCached.Sections.size() ||
+			InBuilt.MaterialInfo.size() != InCached.MaterialInfo.size() ||
+			InBuilt.BVH.GetNodeCount() != InCached.BVH.GetNodeCount() ||
+			InBuilt.BVH.GetWideNodeCount() != InCached.BVH.GetWideNodeCount() ||
+			InBuilt.BVH.GetTriangleBaseIndices() != InCached.BVH.GetTriangleBaseIndices() ||
+			!IsSameSections(InBuilt.Sections, InCached.Sections) ||
+			!IsSameLODChain(InBuilt, InCached) ||
+			!IsSameMeshlets(InBuilt.Meshlets, InCached.Meshlets))
+		{
+			return false;
+		}
+
+		for (size_t Index = 0; Index < InBuilt.Vertices.size(); ++Index)
+		{
+			if (!IsSameVertex(InBuilt.Vertices[Index], InCached.Vertices[Index]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Data/ 아래 모든 .obj를 캐시 없이 빌드할 때와 쿠킹 캐시(.meshcache)에서 읽을 때의 로드 시간을 비교
+	 * @note 인자: [반복 횟수] (기본 3회, 가장 빠른 값 사용). 캐시 측정 전에 한 번 쿠킹하므로 캐시 파일이 생성/갱신된다
+	 */
+	void RunMeshCacheBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 Iterations = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 3));
+
+		TArray<FName> ObjList;
+		const FString DataDirectory = "Data/";
+		if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
+		{
+			for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+			{
+				if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+				{
+					ObjList.push_back(FName(Entry.path().generic_string()));
+				}
+			}
+		}
+
+		if (ObjList.empty())
+		{
+			UE_LOG_WARNING("MeshCache: %s 아래에 .obj 파일이 없습니다", DataDirectory.c_str());
+			return;
+		}
+
+		// UAssetManager::LoadAllObjStaticMesh와 같은 설정
+		FObjImporter::Configuration CacheConfig;
+		CacheConfig.bFlipWindingOrder = false;
+		CacheConfig.bIsBinaryEnabled = true;
+		CacheConfig.bPositionToUEBasis = true;
+		CacheConfig.bNormalToUEBasis = true;
+		CacheConfig.bUVToUEBasis = true;
+
+		FObjImporter::Configuration BuildConfig = CacheConfig;
+		BuildConfig.bIsBinaryEnabled = false;
+
+		double TotalBuildMilliseconds = 0.0;
+		double TotalCacheMilliseconds = 0.0;
+		uintmax_t TotalCacheBytes = 0;
+		int32 MismatchCount = 0;
+
+		for (const FName& ObjPath : ObjList)
+		{
+			std::unique_ptr<FStaticMesh> BuiltMesh;
+			double BuildMilliseconds = DBL_MAX;
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				FScopeCycleCounter Counter;
+				BuiltMesh = FObjManager::ImportStaticMesh(ObjPath, BuildConfig);
+				BuildMilliseconds = std::min(BuildMilliseconds, static_cast<double>(Counter.Finish()));
+			}
+
+			if (!BuiltMesh)
+			{
+				UE_LOG_WARNING("MeshCache: %s 빌드 실패, 건너뜀", ObjPath.ToString().c_str());
+				continue;
+			}
+
+			// 캐시가 없거나 오래되었으면 여기서 쿠킹
+			FObjManager::ImportStaticMesh(ObjPath, CacheConfig);
+
+			std::unique_ptr<FStaticMesh> CachedMesh;
+			double CacheMilliseconds = DBL_MAX;
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				FScopeCycleCounter Counter;
+				CachedMesh = FObjManager::ImportStaticMesh(ObjPath, CacheConfig);
+				CacheMilliseconds = std::min(CacheMilliseconds, static_cast<double>(Counter.Finish()));
+			}
+
+			if (!CachedMesh || !IsSameStaticMesh(*BuiltMesh, *CachedMesh))
+			{
+				UE_LOG_ERROR("MeshCache: %s 캐시 결과가 빌드 결과와 다릅니다", ObjPath.ToString().c_str());
+				++MismatchCount;
+				continue;
+			}
+
+			std::error_code Error;
+			const uintmax_t CacheBytes = std::filesystem::file_size(FStaticMeshCache::GetCachePath(ObjPath.ToString()), Error);
+			TotalCacheBytes += Error ? 0 : CacheBytes;
+
+			UE_LOG_INFO("MeshCache: %s | Verts %zu | Tris %zu | BVH Nodes %d | Build %.3fms | Cache %.3fms (x%.1f)",
+				ObjPath.ToString().c_str(), CachedMesh->Vertices.size(), CachedMesh->Indices.size() / 3,
+				CachedMesh->BVH.GetNodeCount(), BuildMilliseconds, CacheMilliseconds,
+				CacheMilliseconds > 0.0 ? BuildMilliseconds / CacheMilliseconds : 0.0);
+
+			TotalBuildMilliseconds += BuildMilliseconds;
+			TotalCacheMilliseconds += CacheMilliseconds;
+		}
+
+		UE_LOG_SUCCESS("MeshCache: %zu meshes | Build %.3fms | Cache %.3fms (x%.1f) | %.2f MB cached | %d mismatch",
+			ObjList.size(), TotalBuildMilliseconds, TotalCacheMilliseconds,
+			TotalCacheMilliseconds > 0.0 ? TotalBuildMilliseconds / TotalCacheMilliseconds : 0.0,
+			static_cast<double>(TotalCacheBytes) / (1024.0 * 1024.0), MismatchCount);
+	}
+}
+
+IMPLEMENT_BENCHMARK("meshcache", "Load every Data/ .obj with and without the cooked mesh cache, report load times", RunMeshCacheBenchmark)
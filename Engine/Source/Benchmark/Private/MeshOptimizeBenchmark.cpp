@@ -0,0 +1,181 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/MeshOptimizer.h"
+#include "Manager/Asset/Public/ObjManager.h"
+
+#include <array>
+
+namespace
+{
+	using FTriangleKey = std::array<uint64, 3>;
+
+	/** @brief 인덱스와 무관하게 정점 내용으로 만든 해시, 재배치 전후의 같은 정점은 같은 값 */
+	uint64 HashVertex(const FNormalVertex& InVertex)
+	{
+		uint64 Hash = 0xCBF29CE484222325ULL;
+		auto HashBytes = [&Hash](const void* InData, size_t InSize)
+		{
+			const uint8* Bytes = static_cast<const uint8*>(InData);
+			for (size_t Index = 0; Index < InSize; ++Index)
+			{
+				Hash = (Hash ^ Bytes[Index]) * 0x100000001B3ULL;
+			}
+		};
+		HashBytes(&InVertex.Position, sizeof(FVector));
+		HashBytes(&InVertex.Normal, sizeof(FVector));
+		HashBytes(&InVertex.TexCoord, sizeof(FVector2));
+		return Hash;
+	}
+
+	/** @brief 섹션마다 삼각형을 감기 순서를 유지한 채 회전해 정렬한 목록, 최적화 전후가 같아야 한다 */
+	TArray<TArray<FTriangleKey>> GatherSectionTriangles(const FStaticMesh& InMesh)
+	{
+		TArray<uint64> VertexHashes(InMesh.Vertices.size());
+		for (size_t Index = 0; Index < InMesh.Vertices.size(); ++Index)
+		{
+			VertexHashes[Index] = HashVertex(InMesh.Vertices[Index]);
+		}
+
+		TArray<TArray<FTriangleKey>> SectionTriangles(InMesh.Sections.size());
+		for (size_t SectionIndex = 0; SectionIndex < InMesh.Sections.size(); ++SectionIndex)
+		{
+			const FMeshSection& Section = InMesh.Sections[SectionIndex];
+			for (uint32 Index = Section.StartIndex; Index + 2 < Section.StartIndex + Section.IndexCount; Index += 3)
+			{
+				FTriangleKey Key = { VertexHashes[InMesh.Indices[Index]], VertexHashes[InMesh.Indices[Index + 1]], VertexHashes[InMesh.Indices[Index + 2]] };
+				const size_t First = std::min_element(Key.begin(), Key.end()) - Key.begin();
+				std::rotate(Key.begin(), Key.begin() + First, Key.end());
+				SectionTriangles[SectionIndex].push_back(Key);
+			}
+			std::sort(SectionTriangles[SectionIndex].begin(), SectionTriangles[SectionIndex].end());
+		}
+		return SectionTriangles;
+	}
+
+	/** @brief 정점이 인덱스 버퍼에서 처음 쓰이는 순서대로 번호가 매겨졌는지 */
+	bool IsFetchOrdered(const TArray<uint32>& InIndices)
+	{
+		uint32 NextVertex = 0;
+		for (const uint32 Index : InIndices)
+		{
+			if (Index > NextVertex)
+			{
+				return false;
+			}
+			NextVertex += Index == NextVertex ? 1 : 0;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Data/ 아래 모든 .obj를 최적화 없이 빌드한 뒤 FMeshOptimizer를 돌려 ACMR/ATVR(FIFO 16, 32)과 최적화 시간을 비교
+	 * 섹션 구간과 머티리얼 슬롯, 섹션별 삼각형 집합(감기 순서 포함)이 그대로인지와 정점 순서가 첫 사용 순서인지 함께 검증하고,
+	 * 전체 FIFO 16 변환 수가 최적화 전보다 늘지 않았는지 확인한다.
+	 * @note 인자 없음. GPU 없이 CPU 시뮬레이션만 하며 쿠킹 캐시는 쓰지 않는다
+	 */
+	void RunMeshOptimizeBenchmark(const TArray<FString>& InArgs)
+	{
+		TArray<FName> ObjList;
+		const FString DataDirectory = "Data/";
+		if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
+		{
+			for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+			{
+				if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+				{
+					ObjList.push_back(FName(Entry.path().generic_string()));
+				}
+			}
+		}
+
+		if (ObjList.empty())
+		{
+			UE_LOG_WARNING("MeshOptimize: %s 아래에 .obj 파일이 없습니다", DataDirectory.c_str());
+			return;
+		}
+
+		// UAssetManager::LoadAllObjStaticMesh와 같은 설정에서 최적화만 끄고 여기서 직접 돌린다
+		FObjImporter::Configuration Config;
+		Config.bFlipWindingOrder = false;
+		Config.bIsBinaryEnabled = false;
+		Config.bPositionToUEBasis = true;
+		Config.bNormalToUEBasis = true;
+		Config.bUVToUEBasis = true;
+		Config.bIsMeshOptimizationEnabled = false;
+
+		uint64 TotalTriangles = 0;
+		uint64 TransformsBefore = 0;
+		uint64 TransformsAfter = 0;
+		double TotalOptimizeMilliseconds = 0.0;
+		int32 ErrorCount = 0;
+
+		for (const FName& ObjPath : ObjList)
+		{
+			std::unique_ptr<FStaticMesh> Mesh = FObjManager::ImportStaticMesh(ObjPath, Config);
+			if (!Mesh || Mesh->Indices.empty())
+			{
+				UE_LOG_WARNING("MeshOptimize: %s 빌드 실패, 건너뜀", ObjPath.ToString().c_str());
+				continue;
+			}
+
+			const uint32 VertexCount = static_cast<uint32>(Mesh->Vertices.size());
+			const FVertexCacheStatistics Before = FMeshOptimizer::AnalyzeVertexCache(Mesh->Indices.data(), Mesh->Indices.size(), VertexCount);
+			const FVertexCacheStatistics Before32 = FMeshOptimizer::AnalyzeVertexCache(Mesh->Indices.data(), Mesh->Indices.size(), VertexCount, 32);
+			const TArray<FMeshSection> SectionsBefore = Mesh->Sections;
+			const TArray<TArray<FTriangleKey>> TrianglesBefore = GatherSectionTriangles(*Mesh);
+
+			FScopeCycleCounter Counter;
+			FMeshOptimizer::Optimize(*Mesh);
+			const double OptimizeMilliseconds = Counter.Finish();
+
+			const FVertexCacheStatistics After = FMeshOptimizer::AnalyzeVertexCache(Mesh->Indices.data(), Mesh->Indices.size(), VertexCount);
+			const FVertexCacheStatistics After32 = FMeshOptimizer::AnalyzeVertexCache(Mesh->Indices.data(), Mesh->Indices.size(), VertexCount, 32);
+
+			bool bIsSectionLayoutKept = SectionsBefore.size() == Mesh->Sections.size();
+			for (size_t Index = 0; bIsSectionLayoutKept && Index < SectionsBefore.size(); ++Index)
+			{
+				bIsSectionLayoutKept = SectionsBefore[Index].StartIndex == Mesh->Sections[Index].StartIndex &&
+					SectionsBefore[Index].IndexCount == Mesh->Sections[Index].IndexCount &&
+					SectionsBefore[Index].MaterialSlot == Mesh->Sections[Index].MaterialSlot;
+			}
+			const bool bIsTriangleSetKept = bIsSectionLayoutKept && GatherSectionTriangles(*Mesh) == TrianglesBefore;
+			const bool bIsFetchOrdered = IsFetchOrdered(Mesh->Indices);
+			if (!bIsTriangleSetKept || !bIsFetchOrdered || Mesh->Vertices.size() != VertexCount)
+			{
+				UE_LOG_ERROR("MeshOptimize: %s 검증 실패 (sections %d, triangles %d, fetch order %d)", ObjPath.ToString().c_str(),
+					bIsSectionLayoutKept, bIsTriangleSetKept, bIsFetchOrdered);
+				++ErrorCount;
+			}
+
+			UE_LOG_INFO("MeshOptimize: %s | Verts %u | Tris %zu | Sections %zu | ACMR %.3f -> %.3f (32: %.3f -> %.3f) | ATVR %.3f -> %.3f | %.3fms",
+				ObjPath.ToString().c_str(), VertexCount, Mesh->Indices.size() / 3, Mesh->Sections.size(),
+				Before.ACMR, After.ACMR, Before32.ACMR, After32.ACMR, Before.ATVR, After.ATVR, OptimizeMilliseconds);
+
+			TotalTriangles += Mesh->Indices.size() / 3;
+			TransformsBefore += Before.TransformCount;
+			TransformsAfter += After.TransformCount;
+			TotalOptimizeMilliseconds += OptimizeMilliseconds;
+		}
+
+		if (ErrorCount > 0)
+		{
+			UE_LOG_ERROR("MeshOptimize: %d meshes failed validation", ErrorCount);
+			return;
+		}
+
+		// 메시 하나는 이미 잘 정렬된 입력에서 조금 나빠질 수 있지만, 전체 정점 셰이더 호출 수가 늘면 최적화가 깨진 것이다
+		if (TransformsAfter > TransformsBefore)
+		{
+			UE_LOG_ERROR("MeshOptimize: vertex shader invocations increased %llu -> %llu", TransformsBefore, TransformsAfter);
+			return;
+		}
+
+		const double Triangles = static_cast<double>(std::max<uint64>(TotalTriangles, 1));
+		UE_LOG_SUCCESS("MeshOptimize: %zu meshes | %llu tris | ACMR %.3f -> %.3f | vertex shader invocations x%.2f fewer | optimize %.3fms",
+			ObjList.size(), TotalTriangles, TransformsBefore / Triangles, TransformsAfter / Triangles,
+			TransformsAfter > 0 ? static_cast<double>(TransformsBefore) / TransformsAfter : 0.0, TotalOptimizeMilliseconds);
+	}
+}
+
+IMPLEMENT_BENCHMARK("meshoptimize", "Build every Data/ .obj, run the cook-time vertex cache/overdraw/fetch optimizer and report ACMR/ATVR before and after", RunMeshOptimizeBenchmark)
@@ -0,0 +1,145 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
+#include "Manager/Asset/Public/ObjManager.h"
+
+namespace
+{
+	/** @brief LOD 섹션이 LOD0과 같은 순서와 슬롯이고, 구간이 LOD 인덱스 범위 안에서 정점 버퍼만 가리키는지 */
+	bool IsLODChainValid(const FStaticMesh& InMesh)
+	{
+		const uint64 LODBegin = InMesh.Indices.size();
+		const uint64 LODEnd = LODBegin + InMesh.LODIndices.size();
+		float PreviousScreenSize = FLT_MAX;
+		uint32 PreviousIndexCount = static_cast<uint32>(InMesh.Indices.size());
+
+		for (const FStaticMeshLOD& LOD : InMesh.LODs)
+		{
+			if (LOD.Sections.size() != InMesh.Sections.size() || LOD.ScreenSize >= PreviousScreenSize || LOD.IndexCount >= PreviousIndexCount ||
+				LOD.FirstIndex < LODBegin || LOD.FirstIndex + static_cast<uint64>(LOD.IndexCount) > LODEnd)
+			{
+				return false;
+			}
+
+			uint64 SectionIndexTotal = 0;
+			for (size_t SectionIndex = 0; SectionIndex < LOD.Sections.size(); ++SectionIndex)
+			{
+				const FMeshSection& Section = LOD.Sections[SectionIndex];
+				if (Section.MaterialSlot != InMesh.Sections[SectionIndex].MaterialSlot || Section.IndexCount % 3 != 0 ||
+					Section.StartIndex < LOD.FirstIndex || Section.StartIndex + static_cast<uint64>(Section.IndexCount) > LOD.FirstIndex + static_cast<uint64>(LOD.IndexCount))
+				{
+					return false;
+				}
+				SectionIndexTotal += Section.IndexCount;
+			}
+			if (SectionIndexTotal != LOD.IndexCount)
+			{
+				return false;
+			}
+
+			for (uint32 Index = LOD.FirstIndex; Index < LOD.FirstIndex + LOD.IndexCount; ++Index)
+			{
+				if (InMesh.LODIndices[Index - LODBegin] >= InMesh.Vertices.size())
+				{
+					return false;
+				}
+			}
+
+			PreviousScreenSize = LOD.ScreenSize;
+			PreviousIndexCount = LOD.IndexCount;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Data/ 아래 모든 .obj를 LOD 없이 빌드한 뒤 FMeshSimplifier::BuildLODs를 돌려 LOD별 삼각형 수, 오차, 전환 화면 크기와 처리량을 보고
+	 * LOD 섹션 배치(슬롯, 구간, 정점 범위)와 전환 화면 크기의 단조 감소를 함께 검증한다.
+	 * @note 인자: [LOD 수=4]. 쿠킹 캐시는 쓰지 않는다
+	 */
+	void RunMeshSimplifyBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 LODCount = std::clamp(FBenchmarkRegistry::GetIntArg(InArgs, 0, 4), 2, 8);
+
+		TArray<FName> ObjList;
+		const FString DataDirectory = "Data/";
+		if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
+		{
+			for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+			{
+				if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+				{
+					ObjList.push_back(FName(Entry.path().generic_string()));
+				}
+			}
+		}
+
+		if (ObjList.empty())
+		{
+			UE_LOG_WARNING("MeshSimplify: %s 아래에 .obj 파일이 없습니다", DataDirectory.c_str());
+			return;
+		}
+
+		// UAssetManager::LoadAllObjStaticMesh와 같은 설정에서 LOD 생성만 끄고 여기서 직접 돌린다
+		FObjImporter::Configuration Config;
+		Config.bFlipWindingOrder = false;
+		Config.bIsBinaryEnabled = false;
+		Config.bPositionToUEBasis = true;
+		Config.bNormalToUEBasis = true;
+		Config.bUVToUEBasis = true;
+		Config.LODCount = 1;
+
+		uint64 TotalTriangles = 0;
+		uint64 TotalLODTriangles = 0;
+		double TotalSimplifyMilliseconds = 0.0;
+		int32 MeshesWithLODs = 0;
+		int32 ErrorCount = 0;
+
+		for (const FName& ObjPath : ObjList)
+		{
+			std::unique_ptr<FStaticMesh> Mesh = FObjManager::ImportStaticMesh(ObjPath, Config);
+			if (!Mesh || Mesh->Indices.empty())
+			{
+				UE_LOG_WARNING("MeshSimplify: %s 빌드 실패, 건너뜀", ObjPath.ToString().c_str());
+				continue;
+			}
+
+			FScopeCycleCounter Counter;
+			FMeshSimplifier::BuildLODs(*Mesh, LODCount);
+			const double SimplifyMilliseconds = Counter.Finish();
+
+			if (!IsLODChainValid(*Mesh))
+			{
+				UE_LOG_ERROR("MeshSimplify: %s LOD 검증 실패", ObjPath.ToString().c_str());
+				++ErrorCount;
+			}
+
+			FString LODSummary = std::to_string(Mesh->Indices.size() / 3);
+			for (const FStaticMeshLOD& LOD : Mesh->LODs)
+			{
+				char Buffer[96];
+				snprintf(Buffer, sizeof(Buffer), " -> %u (err %.4f, screen %.3f)", LOD.IndexCount / 3, LOD.Error, LOD.ScreenSize);
+				LODSummary += Buffer;
+				TotalLODTriangles += LOD.IndexCount / 3;
+			}
+			UE_LOG_INFO("MeshSimplify: %s | Verts %zu | Tris %s | %.3fms", ObjPath.ToString().c_str(), Mesh->Vertices.size(),
+				LODSummary.c_str(), SimplifyMilliseconds);
+
+			TotalTriangles += Mesh->Indices.size() / 3;
+			TotalSimplifyMilliseconds += SimplifyMilliseconds;
+			MeshesWithLODs += Mesh->LODs.empty() ? 0 : 1;
+		}
+
+		if (ErrorCount > 0)
+		{
+			UE_LOG_ERROR("MeshSimplify: %d meshes failed validation", ErrorCount);
+			return;
+		}
+
+		UE_LOG_SUCCESS("MeshSimplify: %zu meshes (%d with LODs) | LOD0 %llu tris -> LOD1+ %llu tris | %.3fms (%.2f M input tris/s)",
+			ObjList.size(), MeshesWithLODs, TotalTriangles, TotalLODTriangles, TotalSimplifyMilliseconds,
+			TotalSimplifyMilliseconds > 0.0 ? TotalTriangles / (TotalSimplifyMilliseconds * 1000.0) : 0.0);
+	}
+}
+
+IMPLEMENT_BENCHMARK("meshsimplify", "Build every Data/ .obj without LODs, generate the QEM LOD chain and report triangles, error, screen sizes and throughput", RunMeshSimplifyBenchmark)
@@ -0,0 +1,376 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/MeshletBuilder.h"
+#include "Manager/Asset/Public/MeshOptimizer.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Optimization/Public/MeshletCuller.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+namespace
+{
+	/** @brief 감기 순서를 유지한 채 가장 작은 인덱스가 앞에 오도록 돌린 삼각형 키 */
+	std::tuple<uint32, uint32, uint32> MakeTriangleKey(uint32 InA, uint32 InB, uint32 InC)
+	{
+		if (InB < InA && InB <= InC) { return { InB, InC, InA }; }
+		if (InC < InA && InC < InB) { return { InC, InA, InB }; }
+		return { InA, InB, InC };
+	}
+
+	/**
+	 * @brief 메시렛이 섹션을 앞에서부터 빈틈없이 나누고, 정점과 삼각형 상한을 지키며, 섹션의 삼각형 집합이 그대로인지
+	 * @param InOriginalIndices 메시렛을 만들기 전의 LOD0 인덱스, 정점 번호가 바뀐 뒤라면 nullptr로 삼각형 집합 비교를 건너뛴다
+	 */
+	bool AreMeshletsValid(const FStaticMesh& InMesh, const TArray<uint32>* InOriginalIndices)
+	{
+		TArray<FMeshSection> Sections = InMesh.Sections;
+		if (Sections.empty())
+		{
+			Sections.push_back({ 0, static_cast<uint32>(InMesh.Indices.size()) });
+		}
+
+		size_t MeshletIndex = 0;
+		TArray<uint32> UniqueVertices;
+		for (uint32 SectionIndex = 0; SectionIndex < Sections.size(); ++SectionIndex)
+		{
+			const FMeshSection& Section = Sections[SectionIndex];
+			uint32 Cursor = Section.StartIndex;
+			for (; MeshletIndex < InMesh.Meshlets.size() && InMesh.Meshlets[MeshletIndex].SectionIndex == SectionIndex; ++MeshletIndex)
+			{
+				const FMeshlet& Meshlet = InMesh.Meshlets[MeshletIndex];
+				if (Meshlet.FirstIndex != Cursor || Meshlet.IndexCount == 0 || Meshlet.IndexCount % 3 != 0 ||
+					Meshlet.IndexCount / 3 > FMeshletBuilder::MAX_TRIANGLES)
+				{
+					return false;
+				}
+
+				UniqueVertices.assign(InMesh.Indices.begin() + Meshlet.FirstIndex, InMesh.Indices.begin() + Meshlet.FirstIndex + Meshlet.IndexCount);
+				std::sort(UniqueVertices.begin(), UniqueVertices.end());
+				if (std::unique(UniqueVertices.begin(), UniqueVertices.end()) - UniqueVertices.begin() > FMeshletBuilder::MAX_VERTICES)
+				{
+					return false;
+				}
+				Cursor += Meshlet.IndexCount;
+			}
+			if (Cursor != Section.StartIndex + Section.IndexCount - Section.IndexCount % 3)
+			{
+				return false;
+			}
+			if (!InOriginalIndices)
+			{
+				continue;
+			}
+
+			TArray<std::tuple<uint32, uint32, uint32>> Before;
+			TArray<std::tuple<uint32, uint32, uint32>> After;
+			for (uint32 Index = Section.StartIndex; Index + 2 < Section.StartIndex + Section.IndexCount; Index += 3)
+			{
+				Before.push_back(MakeTriangleKey((*InOriginalIndices)[Index], (*InOriginalIndices)[Index + 1], (*InOriginalIndices)[Index + 2]));
+				After.push_back(MakeTriangleKey(InMesh.Indices[Index], InMesh.Indices[Index + 1], InMesh.Indices[Index + 2]));
+			}
+			std::sort(Before.begin(), Before.end());
+			std::sort(After.begin(), After.end());
+			if (Before != After)
+			{
+				return false;
+			}
+		}
+		return MeshletIndex == InMesh.Meshlets.size();
+	}
+
+	/** @brief InEye에서 InTarget을 보는 원근 카메라, UCamera와 같은 (Right, Up, Forward) 기저를 쓴다 */
+	FCameraConstants MakeLookAtCamera(const FVector& InEye, const FVector& InTarget, float InFovY, float InAspect, float InFarZ)
+	{
+		FVector Forward = InTarget - InEye;
+		Forward.Normalize();
+		// FVector::Cross는 표준 외적과 부호가 반대이므로 Right = Up x Forward, Up = Forward x Right
+		FVector Right = Forward.Cross(FVector(0.0f, 0.0f, 1.0f));
+		Right.Normalize();
+		const FVector Up = Right.Cross(Forward);
+
+		FCameraConstants Camera;
+		Camera.View = FMatrix::TranslationMatrixInverse(InEye) * FMatrix(Right, Up, Forward).Transpose();
+
+		const float NearZ = InFarZ * 1e-4f;
+		const float F = 1.0f / tanf(FVector::GetDegreeToRadian(InFovY) * 0.5f);
+		FMatrix Projection = FMatrix::Identity();
+		Projection.Data[0][0] = F / InAspect;
+		Projection.Data[1][1] = F;
+		Projection.Data[2][2] = InFarZ / (InFarZ - NearZ);
+		Projection.Data[2][3] = 1.0f;
+		Projection.Data[3][2] = (-NearZ * InFarZ) / (InFarZ - NearZ);
+		Projection.Data[3][3] = 0.0f;
+		Camera.Projection = Projection;
+
+		Camera.ViewWorldLocation = InEye;
+		Camera.NearClip = NearZ;
+		Camera.FarClip = InFarZ;
+		return Camera;
+	}
+
+	/** @brief ViewVolumeCuller::Cull과 같은 방식으로 View * Projection에서 절두체 평면을 뽑는다 */
+	FFrustum ExtractFrustum(const FMatrix& InViewProj)
+	{
+		FFrustum Frustum;
+		Frustum.Planes[0] = InViewProj[3] + InViewProj[0];
+		Frustum.Planes[1] = InViewProj[3] - InViewProj[0];
+		Frustum.Planes[2] = InViewProj[3] + InViewProj[1];
+		Frustum.Planes[3] = InViewProj[3] - InViewProj[1];
+		Frustum.Planes[4] = InViewProj[2];
+		Frustum.Planes[5] = InViewProj[3] - InViewProj[2];
+
+		for (FVector4& Plane : Frustum.Planes)
+		{
+			const float Length = sqrtf(Plane.X * Plane.X + Plane.Y * Plane.Y + Plane.Z * Plane.Z);
+			Plane /= -Length;
+		}
+		return Frustum;
+	}
+
+	FVector TransformPosition(const FVector& InPosition, const FMatrix& InMatrix)
+	{
+		const FVector4 Result = FVector4(InPosition, 1.0f) * InMatrix;
+		return FVector(Result.X, Result.Y, Result.Z);
+	}
+
+	/**
+	 * @brief 컬링된 메시렛의 삼각형이 정말 보이지 않는지, 월드 공간에서 삼각형마다 다시 판정한다
+	 * 절두체 컬링은 세 정점이 한 평면 바깥, 콘 컬링은 카메라가 삼각형 평면의 뒤쪽이어야 한다.
+	 * @return 보이는데 버려진 삼각형 수
+	 */
+	uint32 CountWronglyCulledTriangles(const FStaticMesh& InMesh, const FMeshlet& InMeshlet, EMeshletVisibility InVisibility,
+		const FMatrix& InWorld, const FFrustum& InFrustum, const FVector& InEye, float InTolerance)
+	{
+		uint32 WrongCount = 0;
+		for (uint32 Index = InMeshlet.FirstIndex; Index < InMeshlet.FirstIndex + InMeshlet.IndexCount; Index += 3)
+		{
+			const FVector P0 = TransformPosition(InMesh.Vertices[InMesh.Indices[Index]].Position, InWorld);
+			const FVector P1 = TransformPosition(InMesh.Vertices[InMesh.Indices[Index + 1]].Position, InWorld);
+			const FVector P2 = TransformPosition(InMesh.Vertices[InMesh.Indices[Index + 2]].Position, InWorld);
+
+			bool bIsHidden = false;
+			if (InVisibility == EMeshletVisibility::FrustumCulled)
+			{
+				for (const FVector4& Plane : InFrustum.Planes)
+				{
+					if (Plane.Dot3(P0) + Plane.W > -InTolerance && Plane.Dot3(P1) + Plane.W > -InTolerance && Plane.Dot3(P2) + Plane.W > -InTolerance)
+					{
+						bIsHidden = true;
+						break;
+					}
+				}
+			}
+			else
+			{
+				// FMeshletBuilder와 같은 앞면 노멀, 월드 행렬의 행렬식이 양수라 방향이 유지된다
+				const FVector FrontNormal = (P1 - P0).Cross(P2 - P0);
+				const FVector ToEye = InEye - P0;
+				bIsHidden = FrontNormal.Dot(ToEye) <= InTolerance * FrontNormal.Length() * ToEye.Length();
+			}
+			WrongCount += bIsHidden ? 0 : 1;
+		}
+		return WrongCount;
+	}
+
+	/**
+	 * @brief Data/ 메시를 메시렛으로 나누고, 메시 둘레를 도는 카메라로 프레임마다 메시렛 컬링이 버리는 삼각형 수를 측정
+	 * 메시렛 분할(섹션 구간, 정점/삼각형 상한, 삼각형 집합 보존)과 컬링의 보수성(버린 삼각형은 모두 절두체 밖이거나 뒷면)을 함께 검증한다.
+	 * 프레임의 절반은 메시 바깥(경계 구 반지름의 2배), 나머지 절반은 메시 안쪽(0.5배)에서 바깥을 본다.
+	 * @note 인자: [프레임 수=360]. 비균등 스케일과 회전을 준 월드 행렬로 로컬 공간 판정까지 확인한다
+	 */
+	void RunMeshletCullBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 Frames = std::max(2, FBenchmarkRegistry::GetIntArg(InArgs, 0, 360));
+		constexpr float Aspect = 16.0f / 9.0f;
+		constexpr float FovY = 60.0f;
+
+		TArray<std::unique_ptr<FStaticMesh>> Meshes;
+		TArray<TArray<uint32>> OriginalIndices;
+		const FString DataDirectory = "Data/";
+		if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
+		{
+			// UAssetManager::LoadAllObjStaticMesh와 같은 설정, 메시렛은 아래에서 직접 만들어 시간을 잰다
+			FObjImporter::Configuration Config;
+			Config.bFlipWindingOrder = false;
+			Config.bIsBinaryEnabled = false;
+			Config.bIsMeshletEnabled = false;
+			// FMeshOptimizer::OptimizeMeshlets가 정점 번호를 바꾸므로 쿠킹 순서대로 LOD는 만들지 않는다
+			Config.LODCount = 1;
+			Config.bPositionToUEBasis = true;
+			Config.bNormalToUEBasis = true;
+			Config.bUVToUEBasis = true;
+
+			for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+			{
+				if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+				{
+					std::unique_ptr<FStaticMesh> Mesh = FObjManager::ImportStaticMesh(FName(Entry.path().generic_string()), Config);
+					if (Mesh && Mesh->Indices.size() / 3 >= FMeshletBuilder::MIN_MESH_TRIANGLES)
+					{
+						OriginalIndices.push_back(Mesh->Indices);
+						Meshes.push_back(std::move(Mesh));
+					}
+				}
+			}
+		}
+
+		if (Meshes.empty())
+		{
+			UE_LOG_WARNING("MeshletCull: %s 아래에 %u 삼각형 이상의 .obj 파일이 없습니다", DataDirectory.c_str(), FMeshletBuilder::MIN_MESH_TRIANGLES);
+			return;
+		}
+
+		double BuildMilliseconds = 0.0;
+		double CullMilliseconds = 0.0;
+		uint64 MeshletCount = 0;
+		uint64 ConeCount = 0;
+		uint64 TriangleCount = 0;
+		uint64 FrontNormalMatches = 0;
+		double ACMRBefore = 0.0;
+		double ACMRMeshlets = 0.0;
+		double ACMRAfter = 0.0;
+		int32 InvalidMeshCount = 0;
+		uint64 WronglyCulledTriangles = 0;
+		uint64 RangeMismatchCount = 0;
+		uint64 RangeCount = 0;
+		FMeshletCullStats Stats;
+		FMeshletCullStats InsideStats;
+		TArray<FMeshletDrawRange> Ranges;
+
+		for (size_t MeshIndex = 0; MeshIndex < Meshes.size(); ++MeshIndex)
+		{
+			FStaticMesh& Mesh = *Meshes[MeshIndex];
+			const uint32 VertexCount = static_cast<uint32>(Mesh.Vertices.size());
+			ACMRBefore += FMeshOptimizer::AnalyzeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), VertexCount).ACMR;
+
+			FScopeCycleCounter BuildCounter;
+			FMeshletBuilder::BuildMeshlets(Mesh);
+			BuildMilliseconds += BuildCounter.Finish();
+
+			ACMRMeshlets += FMeshOptimizer::AnalyzeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), VertexCount).ACMR;
+			if (!AreMeshletsValid(Mesh, &OriginalIndices[MeshIndex]))
+			{
+				++InvalidMeshCount;
+				continue;
+			}
+
+			// ObjManager의 쿠킹 순서대로 메시렛 안의 캐시 순서와 정점 순서를 다시 잡은 뒤에도 구간과 상한이 유지되는지
+			FScopeCycleCounter OptimizeCounter;
+			FMeshOptimizer::OptimizeMeshlets(Mesh);
+			BuildMilliseconds += OptimizeCounter.Finish();
+			ACMRAfter += FMeshOptimizer::AnalyzeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), VertexCount).ACMR;
+			if (!AreMeshletsValid(Mesh, nullptr))
+			{
+				++InvalidMeshCount;
+				continue;
+			}
+
+			// 앞면 노멀 규약이 OBJ의 정점 노멀과 같은 쪽인지
+			for (size_t Index = 0; Index + 2 < Mesh.Indices.size(); Index += 3)
+			{
+				const FNormalVertex& V0 = Mesh.Vertices[Mesh.Indices[Index]];
+				const FNormalVertex& V1 = Mesh.Vertices[Mesh.Indices[Index + 1]];
+				const FNormalVertex& V2 = Mesh.Vertices[Mesh.Indices[Index + 2]];
+				const FVector FrontNormal = (V1.Position - V0.Position).Cross(V2.Position - V0.Position);
+				FrontNormalMatches += FrontNormal.Dot(V0.Normal + V1.Normal + V2.Normal) > 0.0f ? 1 : 0;
+			}
+			TriangleCount += Mesh.Indices.size() / 3;
+			MeshletCount += Mesh.Meshlets.size();
+			for (const FMeshlet& Meshlet : Mesh.Meshlets)
+			{
+				ConeCount += Meshlet.ConeCutoff < 1.0f ? 1 : 0;
+			}
+
+			// 메시 경계 구 반지름을 1로 맞추고 축마다 다른 배율과 회전을 준다
+			FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+			FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+			for (const FNormalVertex& Vertex : Mesh.Vertices)
+			{
+				Min = FVector(std::min(Min.X, Vertex.Position.X), std::min(Min.Y, Vertex.Position.Y), std::min(Min.Z, Vertex.Position.Z));
+				Max = FVector(std::max(Max.X, Vertex.Position.X), std::max(Max.Y, Vertex.Position.Y), std::max(Max.Z, Vertex.Position.Z));
+			}
+			const float UniformScale = 2.0f / std::max((Max - Min).Length(), MATH_EPSILON);
+			const FVector Scale(UniformScale, UniformScale * 1.5f, UniformScale * 0.75f);
+			const FVector Rotation(15.0f, 0.0f, static_cast<float>(MeshIndex * 47 % 360));
+			const FVector Location = -TransformPosition((Min + Max) * 0.5f, FMatrix::GetModelMatrix(FVector(), Rotation, Scale));
+			const FMatrix World = FMatrix::GetModelMatrix(Location, Rotation, Scale);
+			const FMatrix WorldInverse = FMatrix::GetModelMatrixInverse(Location, Rotation, Scale);
+			constexpr float Radius = 1.5f;
+
+			for (int32 Frame = 0; Frame < Frames; ++Frame)
+			{
+				const bool bIsInside = Frame % 2 == 1;
+				const float Angle = 2.0f * PI * static_cast<float>(Frame) / static_cast<float>(Frames);
+				const float Elevation = 0.6f * sinf(Angle * 3.0f);
+				const FVector Direction(cosf(Angle) * cosf(Elevation), sinf(Angle) * cosf(Elevation), sinf(Elevation));
+				const FVector Eye = Direction * (bIsInside ? Radius * 0.5f : Radius * 2.0f);
+				const FVector Target = bIsInside ? Eye * 3.0f : FVector();
+				const FCameraConstants Camera = MakeLookAtCamera(Eye, Target, FovY, Aspect, Radius * 10.0f);
+				const FFrustum Frustum = ExtractFrustum(Camera.View * Camera.Projection);
+
+				FMeshletCullStats FrameStats;
+				Ranges.clear();
+				FScopeCycleCounter CullCounter;
+				const FMeshletCullView View = FMeshletCuller::MakeView(Frustum, Camera, World, WorldInverse, true);
+				FMeshletCuller::Cull(Mesh, View, Ranges, &FrameStats);
+				CullMilliseconds += CullCounter.Finish();
+
+				uint64 RangeTriangles = 0;
+				for (const FMeshletDrawRange& Range : Ranges)
+				{
+					RangeTriangles += Range.IndexCount / 3;
+				}
+				RangeMismatchCount += RangeTriangles != FrameStats.VisibleTriangles ? 1 : 0;
+				RangeCount += Ranges.size();
+
+				for (const FMeshlet& Meshlet : Mesh.Meshlets)
+				{
+					const EMeshletVisibility Visibility = FMeshletCuller::TestMeshlet(Meshlet, View);
+					if (Visibility != EMeshletVisibility::Visible)
+					{
+						WronglyCulledTriangles += CountWronglyCulledTriangles(Mesh, Meshlet, Visibility, World, Frustum, Eye, 1e-4f);
+					}
+				}
+
+				FMeshletCullStats& ViewStats = bIsInside ? InsideStats : Stats;
+				ViewStats.TotalMeshlets += FrameStats.TotalMeshlets;
+				ViewStats.FrustumCulled += FrameStats.FrustumCulled;
+				ViewStats.ConeCulled += FrameStats.ConeCulled;
+				ViewStats.TotalTriangles += FrameStats.TotalTriangles;
+				ViewStats.VisibleTriangles += FrameStats.VisibleTriangles;
+			}
+		}
+
+		const size_t ValidMeshCount = Meshes.size() - InvalidMeshCount;
+		UE_LOG_INFO("MeshletCull: %zu meshes, %llu tris -> %llu meshlets (%.1f tris each, %.0f%% with cones) | build %.3fms",
+			ValidMeshCount, TriangleCount, MeshletCount, MeshletCount > 0 ? static_cast<double>(TriangleCount) / MeshletCount : 0.0,
+			MeshletCount > 0 ? 100.0 * ConeCount / MeshletCount : 0.0, BuildMilliseconds);
+		UE_LOG_INFO("MeshletCull:   mean ACMR optimized %.3f -> meshlets %.3f -> reoptimized %.3f | front normals agree with vertex normals %.1f%%",
+			ACMRBefore / Meshes.size(), ACMRMeshlets / Meshes.size(), ACMRAfter / Meshes.size(), TriangleCount > 0 ? 100.0 * FrontNormalMatches / TriangleCount : 0.0);
+
+		const auto LogStats = [Frames, ValidMeshCount](const char* InLabel, const FMeshletCullStats& InStats)
+		{
+			const double FrameCount = std::max<double>(1.0, static_cast<double>(ValidMeshCount) * (Frames / 2));
+			UE_LOG_INFO("MeshletCull:   %-8s %.0f of %.0f tris/frame culled (%.1f%%) | meshlets: frustum %.1f%%, cone %.1f%%",
+				InLabel, (InStats.TotalTriangles - InStats.VisibleTriangles) / FrameCount, InStats.TotalTriangles / FrameCount,
+				InStats.TotalTriangles > 0 ? 100.0 * (InStats.TotalTriangles - InStats.VisibleTriangles) / InStats.TotalTriangles : 0.0,
+				InStats.TotalMeshlets > 0 ? 100.0 * InStats.FrustumCulled / InStats.TotalMeshlets : 0.0,
+				InStats.TotalMeshlets > 0 ? 100.0 * InStats.ConeCulled / InStats.TotalMeshlets : 0.0);
+		};
+		LogStats("outside", Stats);
+		LogStats("inside", InsideStats);
+
+		if (InvalidMeshCount > 0 || WronglyCulledTriangles > 0 || RangeMismatchCount > 0)
+		{
+			UE_LOG_ERROR("MeshletCull: %d meshes with invalid meshlets | %llu visible triangles culled | %llu frames with mismatched ranges",
+				InvalidMeshCount, WronglyCulledTriangles, RangeMismatchCount);
+			return;
+		}
+
+		const uint64 FrameTotal = static_cast<uint64>(ValidMeshCount) * Frames;
+		UE_LOG_SUCCESS("MeshletCull: culling is conservative | %.1f draw ranges/frame | cull %.4fms/frame",
+			FrameTotal > 0 ? static_cast<double>(RangeCount) / FrameTotal : 0.0, FrameTotal > 0 ? CullMilliseconds / FrameTotal : 0.0);
+	}
+}
+
+IMPLEMENT_BENCHMARK("meshletcull", "Cluster Data/ meshes into meshlets, orbit a camera around them and report triangles culled per frame by frustum and normal cone, verifying culling is conservative", RunMeshletCullBenchmark)
@@ -0,0 +1,226 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Core/Public/JobSystem.h"
+
+namespace
+{
+	/**
+	 * @brief 샤드 풀 이전의 FNameTable, 전역 뮤텍스 하나와 FString 키 맵을 쓰고 검색마다 소문자 복사본을 만든다
+	 */
+	class FLegacyNameTable
+	{
+	public:
+		FLegacyNameTable()
+		{
+			FindOrAddName("None");
+		}
+
+		TPair<int32, int32> FindOrAddName(const FString& InString)
+		{
+			FString LowerString = InString;
+			std::transform(LowerString.begin(), LowerString.end(), LowerString.begin(),
+				[](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+
+			std::lock_guard<std::mutex> Lock(Mutex);
+			auto ComparisonIt = ComparisonMap.try_emplace(LowerString, static_cast<int32>(ComparisonPool.size())).first;
+			if (ComparisonIt->second == static_cast<int32>(ComparisonPool.size()))
+			{
+				ComparisonPool.push_back(LowerString);
+			}
+			auto DisplayIt = DisplayMap.try_emplace(InString, static_cast<int32>(DisplayPool.size())).first;
+			if (DisplayIt->second == static_cast<int32>(DisplayPool.size()))
+			{
+				DisplayPool.push_back(InString);
+			}
+			return { ComparisonIt->second, DisplayIt->second };
+		}
+
+		TPair<int32, int32> GetUniqueName(const FString& InBaseString)
+		{
+			const TPair<int32, int32> Indices = FindOrAddName(InBaseString);
+			std::lock_guard<std::mutex> Lock(Mutex);
+			return { Indices.second, NextNumberMap[InBaseString]++ };
+		}
+
+		FString ToString(int32 InDisplayIndex, int32 InNumber)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			return DisplayPool[InDisplayIndex] + "_" + std::to_string(InNumber);
+		}
+
+	private:
+		TArray<FString> ComparisonPool;
+		TArray<FString> DisplayPool;
+		TMap<FString, int32> ComparisonMap;
+		TMap<FString, int32> DisplayMap;
+		TMap<FString, int32> NextNumberMap;
+		std::mutex Mutex;
+	};
+
+	/** @brief 액터 하나와 기본 컴포넌트들을 스폰할 때 NewObject가 붙이는 이름의 클래스 순서 */
+	const char* const SpawnClassNames[] =
+	{
+		"StaticMeshActor", "SceneComponent", "StaticMeshComponent", "TextComponent", "BillBoardComponent",
+	};
+
+	/**
+	 * @brief 액터 스폰마다 일어나는 이름 작업(클래스 이름으로 GetUniqueName, 아웃라이너 표시용 ToString)을 예전 테이블과 비교
+	 * 예전 방식은 NewObject처럼 클래스 FName을 문자열로 되돌린 뒤 다시 검색하고, 새 방식은 클래스 FName에 번호만 발급한다.
+	 * @note 인자: [액터 수] (기본 100000), 전역 테이블의 클래스 이름 번호가 액터 수만큼 올라간다
+	 */
+	void RunNameSpawnBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 ActorCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 100000));
+
+		TArray<FName> ClassNames;
+		for (const char* ClassName : SpawnClassNames)
+		{
+			ClassNames.emplace_back(ClassName);
+		}
+
+		FLegacyNameTable LegacyTable;
+		uint64 LegacyLength = 0;
+		FScopeCycleCounter LegacyCounter;
+		for (int32 Actor = 0; Actor < ActorCount; ++Actor)
+		{
+			for (const FName& ClassName : ClassNames)
+			{
+				const TPair<int32, int32> Unique = LegacyTable.GetUniqueName(ClassName.ToString());
+				LegacyLength += LegacyTable.ToString(Unique.first, Unique.second).size();
+			}
+		}
+		const double LegacyMilliseconds = LegacyCounter.Finish();
+
+		FNameTable& NameTable = FNameTable::GetInstance();
+		uint64 ShardedLength = 0;
+		FScopeCycleCounter ShardedCounter;
+		for (int32 Actor = 0; Actor < ActorCount; ++Actor)
+		{
+			for (const FName& ClassName : ClassNames)
+			{
+				ShardedLength += NameTable.GetUniqueName(ClassName).ToString().size();
+			}
+		}
+		const double ShardedMilliseconds = ShardedCounter.Finish();
+
+		// 클래스 이름 검색만 따로, 문자열 리터럴에서 할당 없이 찾는 경로
+		const int32 LookupCount = ActorCount * static_cast<int32>(std::size(SpawnClassNames));
+		int32 LookupMismatch = 0;
+		FScopeCycleCounter LookupCounter;
+		for (int32 Index = 0; Index < LookupCount; ++Index)
+		{
+			const int32 ClassIndex = Index % static_cast<int32>(std::size(SpawnClassNames));
+			if (!(FName(std::string_view(SpawnClassNames[ClassIndex])) == ClassNames[ClassIndex]))
+			{
+				++LookupMismatch;
+			}
+		}
+		const double LookupMilliseconds = LookupCounter.Finish();
+
+		const double NameCount = static_cast<double>(ActorCount) * std::size(SpawnClassNames);
+		UE_LOG_INFO("NameSpawn: %d actors x %zu names | Legacy %.2fms (%.1f ns/name) | Sharded %.2fms (%.1f ns/name, x%.1f)",
+			ActorCount, std::size(SpawnClassNames),
+			LegacyMilliseconds, LegacyMilliseconds * 1.0e6 / NameCount,
+			ShardedMilliseconds, ShardedMilliseconds * 1.0e6 / NameCount,
+			ShardedMilliseconds > 0.0 ? LegacyMilliseconds / ShardedMilliseconds : 0.0);
+		UE_LOG_INFO("NameSpawn: FName(string_view) lookup %.1f ns | table %d comparison / %d display names",
+			LookupMilliseconds * 1.0e6 / LookupCount, NameTable.GetComparisonNameCount(), NameTable.GetDisplayNameCount());
+
+		if (LookupMismatch > 0)
+		{
+			UE_LOG_ERROR("NameSpawn: %d lookups returned a different name", LookupMismatch);
+			return;
+		}
+		UE_LOG_SUCCESS("NameSpawn: %llu / %llu characters generated", LegacyLength, ShardedLength);
+	}
+
+	/** @brief Index번 이름 문자열, Variant에 따라 대소문자만 다르게 만든다 */
+	std::string_view MakeStressName(char (&OutBuffer)[32], int32 InIndex, int32 InVariant)
+	{
+		const int32 Length = snprintf(OutBuffer, sizeof(OutBuffer), "NameStress_%d", InIndex);
+		for (int32 Char = 0; Char < Length; ++Char)
+		{
+			if ((InVariant >> (Char & 3)) & 1)
+			{
+				OutBuffer[Char] = static_cast<char>(std::toupper(static_cast<unsigned char>(OutBuffer[Char])));
+			}
+		}
+		return std::string_view(OutBuffer, Length);
+	}
+
+	/**
+	 * @brief 워커 스레드 전체에서 같은 이름들을 대소문자를 섞어 동시에 등록하고 번호를 발급해 결과가 일관적인지 확인
+	 * - 같은 문자열은 항상 같은 DisplayIndex, 대소문자만 다른 문자열은 같은 ComparisonIndex
+	 * - 동시에 발급한 번호는 모두 달라야 한다
+	 * @note 인자: [작업 수] (기본 400000), [서로 다른 이름 수] (기본 20000)
+	 */
+	void RunNameStressBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 TaskCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 400000));
+		const int32 DistinctCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 20000));
+		constexpr int32 VariantCount = 4;
+
+		FJobSystem& JobSystem = FJobSystem::GetInstance();
+		FNameTable& NameTable = FNameTable::GetInstance();
+		const FName UniqueBase("NameStressUnique");
+
+		TArray<TPair<int32, int32>> Indices(TaskCount);
+		TArray<int32> Numbers(TaskCount);
+
+		FScopeCycleCounter ShardedCounter;
+		JobSystem.ParallelFor(TaskCount, [&](int32 InTask)
+		{
+			char Buffer[32];
+			Indices[InTask] = NameTable.FindOrAddName(MakeStressName(Buffer, InTask % DistinctCount, (InTask / DistinctCount) % VariantCount));
+			Numbers[InTask] = NameTable.GetUniqueName(UniqueBase).GetUniqueNumber();
+		}, 256);
+		const double ShardedMilliseconds = ShardedCounter.Finish();
+
+		FLegacyNameTable LegacyTable;
+		FScopeCycleCounter LegacyCounter;
+		JobSystem.ParallelFor(TaskCount, [&](int32 InTask)
+		{
+			char Buffer[32];
+			LegacyTable.FindOrAddName(FString(MakeStressName(Buffer, InTask % DistinctCount, (InTask / DistinctCount) % VariantCount)));
+			LegacyTable.GetUniqueName("NameStressUnique");
+		}, 256);
+		const double LegacyMilliseconds = LegacyCounter.Finish();
+
+		// 이름별 첫 등장 결과를 기준으로 나머지를 검사
+		int32 ComparisonMismatch = 0;
+		int32 DisplayMismatch = 0;
+		TArray<TPair<int32, int32>> FirstIndices(static_cast<size_t>(DistinctCount) * VariantCount, { -1, -1 });
+		for (int32 Task = 0; Task < TaskCount; ++Task)
+		{
+			const int32 Name = Task % DistinctCount;
+			const int32 Variant = (Task / DistinctCount) % VariantCount;
+			TPair<int32, int32>& First = FirstIndices[static_cast<size_t>(Name) * VariantCount + Variant];
+			if (First.first < 0)
+			{
+				First = Indices[Task];
+			}
+			DisplayMismatch += Indices[Task].second != First.second ? 1 : 0;
+
+			const TPair<int32, int32>& Lower = FirstIndices[static_cast<size_t>(Name) * VariantCount];
+			ComparisonMismatch += Lower.first >= 0 && Indices[Task].first != Lower.first ? 1 : 0;
+		}
+
+		std::sort(Numbers.begin(), Numbers.end());
+		const int32 DuplicateNumbers = static_cast<int32>(Numbers.end() - std::unique(Numbers.begin(), Numbers.end()));
+
+		UE_LOG_INFO("NameStress: %d tasks on %u workers, %d names x %d case variants | Legacy %.2fms | Sharded %.2fms (x%.1f)",
+			TaskCount, JobSystem.GetWorkerCount(), DistinctCount, VariantCount, LegacyMilliseconds, ShardedMilliseconds,
+			ShardedMilliseconds > 0.0 ? LegacyMilliseconds / ShardedMilliseconds : 0.0);
+
+		if (ComparisonMismatch > 0 || DisplayMismatch > 0 || DuplicateNumbers > 0)
+		{
+			UE_LOG_ERROR("NameStress: %d comparison / %d display index mismatches, %d duplicate numbers",
+				ComparisonMismatch, DisplayMismatch, DuplicateNumbers);
+			return;
+		}
+		UE_LOG_SUCCESS("NameStress: indices consistent across threads, %d unique numbers", TaskCount);
+	}
+}
+
+IMPLEMENT_BENCHMARK("namespawn", "Time the FName work of spawning 100k actors on the legacy mutex table and the sharded name pool", RunNameSpawnBenchmark)
+IMPLEMENT_BENCHMARK("namestress", "Register mixed-case names and unique numbers from all workers at once and check the results agree", RunNameStressBenchmark)
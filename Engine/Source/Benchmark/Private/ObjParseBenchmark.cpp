@@ -0,0 +1,159 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Core/Public/JobSystem.h"
+#include "Manager/Asset/Public/ObjImporter.h"
+
+namespace
+{
+	/** @brief 부동소수점 값까지 비트 단위로 같은지 비교 (FVector는 패딩이 없는 float 배열) */
+	template <typename T>
+	bool IsSameBits(const TArray<T>& InA, const TArray<T>& InB)
+	{
+		return InA.size() == InB.size() && (InA.empty() || memcmp(InA.data(), InB.data(), sizeof(T) * InA.size()) == 0);
+	}
+
+	/** @brief 병렬 파서의 결과가 기존 줄 단위 파서의 결과와 같은지 확인 */
+	bool IsSameObjInfo(const FObjInfo& InLegacy, const FObjInfo& InParallel)
+	{
+		if (!IsSameBits(InLegacy.VertexList, InParallel.VertexList) ||
+			!IsSameBits(InLegacy.NormalList, InParallel.NormalList) ||
+			!IsSameBits(InLegacy.TexCoordList, InParallel.TexCoordList) ||
+			InLegacy.MaterialFileList != InParallel.MaterialFileList ||
+			InLegacy.ObjectMaterialInfoList.size() != InParallel.ObjectMaterialInfoList.size() ||
+			InLegacy.ObjectInfoList.size() != InParallel.ObjectInfoList.size())
+		{
+			return false;
+		}
+
+		for (size_t Index = 0; Index < InLegacy.ObjectInfoList.size(); ++Index)
+		{
+			const FObjectInfo& Legacy = InLegacy.ObjectInfoList[Index];
+			const FObjectInfo& Parallel = InParallel.ObjectInfoList[Index];
+			if (Legacy.Name != Parallel.Name ||
+				Legacy.VertexIndexList != Parallel.VertexIndexList ||
+				Legacy.NormalIndexList != Parallel.NormalIndexList ||
+				Legacy.TexCoordIndexList != Parallel.TexCoordIndexList ||
+				Legacy.GroupNameList != Parallel.GroupNameList ||
+				Legacy.GroupIndexList != Parallel.GroupIndexList ||
+				Legacy.MaterialNameList != Parallel.MaterialNameList ||
+				Legacy.MaterialIndexList != Parallel.MaterialIndexList)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Data/ 아래 모든 .obj를 기존 iostream 줄 단위 파서와 청크 병렬 파서로 각각 읽어 처리량(MB/s)을 비교
+	 * @note 인자: [반복 횟수] (기본 3회, 가장 빠른 값 사용). 두 결과가 필드 단위로 같은지도 검증한다
+	 */
+	void RunObjParseBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 Iterations = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 3));
+
+		TArray<std::filesystem::path> ObjList;
+		const FString DataDirectory = "Data/";
+		if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
+		{
+			for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+			{
+				if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+				{
+					ObjList.push_back(Entry.path());
+				}
+			}
+		}
+
+		if (ObjList.empty())
+		{
+			UE_LOG_WARNING("ObjParse: %s 아래에 .obj 파일이 없습니다", DataDirectory.c_str());
+			return;
+		}
+
+		// UAssetManager::LoadAllObjStaticMesh와 같은 설정
+		FObjImporter::Configuration ParallelConfig;
+		ParallelConfig.bFlipWindingOrder = false;
+		ParallelConfig.bPositionToUEBasis = true;
+		ParallelConfig.bNormalToUEBasis = true;
+		ParallelConfig.bUVToUEBasis = true;
+		ParallelConfig.bIsParallelParsingEnabled = true;
+
+		FObjImporter::Configuration LegacyConfig = ParallelConfig;
+		LegacyConfig.bIsParallelParsingEnabled = false;
+
+		auto MeasureLoad = [Iterations](const std::filesystem::path& InPath, const FObjImporter::Configuration& InConfig,
+			FObjInfo& OutObjInfo, double& OutMilliseconds)
+		{
+			OutMilliseconds = DBL_MAX;
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				FObjInfo ObjInfo;
+				FScopeCycleCounter Counter;
+				const bool bIsLoaded = FObjImporter::LoadObj(InPath, &ObjInfo, InConfig);
+				OutMilliseconds = std::min(OutMilliseconds, static_cast<double>(Counter.Finish()));
+				if (!bIsLoaded)
+				{
+					return false;
+				}
+				OutObjInfo = std::move(ObjInfo);
+			}
+			return true;
+		};
+
+		auto ToMegabytesPerSecond = [](uintmax_t InBytes, double InMilliseconds)
+		{
+			return InMilliseconds > 0.0 ? static_cast<double>(InBytes) / (1024.0 * 1024.0) / (InMilliseconds / 1000.0) : 0.0;
+		};
+
+		double TotalLegacyMilliseconds = 0.0;
+		double TotalParallelMilliseconds = 0.0;
+		uintmax_t TotalBytes = 0;
+		int32 MismatchCount = 0;
+
+		for (const std::filesystem::path& ObjPath : ObjList)
+		{
+			std::error_code Error;
+			const uintmax_t FileBytes = std::filesystem::file_size(ObjPath, Error);
+			if (Error)
+			{
+				continue;
+			}
+
+			FObjInfo LegacyObjInfo;
+			FObjInfo ParallelObjInfo;
+			double LegacyMilliseconds = 0.0;
+			double ParallelMilliseconds = 0.0;
+			if (!MeasureLoad(ObjPath, LegacyConfig, LegacyObjInfo, LegacyMilliseconds) ||
+				!MeasureLoad(ObjPath, ParallelConfig, ParallelObjInfo, ParallelMilliseconds))
+			{
+				UE_LOG_WARNING("ObjParse: %s 파싱 실패, 건너뜀", ObjPath.generic_string().c_str());
+				continue;
+			}
+
+			if (!IsSameObjInfo(LegacyObjInfo, ParallelObjInfo))
+			{
+				UE_LOG_ERROR("ObjParse: %s 병렬 파서 결과가 기존 파서와 다릅니다", ObjPath.generic_string().c_str());
+				++MismatchCount;
+				continue;
+			}
+
+			UE_LOG_INFO("ObjParse: %s | %.2f MB | Legacy %.3fms (%.1f MB/s) | Parallel %.3fms (%.1f MB/s, x%.1f)",
+				ObjPath.generic_string().c_str(), static_cast<double>(FileBytes) / (1024.0 * 1024.0),
+				LegacyMilliseconds, ToMegabytesPerSecond(FileBytes, LegacyMilliseconds),
+				ParallelMilliseconds, ToMegabytesPerSecond(FileBytes, ParallelMilliseconds),
+				ParallelMilliseconds > 0.0 ? LegacyMilliseconds / ParallelMilliseconds : 0.0);
+
+			TotalLegacyMilliseconds += LegacyMilliseconds;
+			TotalParallelMilliseconds += ParallelMilliseconds;
+			TotalBytes += FileBytes;
+		}
+
+		UE_LOG_SUCCESS("ObjParse: %zu files, %.2f MB, %d workers | Legacy %.1f MB/s | Parallel %.1f MB/s (x%.1f) | %d mismatch",
+			ObjList.size(), static_cast<double>(TotalBytes) / (1024.0 * 1024.0), FJobSystem::GetInstance().GetWorkerCount(),
+			ToMegabytesPerSecond(TotalBytes, TotalLegacyMilliseconds), ToMegabytesPerSecond(TotalBytes, TotalParallelMilliseconds),
+			TotalParallelMilliseconds > 0.0 ? TotalLegacyMilliseconds / TotalParallelMilliseconds : 0.0, MismatchCount);
+	}
+}
+
+IMPLEMENT_BENCHMARK("objparse", "Parse every Data/ .obj with the line-by-line and the chunked parallel parser, report MB/s", RunObjParseBenchmark)
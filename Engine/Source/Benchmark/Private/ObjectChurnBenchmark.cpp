@@ -0,0 +1,185 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Core/Public/ObjectIterator.h"
+#include "Core/Public/WeakObjectPtr.h"
+#include "Texture/Public/Material.h"
+
+namespace
+{
+	/** @brief 슬롯 맵 이전처럼 계속 늘어나기만 하는 배열을 훑으며 IsA로 걸러 센다 */
+	uint32 CountLegacy(const TArray<UObject*>& InLegacyArray, UClass* InClass)
+	{
+		uint32 Count = 0;
+		for (UObject* Object : InLegacyArray)
+		{
+			if (Object && Object->IsA(InClass))
+			{
+				++Count;
+			}
+		}
+		return Count;
+	}
+
+	template <typename T>
+	uint32 CountTyped()
+	{
+		uint32 Count = 0;
+		for (TObjectIterator<T> It; It; ++It)
+		{
+			++Count;
+		}
+		return Count;
+	}
+
+	/**
+	 * @brief 순회하면서 방금 나온 객체와 아직 나오지 않은 객체를 지울 때, 남은 객체를 빠짐없이 한 번씩 돌고 지운 객체는 나오지 않는지 확인
+	 * @return 한 번도 나오지 않았거나 두 번 이상 나온 객체 수
+	 */
+	int32 CountDeleteWhileIteratingErrors(int32 InObjectCount)
+	{
+		TSet<UObject*> Remaining;
+		for (int32 Index = 0; Index < InObjectCount; ++Index)
+		{
+			Remaining.insert(new UObject());
+		}
+
+		TSet<UObject*> Deleted;
+		int32 DuplicateCount = 0;
+		int32 VisitCount = 0;
+		for (TObjectIterator<UObject> It; It; ++It)
+		{
+			UObject* Object = *It;
+			// 지운 객체가 다시 나오면 버킷 자리를 비우지 못한 것
+			DuplicateCount += Deleted.count(Object) > 0 ? 1 : 0;
+			if (Remaining.erase(Object) > 0)
+			{
+				Deleted.insert(Object);
+				delete Object;
+			}
+
+			// 가끔 아직 나오지 않은 객체도 지운다
+			if (++VisitCount % 7 == 0 && !Remaining.empty())
+			{
+				UObject* Ahead = *Remaining.begin();
+				Remaining.erase(Remaining.begin());
+				Deleted.insert(Ahead);
+				delete Ahead;
+			}
+		}
+
+		const int32 MissedCount = static_cast<int32>(Remaining.size());
+		for (UObject* Object : Remaining)
+		{
+			delete Object;
+		}
+		return MissedCount + DuplicateCount;
+	}
+
+	/**
+	 * @brief UObject를 라운드마다 대량으로 만들고 모두 지운 뒤 UMaterial / UObject 순회 시간을 측정
+	 * 삭제된 자리를 nullptr로 남기며 계속 늘어나는 예전 배열을 함께 흉내 내어, 라운드가 지날수록
+	 * 예전 방식의 순회 비용은 늘어나고 슬롯 맵은 그대로인지 비교한다.
+	 * 삭제된 객체의 TWeakObjectPtr가 슬롯 재사용 후에도 nullptr인지, 순회 중 삭제가 다른 객체를 건너뛰지 않는지도 확인한다.
+	 * @note 인자: [라운드 수] (기본 20), [라운드당 객체 수] (기본 100000)
+	 */
+	void RunObjectChurnBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 Rounds = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 20));
+		const int32 ObjectsPerRound = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 100000));
+
+		FUObjectArray& ObjectArray = GetUObjectArray();
+		UClass* MaterialClass = UMaterial::StaticClass();
+
+		TArray<UObject*> LegacyArray;
+		for (TObjectIterator<UObject> It; It; ++It)
+		{
+			LegacyArray.push_back(*It);
+		}
+		const uint32 InitialSlotCount = ObjectArray.GetSlotCount();
+		const uint32 MaterialCount = CountTyped<UMaterial>();
+
+		TArray<UObject*> Churn;
+		Churn.reserve(ObjectsPerRound);
+		TArray<TWeakObjectPtr<UObject>> DestroyedObjects;
+
+		double ChurnMilliseconds = 0.0;
+		double FirstTypedMilliseconds = 0.0, LastTypedMilliseconds = 0.0;
+		double FirstLegacyMilliseconds = 0.0, LastLegacyMilliseconds = 0.0;
+		int32 CountMismatch = 0;
+
+		for (int32 Round = 0; Round < Rounds; ++Round)
+		{
+			FScopeCycleCounter ChurnCounter;
+			for (int32 Index = 0; Index < ObjectsPerRound; ++Index)
+			{
+				Churn.push_back(new UObject());
+			}
+
+			// 생성 직후 한 번 순회해 새 객체를 버킷에 넣어 둔다, 삭제가 버킷에서 빼는 경로까지 측정하기 위함
+			CountTyped<UObject>();
+
+			DestroyedObjects.emplace_back(Churn.front());
+			for (UObject* Object : Churn)
+			{
+				LegacyArray.push_back(Object);
+				delete Object;
+			}
+			Churn.clear();
+			ChurnMilliseconds += ChurnCounter.Finish();
+
+			// 예전 배열에서는 삭제된 객체 자리가 nullptr로 남는다
+			std::fill(LegacyArray.end() - ObjectsPerRound, LegacyArray.end(), nullptr);
+
+			FScopeCycleCounter TypedCounter;
+			const uint32 TypedCount = CountTyped<UMaterial>();
+			const double TypedMilliseconds = TypedCounter.Finish();
+
+			FScopeCycleCounter LegacyCounter;
+			const uint32 LegacyCount = CountLegacy(LegacyArray, MaterialClass);
+			const double LegacyMilliseconds = LegacyCounter.Finish();
+
+			if (TypedCount != MaterialCount || LegacyCount != MaterialCount)
+			{
+				++CountMismatch;
+			}
+
+			if (Round == 0)
+			{
+				FirstTypedMilliseconds = TypedMilliseconds;
+				FirstLegacyMilliseconds = LegacyMilliseconds;
+			}
+			LastTypedMilliseconds = TypedMilliseconds;
+			LastLegacyMilliseconds = LegacyMilliseconds;
+		}
+
+		const int32 IterationErrors = CountDeleteWhileIteratingErrors(std::min(ObjectsPerRound, 10000));
+
+		int32 StaleWeakCount = 0;
+		for (const TWeakObjectPtr<UObject>& Weak : DestroyedObjects)
+		{
+			if (Weak.IsValid())
+			{
+				++StaleWeakCount;
+			}
+		}
+
+		const int64 TotalObjects = static_cast<int64>(Rounds) * ObjectsPerRound;
+		UE_LOG_INFO("ObjectChurn: %lld objects created/destroyed in %.1fms (%.1f ns/object)",
+			TotalObjects, ChurnMilliseconds, ChurnMilliseconds * 1.0e6 / static_cast<double>(TotalObjects));
+		UE_LOG_INFO("ObjectChurn: slots %u -> %u (live %u) | legacy array %zu entries",
+			InitialSlotCount, ObjectArray.GetSlotCount(), ObjectArray.GetObjectCount(), LegacyArray.size());
+		UE_LOG_INFO("ObjectChurn: TObjectIterator<UMaterial> round 1 %.4fms -> round %d %.4fms | legacy scan %.3fms -> %.3fms",
+			FirstTypedMilliseconds, Rounds, LastTypedMilliseconds, FirstLegacyMilliseconds, LastLegacyMilliseconds);
+
+		if (CountMismatch > 0 || StaleWeakCount > 0 || IterationErrors > 0)
+		{
+			UE_LOG_ERROR("ObjectChurn: %d rounds counted wrong materials, %d weak pointers resolved to destroyed objects, %d objects missed or repeated while deleting during iteration",
+				CountMismatch, StaleWeakCount, IterationErrors);
+			return;
+		}
+		UE_LOG_SUCCESS("ObjectChurn: %u materials found every round, all %zu weak pointers to destroyed objects are null",
+			MaterialCount, DestroyedObjects.size());
+	}
+}
+
+IMPLEMENT_BENCHMARK("objectchurn", "Create and destroy millions of UObjects, compare typed iteration on the slot map with a legacy grow-only scan", RunObjectChurnBenchmark)
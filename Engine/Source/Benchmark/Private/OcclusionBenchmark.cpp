@@ -0,0 +1,516 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Core/Public/JobSystem.h"
+#include "Optimization/Public/OcclusionCuller.h"
+#include "Optimization/Public/PrimitiveBoundsSoA.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+#include "Utility/Public/JsonSerializer.h"
+
+namespace
+{
+	/** @brief 오클루더로 래스터화할 메시, ObjImporter와 같이 Y축을 뒤집은 엔진 좌표계로 읽는다 */
+	struct FLayoutMesh
+	{
+		TArray<FNormalVertex> Vertices;
+		TArray<uint32> Indices;
+		FVector LocalMin;
+		FVector LocalMax;
+	};
+
+	struct FLayoutInstance
+	{
+		int32 MeshIndex = 0;
+		FMatrix World;
+		FVector Min;
+		FVector Max;
+	};
+
+	/** @brief .scene 파일에서 GPU 리소스 없이 읽어 온 스태틱 메시 배치와 뷰포트 카메라 */
+	struct FSceneLayout
+	{
+		FString Name;
+		TArray<FLayoutMesh> Meshes;
+		TArray<FLayoutInstance> Instances;
+		FVector CameraLocation = FVector(-15.0f, 0.0f, 10.0f);
+		float FovY = 90.0f;
+	};
+
+	/** @brief OBJ의 v / f 줄만 읽어 부채꼴로 삼각형화 (재질, 법선, UV는 오클루전에 필요 없음) */
+	bool LoadObjMesh(const FString& InPath, FLayoutMesh& OutMesh)
+	{
+		std::ifstream File(InPath);
+		if (!File.is_open())
+		{
+			return false;
+		}
+
+		OutMesh.Vertices.clear();
+		OutMesh.Indices.clear();
+
+		FString Line;
+		TArray<int32> Face;
+		while (std::getline(File, Line))
+		{
+			std::istringstream Tokenizer(Line);
+			FString Token;
+			Tokenizer >> Token;
+
+			if (Token == "v")
+			{
+				FVector Position;
+				Tokenizer >> Position.X >> Position.Y >> Position.Z;
+
+				FNormalVertex Vertex = {};
+				Vertex.Position = FVector(Position.X, -Position.Y, Position.Z);
+				OutMesh.Vertices.push_back(Vertex);
+			}
+			else if (Token == "f")
+			{
+				Face.clear();
+				while (Tokenizer >> Token)
+				{
+					// "v", "v/vt", "v//vn", "v/vt/vn" 모두 첫 숫자가 위치 인덱스, 음수는 끝에서부터
+					const int32 Index = std::atoi(Token.c_str());
+					Face.push_back(Index > 0 ? Index - 1 : static_cast<int32>(OutMesh.Vertices.size()) + Index);
+				}
+
+				for (size_t Corner = 2; Corner < Face.size(); ++Corner)
+				{
+					OutMesh.Indices.push_back(static_cast<uint32>(Face[0]));
+					OutMesh.Indices.push_back(static_cast<uint32>(Face[Corner - 1]));
+					OutMesh.Indices.push_back(static_cast<uint32>(Face[Corner]));
+				}
+			}
+		}
+
+		if (OutMesh.Vertices.empty())
+		{
+			return false;
+		}
+
+		OutMesh.LocalMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		OutMesh.LocalMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (const FNormalVertex& Vertex : OutMesh.Vertices)
+		{
+			OutMesh.LocalMin = FVector(std::min(OutMesh.LocalMin.X, Vertex.Position.X), std::min(OutMesh.LocalMin.Y, Vertex.Position.Y), std::min(OutMesh.LocalMin.Z, Vertex.Position.Z));
+			OutMesh.LocalMax = FVector(std::max(OutMesh.LocalMax.X, Vertex.Position.X), std::max(OutMesh.LocalMax.Y, Vertex.Position.Y), std::max(OutMesh.LocalMax.Z, Vertex.Position.Z));
+		}
+		return true;
+	}
+
+	/** @brief 메시를 찾지 못했을 때 쓰는 [-1, 1] 정육면체 */
+	FLayoutMesh MakeCubeMesh()
+	{
+		FLayoutMesh Mesh;
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			FNormalVertex Vertex = {};
+			Vertex.Position = FVector((Corner & 1) ? 1.0f : -1.0f, (Corner & 2) ? 1.0f : -1.0f, (Corner & 4) ? 1.0f : -1.0f);
+			Mesh.Vertices.push_back(Vertex);
+		}
+
+		// 화면에 투영했을 때 앞면이 반시계 방향 (Y를 뒤집어 읽은 OBJ 메시와 같은 감김)
+		Mesh.Indices = { 0, 1, 2, 1, 3, 2,  4, 6, 5, 5, 6, 7,  0, 4, 1, 1, 4, 5,  2, 3, 6, 3, 7, 6,  0, 2, 4, 2, 6, 4,  1, 5, 3, 3, 5, 7 };
+		Mesh.LocalMin = FVector(-1.0f, -1.0f, -1.0f);
+		Mesh.LocalMax = FVector(1.0f, 1.0f, 1.0f);
+		return Mesh;
+	}
+
+	void ComputeWorldBounds(const FLayoutMesh& InMesh, FLayoutInstance& InOutInstance)
+	{
+		InOutInstance.Min = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		InOutInstance.Max = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const FVector Local((Corner & 1) ? InMesh.LocalMax.X : InMesh.LocalMin.X,
+				(Corner & 2) ? InMesh.LocalMax.Y : InMesh.LocalMin.Y,
+				(Corner & 4) ? InMesh.LocalMax.Z : InMesh.LocalMin.Z);
+			const FVector4 World = FVector4(Local, 1.0f) * InOutInstance.World;
+			InOutInstance.Min = FVector(std::min(InOutInstance.Min.X, World.X), std::min(InOutInstance.Min.Y, World.Y), std::min(InOutInstance.Min.Z, World.Z));
+			InOutInstance.Max = FVector(std::max(InOutInstance.Max.X, World.X), std::max(InOutInstance.Max.Y, World.Y), std::max(InOutInstance.Max.Z, World.Z));
+		}
+	}
+
+	/**
+	 * @brief .scene의 UStaticMeshComponent 배치(부모 컴포넌트 변환 포함)와 마지막 원근 카메라 위치를 읽는다
+	 * @note 작업 디렉터리(Engine/)와 저장소 루트 모두에서 찾는다
+	 */
+	bool LoadSceneLayout(const FString& InFileName, FSceneLayout& OutLayout)
+	{
+		JSON SceneJson;
+		if (!FJsonSerializer::LoadJsonFromFile(SceneJson, InFileName) &&
+			!FJsonSerializer::LoadJsonFromFile(SceneJson, "../" + InFileName))
+		{
+			return false;
+		}
+
+		OutLayout = FSceneLayout();
+		OutLayout.Name = InFileName;
+		TMap<FString, int32> MeshIndices;
+
+		JSON ActorsJson;
+		if (!FJsonSerializer::ReadObject(SceneJson, "Actors", ActorsJson, nullptr, false))
+		{
+			return false;
+		}
+
+		for (auto& Pair : ActorsJson.ObjectRange())
+		{
+			JSON ComponentsJson;
+			if (!FJsonSerializer::ReadArray(Pair.second, "Components", ComponentsJson, nullptr, false))
+			{
+				continue;
+			}
+
+			// 컴포넌트는 부모가 먼저 저장되므로 한 번 훑으면서 월드 행렬을 누적한다
+			TMap<FString, FMatrix> ComponentWorlds;
+			for (JSON& ComponentJson : ComponentsJson.ArrayRange())
+			{
+				FString Type, Name, ParentName, MeshPath;
+				FVector Location, Rotation, Scale;
+				FJsonSerializer::ReadString(ComponentJson, "Type", Type, "", false);
+				FJsonSerializer::ReadString(ComponentJson, "Name", Name, "", false);
+				FJsonSerializer::ReadString(ComponentJson, "ParentName", ParentName, "", false);
+				FJsonSerializer::ReadVector(ComponentJson, "Location", Location, FVector::Zero(), false);
+				FJsonSerializer::ReadVector(ComponentJson, "Rotation", Rotation, FVector::Zero(), false);
+				FJsonSerializer::ReadVector(ComponentJson, "Scale", Scale, FVector(1.0f, 1.0f, 1.0f), false);
+
+				FMatrix World = FMatrix::GetModelMatrix(Location, FQuaternion::FromEuler(Rotation), Scale);
+				auto Parent = ComponentWorlds.find(ParentName);
+				if (Parent != ComponentWorlds.end())
+				{
+					World *= Parent->second;
+				}
+				ComponentWorlds[Name] = World;
+
+				if (Type != "UStaticMeshComponent")
+				{
+					continue;
+				}
+
+				FJsonSerializer::ReadString(ComponentJson, "ObjStaticMeshAsset", MeshPath, "", false);
+				auto Found = MeshIndices.find(MeshPath);
+				if (Found == MeshIndices.end())
+				{
+					FLayoutMesh Mesh;
+					if (!LoadObjMesh(MeshPath, Mesh))
+					{
+						UE_LOG_WARNING("OcclusionBench: %s를 읽지 못해 정육면체로 대신합니다", MeshPath.c_str());
+						Mesh = MakeCubeMesh();
+					}
+					OutLayout.Meshes.push_back(std::move(Mesh));
+					Found = MeshIndices.emplace(MeshPath, static_cast<int32>(OutLayout.Meshes.size()) - 1).first;
+				}
+
+				FLayoutInstance Instance;
+				Instance.MeshIndex = Found->second;
+				Instance.World = World;
+				ComputeWorldBounds(OutLayout.Meshes[Instance.MeshIndex], Instance);
+				OutLayout.Instances.push_back(Instance);
+			}
+		}
+
+		JSON CamerasJson;
+		if (FJsonSerializer::ReadArray(SceneJson, "PerspectiveCamera", CamerasJson, nullptr, false))
+		{
+			for (const JSON& CameraJson : CamerasJson.ArrayRange())
+			{
+				FJsonSerializer::ReadVector(CameraJson, "Location", OutLayout.CameraLocation, OutLayout.CameraLocation, false);
+				FJsonSerializer::ReadArrayFloat(CameraJson, "FOV", OutLayout.FovY, OutLayout.FovY, false);
+			}
+		}
+
+		return !OutLayout.Instances.empty();
+	}
+
+	/** @brief 씬 파일이 없을 때 쓰는 도시 블록 배치, 높이가 다른 건물이 골목을 사이에 두고 늘어선다 */
+	void BuildSyntheticLayout(FSceneLayout& OutLayout)
+	{
+		OutLayout = FSceneLayout();
+		OutLayout.Name = "synthetic city block";
+		OutLayout.Meshes.push_back(MakeCubeMesh());
+
+		for (int32 Block = 0; Block < 4; ++Block)
+		{
+			FLayoutInstance Instance;
+			const float Height = 6.0f + 4.0f * static_cast<float>(Block % 3);
+			Instance.World = FMatrix::GetModelMatrix(FVector((Block & 1) * 14.0f, (Block >> 1) * 14.0f, Height),
+				FVector::Zero(), FVector(5.0f, 5.0f, Height));
+			ComputeWorldBounds(OutLayout.Meshes[0], Instance);
+			OutLayout.Instances.push_back(Instance);
+		}
+		OutLayout.CameraLocation = FVector(-15.0f, 0.0f, 4.0f);
+	}
+
+	/** @brief 한 장면 배치를 InGridSize x InGridSize 격자로 복제해서 멀리 있는 복제본이 가까운 복제본에 가려지게 한다 */
+	void ReplicateLayout(FSceneLayout& InOutLayout, int32 InGridSize, float& OutCellSize, FVector& OutGridCenter)
+	{
+		FVector LayoutMin(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector LayoutMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (const FLayoutInstance& Instance : InOutLayout.Instances)
+		{
+			LayoutMin = FVector(std::min(LayoutMin.X, Instance.Min.X), std::min(LayoutMin.Y, Instance.Min.Y), std::min(LayoutMin.Z, Instance.Min.Z));
+			LayoutMax = FVector(std::max(LayoutMax.X, Instance.Max.X), std::max(LayoutMax.Y, Instance.Max.Y), std::max(LayoutMax.Z, Instance.Max.Z));
+		}
+
+		// 배치 크기의 절반만큼 길을 둔다
+		OutCellSize = std::max(LayoutMax.X - LayoutMin.X, LayoutMax.Y - LayoutMin.Y) * 1.5f;
+		OutGridCenter = FVector((LayoutMin.X + LayoutMax.X) * 0.5f + OutCellSize * (InGridSize - 1) * 0.5f,
+			(LayoutMin.Y + LayoutMax.Y) * 0.5f + OutCellSize * (InGridSize - 1) * 0.5f, (LayoutMin.Z + LayoutMax.Z) * 0.5f);
+
+		const TArray<FLayoutInstance> Original = InOutLayout.Instances;
+		InOutLayout.Instances.clear();
+		for (int32 CellY = 0; CellY < InGridSize; ++CellY)
+		{
+			for (int32 CellX = 0; CellX < InGridSize; ++CellX)
+			{
+				const FMatrix Offset = FMatrix::TranslationMatrix(FVector(CellX * OutCellSize, CellY * OutCellSize, 0.0f));
+				for (FLayoutInstance Instance : Original)
+				{
+					Instance.World *= Offset;
+					ComputeWorldBounds(InOutLayout.Meshes[Instance.MeshIndex], Instance);
+					InOutLayout.Instances.push_back(Instance);
+				}
+			}
+		}
+	}
+
+	/** @brief UCamera::UpdateMatrixByPers와 같은 View / Projection */
+	FCameraConstants MakeCamera(const FVector& InEye, float InYawDegree, float InPitchDegree, float InFovY, float InAspect)
+	{
+		const FMatrix RotationMatrix = FMatrix::RotationMatrix(FVector::GetDegreeToRadian(FVector(0.0f, InPitchDegree, InYawDegree)));
+		const FVector4 Forward4 = FVector4::ForwardVector() * RotationMatrix;
+		const FVector4 WorldUp4 = FVector4::UpVector() * RotationMatrix;
+
+		FVector Forward(Forward4.X, Forward4.Y, Forward4.Z);
+		Forward.Normalize();
+		FVector Right = Forward.Cross(FVector(WorldUp4.X, WorldUp4.Y, WorldUp4.Z));
+		Right.Normalize();
+		FVector Up = Right.Cross(Forward);
+		Up.Normalize();
+
+		FCameraConstants Camera;
+		Camera.View = FMatrix::TranslationMatrixInverse(InEye) * FMatrix(Right, Up, Forward).Transpose();
+
+		constexpr float NearZ = 0.1f;
+		constexpr float FarZ = 1000.0f;
+		const float F = 1.0f / tanf(FVector::GetDegreeToRadian(InFovY) * 0.5f);
+		FMatrix Projection = FMatrix::Identity();
+		Projection.Data[0][0] = F / InAspect;
+		Projection.Data[1][1] = F;
+		Projection.Data[2][2] = FarZ / (FarZ - NearZ);
+		Projection.Data[2][3] = 1.0f;
+		Projection.Data[3][2] = (-NearZ * FarZ) / (FarZ - NearZ);
+		Projection.Data[3][3] = 0.0f;
+		Camera.Projection = Projection;
+
+		Camera.ViewWorldLocation = InEye;
+		Camera.NearClip = NearZ;
+		Camera.FarClip = FarZ;
+		return Camera;
+	}
+
+	/** @brief ViewVolumeCuller::Cull과 같은 방식으로 View * Projection에서 절두체 평면을 뽑는다 */
+	FFrustum ExtractFrustum(const FMatrix& InViewProj)
+	{
+		FFrustum Frustum;
+		Frustum.Planes[0] = InViewProj[3] + InViewProj[0];
+		Frustum.Planes[1] = InViewProj[3] - InViewProj[0];
+		Frustum.Planes[2] = InViewProj[3] + InViewProj[1];
+		Frustum.Planes[3] = InViewProj[3] - InViewProj[1];
+		Frustum.Planes[4] = InViewProj[2];
+		Frustum.Planes[5] = InViewProj[3] - InViewProj[2];
+
+		for (FVector4& Plane : Frustum.Planes)
+		{
+			const float Length = sqrtf(Plane.X * Plane.X + Plane.Y * Plane.Y + Plane.Z * Plane.Z);
+			Plane /= -Length;
+		}
+		return Frustum;
+	}
+
+	struct FOcclusionFrameResult
+	{
+		int32 FrustumVisible = 0;
+		int32 OcclusionVisible = 0;
+		int32 OccluderTriangles = 0;
+	};
+
+	/** @brief COcclusionCuller::Cull과 같은 기준(화면 크기, 삼각형 예산)으로 오클루더를 고르고 절두체를 통과한 인스턴스를 검사 */
+	FOcclusionFrameResult CullFrame(const FSceneLayout& InLayout, const FPrimitiveBoundsSoA& InBounds, const TArray<int32>& InSlotToInstance,
+		const FCameraConstants& InCamera, COcclusionCuller& InCuller, FJobSystem* InJobSystem,
+		TArray<uint64>& InMask, TArray<int32>& InVisible, TArray<std::pair<float, int32>>& InOccluders)
+	{
+		FOcclusionFrameResult Result;
+
+		const FMatrix ViewProj = InCamera.View * InCamera.Projection;
+		InBounds.CullRange(ExtractFrustum(ViewProj), 0, InBounds.Num(), InMask);
+
+		InVisible.clear();
+		for (size_t WordIndex = 0; WordIndex < InMask.size(); ++WordIndex)
+		{
+			for (uint64 Word = InMask[WordIndex]; Word != 0; Word &= Word - 1)
+			{
+				int32 Bit = 0;
+				while (((Word >> Bit) & 1) == 0) { ++Bit; }
+				InVisible.push_back(InSlotToInstance[WordIndex * 64 + Bit]);
+			}
+		}
+		Result.FrustumVisible = static_cast<int32>(InVisible.size());
+
+		InCuller.BeginFrame(ViewProj);
+
+		InOccluders.clear();
+		for (int32 InstanceIndex : InVisible)
+		{
+			const FLayoutInstance& Instance = InLayout.Instances[InstanceIndex];
+			const float RadiusSquared = ((Instance.Max - Instance.Min) * 0.5f).LengthSquared();
+			const float DistanceSquared = FVector::DistSquared(InCamera.ViewWorldLocation, (Instance.Min + Instance.Max) * 0.5f);
+			if (DistanceSquared > RadiusSquared && RadiusSquared >= COcclusionCuller::MIN_OCCLUDER_SCREEN_SIZE * DistanceSquared)
+			{
+				InOccluders.emplace_back(RadiusSquared / DistanceSquared, InstanceIndex);
+			}
+		}
+		std::sort(InOccluders.begin(), InOccluders.end(),
+			[](const std::pair<float, int32>& A, const std::pair<float, int32>& B) { return A.first > B.first; });
+
+		// COcclusionCuller::Cull처럼 래스터화된 오클루더는 자기 깊이와 비교하지 않는다
+		TArray<uint8> bIsOccluder(InLayout.Instances.size(), 0);
+		for (const std::pair<float, int32>& Occluder : InOccluders)
+		{
+			if (InCuller.GetOccluderTriangleCount() >= COcclusionCuller::OCCLUDER_TRIANGLE_BUDGET)
+			{
+				break;
+			}
+
+			const FLayoutInstance& Instance = InLayout.Instances[Occluder.second];
+			const FLayoutMesh& Mesh = InLayout.Meshes[Instance.MeshIndex];
+			if (Mesh.Indices.size() / 3 <= COcclusionCuller::MAX_OCCLUDER_MESH_TRIANGLES)
+			{
+				if (InCuller.AddOccluderMesh(Mesh.Vertices.data(), static_cast<int32>(Mesh.Vertices.size()),
+					Mesh.Indices.data(), static_cast<int32>(Mesh.Indices.size()), Instance.World, true) > 0)
+				{
+					bIsOccluder[Occluder.second] = 1;
+				}
+			}
+		}
+		Result.OccluderTriangles = InCuller.GetOccluderTriangleCount();
+
+		InCuller.RasterizeOccluders(InJobSystem);
+
+		for (int32 InstanceIndex : InVisible)
+		{
+			const FLayoutInstance& Instance = InLayout.Instances[InstanceIndex];
+			Result.OcclusionVisible += bIsOccluder[InstanceIndex] || InCuller.IsVisible(Instance.Min, Instance.Max) ? 1 : 0;
+		}
+		return Result;
+	}
+
+	/**
+	 * @brief DecalPomTest.scene / test1.scene 배치를 격자로 복제한 장면에서 절두체 컬링 후 소프트웨어 오클루전 컬링의
+	 * 컬링 비율과 프레임당 시간을 단일 스레드 / 작업 시스템 래스터화로 측정
+	 * @note 인자: [격자 한 변의 복제 수=16] [프레임 수=120]
+	 */
+	void RunOcclusionBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 GridSize = std::clamp(FBenchmarkRegistry::GetIntArg(InArgs, 0, 16), 1, 256);
+		const int32 Frames = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 120));
+		constexpr float Aspect = 16.0f / 9.0f;
+
+		TArray<FSceneLayout> Layouts;
+		for (const char* SceneFile : { "DecalPomTest.scene", "test1.scene" })
+		{
+			FSceneLayout Layout;
+			if (LoadSceneLayout(SceneFile, Layout))
+			{
+				Layouts.push_back(std::move(Layout));
+			}
+			else
+			{
+				UE_LOG_WARNING("OcclusionBench: %s를 찾지 못했습니다", SceneFile);
+			}
+		}
+		if (Layouts.empty())
+		{
+			Layouts.emplace_back();
+			BuildSyntheticLayout(Layouts.back());
+		}
+
+		FJobSystem Jobs(FJobSystem::GetDefaultWorkerCount());
+
+		for (FSceneLayout& Layout : Layouts)
+		{
+			float CellSize = 0.0f;
+			FVector GridCenter;
+			ReplicateLayout(Layout, GridSize, CellSize, GridCenter);
+
+			FPrimitiveBoundsSoA Bounds;
+			TArray<int32> BoundsIndices(Layout.Instances.size(), -1);
+			TArray<int32> SlotToInstance(Layout.Instances.size());
+			for (int32 Index = 0; Index < static_cast<int32>(Layout.Instances.size()); ++Index)
+			{
+				const int32 Slot = Bounds.Add(nullptr, Layout.Instances[Index].Min, Layout.Instances[Index].Max, BoundsIndices[Index]);
+				SlotToInstance[Slot] = Index;
+			}
+
+			// 씬 카메라 높이에서 격자 가장자리를 따라 돌며 골목 방향으로 격자 중심을 본다
+			const float EyeHeight = std::min(Layout.CameraLocation.Z, GridCenter.Z);
+			const float OrbitRadius = CellSize * GridSize * 0.5f;
+			TArray<FCameraConstants> Cameras;
+			for (int32 Frame = 0; Frame < Frames; ++Frame)
+			{
+				const float Angle = 2.0f * PI * static_cast<float>(Frame) / static_cast<float>(Frames);
+				const FVector Eye(GridCenter.X - cosf(Angle) * OrbitRadius, GridCenter.Y - sinf(Angle) * OrbitRadius, EyeHeight);
+				Cameras.push_back(MakeCamera(Eye, Angle * 180.0f / PI, 0.0f, Layout.FovY, Aspect));
+			}
+
+			size_t TriangleCount = 0;
+			for (const FLayoutMesh& Mesh : Layout.Meshes)
+			{
+				TriangleCount += Mesh.Indices.size() / 3;
+			}
+			UE_LOG_INFO("OcclusionBench: %s | %dx%d grid, %zu instances, %zu mesh(es) %zu tris, %d frames, %u workers",
+				Layout.Name.c_str(), GridSize, GridSize, Layout.Instances.size(), Layout.Meshes.size(), TriangleCount, Frames, Jobs.GetWorkerCount());
+
+			COcclusionCuller Culler;
+			TArray<uint64> Mask;
+			TArray<int32> Visible;
+			TArray<std::pair<float, int32>> Occluders;
+
+			int64 ReferenceVisible = -1;
+			for (FJobSystem* JobSystem : { static_cast<FJobSystem*>(nullptr), &Jobs })
+			{
+				CullFrame(Layout, Bounds, SlotToInstance, Cameras[0], Culler, JobSystem, Mask, Visible, Occluders);
+
+				int64 FrustumVisibleTotal = 0;
+				int64 OcclusionVisibleTotal = 0;
+				int64 OccluderTriangleTotal = 0;
+				FScopeCycleCounter Counter;
+				for (const FCameraConstants& Camera : Cameras)
+				{
+					const FOcclusionFrameResult Result = CullFrame(Layout, Bounds, SlotToInstance, Camera, Culler, JobSystem, Mask, Visible, Occluders);
+					FrustumVisibleTotal += Result.FrustumVisible;
+					OcclusionVisibleTotal += Result.OcclusionVisible;
+					OccluderTriangleTotal += Result.OccluderTriangles;
+				}
+				const double TotalMs = Counter.Finish();
+
+				const double CullRate = FrustumVisibleTotal > 0 ?
+					100.0 * static_cast<double>(FrustumVisibleTotal - OcclusionVisibleTotal) / static_cast<double>(FrustumVisibleTotal) : 0.0;
+				UE_LOG_INFO("OcclusionBench:   %-12s %.3fms/frame | frustum %.1f -> occlusion %.1f visible (cull rate %.1f%%) | %.0f occluder tris",
+					JobSystem ? "job system" : "single", TotalMs / Frames,
+					static_cast<double>(FrustumVisibleTotal) / Frames, static_cast<double>(OcclusionVisibleTotal) / Frames,
+					CullRate, static_cast<double>(OccluderTriangleTotal) / Frames);
+
+				if (ReferenceVisible >= 0 && ReferenceVisible != OcclusionVisibleTotal)
+				{
+					UE_LOG_ERROR("OcclusionBench: 작업 시스템 래스터화 결과가 단일 스레드와 다릅니다 (%lld vs %lld)",
+						static_cast<long long>(OcclusionVisibleTotal), static_cast<long long>(ReferenceVisible));
+				}
+				ReferenceVisible = OcclusionVisibleTotal;
+			}
+		}
+	}
+}
+
+IMPLEMENT_BENCHMARK("occlusion", "Measure software occlusion cull rate and ms/frame on DecalPomTest.scene / test1.scene layouts", RunOcclusionBenchmark)
@@ -0,0 +1,873 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Core/Public/JobSystem.h"
+#include "Global/Octree.h"
+#include "Optimization/Public/PrimitiveBoundsSoA.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+#include <random>
+
+namespace
+{
+	/** @brief 벤치마크용 합성 씬, 프리미티브 포인터는 역참조하지 않는 식별자로만 사용 */
+	struct FSyntheticScene
+	{
+		TArray<FAABB> Bounds;
+		/** @brief UPrimitiveComponent::OctreeElementId 대신 사용하는 역참조 저장소 */
+		TArray<FOctreeElementId> ElementIds;
+		/** @brief UPrimitiveComponent::PrimitiveBoundsIndex 대신 사용하는 SoA 슬롯 인덱스 */
+		TArray<int32> BoundsIndices;
+
+		static UPrimitiveComponent* ToHandle(int32 InIndex)
+		{
+			return reinterpret_cast<UPrimitiveComponent*>(static_cast<uintptr_t>(InIndex + 1) << 4);
+		}
+
+		static int32 ToIndex(const UPrimitiveComponent* InHandle)
+		{
+			return static_cast<int32>((reinterpret_cast<uintptr_t>(InHandle) >> 4) - 1);
+		}
+
+		const FAABB& GetBounds(const UPrimitiveComponent* InHandle) const { return Bounds[ToIndex(InHandle)]; }
+		FOctreeElementId& GetElementId(const UPrimitiveComponent* InHandle) { return ElementIds[ToIndex(InHandle)]; }
+	};
+
+	/**
+	 * @brief 기존 FOctree (고정 크기 루트, 노드마다 new, 재귀 std::find 제거) 알고리즘의 복사본
+	 * GetWorldAABB 호출만 합성 씬의 경계 조회로 바꿔 같은 데이터로 비교할 수 있게 함
+	 */
+	class FLegacyOctree
+	{
+	public:
+		static constexpr int LEGACY_MAX_PRIMITIVES = 16;
+		static constexpr int LEGACY_MAX_DEPTH = 5;
+
+		FLegacyOctree(const FSyntheticScene& InScene, const FAABB& InBoundingBox, int InDepth)
+			: Scene(InScene), BoundingBox(InBoundingBox), Depth(InDepth)
+		{
+			Children.resize(8);
+		}
+
+		~FLegacyOctree()
+		{
+			for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+		}
+
+		bool Insert(UPrimitiveComponent* InPrimitive)
+		{
+			const FAABB& PrimitiveBounds = Scene.GetBounds(InPrimitive);
+			if (BoundingBox.IsIntersected(PrimitiveBounds) == false) { return false; }
+
+			if (IsLeaf())
+			{
+				if (Primitives.size() < LEGACY_MAX_PRIMITIVES || Depth == LEGACY_MAX_DEPTH)
+				{
+					Primitives.push_back(InPrimitive);
+					return true;
+				}
+				Subdivide(InPrimitive);
+				return true;
+			}
+
+			for (int Index = 0; Index < 8; ++Index)
+			{
+				if (Children[Index] && Children[Index]->BoundingBox.IsContains(PrimitiveBounds))
+				{
+					return Children[Index]->Insert(InPrimitive);
+				}
+			}
+
+			Primitives.push_back(InPrimitive);
+			return true;
+		}
+
+		bool Remove(UPrimitiveComponent* InPrimitive)
+		{
+			if (auto It = std::find(Primitives.begin(), Primitives.end(), InPrimitive); It != Primitives.end())
+			{
+				*It = std::move(Primitives.back());
+				Primitives.pop_back();
+				return true;
+			}
+
+			if (IsLeaf()) { return false; }
+
+			for (int Index = 0; Index < 8; ++Index)
+			{
+				if (Children[Index] && Children[Index]->Remove(InPrimitive))
+				{
+					TryMerge();
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const
+		{
+			OutPrimitives.insert(OutPrimitives.end(), Primitives.begin(), Primitives.end());
+			if (!IsLeaf())
+			{
+				for (int Index = 0; Index < 8; ++Index)
+				{
+					if (Children[Index]) { Children[Index]->GetAllPrimitives(OutPrimitives); }
+				}
+			}
+		}
+
+		void Cull(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutVisible) const
+		{
+			TDeque<const FLegacyOctree*> VisitingNodes;
+			VisitingNodes.push_back(this);
+
+			while (!VisitingNodes.empty())
+			{
+				const FLegacyOctree* CurrentNode = VisitingNodes.back();
+				VisitingNodes.pop_back();
+
+				const EBoundCheckResult Result = InFrustum.CheckIntersection(CurrentNode->BoundingBox);
+				if (Result == EBoundCheckResult::Outside)
+				{
+					continue;
+				}
+				if (Result == EBoundCheckResult::Inside)
+				{
+					TArray<UPrimitiveComponent*> Primitives;
+					CurrentNode->GetAllPrimitives(Primitives);
+					OutVisible.insert(OutVisible.end(), Primitives.begin(), Primitives.end());
+					continue;
+				}
+
+				for (UPrimitiveComponent* Primitive : CurrentNode->Primitives)
+				{
+					if (InFrustum.CheckIntersection(Scene.GetBounds(Primitive)) != EBoundCheckResult::Outside)
+					{
+						OutVisible.push_back(Primitive);
+					}
+				}
+
+				if (!CurrentNode->IsLeaf())
+				{
+					for (const FLegacyOctree* Child : CurrentNode->Children)
+					{
+						if (Child) { VisitingNodes.push_back(Child); }
+					}
+				}
+			}
+		}
+
+	private:
+		bool IsLeaf() const { return Children[0] == nullptr; }
+
+		void Subdivide(UPrimitiveComponent* InPrimitive)
+		{
+			const FVector& Min = BoundingBox.Min;
+			const FVector& Max = BoundingBox.Max;
+			const FVector Center = (Min + Max) * 0.5f;
+
+			for (int Index = 0; Index < 8; ++Index)
+			{
+				const FVector ChildMin((Index & 1) ? Center.X : Min.X, (Index & 2) ? Center.Y : Min.Y, (Index & 4) ? Center.Z : Min.Z);
+				const FVector ChildMax((Index & 1) ? Max.X : Center.X, (Index & 2) ? Max.Y : Center.Y, (Index & 4) ? Max.Z : Center.Z);
+				Children[Index] = new FLegacyOctree(Scene, FAABB(ChildMin, ChildMax), Depth + 1);
+			}
+
+			TArray<UPrimitiveComponent*> PrimitivesToMove = Primitives;
+			PrimitivesToMove.push_back(InPrimitive);
+			Primitives.clear();
+
+			for (UPrimitiveComponent* Primitive : PrimitivesToMove)
+			{
+				Insert(Primitive);
+			}
+		}
+
+		void TryMerge()
+		{
+			if (IsLeaf()) { return; }
+
+			size_t TotalPrimitives = Primitives.size();
+			for (int Index = 0; Index < 8; ++Index)
+			{
+				if (!Children[Index]->IsLeaf()) { return; }
+				TotalPrimitives += Children[Index]->Primitives.size();
+			}
+
+			if (TotalPrimitives <= LEGACY_MAX_PRIMITIVES)
+			{
+				for (int Index = 0; Index < 8; ++Index)
+				{
+					Primitives.insert(Primitives.end(), Children[Index]->Primitives.begin(), Children[Index]->Primitives.end());
+					SafeDelete(Children[Index]);
+				}
+			}
+		}
+
+		const FSyntheticScene& Scene;
+		FAABB BoundingBox;
+		int Depth;
+		TArray<UPrimitiveComponent*> Primitives;
+		TArray<FLegacyOctree*> Children;
+	};
+
+	/** @brief ViewVolumeCuller::CullOctree와 같은 순서로 새 옥트리를 순회 */
+	void CullLooseOctree(const FOctree& InOctree, const FSyntheticScene& InScene, const FFrustum& InFrustum,
+		TArray<UPrimitiveComponent*>& OutVisible)
+	{
+		TArray<int32> VisitingNodes;
+		VisitingNodes.push_back(InOctree.GetRootIndex());
+
+		while (!VisitingNodes.empty())
+		{
+			const int32 NodeIndex = VisitingNodes.back();
+			const FOctreeNode& Node = InOctree.GetNode(NodeIndex);
+			VisitingNodes.pop_back();
+
+			const EBoundCheckResult Result = InFrustum.CheckIntersection(Node.LooseBounds);
+			if (Result == EBoundCheckResult::Outside)
+			{
+				continue;
+			}
+			if (Result == EBoundCheckResult::Inside)
+			{
+				InOctree.GetAllPrimitives(NodeIndex, OutVisible);
+				continue;
+			}
+
+			for (const FOctreeElement& Element : Node.Elements)
+			{
+				if (InFrustum.CheckIntersection(InScene.GetBounds(Element.Primitive)) != EBoundCheckResult::Outside)
+				{
+					OutVisible.push_back(Element.Primitive);
+				}
+			}
+
+			for (int32 Octant = 0; Octant < 8; ++Octant)
+			{
+				if (Node.HasChild(Octant)) { VisitingNodes.push_back(Node.Children[Octant]); }
+			}
+		}
+	}
+
+	/** @brief 비트마스크에서 켜진 비트의 프리미티브를 꺼낸다, InIndices가 없으면 비트 번호가 곧 슬롯 */
+	void AppendVisible(const FPrimitiveBoundsSoA& InBounds, const TArray<uint64>& InMask, const int32* InIndices,
+		TArray<UPrimitiveComponent*>& OutVisible)
+	{
+		for (size_t WordIndex = 0; WordIndex < InMask.size(); ++WordIndex)
+		{
+			uint64 Word = InMask[WordIndex];
+			for (size_t Bit = 0; Word != 0; ++Bit, Word >>= 1)
+			{
+				if (Word & 1)
+				{
+					const size_t Position = WordIndex * 64 + Bit;
+					OutVisible.push_back(InBounds.GetPrimitive(InIndices ? InIndices[Position] : static_cast<int32>(Position)));
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief ViewVolumeCuller::CullOctree와 같은 방식으로, Intersect 노드의 요소는 SoA 슬롯만 모은 뒤
+	 * FPrimitiveBoundsSoA::CullIndices로 한 번에 검사한다 (Inside 노드는 개별 검사 없이 전부 포함)
+	 */
+	void CullLooseOctreeSoA(const FOctree& InOctree, const FSyntheticScene& InScene, const FPrimitiveBoundsSoA& InBounds,
+		const FFrustum& InFrustum, TArray<int32>& OutCandidates, TArray<uint64>& OutMask, TArray<UPrimitiveComponent*>& OutVisible)
+	{
+		OutCandidates.clear();
+
+		TArray<int32> VisitingNodes;
+		VisitingNodes.push_back(InOctree.GetRootIndex());
+
+		while (!VisitingNodes.empty())
+		{
+			const int32 NodeIndex = VisitingNodes.back();
+			const FOctreeNode& Node = InOctree.GetNode(NodeIndex);
+			VisitingNodes.pop_back();
+
+			const EBoundCheckResult Result = InFrustum.CheckIntersection(Node.LooseBounds);
+			if (Result == EBoundCheckResult::Outside)
+			{
+				continue;
+			}
+			if (Result == EBoundCheckResult::Inside)
+			{
+				InOctree.GetAllPrimitives(NodeIndex, OutVisible);
+				continue;
+			}
+
+			for (const FOctreeElement& Element : Node.Elements)
+			{
+				OutCandidates.push_back(InScene.BoundsIndices[FSyntheticScene::ToIndex(Element.Primitive)]);
+			}
+
+			for (int32 Octant = 0; Octant < 8; ++Octant)
+			{
+				if (Node.HasChild(Octant)) { VisitingNodes.push_back(Node.Children[Octant]); }
+			}
+		}
+
+		InBounds.CullIndices(InFrustum, OutCandidates, OutMask);
+		AppendVisible(InBounds, OutMask, OutCandidates.data(), OutVisible);
+	}
+
+	/** @brief 카메라 기저로부터 FFrustum 평면(바깥 방향 법선, 양수면 Outside)을 만든다 */
+	FFrustum MakeFrustum(const FVector& InEye, const FVector& InForward, const FVector& InRight, const FVector& InUp,
+		float InTanHalfFov, float InNear, float InFar)
+	{
+		auto MakePlane = [](FVector InNormal, const FVector& InPoint)
+		{
+			InNormal.Normalize();
+			return FVector4(InNormal, -InNormal.Dot(InPoint));
+		};
+
+		FFrustum Frustum;
+		Frustum.Planes[0] = MakePlane((InRight + InForward * InTanHalfFov) * -1.0f, InEye);  // Left
+		Frustum.Planes[1] = MakePlane(InRight - InForward * InTanHalfFov, InEye);            // Right
+		Frustum.Planes[2] = MakePlane((InUp + InForward * InTanHalfFov) * -1.0f, InEye);     // Bottom
+		Frustum.Planes[3] = MakePlane(InUp - InForward * InTanHalfFov, InEye);               // Top
+		Frustum.Planes[4] = MakePlane(InForward * -1.0f, InEye + InForward * InNear);        // Near
+		Frustum.Planes[5] = MakePlane(InForward, InEye + InForward * InFar);                 // Far
+		return Frustum;
+	}
+
+	/** @brief 카메라가 월드를 가로지르며 한 바퀴 회전하는 플라이스루 */
+	TArray<FFrustum> MakeFlythrough(int32 InFrames, float InWorldHalfSize)
+	{
+		TArray<FFrustum> Frustums;
+		for (int32 Frame = 0; Frame < InFrames; ++Frame)
+		{
+			const float T = InFrames > 1 ? static_cast<float>(Frame) / static_cast<float>(InFrames - 1) : 0.0f;
+			const float Yaw = T * 2.0f * PI;
+			const FVector Eye(-InWorldHalfSize + 2.0f * InWorldHalfSize * T, InWorldHalfSize * 0.5f * sinf(Yaw), 10.0f);
+			const FVector Forward(cosf(Yaw), sinf(Yaw), 0.0f);
+			const FVector Up(0.0f, 0.0f, 1.0f);
+			const FVector Right(sinf(Yaw), -cosf(Yaw), 0.0f);
+			Frustums.push_back(MakeFrustum(Eye, Forward, Right, Up, tanf(PI / 6.0f), 0.1f, 1000.0f));
+		}
+		return Frustums;
+	}
+
+	void BuildScene(int32 InCount, float InWorldHalfSize, FSyntheticScene& OutScene)
+	{
+		std::mt19937 Random(0x0C7EE);
+		std::uniform_real_distribution<float> PositionXY(-InWorldHalfSize, InWorldHalfSize);
+		std::uniform_real_distribution<float> PositionZ(-50.0f, 50.0f);
+		std::uniform_real_distribution<float> SmallExtent(0.25f, 2.0f);
+		std::uniform_real_distribution<float> LargeExtent(10.0f, 50.0f);
+		std::uniform_int_distribution<int32> LargeChance(0, 99);
+
+		OutScene.Bounds.resize(InCount);
+		OutScene.ElementIds.assign(InCount, FOctreeElementId());
+		OutScene.BoundsIndices.assign(InCount, -1);
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			const FVector Center(PositionXY(Random), PositionXY(Random), PositionZ(Random));
+			const float Extent = LargeChance(Random) == 0 ? LargeExtent(Random) : SmallExtent(Random);
+			OutScene.Bounds[Index] = FAABB(Center - FVector(Extent, Extent, Extent), Center + FVector(Extent, Extent, Extent));
+		}
+	}
+
+	void RunOctreeBenchmarkForCount(int32 InCount, int32 InFrames)
+	{
+		constexpr float WorldHalfSize = 2000.0f;
+
+		FSyntheticScene Scene;
+		BuildScene(InCount, WorldHalfSize, Scene);
+
+		const TArray<FFrustum> Frustums = MakeFlythrough(InFrames, WorldHalfSize);
+
+		TArray<UPrimitiveComponent*> Handles(InCount);
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			Handles[Index] = FSyntheticScene::ToHandle(Index);
+		}
+
+		// --- Legacy: 고정 크기 루트 (ULevel 기존 설정), 실패한 프리미티브는 Dynamic 목록으로 ---
+		const FVector LegacyCenter(0, 0, -5);
+		const FVector LegacyHalf(37.5f, 37.5f, 37.5f);
+		FLegacyOctree* LegacyOctree = new FLegacyOctree(Scene, FAABB(LegacyCenter - LegacyHalf, LegacyCenter + LegacyHalf), 0);
+		TSet<UPrimitiveComponent*> LegacyDynamic;
+
+		FScopeCycleCounter LegacyInsertCounter;
+		for (UPrimitiveComponent* Handle : Handles)
+		{
+			if (!LegacyOctree->Insert(Handle))
+			{
+				LegacyDynamic.insert(Handle);
+			}
+		}
+		const double LegacyInsertMs = LegacyInsertCounter.Finish();
+		const size_t LegacyDynamicCount = LegacyDynamic.size();
+
+		// --- Loose: 월드 경계로 확장되는 루트 ---
+		FOctree LooseOctree(LegacyCenter, 75.0f);
+		uint32 LooseRejected = 0;
+
+		FScopeCycleCounter LooseInsertCounter;
+		for (UPrimitiveComponent* Handle : Handles)
+		{
+			if (!LooseOctree.Insert(Handle, Scene.GetBounds(Handle), Scene.GetElementId(Handle)))
+			{
+				++LooseRejected;
+			}
+		}
+		const double LooseInsertMs = LooseInsertCounter.Finish();
+
+		// --- Cull ---
+		TArray<UPrimitiveComponent*> Visible;
+		Visible.reserve(InCount);
+		size_t LegacyVisibleTotal = 0;
+		size_t LooseVisibleTotal = 0;
+		int32 LooseMissingFrames = 0;
+		int32 LegacyMissingFrames = 0;
+
+		double LegacyCullMs = 0.0;
+		double LooseCullMs = 0.0;
+		for (const FFrustum& Frustum : Frustums)
+		{
+			Visible.clear();
+			FScopeCycleCounter LegacyCullCounter;
+			LegacyOctree->Cull(Frustum, Visible);
+			// ULevel::GetDynamicPrimitives + ViewVolumeCuller::Cull의 선형 검사와 동일
+			TArray<UPrimitiveComponent*> DynamicPrimitives(LegacyDynamic.begin(), LegacyDynamic.end());
+			for (UPrimitiveComponent* Primitive : DynamicPrimitives)
+			{
+				if (Frustum.CheckIntersection(Scene.GetBounds(Primitive)) != EBoundCheckResult::Outside)
+				{
+					Visible.push_back(Primitive);
+				}
+			}
+			LegacyCullMs += LegacyCullCounter.Finish();
+			const size_t LegacyVisible = Visible.size();
+			LegacyVisibleTotal += LegacyVisible;
+
+			Visible.clear();
+			FScopeCycleCounter LooseCullCounter;
+			CullLooseOctree(LooseOctree, Scene, Frustum, Visible);
+			LooseCullMs += LooseCullCounter.Finish();
+			LooseVisibleTotal += Visible.size();
+
+			// 기존 옥트리는 경계에 걸친 프리미티브를 노드 경계로만 컬링하므로 보이는 객체를 놓칠 수 있다
+			if (Visible.size() < LegacyVisible)
+			{
+				++LooseMissingFrames;
+			}
+			else if (Visible.size() > LegacyVisible)
+			{
+				++LegacyMissingFrames;
+			}
+		}
+
+		// --- Remove (무작위 순서로 최대 10%) ---
+		TArray<UPrimitiveComponent*> RemoveOrder = Handles;
+		std::shuffle(RemoveOrder.begin(), RemoveOrder.end(), std::mt19937(0xBEEF));
+		RemoveOrder.resize(std::max<size_t>(1, RemoveOrder.size() / 10));
+
+		FScopeCycleCounter LegacyRemoveCounter;
+		for (UPrimitiveComponent* Handle : RemoveOrder)
+		{
+			if (!LegacyOctree->Remove(Handle))
+			{
+				LegacyDynamic.erase(Handle);
+			}
+		}
+		const double LegacyRemoveMs = LegacyRemoveCounter.Finish();
+
+		uint32 LooseRemoveFailed = 0;
+		FScopeCycleCounter LooseRemoveCounter;
+		for (UPrimitiveComponent* Handle : RemoveOrder)
+		{
+			if (!LooseOctree.Remove(Scene.GetElementId(Handle)))
+			{
+				++LooseRemoveFailed;
+			}
+		}
+		const double LooseRemoveMs = LooseRemoveCounter.Finish();
+
+		SafeDelete(LegacyOctree);
+
+		const double Frames = static_cast<double>(std::max(1, InFrames));
+		UE_LOG_INFO("Octree: %d prims | Legacy: %zu in dynamic list | Loose: %u nodes, root half %.0f, %u rejected",
+			InCount, LegacyDynamicCount,
+			LooseOctree.GetNodeCount(), LooseOctree.GetNode(LooseOctree.GetRootIndex()).HalfSize, LooseRejected);
+		UE_LOG_INFO("Octree: Insert  Legacy %.3fms | Loose %.3fms (x%.2f)",
+			LegacyInsertMs, LooseInsertMs, LooseInsertMs > 0.0 ? LegacyInsertMs / LooseInsertMs : 0.0);
+		UE_LOG_INFO("Octree: Cull    Legacy %.3fms/frame | Loose %.3fms/frame (x%.2f) | visible avg %.0f / %.0f",
+			LegacyCullMs / Frames, LooseCullMs / Frames, LooseCullMs > 0.0 ? LegacyCullMs / LooseCullMs : 0.0,
+			LegacyVisibleTotal / Frames, LooseVisibleTotal / Frames);
+		UE_LOG_INFO("Octree: Remove  Legacy %.3fms | Loose %.3fms (x%.2f) | %zu removed, %u not found",
+			LegacyRemoveMs, LooseRemoveMs, LooseRemoveMs > 0.0 ? LegacyRemoveMs / LooseRemoveMs : 0.0,
+			RemoveOrder.size(), LooseRemoveFailed);
+
+		if (LegacyMissingFrames > 0)
+		{
+			UE_LOG_INFO("Octree: %d/%d 프레임에서 Legacy가 노드 경계에 걸친 프리미티브를 누락했습니다", LegacyMissingFrames, InFrames);
+		}
+		if (LooseMissingFrames > 0)
+		{
+			UE_LOG_ERROR("Octree: %d/%d 프레임에서 Loose의 가시 개수가 Legacy보다 적습니다", LooseMissingFrames, InFrames);
+		}
+	}
+
+	/**
+	 * @brief 합성 씬(수 km 범위)에서 기존 FOctree와 느슨한 옥트리의 삽입/제거/컬링 처리량을 비교
+	 * @note 인자: [프리미티브 개수] [플라이스루 프레임 수] (개수 생략 시 10k, 100k, 1M 순서로 실행)
+	 */
+	void RunOctreeBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 Count = FBenchmarkRegistry::GetIntArg(InArgs, 0, 0);
+		const int32 Frames = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 64));
+
+		if (Count > 0)
+		{
+			RunOctreeBenchmarkForCount(Count, Frames);
+			return;
+		}
+
+		for (int32 SceneCount : { 10000, 100000, 1000000 })
+		{
+			RunOctreeBenchmarkForCount(SceneCount, Frames);
+		}
+	}
+
+	/**
+	 * @brief 매 프레임 일부 프리미티브를 움직였을 때 기존 옥트리(재귀 탐색 제거 + 재삽입)와
+	 * 역참조 기반 재배치(개별 / 일괄)의 처리 시간을 비교
+	 * @note 인자: [프리미티브 개수=100000] [프레임당 이동 개수=1000] [프레임 수=10]
+	 */
+	void RunOctreeRelocateBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 Count = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 100000));
+		const int32 MovesPerFrame = std::clamp(FBenchmarkRegistry::GetIntArg(InArgs, 1, 1000), 1, Count);
+		const int32 Frames = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 2, 10));
+		constexpr float WorldHalfSize = 2000.0f;
+
+		FSyntheticScene Scene;
+		BuildScene(Count, WorldHalfSize, Scene);
+
+		// 프레임마다 움직일 프리미티브와 새 경계를 미리 만든다 (90% 미세 이동, 10% 먼 거리 이동)
+		std::mt19937 Random(0x5EED);
+		std::uniform_int_distribution<int32> PickIndex(0, Count - 1);
+		std::uniform_real_distribution<float> Jitter(-0.5f, 0.5f);
+		std::uniform_real_distribution<float> Teleport(-WorldHalfSize, WorldHalfSize);
+		std::uniform_int_distribution<int32> TeleportChance(0, 9);
+
+		struct FMove
+		{
+			int32 Index;
+			FAABB Bounds;
+		};
+		TArray<TArray<FMove>> MovesByFrame(Frames);
+		{
+			TArray<FAABB> Simulated = Scene.Bounds;
+			for (TArray<FMove>& Moves : MovesByFrame)
+			{
+				for (int32 MoveIndex = 0; MoveIndex < MovesPerFrame; ++MoveIndex)
+				{
+					const int32 Index = PickIndex(Random);
+					const FVector Offset = TeleportChance(Random) == 0
+						? FVector(Teleport(Random), Teleport(Random), 0.0f) - Simulated[Index].GetCenter() * FVector(1.0f, 1.0f, 0.0f)
+						: FVector(Jitter(Random), Jitter(Random), Jitter(Random));
+					Simulated[Index] = FAABB(Simulated[Index].Min + Offset, Simulated[Index].Max + Offset);
+					Moves.push_back({ Index, Simulated[Index] });
+				}
+			}
+		}
+
+		// --- Legacy: 월드 전체를 덮는 루트로 만들어 모든 프리미티브가 트리 안에 있도록 함 ---
+		const FVector LegacyHalf(WorldHalfSize + 100.0f, WorldHalfSize + 100.0f, WorldHalfSize + 100.0f);
+		FLegacyOctree* LegacyOctree = new FLegacyOctree(Scene, FAABB(LegacyHalf * -1.0f, LegacyHalf), 0);
+		FOctree SingleOctree(FVector(0, 0, -5), 75.0f);
+		FOctree BatchOctree(FVector(0, 0, -5), 75.0f);
+		TArray<FOctreeElementId> BatchElementIds(Count);
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			UPrimitiveComponent* Handle = FSyntheticScene::ToHandle(Index);
+			LegacyOctree->Insert(Handle);
+			SingleOctree.Insert(Handle, Scene.Bounds[Index], Scene.ElementIds[Index]);
+			BatchOctree.Insert(Handle, Scene.Bounds[Index], BatchElementIds[Index]);
+		}
+
+		double LegacyMs = 0.0;
+		double SingleMs = 0.0;
+		double BatchMs = 0.0;
+		TArray<FOctreeRelocation> Relocations;
+		TArray<UPrimitiveComponent*> Rejected;
+
+		for (const TArray<FMove>& Moves : MovesByFrame)
+		{
+			// 기존 ULevel::UpdatePrimitiveInOctree + UpdateOctree 경로 (제거 후 재삽입)
+			FScopeCycleCounter LegacyCounter;
+			for (const FMove& Move : Moves)
+			{
+				UPrimitiveComponent* Handle = FSyntheticScene::ToHandle(Move.Index);
+				LegacyOctree->Remove(Handle);
+				Scene.Bounds[Move.Index] = Move.Bounds;
+				LegacyOctree->Insert(Handle);
+			}
+			LegacyMs += LegacyCounter.Finish();
+
+			FScopeCycleCounter SingleCounter;
+			for (const FMove& Move : Moves)
+			{
+				SingleOctree.Relocate(FSyntheticScene::ToHandle(Move.Index), Move.Bounds, Scene.ElementIds[Move.Index]);
+			}
+			SingleMs += SingleCounter.Finish();
+
+			FScopeCycleCounter BatchCounter;
+			Relocations.clear();
+			for (const FMove& Move : Moves)
+			{
+				Relocations.push_back({ FSyntheticScene::ToHandle(Move.Index), Move.Bounds.Min, Move.Bounds.Max, &BatchElementIds[Move.Index] });
+			}
+			BatchOctree.Relocate(Relocations, Rejected);
+			BatchMs += BatchCounter.Finish();
+		}
+
+		// 모든 역참조가 최종 경계를 가진 요소를 정확히 가리키는지 검증
+		int32 InvalidElementIds = 0;
+		auto ValidateElementId = [&](const FOctree& InOctree, const FOctreeElementId& InElementId, int32 InIndex)
+		{
+			if (!InElementId.IsValid() || InElementId.NodeIndex >= static_cast<int32>(InOctree.GetNodePool().size()))
+			{
+				++InvalidElementIds;
+				return;
+			}
+
+			const FOctreeNode& Node = InOctree.GetNode(InElementId.NodeIndex);
+			if (InElementId.ElementIndex >= static_cast<int32>(Node.Elements.size()))
+			{
+				++InvalidElementIds;
+				return;
+			}
+
+			const FOctreeElement& Element = Node.Elements[InElementId.ElementIndex];
+			if (Element.Primitive != FSyntheticScene::ToHandle(InIndex) ||
+				Element.Min != Scene.Bounds[InIndex].Min || Element.Max != Scene.Bounds[InIndex].Max)
+			{
+				++InvalidElementIds;
+			}
+		};
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			ValidateElementId(SingleOctree, Scene.ElementIds[Index], Index);
+			ValidateElementId(BatchOctree, BatchElementIds[Index], Index);
+		}
+
+		SafeDelete(LegacyOctree);
+
+		const double TotalMoves = static_cast<double>(MovesPerFrame) * Frames;
+		UE_LOG_INFO("OctreeRelocate: %d prims, %d moves/frame x %d frames", Count, MovesPerFrame, Frames);
+		UE_LOG_INFO("OctreeRelocate: Legacy remove+insert %.3fms/frame (%.3fus/move)", LegacyMs / Frames, LegacyMs * 1000.0 / TotalMoves);
+		UE_LOG_INFO("OctreeRelocate: Relocate (single)    %.3fms/frame (%.3fus/move, x%.1f)", SingleMs / Frames,
+			SingleMs * 1000.0 / TotalMoves, SingleMs > 0.0 ? LegacyMs / SingleMs : 0.0);
+		UE_LOG_INFO("OctreeRelocate: Relocate (batched)   %.3fms/frame (%.3fus/move, x%.1f) | %u nodes",
+			BatchMs / Frames, BatchMs * 1000.0 / TotalMoves, BatchMs > 0.0 ? LegacyMs / BatchMs : 0.0, BatchOctree.GetNodeCount());
+
+		if (InvalidElementIds > 0 || !Rejected.empty())
+		{
+			UE_LOG_ERROR("OctreeRelocate: 잘못된 역참조 %d개, 거부된 프리미티브 %zu개", InvalidElementIds, Rejected.size());
+		}
+	}
+
+	/**
+	 * @brief 프리미티브별 스칼라 FFrustum::CheckIntersection과 SoA SIMD 커널(FPrimitiveBoundsSoA)을
+	 * 전수 검사 / 옥트리 탐색 두 가지 경로에서 비교
+	 * @note 인자: [프리미티브 개수=100000] [플라이스루 프레임 수=120]
+	 */
+	void RunFrustumCullBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 Count = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 100000));
+		const int32 Frames = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 120));
+		constexpr float WorldHalfSize = 2000.0f;
+
+		FSyntheticScene Scene;
+		BuildScene(Count, WorldHalfSize, Scene);
+		const TArray<FFrustum> Frustums = MakeFlythrough(Frames, WorldHalfSize);
+
+		FOctree Octree(FVector(0, 0, -5), 75.0f);
+		FPrimitiveBoundsSoA Bounds;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			UPrimitiveComponent* Handle = FSyntheticScene::ToHandle(Index);
+			Octree.Insert(Handle, Scene.Bounds[Index], Scene.ElementIds[Index]);
+			Bounds.Add(Handle, Scene.Bounds[Index].Min, Scene.Bounds[Index].Max, Scene.BoundsIndices[Index]);
+		}
+
+		TArray<UPrimitiveComponent*> Visible;
+		Visible.reserve(Count);
+		TArray<int32> Candidates;
+		TArray<uint64> Mask;
+
+		double ScalarFlatMs = 0.0;
+		double SimdFlatMs = 0.0;
+		double ScalarOctreeMs = 0.0;
+		double SimdOctreeMs = 0.0;
+		size_t FlatVisibleTotal = 0;
+		size_t OctreeVisibleTotal = 0;
+		size_t CandidateTotal = 0;
+		int32 FlatMismatchFrames = 0;
+		int32 OctreeMismatchFrames = 0;
+
+		for (const FFrustum& Frustum : Frustums)
+		{
+			// 1. 전수 검사: 기존 Dynamic 프리미티브 경로와 같은 프리미티브별 스칼라 검사
+			Visible.clear();
+			FScopeCycleCounter ScalarFlatCounter;
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				if (Frustum.CheckIntersection(Scene.Bounds[Index]) != EBoundCheckResult::Outside)
+				{
+					Visible.push_back(FSyntheticScene::ToHandle(Index));
+				}
+			}
+			ScalarFlatMs += ScalarFlatCounter.Finish();
+			const size_t ScalarFlatVisible = Visible.size();
+
+			Visible.clear();
+			FScopeCycleCounter SimdFlatCounter;
+			Bounds.CullRange(Frustum, 0, Bounds.Num(), Mask);
+			AppendVisible(Bounds, Mask, nullptr, Visible);
+			SimdFlatMs += SimdFlatCounter.Finish();
+			FlatVisibleTotal += Visible.size();
+			if (Visible.size() != ScalarFlatVisible)
+			{
+				++FlatMismatchFrames;
+			}
+
+			// 2. 옥트리 탐색: Intersect 노드의 요소만 개별 검사
+			Visible.clear();
+			FScopeCycleCounter ScalarOctreeCounter;
+			CullLooseOctree(Octree, Scene, Frustum, Visible);
+			ScalarOctreeMs += ScalarOctreeCounter.Finish();
+			const size_t ScalarOctreeVisible = Visible.size();
+
+			Visible.clear();
+			FScopeCycleCounter SimdOctreeCounter;
+			CullLooseOctreeSoA(Octree, Scene, Bounds, Frustum, Candidates, Mask, Visible);
+			SimdOctreeMs += SimdOctreeCounter.Finish();
+			OctreeVisibleTotal += Visible.size();
+			CandidateTotal += Candidates.size();
+			if (Visible.size() != ScalarOctreeVisible)
+			{
+				++OctreeMismatchFrames;
+			}
+		}
+
+		const double FrameCount = static_cast<double>(Frames);
+		UE_LOG_INFO("FrustumCull: %d boxes, %d frames | visible avg %.0f, octree candidates avg %.0f",
+			Count, Frames, FlatVisibleTotal / FrameCount, CandidateTotal / FrameCount);
+		UE_LOG_INFO("FrustumCull: Flat   Scalar %.3fms/frame | SoA SIMD %.3fms/frame (x%.2f)",
+			ScalarFlatMs / FrameCount, SimdFlatMs / FrameCount, SimdFlatMs > 0.0 ? ScalarFlatMs / SimdFlatMs : 0.0);
+		UE_LOG_INFO("FrustumCull: Octree Scalar %.3fms/frame | SoA SIMD %.3fms/frame (x%.2f) | visible avg %.0f",
+			ScalarOctreeMs / FrameCount, SimdOctreeMs / FrameCount, SimdOctreeMs > 0.0 ? ScalarOctreeMs / SimdOctreeMs : 0.0,
+			OctreeVisibleTotal / FrameCount);
+
+		if (FlatMismatchFrames > 0 || OctreeMismatchFrames > 0)
+		{
+			UE_LOG_ERROR("FrustumCull: 스칼라 경로와 가시 개수가 다른 프레임 (전수 %d, 옥트리 %d)", FlatMismatchFrames, OctreeMismatchFrames);
+		}
+	}
+
+	/**
+	 * @brief 여러 카메라의 컬링(옥트리 탐색 + SoA 커널)을 FJobSystem으로 병렬 실행했을 때 스레드 수에 따른 확장성 측정
+	 * URenderer::CullViewports처럼 카메라 하나를 작업 하나로 제출하고, 옥트리와 SoA 경계는 읽기 전용으로 공유한다.
+	 * @note 인자: [카메라 개수=16] [프리미티브 개수=100000] [최대 스레드 수=16] [프레임 수=32]
+	 */
+	void RunParallelCullBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 CameraCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 16));
+		const int32 Count = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 100000));
+		const int32 MaxThreads = std::clamp(FBenchmarkRegistry::GetIntArg(InArgs, 2, 16), 1, 64);
+		const int32 Frames = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 3, 32));
+		constexpr float WorldHalfSize = 2000.0f;
+
+		FSyntheticScene Scene;
+		BuildScene(Count, WorldHalfSize, Scene);
+
+		FOctree Octree(FVector(0, 0, -5), 75.0f);
+		FPrimitiveBoundsSoA Bounds;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			UPrimitiveComponent* Handle = FSyntheticScene::ToHandle(Index);
+			Octree.Insert(Handle, Scene.Bounds[Index], Scene.ElementIds[Index]);
+			Bounds.Add(Handle, Scene.Bounds[Index].Min, Scene.Bounds[Index].Max, Scene.BoundsIndices[Index]);
+		}
+
+		// 카메라마다 플라이스루 경로의 서로 다른 지점에서 시작
+		const TArray<FFrustum> Path = MakeFlythrough(CameraCount * Frames, WorldHalfSize);
+
+		struct FCameraScratch
+		{
+			TArray<int32> Candidates;
+			TArray<uint64> Mask;
+			TArray<UPrimitiveComponent*> Visible;
+		};
+		TArray<FCameraScratch> Cameras(CameraCount);
+
+		auto CullFrame = [&](FJobSystem& InJobs, int32 InFrame)
+		{
+			InJobs.ParallelFor(CameraCount, [&](int32 InCamera)
+			{
+				FCameraScratch& Camera = Cameras[InCamera];
+				Camera.Visible.clear();
+				CullLooseOctreeSoA(Octree, Scene, Bounds, Path[InCamera * Frames + InFrame], Camera.Candidates, Camera.Mask, Camera.Visible);
+			});
+
+			size_t VisibleCount = 0;
+			for (const FCameraScratch& Camera : Cameras)
+			{
+				VisibleCount += Camera.Visible.size();
+			}
+			return VisibleCount;
+		};
+
+		UE_LOG_INFO("ParallelCull: %d cameras, %d prims, %d frames, hardware threads %u",
+			CameraCount, Count, Frames, std::thread::hardware_concurrency());
+
+		double SingleThreadMs = 0.0;
+		size_t ReferenceVisible = 0;
+		int32 MismatchCount = 0;
+
+		for (int32 ThreadCount = 1; ThreadCount <= MaxThreads; ThreadCount *= 2)
+		{
+			// 호출 스레드도 Wait 중에 작업을 실행하므로 워커는 ThreadCount - 1개
+			FJobSystem Jobs(static_cast<uint32>(ThreadCount - 1));
+			CullFrame(Jobs, 0);
+
+			size_t VisibleTotal = 0;
+			FScopeCycleCounter Counter;
+			for (int32 Frame = 0; Frame < Frames; ++Frame)
+			{
+				VisibleTotal += CullFrame(Jobs, Frame);
+			}
+			const double TotalMs = Counter.Finish();
+
+			if (ThreadCount == 1)
+			{
+				SingleThreadMs = TotalMs;
+				ReferenceVisible = VisibleTotal;
+			}
+			else if (VisibleTotal != ReferenceVisible)
+			{
+				++MismatchCount;
+			}
+
+			UE_LOG_INFO("ParallelCull: %2d threads %.3fms/frame (x%.2f) | visible avg %.0f/camera",
+				ThreadCount, TotalMs / Frames, TotalMs > 0.0 ? SingleThreadMs / TotalMs : 0.0,
+				static_cast<double>(VisibleTotal) / (static_cast<double>(Frames) * CameraCount));
+		}
+
+		if (MismatchCount > 0)
+		{
+			UE_LOG_ERROR("ParallelCull: %d개 스레드 구성에서 단일 스레드와 가시 개수가 다릅니다", MismatchCount);
+		}
+	}
+}
+
+IMPLEMENT_BENCHMARK("octree", "Compare legacy and loose octree insert / remove / cull on a synthetic km-scale scene", RunOctreeBenchmark)
+IMPLEMENT_BENCHMARK("octreemove", "Compare legacy remove+reinsert with back-pointer octree relocation (single / batched)", RunOctreeRelocateBenchmark)
+IMPLEMENT_BENCHMARK("frustum", "Compare scalar per-primitive frustum tests with the SoA SIMD culling kernel (flat / octree)", RunFrustumCullBenchmark)
+IMPLEMENT_BENCHMARK("cullmt", "Measure multi-camera culling scaling on FJobSystem from 1 to 16 threads", RunParallelCullBenchmark)
@@ -0,0 +1,229 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Optimization/Public/RenderProxyList.h"
+
+#include <random>
+
+namespace
+{
+	/** @brief 기수 정렬 결과가 std::stable_sort와 키와 값 모두 같은지 (같은 키 안의 순서까지) */
+	bool MatchesStableSort(const TArray<uint64>& InKeys)
+	{
+		TArray<TPair<uint64, uint32>> Expected(InKeys.size());
+		TArray<uint64> Keys = InKeys;
+		TArray<uint32> Values(InKeys.size());
+		for (uint32 Index = 0; Index < InKeys.size(); ++Index)
+		{
+			Expected[Index] = { InKeys[Index], Index };
+			Values[Index] = Index;
+		}
+		std::stable_sort(Expected.begin(), Expected.end(), [](const TPair<uint64, uint32>& A, const TPair<uint64, uint32>& B)
+		{
+			return A.first < B.first;
+		});
+
+		TArray<uint64> ScratchKeys;
+		TArray<uint32> ScratchValues;
+		RadixSortKeyValues(Keys, Values, ScratchKeys, ScratchValues);
+
+		for (size_t Index = 0; Index < Expected.size(); ++Index)
+		{
+			if (Keys[Index] != Expected[Index].first || Values[Index] != Expected[Index].second)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief 프록시 InProxyCount개에 대해 가시성 비트셋 -> 정렬된 명령 목록 생성 시간을 std::sort 방식과 비교하고 결과를 검증
+	 * 마지막으로 일부 프록시를 제거해 남은 소유자의 보관된 키와 위치가 그대로인지도 확인한다
+	 * @return 검증 실패 수
+	 */
+	int32 RunProxyCount(int32 InProxyCount, int32 InFrameCount, std::mt19937& InRandom)
+	{
+		std::uniform_int_distribution<int32> PassDistribution(0, 99);
+		std::uniform_int_distribution<uint32> MaterialDistribution(0, 63);
+		std::uniform_int_distribution<uint32> MeshDistribution(0, 255);
+		std::uniform_real_distribution<float> PositionDistribution(-2000.0f, 2000.0f);
+
+		// 컴포넌트 없이 저수준 API로 프록시 슬롯과 키만 만든다
+		TArray<int32> IndexRefs(InProxyCount, -1);
+		FRenderProxyList Proxies;
+		for (int32 Index = 0; Index < InProxyCount; ++Index)
+		{
+			Proxies.Add(nullptr, IndexRefs[Index]);
+
+			// 대부분 스태틱 메시, 일부는 빌보드/텍스트/데칼, 1%는 어느 패스도 그리지 않는 프리미티브
+			const int32 Roll = PassDistribution(InRandom);
+			const ERenderProxyPass Pass = Roll < 85 ? ERenderProxyPass::StaticMesh : Roll < 92 ? ERenderProxyPass::BillBoard :
+				Roll < 96 ? ERenderProxyPass::Text : Roll < 99 ? ERenderProxyPass::Decal : ERenderProxyPass::None;
+			const uint32 Material = MaterialDistribution(InRandom);
+			Proxies.SetSortKey(Index, FRenderSortKey::Make(Pass, Material & 1, Material, Pass == ERenderProxyPass::StaticMesh ? MeshDistribution(InRandom) : 0));
+			Proxies.SetLocation(Index, FVector(PositionDistribution(InRandom), PositionDistribution(InRandom), PositionDistribution(InRandom)));
+		}
+
+		// 프레임마다 절반 정도가 보이는 비트셋
+		TArray<TArray<uint64>> Visibilities(InFrameCount);
+		TArray<FVector> ViewLocations(InFrameCount);
+		for (int32 Frame = 0; Frame < InFrameCount; ++Frame)
+		{
+			Visibilities[Frame].assign((static_cast<size_t>(InProxyCount) + 63) / 64, 0);
+			for (int32 Index = 0; Index < InProxyCount; ++Index)
+			{
+				if (InRandom() & 1)
+				{
+					Visibilities[Frame][Index >> 6] |= 1ull << (Index & 63);
+				}
+			}
+			ViewLocations[Frame] = FVector(PositionDistribution(InRandom), PositionDistribution(InRandom), PositionDistribution(InRandom));
+		}
+
+		// 비교 대상: 같은 키를 모아 std::sort
+		TArray<TPair<uint64, uint32>> SortPairs;
+		uint64 ComparisonChecksum = 0;
+		FScopeCycleCounter ComparisonCounter;
+		for (int32 Frame = 0; Frame < InFrameCount; ++Frame)
+		{
+			SortPairs.clear();
+			for (int32 Index = 0; Index < InProxyCount; ++Index)
+			{
+				const uint64 SortKey = Proxies.GetSortKey(Index);
+				if ((Visibilities[Frame][Index >> 6] >> (Index & 63) & 1) && FRenderSortKey::GetPass(SortKey) != ERenderProxyPass::None)
+				{
+					SortPairs.push_back({ SortKey, static_cast<uint32>(Index) });
+				}
+			}
+			std::sort(SortPairs.begin(), SortPairs.end());
+			ComparisonChecksum += SortPairs.empty() ? 0 : SortPairs.front().first >> 56;
+		}
+		const double ComparisonMilliseconds = ComparisonCounter.Finish();
+
+		FRenderCommandList CommandList;
+		uint64 CommandChecksum = 0;
+		FScopeCycleCounter RadixCounter;
+		for (int32 Frame = 0; Frame < InFrameCount; ++Frame)
+		{
+			Proxies.BuildCommandList(Visibilities[Frame], ViewLocations[Frame], CommandList);
+			CommandChecksum += CommandList.Commands.empty() ? 0 : CommandList.Commands.front().SortKey >> 56;
+		}
+		const double RadixMilliseconds = RadixCounter.Finish();
+
+		// 마지막 프레임 결과 검증: 정렬 순서, 보이는 프록시 집합, 깊이 버킷, 패스 구간
+		const TArray<uint64>& Visibility = Visibilities[InFrameCount - 1];
+		const FVector& ViewLocation = ViewLocations[InFrameCount - 1];
+		int32 Errors = 0;
+		TArray<uint8> Seen(InProxyCount, 0);
+		for (size_t Command = 0; Command < CommandList.Commands.size(); ++Command)
+		{
+			const uint64 SortKey = CommandList.Keys[Command];
+			const uint32 Index = CommandList.ProxyIndices[Command];
+			Errors += Command > 0 && CommandList.Keys[Command - 1] > SortKey ? 1 : 0;
+			Errors += CommandList.Commands[Command].SortKey != SortKey ? 1 : 0;
+			Errors += Seen[Index]++ != 0 ? 1 : 0;
+			Errors += (Visibility[Index >> 6] >> (Index & 63) & 1) == 0 ? 1 : 0;
+
+			const uint32 DepthBucket = FRenderSortKey::QuantizeDepth((Proxies.GetLocation(Index) - ViewLocation).LengthSquared());
+			Errors += FRenderSortKey::GetDepthBucket(SortKey) != DepthBucket ? 1 : 0;
+			Errors += FRenderSortKey::WithDepthBucket(SortKey, 0) != Proxies.GetSortKey(Index) ? 1 : 0;
+
+			const int32 Pass = static_cast<int32>(FRenderSortKey::GetPass(SortKey));
+			Errors += static_cast<int32>(Command) < CommandList.PassOffsets[Pass] || static_cast<int32>(Command) >= CommandList.PassOffsets[Pass + 1] ? 1 : 0;
+		}
+		int32 ExpectedCount = 0;
+		for (int32 Index = 0; Index < InProxyCount; ++Index)
+		{
+			if ((Visibility[Index >> 6] >> (Index & 63) & 1) && FRenderSortKey::GetPass(Proxies.GetSortKey(Index)) != ERenderProxyPass::None)
+			{
+				++ExpectedCount;
+			}
+		}
+		Errors += static_cast<int32>(CommandList.Commands.size()) != ExpectedCount ? 1 : 0;
+		Errors += CommandList.PassOffsets[static_cast<int32>(ERenderProxyPass::Count)] != ExpectedCount ? 1 : 0;
+
+		// 보관한 키와 위치가 제거 후에도 자기 소유자를 따라가는지: 일부를 지운 뒤 남은 소유자의 인덱스로 다시 읽는다
+		TArray<uint64> OwnerKeys(InProxyCount);
+		TArray<FVector> OwnerLocations(InProxyCount);
+		for (int32 Owner = 0; Owner < InProxyCount; ++Owner)
+		{
+			OwnerKeys[Owner] = Proxies.GetSortKey(IndexRefs[Owner]);
+			OwnerLocations[Owner] = Proxies.GetLocation(IndexRefs[Owner]);
+		}
+		int32 RemainingCount = InProxyCount;
+		for (int32 Owner = 0; Owner < InProxyCount; ++Owner)
+		{
+			if (PassDistribution(InRandom) < 10)
+			{
+				Errors += Proxies.Remove(IndexRefs[Owner]) ? 0 : 1;
+				--RemainingCount;
+			}
+		}
+		Errors += Proxies.Num() != RemainingCount ? 1 : 0;
+		for (int32 Owner = 0; Owner < InProxyCount; ++Owner)
+		{
+			const int32 Index = IndexRefs[Owner];
+			if (Index < 0)
+			{
+				continue;
+			}
+			Errors += Index >= Proxies.Num() || Proxies.GetSortKey(Index) != OwnerKeys[Owner] ||
+				memcmp(&Proxies.GetLocation(Index), &OwnerLocations[Owner], sizeof(FVector)) != 0 ? 1 : 0;
+		}
+
+		const double VisibleCount = static_cast<double>(ExpectedCount);
+		UE_LOG_INFO("RenderProxy: %7d proxies, %7d visible | gather + std::sort %.3fms | bitset + radix %.3fms (%.0f proxies/ms, x%.1f) | checksum %llu / %llu",
+			InProxyCount, ExpectedCount,
+			ComparisonMilliseconds / InFrameCount, RadixMilliseconds / InFrameCount,
+			RadixMilliseconds > 0.0 ? VisibleCount * InFrameCount / RadixMilliseconds : 0.0,
+			RadixMilliseconds > 0.0 ? ComparisonMilliseconds / RadixMilliseconds : 0.0,
+			ComparisonChecksum, CommandChecksum);
+		return Errors;
+	}
+
+	/**
+	 * @brief 렌더 프록시 명령 목록 생성(가시성 비트셋 수집 + 깊이 버킷 + 기수 정렬)을 프록시 10k~500k에서 측정하고 검증
+	 * 기수 정렬 자체는 임의의 64비트 키에 대해 std::stable_sort와 키/값 순서가 같은지 먼저 확인한다.
+	 * @note 인자: [프록시 수] (생략하면 10000, 50000, 100000, 500000), [프레임 수] (기본 20)
+	 */
+	void RunRenderProxyBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 ProxyArg = FBenchmarkRegistry::GetIntArg(InArgs, 0, 0);
+		const int32 FrameCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 20));
+
+		std::mt19937 Random(0x20020);
+
+		// 중복 키가 많은 경우와 전 비트가 임의인 경우
+		int32 SortErrors = 0;
+		for (const uint64 KeyMask : { 0xFFull, 0xF0F0000000FF0000ull, ~0ull })
+		{
+			TArray<uint64> Keys(50000);
+			for (uint64& Key : Keys)
+			{
+				Key = ((static_cast<uint64>(Random()) << 32) | Random()) & KeyMask;
+			}
+			SortErrors += MatchesStableSort(Keys) ? 0 : 1;
+		}
+
+		TArray<int32> ProxyCounts = { 10000, 50000, 100000, 500000 };
+		if (ProxyArg > 0)
+		{
+			ProxyCounts = { ProxyArg };
+		}
+
+		int32 CommandErrors = 0;
+		for (const int32 ProxyCount : ProxyCounts)
+		{
+			CommandErrors += RunProxyCount(ProxyCount, FrameCount, Random);
+		}
+
+		if (SortErrors > 0 || CommandErrors > 0)
+		{
+			UE_LOG_ERROR("RenderProxy: %d radix sort mismatches, %d command list errors", SortErrors, CommandErrors);
+			return;
+		}
+		UE_LOG_SUCCESS("RenderProxy: radix sort matches std::stable_sort, command lists are sorted and complete, retained keys follow their owners after removal");
+	}
+}
+
+IMPLEMENT_BENCHMARK("renderproxy", "Build sorted render command lists from a visibility bitset for 10k-500k proxies with a radix sort and compare with std::sort", RunRenderProxyBenchmark)
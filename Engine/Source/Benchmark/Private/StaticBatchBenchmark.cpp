@@ -0,0 +1,217 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Optimization/Public/StaticMeshMerger.h"
+#include "Texture/Public/Material.h"
+
+namespace
+{
+	/** @brief 소스를 따로 그릴 때의 드로우 수, FStaticMeshPass는 섹션마다 한 번 그린다 */
+	uint32 GetSourceDrawCount(const FStaticMeshMergeSource& InSource)
+	{
+		return static_cast<uint32>(std::max<size_t>(InSource.Mesh->Sections.size(), 1));
+	}
+
+	/** @brief 셀의 섹션이 인덱스 버퍼를 빈틈없이 나누고, 슬롯이 머티리얼과 맞고, 인덱스가 정점 범위 안인지 */
+	bool IsMergedCellValid(const FStaticMeshMergedCell& InCell)
+	{
+		const FStaticMesh& Mesh = InCell.Mesh;
+		if (Mesh.Indices.size() % 3 != 0 || Mesh.MaterialInfo.size() != InCell.Materials.size())
+		{
+			return false;
+		}
+
+		uint64 SectionIndexTotal = 0;
+		for (const FMeshSection& Section : Mesh.Sections)
+		{
+			if (Section.StartIndex != SectionIndexTotal || Section.IndexCount % 3 != 0 ||
+				(!InCell.Materials.empty() && Section.MaterialSlot >= InCell.Materials.size()))
+			{
+				return false;
+			}
+			SectionIndexTotal += Section.IndexCount;
+		}
+		if (!Mesh.Sections.empty() && SectionIndexTotal != Mesh.Indices.size())
+		{
+			return false;
+		}
+
+		for (uint32 Index : Mesh.Indices)
+		{
+			if (Index >= Mesh.Vertices.size())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** @brief 셀의 정점이 소스 순서대로 각 소스 정점을 월드로 옮긴 위치이고, 합친 드로우 수가 소스별 드로우 수의 합인지 */
+	bool IsMergedGeometryPreserved(const FStaticMeshMergedCell& InCell, const TArray<FStaticMeshMergeSource>& InSources)
+	{
+		size_t VertexOffset = 0;
+		uint32 SourceDrawCount = 0;
+		for (const int32 SourceIndex : InCell.SourceIndices)
+		{
+			const FStaticMeshMergeSource& Source = InSources[SourceIndex];
+			SourceDrawCount += GetSourceDrawCount(Source);
+			if (VertexOffset + Source.Mesh->Vertices.size() > InCell.Mesh.Vertices.size())
+			{
+				return false;
+			}
+
+			for (const FNormalVertex& LocalVertex : Source.Mesh->Vertices)
+			{
+				const FVector4 Expected = FVector4(LocalVertex.Position, 1.0f) * Source.World;
+				const FVector Delta = InCell.Mesh.Vertices[VertexOffset++].Position - FVector(Expected.X, Expected.Y, Expected.Z);
+				if (Delta.Length() > 1e-3f * (1.0f + FVector(Expected.X, Expected.Y, Expected.Z).Length()))
+				{
+					return false;
+				}
+			}
+		}
+		return VertexOffset == InCell.Mesh.Vertices.size() && SourceDrawCount == InCell.SourceDrawCount;
+	}
+
+	/**
+	 * @brief Data/ 아래 작은 메시를 격자에 흩어 놓고 FStaticMeshMerger::BuildCells로 셀을 만들어 드로우 수와 합친 버퍼 크기를 보고
+	 * 소품마다 회전, 크기, 머티리얼 조합이 다르며 일부는 음수 스케일로 뒤집혀 있다.
+	 * 셀 구성(섹션 구간, 슬롯, 인덱스 범위)과 합친 소스의 삼각형 수, 월드 정점 위치 보존, 소스가 셀 하나에만 들어갔는지를 함께 검증한다.
+	 * @note 인자: [격자 한 변의 소품 수=64] [셀 크기=32]. CPU만 측정하며 GPU 버퍼는 만들지 않는다
+	 */
+	void RunStaticBatchBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 GridSize = std::clamp(FBenchmarkRegistry::GetIntArg(InArgs, 0, 64), 2, 512);
+		const float CellSize = static_cast<float>(std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, static_cast<int32>(FStaticMeshMerger::DEFAULT_CELL_SIZE))));
+		constexpr float Spacing = 4.0f;
+		constexpr int32 MaterialCount = 3;
+
+		TArray<std::unique_ptr<FStaticMesh>> Meshes;
+		const FString DataDirectory = "Data/";
+		if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
+		{
+			// UAssetManager::LoadAllObjStaticMesh와 같은 설정, 캐시 없이 빌드한다
+			FObjImporter::Configuration Config;
+			Config.bFlipWindingOrder = false;
+			Config.bIsBinaryEnabled = false;
+			Config.bPositionToUEBasis = true;
+			Config.bNormalToUEBasis = true;
+			Config.bUVToUEBasis = true;
+
+			for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+			{
+				if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+				{
+					std::unique_ptr<FStaticMesh> Mesh = FObjManager::ImportStaticMesh(FName(Entry.path().generic_string()), Config);
+					if (Mesh && FStaticMeshMerger::CanMerge(*Mesh))
+					{
+						Meshes.push_back(std::move(Mesh));
+					}
+				}
+			}
+		}
+
+		if (Meshes.empty())
+		{
+			UE_LOG_WARNING("StaticBatch: %s 아래에 %u 삼각형 이하의 .obj 파일이 없습니다", DataDirectory.c_str(), FStaticMeshMerger::MAX_SOURCE_TRIANGLES);
+			return;
+		}
+
+		// 셀 묶음은 포인터 비교만 하므로 텍스처 없는 머티리얼로 충분하다
+		UMaterial* Materials[MaterialCount];
+		for (UMaterial*& Material : Materials)
+		{
+			Material = NewObject<UMaterial>();
+		}
+
+		TArray<FStaticMeshMergeSource> Sources;
+		Sources.reserve(static_cast<size_t>(GridSize) * GridSize);
+		for (int32 CellY = 0; CellY < GridSize; ++CellY)
+		{
+			for (int32 CellX = 0; CellX < GridSize; ++CellX)
+			{
+				const int32 PropIndex = CellX + CellY * GridSize;
+				const FStaticMesh* Mesh = Meshes[PropIndex % Meshes.size()].get();
+
+				const FVector Location(CellX * Spacing, CellY * Spacing, 0.0f);
+				const FVector Rotation(0.0f, 0.0f, static_cast<float>((PropIndex * 37) % 360));
+				const float UniformScale = 0.5f + static_cast<float>(PropIndex % 5) * 0.25f;
+				const FVector Scale(PropIndex % 7 == 0 ? -UniformScale : UniformScale, UniformScale, UniformScale);
+
+				FStaticMeshMergeSource Source;
+				Source.Mesh = Mesh;
+				Source.World = FMatrix::GetModelMatrix(Location, Rotation, Scale);
+				Source.WorldInverse = FMatrix::GetModelMatrixInverse(Location, Rotation, Scale);
+				const int32 Variant = (CellX * 7 + CellY) % MaterialCount;
+				if (!Mesh->MaterialInfo.empty())
+				{
+					for (const FMeshSection& Section : Mesh->Sections)
+					{
+						Source.SectionMaterials.push_back(Materials[(Variant + Section.MaterialSlot) % MaterialCount]);
+					}
+				}
+				Sources.push_back(Source);
+			}
+		}
+
+		TArray<FStaticMeshMergedCell> Cells;
+		FScopeCycleCounter Counter;
+		FStaticMeshMerger::BuildCells(Sources, CellSize, Cells);
+		const double BuildMilliseconds = Counter.Finish();
+
+		uint32 DrawsBefore = 0;
+		for (const FStaticMeshMergeSource& Source : Sources)
+		{
+			DrawsBefore += GetSourceDrawCount(Source);
+		}
+
+		uint32 DrawsAfter = DrawsBefore;
+		uint64 MergedSourceCount = 0;
+		uint64 MergedBufferSize = 0;
+		int32 ErrorCount = 0;
+		TArray<uint8> SourceCellCounts(Sources.size(), 0);
+		for (const FStaticMeshMergedCell& Cell : Cells)
+		{
+			uint64 SourceTriangles = 0;
+			bool bHasDuplicateSource = false;
+			for (int32 SourceIndex : Cell.SourceIndices)
+			{
+				SourceTriangles += Sources[SourceIndex].Mesh->Indices.size() / 3;
+				bHasDuplicateSource |= SourceCellCounts[SourceIndex]++ != 0;
+			}
+
+			if (!IsMergedCellValid(Cell) || SourceTriangles != Cell.Mesh.Indices.size() / 3 || bHasDuplicateSource ||
+				!IsMergedGeometryPreserved(Cell, Sources))
+			{
+				++ErrorCount;
+			}
+
+			DrawsAfter -= Cell.SourceDrawCount;
+			DrawsAfter += static_cast<uint32>(std::max<size_t>(Cell.Mesh.Sections.size(), 1));
+			MergedSourceCount += Cell.SourceIndices.size();
+			MergedBufferSize += Cell.Mesh.Vertices.size() * sizeof(FNormalVertex) + Cell.Mesh.Indices.size() * sizeof(uint32);
+		}
+
+		for (UMaterial*& Material : Materials)
+		{
+			SafeDelete(Material);
+		}
+
+		UE_LOG_INFO("StaticBatch: %zu meshes | %dx%d grid, %zu props, cell %.0f | %zu cells hold %llu props (%.1f per cell)",
+			Meshes.size(), GridSize, GridSize, Sources.size(), CellSize, Cells.size(), MergedSourceCount,
+			Cells.empty() ? 0.0 : static_cast<double>(MergedSourceCount) / Cells.size());
+
+		if (ErrorCount > 0)
+		{
+			UE_LOG_ERROR("StaticBatch: %d cells failed validation", ErrorCount);
+			return;
+		}
+
+		UE_LOG_SUCCESS("StaticBatch: draws %u -> %u (x%.2f) | merged buffers %.2f MB | build %.3fms",
+			DrawsBefore, DrawsAfter, DrawsAfter > 0 ? static_cast<double>(DrawsBefore) / DrawsAfter : 0.0,
+			static_cast<double>(MergedBufferSize) / (1024.0 * 1024.0), BuildMilliseconds);
+	}
+}
+
+IMPLEMENT_BENCHMARK("staticbatch", "Scatter small Data/ meshes on a grid, merge them into static batch cells and report draw counts, merged buffer size and build time", RunStaticBatchBenchmark)
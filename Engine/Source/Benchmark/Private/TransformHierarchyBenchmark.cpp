@@ -0,0 +1,218 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Component/Public/SceneComponent.h"
+#include "Optimization/Public/TransformHierarchy.h"
+
+#include <random>
+
+namespace
+{
+	/**
+	 * @brief FTransformHierarchy 이전의 USceneComponent 변환 처리
+	 * MarkAsDirty가 자식을 재귀로 따라 내려가고, 월드 행렬은 읽을 때 부모 체인을 재귀로 올라가며 계산한다.
+	 */
+	struct FLegacyTransformNode
+	{
+		FVector RelativeLocation = FVector::ZeroVector();
+		FQuaternion RelativeRotation = FQuaternion::Identity();
+		FVector RelativeScale3D = FVector::OneVector();
+
+		FLegacyTransformNode* AttachParent = nullptr;
+		TArray<FLegacyTransformNode*> AttachChildren;
+
+		mutable bool bIsTransformDirty = true;
+		mutable FMatrix WorldTransformMatrix;
+
+		void MarkAsDirty()
+		{
+			bIsTransformDirty = true;
+			for (FLegacyTransformNode* Child : AttachChildren)
+			{
+				Child->MarkAsDirty();
+			}
+		}
+
+		const FMatrix& GetWorldTransformMatrix() const
+		{
+			if (bIsTransformDirty)
+			{
+				WorldTransformMatrix = FMatrix::GetModelMatrix(RelativeLocation, RelativeRotation, RelativeScale3D);
+				if (AttachParent)
+				{
+					WorldTransformMatrix *= AttachParent->GetWorldTransformMatrix();
+				}
+				bIsTransformDirty = false;
+			}
+			return WorldTransformMatrix;
+		}
+	};
+
+	struct FTransformMove
+	{
+		int32 Index;
+		FVector Location;
+		FQuaternion Rotation;
+	};
+
+	/**
+	 * @brief 깊이 1~16의 체인으로 이뤄진 컴포넌트 계층에서, 매 프레임 일부를 움직이고 모든 월드 행렬을 읽는 비용을 비교
+	 * 움직일 때는 이동 컴포넌트처럼 SetRelativeLocation과 SetRelativeRotation을 연달아 호출하고,
+	 * 새 방식은 읽기 전에 FTransformHierarchy::Update를 한 번 돌린다. 마지막에 두 방식의 월드 행렬이 같은지 확인한다.
+	 * @note 인자: [컴포넌트 수] (기본 100000), [프레임 수] (기본 60), [프레임당 움직이는 비율 %] (기본 10)
+	 */
+	void RunTransformHierarchyBenchmark(const TArray<FString>& InArgs)
+	{
+		const int32 ComponentCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 0, 100000));
+		const int32 FrameCount = std::max(1, FBenchmarkRegistry::GetIntArg(InArgs, 1, 60));
+		const int32 MovePercent = std::clamp(FBenchmarkRegistry::GetIntArg(InArgs, 2, 10), 0, 100);
+		constexpr int32 MAX_CHAIN_DEPTH = 16;
+
+		std::mt19937 Random(0x17017);
+		std::uniform_int_distribution<int32> DepthDistribution(1, MAX_CHAIN_DEPTH);
+		std::uniform_real_distribution<float> OffsetDistribution(-2.0f, 2.0f);
+		std::uniform_real_distribution<float> AngleDistribution(-30.0f, 30.0f);
+
+		FTransformHierarchy& TransformHierarchy = FTransformHierarchy::GetInstance();
+		TransformHierarchy.Update();
+
+		TArray<FLegacyTransformNode> LegacyNodes(ComponentCount);
+		TArray<USceneComponent*> Components(ComponentCount);
+		int32 ChainCount = 0;
+		for (int32 Index = 0; Index < ComponentCount; ++ChainCount)
+		{
+			const int32 Depth = std::min(DepthDistribution(Random), ComponentCount - Index);
+			for (int32 Level = 0; Level < Depth; ++Level, ++Index)
+			{
+				const FVector Location(OffsetDistribution(Random), OffsetDistribution(Random), OffsetDistribution(Random));
+				const FQuaternion Rotation = FQuaternion::FromEuler(FVector(AngleDistribution(Random), AngleDistribution(Random), AngleDistribution(Random)));
+
+				FLegacyTransformNode& Node = LegacyNodes[Index];
+				Node.RelativeLocation = Location;
+				Node.RelativeRotation = Rotation;
+
+				USceneComponent* Component = new USceneComponent();
+				Component->SetRelativeLocation(Location);
+				Component->SetRelativeRotation(Rotation);
+				Component->SetRelativeScale3D(FVector::OneVector());
+				Components[Index] = Component;
+
+				if (Level > 0)
+				{
+					Node.AttachParent = &LegacyNodes[Index - 1];
+					LegacyNodes[Index - 1].AttachChildren.push_back(&Node);
+					Component->AttachToComponent(Components[Index - 1]);
+				}
+			}
+		}
+
+		// 두 방식에 같은 이동을 적용하도록 프레임별 이동 목록을 미리 만든다
+		const int32 MovesPerFrame = static_cast<int32>(static_cast<int64>(ComponentCount) * MovePercent / 100);
+		std::uniform_int_distribution<int32> IndexDistribution(0, ComponentCount - 1);
+		TArray<FTransformMove> Moves(static_cast<size_t>(MovesPerFrame) * FrameCount);
+		for (FTransformMove& Move : Moves)
+		{
+			Move.Index = IndexDistribution(Random);
+			Move.Location = FVector(OffsetDistribution(Random), OffsetDistribution(Random), OffsetDistribution(Random));
+			Move.Rotation = FQuaternion::FromEuler(FVector(AngleDistribution(Random), AngleDistribution(Random), AngleDistribution(Random)));
+		}
+
+		// 첫 프레임 전에 양쪽 모두 한 번 계산해 둔다
+		TransformHierarchy.Update();
+		for (const FLegacyTransformNode& Node : LegacyNodes)
+		{
+			Node.GetWorldTransformMatrix();
+		}
+
+		float LegacySum = 0.0f;
+		double LegacyMoveMilliseconds = 0.0, LegacyReadMilliseconds = 0.0;
+		for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+		{
+			FScopeCycleCounter MoveCounter;
+			for (int32 Move = 0; Move < MovesPerFrame; ++Move)
+			{
+				const FTransformMove& FrameMove = Moves[static_cast<size_t>(Frame) * MovesPerFrame + Move];
+				FLegacyTransformNode& Node = LegacyNodes[FrameMove.Index];
+				Node.RelativeLocation = FrameMove.Location;
+				Node.MarkAsDirty();
+				Node.RelativeRotation = FrameMove.Rotation;
+				Node.MarkAsDirty();
+			}
+			LegacyMoveMilliseconds += MoveCounter.Finish();
+
+			FScopeCycleCounter ReadCounter;
+			for (const FLegacyTransformNode& Node : LegacyNodes)
+			{
+				LegacySum += Node.GetWorldTransformMatrix().Data[3][0];
+			}
+			LegacyReadMilliseconds += ReadCounter.Finish();
+		}
+
+		float HierarchySum = 0.0f;
+		int64 UpdatedCount = 0;
+		double HierarchyMoveMilliseconds = 0.0, HierarchyUpdateMilliseconds = 0.0, HierarchyReadMilliseconds = 0.0;
+		for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+		{
+			FScopeCycleCounter MoveCounter;
+			for (int32 Move = 0; Move < MovesPerFrame; ++Move)
+			{
+				const FTransformMove& FrameMove = Moves[static_cast<size_t>(Frame) * MovesPerFrame + Move];
+				USceneComponent* Component = Components[FrameMove.Index];
+				Component->SetRelativeLocation(FrameMove.Location);
+				Component->SetRelativeRotation(FrameMove.Rotation);
+			}
+			HierarchyMoveMilliseconds += MoveCounter.Finish();
+
+			FScopeCycleCounter UpdateCounter;
+			TransformHierarchy.Update();
+			HierarchyUpdateMilliseconds += UpdateCounter.Finish();
+			UpdatedCount += TransformHierarchy.GetLastUpdatedCount();
+
+			FScopeCycleCounter ReadCounter;
+			for (const USceneComponent* Component : Components)
+			{
+				HierarchySum += Component->GetWorldTransformMatrix().Data[3][0];
+			}
+			HierarchyReadMilliseconds += ReadCounter.Finish();
+		}
+
+		float MaxError = 0.0f;
+		for (int32 Index = 0; Index < ComponentCount; ++Index)
+		{
+			const FMatrix& Legacy = LegacyNodes[Index].GetWorldTransformMatrix();
+			const FMatrix& Hierarchy = Components[Index]->GetWorldTransformMatrix();
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Column = 0; Column < 4; ++Column)
+				{
+					MaxError = std::max(MaxError, std::abs(Legacy.Data[Row][Column] - Hierarchy.Data[Row][Column]));
+				}
+			}
+		}
+
+		for (USceneComponent* Component : Components)
+		{
+			delete Component;
+		}
+		TransformHierarchy.Update();
+
+		const double LegacyMilliseconds = LegacyMoveMilliseconds + LegacyReadMilliseconds;
+		const double HierarchyMilliseconds = HierarchyMoveMilliseconds + HierarchyUpdateMilliseconds + HierarchyReadMilliseconds;
+		UE_LOG_INFO("TransformHierarchy: %d components in %d chains (depth 1-%d), %d frames x %d moves",
+			ComponentCount, ChainCount, MAX_CHAIN_DEPTH, FrameCount, MovesPerFrame);
+		UE_LOG_INFO("TransformHierarchy: Recursive %.2fms/frame (mark %.3f, read %.3f) | Batched %.2fms/frame (mark %.3f, update %.3f, read %.3f) x%.1f",
+			LegacyMilliseconds / FrameCount, LegacyMoveMilliseconds / FrameCount, LegacyReadMilliseconds / FrameCount,
+			HierarchyMilliseconds / FrameCount, HierarchyMoveMilliseconds / FrameCount, HierarchyUpdateMilliseconds / FrameCount, HierarchyReadMilliseconds / FrameCount,
+			HierarchyMilliseconds > 0.0 ? LegacyMilliseconds / HierarchyMilliseconds : 0.0);
+		UE_LOG_INFO("TransformHierarchy: %.0f world matrices recomputed per frame | checksum %.3f / %.3f",
+			static_cast<double>(UpdatedCount) / FrameCount, LegacySum, HierarchySum);
+
+		if (MaxError > 1.0e-3f)
+		{
+			UE_LOG_ERROR("TransformHierarchy: world matrices differ from the recursive path (max error %f)", MaxError);
+			return;
+		}
+		UE_LOG_SUCCESS("TransformHierarchy: world matrices match the recursive path (max error %g)", MaxError);
+	}
+}
+
+IMPLEMENT_BENCHMARK("transformhierarchy", "Move components in 100k-component chains of depth 1-16 and compare recursive dirty marking with the batched depth-ordered update", RunTransformHierarchyBenchmark)
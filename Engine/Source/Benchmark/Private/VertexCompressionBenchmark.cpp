@@ -0,0 +1,173 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Manager/Asset/Public/VertexQuantizer.h"
+
+#include <random>
+
+namespace
+{
+	/** @return half 왕복 오차가 반 ULP(상대 2^-11)를 넘는 값의 수 */
+	int32 CheckHalfRoundTrip(std::mt19937& InRandom)
+	{
+		std::uniform_real_distribution<float> Distribution(-64.0f, 64.0f);
+		int32 Errors = 0;
+		for (int32 Index = 0; Index < 100000; ++Index)
+		{
+			const float Value = Distribution(InRandom);
+			const float Decoded = FVertexQuantizer::HalfToFloat(FVertexQuantizer::FloatToHalf(Value));
+			const float Tolerance = std::max(std::abs(Value) * (1.0f / 2048.0f), std::ldexp(1.0f, -25));
+			Errors += std::abs(Decoded - Value) > Tolerance ? 1 : 0;
+		}
+
+		// 경계값: 0, 최대 정규 수, 넘침, 비정규 수
+		Errors += FVertexQuantizer::FloatToHalf(0.0f) != 0 ? 1 : 0;
+		Errors += FVertexQuantizer::HalfToFloat(FVertexQuantizer::FloatToHalf(65504.0f)) != 65504.0f ? 1 : 0;
+		Errors += FVertexQuantizer::FloatToHalf(70000.0f) != 0x7C00 ? 1 : 0;
+		Errors += FVertexQuantizer::HalfToFloat(FVertexQuantizer::FloatToHalf(std::ldexp(3.0f, -24))) != std::ldexp(3.0f, -24) ? 1 : 0;
+		return Errors;
+	}
+
+	/** @return 8면체 인코딩 왕복의 최대 각도 오차(도) */
+	float MeasureOctahedralError(std::mt19937& InRandom)
+	{
+		std::normal_distribution<float> Distribution;
+		float MaxDegrees = 0.0f;
+		for (int32 Index = 0; Index < 100000; ++Index)
+		{
+			FVector Direction(Distribution(InRandom), Distribution(InRandom), Distribution(InRandom));
+			if (Direction.LengthSquared() < 1e-6f) { continue; }
+			Direction = Direction / Direction.Length();
+
+			int16 Encoded[2];
+			FVertexQuantizer::EncodeOctahedral(Direction, Encoded);
+			const FVector Decoded = FVertexQuantizer::DecodeOctahedral(Encoded);
+			MaxDegrees = std::max(MaxDegrees, std::atan2(Decoded.Cross(Direction).Length(), Decoded.Dot(Direction)) * ToDeg);
+		}
+		return MaxDegrees;
+	}
+
+	/** @brief 쿠킹 캐시에서 읽은 압축 정점과 역양자화 범위가 임포트 결과와 비트 단위로 같은지 */
+	bool IsSamePackedMesh(const FStaticMesh& InBuilt, const FStaticMesh& InCached)
+	{
+		return InBuilt.PackedVertices.size() == InCached.PackedVertices.size() &&
+			memcmp(InBuilt.PackedVertices.data(), InCached.PackedVertices.data(), InBuilt.PackedVertices.size() * sizeof(FPackedNormalVertex)) == 0 &&
+			memcmp(&InBuilt.PackedPositionMin, &InCached.PackedPositionMin, sizeof(FVector)) == 0 &&
+			memcmp(&InBuilt.PackedPositionExtent, &InCached.PackedPositionExtent, sizeof(FVector)) == 0;
+	}
+
+	/**
+	 * @brief Data/ 아래 모든 .obj를 압축 정점으로 임포트해 GPU 정점 버퍼 크기와 양자화 오차를 보고
+	 * half / 8면체 인코딩 왕복을 먼저 검증하고, 메시마다 위치 오차가 AABB 대각선 대비 16비트 격자 반 칸을 넘지 않는지,
+	 * 쿠킹 캐시를 거쳐 읽은 압축 정점이 임포트 결과와 같은지 확인한다.
+	 * @note 인자 없음. 캐시 왕복 검사 때문에 압축을 켠 설정으로 캐시 파일이 생성/갱신된다
+	 */
+	void RunVertexCompressionBenchmark(const TArray<FString>& InArgs)
+	{
+		std::mt19937 Random(0x20021);
+		const int32 HalfErrors = CheckHalfRoundTrip(Random);
+		const float OctahedralDegrees = MeasureOctahedralError(Random);
+		UE_LOG_INFO("VertexCompression: half round trip %d errors | octahedral max error %.5f deg", HalfErrors, OctahedralDegrees);
+
+		TArray<FName> ObjList;
+		const FString DataDirectory = "Data/";
+		if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
+		{
+			for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+			{
+				if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+				{
+					ObjList.push_back(FName(Entry.path().generic_string()));
+				}
+			}
+		}
+
+		// UAssetManager::LoadAllObjStaticMesh와 같은 설정에 압축만 켠다
+		FObjImporter::Configuration Config;
+		Config.bFlipWindingOrder = false;
+		Config.bIsBinaryEnabled = false;
+		Config.bPositionToUEBasis = true;
+		Config.bNormalToUEBasis = true;
+		Config.bUVToUEBasis = true;
+		Config.bIsVertexCompressionEnabled = true;
+
+		FObjImporter::Configuration CacheConfig = Config;
+		CacheConfig.bIsBinaryEnabled = true;
+
+		size_t TotalSourceBytes = 0;
+		size_t TotalPackedBytes = 0;
+		double TotalQuantizeMilliseconds = 0.0;
+		FVertexQuantizationError WorstError;
+		int32 MeshErrors = 0;
+		int32 CacheMismatches = 0;
+
+		for (const FName& ObjPath : ObjList)
+		{
+			std::unique_ptr<FStaticMesh> Mesh = FObjManager::ImportStaticMesh(ObjPath, Config);
+			if (!Mesh || Mesh->Vertices.empty())
+			{
+				UE_LOG_WARNING("VertexCompression: %s 임포트 실패, 건너뜀", ObjPath.ToString().c_str());
+				continue;
+			}
+
+			// 임포트 안에서 이미 양자화했지만 시간만 따로 재기 위해 한 번 더 돌린다
+			FScopeCycleCounter Counter;
+			FVertexQuantizer::Quantize(*Mesh);
+			const double QuantizeMilliseconds = Counter.Finish();
+
+			const FVertexQuantizationError Error = FVertexQuantizer::MeasureError(*Mesh);
+			const size_t SourceBytes = Mesh->Vertices.size() * sizeof(FNormalVertex);
+			const size_t PackedBytes = Mesh->PackedVertices.size() * sizeof(FPackedNormalVertex);
+
+			// 축마다 반 칸(Extent / 65535 / 2) 이내여야 하므로 대각선 기준 허용치는 |Extent| / 65535
+			const float PositionTolerance = Mesh->PackedPositionExtent.Length() / 65535.0f + 1e-5f;
+			if (Mesh->PackedVertices.size() != Mesh->Vertices.size() || Error.MaxPositionError > PositionTolerance)
+			{
+				UE_LOG_ERROR("VertexCompression: %s 위치 오차 %.6f > 허용치 %.6f", ObjPath.ToString().c_str(), Error.MaxPositionError, PositionTolerance);
+				++MeshErrors;
+			}
+
+			// 처음 호출에서 캐시가 없거나 오래되었으면 쿠킹하고, 두 번째 호출은 캐시에서 읽는다
+			FObjManager::ImportStaticMesh(ObjPath, CacheConfig);
+			const std::unique_ptr<FStaticMesh> CachedMesh = FObjManager::ImportStaticMesh(ObjPath, CacheConfig);
+			if (!CachedMesh || !IsSamePackedMesh(*Mesh, *CachedMesh))
+			{
+				UE_LOG_ERROR("VertexCompression: %s 캐시에서 읽은 압축 정점이 임포트 결과와 다릅니다", ObjPath.ToString().c_str());
+				++CacheMismatches;
+			}
+
+			UE_LOG_INFO("VertexCompression: %s | Verts %zu | %zu -> %zu bytes (x%.2f) | Pos %.6f | N %.4f deg | T %.4f deg | UV %.6f | B flips %d | %.3fms",
+				ObjPath.ToString().c_str(), Mesh->Vertices.size(), SourceBytes, PackedBytes,
+				PackedBytes > 0 ? static_cast<double>(SourceBytes) / PackedBytes : 0.0,
+				Error.MaxPositionError, Error.MaxNormalErrorDegrees, Error.MaxTangentErrorDegrees, Error.MaxTexCoordError,
+				Error.BitangentFlipCount, QuantizeMilliseconds);
+
+			TotalSourceBytes += SourceBytes;
+			TotalPackedBytes += PackedBytes;
+			TotalQuantizeMilliseconds += QuantizeMilliseconds;
+			WorstError.MaxPositionError = std::max(WorstError.MaxPositionError, Error.MaxPositionError);
+			WorstError.MaxNormalErrorDegrees = std::max(WorstError.MaxNormalErrorDegrees, Error.MaxNormalErrorDegrees);
+			WorstError.MaxTangentErrorDegrees = std::max(WorstError.MaxTangentErrorDegrees, Error.MaxTangentErrorDegrees);
+			WorstError.MaxTexCoordError = std::max(WorstError.MaxTexCoordError, Error.MaxTexCoordError);
+			WorstError.BitangentFlipCount += Error.BitangentFlipCount;
+		}
+
+		// 16비트 8면체 인코딩은 float 측정 오차를 합쳐 0.01도 안팎, 여유를 두고 0.02도
+		if (HalfErrors > 0 || OctahedralDegrees > 0.02f || MeshErrors > 0 || CacheMismatches > 0)
+		{
+			UE_LOG_ERROR("VertexCompression: half %d errors | octahedral %.5f deg | %d meshes over tolerance | %d cache mismatches",
+				HalfErrors, OctahedralDegrees, MeshErrors, CacheMismatches);
+			return;
+		}
+
+		UE_LOG_SUCCESS("VertexCompression: %zu meshes | %.2f MB -> %.2f MB (x%.2f) | worst Pos %.6f | N %.4f deg | T %.4f deg | UV %.6f | B flips %d | quantize %.3fms",
+			ObjList.size(),
+			static_cast<double>(TotalSourceBytes) / (1024.0 * 1024.0), static_cast<double>(TotalPackedBytes) / (1024.0 * 1024.0),
+			TotalPackedBytes > 0 ? static_cast<double>(TotalSourceBytes) / TotalPackedBytes : 0.0,
+			WorstError.MaxPositionError, WorstError.MaxNormalErrorDegrees, WorstError.MaxTangentErrorDegrees, WorstError.MaxTexCoordError,
+			WorstError.BitangentFlipCount, TotalQuantizeMilliseconds);
+	}
+}
+
+IMPLEMENT_BENCHMARK("vertexcompression", "Import every Data/ .obj with packed vertices, report GPU vertex bytes and quantization error", RunVertexCompressionBenchmark)
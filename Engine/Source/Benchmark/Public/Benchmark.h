@@ -0,0 +1,52 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 콘솔 명령어(bench)로 실행되는 CPU 전용 벤치마크 레지스트리
+ * 각 벤치마크는 GPU 리소스에 의존하지 않고, 결과는 UE_LOG로 출력한다
+ * @note 사용 예시: "bench list", "bench bvh", "bench octree 100000"
+ */
+class FBenchmarkRegistry
+{
+public:
+	using FBenchmarkFunction = TFunction<void(const TArray<FString>& InArgs)>;
+
+	struct FBenchmarkEntry
+	{
+		FString Description;
+		FBenchmarkFunction Function;
+	};
+
+	static void Register(const FString& InName, const FString& InDescription, FBenchmarkFunction InFunction);
+
+	/**
+	 * @brief 등록된 벤치마크를 실행
+	 * @param InName 벤치마크 이름 (소문자)
+	 * @param InArgs 벤치마크별 추가 인자
+	 * @return 해당 이름의 벤치마크가 존재하면 true
+	 */
+	static bool Run(const FString& InName, const TArray<FString>& InArgs);
+	static void PrintList();
+
+	/**
+	 * @brief 인자 배열에서 Index번째 값을 정수로 읽고, 없거나 잘못된 값이면 기본값을 반환
+	 */
+	static int32 GetIntArg(const TArray<FString>& InArgs, size_t InIndex, int32 InDefault);
+
+private:
+	static TMap<FString, FBenchmarkEntry>& GetEntries();
+};
+
+/**
+ * @brief 정적 초기화 시점에 벤치마크를 레지스트리에 등록하는 헬퍼
+ */
+struct FAutoRegisterBenchmark
+{
+	FAutoRegisterBenchmark(const FString& InName, const FString& InDescription, FBenchmarkRegistry::FBenchmarkFunction InFunction)
+	{
+		FBenchmarkRegistry::Register(InName, InDescription, std::move(InFunction));
+	}
+};
+
+#define IMPLEMENT_BENCHMARK(Name, Description, Function) \
+	static FAutoRegisterBenchmark GAutoRegisterBenchmark_##Function(Name, Description, Function);
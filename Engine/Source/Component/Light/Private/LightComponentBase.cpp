@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Component/Light/Public/LightComponentBase.h"
+#include "Core/Public/Archive.h"
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_ABSTRACT_CLASS(ULightComponentBase, USceneComponent)
@@ -8,18 +9,27 @@ void ULightComponentBase::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 
-	if (bInIsLoading)
-	{
-		FJsonSerializer::ReadFloat(InOutHandle, "Intensity", Intensity, 1.0f);
-		FJsonSerializer::ReadVector4(InOutHandle, "Color", Color, FVector4(1.0f, 1.0f, 1.0f, 1.0f));
-	}
-	else
+	if (!bInIsLoading)
 	{
 		InOutHandle["Intensity"] = Intensity;
 		InOutHandle["Color"] = FJsonSerializer::Vector4ToJson(Color);
 	}
 }
 
+void ULightComponentBase::Deserialize(const FJsonValue& InHandle)
+{
+	Super::Deserialize(InHandle);
+
+	FJsonSerializer::ReadFloat(InHandle, "Intensity", Intensity, 1.0f);
+	FJsonSerializer::ReadVector4(InHandle, "Color", Color, FVector4(1.0f, 1.0f, 1.0f, 1.0f));
+}
+
+void ULightComponentBase::SerializeBinary(FArchive& InOutArchive)
+{
+	Super::SerializeBinary(InOutArchive);
+	InOutArchive << Intensity << Color;
+}
+
 UObject* ULightComponentBase::Duplicate()
 {
 	ULightComponentBase* LightComponent = Cast<ULightComponentBase>(Super::Duplicate());
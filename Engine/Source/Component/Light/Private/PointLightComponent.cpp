@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Component/Light/Public/PointLightComponent.h"
+#include "Core/Public/Archive.h"
 #include "Render/UI/Widget/Light/Public/PointLightComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -21,18 +22,27 @@ void UPointLightComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 
-	if (bInIsLoading)
-	{
-		FJsonSerializer::ReadFloat(InOutHandle, "AttenuationRadius", AttenuationRadius, 10.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "LightFalloffExponent", LightFalloffExponent, 8.0f);
-	}
-	else
+	if (!bInIsLoading)
 	{
 		InOutHandle["AttenuationRadius"] = AttenuationRadius;
 		InOutHandle["LightFalloffExponent"] = LightFalloffExponent;
 	}
 }
 
+void UPointLightComponent::Deserialize(const FJsonValue& InHandle)
+{
+	Super::Deserialize(InHandle);
+
+	FJsonSerializer::ReadFloat(InHandle, "AttenuationRadius", AttenuationRadius, 10.0f);
+	FJsonSerializer::ReadFloat(InHandle, "LightFalloffExponent", LightFalloffExponent, 8.0f);
+}
+
+void UPointLightComponent::SerializeBinary(FArchive& InOutArchive)
+{
+	Super::SerializeBinary(InOutArchive);
+	InOutArchive << AttenuationRadius << LightFalloffExponent;
+}
+
 UObject* UPointLightComponent::Duplicate()
 {
 	UPointLightComponent* PointLightComp = Cast<UPointLightComponent>(Super::Duplicate());
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Component/Light/Public/SpotLightComponent.h"
+#include "Core/Public/Archive.h"
 #include "Render/UI/Widget/Light/Public/SpotLightComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -9,14 +10,7 @@ void USpotLightComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 
-	if (bInIsLoading)
-	{
-		FJsonSerializer::ReadFloat(InOutHandle, "InnerConeAngleRad", InnerConeAngleRad, 0.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "OuterConeAngleRad", OuterConeAngleRad, 0.785398f);
-		FJsonSerializer::ReadFloat(InOutHandle, "Range", Range, 50.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "Falloff", Light.Falloff, 1.0f);
-	}
-	else
+	if (!bInIsLoading)
 	{
 		InOutHandle["InnerConeAngleRad"] = InnerConeAngleRad;
 		InOutHandle["OuterConeAngleRad"] = OuterConeAngleRad;
@@ -25,6 +19,22 @@ void USpotLightComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void USpotLightComponent::Deserialize(const FJsonValue& InHandle)
+{
+	Super::Deserialize(InHandle);
+
+	FJsonSerializer::ReadFloat(InHandle, "InnerConeAngleRad", InnerConeAngleRad, 0.0f);
+	FJsonSerializer::ReadFloat(InHandle, "OuterConeAngleRad", OuterConeAngleRad, 0.785398f);
+	FJsonSerializer::ReadFloat(InHandle, "Range", Range, 50.0f);
+	FJsonSerializer::ReadFloat(InHandle, "Falloff", Light.Falloff, 1.0f);
+}
+
+void USpotLightComponent::SerializeBinary(FArchive& InOutArchive)
+{
+	Super::SerializeBinary(InOutArchive);
+	InOutArchive << InnerConeAngleRad << OuterConeAngleRad << Range << Light.Falloff;
+}
+
 UObject* USpotLightComponent::Duplicate()
 {
 	USpotLightComponent* SpotLightComp = Cast<USpotLightComponent>(Super::Duplicate());
@@ -13,6 +13,8 @@ public:
 	~ULightComponentBase() override {};
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void Deserialize(const FJsonValue& InHandle) override;
+	void SerializeBinary(FArchive& InOutArchive) override;
 	UObject* Duplicate() override;
 
 	void SetIntensity(float InIntensity) { Intensity = InIntensity;}
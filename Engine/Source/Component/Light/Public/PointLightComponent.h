@@ -22,6 +22,8 @@ public:
     virtual ~UPointLightComponent() override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void Deserialize(const FJsonValue& InHandle) override;
+	void SerializeBinary(FArchive& InOutArchive) override;
 	UObject* Duplicate() override;
 
 	virtual UClass* GetSpecificWidgetClass() const override;
@@ -21,6 +21,8 @@ class USpotLightComponent : public ULightComponent
 
 public:
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void Deserialize(const FJsonValue& InHandle) override;
+	void SerializeBinary(FArchive& InOutArchive) override;
 	UObject* Duplicate() override;
 
 	UClass* GetSpecificWidgetClass() const override;
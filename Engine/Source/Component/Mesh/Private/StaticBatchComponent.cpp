@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "Component/Mesh/Public/StaticBatchComponent.h"
+#include "Physics/Public/AABB.h"
+#include "Render/Renderer/Public/RenderResourceFactory.h"
+
+IMPLEMENT_CLASS(UStaticBatchComponent, UStaticMeshComponent)
+
+namespace
+{
+	/** @brief 셀 메시 경로의 접두사, 에셋 캐시에 없는 이름이라 메시 선택 목록에서 거른다 */
+	constexpr const char* STATIC_BATCH_PATH_PREFIX = "StaticBatch/";
+}
+
+UStaticBatchComponent::UStaticBatchComponent()
+{
+	// 부모 생성자가 연결한 기본 메시의 에셋 버퍼는 에셋 매니저 소유이므로, 셀 버퍼로 바꾸기 전에 연결만 끊는다
+	StaticMesh = nullptr;
+	VertexBuffer = nullptr;
+	IndexBuffer = nullptr;
+	BoundingBox = nullptr;
+
+	// 정점이 이미 월드 공간이므로 피킹은 원본 컴포넌트가 맡는다
+	SetCanPick(false);
+}
+
+UStaticBatchComponent::~UStaticBatchComponent()
+{
+	ReleaseMergedCell();
+
+	if (bOwnsBoundingBox)
+	{
+		SafeDelete(BoundingBox);
+	}
+}
+
+void UStaticBatchComponent::SetMergedCell(FStaticMeshMergedCell&& InCell, const TArray<UStaticMeshComponent*>& InSources)
+{
+	ReleaseMergedCell();
+
+	MergedMesh = std::move(InCell.Mesh);
+	MergedMesh.PathFileName = FName(STATIC_BATCH_PATH_PREFIX + std::to_string(GetUUID()));
+	Sources = InSources;
+	SourceDrawCount = InCell.SourceDrawCount;
+	bReceivesDecals = InCell.bReceivesDecals;
+
+	// 머티리얼은 원본 메시 소유이므로, 해제 전에 슬롯을 비워 UStaticMesh 소멸자가 지우지 않게 한다
+	MergedStaticMesh = new UStaticMesh();
+	MergedStaticMesh->SetStaticMeshAsset(&MergedMesh);
+	for (int32 Slot = 0; Slot < static_cast<int32>(InCell.Materials.size()); ++Slot)
+	{
+		MergedStaticMesh->SetMaterial(Slot, InCell.Materials[Slot]);
+	}
+	StaticMesh = MergedStaticMesh;
+
+	Vertices = &MergedMesh.Vertices;
+	Indices = &MergedMesh.Indices;
+	NumVertices = static_cast<uint32>(MergedMesh.Vertices.size());
+	NumIndices = static_cast<uint32>(MergedMesh.Indices.size());
+	VertexBuffer = FRenderResourceFactory::CreateVertexBuffer(MergedMesh.Vertices.data(), NumVertices * sizeof(FNormalVertex));
+	IndexBuffer = FRenderResourceFactory::CreateIndexBuffer(MergedMesh.Indices.data(), NumIndices * sizeof(uint32));
+
+	if (bOwnsBoundingBox)
+	{
+		SafeDelete(BoundingBox);
+	}
+	BoundingBox = new FAABB(InCell.Min, InCell.Max);
+	bOwnsBoundingBox = true;
+	bIsAABBCacheDirty = true;
+
+	MarkRenderStateDirty();
+}
+
+void UStaticBatchComponent::RemoveSource(UStaticMeshComponent* InSource)
+{
+	if (auto It = std::find(Sources.begin(), Sources.end(), InSource); It != Sources.end())
+	{
+		Sources.erase(It);
+	}
+}
+
+uint32 UStaticBatchComponent::GetDrawCount() const
+{
+	if (MergedMesh.Sections.empty())
+	{
+		return MergedMesh.Indices.empty() ? 0 : 1;
+	}
+
+	uint32 DrawCount = 0;
+	for (const FMeshSection& Section : MergedMesh.Sections)
+	{
+		DrawCount += Section.IndexCount > 0 ? 1 : 0;
+	}
+	return DrawCount;
+}
+
+uint64 UStaticBatchComponent::GetMergedBufferSize() const
+{
+	return MergedMesh.Vertices.size() * sizeof(FNormalVertex) + MergedMesh.Indices.size() * sizeof(uint32);
+}
+
+bool UStaticBatchComponent::IsStaticBatchMesh(const UStaticMesh* InStaticMesh)
+{
+	return InStaticMesh && InStaticMesh->GetAssetPathFileName().ToString().rfind(STATIC_BATCH_PATH_PREFIX, 0) == 0;
+}
+
+void UStaticBatchComponent::ReleaseMergedCell()
+{
+	SafeRelease(VertexBuffer);
+	SafeRelease(IndexBuffer);
+
+	if (MergedStaticMesh)
+	{
+		for (int32 Slot = 0; Slot < MergedStaticMesh->GetNumMaterials(); ++Slot)
+		{
+			MergedStaticMesh->SetMaterial(Slot, nullptr);
+		}
+		if (StaticMesh == MergedStaticMesh)
+		{
+			StaticMesh = nullptr;
+		}
+		SafeDelete(MergedStaticMesh);
+	}
+
+	Vertices = nullptr;
+	Indices = nullptr;
+	NumVertices = 0;
+	NumIndices = 0;
+	Sources.clear();
+	SourceDrawCount = 0;
+}
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Core/Public/ObjectIterator.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Core/Public/Archive.h"
 #include "Component/Mesh/Public/MeshComponent.h"
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Asset/Public/AssetManager.h"
@@ -28,48 +29,13 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 
-	// 불러오기
-	if (bInIsLoading)
-	{
-		FString AssetPath;
-		FJsonSerializer::ReadString(InOutHandle, "ObjStaticMeshAsset", AssetPath);
-		SetStaticMesh(AssetPath);
-
-		JSON OverrideMaterialJson;
-		if (FJsonSerializer::ReadObject(InOutHandle, "OverrideMaterial", OverrideMaterialJson, nullptr, false))
-		{
-			for (auto& Pair : OverrideMaterialJson.ObjectRange())
-			{
-				const FString& IdString = Pair.first;
-				JSON& MaterialPathDataJson = Pair.second;
-
-				int32 MaterialId;
-				try { MaterialId = std::stoi(IdString); }
-				catch (const std::exception&) { continue; }
-
-				FString MaterialPath;
-				FJsonSerializer::ReadString(MaterialPathDataJson, "Path", MaterialPath);
-
-				for (TObjectIterator<UMaterial> It; It; ++It)
-				{
-					UMaterial* Mat = *It;
-					if (!Mat) continue;
-
-					if (Mat->GetDiffuseTexture()->GetFilePath() == MaterialPath)
-					{
-						SetMaterial(MaterialId, Mat);
-						break;
-					}
-				}
-			}
-		}
-	}
 	// 저장
-	else
+	if (!bInIsLoading)
 	{
 		if (StaticMesh)
 		{
 			InOutHandle["ObjStaticMeshAsset"] = StaticMesh->GetAssetPathFileName().ToString();
+			InOutHandle["ForcedLOD"] = ForcedLOD;
 
 			if (0 < OverrideMaterials.size())
 			{
@@ -88,6 +54,86 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void UStaticMeshComponent::Deserialize(const FJsonValue& InHandle)
+{
+	Super::Deserialize(InHandle);
+
+	FString AssetPath;
+	FJsonSerializer::ReadString(InHandle, "ObjStaticMeshAsset", AssetPath);
+	SetStaticMesh(AssetPath);
+	FJsonSerializer::ReadInt32(InHandle, "ForcedLOD", ForcedLOD, -1, false);
+
+	FJsonValue OverrideMaterialJson;
+	if (FJsonSerializer::ReadObject(InHandle, "OverrideMaterial", OverrideMaterialJson, false))
+	{
+		const FJsonValue::FRange Materials = OverrideMaterialJson.ObjectRange();
+		for (FJsonValue::FIterator It = Materials.begin(); It != Materials.end(); ++It)
+		{
+			int32 MaterialId;
+			try { MaterialId = std::stoi(FString(It.GetKey())); }
+			catch (const std::exception&) { continue; }
+
+			FString MaterialPath;
+			FJsonSerializer::ReadString(It.GetValue(), "Path", MaterialPath);
+
+			for (TObjectIterator<UMaterial> MaterialIt; MaterialIt; ++MaterialIt)
+			{
+				UMaterial* Mat = *MaterialIt;
+				if (!Mat) continue;
+
+				if (Mat->GetDiffuseTexture()->GetFilePath() == MaterialPath)
+				{
+					SetMaterial(MaterialId, Mat);
+					break;
+				}
+			}
+		}
+	}
+}
+
+void UStaticMeshComponent::SerializeBinary(FArchive& InOutArchive)
+{
+	Super::SerializeBinary(InOutArchive);
+
+	FName AssetPath = StaticMesh ? StaticMesh->GetAssetPathFileName() : FName::GetNone();
+	InOutArchive << AssetPath << ForcedLOD;
+
+	// 오버라이드 머티리얼은 JSON과 같이 디퓨즈 텍스처 경로로 저장하고, 로드된 머티리얼 중에서 찾는다
+	TArray<FName> MaterialPaths;
+	if (!InOutArchive.IsLoading() && StaticMesh)
+	{
+		for (const UMaterial* Material : OverrideMaterials)
+		{
+			const UTexture* DiffuseTexture = Material ? Material->GetDiffuseTexture() : nullptr;
+			MaterialPaths.push_back(DiffuseTexture ? DiffuseTexture->GetFilePath() : FName::GetNone());
+		}
+	}
+	InOutArchive << MaterialPaths;
+
+	if (InOutArchive.IsLoading())
+	{
+		SetStaticMesh(AssetPath);
+
+		for (int32 MaterialId = 0; MaterialId < static_cast<int32>(MaterialPaths.size()); ++MaterialId)
+		{
+			if (MaterialPaths[MaterialId].IsNone())
+			{
+				continue;
+			}
+
+			for (TObjectIterator<UMaterial> It; It; ++It)
+			{
+				UMaterial* Mat = *It;
+				if (Mat && Mat->GetDiffuseTexture() && Mat->GetDiffuseTexture()->GetFilePath() == MaterialPaths[MaterialId])
+				{
+					SetMaterial(MaterialId, Mat);
+					break;
+				}
+			}
+		}
+	}
+}
+
 UClass* UStaticMeshComponent::GetSpecificWidgetClass() const
 {
 	return UStaticMeshComponentWidget::StaticClass();
@@ -115,6 +161,7 @@ void UStaticMeshComponent::SetStaticMesh(const FName& InObjPath)
 		RenderState.FillMode = EFillMode::Solid;
 		BoundingBox = &AssetManager.GetStaticMeshAABB(InObjPath);
 		MarkAsDirty();
+		MarkRenderStateDirty();
 	}
 }
 
@@ -136,6 +183,7 @@ void UStaticMeshComponent::SetMaterial(int32 Index, UMaterial* InMaterial)
 		OverrideMaterials.resize(Index + 1, nullptr);
 	}
 	OverrideMaterials[Index] = InMaterial;
+	MarkRenderStateDirty();
 }
 
 const FRenderState& UStaticMeshComponent::GetClassDefaultRenderState()
@@ -144,12 +192,51 @@ const FRenderState& UStaticMeshComponent::GetClassDefaultRenderState()
 	return DefaultRenderState;
 }
 
+int32 UStaticMeshComponent::SelectLOD(const FStaticMesh& InMesh, float InScreenSize, int32 InCurrentLOD)
+{
+	const int32 LODCount = InMesh.GetNumLODs();
+	int32 CurrentLOD = std::clamp(InCurrentLOD, 0, LODCount - 1);
+
+	// 전환 화면 크기는 LOD가 커질수록 작아지므로, 화면 크기보다 큰 전환점 수가 목표 LOD
+	int32 TargetLOD = 0;
+	while (TargetLOD + 1 < LODCount && InScreenSize < InMesh.LODs[TargetLOD].ScreenSize)
+	{
+		++TargetLOD;
+	}
+
+	// 거친 쪽으로는 전환점보다 LOD_HYSTERESIS만큼 더 작아져야, 세밀한 쪽으로는 그만큼 더 커져야 넘어간다
+	while (TargetLOD > CurrentLOD && InScreenSize >= InMesh.LODs[TargetLOD - 1].ScreenSize * (1.0f - LOD_HYSTERESIS))
+	{
+		--TargetLOD;
+	}
+	while (TargetLOD < CurrentLOD && InScreenSize <= InMesh.LODs[TargetLOD].ScreenSize * (1.0f + LOD_HYSTERESIS))
+	{
+		++TargetLOD;
+	}
+	return TargetLOD;
+}
+
+int32 UStaticMeshComponent::SelectLOD(float InScreenSize, int32 InCurrentLOD) const
+{
+	const FStaticMesh* MeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+	if (!MeshAsset)
+	{
+		return 0;
+	}
+	if (ForcedLOD >= 0)
+	{
+		return std::min(ForcedLOD, MeshAsset->GetNumLODs() - 1);
+	}
+	return SelectLOD(*MeshAsset, InScreenSize, InCurrentLOD);
+}
+
 UObject* UStaticMeshComponent::Duplicate()
 {
 	UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Super::Duplicate());
 
 	StaticMeshComponent->bIsScrollEnabled = bIsScrollEnabled;
 	StaticMeshComponent->ElapsedTime = ElapsedTime;
+	StaticMeshComponent->ForcedLOD = ForcedLOD;
 	StaticMeshComponent->StaticMesh = StaticMesh;
 	StaticMeshComponent->OverrideMaterials = OverrideMaterials;
 	return StaticMeshComponent;
@@ -0,0 +1,47 @@
+#pragma once
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Optimization/Public/StaticMeshMerger.h"
+
+/**
+ * @brief 정적 배치 셀 하나를 그리는 컴포넌트, ULevel::BuildStaticBatches가 만들어 원본 컴포넌트 대신 컬링 구조에 등록한다
+ * 월드 공간으로 합친 메시와 GPU 버퍼를 직접 소유하고 항등 월드 행렬로 그리므로, 컬링과 렌더 패스는 일반 스태틱 메시와 같은 경로를 탄다.
+ * 액터에 속하지 않아 저장되지 않으며, 피킹은 GetSources의 원본 컴포넌트로 넘긴다.
+ */
+UCLASS()
+class UStaticBatchComponent : public UStaticMeshComponent
+{
+	GENERATED_BODY()
+	DECLARE_CLASS(UStaticBatchComponent, UStaticMeshComponent)
+
+public:
+	UStaticBatchComponent();
+	~UStaticBatchComponent() override;
+
+	/** @brief 합친 셀로 메시, 버퍼, 경계를 교체, 이전 셀의 리소스는 해제한다 */
+	void SetMergedCell(FStaticMeshMergedCell&& InCell, const TArray<UStaticMeshComponent*>& InSources);
+
+	/** @brief 셀에서 원본 하나를 뺀다, 합친 메시는 ULevel이 나머지로 다시 합칠 때까지 그대로 둔다 */
+	void RemoveSource(UStaticMeshComponent* InSource);
+
+	const TArray<UStaticMeshComponent*>& GetSources() const { return Sources; }
+
+	/** @brief 원본을 따로 그렸을 때의 드로우 수 */
+	uint32 GetSourceDrawCount() const { return SourceDrawCount; }
+	/** @brief 셀 하나의 드로우 수 (비어 있지 않은 섹션 수) */
+	uint32 GetDrawCount() const;
+	/** @brief 합친 정점 / 인덱스 버퍼 크기 (바이트) */
+	uint64 GetMergedBufferSize() const;
+
+	/** @brief 정적 배치 셀이 만든 메시인지, 에셋 목록에서 셀 메시를 거를 때 쓴다 */
+	static bool IsStaticBatchMesh(const UStaticMesh* InStaticMesh);
+
+private:
+	void ReleaseMergedCell();
+
+	/** @brief 합친 메시 본체, MergedStaticMesh가 비소유 포인터로 감싼다 */
+	FStaticMesh MergedMesh;
+	UStaticMesh* MergedStaticMesh = nullptr;
+
+	TArray<UStaticMeshComponent*> Sources;
+	uint32 SourceDrawCount = 0;
+};
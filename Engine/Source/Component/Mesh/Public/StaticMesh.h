@@ -12,6 +12,40 @@ struct FMeshSection
 	uint32 MaterialSlot;
 };
 
+/**
+ * @brief 쿠킹 때 만든 LOD1 이상의 한 단계 (FMeshSimplifier 참고)
+ * 인덱스는 LOD0 정점 버퍼를 그대로 가리키며, 구간은 Indices 뒤에 LODIndices를 이어 붙인 GPU 인덱스 버퍼 기준이다.
+ */
+struct FStaticMeshLOD
+{
+	/** @brief 경계 구 지름이 화면 높이의 이 비율보다 작아지면 이 LOD로 바꾼다 */
+	float ScreenSize = 0.0f;
+	/** @brief LOD0 대비 추정 오차 (모델 단위 거리) */
+	float Error = 0.0f;
+	uint32 FirstIndex = 0;
+	uint32 IndexCount = 0;
+	/** @brief LOD0과 같은 순서와 머티리얼 슬롯의 섹션 */
+	TArray<FMeshSection> Sections;
+};
+
+/**
+ * @brief 쿠킹 때 LOD0 섹션을 나눈 삼각형 묶음 하나 (FMeshletBuilder 참고)
+ * 삼각형은 Indices의 [FirstIndex, FirstIndex + IndexCount)에 모여 있고, 로컬 공간 경계 구와 노멀 콘으로 CPU에서 절두체/뒷면 컬링한다 (FMeshletCuller 참고).
+ */
+struct FMeshlet
+{
+	FVector Center;
+	float Radius = 0.0f;
+	/** @brief 모든 삼각형 평면의 뒤쪽에 있는 점, 카메라에서 이 점으로 향하는 방향과 ConeAxis의 내적이 ConeCutoff 이상이면 전부 뒷면이다 */
+	FVector ConeApex;
+	FVector ConeAxis;
+	/** @brief 콘 반각의 사인, 1이면 노멀이 너무 퍼져 있어 콘으로 컬링하지 않는다 */
+	float ConeCutoff = 1.0f;
+	uint32 SectionIndex = 0;
+	uint32 FirstIndex = 0;
+	uint32 IndexCount = 0;
+};
+
 /**
 * @brief 스태틱 메시 Cooked Data.
 * @note 엔진 내부 관점에서 Static Mesh Asset은 이 구조체를 의미합니다.
@@ -22,6 +56,18 @@ struct FStaticMesh
 
 	TArray<FNormalVertex> Vertices;
 	TArray<uint32> Indices;
+
+	/**
+	 * @brief 압축 정점 포맷으로 쿠킹한 메시만 채워지며, GPU에는 Vertices 대신 이것을 올린다
+	 * Vertices는 피킹과 BVH를 위해 그대로 남는다. (FVertexQuantizer 참고)
+	 */
+	TArray<FPackedNormalVertex> PackedVertices;
+	FVector PackedPositionMin;
+	FVector PackedPositionExtent;
+	/** @brief PackedVertices의 [0,1] 위치를 로컬 위치로 되돌리는 행렬, 셰이더에 넘기는 World 앞에 곱한다 */
+	FMatrix PackedPositionToLocal = FMatrix::Identity();
+
+	bool HasPackedVertices() const { return !PackedVertices.empty(); }
 	FBVH BVH; // 메시의 가속 구조
 
 	// --- 2. 재질 정보 (Materials) ---
@@ -33,6 +79,22 @@ struct FStaticMesh
 	// --- 3. 연결 정보 (Sections) ---
 	// 각 재질을 어떤 기하 구간에 칠할지에 대한 지시서
 	TArray<FMeshSection> Sections;
+
+	// --- 4. LOD ---
+	/** @brief LOD1 이상의 인덱스, GPU 인덱스 버퍼는 Indices 뒤에 이것을 이어 붙인다 (피킹과 BVH는 LOD0만 쓴다) */
+	TArray<uint32> LODIndices;
+	/** @brief 화면 크기가 큰 것부터 LOD1, LOD2, ... 순서 */
+	TArray<FStaticMeshLOD> LODs;
+
+	// --- 5. Meshlets ---
+	/** @brief LOD0 섹션 순서대로 나눈 메시렛, 작은 메시는 비어 있다 */
+	TArray<FMeshlet> Meshlets;
+
+	int32 GetNumLODs() const { return 1 + static_cast<int32>(LODs.size()); }
+	/** @param InLODIndex [0, GetNumLODs()) */
+	const TArray<FMeshSection>& GetLODSections(int32 InLODIndex) const { return InLODIndex > 0 ? LODs[InLODIndex - 1].Sections : Sections; }
+	uint32 GetLODFirstIndex(int32 InLODIndex) const { return InLODIndex > 0 ? LODs[InLODIndex - 1].FirstIndex : 0; }
+	uint32 GetLODIndexCount(int32 InLODIndex) const { return InLODIndex > 0 ? LODs[InLODIndex - 1].IndexCount : static_cast<uint32>(Indices.size()); }
 };
 
 
@@ -17,6 +17,8 @@ public:
 	~UStaticMeshComponent();
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void Deserialize(const FJsonValue& InHandle) override;
+	void SerializeBinary(FArchive& InOutArchive) override;
 
 public:
 	UStaticMesh* GetStaticMesh() { return StaticMesh; }
@@ -36,15 +38,34 @@ public:
 
 	static const FRenderState& GetClassDefaultRenderState(); 
 
-private:
+	/** @brief LOD 전환 화면 크기 주변의 불감 구간 비율, 경계에서 LOD가 매 프레임 바뀌지 않게 한다 */
+	static constexpr float LOD_HYSTERESIS = 0.1f;
+
+	/**
+	 * @brief 화면 크기에 맞는 LOD, 현재 LOD에서 벗어나려면 전환 화면 크기를 LOD_HYSTERESIS만큼 넘어야 한다
+	 * @param InScreenSize ViewVolumeCuller::ComputeScreenSize
+	 * @param InCurrentLOD 지난 프레임에 고른 LOD
+	 */
+	static int32 SelectLOD(const FStaticMesh& InMesh, float InScreenSize, int32 InCurrentLOD);
+	/** @brief ForcedLOD가 있으면 그것을, 없으면 메시의 LOD 체인에서 고른다 */
+	int32 SelectLOD(float InScreenSize, int32 InCurrentLOD) const;
+
+	/** @brief -1이면 화면 크기로 고르고, 0 이상이면 그 LOD로 고정 (메시의 LOD 수로 제한) */
+	int32 GetForcedLOD() const { return ForcedLOD; }
+	void SetForcedLOD(int32 InForcedLOD) { ForcedLOD = InForcedLOD; }
+
+protected:
 	UStaticMesh* StaticMesh;
 
+private:
 	// MaterialList
 	TArray<UMaterial*> OverrideMaterials;
 
 	// Scroll
 	bool bIsScrollEnabled;
 	float ElapsedTime;
+
+	int32 ForcedLOD = -1;
 	
 public:
 	virtual UObject* Duplicate() override;
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Component/Public/ActorComponent.h"
+#include "Core/Public/Archive.h"
 
 #include "Utility/Public/JsonSerializer.h"
 
@@ -17,24 +18,28 @@ UActorComponent::~UActorComponent()
 void UActorComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
-	if (bInIsLoading)
-	{
-		FString IsEditorOnlyString;
-		FJsonSerializer::ReadString(InOutHandle, "IsEditorOnly", IsEditorOnlyString, "false");
-		bIsEditorOnly = IsEditorOnlyString == "true";
-		
-		FString IsVisualizationString;
-		FJsonSerializer::ReadString(InOutHandle, "IsVisualizationComponent", IsVisualizationString, "false");
-		bIsVisualizationComponent =  IsVisualizationString == "true";
-	}
 	// 저장
-	else
+	if (!bInIsLoading)
 	{
 		InOutHandle["IsEditorOnly"] = bIsEditorOnly ? "true" : "false";
 		InOutHandle["IsVisualizationComponent"] = bIsVisualizationComponent ? "true" : "false";
 	}
 }
 
+void UActorComponent::Deserialize(const FJsonValue& InHandle)
+{
+	Super::Deserialize(InHandle);
+
+	FJsonSerializer::ReadBool(InHandle, "IsEditorOnly", bIsEditorOnly, false);
+	FJsonSerializer::ReadBool(InHandle, "IsVisualizationComponent", bIsVisualizationComponent, false);
+}
+
+void UActorComponent::SerializeBinary(FArchive& InOutArchive)
+{
+	Super::SerializeBinary(InOutArchive);
+	InOutArchive << bIsEditorOnly << bIsVisualizationComponent;
+}
+
 void UActorComponent::BeginPlay()
 {
 
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Component/Public/BillBoardComponent.h"
+#include "Core/Public/Archive.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Render/Renderer/Public/Renderer.h"
 #include "Physics/Public/AABB.h"
@@ -41,28 +42,43 @@ void UBillBoardComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle);
 
-    if (bInIsLoading)
-    {
-        FString SpritePath;
-        FJsonSerializer::ReadString(InOutHandle, "BillBoardSprite", SpritePath, "");
-        if (!SpritePath.empty())
-            SetSprite(UAssetManager::GetInstance().LoadTexture(FName(SpritePath)));
-
-        FString ScreenSizeScaledString;
-        FJsonSerializer::ReadString(InOutHandle, "BillBoardScreenSizeScaled", ScreenSizeScaledString, "false");
-        bScreenSizeScaled = ScreenSizeScaledString == "true";
-
-        FString ScreenSizeString;
-        FJsonSerializer::ReadString(InOutHandle, "BillBoardScreenSize", ScreenSizeString, "0.1");
-        ScreenSize = stof(ScreenSizeString);
-    }
     // 저장
-    else
+    if (!bInIsLoading)
     {
         InOutHandle["BillBoardSprite"] = Sprite->GetFilePath().ToBaseNameString();
         InOutHandle["BillBoardScreenSizeScaled"] = bScreenSizeScaled ? "true" : "false"; 
         InOutHandle["BillBoardScreenSize"] = to_string(ScreenSize); 
-    }}
+    }
+}
+
+void UBillBoardComponent::Deserialize(const FJsonValue& InHandle)
+{
+    Super::Deserialize(InHandle);
+
+    FString SpritePath;
+    FJsonSerializer::ReadString(InHandle, "BillBoardSprite", SpritePath, "");
+    if (!SpritePath.empty())
+        SetSprite(UAssetManager::GetInstance().LoadTexture(FName(SpritePath)));
+
+    FJsonSerializer::ReadBool(InHandle, "BillBoardScreenSizeScaled", bScreenSizeScaled, false);
+
+    FString ScreenSizeString;
+    FJsonSerializer::ReadString(InHandle, "BillBoardScreenSize", ScreenSizeString, "0.1");
+    ScreenSize = stof(ScreenSizeString);
+}
+
+void UBillBoardComponent::SerializeBinary(FArchive& InOutArchive)
+{
+    Super::SerializeBinary(InOutArchive);
+
+    FName SpritePath = Sprite ? Sprite->GetFilePath() : FName::GetNone();
+    InOutArchive << SpritePath << bScreenSizeScaled << ScreenSize;
+
+    if (InOutArchive.IsLoading() && !SpritePath.IsNone())
+    {
+        SetSprite(UAssetManager::GetInstance().LoadTexture(SpritePath));
+    }
+}
 
 void UBillBoardComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax)
 {
@@ -72,6 +88,9 @@ void UBillBoardComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax)
 		return;
 	}
 
+	// 조상이 움직였다면 여기서 월드 행렬이 다시 계산되며 AABB 캐시도 무효화된다
+	GetWorldTransformMatrix();
+
 	if (bIsAABBCacheDirty)
 	{
 		// 회전 무시하고 위치 기준으로 구형 AABB 반환 (옥트리 업데이트 최소화)
@@ -109,6 +128,7 @@ UTexture* UBillBoardComponent::GetSprite() const
 void UBillBoardComponent::SetSprite(UTexture* InSprite)
 {
     Sprite = InSprite;
+    MarkRenderStateDirty();
 }
 
 UClass* UBillBoardComponent::GetSpecificWidgetClass() const
@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "Component/Public/DecalComponent.h"
+#include "Core/Public/Archive.h"
 #include "Level/Public/Level.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/OBB.h"
@@ -42,52 +43,8 @@ void UDecalComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 
-	if (bInIsLoading)
-	{
-		FString DecalTexturePath;
-		FJsonSerializer::ReadString(InOutHandle, "DecalTexture", DecalTexturePath, "");
-		if (!DecalTexturePath.empty())
-		{
-			SetTexture(UAssetManager::GetInstance().LoadTexture(FName(DecalTexturePath)));
-		}
-		else
-		{
-			SetTexture(UAssetManager::GetInstance().GetTextureCache().begin()->second);
-		}
-		
-		FString FadeTexturePath;
-		FJsonSerializer::ReadString(InOutHandle, "FadeTexture", FadeTexturePath, "Data/Texture/PerlinNoiseFadeTexture.png");
-		SetFadeTexture(UAssetManager::GetInstance().LoadTexture(FName(FadeTexturePath)));
-
-		FString IsPerspectiveString;
-		FJsonSerializer::ReadString(InOutHandle, "DecalIsPerspective", IsPerspectiveString, "true");
-		bIsPerspective = IsPerspectiveString == "true" ? true : false;
-
-		FJsonSerializer::ReadFloat(InOutHandle, "FadeStartDelay", FadeStartDelay, 0.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FadeDuration", FadeDuration, 3.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FadeInStartDelay", FadeInStartDelay, 0.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FadeInDuration", FadeInDuration, 3.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FadeElapsedTime", FadeElapsedTime, 0.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FadeProgress", FadeProgress, 0.0f);
-
-		FString bDestroyOwnerAfterFadeString;
-		FJsonSerializer::ReadString(InOutHandle, "bDestroyOwnerAfterFade", bDestroyOwnerAfterFadeString, "false");
-		bDestroyOwnerAfterFade = bDestroyOwnerAfterFadeString == "true" ? true : false;
-
-		FString bIsFadingString;
-		FJsonSerializer::ReadString(InOutHandle, "bIsFading", bIsFadingString, "false");
-		bIsFading = bIsFadingString == "true" ? true : false;
-
-		FString bIsFadingInString;
-		FJsonSerializer::ReadString(InOutHandle, "bIsFadingIn", bIsFadingInString, "false");
-		bIsFadingIn = bIsFadingInString == "true" ? true : false;
-
-		FString bIsFadePausedString;
-		FJsonSerializer::ReadString(InOutHandle, "bIsFadePaused", bIsFadePausedString, "false");
-		bIsFadePaused = bIsFadePausedString == "true" ? true : false;
-	}
 	// 저장
-	else
+	if (!bInIsLoading)
 	{
 		InOutHandle["DecalTexture"] = DecalTexture->GetFilePath().ToBaseNameString();
 		InOutHandle["FadeTexture"] =  FadeTexture->GetFilePath().ToBaseNameString();
@@ -106,10 +63,63 @@ void UDecalComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void UDecalComponent::Deserialize(const FJsonValue& InHandle)
+{
+	Super::Deserialize(InHandle);
+
+	FString DecalTexturePath;
+	FJsonSerializer::ReadString(InHandle, "DecalTexture", DecalTexturePath, "");
+	if (!DecalTexturePath.empty())
+	{
+		SetTexture(UAssetManager::GetInstance().LoadTexture(FName(DecalTexturePath)));
+	}
+	else
+	{
+		SetTexture(UAssetManager::GetInstance().GetTextureCache().begin()->second);
+	}
+
+	FString FadeTexturePath;
+	FJsonSerializer::ReadString(InHandle, "FadeTexture", FadeTexturePath, "Data/Texture/PerlinNoiseFadeTexture.png");
+	SetFadeTexture(UAssetManager::GetInstance().LoadTexture(FName(FadeTexturePath)));
+
+	FJsonSerializer::ReadBool(InHandle, "DecalIsPerspective", bIsPerspective, true);
+
+	FJsonSerializer::ReadFloat(InHandle, "FadeStartDelay", FadeStartDelay, 0.0f);
+	FJsonSerializer::ReadFloat(InHandle, "FadeDuration", FadeDuration, 3.0f);
+	FJsonSerializer::ReadFloat(InHandle, "FadeInStartDelay", FadeInStartDelay, 0.0f);
+	FJsonSerializer::ReadFloat(InHandle, "FadeInDuration", FadeInDuration, 3.0f);
+	FJsonSerializer::ReadFloat(InHandle, "FadeElapsedTime", FadeElapsedTime, 0.0f);
+	FJsonSerializer::ReadFloat(InHandle, "FadeProgress", FadeProgress, 0.0f);
+
+	FJsonSerializer::ReadBool(InHandle, "bDestroyOwnerAfterFade", bDestroyOwnerAfterFade, false);
+	FJsonSerializer::ReadBool(InHandle, "bIsFading", bIsFading, false);
+	FJsonSerializer::ReadBool(InHandle, "bIsFadingIn", bIsFadingIn, false);
+	FJsonSerializer::ReadBool(InHandle, "bIsFadePaused", bIsFadePaused, false);
+}
+
+void UDecalComponent::SerializeBinary(FArchive& InOutArchive)
+{
+	Super::SerializeBinary(InOutArchive);
+
+	FName DecalTexturePath = DecalTexture ? DecalTexture->GetFilePath() : FName::GetNone();
+	FName FadeTexturePath = FadeTexture ? FadeTexture->GetFilePath() : FName::GetNone();
+	InOutArchive << DecalTexturePath << FadeTexturePath << bIsPerspective;
+	InOutArchive << FadeStartDelay << FadeDuration << FadeInStartDelay << FadeInDuration << FadeElapsedTime << FadeProgress;
+	InOutArchive << bDestroyOwnerAfterFade << bIsFading << bIsFadingIn << bIsFadePaused;
+
+	if (InOutArchive.IsLoading())
+	{
+		UAssetManager& AssetManager = UAssetManager::GetInstance();
+		SetTexture(!DecalTexturePath.IsNone() ? AssetManager.LoadTexture(DecalTexturePath) : AssetManager.GetTextureCache().begin()->second);
+		SetFadeTexture(AssetManager.LoadTexture(!FadeTexturePath.IsNone() ? FadeTexturePath : FName("Data/Texture/PerlinNoiseFadeTexture.png")));
+	}
+}
+
 void UDecalComponent::SetTexture(UTexture* InTexture)
 {
 	if (DecalTexture == InTexture) { return; }
 	DecalTexture = InTexture;
+	MarkRenderStateDirty();
 }
 
 void UDecalComponent::SetFadeTexture(UTexture* InFadeTexture)
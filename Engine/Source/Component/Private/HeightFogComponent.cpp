@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Component/Public/HeightFogComponent.h"
+#include "Core/Public/Archive.h"
 #include "Render/UI/Widget/Public/HeightFogComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -23,18 +24,8 @@ void UHeightFogComponent::TickComponent(float DeltaTime)
 void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle);
-    // 불러오기
-    if (bInIsLoading)
-    {
-        FJsonSerializer::ReadVector(InOutHandle, "FogInScatteringColor", FogInScatteringColor, {0.5f, 0.5f, 0.5f});
-        FJsonSerializer::ReadFloat(InOutHandle, "FogDensity", FogDensity, 0.05f);
-        FJsonSerializer::ReadFloat(InOutHandle, "FogHeightFalloff", FogHeightFalloff, 0.01f);
-        FJsonSerializer::ReadFloat(InOutHandle, "StartDistance", StartDistance, 1.5f);
-        FJsonSerializer::ReadFloat(InOutHandle, "FogCutoffDistance", FogCutoffDistance, 50000.0f);
-        FJsonSerializer::ReadFloat(InOutHandle, "FogMaxOpacity", FogMaxOpacity, 0.98f);
-    }
     // 저장
-    else
+    if (!bInIsLoading)
     {
         InOutHandle["FogInScatteringColor"] = FJsonSerializer::VectorToJson(FogInScatteringColor);
         InOutHandle["FogDensity"] = FogDensity;
@@ -45,6 +36,24 @@ void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
     }
 }
 
+void UHeightFogComponent::Deserialize(const FJsonValue& InHandle)
+{
+    Super::Deserialize(InHandle);
+
+    FJsonSerializer::ReadVector(InHandle, "FogInScatteringColor", FogInScatteringColor, {0.5f, 0.5f, 0.5f});
+    FJsonSerializer::ReadFloat(InHandle, "FogDensity", FogDensity, 0.05f);
+    FJsonSerializer::ReadFloat(InHandle, "FogHeightFalloff", FogHeightFalloff, 0.01f);
+    FJsonSerializer::ReadFloat(InHandle, "StartDistance", StartDistance, 1.5f);
+    FJsonSerializer::ReadFloat(InHandle, "FogCutoffDistance", FogCutoffDistance, 50000.0f);
+    FJsonSerializer::ReadFloat(InHandle, "FogMaxOpacity", FogMaxOpacity, 0.98f);
+}
+
+void UHeightFogComponent::SerializeBinary(FArchive& InOutArchive)
+{
+    Super::SerializeBinary(InOutArchive);
+    InOutArchive << FogInScatteringColor << FogDensity << FogHeightFalloff << StartDistance << FogCutoffDistance << FogMaxOpacity;
+}
+
 UClass* UHeightFogComponent::GetSpecificWidgetClass() const
 {
 	return UHeightFogComponentWidget::StaticClass();
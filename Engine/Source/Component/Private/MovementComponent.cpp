@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "Component/Public/MovementComponent.h"
+#include "Core/Public/Archive.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -59,16 +60,25 @@ void UMovementComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle);
     
-    if (bInIsLoading)
-    {
-        FJsonSerializer::ReadVector(InOutHandle, "Velocity", Velocity, FVector::Zero());
-    }
-    else
+    if (!bInIsLoading)
     {
         InOutHandle["Velocity"] = FJsonSerializer::VectorToJson(Velocity);
     }
 }
 
+void UMovementComponent::Deserialize(const FJsonValue& InHandle)
+{
+    Super::Deserialize(InHandle);
+
+    FJsonSerializer::ReadVector(InHandle, "Velocity", Velocity, FVector::Zero());
+}
+
+void UMovementComponent::SerializeBinary(FArchive& InOutArchive)
+{
+    Super::SerializeBinary(InOutArchive);
+    InOutArchive << Velocity;
+}
+
 UObject* UMovementComponent::Duplicate()
 {
     UMovementComponent* MovementComponent = Cast<UMovementComponent>(Super::Duplicate());
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Component/Public/PrimitiveComponent.h"
 
+#include "Level/Public/Level.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/AABB.h"
 #include "Physics/Public/OBB.h"
@@ -90,36 +91,15 @@ void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax)
 		return;
 	}
 
+	// 조상이 움직였다면 여기서 월드 행렬이 다시 계산되며 AABB 캐시도 무효화된다
+	const FMatrix& WorldTransform = GetWorldTransformMatrix();
+
 	if (bIsAABBCacheDirty)
 	{
 		if (BoundingBox->GetType() == EBoundingVolumeType::AABB)
 		{
 			const FAABB* LocalAABB = static_cast<const FAABB*>(BoundingBox);
-			FVector LocalCorners[8] =
-			{
-				FVector(LocalAABB->Min.X, LocalAABB->Min.Y, LocalAABB->Min.Z), FVector(LocalAABB->Max.X, LocalAABB->Min.Y, LocalAABB->Min.Z),
-				FVector(LocalAABB->Min.X, LocalAABB->Max.Y, LocalAABB->Min.Z), FVector(LocalAABB->Max.X, LocalAABB->Max.Y, LocalAABB->Min.Z),
-				FVector(LocalAABB->Min.X, LocalAABB->Min.Y, LocalAABB->Max.Z), FVector(LocalAABB->Max.X, LocalAABB->Min.Y, LocalAABB->Max.Z),
-				FVector(LocalAABB->Min.X, LocalAABB->Max.Y, LocalAABB->Max.Z), FVector(LocalAABB->Max.X, LocalAABB->Max.Y, LocalAABB->Max.Z)
-			};
-
-			const FMatrix& WorldTransform = GetWorldTransformMatrix();
-			FVector WorldMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
-			FVector WorldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-			for (int32 Idx = 0; Idx < 8; Idx++)
-			{
-				FVector4 WorldCorner = FVector4(LocalCorners[Idx].X, LocalCorners[Idx].Y, LocalCorners[Idx].Z, 1.0f) * WorldTransform;
-				WorldMin.X = min(WorldMin.X, WorldCorner.X);
-				WorldMin.Y = min(WorldMin.Y, WorldCorner.Y);
-				WorldMin.Z = min(WorldMin.Z, WorldCorner.Z);
-				WorldMax.X = max(WorldMax.X, WorldCorner.X);
-				WorldMax.Y = max(WorldMax.Y, WorldCorner.Y);
-				WorldMax.Z = max(WorldMax.Z, WorldCorner.Z);
-			}
-
-			CachedWorldMin = WorldMin;
-			CachedWorldMax = WorldMax;
+			TransformAABB(WorldTransform, LocalAABB->Min, LocalAABB->Max, CachedWorldMin, CachedWorldMax);
 		}
 		else if (BoundingBox->GetType() == EBoundingVolumeType::OBB ||
 			BoundingBox->GetType() == EBoundingVolumeType::SpotLight)
@@ -139,10 +119,40 @@ void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax)
 	OutMax = CachedWorldMax;
 }
 
-void UPrimitiveComponent::MarkAsDirty()
+const FAABB* UPrimitiveComponent::GetLocalAABB() const
+{
+	if (BoundingBox && BoundingBox->GetType() == EBoundingVolumeType::AABB)
+	{
+		return static_cast<const FAABB*>(BoundingBox);
+	}
+	return nullptr;
+}
+
+void UPrimitiveComponent::SetCachedWorldAABB(const FVector& InMin, const FVector& InMax)
+{
+	CachedWorldMin = InMin;
+	CachedWorldMax = InMax;
+	bIsAABBCacheDirty = false;
+}
+
+void UPrimitiveComponent::OnUpdateTransform()
 {
 	bIsAABBCacheDirty = true;
-	Super::MarkAsDirty();
+
+	// 레벨에 등록된 경우에만 경계 갱신을 예약한다 (부모 이동으로 갱신된 자식 컴포넌트도 포함)
+	// 정적 배치에 합쳐진 경우는 셀에서 빼도록 예약한다
+	if ((PrimitiveBoundsIndex >= 0 || bIsStaticBatched) && GWorld && GWorld->GetLevel())
+	{
+		GWorld->GetLevel()->UpdatePrimitiveInOctree(this);
+	}
+}
+
+void UPrimitiveComponent::MarkRenderStateDirty()
+{
+	if ((RenderProxyIndex >= 0 || bIsStaticBatched) && GWorld && GWorld->GetLevel())
+	{
+		GWorld->GetLevel()->UpdatePrimitiveRenderState(this);
+	}
 }
 
 
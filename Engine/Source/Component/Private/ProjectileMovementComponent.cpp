@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "Component/Public/ProjectileMovementComponent.h"
+#include "Core/Public/Archive.h"
 #include "Render/UI/Widget/Public/ProjectileMovementComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -48,17 +49,7 @@ void UProjectileMovementComponent::Serialize(const bool bInIsLoading, JSON& InOu
 {
     Super::Serialize(bInIsLoading, InOutHandle);
     
-    if (bInIsLoading)
-    {
-        FJsonSerializer::ReadFloat(InOutHandle, "InitialSpeed", InitialSpeed, 0);
-        FJsonSerializer::ReadFloat(InOutHandle, "MaxSpeed", MaxSpeed, 0);
-        FJsonSerializer::ReadFloat(InOutHandle, "GravityScale", GravityScale, 0);
-
-        FString bRotationFollowsVelocityString;
-        FJsonSerializer::ReadString(InOutHandle, "bRotationFollowsVelocity", bRotationFollowsVelocityString, "false");
-        bRotationFollowsVelocity = bRotationFollowsVelocityString == "true" ? true : false;
-    }
-    else
+    if (!bInIsLoading)
     {
         InOutHandle["InitialSpeed"] = InitialSpeed;
         InOutHandle["MaxSpeed"] = MaxSpeed;
@@ -67,6 +58,22 @@ void UProjectileMovementComponent::Serialize(const bool bInIsLoading, JSON& InOu
     }
 }
 
+void UProjectileMovementComponent::Deserialize(const FJsonValue& InHandle)
+{
+    Super::Deserialize(InHandle);
+
+    FJsonSerializer::ReadFloat(InHandle, "InitialSpeed", InitialSpeed, 0);
+    FJsonSerializer::ReadFloat(InHandle, "MaxSpeed", MaxSpeed, 0);
+    FJsonSerializer::ReadFloat(InHandle, "GravityScale", GravityScale, 0);
+    FJsonSerializer::ReadBool(InHandle, "bRotationFollowsVelocity", bRotationFollowsVelocity, false);
+}
+
+void UProjectileMovementComponent::SerializeBinary(FArchive& InOutArchive)
+{
+    Super::SerializeBinary(InOutArchive);
+    InOutArchive << InitialSpeed << MaxSpeed << GravityScale << bRotationFollowsVelocity;
+}
+
 UObject* UProjectileMovementComponent::Duplicate()
 {
     UProjectileMovementComponent* ProjectileMovementComponent = Cast<UProjectileMovementComponent>(Super::Duplicate());
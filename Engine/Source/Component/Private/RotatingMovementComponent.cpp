@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "Component/Public/RotatingMovementComponent.h"
+#include "Core/Public/Archive.h"
 #include "Render/UI/Widget/Public/RotatingMovementComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -31,16 +32,7 @@ void URotatingMovementComponent::Serialize(const bool bInIsLoading, JSON& InOutH
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 
-	if (bInIsLoading)
-	{
-		FJsonSerializer::ReadVector(InOutHandle, "RotationRate", RotationRate, FVector::ZeroVector());
-		FJsonSerializer::ReadVector(InOutHandle, "PivotTranslation", PivotTranslation, FVector::ZeroVector());
-
-		FString bRotationInLocalSpaceString;
-		FJsonSerializer::ReadString(InOutHandle, "bRotationInLocalSpace", bRotationInLocalSpaceString, "false");
-		bRotationInLocalSpace = bRotationInLocalSpaceString == "true" ? true : false;
-	}
-	else
+	if (!bInIsLoading)
 	{
 		InOutHandle["RotationRate"] = FJsonSerializer::VectorToJson(RotationRate);
 		InOutHandle["PivotTranslation"] = FJsonSerializer::VectorToJson(PivotTranslation);
@@ -48,6 +40,21 @@ void URotatingMovementComponent::Serialize(const bool bInIsLoading, JSON& InOutH
 	}
 }
 
+void URotatingMovementComponent::Deserialize(const FJsonValue& InHandle)
+{
+	Super::Deserialize(InHandle);
+
+	FJsonSerializer::ReadVector(InHandle, "RotationRate", RotationRate, FVector::ZeroVector());
+	FJsonSerializer::ReadVector(InHandle, "PivotTranslation", PivotTranslation, FVector::ZeroVector());
+	FJsonSerializer::ReadBool(InHandle, "bRotationInLocalSpace", bRotationInLocalSpace, false);
+}
+
+void URotatingMovementComponent::SerializeBinary(FArchive& InOutArchive)
+{
+	Super::SerializeBinary(InOutArchive);
+	InOutArchive << RotationRate << PivotTranslation << bRotationInLocalSpace;
+}
+
 UObject* URotatingMovementComponent::Duplicate()
 {
 	URotatingMovementComponent* RotatingMovementComponent = Cast<URotatingMovementComponent>(Super::Duplicate());
@@ -1,17 +1,21 @@
 #include "pch.h"
 #include "Component/Public/SceneComponent.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#include "Optimization/Public/TransformHierarchy.h"
 #include "Utility/Public/JsonSerializer.h"
 
-#include "Component/Public/PrimitiveComponent.h"
-#include "Level/Public/Level.h"
-
 #include <json.hpp>
 
 IMPLEMENT_CLASS(USceneComponent, UActorComponent)
 
 USceneComponent::USceneComponent()
 {
+	TransformIndex = FTransformHierarchy::GetInstance().Add(this);
+}
+
+USceneComponent::~USceneComponent()
+{
+	FTransformHierarchy::GetInstance().Remove(TransformIndex);
 }
 
 void USceneComponent::BeginPlay()
@@ -27,18 +31,8 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 
-	// 불러오기
-	if (bInIsLoading)
-	{
-		FJsonSerializer::ReadVector(InOutHandle, "Location", RelativeLocation, FVector::ZeroVector());
-		FVector RotationEuler;
-		FJsonSerializer::ReadVector(InOutHandle, "Rotation", RotationEuler, FVector::ZeroVector());
-		RelativeRotation = FQuaternion::FromEuler(RotationEuler);
-
-		FJsonSerializer::ReadVector(InOutHandle, "Scale", RelativeScale3D, FVector::OneVector());
-	}
 	// 저장
-	else
+	if (!bInIsLoading)
 	{
 		InOutHandle["Location"] = FJsonSerializer::VectorToJson(RelativeLocation);
 		InOutHandle["Rotation"] = FJsonSerializer::VectorToJson(RelativeRotation.ToEuler());
@@ -46,9 +40,30 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void USceneComponent::Deserialize(const FJsonValue& InHandle)
+{
+	Super::Deserialize(InHandle);
+
+	FJsonSerializer::ReadVector(InHandle, "Location", RelativeLocation, FVector::ZeroVector());
+	FVector RotationEuler;
+	FJsonSerializer::ReadVector(InHandle, "Rotation", RotationEuler, FVector::ZeroVector());
+	RelativeRotation = FQuaternion::FromEuler(RotationEuler);
+
+	FJsonSerializer::ReadVector(InHandle, "Scale", RelativeScale3D, FVector::OneVector());
+
+	MarkAsDirty();
+}
+
 void USceneComponent::AttachToComponent(USceneComponent* Parent, bool bRemainTransform)
 {
 	if (!Parent || Parent == this || GetOwner() != Parent->GetOwner()) { return; }
+
+	// 자신의 자손 아래로 붙이면 계층에 순환이 생긴다
+	for (const USceneComponent* Ancestor = Parent->AttachParent; Ancestor; Ancestor = Ancestor->AttachParent)
+	{
+		if (Ancestor == this) { return; }
+	}
+
 	if (AttachParent)
 	{
 		AttachParent->DetachChild(this);
@@ -57,7 +72,7 @@ void USceneComponent::AttachToComponent(USceneComponent* Parent, bool bRemainTra
 	AttachParent = Parent;
 	Parent->AttachChildren.push_back(this);
 
-	MarkAsDirty();
+	FTransformHierarchy::GetInstance().SetParent(TransformIndex, Parent->TransformIndex);
 }
 
 void USceneComponent::DetachFromComponent()
@@ -66,6 +81,7 @@ void USceneComponent::DetachFromComponent()
 	{
 		AttachParent->DetachChild(this);
 		AttachParent = nullptr;
+		FTransformHierarchy::GetInstance().SetParent(TransformIndex, -1);
 	}
 }
 
@@ -91,68 +107,41 @@ void USceneComponent::DuplicateSubObjects(UObject* DuplicatedObject)
 
 void USceneComponent::MarkAsDirty()
 {
-	bIsTransformDirty = true;
-	bIsTransformDirtyInverse = true;
-
-	for (USceneComponent* Child : AttachChildren)
-	{
-		Child->MarkAsDirty();
-	}
+	FTransformHierarchy::GetInstance().MarkDirty(TransformIndex);
 }
 
 void USceneComponent::SetRelativeLocation(const FVector& Location)
 {
 	RelativeLocation = Location;
 	MarkAsDirty();
-
-	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(this))
-	{
-		GWorld->GetLevel()->UpdatePrimitiveInOctree(PrimitiveComponent);
-	}
 }
 
 void USceneComponent::SetRelativeRotation(const FQuaternion& Rotation)
 {
 	RelativeRotation = Rotation;
 	MarkAsDirty();
-
-	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(this))
-	{
-		GWorld->GetLevel()->UpdatePrimitiveInOctree(PrimitiveComponent);
-	}
 }
 
 void USceneComponent::SetRelativeScale3D(const FVector& Scale)
 {
 	RelativeScale3D = Scale;
 	MarkAsDirty();
-
-	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(this))
-	{
-		GWorld->GetLevel()->UpdatePrimitiveInOctree(PrimitiveComponent);
-	}
 }
 
 const FMatrix& USceneComponent::GetWorldTransformMatrix() const
 {
-	if (bIsTransformDirty)
-	{
-		WorldTransformMatrix = FMatrix::GetModelMatrix(RelativeLocation, RelativeRotation, RelativeScale3D);
-
-		if (AttachParent)
-		{
-			WorldTransformMatrix *= AttachParent->GetWorldTransformMatrix();
-		}
-
-		bIsTransformDirty = false;
-	}
-
+	FTransformHierarchy::GetInstance().Resolve(TransformIndex);
 	return WorldTransformMatrix;
 }
 
 const FMatrix& USceneComponent::GetWorldTransformMatrixInverse() const
 {
-	if (bIsTransformDirtyInverse)
+	FTransformHierarchy& TransformHierarchy = FTransformHierarchy::GetInstance();
+	TransformHierarchy.Resolve(TransformIndex);
+
+	// 부모가 움직여도 자신의 월드 행렬이 다시 계산되며 버전이 바뀐다
+	const uint32 WorldVersion = TransformHierarchy.GetWorldVersion(TransformIndex);
+	if (WorldTransformInverseVersion != WorldVersion)
 	{
 		WorldTransformMatrixInverse = FMatrix::Identity();
 
@@ -163,7 +152,7 @@ const FMatrix& USceneComponent::GetWorldTransformMatrixInverse() const
 
 		WorldTransformMatrixInverse *= FMatrix::GetModelMatrixInverse(RelativeLocation, RelativeRotation, RelativeScale3D);
 
-		bIsTransformDirtyInverse = false;
+		WorldTransformInverseVersion = WorldVersion;
 	}
 
 	return WorldTransformMatrixInverse;
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Component/Public/UUIDTextComponent.h"
+#include "Core/Public/Archive.h"
 #include "Editor/Public/Editor.h"
 #include "Actor/Public/Actor.h"
 
@@ -49,7 +50,19 @@ void UUUIDTextComponent::UpdateRotationMatrix(const FVector& InCameraForward)
 void UUUIDTextComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	UTextComponent::Serialize(bInIsLoading, InOutHandle);
-	if (bInIsLoading)
+}
+
+void UUUIDTextComponent::Deserialize(const FJsonValue& InHandle)
+{
+	UTextComponent::Deserialize(InHandle);
+	SetOffset(5);
+}
+
+void UUUIDTextComponent::SerializeBinary(FArchive& InOutArchive)
+{
+	UTextComponent::SerializeBinary(InOutArchive);
+
+	if (InOutArchive.IsLoading())
 	{
 		SetOffset(5);
 	}
@@ -14,6 +14,8 @@ public:
 	UActorComponent();
 	~UActorComponent() override;
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	virtual void Deserialize(const FJsonValue& InHandle) override;
+	virtual void SerializeBinary(FArchive& InOutArchive) override;
 	/*virtual void Render(const URenderer& Renderer) const
 	{
 
@@ -13,8 +13,12 @@ public:
 	virtual ~UBillBoardComponent() override;
 
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	virtual void Deserialize(const FJsonValue& InHandle) override;
+	virtual void SerializeBinary(FArchive& InOutArchive) override;
 
 	void GetWorldAABB(FVector& OutMin, FVector& OutMax) override;
+	/** @brief 회전을 무시한 구형 경계를 쓰므로 일괄 변환 대상이 아님 */
+	const FAABB* GetLocalAABB() const override { return nullptr; }
 	void FaceCamera(const FVector& CameraForward);
 
 	UTexture* GetSprite() const;
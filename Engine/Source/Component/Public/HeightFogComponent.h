@@ -11,6 +11,8 @@ public:
 
     virtual void TickComponent(float DeltaTime) override;
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    virtual void Deserialize(const FJsonValue& InHandle) override;
+    virtual void SerializeBinary(FArchive& InOutArchive) override;
 
     UClass* GetSpecificWidgetClass() const override;
 
@@ -31,5 +31,7 @@ protected:
 
 public:
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void Deserialize(const FJsonValue& InHandle) override;
+    void SerializeBinary(FArchive& InOutArchive) override;
     UObject* Duplicate() override;
 };
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Component/Public/SceneComponent.h"
 #include "Physics/Public/BoundingVolume.h"
+#include "Global/Octree.h"
 
 UCLASS()
 class UPrimitiveComponent : public USceneComponent
@@ -29,7 +30,15 @@ public:
 	//void Render(const URenderer& Renderer) const override;
 
 	bool IsVisible() const { return bVisible; }
-	void SetVisibility(bool bVisibility) { bVisible = bVisibility; }
+	void SetVisibility(bool bVisibility)
+	{
+		bVisible = bVisibility;
+		// 정적 배치 셀에 합쳐진 경우 셀에서 빠져야 숨겨진다
+		if (bIsStaticBatched)
+		{
+			MarkRenderStateDirty();
+		}
+	}
 	
 	bool CanPick() const { return bCanPick; }
 	void SetCanPick(bool bInCanPick) { bCanPick = bInCanPick; }
@@ -43,16 +52,35 @@ public:
 	void GetCachedWorldAABB(FVector& OutMin, FVector& OutMax) const { OutMin = CachedWorldMin; OutMax = CachedWorldMax; }
 	bool IsAABBCacheDirty() const { return bIsAABBCacheDirty; }
 
-	virtual void MarkAsDirty() override;
+	/**
+	 * @brief 월드 AABB를 로컬 AABB와 월드 행렬만으로 구할 수 있으면 로컬 AABB, 아니면 nullptr
+	 * FPrimitiveBoundsSoA가 이 경우의 프리미티브를 모아 한 번에 변환하고 SetCachedWorldAABB로 캐시를 채운다.
+	 */
+	virtual const FAABB* GetLocalAABB() const;
+	void SetCachedWorldAABB(const FVector& InMin, const FVector& InMax);
 
 	// 데칼에 덮일 수 있는가
 	bool bReceivesDecals = true;
 
-	// 다른 곳에서 사용할 인덱스
-	mutable int32 CachedAABBIndex = -1;
-	mutable uint32 CachedFrame = 0;
+	/** @brief 레벨 StaticOctree 안에서의 위치, FOctree가 직접 갱신하며 복제 시 복사하지 않음 */
+	FOctreeElementId OctreeElementId;
+
+	/** @brief 레벨 PrimitiveBounds(SoA 월드 AABB 배열) 안의 슬롯 인덱스, 등록되지 않았으면 -1 */
+	int32 PrimitiveBoundsIndex = -1;
+
+	/** @brief 레벨 RenderProxies 안의 슬롯 인덱스, 가시성 비트셋의 비트 위치이기도 함, 등록되지 않았으면 -1 */
+	int32 RenderProxyIndex = -1;
+
+	/** @brief 정적 배치 셀에 합쳐져 컬링 구조에 없는 상태, ULevel이 관리하며 복제 시 복사하지 않음 */
+	bool bIsStaticBatched = false;
+
+	/** @brief 메시, 머티리얼, 텍스처처럼 렌더 정렬 키에 들어가는 상태가 바뀌면 호출, 레벨이 다음 컬링 전에 키를 다시 만든다 */
+	void MarkRenderStateDirty();
 
 protected:
+	/** @brief 월드 행렬이 바뀌면 AABB 캐시를 무효화하고, 레벨에 등록된 경우 옥트리 재배치를 예약 */
+	void OnUpdateTransform() override;
+
 	const TArray<FNormalVertex>* Vertices = nullptr;
 	const TArray<uint32>* Indices = nullptr;
 
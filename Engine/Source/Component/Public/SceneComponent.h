@@ -12,11 +12,14 @@ class USceneComponent : public UActorComponent
 
 public:
 	USceneComponent();
+	~USceneComponent() override;
 
 	void BeginPlay() override;
 	    void TickComponent(float DeltaTime) override;
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void Deserialize(const FJsonValue& InHandle) override;
 	
+	/** @brief 월드 행렬 재계산을 FTransformHierarchy에 예약, 자식은 다음 갱신에서 부모를 따라 다시 계산된다 */
 	virtual void MarkAsDirty();
 
 	void SetRelativeLocation(const FVector& Location);
@@ -43,11 +46,20 @@ public:
     void SetWorldRotation(const FQuaternion& NewRotation);
     void SetWorldScale3D(const FVector& NewScale);
 
+protected:
+	/** @brief FTransformHierarchy가 이 컴포넌트의 월드 행렬을 다시 계산한 직후 호출 (부모 이동으로 인한 갱신 포함) */
+	virtual void OnUpdateTransform() {}
+
 private:
-	mutable bool bIsTransformDirty = true;
-	mutable bool bIsTransformDirtyInverse = true;
-	mutable FMatrix WorldTransformMatrix;
+	friend class FTransformHierarchy;
+
+	/** @brief FTransformHierarchy 슬롯 인덱스, 계층 깊이 순 재정렬 시 시스템이 갱신한다 */
+	int32 TransformIndex = -1;
+	/** @brief FTransformHierarchy가 계산한 월드 행렬의 사본, 슬롯 배열이 재배치되어도 반환한 참조가 유지된다 */
+	FMatrix WorldTransformMatrix;
 	mutable FMatrix WorldTransformMatrixInverse;
+	/** @brief 역행렬을 계산할 때의 월드 행렬 버전, 버전은 1부터 시작하므로 0이면 아직 계산 전 */
+	mutable uint32 WorldTransformInverseVersion = 0;
 
 	FVector RelativeLocation = FVector{ 0,0,0.f };
 	FQuaternion RelativeRotation = FQuaternion::Identity();
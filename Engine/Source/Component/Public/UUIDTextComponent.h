@@ -21,6 +21,8 @@ public:
 
 	FMatrix GetRTMatrix() const override { return RTMatrix; }
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void Deserialize(const FJsonValue& InHandle) override;
+	void SerializeBinary(FArchive& InOutArchive) override;
 
 	UClass* GetSpecificWidgetClass() const override;
 private:
@@ -1,3 +1,15 @@
 #include "pch.h"
 
 #include "Core/Public/Archive.h"
+#include "Core/Public/Name.h"
+
+void FArchive::SerializeName(FName& Value)
+{
+	FString String = IsLoading() ? FString() : Value.ToString();
+	*this << String;
+
+	if (IsLoading())
+	{
+		Value = String.empty() ? FName::GetNone() : FName(String);
+	}
+}
@@ -4,30 +4,31 @@
 
 using std::stringstream;
 
+// 상수 초기화이므로 정적 초기화 순서와 관계없이 첫 등록 전에 true다
+bool UClass::bIsClassTreeDirty = true;
+
 void UClass::SignUpClass(UClass* InClass)
 {
 	if (InClass)
 	{
-		for (UClass* Class : GetAllClasses())
+		// StaticClass가 호출될 때마다 들어오므로 이미 등록된 클래스는 맵에서 바로 걸러낸다
+		auto [Iter, bIsInserted] = GetClassMap().emplace(InClass->GetName().GetComparisonIndex(), InClass);
+		if (!bIsInserted)
 		{
-			if (Class == InClass) return;
+			return;
 		}
+
 		GetAllClasses().emplace_back(InClass);
+		bIsClassTreeDirty = true;
 		UE_LOG("UClass: Class registered: %s (Total: %llu)", InClass->GetName().ToString().data(), GetAllClasses().size());
 	}
 }
 
 UClass* UClass::FindClass(const FName& InClassName)
 {
-	for (UClass* Class : GetAllClasses())
-	{
-		if (Class && Class->GetName() == InClassName)
-		{
-			return Class;
-		}
-	}
-
-	return nullptr;
+	const TMap<int32, UClass*>& ClassMap = GetClassMap();
+	auto Iter = ClassMap.find(InClassName.GetComparisonIndex());
+	return Iter != ClassMap.end() ? Iter->second : nullptr;
 }
 
 TArray<UClass*> UClass::FindClasses(UClass* SuperClass)
@@ -51,50 +52,69 @@ TArray<UClass*>& UClass::GetAllClasses()
 	return AllClasses;
 }
 
-/**
- * @brief UClass Constructor
- * @param InName Class 이름
- * @param InSuperClass Parent Class
- * @param InClassSize Class Size
- * @param InConstructor 생성자 함수 포인터
- */
-UClass::UClass(const FName& InName, UClass* InSuperClass, size_t InClassSize, ClassConstructorType InConstructor, bool InIsAbstract)
-	: ClassName(InName), SuperClass(InSuperClass), ClassSize(InClassSize), Constructor(InConstructor), bIsAbstract(InIsAbstract)
+TMap<int32, UClass*>& UClass::GetClassMap()
 {
-	UE_LOG("UClass: 클래스 등록: %s", ClassName.ToString().data());
+	static TMap<int32, UClass*> ClassMap;
+	return ClassMap;
 }
 
-/**
- * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인
- * @param InClass 확인할 클래스
- * @return 하위 클래스이거나 같은 클래스면 true
- */
-bool UClass::IsChildOf(UClass* InClass) const
+void UClass::BuildClassTree()
 {
-	if (!InClass)
+	TMap<UClass*, TArray<UClass*>> Children;
+	TArray<UClass*> Roots;
+	for (UClass* Class : GetAllClasses())
 	{
-		return false;
+		if (Class->SuperClass)
+		{
+			Children[Class->SuperClass].push_back(Class);
+		}
+		else
+		{
+			Roots.push_back(Class);
+		}
 	}
 
-	// 자기 자신과 같은 클래스인 경우
-	if (this == InClass)
+	uint32 NextIndex = 0;
+	for (UClass* Root : Roots)
 	{
-		return true;
+		NextIndex = NumberClassTree(Root, Children, NextIndex);
 	}
 
-	// 부모 클래스들을 거슬러 올라가면서 확인
-	const UClass* CurrentClass = this;
-	while (CurrentClass)
+	bIsClassTreeDirty = false;
+}
+
+/**
+ * @brief InClass와 자손에게 InNextIndex부터 전위 번호를 매긴다
+ * @return 다음에 사용할 번호
+ */
+uint32 UClass::NumberClassTree(UClass* InClass, const TMap<UClass*, TArray<UClass*>>& InChildren, uint32 InNextIndex)
+{
+	InClass->TreeIndex = InNextIndex++;
+
+	auto Iter = InChildren.find(InClass);
+	if (Iter != InChildren.end())
 	{
-		if (CurrentClass->ClassName == InClass->ClassName)
+		for (UClass* Child : Iter->second)
 		{
-			return true;
+			InNextIndex = NumberClassTree(Child, InChildren, InNextIndex);
 		}
-
-		CurrentClass = CurrentClass->SuperClass;
 	}
 
-	return false;
+	InClass->TreeLastIndex = InNextIndex - 1;
+	return InNextIndex;
+}
+
+/**
+ * @brief UClass Constructor
+ * @param InName Class 이름
+ * @param InSuperClass Parent Class
+ * @param InClassSize Class Size
+ * @param InConstructor 생성자 함수 포인터
+ */
+UClass::UClass(const FName& InName, UClass* InSuperClass, size_t InClassSize, ClassConstructorType InConstructor, bool InIsAbstract)
+	: ClassName(InName), SuperClass(InSuperClass), ClassSize(InClassSize), Constructor(InConstructor), bIsAbstract(InIsAbstract)
+{
+	UE_LOG("UClass: 클래스 등록: %s", ClassName.ToString().data());
 }
 
 /**
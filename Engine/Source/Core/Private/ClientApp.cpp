@@ -3,6 +3,7 @@
 
 #include "Editor/Public/Editor.h"
 #include "Core/Public/AppWindow.h"
+#include "Core/Public/JobSystem.h"
 #include "Manager/Input/Public/InputManager.h"
 
 #include "Manager/Asset/Public/AssetManager.h"
@@ -85,6 +86,12 @@ int FClientApp::InitializeSystem() const
 	// Initialize By Get Instance
 	UTimeManager::GetInstance();
 	UInputManager::GetInstance();
+
+	// 정적 초기화에서 모든 클래스 등록이 끝났으므로 워커가 Cast를 쓰기 전에 클래스 트리 번호를 매긴다
+	UClass::BuildClassTree();
+
+	// 메인 스레드를 제외한 하드웨어 스레드 수만큼 워커 생성
+	FJobSystem::GetInstance().Initialize(FJobSystem::GetDefaultWorkerCount());
 	
 	auto& Renderer = URenderer::GetInstance();
 	Renderer.Init(Window->GetWindowHandle());
@@ -196,4 +203,5 @@ void FClientApp::ShutdownSystem() const
 	UUIManager::GetInstance().Shutdown();
 	UAssetManager::GetInstance().Release();
 	URenderer::GetInstance().Release();
+	FJobSystem::GetInstance().Shutdown();
 }
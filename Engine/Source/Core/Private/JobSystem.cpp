@@ -0,0 +1,221 @@
+#include "pch.h"
+#include "Core/Public/JobSystem.h"
+
+namespace
+{
+	// 워커 스레드가 어느 작업 시스템의 몇 번째 큐를 소유하는지 기록 (벤치마크처럼 인스턴스가 여러 개일 수 있음)
+	thread_local const FJobSystem* GCurrentJobSystem = nullptr;
+	thread_local int32 GCurrentQueueIndex = -1;
+}
+
+FJobSystem& FJobSystem::GetInstance()
+{
+	static FJobSystem Instance;
+	return Instance;
+}
+
+FJobSystem::FJobSystem(uint32 InWorkerCount)
+{
+	Initialize(InWorkerCount);
+}
+
+FJobSystem::~FJobSystem()
+{
+	Shutdown();
+}
+
+uint32 FJobSystem::GetDefaultWorkerCount()
+{
+	const uint32 HardwareThreadCount = std::thread::hardware_concurrency();
+	return HardwareThreadCount > 1 ? HardwareThreadCount - 1 : 0;
+}
+
+void FJobSystem::Initialize(uint32 InWorkerCount)
+{
+	Shutdown();
+
+	// 워커가 없어도 Submit한 작업은 Wait를 호출한 스레드가 실행할 수 있도록 큐는 최소 1개 유지
+	Queues.clear();
+	const uint32 QueueCount = std::max(1u, InWorkerCount);
+	for (uint32 QueueIndex = 0; QueueIndex < QueueCount; ++QueueIndex)
+	{
+		Queues.push_back(std::make_unique<FWorkerQueue>());
+	}
+
+	bIsRunning.store(true);
+	Workers.reserve(InWorkerCount);
+	for (uint32 WorkerIndex = 0; WorkerIndex < InWorkerCount; ++WorkerIndex)
+	{
+		Workers.emplace_back(&FJobSystem::WorkerLoop, this, static_cast<int32>(WorkerIndex));
+	}
+}
+
+void FJobSystem::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(SleepMutex);
+		bIsRunning.store(false);
+	}
+	SleepCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.clear();
+}
+
+void FJobSystem::Submit(FJobFunction InJob, FJobCounter& InCounter)
+{
+	InCounter.Remaining.fetch_add(1, std::memory_order_relaxed);
+
+	// 워커가 제출하면 자기 큐에 넣어 캐시를 유지하고, 외부 스레드는 큐를 돌아가며 분배한다
+	int32 QueueIndex = GetCurrentQueueIndex();
+	if (QueueIndex < 0)
+	{
+		QueueIndex = static_cast<int32>(NextQueue.fetch_add(1, std::memory_order_relaxed) % Queues.size());
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(Queues[QueueIndex]->Mutex);
+		Queues[QueueIndex]->Jobs.push_back({ std::move(InJob), &InCounter });
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(SleepMutex);
+		PendingJobCount.fetch_add(1, std::memory_order_relaxed);
+	}
+	SleepCondition.notify_one();
+}
+
+void FJobSystem::Wait(FJobCounter& InCounter)
+{
+	const int32 OwnQueue = GetCurrentQueueIndex();
+	while (!InCounter.IsDone())
+	{
+		if (!TryExecuteJob(OwnQueue))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FJobSystem::ParallelFor(int32 InCount, const TFunction<void(int32)>& InBody, int32 InBatchSize)
+{
+	if (InCount <= 0)
+	{
+		return;
+	}
+
+	InBatchSize = std::max(1, InBatchSize);
+
+	FJobCounter Counter;
+	for (int32 First = 0; First < InCount; First += InBatchSize)
+	{
+		const int32 Last = std::min(InCount, First + InBatchSize);
+		Submit([&InBody, First, Last]()
+		{
+			for (int32 Index = First; Index < Last; ++Index)
+			{
+				InBody(Index);
+			}
+		}, Counter);
+	}
+
+	Wait(Counter);
+}
+
+void FJobSystem::WorkerLoop(int32 InWorkerIndex)
+{
+	GCurrentJobSystem = this;
+	GCurrentQueueIndex = InWorkerIndex;
+
+	while (true)
+	{
+		if (TryExecuteJob(InWorkerIndex))
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> Lock(SleepMutex);
+		SleepCondition.wait(Lock, [this]()
+		{
+			return !bIsRunning.load() || PendingJobCount.load(std::memory_order_relaxed) > 0;
+		});
+
+		if (!bIsRunning.load())
+		{
+			break;
+		}
+	}
+
+	GCurrentJobSystem = nullptr;
+	GCurrentQueueIndex = -1;
+}
+
+bool FJobSystem::TryExecuteJob(int32 InOwnQueue)
+{
+	FJob Job;
+	bool bFound = InOwnQueue >= 0 && PopBack(InOwnQueue, Job);
+
+	if (!bFound)
+	{
+		// 자기 큐 다음 번호부터 돌아가며 훔쳐서 같은 큐에 도둑이 몰리지 않게 한다
+		const int32 QueueCount = static_cast<int32>(Queues.size());
+		const int32 Start = InOwnQueue >= 0 ? InOwnQueue + 1 : 0;
+		for (int32 Offset = 0; Offset < QueueCount && !bFound; ++Offset)
+		{
+			const int32 QueueIndex = (Start + Offset) % QueueCount;
+			if (QueueIndex != InOwnQueue)
+			{
+				bFound = StealFront(QueueIndex, Job);
+			}
+		}
+	}
+
+	if (!bFound)
+	{
+		return false;
+	}
+
+	PendingJobCount.fetch_sub(1, std::memory_order_relaxed);
+	Job.Function();
+	Job.Counter->Remaining.fetch_sub(1, std::memory_order_release);
+	return true;
+}
+
+bool FJobSystem::PopBack(int32 InQueueIndex, FJob& OutJob)
+{
+	FWorkerQueue& Queue = *Queues[InQueueIndex];
+	std::lock_guard<std::mutex> Lock(Queue.Mutex);
+	if (Queue.Jobs.empty())
+	{
+		return false;
+	}
+
+	OutJob = std::move(Queue.Jobs.back());
+	Queue.Jobs.pop_back();
+	return true;
+}
+
+bool FJobSystem::StealFront(int32 InQueueIndex, FJob& OutJob)
+{
+	FWorkerQueue& Queue = *Queues[InQueueIndex];
+	std::lock_guard<std::mutex> Lock(Queue.Mutex);
+	if (Queue.Jobs.empty())
+	{
+		return false;
+	}
+
+	OutJob = std::move(Queue.Jobs.front());
+	Queue.Jobs.pop_front();
+	return true;
+}
+
+int32 FJobSystem::GetCurrentQueueIndex() const
+{
+	return GCurrentJobSystem == this ? GCurrentQueueIndex : -1;
+}
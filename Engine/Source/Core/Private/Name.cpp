@@ -1,13 +1,20 @@
 #include "pch.h"
 #include "Core/Public/Name.h"
-#include <algorithm> // for std::transform
-#include <cctype>    // for std::tolower
+#include <charconv>  // for std::to_chars
+
+namespace
+{
+    char ToLowerAscii(char C)
+    {
+        return (C >= 'A' && C <= 'Z') ? static_cast<char>(C + ('a' - 'A')) : C;
+    }
+}
 
 FName::FName() : DisplayIndex(0), ComparisonIndex(0), Number(-1)
 {
 }
 
-FName::FName(const FString& Str)
+FName::FName(std::string_view Str)
 {
     TPair<int32, int32> Indices = FNameTable::GetInstance().FindOrAddName(Str);
     ComparisonIndex = Indices.first;
@@ -15,11 +22,13 @@ FName::FName(const FString& Str)
     Number = -1;
 }
 
-FName::FName(const char* Str) : FName(FString(Str)) { }
+FName::FName(const FString& Str) : FName(std::string_view(Str)) { }
+
+FName::FName(const char* Str) : FName(Str ? std::string_view(Str) : std::string_view()) { }
 
 /**
 * @brief NameTable에서 UniqueName을 만들 때 사용하는 생성자
-* 
+*
 */
 FName::FName(int32 InDisplayIndex, int32 InComparisonIndex, int32 InNumber)
     : DisplayIndex(InDisplayIndex), ComparisonIndex(InComparisonIndex), Number(InNumber) {}
@@ -44,106 +53,275 @@ int32 FName::Compare(const FName& Other) const
     return 0;
 }
 
+/**
+* @brief "Base_Number" 형태의 문자열, 결과 문자열 한 번만 할당한다
+*/
 FString FName::ToString() const
 {
-    FString BaseName = FNameTable::GetInstance().GetDisplayString(DisplayIndex);
-    if (Number >= 0)
+    const std::string_view BaseName = ToBaseNameView();
+    if (Number < 0)
     {
-        return BaseName + "_" + to_string(Number);
+        return FString(BaseName);
     }
-    return BaseName;
+
+    char NumberBuffer[16];
+    const std::to_chars_result Result = std::to_chars(NumberBuffer, NumberBuffer + sizeof(NumberBuffer), Number);
+
+    FString Name;
+    Name.reserve(BaseName.size() + 1 + (Result.ptr - NumberBuffer));
+    Name.append(BaseName);
+    Name.push_back('_');
+    Name.append(NumberBuffer, Result.ptr);
+    return Name;
 }
 
 FString FName::ToBaseNameString() const
 {
-    return FNameTable::GetInstance().GetDisplayString(DisplayIndex);
+    return FString(ToBaseNameView());
+}
+
+std::string_view FName::ToBaseNameView() const
+{
+    return FNameTable::GetInstance().GetDisplayView(DisplayIndex);
 }
 
 FName FName::GetNone()
 {
     return None;
 }
-const FName FName::None(0, 0, -1); 
+const FName FName::None(0, 0, -1);
+
+// FNameTable::FNamePool
+FNameTable::FNamePool::FNamePool(bool bInIgnoreCase)
+    : bIgnoreCase(bInIgnoreCase)
+{
+    for (FShard& Shard : Shards)
+    {
+        Shard.Slots.resize(64);
+    }
+}
+
+FNameTable::FNamePool::~FNamePool()
+{
+    for (std::atomic<FEntry*>& Block : Blocks)
+    {
+        delete[] Block.load(std::memory_order_relaxed);
+    }
+}
 
-// FNameTable
 /**
-* @brief FString 객체를 받아 풀에 없으면 반환
-* @param Str FName으로 등록되었는지 확인할 FString
-* @return DisplayIndex, ComparisonIndex
+* @brief FNV-1a, 대소문자 무시 풀이면 글자를 소문자로 바꿔 가며 해시하므로 소문자 복사본을 만들지 않는다
 */
-FNameTable::FNameTable()
+uint32 FNameTable::FNamePool::HashString(std::string_view InString) const
 {
-    ComparisonMap["None"] = 0;
-    DisplayMap["None"] = 0;
+    uint32 Hash = 2166136261u;
+    for (char C : InString)
+    {
+        Hash ^= static_cast<uint8>(bIgnoreCase ? ToLowerAscii(C) : C);
+        Hash *= 16777619u;
+    }
+    // 0은 빈 슬롯 검사를 빠르게 하려고 쓰지 않는다
+    return Hash ? Hash : 1u;
 }
 
-FNameTable::~FNameTable() = default;
+bool FNameTable::FNamePool::IsSameString(const FEntry& InEntry, std::string_view InString) const
+{
+    if (InEntry.Length != InString.size())
+    {
+        return false;
+    }
+    if (!bIgnoreCase)
+    {
+        return memcmp(InEntry.Data, InString.data(), InString.size()) == 0;
+    }
+    // 저장된 문자열은 이미 소문자
+    for (size_t Index = 0; Index < InString.size(); ++Index)
+    {
+        if (InEntry.Data[Index] != ToLowerAscii(InString[Index]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
-FNameTable& FNameTable::GetInstance()
+/**
+* @brief 샤드의 현재 청크 뒤에 문자열을 붙인다, 남은 공간이 부족하면 새 청크를 잡고 이전 청크는 그대로 둔다
+*/
+const char* FNameTable::FNamePool::StoreString(FShard& InShard, std::string_view InString)
 {
-    static FNameTable Instance;
-    return Instance;
+    const size_t Size = InString.size() + 1;
+    if (Size > InShard.Remaining)
+    {
+        const size_t ChunkSize = std::max(CHUNK_SIZE, Size);
+        InShard.Chunks.push_back(std::make_unique<char[]>(ChunkSize));
+        InShard.Cursor = InShard.Chunks.back().get();
+        InShard.Remaining = ChunkSize;
+    }
+
+    char* Data = InShard.Cursor;
+    for (size_t Index = 0; Index < InString.size(); ++Index)
+    {
+        Data[Index] = bIgnoreCase ? ToLowerAscii(InString[Index]) : InString[Index];
+    }
+    Data[InString.size()] = '\0';
+
+    InShard.Cursor += Size;
+    InShard.Remaining -= Size;
+    return Data;
 }
 
-TPair<int32, int32> FNameTable::FindOrAddName(const FString& Str)
+FNameTable::FNamePool::FEntry* FNameTable::FNamePool::FindEntry(int32 InIndex) const
 {
-    FString LowerStr = ToLower(Str);
+    if (InIndex < 0 || InIndex >= EntryCount.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+    FEntry* Block = Blocks[InIndex >> BLOCK_BITS].load(std::memory_order_acquire);
+    return Block ? &Block[InIndex & (BLOCK_SIZE - 1)] : nullptr;
+}
 
-    int32 ComparisonIndex;
-    auto ItComparison = ComparisonMap.find(LowerStr);
-    if (ItComparison != ComparisonMap.end())
+/**
+* @brief InIndex 자리의 항목, 블록이 없으면 만들어 CAS로 올린다
+* 다른 샤드가 같은 블록을 동시에 만들었으면 진 쪽이 자기 블록을 버린다.
+*/
+FNameTable::FNamePool::FEntry& FNameTable::FNamePool::AddEntry(int32 InIndex)
+{
+    std::atomic<FEntry*>& BlockSlot = Blocks[InIndex >> BLOCK_BITS];
+    FEntry* Block = BlockSlot.load(std::memory_order_acquire);
+    if (!Block)
     {
-        ComparisonIndex = ItComparison->second;
+        FEntry* NewBlock = new FEntry[BLOCK_SIZE];
+        if (BlockSlot.compare_exchange_strong(Block, NewBlock, std::memory_order_acq_rel))
+        {
+            Block = NewBlock;
+        }
+        else
+        {
+            delete[] NewBlock;
+        }
     }
-    else
+    return Block[InIndex & (BLOCK_SIZE - 1)];
+}
+
+/**
+* @brief 슬롯 수를 두 배로 늘리고 해시를 다시 배치한다, 문자열과 인덱스는 움직이지 않는다
+*/
+void FNameTable::FNamePool::GrowShard(FShard& InShard)
+{
+    TArray<FSlot> NewSlots(InShard.Slots.size() * 2);
+    const uint32 Mask = static_cast<uint32>(NewSlots.size()) - 1;
+    for (const FSlot& Slot : InShard.Slots)
     {
-        ComparisonIndex = ComparisonStringPool.size();
-        ComparisonStringPool.push_back(LowerStr);
-        ComparisonMap[LowerStr] = ComparisonIndex;
+        if (Slot.Index < 0)
+        {
+            continue;
+        }
+        uint32 Probe = Slot.Hash & Mask;
+        while (NewSlots[Probe].Index >= 0)
+        {
+            Probe = (Probe + 1) & Mask;
+        }
+        NewSlots[Probe] = Slot;
     }
+    InShard.Slots = std::move(NewSlots);
+}
 
-    int32 DisplayIndex;
-    auto ItDisplay = DisplayMap.find(Str);
-    if (ItDisplay != DisplayMap.end())
+/**
+* @brief 해시 상위 비트로 샤드를 고르고 그 샤드만 잠근 채 선형 탐사로 찾는다, 없으면 새 인덱스를 발급한다
+*/
+int32 FNameTable::FNamePool::FindOrAdd(std::string_view InString)
+{
+    const uint32 Hash = HashString(InString);
+    FShard& Shard = Shards[Hash >> (32 - SHARD_BITS)];
+
+    std::lock_guard<std::mutex> Lock(Shard.Mutex);
+
+    const uint32 Mask = static_cast<uint32>(Shard.Slots.size()) - 1;
+    uint32 Probe = Hash & Mask;
+    while (Shard.Slots[Probe].Index >= 0)
     {
-        DisplayIndex = ItDisplay->second;
+        const FSlot& Slot = Shard.Slots[Probe];
+        if (Slot.Hash == Hash && IsSameString(*FindEntry(Slot.Index), InString))
+        {
+            return Slot.Index;
+        }
+        Probe = (Probe + 1) & Mask;
     }
-    else
+
+    const int32 Index = EntryCount.fetch_add(1, std::memory_order_relaxed);
+    assert(Index < static_cast<int32>(BLOCK_SIZE * MAX_BLOCKS) && "FNamePool: 이름 수가 한도를 넘었습니다");
+
+    FEntry& Entry = AddEntry(Index);
+    Entry.Data = StoreString(Shard, InString);
+    Entry.Length = static_cast<uint32>(InString.size());
+
+    Shard.Slots[Probe] = { Hash, Index };
+    if (++Shard.SlotCount * 2 > Shard.Slots.size())
     {
-        DisplayIndex = DisplayStringPool.size();
-        DisplayStringPool.push_back(Str);
-        DisplayMap[Str] = DisplayIndex;
+        GrowShard(Shard);
     }
 
-    return { ComparisonIndex, DisplayIndex };
+    return Index;
 }
 
-FName FNameTable::GetUniqueName(const FString& BaseStr)
+std::string_view FNameTable::FNamePool::Get(int32 InIndex) const
 {
-    TPair<int32, int32> Indices = FindOrAddName(BaseStr);
-    int32 DisplayIndex = Indices.second;
-    int32 ComparisonIndex = Indices.first;
+    const FEntry* Entry = FindEntry(InIndex);
+    // 범위 밖이거나 아직 채워지지 않은 항목
+    if (!Entry || !Entry->Data)
+    {
+        return {};
+    }
+    return std::string_view(Entry->Data, Entry->Length);
+}
 
-    int32 Number = NextNumberMap[BaseStr];
-    NextNumberMap[BaseStr]++;
+int32 FNameTable::FNamePool::AllocateNumber(int32 InIndex)
+{
+    FEntry* Entry = FindEntry(InIndex);
+    return Entry ? Entry->NextNumber.fetch_add(1, std::memory_order_relaxed) : 0;
+}
+
+// FNameTable
+FNameTable::FNameTable()
+    : ComparisonPool(true), DisplayPool(false)
+{
+    // 인덱스 0은 항상 "None"
+    ComparisonPool.FindOrAdd("None");
+    DisplayPool.FindOrAdd("None");
+}
 
-    return FName(DisplayIndex, ComparisonIndex, Number);
+FNameTable::~FNameTable() = default;
+
+FNameTable& FNameTable::GetInstance()
+{
+    static FNameTable Instance;
+    return Instance;
+}
+
+/**
+* @brief 문자열을 받아 풀에 없으면 추가하고 인덱스를 반환
+* @param Str FName으로 등록되었는지 확인할 문자열
+* @return ComparisonIndex, DisplayIndex
+*/
+TPair<int32, int32> FNameTable::FindOrAddName(std::string_view Str)
+{
+    return { ComparisonPool.FindOrAdd(Str), DisplayPool.FindOrAdd(Str) };
+}
+
+FName FNameTable::GetUniqueName(const FName& BaseName)
+{
+    const int32 Number = DisplayPool.AllocateNumber(BaseName.GetDisplayIndex());
+    return FName(BaseName.GetDisplayIndex(), BaseName.GetComparisonIndex(), Number);
 }
 
 FString FNameTable::GetDisplayString(int32 Idx) const
 {
-    if (Idx >= 0 && Idx < DisplayStringPool.size())
-    {
-        return DisplayStringPool[Idx];
-    }
-    static const FString EmptyString = "None";
-    return EmptyString;
+    return FString(GetDisplayView(Idx));
 }
 
-FString FNameTable::ToLower(const FString& Str) const
+std::string_view FNameTable::GetDisplayView(int32 Idx) const
 {
-    FString LowerStr = Str;
-    std::transform(LowerStr.begin(), LowerStr.end(), LowerStr.begin(),
-        [](unsigned char C) { return std::tolower(C); });
-    return LowerStr;
-}
\ No newline at end of file
+    const std::string_view Display = DisplayPool.Get(Idx);
+    return Display.data() ? Display : std::string_view("None");
+}
@@ -2,14 +2,15 @@
 #include "Core/Public/Object.h"
 #include "Core/Public/EngineStatics.h"
 #include "Core/Public/Name.h"
+#include "Utility/Public/JsonReader.h"
 
 #include <json.hpp>
 
 uint32 UEngineStatics::NextUUID = 0;
 
-TArray<UObject*>& GetUObjectArray()
+FUObjectArray& GetUObjectArray()
 {
-	static TArray<UObject*> GUObjectArray;
+	static FUObjectArray GUObjectArray;
 	return GUObjectArray;
 }
 
@@ -20,22 +21,32 @@ UObject::UObject()
 {
 	UUID = UEngineStatics::GenUUID();
 	
-	GetUObjectArray().emplace_back(this);
-	InternalIndex = static_cast<uint32>(GetUObjectArray().size()) - 1;
+	ObjectHandle = GetUObjectArray().Add(this);
 }
 
 UObject::~UObject()
 {
-	/** @todo: 이후에 리뷰 필요 */
+	// 슬롯을 비우고 세대를 올려 이 객체를 가리키던 핸들을 무효화한다
+	GetUObjectArray().Remove(ObjectHandle);
+}
 
-	// std::vector에 맞는 올바른 인덱스 유효성 검사
-	if (InternalIndex < GetUObjectArray().size())
+void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+{
+	if (bInIsLoading)
 	{
-		GetUObjectArray()[InternalIndex] = nullptr;
+		FJsonDocument Document;
+		if (Document.Parse(InOutHandle.dump()))
+		{
+			Deserialize(Document.GetRoot());
+		}
 	}
 }
 
-void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+void UObject::Deserialize(const FJsonValue& InHandle)
+{
+}
+
+void UObject::SerializeBinary(FArchive& InOutArchive)
 {
 }
 
@@ -104,22 +115,6 @@ void UObject::PropagateMemoryChange(uint64 InBytesDelta, uint32 InCountDelta)
 	}
 }
 
-/**
- * @brief 해당 클래스가 현재 내 클래스의 조상 클래스인지 판단하는 함수
- * 내부적으로 재귀를 활용해서 부모를 계속 탐색한 뒤 결과를 반환한다
- * @param InClass 판정할 Class
- * @return 판정 결과
- */
-bool UObject::IsA(UClass* InClass) const
-{
-	if (!InClass)
-	{
-		return false;
-	}
-
-	return GetClass()->IsChildOf(InClass);
-}
-
 /**
  * @brief 해당 클래스가 현재 내 클래스와 동일한지 판단하는 함수
  * @return 판정 결과
@@ -0,0 +1,206 @@
+#include "pch.h"
+#include "Core/Public/ObjectArray.h"
+#include "Core/Public/Object.h"
+
+FObjectHandle FUObjectArray::Add(UObject* InObject)
+{
+	uint32 SlotIndex = FirstFreeSlot;
+	if (SlotIndex != INDEX_NONE)
+	{
+		FirstFreeSlot = Slots[SlotIndex].BucketPositionOrNextFree;
+	}
+	else
+	{
+		if (Slots.size() > FObjectHandle::INDEX_MASK)
+		{
+			UE_LOG_ERROR("UObjectArray: 슬롯 수가 한계(%u)를 넘어 객체를 등록하지 못했습니다", FObjectHandle::INDEX_MASK + 1);
+			return FObjectHandle();
+		}
+		SlotIndex = static_cast<uint32>(Slots.size());
+		Slots.emplace_back();
+	}
+
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.Object = InObject;
+	Slot.BucketIndex = INDEX_NONE;
+	Slot.BucketPositionOrNextFree = INDEX_NONE;
+	++ObjectCount;
+
+	const FObjectHandle Handle(SlotIndex, Slot.Generation);
+
+	// 순회 없이 생성/삭제만 반복하면 대기 목록에 삭제된 객체가 쌓이므로, 살아 있는 객체 수의 두 배를 넘으면 걸러낸다
+	if (PendingObjects.size() >= 2 * static_cast<size_t>(ObjectCount) + 1024)
+	{
+		PendingObjects.erase(std::remove_if(PendingObjects.begin(), PendingObjects.end(),
+			[this](FObjectHandle InPending) { return Resolve(InPending) == nullptr; }), PendingObjects.end());
+	}
+	PendingObjects.push_back(Handle);
+
+	return Handle;
+}
+
+void FUObjectArray::Remove(FObjectHandle InHandle)
+{
+	if (!Resolve(InHandle))
+	{
+		return;
+	}
+
+	const uint32 SlotIndex = InHandle.GetIndex();
+	FSlot& Slot = Slots[SlotIndex];
+
+	if (Slot.BucketIndex != INDEX_NONE && ActiveIteratorCount > 0)
+	{
+		// 순회 중에는 끝 원소를 옮기면 순회가 그 원소를 건너뛰므로 자리만 비워 두고 EndIteration에서 당긴다
+		FClassBucket& Bucket = Buckets[Slot.BucketIndex];
+		const uint32 Position = Slot.BucketPositionOrNextFree;
+		Bucket.Objects[Position] = nullptr;
+		Bucket.SlotIndices[Position] = INDEX_NONE;
+		if (!Bucket.bHasHoles)
+		{
+			Bucket.bHasHoles = true;
+			BucketsWithHoles.push_back(Slot.BucketIndex);
+		}
+	}
+	else if (Slot.BucketIndex != INDEX_NONE)
+	{
+		// 버킷 끝 원소를 삭제할 자리로 옮긴다
+		FClassBucket& Bucket = Buckets[Slot.BucketIndex];
+		const uint32 Position = Slot.BucketPositionOrNextFree;
+		const uint32 LastSlotIndex = Bucket.SlotIndices.back();
+
+		Bucket.Objects[Position] = Bucket.Objects.back();
+		Bucket.SlotIndices[Position] = LastSlotIndex;
+		Slots[LastSlotIndex].BucketPositionOrNextFree = Position;
+
+		Bucket.Objects.pop_back();
+		Bucket.SlotIndices.pop_back();
+	}
+
+	Slot.Object = nullptr;
+	Slot.BucketIndex = INDEX_NONE;
+	Slot.Generation = (Slot.Generation + 1) & FObjectHandle::GENERATION_MASK;
+	if (Slot.Generation == 0)
+	{
+		Slot.Generation = 1;
+	}
+
+	Slot.BucketPositionOrNextFree = FirstFreeSlot;
+	FirstFreeSlot = SlotIndex;
+	--ObjectCount;
+}
+
+UObject* FUObjectArray::Resolve(FObjectHandle InHandle) const
+{
+	if (!InHandle.IsValid() || InHandle.GetIndex() >= Slots.size())
+	{
+		return nullptr;
+	}
+
+	const FSlot& Slot = Slots[InHandle.GetIndex()];
+	return Slot.Generation == InHandle.GetGeneration() ? Slot.Object : nullptr;
+}
+
+void FUObjectArray::EndIteration()
+{
+	if (--ActiveIteratorCount > 0)
+	{
+		return;
+	}
+
+	// 남은 원소의 순서를 유지한 채 비운 자리를 당기고, 옮겨진 원소의 슬롯에 새 위치를 기록
+	for (const uint32 BucketIndex : BucketsWithHoles)
+	{
+		FClassBucket& Bucket = Buckets[BucketIndex];
+		uint32 WritePosition = 0;
+		for (uint32 ReadPosition = 0; ReadPosition < Bucket.Objects.size(); ++ReadPosition)
+		{
+			if (!Bucket.Objects[ReadPosition])
+			{
+				continue;
+			}
+
+			Bucket.Objects[WritePosition] = Bucket.Objects[ReadPosition];
+			Bucket.SlotIndices[WritePosition] = Bucket.SlotIndices[ReadPosition];
+			Slots[Bucket.SlotIndices[WritePosition]].BucketPositionOrNextFree = WritePosition;
+			++WritePosition;
+		}
+		Bucket.Objects.resize(WritePosition);
+		Bucket.SlotIndices.resize(WritePosition);
+		Bucket.bHasHoles = false;
+	}
+	BucketsWithHoles.clear();
+}
+
+void FUObjectArray::Reserve(uint32 InCount)
+{
+	Slots.reserve(Slots.size() + InCount);
+	PendingObjects.reserve(PendingObjects.size() + InCount);
+}
+
+const TArray<uint32>& FUObjectArray::GetClassBuckets(UClass* InClass)
+{
+	FlushPendingObjects();
+
+	auto Iter = ClassBuckets.find(InClass);
+	if (Iter != ClassBuckets.end())
+	{
+		return Iter->second;
+	}
+
+	TArray<uint32>& BucketList = ClassBuckets[InClass];
+	for (uint32 BucketIndex = 0; BucketIndex < Buckets.size(); ++BucketIndex)
+	{
+		if (Buckets[BucketIndex].Class->IsChildOf(InClass))
+		{
+			BucketList.push_back(BucketIndex);
+		}
+	}
+	return BucketList;
+}
+
+void FUObjectArray::FlushPendingObjects()
+{
+	for (FObjectHandle Handle : PendingObjects)
+	{
+		UObject* Object = Resolve(Handle);
+		if (!Object)
+		{
+			continue;
+		}
+
+		FSlot& Slot = Slots[Handle.GetIndex()];
+		const uint32 BucketIndex = FindOrAddBucket(Object->GetClass());
+		FClassBucket& Bucket = Buckets[BucketIndex];
+
+		Slot.BucketIndex = BucketIndex;
+		Slot.BucketPositionOrNextFree = static_cast<uint32>(Bucket.Objects.size());
+		Bucket.Objects.push_back(Object);
+		Bucket.SlotIndices.push_back(Handle.GetIndex());
+	}
+	PendingObjects.clear();
+}
+
+uint32 FUObjectArray::FindOrAddBucket(UClass* InClass)
+{
+	auto Iter = BucketIndices.find(InClass);
+	if (Iter != BucketIndices.end())
+	{
+		return Iter->second;
+	}
+
+	const uint32 BucketIndex = static_cast<uint32>(Buckets.size());
+	Buckets.emplace_back();
+	Buckets.back().Class = InClass;
+	BucketIndices.emplace(InClass, BucketIndex);
+
+	// 이미 만들어 둔 순회 목록 중 새 클래스의 조상 클래스 목록에 이어 붙인다
+	for (auto& Pair : ClassBuckets)
+	{
+		if (InClass->IsChildOf(Pair.first))
+		{
+			Pair.second.push_back(BucketIndex);
+		}
+	}
+	return BucketIndex;
+}
@@ -0,0 +1,65 @@
+#include "pch.h"
+
+#include "Core/Public/WindowsMappedFile.h"
+
+bool FWindowsMappedFile::Open(const std::filesystem::path& InFilePath)
+{
+	Close();
+
+	HANDLE File = CreateFileW(InFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (File == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	FileHandle = File;
+
+	LARGE_INTEGER FileSize = {};
+	if (!GetFileSizeEx(File, &FileSize) || FileSize.QuadPart <= 0)
+	{
+		Close();
+		return false;
+	}
+
+	MappingHandle = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!MappingHandle)
+	{
+		UE_LOG_ERROR("파일 매핑을 만들지 못했습니다: %s", InFilePath.string().c_str());
+		Close();
+		return false;
+	}
+
+	Data = static_cast<const uint8*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+	if (!Data)
+	{
+		UE_LOG_ERROR("파일 뷰를 매핑하지 못했습니다: %s", InFilePath.string().c_str());
+		Close();
+		return false;
+	}
+
+	Size = static_cast<size_t>(FileSize.QuadPart);
+	return true;
+}
+
+void FWindowsMappedFile::Close()
+{
+	if (Data)
+	{
+		UnmapViewOfFile(Data);
+		Data = nullptr;
+	}
+
+	if (MappingHandle)
+	{
+		CloseHandle(MappingHandle);
+		MappingHandle = nullptr;
+	}
+
+	if (FileHandle)
+	{
+		CloseHandle(FileHandle);
+		FileHandle = nullptr;
+	}
+
+	Size = 0;
+}
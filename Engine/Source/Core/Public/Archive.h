@@ -5,6 +5,8 @@
 #include "Global/CoreTypes.h"
 #include "Global/Vector.h"
 
+class FName;
+
 struct FArchive
 {
 	virtual ~FArchive() = default;
@@ -13,6 +15,18 @@ struct FArchive
 	virtual bool IsLoading() const = 0;
 	virtual void Serialize(void* V, size_t Length) = 0;
 
+	/**
+	 * @brief FName은 인덱스가 실행마다 달라지므로 문자열로 직렬화한다
+	 * 이름 테이블을 가진 아카이브(레벨 바이너리 등)는 재정의해서 테이블 인덱스로 바꿔 쓴다
+	 */
+	virtual void SerializeName(FName& Value);
+
+	FArchive& operator<<(FName& Value)
+	{
+		SerializeName(Value);
+		return *this;
+	}
+
 	template<typename T, typename = std::enable_if_t<std::is_trivially_copyable_v<T>>>
 	FArchive& operator<<(T& Value)
 	{
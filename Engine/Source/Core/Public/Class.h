@@ -17,10 +17,22 @@ public:
     typedef UObject* (*ClassConstructorType)();
 public:
     static void SignUpClass(UClass* InClass);
+    /** @brief 이름의 비교 인덱스로 해시 검색 */
     static UClass* FindClass(const FName& InClassName);
     static TArray<UClass*> FindClasses(UClass* SuperClass);
+
+    /**
+     * @brief 클래스 트리를 깊이 우선으로 훑어 전위 번호와 마지막 자손 번호를 매긴다
+     * 하위 클래스의 번호는 항상 부모의 [TreeIndex, TreeLastIndex] 구간 안에 있으므로 IsChildOf가 정수 비교 두 번이 된다.
+     * @note 모든 IMPLEMENT_CLASS 등록이 끝난 시작 시점에 한 번 호출하며, 이후 새 클래스가 등록되면 다음 IsChildOf에서 다시 매긴다
+     */
+    static void BuildClassTree();
 private:
     static TArray<UClass*>& GetAllClasses();
+    static TMap<int32, UClass*>& GetClassMap();
+    static uint32 NumberClassTree(UClass* InClass, const TMap<UClass*, TArray<UClass*>>& InChildren, uint32 InNextIndex);
+
+    static bool bIsClassTreeDirty;
     
 public:
     UClass(const FName& InName, UClass* InSuperClass, size_t InClassSize, ClassConstructorType InConstructor, bool InIsAbstract = false);
@@ -30,7 +42,25 @@ public:
     UClass* GetSuperClass() const { return SuperClass; }
     size_t GetClassSize() const { return ClassSize; }
     
-    bool IsChildOf(UClass* InClass) const;
+    /**
+     * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인
+     * @param InClass 확인할 클래스
+     * @return 하위 클래스이거나 같은 클래스면 true
+     */
+    bool IsChildOf(const UClass* InClass) const
+    {
+        if (!InClass)
+        {
+            return false;
+        }
+
+        if (bIsClassTreeDirty)
+        {
+            BuildClassTree();
+        }
+
+        return InClass->TreeIndex <= TreeIndex && TreeIndex <= InClass->TreeLastIndex;
+    }
     UObject* CreateDefaultObject() const;
 
     bool IsAbstract() const { return bIsAbstract; }
@@ -41,6 +71,10 @@ private:
     size_t ClassSize;
     ClassConstructorType Constructor;
     bool bIsAbstract;
+
+    /** @brief 클래스 트리의 전위 번호와 가장 마지막 자손의 번호 */
+    uint32 TreeIndex = 0;
+    uint32 TreeLastIndex = 0;
 };
 
 /**
@@ -77,7 +111,9 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         &ClassName::CreateDefaultObject##ClassName \
     ); \
-    UClass::SignUpClass(&Instance); \
+    /* 등록은 처음 한 번만, 이후 호출은 Cast 경로에서 정적 변수 확인만 한다 */ \
+    static const bool bIsSignedUp = (UClass::SignUpClass(&Instance), true); \
+    (void)bIsSignedUp; \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -101,7 +137,9 @@ UClass* ClassName::StaticClass() \
         nullptr, \
         true \
     ); \
-    UClass::SignUpClass(&Instance); \
+    /* 등록은 처음 한 번만, 이후 호출은 Cast 경로에서 정적 변수 확인만 한다 */ \
+    static const bool bIsSignedUp = (UClass::SignUpClass(&Instance), true); \
+    (void)bIsSignedUp; \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -142,7 +180,9 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         nullptr /* 싱글톤은 동적 생성을 지원하지 않으므로 생성자 포인터를 null로 전달 */ \
     ); \
-    UClass::SignUpClass(&Instance); \
+    /* 등록은 처음 한 번만, 이후 호출은 Cast 경로에서 정적 변수 확인만 한다 */ \
+    static const bool bIsSignedUp = (UClass::SignUpClass(&Instance), true); \
+    (void)bIsSignedUp; \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -172,7 +212,9 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         &ClassName::CreateDefaultObject##ClassName \
     ); \
-    UClass::SignUpClass(&Instance); \
+    /* 등록은 처음 한 번만, 이후 호출은 Cast 경로에서 정적 변수 확인만 한다 */ \
+    static const bool bIsSignedUp = (UClass::SignUpClass(&Instance), true); \
+    (void)bIsSignedUp; \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -0,0 +1,92 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief FJobSystem::Submit으로 제출한 작업 묶음의 남은 개수
+ * 작업 하나가 끝날 때마다 감소하며, FJobSystem::Wait로 0이 될 때까지 기다린다.
+ */
+struct FJobCounter
+{
+	std::atomic<int32> Remaining{ 0 };
+
+	bool IsDone() const { return Remaining.load(std::memory_order_acquire) == 0; }
+};
+
+/**
+ * @brief 워커마다 작업 덱을 두는 작업 훔치기(Work-Stealing) 방식의 작업 시스템
+ * 워커는 자신의 덱 뒤쪽에서 작업을 꺼내고, 비어 있으면 다른 워커 덱의 앞쪽에서 훔쳐 온다.
+ * Wait를 호출한 스레드도 기다리는 동안 작업을 직접 실행하므로, 워커가 0개여도 동작한다.
+ * @note 엔진 전역 인스턴스는 FClientApp이 초기화하며, 벤치마크는 워커 수를 바꾼 별도 인스턴스를 만들어 사용한다.
+ */
+class FJobSystem
+{
+public:
+	using FJobFunction = TFunction<void()>;
+
+	static FJobSystem& GetInstance();
+
+	/** @param InWorkerCount 호출 스레드 외에 만들 워커 스레드 개수 */
+	explicit FJobSystem(uint32 InWorkerCount = 0);
+	~FJobSystem();
+
+	FJobSystem(const FJobSystem&) = delete;
+	FJobSystem& operator=(const FJobSystem&) = delete;
+
+	/** @brief 기존 워커를 정리하고 InWorkerCount개의 워커로 다시 시작 */
+	void Initialize(uint32 InWorkerCount);
+	void Shutdown();
+
+	/** @brief 작업을 큐에 넣고 InCounter를 증가시킴, 완료는 반드시 Wait로 확인해야 함 */
+	void Submit(FJobFunction InJob, FJobCounter& InCounter);
+
+	/** @brief InCounter가 0이 될 때까지 대기하며, 그동안 호출 스레드도 남은 작업을 실행 */
+	void Wait(FJobCounter& InCounter);
+
+	/**
+	 * @brief [0, InCount) 범위를 InBatchSize개씩 작업으로 나눠 병렬 실행하고 모두 끝날 때까지 대기
+	 * @param InBody 인덱스 하나를 처리하는 함수, 서로 다른 인덱스끼리 공유 상태를 쓰지 않아야 함
+	 */
+	void ParallelFor(int32 InCount, const TFunction<void(int32)>& InBody, int32 InBatchSize = 1);
+
+	uint32 GetWorkerCount() const { return static_cast<uint32>(Workers.size()); }
+
+	/** @brief 하드웨어 스레드 수에서 메인 스레드를 뺀 기본 워커 개수 */
+	static uint32 GetDefaultWorkerCount();
+
+private:
+	struct FJob
+	{
+		FJobFunction Function;
+		FJobCounter* Counter = nullptr;
+	};
+
+	struct FWorkerQueue
+	{
+		std::mutex Mutex;
+		std::deque<FJob> Jobs;
+	};
+
+	void WorkerLoop(int32 InWorkerIndex);
+
+	/** @brief 자기 큐(InOwnQueue, 없으면 -1)의 뒤쪽을 먼저 보고, 비어 있으면 다른 큐의 앞쪽에서 훔쳐 와 실행 */
+	bool TryExecuteJob(int32 InOwnQueue);
+	bool PopBack(int32 InQueueIndex, FJob& OutJob);
+	bool StealFront(int32 InQueueIndex, FJob& OutJob);
+
+	/** @brief 현재 스레드가 이 작업 시스템의 워커라면 해당 큐 인덱스, 아니면 -1 */
+	int32 GetCurrentQueueIndex() const;
+
+	TArray<std::thread> Workers;
+	TArray<std::unique_ptr<FWorkerQueue>> Queues;
+
+	std::atomic<uint32> NextQueue{ 0 };
+	std::atomic<int32> PendingJobCount{ 0 };
+	std::atomic<bool> bIsRunning{ false };
+
+	std::mutex SleepMutex;
+	std::condition_variable SleepCondition;
+};
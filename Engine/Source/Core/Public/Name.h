@@ -1,4 +1,8 @@
 #pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string_view>
 
 /**
  * @brief 오브젝트의 이름을 담당하는 구조체
@@ -12,6 +16,8 @@ public:
 	FName();
 	FName(const FString& Str);
 	FName(const char* Str);
+	/** @brief 문자열을 복사하지 않고 해시로 바로 찾는다, 처음 보는 이름일 때만 풀에 저장한다 */
+	FName(std::string_view Str);
 	FName(int32 InDisplayIndex, int32 InComparisonIndex, int32 InNumber);
 
 	bool operator==(const FName& Other) const;
@@ -19,6 +25,8 @@ public:
 
 	FString ToString() const;
 	FString ToBaseNameString() const;
+	/** @brief 번호를 뺀 표시용 이름, 풀의 문자열을 그대로 가리키므로 할당이 없다 */
+	std::string_view ToBaseNameView() const;
 
 	int32 GetComparisonIndex() const { return ComparisonIndex; }
 	int32 GetDisplayIndex() const { return DisplayIndex; }
@@ -55,6 +63,14 @@ namespace std {
 }
 
 
+/**
+ * @brief FName의 문자열 풀, 비교용(소문자)과 표시용 두 개를 둔다
+ * 에셋 로딩 잡처럼 워커 스레드에서도 FName을 만들고 읽으므로 모든 함수는 스레드 안전하다.
+ * - 검색: 해시를 입력 문자열에서 바로 계산하고(비교용은 대소문자 무시), 해시 상위 비트로 고른 샤드 하나만 잠근다
+ * - 저장: 문자열은 샤드별 청크 아레나에, 항목은 고정 크기 블록에 넣어 한 번 받은 인덱스와 문자열 주소가 바뀌지 않는다
+ * - 인덱스로 문자열 읽기와 번호 발급은 잠금 없이 처리한다
+ * @note 인덱스 0은 "None"
+ */
 class FNameTable
 {
 public:
@@ -63,18 +79,81 @@ public:
 public:
 	FNameTable();
 	~FNameTable();
-	TPair<int32, int32> FindOrAddName(const FString& Str);
-	FName GetUniqueName(const FString& BaseStr);
+
+	/** @return ComparisonIndex, DisplayIndex */
+	TPair<int32, int32> FindOrAddName(std::string_view Str);
+	/**
+	 * @brief BaseName에 번호를 붙인 이름, 번호는 표시용 이름별로 원자적으로 발급한다
+	 * 클래스 이름처럼 이미 만들어 둔 FName을 넘기면 문자열 검색 없이 번호만 발급한다.
+	 */
+	FName GetUniqueName(const FName& BaseName);
 
 	FString GetDisplayString(int32 Idx) const;
+	std::string_view GetDisplayView(int32 Idx) const;
+
+	int32 GetComparisonNameCount() const { return ComparisonPool.GetCount(); }
+	int32 GetDisplayNameCount() const { return DisplayPool.GetCount(); }
 
 private:
-	FString ToLower(const FString& Str) const;
+	/** @brief 문자열 하나당 인덱스 하나를 발급하는 샤드 해시 풀 */
+	class FNamePool
+	{
+	public:
+		explicit FNamePool(bool bInIgnoreCase);
+		~FNamePool();
+
+		int32 FindOrAdd(std::string_view InString);
+		/** @brief 유효하지 않은 인덱스면 빈 문자열 */
+		std::string_view Get(int32 InIndex) const;
+		/** @brief InIndex 이름의 다음 번호, 원자적으로 증가 */
+		int32 AllocateNumber(int32 InIndex);
+		int32 GetCount() const { return EntryCount.load(std::memory_order_acquire); }
+
+	private:
+		struct FEntry
+		{
+			const char* Data = nullptr;
+			uint32 Length = 0;
+			std::atomic<int32> NextNumber{ 0 };
+		};
 
-	TArray<FString> ComparisonStringPool;
-	TArray<FString> DisplayStringPool;
+		/** @brief 열린 주소법 슬롯, Index가 -1이면 비어 있다 */
+		struct FSlot
+		{
+			uint32 Hash = 0;
+			int32 Index = -1;
+		};
+
+		struct FShard
+		{
+			std::mutex Mutex;
+			TArray<FSlot> Slots;
+			uint32 SlotCount = 0;
+			TArray<std::unique_ptr<char[]>> Chunks;
+			char* Cursor = nullptr;
+			size_t Remaining = 0;
+		};
+
+		static constexpr uint32 SHARD_BITS = 6;
+		static constexpr uint32 SHARD_COUNT = 1u << SHARD_BITS;
+		static constexpr uint32 BLOCK_BITS = 12;
+		static constexpr uint32 BLOCK_SIZE = 1u << BLOCK_BITS;
+		static constexpr uint32 MAX_BLOCKS = 4096;
+		static constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+		uint32 HashString(std::string_view InString) const;
+		bool IsSameString(const FEntry& InEntry, std::string_view InString) const;
+		const char* StoreString(FShard& InShard, std::string_view InString);
+		FEntry* FindEntry(int32 InIndex) const;
+		FEntry& AddEntry(int32 InIndex);
+		void GrowShard(FShard& InShard);
+
+		bool bIgnoreCase;
+		FShard Shards[SHARD_COUNT];
+		std::atomic<FEntry*> Blocks[MAX_BLOCKS] = {};
+		std::atomic<int32> EntryCount{ 0 };
+	};
 
-	TMap<FString, int32> ComparisonMap;
-	TMap<FString, int32> DisplayMap;
-	TMap<FString, int32> NextNumberMap;
+	FNamePool ComparisonPool;
+	FNamePool DisplayPool;
 };
\ No newline at end of file
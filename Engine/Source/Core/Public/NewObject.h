@@ -13,7 +13,7 @@ T* NewObject(UObject* InOuter = nullptr)
 {
 	static_assert(is_base_of_v<UObject, T>, "생성할 클래스는 UObject를 반드시 상속 받아야 합니다");
 	T* NewObject = new T();
-	NewObject->SetName(FNameTable::GetInstance().GetUniqueName(NewObject->GetClass()->GetName().ToString()));
+	NewObject->SetName(FNameTable::GetInstance().GetUniqueName(NewObject->GetClass()->GetName()));
 	NewObject->SetOuter(InOuter);
 	return NewObject;
 }
@@ -25,7 +25,7 @@ inline UObject* NewObject(UClass* ClassToCreate, UObject* InOuter = nullptr)
        
 	if (NewObject)
 	{
-		FName NewName = FNameTable::GetInstance().GetUniqueName(ClassToCreate->GetName().ToString());
+		FName NewName = FNameTable::GetInstance().GetUniqueName(ClassToCreate->GetName());
 		NewObject->SetName(NewName);
 		NewObject->SetOuter(InOuter);
 	}
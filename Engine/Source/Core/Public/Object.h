@@ -1,10 +1,14 @@
 #pragma once
 #include "Class.h"
 #include "Name.h"
+#include "ObjectArray.h"
 
 namespace json { class JSON; }
 using JSON = json::JSON;
 
+struct FArchive;
+class FJsonValue;
+
 UCLASS()
 class UObject
 {
@@ -19,8 +23,26 @@ public:
 	// 2. 가상 함수 (인터페이스)
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle);
 
+	/**
+	 * @brief JSON 불러오기, FJsonDocument의 테이프에서 DOM 없이 읽는다
+	 * @note Serialize(true, ...)로 들어온 DOM도 테이프로 다시 읽어 이 함수로 넘기므로 불러오기 코드는 여기에만 둔다
+	 */
+	virtual void Deserialize(const FJsonValue& InHandle);
+
+	/**
+	 * @brief 바이너리 레벨(.scenebin)의 프로퍼티 블록을 읽고 쓴다, JSON Serialize와 같은 값을 다룬다
+	 * @note 씬 컴포넌트의 상대 변환과 부모는 레벨 파일이 별도 블록으로 저장하므로 여기서 다루지 않는다
+	 */
+	virtual void SerializeBinary(FArchive& InOutArchive);
+
 	// 3. Public 멤버 함수
-	bool IsA(UClass* InClass) const;
+	/**
+	 * @brief 해당 클래스가 현재 내 클래스의 조상 클래스인지 판단하는 함수
+	 * 클래스 트리 번호 구간을 비교하므로 상속 깊이와 관계없이 상수 시간이다
+	 * @param InClass 판정할 Class
+	 * @return 판정 결과
+	 */
+	bool IsA(UClass* InClass) const { return InClass && GetClass()->IsChildOf(InClass); }
 	bool IsExactly(UClass* InClass) const;
 	void AddMemoryUsage(uint64 InBytes, uint32 InCount);
 	void RemoveMemoryUsage(uint64 InBytes, uint32 InCount);
@@ -31,6 +53,8 @@ public:
 	uint64 GetAllocatedBytes() const { return AllocatedBytes; }
 	uint32 GetAllocatedCount() const { return AllocatedCounts; }
 	uint32 GetUUID() const { return UUID; }
+	/** @brief TWeakObjectPtr가 저장하는 세대 핸들, 삭제된 뒤에는 GetUObjectArray().Resolve가 nullptr을 돌려준다 */
+	FObjectHandle GetObjectHandle() const { return ObjectHandle; }
 
 	FName GetName() { return Name; }
 	void SetName(const FName& InName) { Name = InName; }
@@ -52,7 +76,7 @@ private:
 private:
 	// 5. Private 멤버 변수
 	uint32 UUID;
-	uint32 InternalIndex;
+	FObjectHandle ObjectHandle;
 	FName Name;
 	UObject* Outer;
 	uint64 AllocatedBytes = 0;
@@ -165,4 +189,4 @@ bool IsValid(const UObject* InObject)
 	return InObject && IsA<T>(InObject);
 }
 
-TArray<UObject*>& GetUObjectArray();
+FUObjectArray& GetUObjectArray();
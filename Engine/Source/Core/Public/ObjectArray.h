@@ -0,0 +1,114 @@
+#pragma once
+
+class UObject;
+class UClass;
+
+/**
+ * @brief FUObjectArray의 슬롯을 가리키는 32비트 핸들, 하위 20비트는 슬롯 인덱스이고 상위 12비트는 세대
+ * 객체가 삭제되면 슬롯의 세대가 올라가므로, 슬롯이 다른 객체에 재사용되어도 예전 핸들은 nullptr로 풀린다.
+ * @note 같은 슬롯이 4095번 재사용되면 세대가 한 바퀴 돌아 아주 오래된 핸들이 다시 풀릴 수 있다
+ */
+struct FObjectHandle
+{
+	static constexpr uint32 INDEX_BITS = 20;
+	static constexpr uint32 INDEX_MASK = (1u << INDEX_BITS) - 1;
+	static constexpr uint32 GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+
+	FObjectHandle() = default;
+	FObjectHandle(uint32 InIndex, uint32 InGeneration)
+		: Value((InGeneration << INDEX_BITS) | InIndex)
+	{
+	}
+
+	/** @brief 세대 0은 쓰지 않으므로 기본 생성된 핸들은 항상 무효 */
+	bool IsValid() const { return Value != 0; }
+	uint32 GetIndex() const { return Value & INDEX_MASK; }
+	uint32 GetGeneration() const { return Value >> INDEX_BITS; }
+
+	bool operator==(const FObjectHandle& InOther) const { return Value == InOther.Value; }
+	bool operator!=(const FObjectHandle& InOther) const { return Value != InOther.Value; }
+
+	uint32 Value = 0;
+};
+
+/**
+ * @brief 모든 UObject를 등록하는 세대 슬롯 맵
+ * - 삭제된 슬롯은 프리 리스트로 재사용하므로 생성/삭제를 반복해도 배열이 늘어나지 않는다
+ * - 살아 있는 객체는 정확한 클래스별 버킷에 빽빽하게 모여 있고, 삭제는 버킷 끝 원소와 자리를 바꿔 O(1)로 뺀다
+ * - TObjectIterator<T>는 T와 하위 클래스 버킷만 훑으므로 다른 클래스 객체나 빈 슬롯을 건드리지 않는다
+ * 생성자 안에서는 가상 함수인 GetClass가 아직 최종 클래스를 돌려주지 않으므로, 새 객체는 대기 목록에 두었다가
+ * 클래스별 순회를 요청할 때 버킷에 넣는다.
+ * 순회 중에 삭제하면 버킷 끝 원소를 옮기지 않고 자리만 비워 두므로, 순회가 아직 보지 않은 객체를 건너뛰지 않는다.
+ * 비운 자리는 마지막 TObjectIterator가 끝날 때 한꺼번에 당긴다.
+ * @note 메인 스레드 전용
+ */
+class FUObjectArray
+{
+public:
+	FObjectHandle Add(UObject* InObject);
+	void Remove(FObjectHandle InHandle);
+
+	/** @brief 핸들이 가리키는 객체가 아직 살아 있으면 객체, 삭제되었거나 슬롯이 재사용되었으면 nullptr */
+	UObject* Resolve(FObjectHandle InHandle) const;
+
+	/** @brief 한 번에 많은 객체를 만들기 전에 슬롯을 미리 확보 */
+	void Reserve(uint32 InCount);
+
+	/**
+	 * @brief InClass와 하위 클래스 버킷의 인덱스 목록, 대기 중인 새 객체를 먼저 버킷에 넣는다
+	 * 목록은 클래스마다 한 번 만들어 두고, 이후 새 클래스의 버킷이 생기면 해당하는 목록 끝에 이어 붙인다.
+	 */
+	const TArray<uint32>& GetClassBuckets(UClass* InClass);
+	/** @brief 순회 중 삭제된 자리는 nullptr */
+	const TArray<UObject*>& GetBucketObjects(uint32 InBucketIndex) const { return Buckets[InBucketIndex].Objects; }
+
+	/** @brief TObjectIterator의 수명 동안 버킷 원소를 옮기지 않도록 잡아 둔다, EndIteration과 짝을 맞춘다 */
+	void BeginIteration() { ++ActiveIteratorCount; }
+	/** @brief 마지막 순회가 끝나면 순회 중 삭제로 비운 자리를 당겨 버킷을 다시 빽빽하게 만든다 */
+	void EndIteration();
+
+	uint32 GetObjectCount() const { return ObjectCount; }
+	uint32 GetSlotCount() const { return static_cast<uint32>(Slots.size()); }
+	uint32 GetBucketCount() const { return static_cast<uint32>(Buckets.size()); }
+
+private:
+	static constexpr uint32 INDEX_NONE = UINT32_MAX;
+
+	struct FSlot
+	{
+		UObject* Object = nullptr;
+		uint32 Generation = 1;
+		/** @brief 버킷에 들어가기 전이면 INDEX_NONE */
+		uint32 BucketIndex = INDEX_NONE;
+		/** @brief 사용 중이면 버킷 안의 위치, 비어 있으면 다음 빈 슬롯 */
+		uint32 BucketPositionOrNextFree = INDEX_NONE;
+	};
+
+	/** @brief 정확히 같은 클래스의 살아 있는 객체, Objects와 SlotIndices는 같은 순서 */
+	struct FClassBucket
+	{
+		UClass* Class = nullptr;
+		TArray<UObject*> Objects;
+		TArray<uint32> SlotIndices;
+		/** @brief 순회 중 삭제로 비운 자리가 있어 BucketsWithHoles에 들어 있는지 */
+		bool bHasHoles = false;
+	};
+
+	void FlushPendingObjects();
+	uint32 FindOrAddBucket(UClass* InClass);
+
+	TArray<FSlot> Slots;
+	uint32 FirstFreeSlot = INDEX_NONE;
+	uint32 ObjectCount = 0;
+
+	/** @brief 아직 버킷에 넣지 않은 객체, 그 사이에 삭제된 객체는 핸들이 풀리지 않으므로 넣을 때 걸러진다 */
+	TArray<FObjectHandle> PendingObjects;
+
+	TArray<FClassBucket> Buckets;
+	/** @brief 살아 있는 TObjectIterator 수, 0보다 크면 Remove가 버킷 원소를 옮기지 않는다 */
+	uint32 ActiveIteratorCount = 0;
+	TArray<uint32> BucketsWithHoles;
+	TMap<UClass*, uint32> BucketIndices;
+	/** @brief 순회 대상 클래스별 버킷 목록, 노드 기반 맵이라 반환한 참조가 유지된다 */
+	TMap<UClass*, TArray<uint32>> ClassBuckets;
+};
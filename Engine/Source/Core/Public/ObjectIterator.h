@@ -1,16 +1,38 @@
 #pragma once
 
 #include "Core/Public/Object.h"
+
+/**
+ * @brief TObject와 하위 클래스의 살아 있는 객체만 순회
+ * FUObjectArray의 클래스별 버킷을 차례로 훑으므로 IsA 검사가 없다.
+ * 순회하는 동안 FUObjectArray가 버킷 원소를 옮기지 않으므로, 순회 중 객체를 삭제해도 남은 객체를 건너뛰지 않는다.
+ * 순회 중 삭제된 객체 중 아직 지나지 않은 객체는 나오지 않는다.
+ */
 template<typename TObject>
 class TObjectIterator
 {
 public:
-	TObjectIterator() : UObjectArray(GetUObjectArray())
+	TObjectIterator()
+		: UObjectArray(GetUObjectArray()), BucketList(UObjectArray.GetClassBuckets(TObject::StaticClass()))
 	{
-		CurrentIndex = 0;
+		UObjectArray.BeginIteration();
 		AdvanceToNextValidObject();
 	}
 
+	TObjectIterator(const TObjectIterator& InOther)
+		: CurrentBucket(InOther.CurrentBucket), CurrentIndex(InOther.CurrentIndex), CurrentObject(InOther.CurrentObject),
+		UObjectArray(InOther.UObjectArray), BucketList(InOther.BucketList)
+	{
+		UObjectArray.BeginIteration();
+	}
+
+	TObjectIterator& operator=(const TObjectIterator&) = delete;
+
+	~TObjectIterator()
+	{
+		UObjectArray.EndIteration();
+	}
+
 	explicit operator bool() const
 	{
 		return CurrentObject != nullptr;
@@ -53,19 +75,28 @@ private:
 	void AdvanceToNextValidObject()
 	{
 		CurrentObject = nullptr;
-		while (CurrentIndex < UObjectArray.size())
+		while (CurrentBucket < BucketList.size())
 		{
-			UObject* Obj = UObjectArray[CurrentIndex];
-			if (Obj && Obj->IsA(TObject::StaticClass()))
+			const TArray<UObject*>& Objects = UObjectArray.GetBucketObjects(BucketList[CurrentBucket]);
+			if (CurrentIndex < Objects.size())
 			{
-				CurrentObject = Cast<TObject>(Obj);
+				// 순회 중 삭제되어 비워 둔 자리
+				if (!Objects[CurrentIndex])
+				{
+					++CurrentIndex;
+					continue;
+				}
+				CurrentObject = static_cast<TObject*>(Objects[CurrentIndex]);
 				return;
 			}
-			++CurrentIndex;
+			++CurrentBucket;
+			CurrentIndex = 0;
 		}
 	}
 
-	int32 CurrentIndex;
+	uint32 CurrentBucket = 0;
+	uint32 CurrentIndex = 0;
 	TObject* CurrentObject = nullptr;
-	TArray<UObject*>& UObjectArray;
+	FUObjectArray& UObjectArray;
+	const TArray<uint32>& BucketList;
 };
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Core/Public/Object.h"
+
+/**
+ * @brief 객체의 세대 핸들만 저장하는 약한 참조
+ * 객체가 삭제되면 슬롯이 다른 객체에 재사용되더라도 Get이 nullptr을 돌려준다.
+ * @tparam T UObject를 상속받은 타입
+ */
+template <typename T>
+class TWeakObjectPtr
+{
+public:
+	TWeakObjectPtr() = default;
+	TWeakObjectPtr(const T* InObject)
+		: Handle(InObject ? InObject->GetObjectHandle() : FObjectHandle())
+	{
+		static_assert(std::is_base_of_v<UObject, T>, "TWeakObjectPtr<T>: T는 UObject를 상속받아야 합니다");
+	}
+
+	T* Get() const { return static_cast<T*>(GetUObjectArray().Resolve(Handle)); }
+	bool IsValid() const { return Get() != nullptr; }
+	void Reset() { Handle = FObjectHandle(); }
+
+	explicit operator bool() const { return IsValid(); }
+	T* operator->() const { return Get(); }
+
+	bool operator==(const TWeakObjectPtr& InOther) const { return Handle == InOther.Handle; }
+	bool operator!=(const TWeakObjectPtr& InOther) const { return Handle != InOther.Handle; }
+
+private:
+	FObjectHandle Handle;
+};
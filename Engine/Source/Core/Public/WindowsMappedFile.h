@@ -0,0 +1,35 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Global/Types.h"
+
+/**
+ * @brief 파일 전체를 읽기 전용으로 메모리에 매핑하는 RAII 래퍼
+ * 읽기 호출 없이 페이지 폴트로 필요한 부분만 올라오므로, 쿠킹된 바이너리를 포인터로 바로 해석할 때 사용한다
+ * @note 매핑된 메모리는 Close 또는 소멸 시점까지만 유효하다
+ */
+class FWindowsMappedFile
+{
+public:
+	FWindowsMappedFile() = default;
+	explicit FWindowsMappedFile(const std::filesystem::path& InFilePath) { Open(InFilePath); }
+	~FWindowsMappedFile() { Close(); }
+
+	FWindowsMappedFile(const FWindowsMappedFile&) = delete;
+	FWindowsMappedFile& operator=(const FWindowsMappedFile&) = delete;
+
+	/** @brief 파일을 매핑, 파일이 없거나 비어 있으면 false */
+	bool Open(const std::filesystem::path& InFilePath);
+	void Close();
+
+	bool IsValid() const { return Data != nullptr; }
+	const uint8* GetData() const { return Data; }
+	size_t GetSize() const { return Size; }
+
+private:
+	void* FileHandle = nullptr;
+	void* MappingHandle = nullptr;
+	const uint8* Data = nullptr;
+	size_t Size = 0;
+};
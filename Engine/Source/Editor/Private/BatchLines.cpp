@@ -123,20 +123,19 @@ void UBatchLines::UpdatePointLightRangeVertices(UPointLightComponent* PointLight
 	bChangedVertices = true;
 }
 
-void UBatchLines::TraverseOctree(const FOctree* InNode)
+void UBatchLines::TraverseOctree(const FOctree* InOctree)
 {
-	if (!InNode) { return; }
+	if (!InOctree) { return; }
 
-	UBoundingBoxLines BoxLines;
-	BoxLines.UpdateVertices(&InNode->GetBoundingBox());
-	OctreeLines.push_back(BoxLines);
-
-	if (!InNode->IsLeafNode())
+	// 풀에서 사용 중인 노드의 셀 경계를 그린다 (느슨한 경계는 셀의 두 배라 겹쳐 보이므로 제외)
+	for (const FOctreeNode& Node : InOctree->GetNodePool())
 	{
-		for (const auto& Child : InNode->GetChildren())
-		{
-			TraverseOctree(Child);
-		}
+		if (!Node.bIsInUse) { continue; }
+
+		const FAABB CellBounds = Node.GetCellBounds();
+		UBoundingBoxLines BoxLines;
+		BoxLines.UpdateVertices(&CellBounds);
+		OctreeLines.push_back(BoxLines);
 	}
 }
 
@@ -4,9 +4,6 @@
 #include "Manager/Time/Public/TimeManager.h"
 #include "Manager/Config/Public/ConfigManager.h"
 
-#include "Component/Public/PrimitiveComponent.h"
-#include "Level/Public/Level.h"
-
 UCamera::UCamera() :
 	CameraConstants(FCameraConstants()),
 	RelativeLocation(FVector(-15.0f, 0.f, 10.0f)), RelativeRotation(FVector(0, 0, 0)),
@@ -111,19 +108,6 @@ void UCamera::Update(const D3D11_VIEWPORT& InViewport)
 		UpdateMatrixByOrth();
 		break;
 	}
-
-	// 카메라가 업데이트할 때마다 Cull한다.
-	// 카메라가 업데이트하지 않으면 Culling을 갱신할 이유가 없다.
-    ULevel* CurrentLevel = GWorld->GetLevel();
-    if (CurrentLevel)
-    {
-        ViewVolumeCuller.Cull(
-            CurrentLevel->GetStaticOctree(),
-            CurrentLevel->GetDynamicPrimitives(),
-            CurrentLevel->GetLights(),
-            CameraConstants
-        );
-    }
 }
 
 void UCamera::UpdateMatrixByPers()
@@ -8,6 +8,7 @@
 #include "Manager/Config/Public/ConfigManager.h"
 #include "Manager/Time/Public/TimeManager.h"
 #include "Component/Public/PrimitiveComponent.h"
+#include "Component/Mesh/Public/StaticBatchComponent.h"
 #include "Level/Public/Level.h"
 #include "Global/Quaternion.h"
 #include "Utility/Public/ScopeCycleCounter.h"
@@ -454,6 +455,16 @@ void UEditor::ProcessMouseInput()
 				{
 					Candidate.insert(Candidate.end(), DynamicCandidates.begin(), DynamicCandidates.end());
 				}
+
+				// 정적 배치 셀은 피킹하지 않고, 레이가 셀 경계에 닿으면 셀에 합쳐진 원본을 대신 검사한다
+				const size_t OctreeCandidateCount = Candidate.size();
+				for (size_t Index = 0; Index < OctreeCandidateCount; ++Index)
+				{
+					if (const UStaticBatchComponent* Batch = Cast<UStaticBatchComponent>(Candidate[Index]))
+					{
+						Candidate.insert(Candidate.end(), Batch->GetSources().begin(), Batch->GetSources().end());
+					}
+				}
 				
 
 				TStatId StatId("Picking");
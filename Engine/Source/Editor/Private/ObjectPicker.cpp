@@ -171,6 +171,31 @@ bool UObjectPicker::IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay&
 	const TArray<uint32>* Indices = Primitive->GetIndicesData();
 
 	FRay ModelRay = GetModelRay(WorldRay, Primitive);
+
+	// BVH4가 있는 스태틱 메시는 최근접 삼각형을 직접 찾고, 그 삼각형만 Near/Far 검사
+	if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Primitive))
+	{
+		UStaticMesh* StaticMeshObject = StaticMeshComp->GetStaticMesh();
+		FStaticMesh* StaticMesh = StaticMeshObject ? StaticMeshObject->GetStaticMeshAsset() : nullptr;
+		if (StaticMesh && Indices && StaticMesh->BVH.HasWideNodes())
+		{
+			FBVHRayHit Hit;
+			if (!StaticMesh->BVH.RaycastNearest(ModelRay, Hit))
+			{
+				return false;
+			}
+
+			const FVector& V0 = (*Vertices)[(*Indices)[Hit.TriangleIndex * 3 + 0]].Position;
+			const FVector& V1 = (*Vertices)[(*Indices)[Hit.TriangleIndex * 3 + 1]].Position;
+			const FVector& V2 = (*Vertices)[(*Indices)[Hit.TriangleIndex * 3 + 2]].Position;
+			if (IsRayTriangleCollided(InActiveCamera, ModelRay, V0, V1, V2, ModelMatrix, &Distance))
+			{
+				*ShortestDistance = std::min(*ShortestDistance, Distance);
+				return true;
+			}
+			// 최근접 삼각형이 Near/Far 범위 밖이면 아래의 후보 전체 검사로 넘어감
+		}
+	}
 	
 	// 충돌 가능성 있는 삼각형 인덱스 수집
 	// Triangle Ordinal(인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호)로 반환
@@ -287,31 +312,38 @@ bool UObjectPicker::IsRayCollideWithPlane(const FRay& WorldRay, FVector PlanePoi
  * 레이와 충돌하는 후보 노드들을 찾아 그 안의 프리미티브들을 OutCandidate에 담습니다.
  * @return 후보를 찾았으면 true, 못 찾았으면 false를 반환합니다.
  */
-bool UObjectPicker::FindCandidateFromOctree(FOctree* Node, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate)
+bool UObjectPicker::FindCandidateFromOctree(const FOctree* Octree, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate)
 {
 	// 0. nullptr인지 검사.
-	if (!Node) { return false; }
+	if (!Octree) { return false; }
 
-	// 1. 레이가 현재 노드와 겹치지 않으면 검사 생략.
-	if (CheckIntersectionRayBox(WorldRay, Node->GetBoundingBox()) == false) { return false; }
+	bool bIsFound = false;
+	TArray<int32> VisitingNodes;
+	VisitingNodes.push_back(Octree->GetRootIndex());
 
-	// 2. 현재 노드와 레이가 교차하므로, 이 노드에 직접 포함된 프리미티브들을 후보에 추가합니다.
-	const auto& CurrentNodePrimitives = Node->GetPrimitives();
-	if (!CurrentNodePrimitives.empty())
+	while (!VisitingNodes.empty())
 	{
-		OutCandidate.insert(OutCandidate.end(), CurrentNodePrimitives.begin(), CurrentNodePrimitives.end());
-	}
+		const FOctreeNode& Node = Octree->GetNode(VisitingNodes.back());
+		VisitingNodes.pop_back();
 
-	// 3. 리프 노드가 아니라면, 자식 노드를 재귀적으로 탐색합니다.
-	if (!Node->IsLeafNode())
-	{
-		for (FOctree* Child : Node->GetChildren())
+		// 1. 레이가 현재 노드의 느슨한 경계와 겹치지 않으면 검사 생략.
+		if (CheckIntersectionRayBox(WorldRay, Node.LooseBounds) == false) { continue; }
+		bIsFound = true;
+
+		// 2. 현재 노드와 레이가 교차하므로, 이 노드에 직접 포함된 프리미티브들을 후보에 추가합니다.
+		for (const FOctreeElement& Element : Node.Elements)
 		{
-			FindCandidateFromOctree(Child, WorldRay, OutCandidate);
+			OutCandidate.push_back(Element.Primitive);
+		}
+
+		// 3. 존재하는 자식 노드를 탐색 대상에 추가합니다.
+		for (int32 Octant = 0; Octant < 8; ++Octant)
+		{
+			if (Node.HasChild(Octant)) { VisitingNodes.push_back(Node.Children[Octant]); }
 		}
 	}
 
-	return true;
+	return bIsFound;
 }
 
 void UObjectPicker::GatherCandidateTriangles(UPrimitiveComponent* Primitive, const FRay& ModelRay, TArray<int32>& OutCandidateIndices)
@@ -66,7 +66,7 @@ public:
 private:
 	void SetIndices();
 
-	void TraverseOctree(const FOctree* InNode);
+	void TraverseOctree(const FOctree* InOctree);
 
 	/*void AddWorldGridVerticesAndConstData();
 	void AddBoundingBoxVertices();*/
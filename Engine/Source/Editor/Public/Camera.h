@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Public/Object.h"
+#include "Optimization/Public/OcclusionCuller.h"
 #include "Optimization/Public/ViewVolumeCuller.h"
 
 class UConfigManager;
@@ -66,6 +67,7 @@ public:
 	float GetOrthoWidth() const { return OrthoWidth; }
 	ECameraType GetCameraType() const { return CameraType; }
 	ViewVolumeCuller& GetViewVolumeCuller() { return ViewVolumeCuller; }
+	COcclusionCuller& GetOcclusionCuller() { return OcclusionCuller; }
 
 
 	// Camera Movement Speed Control
@@ -108,6 +110,9 @@ private:
 	// 절두체 컬링을 이용한 최적화
 	ViewVolumeCuller ViewVolumeCuller;
 
+	// 절두체 컬링 결과 중 다른 물체에 가려진 프리미티브 제거
+	COcclusionCuller OcclusionCuller;
+
 	// Dynamic Movement Speed
 	float CurrentMoveSpeed = DEFAULT_SPEED;
 };
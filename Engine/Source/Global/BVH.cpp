@@ -25,61 +25,43 @@ void FBVH::Clear()
 {
 	Mesh = nullptr;
 	Nodes.clear();
+	TriangleBaseIndices.clear();
+	WideNodes.clear();
+	LeafTriangleVertices.clear();
 	RootIndex = -1;
+	LeafCount = 0;
+	MaxDepth = 0;
 	Cost = 0.0f;
 }
 
-int32 FBVH::InsertLeaf(int32 InTriangleBaseIndex)
+namespace
 {
-	if(!Mesh)
+	float GetAxisValue(const FVector& InVector, int32 InAxis)
 	{
-		std::cerr << "FBVH::InsertLeaf: Mesh is null. Cannot insert leaf node." << std::endl;
-		return -1;
+		return InAxis == 0 ? InVector.X : (InAxis == 1 ? InVector.Y : InVector.Z);
 	}
 
-	if(InTriangleBaseIndex < 0 || InTriangleBaseIndex + 2 >= Mesh->Indices.size() || InTriangleBaseIndex % 3 != 0)
+	void ExpandBounds(FVector& InOutMin, FVector& InOutMax, const FVector& InMin, const FVector& InMax)
 	{
-		std::cerr << "FBVH::InsertLeaf: Invalid triangle base index." << std::endl;
-		return -1;
+		InOutMin.X = std::min(InOutMin.X, InMin.X);
+		InOutMin.Y = std::min(InOutMin.Y, InMin.Y);
+		InOutMin.Z = std::min(InOutMin.Z, InMin.Z);
+		InOutMax.X = std::max(InOutMax.X, InMax.X);
+		InOutMax.Y = std::max(InOutMax.Y, InMax.Y);
+		InOutMax.Z = std::max(InOutMax.Z, InMax.Z);
 	}
 
-	// 1. 새 Leaf node의 AABB 계산
-	FNormalVertex V0 = Mesh->Vertices[Mesh->Indices[InTriangleBaseIndex]];
-	FNormalVertex V1 = Mesh->Vertices[Mesh->Indices[InTriangleBaseIndex + 1]];
-	FNormalVertex V2 = Mesh->Vertices[Mesh->Indices[InTriangleBaseIndex + 2]];
-	FAABB LeafAABB = GetTriangleAABB(V0, V1, V2);
-
-	// 2. 새 Leaf node 생성
-	FNode NewNode;
-	NewNode.ObjectIndex = static_cast<int32>(Nodes.size());
-	NewNode.ParentIndex = -1; // Parent는 InsertInternalNode에서 설정
-	NewNode.Child1 = -1;
-	NewNode.Child2 = -1;
-	NewNode.bIsLeaf = true;
-	NewNode.Box = LeafAABB;
-	NewNode.TriangleBaseIndex = InTriangleBaseIndex;
-	// 빈 트리인 경우 새 노드를 루트로 설정하고 종료
-	if (NewNode.ObjectIndex == 0)
+	float GetBoundsSurfaceArea(const FVector& InMin, const FVector& InMax)
 	{
-		Nodes.push_back(NewNode);
-		RootIndex = 0;
-		Cost = GetCost(RootIndex);
-		return 0;
+		const FVector Extent = InMax - InMin;
+		return 2.f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
 	}
 
-	// 3. 새 Leaf node를 삽입할 최적의 sibling node 찾기;
-	int32 SiblingIndex = FindBestSibling(NewNode.Box);
-
-	// 4. 새 leaf node와 sibling의 새로운 부모 node 생성
-	Nodes.push_back(NewNode);
-	InsertInternalNode(NewNode.ObjectIndex, SiblingIndex);
-
-	// 5. 새 node가 추가되었으므로 부모 거슬러올라가며 AABB 리피팅
-	// NewNode의 부모가 InsertInternalNode에서 설정했고, 부모의 AABB도 끝내둠.
-	// 리핏은 ParentIndex부터 시작
-	RefitAncestors(Nodes[SiblingIndex].ParentIndex);
-
-	return NewNode.ObjectIndex;
+	int32 GetBinIndex(float InCentroid, float InCentroidMin, float InBinScale, int32 InBinCount)
+	{
+		const int32 Bin = static_cast<int32>((InCentroid - InCentroidMin) * InBinScale);
+		return std::clamp(Bin, 0, InBinCount - 1);
+	}
 }
 
 float FBVH::GetCost(int32 SubTreeRootIndex, bool bInternalOnly) const
@@ -90,226 +72,36 @@ float FBVH::GetCost(int32 SubTreeRootIndex, bool bInternalOnly) const
 		return 0.0f;
 	}
 
-	const FNode& SubTreeRoot = Nodes[SubTreeRootIndex];
-	if (SubTreeRoot.bIsLeaf)
-	{
-		// InternalOnly면 leaf node의 cost는 0으로 계산
-		// 새 노드 삽입시 최적 위치 계산하는 경우는 leaf node의 cost가 상수이기 때문
-		if (bInternalOnly)
-		{
-			return 0.0f;
-		}
-
-		return SubTreeRoot.Box.GetSurfaceArea();
-	}
-
-	return SubTreeRoot.Box.GetSurfaceArea() + GetCost(SubTreeRoot.Child1, bInternalOnly) + GetCost(SubTreeRoot.Child2, bInternalOnly);
-}
-
-int32 FBVH::FindBestSibling(const FAABB& NewLeafAABB)
-{
-	int32 BestSiblingIndex = -1;
-	float MinCostIncrease = FLT_MAX;
-
-	// Branch and Bound 최적화를 위한 스택 기반 순회
-	// 루트부터 시작하여 더 나은 후보가 있을 수 있는 노드들만 방문
-	TArray<int32> CandidateStack;
-	CandidateStack.push_back(RootIndex);
-
-	while (!CandidateStack.empty())
+	// 퇴화한 메시에서는 트리 깊이가 삼각형 수에 가까워질 수 있으므로 재귀 대신 스택으로 순회
+	float TotalCost = 0.0f;
+	TArray<int32> NodeStack;
+	NodeStack.push_back(SubTreeRootIndex);
+	while (!NodeStack.empty())
 	{
-		int32 CurrentIndex = CandidateStack.back();
-		CandidateStack.pop_back();
-
-		if (CurrentIndex < 0 || CurrentIndex >= static_cast<int32>(Nodes.size()))
+		const int32 NodeIndex = NodeStack.back();
+		NodeStack.pop_back();
+		if (NodeIndex < 0 || NodeIndex >= static_cast<int32>(Nodes.size()))
 		{
 			continue;
 		}
 
-		const FNode& CurrentNode = Nodes[CurrentIndex];
-		FAABB CombinedAABB = Union(NewLeafAABB, CurrentNode.Box);
-
-		// 하한 비용 계산: 이 서브트리의 어떤 리프를 선택하더라도 최소한 발생하는 '증가' 비용
-		float DirectIncrease = CombinedAABB.GetSurfaceArea() - CurrentNode.Box.GetSurfaceArea();
-		float InheritedIncrease = 0.0f;
-		int32 AncestorIndex = CurrentNode.ParentIndex;
-		int32 CurrentChildIndex = CurrentIndex;
-		FAABB CurrentAABB = CombinedAABB;
-		while(AncestorIndex != -1)
-		{
-			const FNode& AncestorNode = Nodes[AncestorIndex];
-			int32 SiblingOfCurrentChildIndex = (AncestorNode.Child1 == CurrentChildIndex)
-				? AncestorNode.Child2
-				: AncestorNode.Child1;
-			const FNode& SiblingOfCurrentChild = Nodes[SiblingOfCurrentChildIndex];
-
-			FAABB AncestorNewAABB = Union(SiblingOfCurrentChild.Box, CurrentAABB);
-			InheritedIncrease += AncestorNewAABB.GetSurfaceArea() - AncestorNode.Box.GetSurfaceArea();
-			AncestorIndex = AncestorNode.ParentIndex;
-			CurrentChildIndex = AncestorNode.ObjectIndex;
-			CurrentAABB = AncestorNewAABB;
-		}
-		float LowerBoundIncrease = DirectIncrease + InheritedIncrease;
-
-		// 하한 비용이 현재 최적 증가 비용 이상이면 이 서브트리에서는 더 나은 해를 찾을 수 없으므로 탐색 중단
-		if (LowerBoundIncrease >= MinCostIncrease)
-		{
-			continue; // 조기 포기
-		}
-
-		if (CurrentNode.bIsLeaf)
+		const FNode& Node = Nodes[NodeIndex];
+		if (Node.bIsLeaf)
 		{
-			// 리프 노드인 경우: 전체 비용 증가 계산
-			float TotalCostIncrease = CalculateCostIncrease(CurrentIndex, NewLeafAABB);
-
-			if (TotalCostIncrease < MinCostIncrease)
+			// InternalOnly면 leaf node의 cost는 0으로 계산
+			// 새 노드 삽입시 최적 위치 계산하는 경우는 leaf node의 cost가 상수이기 때문
+			if (!bInternalOnly)
 			{
-				MinCostIncrease = TotalCostIncrease;
-				BestSiblingIndex = CurrentIndex;
-			}
-		}
-		else
-		{
-			// 내부 노드인 경우: 자식들을 스택에 추가
-			// 하지만 Lower Bound가 현재 최적해보다 좋을 때만
-
-			if (LowerBoundIncrease < MinCostIncrease)
-			{
-				// 자식 노드들을 후보에 추가
-				if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < static_cast<int32>(Nodes.size()))
-				{
-					CandidateStack.push_back(CurrentNode.Child1);
-				}
-				if (CurrentNode.Child2 >= 0 && CurrentNode.Child2 < static_cast<int32>(Nodes.size()))
-				{
-					CandidateStack.push_back(CurrentNode.Child2);
-				}
+				TotalCost += Node.Box.GetSurfaceArea();
 			}
-			// else: 이 서브트리는 더 이상 탐색하지 않음 (Bound)
+			continue;
 		}
-	}
-
-	return BestSiblingIndex;
-}
-
-float FBVH::CalculateCostIncrease(int32 CandidateIndex, const FAABB& NewLeafAABB) const
-{
-	if (CandidateIndex < 0 || CandidateIndex >= static_cast<int32>(Nodes.size()))
-	{
-		return FLT_MAX;
-	}
 
-	const FNode& CandidateNode = Nodes[CandidateIndex];
-	const FAABB& SiblingAABB = CandidateNode.Box;
-
-	// 새 리프와 sibling을 묶는 새 internal node의 AABB 계산
-	FAABB CombinedAABB = Union(NewLeafAABB, SiblingAABB);
-
-	// Cost 증가 계산: 새 internal node의 surface area
-	// (기존 sibling의 cost는 leaf이므로 변화 없음)
-	float CostIncrease = CombinedAABB.GetSurfaceArea();
-
-	// Sibling이 가지고 있던 부모 노드가 있다면
-	// 부모부터 루트까지 올라가며 추가 cost 계산
-	int32 AncestorIndex = CandidateNode.ParentIndex;
-	int32 CurrentChildIndex = CandidateIndex;
-	FAABB CurrentAABB = CombinedAABB;
-	while (AncestorIndex != -1 && AncestorIndex < static_cast<int32>(Nodes.size()))
-	{
-		const FNode& AncestorNode = Nodes[AncestorIndex];
-
-		// 형제 노드의 AABB와 합쳐서 새로운 조상 AABB 계산
-		int32 SiblingOfCurrentChildIndex = (AncestorNode.Child1 == CurrentChildIndex)
-			? AncestorNode.Child2
-			: AncestorNode.Child1;
-
-		if (SiblingOfCurrentChildIndex >= 0 && SiblingOfCurrentChildIndex < static_cast<int32>(Nodes.size()))
-		{
-			const FAABB& SiblingOfCurrentChild = Nodes[SiblingOfCurrentChildIndex].Box;
-			FAABB NewAncestorAABB = Union(CurrentAABB, SiblingOfCurrentChild);
-			CostIncrease += NewAncestorAABB.GetSurfaceArea() - AncestorNode.Box.GetSurfaceArea();
-			CurrentAABB = NewAncestorAABB;
-		}
-		
-		CurrentChildIndex = AncestorIndex;
-		AncestorIndex = AncestorNode.ParentIndex;
+		TotalCost += Node.Box.GetSurfaceArea();
+		NodeStack.push_back(Node.Child2);
+		NodeStack.push_back(Node.Child1);
 	}
-
-	return CostIncrease;
-}
-
-void FBVH::InsertInternalNode(int32 NewLeafIndex, int32 SiblingIndex)
-{
-	// 새 부모(Internal) 노드 구성
-	FNode NewParent;
-	int32 OldParentIndex = Nodes[SiblingIndex].ParentIndex;
-	NewParent.ParentIndex = OldParentIndex;
-	NewParent.Child1 = SiblingIndex;
-	NewParent.Child2 = NewLeafIndex;
-	NewParent.bIsLeaf = false;
-	NewParent.TriangleBaseIndex = -1; // Internal 노드는 삼각형 인덱스 없음
-
-	// 부모 AABB는 두 자식의 합집합
-	FAABB NewLeafAABB = Nodes[NewLeafIndex].Box;
-	FAABB SiblingAABB = Nodes[SiblingIndex].Box;
-	NewParent.Box = Union(NewLeafAABB, SiblingAABB);
-
-	// 새 부모 노드를 push하고 인덱스 확정
-	int32 NewParentIndex = static_cast<int32>(Nodes.size());
-	NewParent.ObjectIndex = NewParentIndex;
-	Nodes.push_back(NewParent);
-
-	// 자식들의 부모 갱신
-	Nodes[SiblingIndex].ParentIndex = NewParentIndex;
-	Nodes[NewLeafIndex].ParentIndex = NewParentIndex;
-
-	// 이전 부모가 있었다면 그 부모의 자식 포인터를 새 부모로 교체
-	if (OldParentIndex != -1)
-	{
-		FNode& OldParent = Nodes[OldParentIndex];
-		if (OldParent.Child1 == SiblingIndex)
-		{
-			OldParent.Child1 = NewParentIndex;
-		}
-		else if (OldParent.Child2 == SiblingIndex)
-		{
-			OldParent.Child2 = NewParentIndex;
-		}
-		else
-		{
-			// 혹시 모를 오류 (OldParent가 SiblingIndex를 자식으로 가지고 있지 않는 경우) 대비
-			throw std::runtime_error("OldParent does not reference SiblingIndex as a child.");
-		}
-	}
-	// sibling이 루트였던 경우, 새 부모가 루트가 됨
-	else
-	{
-		RootIndex = NewParentIndex;
-	}
-}
-
-void FBVH::RefitAncestors(int32 RefitStartIndex)
-{
-	// 시작점의 부모부터 루트까지 올라가며 InternalBox를 리핏
-	if (RefitStartIndex < 0 || RefitStartIndex >= static_cast<int32>(Nodes.size()))
-	{
-		return;
-	}
-
-	int32 CurrentIndex = Nodes[RefitStartIndex].ParentIndex; // 부모부터 시작
-	while (CurrentIndex != -1)
-	{
-		FNode& Current = Nodes[CurrentIndex];
-		// 두 자식의 AABB 합집합으로 현재 InternalBox 갱신
-		FAABB Child1AABB = Nodes[Current.Child1].Box;
-		FAABB Child2AABB = Nodes[Current.Child2].Box;
-		Current.Box = Union(Child1AABB, Child2AABB);
-
-		CurrentIndex = Current.ParentIndex;
-	}
-
-	// 전체 비용 갱신
-	Cost = GetCost(RootIndex);
+	return TotalCost;
 }
 
 bool FBVH::CheckValidity() const
@@ -339,9 +131,11 @@ bool FBVH::CheckValidity() const
 			{
 				return false;
 			}
-			if (Node.TriangleBaseIndex < 0 || Node.TriangleBaseIndex % 3 != 0)
+			// 리프 노드는 반드시 유효한 삼각형 범위를 가져야 함
+			if (Node.TriangleCount <= 0 || Node.FirstTriangle < 0 ||
+				Node.FirstTriangle + Node.TriangleCount > static_cast<int32>(TriangleBaseIndices.size()))
 			{
-				return false; // 리프 노드는 반드시 유효한 인덱스 배열의 인덱스를 가져야 함
+				return false;
 			}
 		}
 		else // Internal Node 인 경우 자식이 있어야 함
@@ -350,9 +144,13 @@ bool FBVH::CheckValidity() const
 			{
 				return false;
 			}
-			if (Node.TriangleBaseIndex != -1)
+			if (Node.TriangleCount != 0)
 			{
-				return false; // 내부 노드는 인덱스를 가져선 안됨
+				return false; // 내부 노드는 삼각형을 가져선 안됨
+			}
+			if (Node.Child1 != i + 1)
+			{
+				return false; // DFS 순서 배치에서 첫 번째 자식은 항상 바로 다음 노드
 			}
 			// 자식 노드들이 올바른 부모 인덱스를 가리키는지 확인
 			if (Node.Child1 < 0 || Node.Child1 >= static_cast<int32>(Nodes.size()) ||
@@ -434,20 +232,23 @@ bool FBVH::TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const
 			// BVH 외부에서는 삼각형 인덱스 = 인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호를 의미하므로(Triangle ordinal)
 			// 의미 통일을 위해 외부 반환시 3으로 나누어 사용
 			// ------------------------------------------------------------------------------------
-			OutTriangleIndices.push_back(CurrentNode.TriangleBaseIndex / 3);
+			for (int32 i = 0; i < CurrentNode.TriangleCount; ++i)
+			{
+				OutTriangleIndices.push_back(TriangleBaseIndices[CurrentNode.FirstTriangle + i] / 3);
+			}
 		}
 		else
 		{
 			// 내부 노드인 경우 자식들을 스택에 추가
-			// 자식 인덱스가 유효한지 확인
-			if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < static_cast<int32>(Nodes.size()))
-			{
-				NodeStack.push_back(CurrentNode.Child1);
-			}
+			// Child1(바로 다음 노드)을 먼저 방문하도록 Child2를 먼저 push
 			if (CurrentNode.Child2 >= 0 && CurrentNode.Child2 < static_cast<int32>(Nodes.size()))
 			{
 				NodeStack.push_back(CurrentNode.Child2);
 			}
+			if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < static_cast<int32>(Nodes.size()))
+			{
+				NodeStack.push_back(CurrentNode.Child1);
+			}
 		}
 	}
 	
@@ -463,13 +264,161 @@ void FBVH::Build(FStaticMesh* InMesh)
 	}
 	Clear();
 	Mesh = InMesh;
-	// 모든 삼각형에 대해 Leaf 노드 삽입
-	int32 TriangleCount = static_cast<int32>(Mesh->Indices.size()) / 3;
+
+	const int32 TriangleCount = static_cast<int32>(Mesh->Indices.size()) / 3;
+	if (TriangleCount == 0)
+	{
+		return;
+	}
+
+	// 1. 삼각형별 AABB와 중심점 계산
+	TArray<FBuildTriangle> Triangles(TriangleCount);
 	for (int32 i = 0; i < TriangleCount; ++i)
 	{
-		int32 TriangleBaseIndex = i * 3;
-		InsertLeaf(TriangleBaseIndex);
+		const FVector& P0 = Mesh->Vertices[Mesh->Indices[i * 3]].Position;
+		const FVector& P1 = Mesh->Vertices[Mesh->Indices[i * 3 + 1]].Position;
+		const FVector& P2 = Mesh->Vertices[Mesh->Indices[i * 3 + 2]].Position;
+
+		FBuildTriangle& Triangle = Triangles[i];
+		Triangle.Min = FVector(std::min({ P0.X, P1.X, P2.X }), std::min({ P0.Y, P1.Y, P2.Y }), std::min({ P0.Z, P1.Z, P2.Z }));
+		Triangle.Max = FVector(std::max({ P0.X, P1.X, P2.X }), std::max({ P0.Y, P1.Y, P2.Y }), std::max({ P0.Z, P1.Z, P2.Z }));
+		Triangle.Centroid = (Triangle.Min + Triangle.Max) * 0.5f;
+		Triangle.BaseIndex = i * 3;
 	}
+
+	// 2. 스택 기반 top-down 분할
+	// 왼쪽 자식을 나중에 push하여 먼저 꺼내므로, 노드는 pop 시점에 할당되면서 DFS pre-order로 배치된다
+	struct FBuildTask
+	{
+		int32 Begin;
+		int32 End;
+		int32 ParentIndex;
+		int32 Depth;
+		bool bIsSecondChild;
+	};
+
+	Nodes.reserve(static_cast<size_t>(TriangleCount) * 2);
+	TArray<FBuildTask> TaskStack;
+	TaskStack.push_back({ 0, TriangleCount, -1, 0, false });
+
+	while (!TaskStack.empty())
+	{
+		const FBuildTask Task = TaskStack.back();
+		TaskStack.pop_back();
+
+		// 범위의 AABB와 중심점 AABB 계산
+		FVector BoundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		FVector CentroidMin(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector CentroidMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (int32 i = Task.Begin; i < Task.End; ++i)
+		{
+			ExpandBounds(BoundsMin, BoundsMax, Triangles[i].Min, Triangles[i].Max);
+			ExpandBounds(CentroidMin, CentroidMax, Triangles[i].Centroid, Triangles[i].Centroid);
+		}
+
+		const int32 NodeIndex = static_cast<int32>(Nodes.size());
+		FNode NewNode;
+		NewNode.ObjectIndex = NodeIndex;
+		NewNode.ParentIndex = Task.ParentIndex;
+		NewNode.Child1 = -1;
+		NewNode.Child2 = -1;
+		NewNode.bIsLeaf = false;
+		NewNode.Box = FAABB(BoundsMin, BoundsMax);
+		NewNode.FirstTriangle = -1;
+		NewNode.TriangleCount = 0;
+		Nodes.push_back(NewNode);
+
+		if (Task.ParentIndex == -1)
+		{
+			RootIndex = NodeIndex;
+		}
+		else if (Task.bIsSecondChild)
+		{
+			Nodes[Task.ParentIndex].Child2 = NodeIndex;
+		}
+		else
+		{
+			Nodes[Task.ParentIndex].Child1 = NodeIndex;
+		}
+		MaxDepth = std::max(MaxDepth, Task.Depth);
+
+		// 분할 여부 결정: 분할 비용이 리프 비용보다 싸지 않으면 리프로 만든다
+		const int32 Count = Task.End - Task.Begin;
+		int32 SplitAxis = -1;
+		int32 SplitBin = -1;
+		bool bMakeLeaf = Count <= 1;
+		if (!bMakeLeaf)
+		{
+			const float SplitSAH = FindBestSplit(Triangles, Task.Begin, Task.End, CentroidMin, CentroidMax, SplitAxis, SplitBin);
+			const float NodeArea = GetBoundsSurfaceArea(BoundsMin, BoundsMax);
+			const float LeafCost = SAH_INTERSECTION_COST * static_cast<float>(Count);
+			const float SplitCost = (SplitAxis >= 0 && NodeArea > 0.0f)
+				? SAH_TRAVERSAL_COST + SAH_INTERSECTION_COST * SplitSAH / NodeArea
+				: FLT_MAX;
+			bMakeLeaf = Count <= MAX_LEAF_TRIANGLES && SplitCost >= LeafCost;
+		}
+
+		if (bMakeLeaf)
+		{
+			Nodes[NodeIndex].bIsLeaf = true;
+			Nodes[NodeIndex].FirstTriangle = Task.Begin;
+			Nodes[NodeIndex].TriangleCount = Count;
+			++LeafCount;
+			continue;
+		}
+
+		// 삼각형 분할: SAH 분할이 가능하면 bin 기준, 아니면(중심점이 모두 겹침 등) 가장 긴 축 기준 중앙값 분할
+		int32 Mid = Task.Begin;
+		if (SplitAxis >= 0)
+		{
+			const float AxisMin = GetAxisValue(CentroidMin, SplitAxis);
+			const float BinScale = static_cast<float>(SAH_BIN_COUNT) / (GetAxisValue(CentroidMax, SplitAxis) - AxisMin);
+			auto MidIter = std::partition(Triangles.begin() + Task.Begin, Triangles.begin() + Task.End,
+				[&](const FBuildTriangle& Triangle)
+				{
+					return GetBinIndex(GetAxisValue(Triangle.Centroid, SplitAxis), AxisMin, BinScale, SAH_BIN_COUNT) < SplitBin;
+				});
+			Mid = static_cast<int32>(MidIter - Triangles.begin());
+		}
+
+		if (Mid == Task.Begin || Mid == Task.End)
+		{
+			const FVector CentroidExtent = CentroidMax - CentroidMin;
+			int32 LongestAxis = 0;
+			if (CentroidExtent.Y > CentroidExtent.X) { LongestAxis = 1; }
+			if (CentroidExtent.Z > GetAxisValue(CentroidExtent, LongestAxis)) { LongestAxis = 2; }
+
+			Mid = Task.Begin + Count / 2;
+			std::nth_element(Triangles.begin() + Task.Begin, Triangles.begin() + Mid, Triangles.begin() + Task.End,
+				[LongestAxis](const FBuildTriangle& A, const FBuildTriangle& B)
+				{
+					return GetAxisValue(A.Centroid, LongestAxis) < GetAxisValue(B.Centroid, LongestAxis);
+				});
+		}
+
+		TaskStack.push_back({ Mid, Task.End, NodeIndex, Task.Depth + 1, true });
+		TaskStack.push_back({ Task.Begin, Mid, NodeIndex, Task.Depth + 1, false });
+	}
+
+	// 3. 분할이 끝난 삼각형 순서를 그대로 Leaf 참조 목록으로 사용
+	TriangleBaseIndices.resize(TriangleCount);
+	for (int32 i = 0; i < TriangleCount; ++i)
+	{
+		TriangleBaseIndices[i] = Triangles[i].BaseIndex;
+	}
+
+	// 4. Leaf 순서대로 삼각형 정점을 모아두고 BVH4로 축약 (피킹용 SIMD 순회)
+	LeafTriangleVertices.resize(static_cast<size_t>(TriangleCount) * 3);
+	for (int32 i = 0; i < TriangleCount; ++i)
+	{
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			LeafTriangleVertices[i * 3 + Corner] = Mesh->Vertices[Mesh->Indices[TriangleBaseIndices[i] + Corner]].Position;
+		}
+	}
+	BuildWideNodes();
+
 	// 전체 비용 계산
 	Cost = GetCost(RootIndex);
 	// 유효성 검사
@@ -479,3 +428,404 @@ void FBVH::Build(FStaticMesh* InMesh)
 	}
 }
 
+void FBVH::BuildWideNodes()
+{
+	WideNodes.clear();
+	if (RootIndex < 0)
+	{
+		return;
+	}
+
+	WideNodes.reserve(Nodes.size() / 2 + 1);
+
+	// 루트가 Leaf인 작은 메시는 Leaf 슬롯 하나짜리 노드로 감싼다
+	if (Nodes[RootIndex].bIsLeaf)
+	{
+		const FNode& Root = Nodes[RootIndex];
+		FWideNode WideRoot = {};
+		WideRoot.NumChildren = 1;
+		for (int32 Slot = 0; Slot < 4; ++Slot)
+		{
+			WideRoot.ChildIndex[Slot] = -1;
+		}
+		WideRoot.MinX[0] = Root.Box.Min.X; WideRoot.MinY[0] = Root.Box.Min.Y; WideRoot.MinZ[0] = Root.Box.Min.Z;
+		WideRoot.MaxX[0] = Root.Box.Max.X; WideRoot.MaxY[0] = Root.Box.Max.Y; WideRoot.MaxZ[0] = Root.Box.Max.Z;
+		WideRoot.ChildIndex[0] = Root.FirstTriangle;
+		WideRoot.TriangleCount[0] = Root.TriangleCount;
+		WideNodes.push_back(WideRoot);
+		return;
+	}
+
+	CollapseToWideNode(RootIndex);
+}
+
+int32 FBVH::CollapseToWideNode(int32 BinaryNodeIndex)
+{
+	// 퇴화한 메시에서도 호출 스택이 넘치지 않도록 (이진 노드, 부모 BVH4 노드, 슬롯) 작업을 스택으로 처리한다
+	// 자식을 역순으로 push하므로 WideNodes는 재귀 축약과 같은 DFS pre-order로 배치된다
+	struct FCollapseTask
+	{
+		int32 BinaryNodeIndex;
+		int32 ParentWideIndex;
+		int32 ParentSlot;
+	};
+
+	const int32 RootWideIndex = static_cast<int32>(WideNodes.size());
+	TArray<FCollapseTask> TaskStack;
+	TaskStack.push_back({ BinaryNodeIndex, -1, -1 });
+	while (!TaskStack.empty())
+	{
+		const FCollapseTask Task = TaskStack.back();
+		TaskStack.pop_back();
+
+		const int32 WideIndex = static_cast<int32>(WideNodes.size());
+		if (Task.ParentWideIndex >= 0)
+		{
+			WideNodes[Task.ParentWideIndex].ChildIndex[Task.ParentSlot] = WideIndex;
+		}
+		WideNodes.push_back(CollapseSlots(Task.BinaryNodeIndex));
+
+		const FWideNode& WideNode = WideNodes[WideIndex];
+		for (int32 Slot = WideNode.NumChildren - 1; Slot >= 0; --Slot)
+		{
+			if (WideNode.TriangleCount[Slot] == 0)
+			{
+				TaskStack.push_back({ WideNode.ChildIndex[Slot], WideIndex, Slot });
+			}
+		}
+	}
+	return RootWideIndex;
+}
+
+FWideNode FBVH::CollapseSlots(int32 BinaryNodeIndex) const
+{
+	// 1. 표면적이 가장 큰 Internal 자식을 펼치면서 최대 4개의 자식 슬롯을 모은다
+	int32 Slots[4] = { Nodes[BinaryNodeIndex].Child1, Nodes[BinaryNodeIndex].Child2, -1, -1 };
+	int32 SlotCount = 2;
+	while (SlotCount < 4)
+	{
+		int32 ExpandSlot = -1;
+		float LargestArea = -1.0f;
+		for (int32 Slot = 0; Slot < SlotCount; ++Slot)
+		{
+			const FNode& Candidate = Nodes[Slots[Slot]];
+			if (!Candidate.bIsLeaf && Candidate.Box.GetSurfaceArea() > LargestArea)
+			{
+				LargestArea = Candidate.Box.GetSurfaceArea();
+				ExpandSlot = Slot;
+			}
+		}
+
+		if (ExpandSlot < 0)
+		{
+			break; // 모든 슬롯이 Leaf
+		}
+
+		const FNode& Expanded = Nodes[Slots[ExpandSlot]];
+		Slots[SlotCount++] = Expanded.Child2;
+		Slots[ExpandSlot] = Expanded.Child1;
+	}
+
+	// 2. Internal 슬롯은 이진 노드 인덱스를 담아 두고, CollapseToWideNode가 BVH4 인덱스로 바꾼다
+	FWideNode WideNode = {};
+	WideNode.NumChildren = SlotCount;
+	for (int32 Slot = 0; Slot < 4; ++Slot)
+	{
+		if (Slot >= SlotCount)
+		{
+			WideNode.MinX[Slot] = WideNode.MinY[Slot] = WideNode.MinZ[Slot] = FLT_MAX;
+			WideNode.MaxX[Slot] = WideNode.MaxY[Slot] = WideNode.MaxZ[Slot] = -FLT_MAX;
+			WideNode.ChildIndex[Slot] = -1;
+			WideNode.TriangleCount[Slot] = 0;
+			continue;
+		}
+
+		const FNode& Child = Nodes[Slots[Slot]];
+		WideNode.MinX[Slot] = Child.Box.Min.X;
+		WideNode.MinY[Slot] = Child.Box.Min.Y;
+		WideNode.MinZ[Slot] = Child.Box.Min.Z;
+		WideNode.MaxX[Slot] = Child.Box.Max.X;
+		WideNode.MaxY[Slot] = Child.Box.Max.Y;
+		WideNode.MaxZ[Slot] = Child.Box.Max.Z;
+
+		if (Child.bIsLeaf)
+		{
+			WideNode.ChildIndex[Slot] = Child.FirstTriangle;
+			WideNode.TriangleCount[Slot] = Child.TriangleCount;
+		}
+		else
+		{
+			WideNode.ChildIndex[Slot] = Slots[Slot];
+			WideNode.TriangleCount[Slot] = 0;
+		}
+	}
+	return WideNode;
+}
+
+bool FBVH::RaycastNearest(const FRay& Ray, FBVHRayHit& OutHit) const
+{
+	if (WideNodes.empty())
+	{
+		return false;
+	}
+
+	const FVector Origin(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z);
+	const FVector Direction(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z);
+
+	// 축과 평행한 Ray에서 0으로 나누지 않도록 아주 작은 값으로 대체
+	auto SafeInverse = [](float Value)
+	{
+		return 1.0f / (std::fabs(Value) > 1e-20f ? Value : (Value >= 0.0f ? 1e-20f : -1e-20f));
+	};
+
+	const __m128 OriginX = _mm_set1_ps(Origin.X);
+	const __m128 OriginY = _mm_set1_ps(Origin.Y);
+	const __m128 OriginZ = _mm_set1_ps(Origin.Z);
+	const __m128 InvDirX = _mm_set1_ps(SafeInverse(Direction.X));
+	const __m128 InvDirY = _mm_set1_ps(SafeInverse(Direction.Y));
+	const __m128 InvDirZ = _mm_set1_ps(SafeInverse(Direction.Z));
+	const __m128 Zero = _mm_setzero_ps();
+
+	float BestT = FLT_MAX;
+	int32 BestTriangle = -1;
+	float BestU = 0.0f;
+	float BestV = 0.0f;
+
+	// 보통은 BVH4 깊이 * 3(한 번에 push되는 최대 자식 수)보다 충분히 큰 고정 스택으로 끝나고,
+	// 퇴화한 메시에서 넘치면 나머지는 동적 스택에 쌓는다 (고정 스택이 가득 찬 동안만 쓰므로 LIFO 순서가 유지된다)
+	constexpr int32 STACK_SIZE = 256;
+	int32 NodeStack[STACK_SIZE];
+	int32 StackSize = 0;
+	TArray<int32> OverflowStack;
+	NodeStack[StackSize++] = 0;
+
+	while (StackSize > 0 || !OverflowStack.empty())
+	{
+		int32 NodeIndex;
+		if (!OverflowStack.empty())
+		{
+			NodeIndex = OverflowStack.back();
+			OverflowStack.pop_back();
+		}
+		else
+		{
+			NodeIndex = NodeStack[--StackSize];
+		}
+		const FWideNode& Node = WideNodes[NodeIndex];
+
+		// 4개 자식 AABB에 대한 slab 검사를 한 번에 수행
+		const __m128 T0X = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinX), OriginX), InvDirX);
+		const __m128 T1X = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxX), OriginX), InvDirX);
+		const __m128 T0Y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinY), OriginY), InvDirY);
+		const __m128 T1Y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxY), OriginY), InvDirY);
+		const __m128 T0Z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinZ), OriginZ), InvDirZ);
+		const __m128 T1Z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxZ), OriginZ), InvDirZ);
+
+		const __m128 TNear = _mm_max_ps(
+			_mm_max_ps(_mm_min_ps(T0X, T1X), _mm_min_ps(T0Y, T1Y)),
+			_mm_max_ps(_mm_min_ps(T0Z, T1Z), Zero));
+		const __m128 TFar = _mm_min_ps(
+			_mm_min_ps(_mm_max_ps(T0X, T1X), _mm_max_ps(T0Y, T1Y)),
+			_mm_min_ps(_mm_max_ps(T0Z, T1Z), _mm_set1_ps(BestT)));
+
+		int32 HitMask = _mm_movemask_ps(_mm_cmple_ps(TNear, TFar)) & ((1 << Node.NumChildren) - 1);
+		if (HitMask == 0)
+		{
+			continue;
+		}
+
+		alignas(16) float NearDistances[4];
+		_mm_store_ps(NearDistances, TNear);
+
+		// Leaf 슬롯은 즉시 삼각형 검사, Internal 슬롯은 가까운 순서로 방문하도록 정렬 후 push
+		int32 InternalSlots[4];
+		int32 InternalCount = 0;
+		for (int32 Slot = 0; Slot < 4; ++Slot)
+		{
+			if ((HitMask & (1 << Slot)) == 0)
+			{
+				continue;
+			}
+
+			if (Node.TriangleCount[Slot] > 0)
+			{
+				const int32 First = Node.ChildIndex[Slot];
+				for (int32 i = First; i < First + Node.TriangleCount[Slot]; ++i)
+				{
+					float T, U, V;
+					if (IntersectRayTriangle(Origin, Direction, LeafTriangleVertices[i * 3], LeafTriangleVertices[i * 3 + 1],
+						LeafTriangleVertices[i * 3 + 2], T, U, V) && T < BestT)
+					{
+						BestT = T;
+						BestU = U;
+						BestV = V;
+						BestTriangle = TriangleBaseIndices[i] / 3;
+					}
+				}
+			}
+			else
+			{
+				InternalSlots[InternalCount++] = Slot;
+			}
+		}
+
+		// 먼 자식을 먼저 push해야 가까운 자식이 먼저 pop 됨 (삽입 정렬, 최대 4개)
+		for (int32 i = 1; i < InternalCount; ++i)
+		{
+			const int32 Key = InternalSlots[i];
+			int32 j = i - 1;
+			while (j >= 0 && NearDistances[InternalSlots[j]] < NearDistances[Key])
+			{
+				InternalSlots[j + 1] = InternalSlots[j];
+				--j;
+			}
+			InternalSlots[j + 1] = Key;
+		}
+
+		for (int32 i = 0; i < InternalCount; ++i)
+		{
+			if (StackSize < STACK_SIZE)
+			{
+				NodeStack[StackSize++] = Node.ChildIndex[InternalSlots[i]];
+			}
+			else
+			{
+				OverflowStack.push_back(Node.ChildIndex[InternalSlots[i]]);
+			}
+		}
+	}
+
+	if (BestTriangle < 0)
+	{
+		return false;
+	}
+
+	OutHit.TriangleIndex = BestTriangle;
+	OutHit.Distance = BestT;
+	OutHit.U = BestU;
+	OutHit.V = BestV;
+	return true;
+}
+
+bool IntersectRayTriangle(const FVector& Origin, const FVector& Direction,
+	const FVector& V0, const FVector& V1, const FVector& V2, float& OutT, float& OutU, float& OutV)
+{
+	const FVector Edge1 = V1 - V0;
+	const FVector Edge2 = V2 - V0;
+
+	// FVector::Cross는 표준 외적과 부호가 반대지만, 행렬식과 분자가 함께 뒤집히므로 U/V/T는 동일
+	const FVector P = Direction.Cross(Edge2);
+	const float Determinant = Edge1.Dot(P);
+	if (std::fabs(Determinant) < 1e-12f)
+	{
+		return false; // Ray가 삼각형 평면과 평행
+	}
+
+	const float InvDeterminant = 1.0f / Determinant;
+	const FVector S = Origin - V0;
+	const float U = S.Dot(P) * InvDeterminant;
+	if (U < 0.0f || U > 1.0f)
+	{
+		return false;
+	}
+
+	const FVector Q = S.Cross(Edge1);
+	const float V = Direction.Dot(Q) * InvDeterminant;
+	if (V < 0.0f || U + V > 1.0f)
+	{
+		return false;
+	}
+
+	const float T = Edge2.Dot(Q) * InvDeterminant;
+	if (T < 0.0f)
+	{
+		return false;
+	}
+
+	OutT = T;
+	OutU = U;
+	OutV = V;
+	return true;
+}
+
+float FBVH::FindBestSplit(const TArray<FBuildTriangle>& Triangles, int32 Begin, int32 End,
+	const FVector& CentroidMin, const FVector& CentroidMax, int32& OutAxis, int32& OutSplitBin) const
+{
+	struct FBin
+	{
+		FVector Min = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		int32 Count = 0;
+	};
+
+	OutAxis = -1;
+	OutSplitBin = -1;
+	float BestCost = FLT_MAX;
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float AxisMin = GetAxisValue(CentroidMin, Axis);
+		const float AxisExtent = GetAxisValue(CentroidMax, Axis) - AxisMin;
+		if (AxisExtent <= MATH_EPSILON)
+		{
+			continue; // 이 축으로는 중심점이 구분되지 않음
+		}
+
+		// 1. 삼각형을 bin에 분배
+		FBin Bins[SAH_BIN_COUNT];
+		const float BinScale = static_cast<float>(SAH_BIN_COUNT) / AxisExtent;
+		for (int32 i = Begin; i < End; ++i)
+		{
+			const FBuildTriangle& Triangle = Triangles[i];
+			FBin& Bin = Bins[GetBinIndex(GetAxisValue(Triangle.Centroid, Axis), AxisMin, BinScale, SAH_BIN_COUNT)];
+			ExpandBounds(Bin.Min, Bin.Max, Triangle.Min, Triangle.Max);
+			++Bin.Count;
+		}
+
+		// 2. 오른쪽에서 왼쪽으로 누적하여 각 분할 평면 오른쪽의 면적과 개수 계산
+		float RightArea[SAH_BIN_COUNT];
+		int32 RightCount[SAH_BIN_COUNT];
+		FVector AccumMin(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector AccumMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		int32 AccumCount = 0;
+		for (int32 Bin = SAH_BIN_COUNT - 1; Bin > 0; --Bin)
+		{
+			if (Bins[Bin].Count > 0)
+			{
+				ExpandBounds(AccumMin, AccumMax, Bins[Bin].Min, Bins[Bin].Max);
+				AccumCount += Bins[Bin].Count;
+			}
+			RightArea[Bin] = AccumCount > 0 ? GetBoundsSurfaceArea(AccumMin, AccumMax) : 0.0f;
+			RightCount[Bin] = AccumCount;
+		}
+
+		// 3. 왼쪽에서 오른쪽으로 누적하면서 분할 비용 평가
+		AccumMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		AccumMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		AccumCount = 0;
+		for (int32 Bin = 1; Bin < SAH_BIN_COUNT; ++Bin)
+		{
+			if (Bins[Bin - 1].Count > 0)
+			{
+				ExpandBounds(AccumMin, AccumMax, Bins[Bin - 1].Min, Bins[Bin - 1].Max);
+				AccumCount += Bins[Bin - 1].Count;
+			}
+
+			if (AccumCount == 0 || RightCount[Bin] == 0)
+			{
+				continue;
+			}
+
+			const float SplitCost = GetBoundsSurfaceArea(AccumMin, AccumMax) * static_cast<float>(AccumCount) +
+				RightArea[Bin] * static_cast<float>(RightCount[Bin]);
+			if (SplitCost < BestCost)
+			{
+				BestCost = SplitCost;
+				OutAxis = Axis;
+				OutSplitBin = Bin;
+			}
+		}
+	}
+
+	return BestCost;
+}
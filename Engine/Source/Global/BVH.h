@@ -9,11 +9,41 @@ struct FNode
 {
 	int32 ObjectIndex;
 	int32 ParentIndex;
-	int32 Child1;
+	int32 Child1; // DFS 순서로 평탄화되어 있으므로 내부 노드의 Child1은 항상 ObjectIndex + 1
 	int32 Child2;
 	bool bIsLeaf;
 	FAABB Box;
-	int32 TriangleBaseIndex; // �ε��� ���ۿ��� �ﰢ���� ���� �ε���
+	int32 FirstTriangle; // Leaf: TriangleBaseIndices에서 시작 위치
+	int32 TriangleCount; // Leaf: 포함된 삼각형 개수 (Internal 노드는 0)
+};
+
+/**
+* @brief 4개의 자식을 SoA로 묶은 BVH4 노드. 한 번의 SSE slab 검사로 4개 자식을 동시에 검사한다.
+* @note 자식 슬롯은 앞에서부터 NumChildren개만 유효.
+* TriangleCount[i] > 0 이면 Leaf 슬롯(ChildIndex = TriangleBaseIndices 내 시작 위치), 0 이면 WideNodes 인덱스
+*/
+struct alignas(64) FWideNode
+{
+	float MinX[4];
+	float MinY[4];
+	float MinZ[4];
+	float MaxX[4];
+	float MaxY[4];
+	float MaxZ[4];
+	int32 ChildIndex[4];
+	int32 TriangleCount[4];
+	int32 NumChildren;
+};
+
+/**
+* @brief 최근접 Ray 충돌 결과 (메시 로컬 좌표계 기준)
+*/
+struct FBVHRayHit
+{
+	int32 TriangleIndex = -1; // Triangle ordinal (인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호)
+	float Distance = FLT_MAX; // Ray.Direction 방향으로의 거리 (t)
+	float U = 0.0f;
+	float V = 0.0f;
 };
 
 //  Phase Picking에 사용되는 BVH (Bounding Volume Hierarchy)
@@ -23,6 +53,10 @@ public:
 	FBVH() = default;
 	explicit FBVH(FStaticMesh* InMesh);
 
+	/**
+	* @brief 메시의 모든 삼각형으로 Binned SAH top-down 빌드를 수행.
+	* @note 노드는 DFS(pre-order) 순서로 한 번에 평탄화되며, Leaf는 최대 MAX_LEAF_TRIANGLES개의 삼각형을 가짐.
+	*/
 	void Build(FStaticMesh* InMesh);
 	int32 GetRootIndex() const { return RootIndex; }
 	int32 GetNodeCount() const { return Nodes.size(); }
@@ -52,34 +86,80 @@ public:
 	bool TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const;
 
 	/**
-	* @brief: 새 리프 노드를 특정 노드의 형제로 추가했을 때 전체 뉱업 트리의 비용 증가량 계산
-	* @param CandidateIndex: 후보 형제 노드 인덱스
-	* @param NewLeafAABB: 새로운 리프 노드의 AABB
-	* @return: 비용 증가량
+	* @brief: BVH4(WideNodes)를 SIMD로 순회하여 Ray와 가장 가까운 삼각형을 직접 찾음
+	* @param Ray: 교차 검사를 수행할 Ray (Local 좌표계, Direction은 정규화되어 있어야 Distance가 실제 거리)
+	* @param OutHit: 최근접 충돌 정보 (output)
+	* @return: 충돌한 삼각형이 있으면 true
 	*/
-	float CalculateCostIncrease(int32 CandidateIndex, const FAABB& NewLeafAABB) const;
+	bool RaycastNearest(const FRay& Ray, FBVHRayHit& OutHit) const;
+	bool HasWideNodes() const { return !WideNodes.empty(); }
+	int32 GetWideNodeCount() const { return static_cast<int32>(WideNodes.size()); }
+
+	// Leaf가 참조하는 삼각형 base index 목록 (Leaf의 FirstTriangle/TriangleCount 범위로 접근)
+	const TArray<int32>& GetTriangleBaseIndices() const { return TriangleBaseIndices; }
+	int32 GetLeafCount() const { return LeafCount; }
+	int32 GetMaxDepth() const { return MaxDepth; }
+
+	// Binned SAH 빌드 파라미터
+	static constexpr int32 SAH_BIN_COUNT = 16;
+	static constexpr int32 MAX_LEAF_TRIANGLES = 4;
+	static constexpr float SAH_TRAVERSAL_COST = 1.0f;
+	static constexpr float SAH_INTERSECTION_COST = 1.0f;
 
 private:
+	// 쿠킹 캐시가 평탄화된 노드 배열을 그대로 저장하고 복원한다
+	friend struct FStaticMeshCache;
+
 	/**
-	* @brief 새로운 leaf node를 삽입.
-	* @note cost가 가장 낮아지는 최적의 sibling node를 찾아서 삽입되도록 함.
-	* @return 삽입된 leaf node의 인덱스, 실패 시 -1 반환
+	* @brief 빌드 시 사용하는 삼각형 정보. FAABB(가상 함수 테이블 포함) 대신 평탄한 구조체를 사용
 	*/
-	int32 InsertLeaf(int32 InTriangleBaseIndex);
+	struct FBuildTriangle
+	{
+		FVector Min;
+		FVector Max;
+		FVector Centroid;
+		int32 BaseIndex;
+	};
 
-	// --- 새 leaf node 삽입 과정 보조 메소드들 ---
+	/**
+	* @brief [Begin, End) 범위의 삼각형을 나눌 최적 분할을 Binned SAH로 탐색.
+	* @param OutAxis: 분할 축 (분할할 수 없으면 -1)
+	* @param OutSplitBin: 이 bin 인덱스 미만은 왼쪽 자식으로 분류
+	* @return 분할 시 예상 비용 (SAH, 노드 표면적으로 정규화하기 전 값)
+	*/
+	float FindBestSplit(const TArray<FBuildTriangle>& Triangles, int32 Begin, int32 End,
+		const FVector& CentroidMin, const FVector& CentroidMax, int32& OutAxis, int32& OutSplitBin) const;
 
-	//@brief 새로운 leaf node가 추가되었을 때 cost가 가장 조금 증가하는 sibling node 탐색.
-	int32 FindBestSibling(const FAABB& NewLeafAABB);
-	//@brief 새로운 leaf node와 기존 sibling node를 묶는 internal node를 생성하고 트리에 삽입.
-	void InsertInternalNode(int32 LeafIndex, int32 SiblingIndex);
-	//@brief 주어진 노드의 '부모'부터 루트까지 올라가며 AABB Refit 수행.
-	void RefitAncestors(int32 RefitStartIndex);
+	/**
+	* @brief 이진 트리의 Internal 노드를 루트로 하는 서브트리를 BVH4로 축약.
+	* @note 재귀 없이 작업 스택으로 서브트리 전체를 DFS pre-order로 축약
+	* @return 서브트리 루트의 WideNodes 인덱스
+	*/
+	int32 CollapseToWideNode(int32 BinaryNodeIndex);
+
+	/**
+	* @brief Internal 노드 하나의 BVH4 슬롯을 만든다.
+	* @note 표면적이 가장 큰 Internal 자식을 반복적으로 펼쳐 최대 4개의 자식을 모음. Internal 슬롯의 ChildIndex는 이진 노드 인덱스
+	*/
+	FWideNode CollapseSlots(int32 BinaryNodeIndex) const;
+	void BuildWideNodes();
 
 	FStaticMesh* Mesh = nullptr; // BVH 원본 메시
 	TArray<FNode> Nodes;
+	TArray<int32> TriangleBaseIndices;
+	TArray<FWideNode> WideNodes;
+	TArray<FVector> LeafTriangleVertices; // TriangleBaseIndices 순서대로 미리 모아둔 삼각형 정점 (삼각형당 3개)
 	int32 RootIndex = -1;
+	int32 LeafCount = 0;
+	int32 MaxDepth = 0;
 	float Cost = 0.0f;
 };
 
-FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2);
\ No newline at end of file
+FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2);
+
+/**
+* @brief Moller-Trumbore Ray-삼각형 교차 검사
+* @param OutT: Ray 상의 충돌 거리, OutU/OutV: 무게중심 좌표
+*/
+bool IntersectRayTriangle(const FVector& Origin, const FVector& Direction,
+	const FVector& V0, const FVector& V1, const FVector& V2, float& OutT, float& OutU, float& OutV);
\ No newline at end of file
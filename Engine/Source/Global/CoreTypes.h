@@ -146,6 +146,22 @@ struct FNormalVertex
 	FVector Bitangent;
 };
 
+/**
+ * @brief FNormalVertex의 압축 정점 (20바이트), FVertexQuantizer가 쿠킹 시점에 만든다
+ * - Position: 메시 범위 기준 R16G16B16A16_UNORM, w는 바이텐전트 부호 (0 = -1, 65535 = +1)
+ * - Normal, Tangent: 8면체(octahedral) 인코딩 R16G16_SNORM
+ * - TexCoord: R16G16_FLOAT
+ * @note 범위 복원은 FStaticMesh::PackedPositionToLocal을 World에 곱해서 하므로 셰이더는 [0,1] 위치를 그대로 쓴다
+ */
+struct FPackedNormalVertex
+{
+	uint16 Position[4];
+	int16 Normal[2];
+	int16 Tangent[2];
+	uint16 TexCoord[2];
+};
+static_assert(sizeof(FPackedNormalVertex) == 20, "FPackedNormalVertex must match the PACKED_VERTEX input layout");
+
 struct FRay
 {
 	FVector4 Origin;
@@ -14,33 +14,43 @@ namespace
 
 		return FAABB(Min, Max);
 	}
+
+	/** @brief AABB의 중심과 가장 긴 축의 반경을 구한다 */
+	void GetCenterAndExtent(const FVector& InMin, const FVector& InMax, FVector& OutCenter, float& OutExtent)
+	{
+		OutCenter = (InMin + InMax) * 0.5f;
+		const FVector HalfSize = (InMax - InMin) * 0.5f;
+		OutExtent = std::max(HalfSize.X, std::max(HalfSize.Y, HalfSize.Z));
+	}
+
+	/** @brief 셀 반경이 InHalfSize인 노드에 반경 InExtent의 객체가 느슨한 경계 안에 들어가는지 확인 */
+	bool IsExtentFit(float InExtent, float InHalfSize)
+	{
+		return InExtent <= InHalfSize * (LOOSE_FACTOR - 1.0f);
+	}
 }
 
-FOctree::FOctree()
-	: BoundingBox(), Depth(0)
+FAABB FOctreeNode::GetCellBounds() const
 {
-	Children.resize(8);
+	const FVector Half(HalfSize, HalfSize, HalfSize);
+	return FAABB(Center - Half, Center + Half);
 }
 
-FOctree::FOctree(const FAABB& InBoundingBox, int InDepth)
-	: BoundingBox(InBoundingBox), Depth(InDepth)
+FOctree::FOctree()
+	: FOctree(FVector(0, 0, 0), 64.0f)
 {
-	Children.resize(8);
 }
 
-FOctree::FOctree(const FVector& InPosition, float InSize, int InDepth)
-	: Depth(InDepth)
+FOctree::FOctree(const FVector& InPosition, float InSize)
+	: InitialCenter(InPosition), InitialHalfSize(std::max(InSize * 0.5f, MIN_NODE_HALF_SIZE))
 {
-	const float HalfSize = InSize * 0.5f;
-	BoundingBox.Min = InPosition - FVector(HalfSize, HalfSize, HalfSize);
-	BoundingBox.Max = InPosition + FVector(HalfSize, HalfSize, HalfSize);
-	Children.resize(8);
+	Clear();
 }
 
 FOctree::~FOctree()
 {
-	Primitives.clear();
-	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+	NodePool.clear();
+	FreeNodeIndices.clear();
 }
 
 bool FOctree::Insert(UPrimitiveComponent* InPrimitive)
@@ -48,111 +58,234 @@ bool FOctree::Insert(UPrimitiveComponent* InPrimitive)
 	// nullptr 체크
 	if (!InPrimitive) { return false; }
 
-	// 0. 영역 내에 객체가 없으면 종료
-	if (BoundingBox.IsIntersected(GetPrimitiveBoundingBox(InPrimitive)) == false) { return false; }
+	return Insert(InPrimitive, GetPrimitiveBoundingBox(InPrimitive), InPrimitive->OctreeElementId);
+}
 
-	if (IsLeaf())
+bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
+{
+	if (InPrimitive == nullptr) { return false; }
+
+	return Remove(InPrimitive->OctreeElementId);
+}
+
+bool FOctree::Relocate(UPrimitiveComponent* InPrimitive)
+{
+	if (InPrimitive == nullptr) { return false; }
+
+	return Relocate(InPrimitive, GetPrimitiveBoundingBox(InPrimitive), InPrimitive->OctreeElementId);
+}
+
+void FOctree::Relocate(const TArray<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>& OutRejected)
+{
+	TArray<FOctreeRelocation> Relocations;
+	Relocations.reserve(InPrimitives.size());
+
+	for (UPrimitiveComponent* Primitive : InPrimitives)
 	{
-		// 리프 노드이며, 여유 공간이 있거나 최대 깊이에 도달했다면
-		if (Primitives.size() < MAX_PRIMITIVES || Depth == MAX_DEPTH)
-		{
-			Primitives.push_back(InPrimitive); // 해당 객체를 추가한다
-			return true;
-		}
-		else // 여유 공간이 없고, 최대 깊이에 도달하지 않았다면
-		{
-			// 분할 및 재귀적 추가를 한다
-			Subdivide(InPrimitive);
-			return true;
-		}
+		if (!Primitive) { continue; }
+
+		FOctreeRelocation Relocation;
+		Relocation.Primitive = Primitive;
+		Primitive->GetWorldAABB(Relocation.Min, Relocation.Max);
+		Relocation.ElementId = &Primitive->OctreeElementId;
+		Relocations.push_back(Relocation);
 	}
-	else
+
+	Relocate(Relocations, OutRejected);
+}
+
+void FOctree::Relocate(const TArray<FOctreeRelocation>& InRelocations, TArray<UPrimitiveComponent*>& OutRejected)
+{
+	TArray<const FOctreeRelocation*> PendingInserts;
+	TArray<int32> NodesToMerge;
+
+	// 1. 현재 노드에 머무를 수 있으면 경계만 갱신하고, 아니면 병합 없이 빼둔다
+	for (const FOctreeRelocation& Relocation : InRelocations)
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		FOctreeElementId& ElementId = *Relocation.ElementId;
+		if (IsElementIdValid(ElementId))
 		{
-			// 자식 노드를 보유하고 있고, 영역 내에 해당 객체가 존재한다면
-			if (Children[Index] && Children[Index]->BoundingBox.IsContains(GetPrimitiveBoundingBox(InPrimitive)))
+			FVector Center;
+			float Extent;
+			GetCenterAndExtent(Relocation.Min, Relocation.Max, Center, Extent);
+
+			if (CanStayInNode(NodePool[ElementId.NodeIndex], Center, Extent))
 			{
-				return Children[Index]->Insert(InPrimitive); // 자식 노드에게 넘겨준다
+				FOctreeElement& Element = NodePool[ElementId.NodeIndex].Elements[ElementId.ElementIndex];
+				Element.Min = Relocation.Min;
+				Element.Max = Relocation.Max;
+				continue;
 			}
+
+			NodesToMerge.push_back(ElementId.NodeIndex);
+			RemoveElement(ElementId);
 		}
+		PendingInserts.push_back(&Relocation);
+	}
 
-		Primitives.push_back(InPrimitive);
-		return true;
+	// 2. 빠진 프리미티브를 다시 삽입
+	for (const FOctreeRelocation* Relocation : PendingInserts)
+	{
+		if (!Insert(Relocation->Primitive, FAABB(Relocation->Min, Relocation->Max), *Relocation->ElementId))
+		{
+			OutRejected.push_back(Relocation->Primitive);
+		}
 	}
 
-	return false;
+	// 3. 재삽입 이후에도 비어있거나 작아진 노드만 병합 (형제 노드 사이의 이동으로 인한 병합/분할 반복 방지)
+	for (int32 NodeIndex : NodesToMerge)
+	{
+		if (NodePool[NodeIndex].bIsInUse)
+		{
+			TryMerge(NodeIndex);
+		}
+	}
 }
 
-bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
+bool FOctree::Insert(UPrimitiveComponent* InPrimitive, const FAABB& InBounds, FOctreeElementId& InOutElementId)
 {
-	if (InPrimitive == nullptr) { return false; }
+	if (!InPrimitive) { return false; }
 
-	// 경계 검사를 수행하지 않고 바로 탐색 시작
-    
-	// 1-A. 리프 노드인 경우 (현재 노드만 검사하면 됨)
-	if (IsLeaf())
+	// 이미 트리에 있는 요소라면 중복 삽입 대신 위치를 갱신
+	if (IsElementIdValid(InOutElementId))
 	{
-		// O(N) 탐색을 통해 프리미티브 목록에서 제거를 시도합니다.
-		if (auto It = std::find(Primitives.begin(), Primitives.end(), InPrimitive); It != Primitives.end())
-		{
-			*It = std::move(Primitives.back());
-			Primitives.pop_back();
-			return true;
-		}
-		return false; // 리프 노드에서 발견하지 못했으므로 탐색 종료
+		return Relocate(InPrimitive, InBounds, InOutElementId);
 	}
-    
-	// 1-B. 자식 노드가 있는 경우 (내부 노드)
-	else
+
+	FVector Center;
+	float Extent;
+	GetCenterAndExtent(InBounds.Min, InBounds.Max, Center, Extent);
+	if (!std::isfinite(Center.X) || !std::isfinite(Center.Y) || !std::isfinite(Center.Z) || !std::isfinite(Extent))
+	{
+		InOutElementId.Reset();
+		return false;
+	}
+
+	// 0. 루트가 객체를 담지 못하면 객체 방향으로 루트를 확장한다
+	if (!GrowToFit(Center, Extent))
 	{
-		// 2. 현재 노드의 Primitives 목록에서 제거 시도 (선택 사항: 일부 트리는 내부 노드에도 프리미티브를 저장함)
-		if (auto It = std::find(Primitives.begin(), Primitives.end(), InPrimitive); It != Primitives.end())
+		InOutElementId.Reset();
+		return false;
+	}
+
+	// 1. 이미 분할된 노드라면 객체가 들어갈 수 있는 가장 깊은 자식까지 내려간다
+	int32 NodeIndex = RootIndex;
+	while (true)
+	{
+		const FOctreeNode& Node = NodePool[NodeIndex];
+		const float ChildHalfSize = Node.HalfSize * 0.5f;
+		if (Node.IsLeaf() || ChildHalfSize < MIN_NODE_HALF_SIZE || !IsExtentFit(Extent, ChildHalfSize))
 		{
-			*It = std::move(Primitives.back());
-			Primitives.pop_back();
-			return true; // 현재 노드에서 제거 완료
+			break;
 		}
-       
-		// 3. 자식 노드 순회 (원래 등록되었을 위치를 재귀적으로 탐색)
-		bool bIsRemoved = false;
+		NodeIndex = GetOrCreateChild(NodeIndex, GetOctant(Node.Center, Center));
+	}
 
-		for (int Index = 0; Index < 8; ++Index)
+	// 2. 노드에 추가하고, 리프의 여유 공간이 없다면 분할한다
+	FOctreeNode& TargetNode = NodePool[NodeIndex];
+	TargetNode.Elements.push_back({ InPrimitive, InBounds.Min, InBounds.Max, &InOutElementId });
+	InOutElementId.NodeIndex = NodeIndex;
+	InOutElementId.ElementIndex = static_cast<int32>(TargetNode.Elements.size()) - 1;
+	++PrimitiveCount;
+
+	// 분할이 막힌 리프는 새 요소가 자식에 들어갈 수 있을 때만 다시 시도해 매 삽입마다 O(n) 재분배를 피한다
+	if (TargetNode.IsLeaf() && TargetNode.Elements.size() > MAX_PRIMITIVES &&
+		(!TargetNode.bIsSplitBlocked || IsExtentFit(Extent, TargetNode.HalfSize * 0.5f)))
+	{
+		Subdivide(NodeIndex);
+	}
+	return true;
+}
+
+bool FOctree::Remove(FOctreeElementId& InOutElementId)
+{
+	if (!IsElementIdValid(InOutElementId)) { return false; }
+
+	// 역참조로 노드와 슬롯을 바로 찾으므로 탐색 없이 O(1) 제거 후 해당 노드부터 병합 검사
+	const int32 NodeIndex = InOutElementId.NodeIndex;
+	RemoveElement(InOutElementId);
+	TryMerge(NodeIndex);
+	return true;
+}
+
+bool FOctree::Relocate(UPrimitiveComponent* InPrimitive, const FAABB& InBounds, FOctreeElementId& InOutElementId)
+{
+	if (!InPrimitive) { return false; }
+
+	if (IsElementIdValid(InOutElementId))
+	{
+		FVector Center;
+		float Extent;
+		GetCenterAndExtent(InBounds.Min, InBounds.Max, Center, Extent);
+
+		// 현재 노드에 그대로 머무를 수 있다면 저장된 경계만 갱신한다
+		if (CanStayInNode(NodePool[InOutElementId.NodeIndex], Center, Extent))
 		{
-			// 💡 Children[Index]->Remove(InPrimitive) 호출 시, 
-			//    자식 노드 내부에서 다시 경계 검사가 수행되지 않도록 보장해야 합니다.
-			if (Children[Index] && Children[Index]->Remove(InPrimitive))
+			FOctreeNode& Node = NodePool[InOutElementId.NodeIndex];
+			FOctreeElement& Element = Node.Elements[InOutElementId.ElementIndex];
+			Element.Min = InBounds.Min;
+			Element.Max = InBounds.Max;
+			// 작아진 요소는 이제 자식에 들어갈 수 있으므로 다음 삽입 때 분할을 다시 시도
+			if (Node.bIsSplitBlocked && IsExtentFit(Extent, Node.HalfSize * 0.5f))
 			{
-				bIsRemoved = true;
-				break;
+				Node.bIsSplitBlocked = false;
 			}
+			return true;
 		}
 
-		// 4. 자식 노드에서 무언가 제거되었다면, 현재 노드를 합칠 수 있는지 검사
-		if (bIsRemoved) { TryMerge(); }
-
-		return bIsRemoved;
+		Remove(InOutElementId);
 	}
 
+	return Insert(InPrimitive, InBounds, InOutElementId);
 }
 
 void FOctree::Clear()
 {
-	Primitives.clear();
-	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+	for (const FOctreeNode& Node : NodePool)
+	{
+		for (const FOctreeElement& Element : Node.Elements)
+		{
+			Element.ElementId->Reset();
+		}
+	}
+
+	NodePool.clear();
+	FreeNodeIndices.clear();
+	PrimitiveCount = 0;
+	RootIndex = AllocateNode(InitialCenter, InitialHalfSize, -1);
 }
 
 void FOctree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const
 {
-	// 1. 현재 노드가 가진 프리미티브를 결과 배열에 추가합니다.
-	OutPrimitives.insert(OutPrimitives.end(), Primitives.begin(), Primitives.end());
+	OutPrimitives.reserve(OutPrimitives.size() + PrimitiveCount);
+	for (const FOctreeNode& Node : NodePool)
+	{
+		for (const FOctreeElement& Element : Node.Elements)
+		{
+			OutPrimitives.push_back(Element.Primitive);
+		}
+	}
+}
+
+void FOctree::GetAllPrimitives(int32 InNodeIndex, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	if (InNodeIndex < 0) { return; }
 
-	// 2. 리프 노드가 아니라면, 모든 자식 노드에 대해 재귀적으로 함수를 호출합니다.
-	if (!IsLeaf())
+	TArray<int32> Stack;
+	Stack.push_back(InNodeIndex);
+
+	while (!Stack.empty())
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		const FOctreeNode& Node = NodePool[Stack.back()];
+		Stack.pop_back();
+		for (const FOctreeElement& Element : Node.Elements)
 		{
-			if (Children[Index]) { Children[Index]->GetAllPrimitives(OutPrimitives); }
+			OutPrimitives.push_back(Element.Primitive);
+		}
+
+		for (int32 Octant = 0; Octant < 8; ++Octant)
+		{
+			if (Node.HasChild(Octant)) { Stack.push_back(Node.Children[Octant]); }
 		}
 	}
 }
@@ -163,31 +296,24 @@ TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindP
 	Candidates.reserve(MaxPrimitiveCount);
 	FNodeQueue NodeQueue;
 
-	float RootDistance = this->GetBoundingBox().GetCenterDistanceSquared(FindPos);
-	NodeQueue.push({ RootDistance, this });
+	NodeQueue.push({ (NodePool[RootIndex].Center - FindPos).LengthSquared(), RootIndex });
 
 	while (!NodeQueue.empty() && Candidates.size() < MaxPrimitiveCount)
 	{
-		FOctree* CurrentNode = NodeQueue.top().second;
+		const FOctreeNode& CurrentNode = NodePool[NodeQueue.top().second];
 		NodeQueue.pop();
 
-		if (CurrentNode->IsLeafNode())
+		for (const FOctreeElement& Element : CurrentNode.Elements)
 		{
-			for (UPrimitiveComponent* Primitive : CurrentNode->GetPrimitives())
-			{
-				Candidates.push_back(Primitive);
-			}
+			Candidates.push_back(Element.Primitive);
 		}
-		else
+
+		for (int32 Octant = 0; Octant < 8; ++Octant)
 		{
-			for (int i = 0; i < 8; ++i)
+			if (CurrentNode.HasChild(Octant))
 			{
-				FOctree* Child = CurrentNode->Children[i];
-				if (Child)
-				{
-					float ChildDistance = Child->GetBoundingBox().GetCenterDistanceSquared(FindPos);
-					NodeQueue.push({ ChildDistance, Child });
-				}
+				const int32 ChildIndex = CurrentNode.Children[Octant];
+				NodeQueue.push({ (NodePool[ChildIndex].Center - FindPos).LengthSquared(), ChildIndex });
 			}
 		}
 	}
@@ -195,96 +321,281 @@ TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindP
 	return Candidates;
 }
 
-void FOctree::Subdivide(UPrimitiveComponent* InPrimitive)
+int32 FOctree::AllocateNode(const FVector& InCenter, float InHalfSize, int32 InParent)
 {
-	const FVector& Min = BoundingBox.Min;
-	const FVector& Max = BoundingBox.Max;
-	const FVector Center = (Min + Max) * 0.5f;
-
-	Children[0] = new FOctree(FAABB(FVector(Min.X, Center.Y, Min.Z), FVector(Center.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Left
-	Children[1] = new FOctree(FAABB(FVector(Center.X, Center.Y, Min.Z), FVector(Max.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Right
-	Children[2] = new FOctree(FAABB(FVector(Min.X, Center.Y, Center.Z), FVector(Center.X, Max.Y, Max.Z)), Depth + 1); // Top-Front-Left
-	Children[3] = new FOctree(FAABB(FVector(Center.X, Center.Y, Center.Z), FVector(Max.X, Max.Y, Max.Z)), Depth + 1); // Top-Front-Right
-	Children[4] = new FOctree(FAABB(FVector(Min.X, Min.Y, Min.Z), FVector(Center.X, Center.Y, Center.Z)), Depth + 1); // Bottom-Back-Left
-	Children[5] = new FOctree(FAABB(FVector(Center.X, Min.Y, Min.Z), FVector(Max.X, Center.Y, Center.Z)), Depth + 1); // Bottom-Back-Right
-	Children[6] = new FOctree(FAABB(FVector(Min.X, Min.Y, Center.Z), FVector(Center.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Left
-	Children[7] = new FOctree(FAABB(FVector(Center.X, Min.Y, Center.Z), FVector(Max.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Right
-
-	TArray<UPrimitiveComponent*> primitivesToMove = Primitives;
-	primitivesToMove.push_back(InPrimitive);
-	Primitives.clear();
-
-	for (UPrimitiveComponent* prim : primitivesToMove)
+	int32 NodeIndex;
+	if (!FreeNodeIndices.empty())
+	{
+		NodeIndex = FreeNodeIndices.back();
+		FreeNodeIndices.pop_back();
+	}
+	else
 	{
-		Insert(prim);
+		NodeIndex = static_cast<int32>(NodePool.size());
+		NodePool.emplace_back();
 	}
+
+	FOctreeNode& Node = NodePool[NodeIndex];
+	Node.Center = InCenter;
+	Node.HalfSize = InHalfSize;
+	const float LooseHalfSize = InHalfSize * LOOSE_FACTOR;
+	Node.LooseBounds = FAABB(InCenter - FVector(LooseHalfSize, LooseHalfSize, LooseHalfSize),
+		InCenter + FVector(LooseHalfSize, LooseHalfSize, LooseHalfSize));
+	Node.Parent = InParent;
+	Node.ChildMask = 0;
+	Node.bIsInUse = true;
+	Node.bIsSplitBlocked = false;
+	return NodeIndex;
 }
 
-void FOctree::TryMerge()
+void FOctree::FreeNode(int32 InNodeIndex)
 {
-	// Case 1. 자식 노드가 존재하지 않으므로 종료
-	if (IsLeaf()) { return; }
+	FOctreeNode& Node = NodePool[InNodeIndex];
+	Node.Elements.clear();
+	Node.Parent = -1;
+	Node.ChildMask = 0;
+	Node.bIsInUse = false;
+	FreeNodeIndices.push_back(InNodeIndex);
+}
 
-	// 모든 자식 노드가 리프 노드인지 확인
-	for (int Index = 0; Index < 8; ++Index)
+int32 FOctree::GetOrCreateChild(int32 InNodeIndex, int32 InOctant)
+{
+	if (NodePool[InNodeIndex].HasChild(InOctant))
 	{
-		if (!Children[Index]->IsLeaf())
-		{
-			return; // 하나라도 리프가 아니면 합치지 않음
-		}
+		return NodePool[InNodeIndex].Children[InOctant];
 	}
 
-	// 모든 자식 노드에 있는 프리미티브의 총 개수를 계산
-	uint32 TotalPrimitives = Primitives.size();
-	for (int Index = 0; Index < 8; ++Index)
-	{
-		TotalPrimitives += Children[Index]->Primitives.size();
-	}
+	// AllocateNode가 NodePool을 재할당할 수 있으므로 참조를 미리 잡아두지 않는다
+	const FVector ParentCenter = NodePool[InNodeIndex].Center;
+	const float ChildHalfSize = NodePool[InNodeIndex].HalfSize * 0.5f;
+	const FVector ChildCenter(
+		ParentCenter.X + ((InOctant & 1) ? ChildHalfSize : -ChildHalfSize),
+		ParentCenter.Y + ((InOctant & 2) ? ChildHalfSize : -ChildHalfSize),
+		ParentCenter.Z + ((InOctant & 4) ? ChildHalfSize : -ChildHalfSize));
+
+	const int32 ChildIndex = AllocateNode(ChildCenter, ChildHalfSize, InNodeIndex);
+	FOctreeNode& Node = NodePool[InNodeIndex];
+	Node.Children[InOctant] = ChildIndex;
+	Node.ChildMask |= static_cast<uint8>(1 << InOctant);
+	return ChildIndex;
+}
 
-	// 프리미티브 총 개수가 최대치보다 작으면 합치기 수행
-	if (TotalPrimitives <= MAX_PRIMITIVES)
+bool FOctree::GrowToFit(const FVector& InCenter, float InExtent)
+{
+	for (int32 GrowCount = 0; ; ++GrowCount)
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		const FOctreeNode& Root = NodePool[RootIndex];
+		if (IsInsideCell(Root, InCenter) && IsExtentFit(InExtent, Root.HalfSize))
 		{
-			Primitives.insert(Primitives.end(), Children[Index]->Primitives.begin(), Children[Index]->Primitives.end());
+			return true;
 		}
 
-		// 모든 자식 노드를 메모리에서 해제
-		for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+		if (GrowCount >= MAX_ROOT_GROW_COUNT)
+		{
+			return false;
+		}
+
+		// 객체가 있는 방향으로 루트를 두 배 확장하면, 기존 루트는 새 루트의 한 옥탄트와 정확히 겹친다
+		const FVector OldCenter = Root.Center;
+		const float OldHalfSize = Root.HalfSize;
+		const bool bIsOldRootEmpty = Root.IsLeaf() && Root.Elements.empty();
+		const FVector NewCenter(
+			OldCenter.X + (InCenter.X >= OldCenter.X ? OldHalfSize : -OldHalfSize),
+			OldCenter.Y + (InCenter.Y >= OldCenter.Y ? OldHalfSize : -OldHalfSize),
+			OldCenter.Z + (InCenter.Z >= OldCenter.Z ? OldHalfSize : -OldHalfSize));
+
+		const int32 OldRootIndex = RootIndex;
+		const int32 NewRootIndex = AllocateNode(NewCenter, OldHalfSize * 2.0f, -1);
+
+		if (bIsOldRootEmpty)
+		{
+			FreeNode(OldRootIndex);
+		}
+		else
+		{
+			const int32 Octant = GetOctant(NewCenter, OldCenter);
+			FOctreeNode& NewRoot = NodePool[NewRootIndex];
+			NewRoot.Children[Octant] = OldRootIndex;
+			NewRoot.ChildMask |= static_cast<uint8>(1 << Octant);
+			NodePool[OldRootIndex].Parent = NewRootIndex;
+		}
+		RootIndex = NewRootIndex;
 	}
 }
 
-void FOctree::DeepCopy(FOctree* OutOctree) const
+void FOctree::Subdivide(int32 InNodeIndex)
 {
-	if (!OutOctree) { return; }
+	const float ChildHalfSize = NodePool[InNodeIndex].HalfSize * 0.5f;
+	if (ChildHalfSize < MIN_NODE_HALF_SIZE) { return; }
+
+	const FVector NodeCenter = NodePool[InNodeIndex].Center;
+	TArray<FOctreeElement> ElementsToMove = std::move(NodePool[InNodeIndex].Elements);
+	NodePool[InNodeIndex].Elements.clear();
+
+	// 자식 셀에 들어갈 수 있는 객체만 내려보내고, 큰 객체는 현재 노드에 남긴다
+	for (const FOctreeElement& Element : ElementsToMove)
+	{
+		FVector Center;
+		float Extent;
+		GetCenterAndExtent(Element.Min, Element.Max, Center, Extent);
 
-	// 1) 필드 복사
-	OutOctree->BoundingBox = BoundingBox;
-	OutOctree->Depth = Depth;
+		if (IsExtentFit(Extent, ChildHalfSize))
+		{
+			const int32 ChildIndex = GetOrCreateChild(InNodeIndex, GetOctant(NodeCenter, Center));
+			NodePool[ChildIndex].Elements.push_back(Element);
+		}
+		else
+		{
+			NodePool[InNodeIndex].Elements.push_back(Element);
+		}
+	}
 
-	// 2) 기존 대상의 프리미티브/자식 정리 후 초기화
-	//    - 프리미티브는 대입으로 교체
-	OutOctree->Primitives = Primitives; // shallow copy of pointers
+	// 자식을 하나도 만들지 못했다면 리프로 남으므로 분할이 막혔다고 기록
+	NodePool[InNodeIndex].bIsSplitBlocked = NodePool[InNodeIndex].IsLeaf();
 
-	//    - 기존 자식 노드 메모리 해제
-	for (FOctree* Child : OutOctree->Children)
+	UpdateElementIds(InNodeIndex);
+	for (int32 Octant = 0; Octant < 8; ++Octant)
 	{
-		SafeDelete(Child);
+		if (!NodePool[InNodeIndex].HasChild(Octant)) { continue; }
+
+		const int32 ChildIndex = NodePool[InNodeIndex].Children[Octant];
+		UpdateElementIds(ChildIndex);
+		if (NodePool[ChildIndex].Elements.size() > MAX_PRIMITIVES)
+		{
+			Subdivide(ChildIndex);
+		}
 	}
-	OutOctree->Children.clear();
-	OutOctree->Children.resize(8, nullptr);
+}
 
-	// 3) 자식 재귀 복사
-	if (!IsLeaf())
+void FOctree::TryMerge(int32 InNodeIndex)
+{
+	int32 NodeIndex = InNodeIndex;
+	while (NodeIndex != -1)
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		const int32 ParentIndex = NodePool[NodeIndex].Parent;
+
+		// Case 1. 비어있는 리프는 해제하고 부모의 자식 마스크에서 제거 (루트는 유지)
+		if (NodePool[NodeIndex].IsLeaf())
 		{
-			if (Children[Index] != nullptr)
+			if (NodePool[NodeIndex].Elements.empty() && ParentIndex != -1)
 			{
-				// 자식 노드 생성 후 재귀 복사
-				OutOctree->Children[Index] = new FOctree(Children[Index]->BoundingBox, Children[Index]->Depth);
-				Children[Index]->DeepCopy(OutOctree->Children[Index]);
+				FOctreeNode& Parent = NodePool[ParentIndex];
+				for (int32 Octant = 0; Octant < 8; ++Octant)
+				{
+					if (Parent.HasChild(Octant) && Parent.Children[Octant] == NodeIndex)
+					{
+						Parent.Children[Octant] = -1;
+						Parent.ChildMask &= static_cast<uint8>(~(1 << Octant));
+						break;
+					}
+				}
+				FreeNode(NodeIndex);
 			}
+			NodeIndex = ParentIndex;
+			continue;
+		}
+
+		// Case 2. 모든 자식이 리프이고 프리미티브 총 개수가 최대치 이하라면 자식을 현재 노드로 합친다
+		const FOctreeNode& Node = NodePool[NodeIndex];
+		size_t TotalPrimitives = Node.Elements.size();
+		bool bCanMerge = true;
+		for (int32 Octant = 0; Octant < 8 && bCanMerge; ++Octant)
+		{
+			if (!Node.HasChild(Octant)) { continue; }
+
+			const FOctreeNode& Child = NodePool[Node.Children[Octant]];
+			bCanMerge = Child.IsLeaf();
+			TotalPrimitives += Child.Elements.size();
+		}
+
+		if (!bCanMerge || TotalPrimitives > MAX_PRIMITIVES)
+		{
+			// 현재 노드가 내부 노드로 남으면 조상 노드도 병합될 수 없으므로 여기서 종료
+			break;
+		}
+
+		const size_t FirstMergedElement = Node.Elements.size();
+		for (int32 Octant = 0; Octant < 8; ++Octant)
+		{
+			if (!NodePool[NodeIndex].HasChild(Octant)) { continue; }
+
+			const int32 ChildIndex = NodePool[NodeIndex].Children[Octant];
+			TArray<FOctreeElement>& ChildElements = NodePool[ChildIndex].Elements;
+			NodePool[NodeIndex].Elements.insert(NodePool[NodeIndex].Elements.end(), ChildElements.begin(), ChildElements.end());
+			NodePool[NodeIndex].Children[Octant] = -1;
+			FreeNode(ChildIndex);
 		}
+		NodePool[NodeIndex].ChildMask = 0;
+		NodePool[NodeIndex].bIsSplitBlocked = false;
+		UpdateElementIds(NodeIndex, FirstMergedElement);
+
+		NodeIndex = ParentIndex;
+	}
+}
+
+bool FOctree::IsElementIdValid(const FOctreeElementId& InElementId) const
+{
+	if (InElementId.NodeIndex < 0 || InElementId.NodeIndex >= static_cast<int32>(NodePool.size()))
+	{
+		return false;
+	}
+
+	const FOctreeNode& Node = NodePool[InElementId.NodeIndex];
+	return Node.bIsInUse &&
+		InElementId.ElementIndex >= 0 && InElementId.ElementIndex < static_cast<int32>(Node.Elements.size()) &&
+		Node.Elements[InElementId.ElementIndex].ElementId == &InElementId;
+}
+
+bool FOctree::CanStayInNode(const FOctreeNode& InNode, const FVector& InCenter, float InExtent) const
+{
+	if (!IsInsideCell(InNode, InCenter) || !IsExtentFit(InExtent, InNode.HalfSize))
+	{
+		return false;
+	}
+
+	// 분할된 노드에서는 자식에 들어갈 수 없는 큰 객체만 머무르게 해 트리 품질을 유지한다
+	const float ChildHalfSize = InNode.HalfSize * 0.5f;
+	return InNode.IsLeaf() || ChildHalfSize < MIN_NODE_HALF_SIZE || !IsExtentFit(InExtent, ChildHalfSize);
+}
+
+void FOctree::RemoveElement(const FOctreeElementId& InElementId)
+{
+	const int32 NodeIndex = InElementId.NodeIndex;
+	const int32 ElementIndex = InElementId.ElementIndex;
+	TArray<FOctreeElement>& Elements = NodePool[NodeIndex].Elements;
+
+	// 마지막 요소를 빈 슬롯으로 옮기고 그 요소의 역참조만 갱신
+	Elements[ElementIndex].ElementId->Reset();
+	if (ElementIndex != static_cast<int32>(Elements.size()) - 1)
+	{
+		Elements[ElementIndex] = Elements.back();
+		Elements[ElementIndex].ElementId->ElementIndex = ElementIndex;
 	}
+	Elements.pop_back();
+	NodePool[NodeIndex].bIsSplitBlocked = false;
+	--PrimitiveCount;
+}
+
+void FOctree::UpdateElementIds(int32 InNodeIndex, size_t InFirstElement)
+{
+	TArray<FOctreeElement>& Elements = NodePool[InNodeIndex].Elements;
+	for (size_t Index = InFirstElement; Index < Elements.size(); ++Index)
+	{
+		Elements[Index].ElementId->NodeIndex = InNodeIndex;
+		Elements[Index].ElementId->ElementIndex = static_cast<int32>(Index);
+	}
+}
+
+bool FOctree::IsInsideCell(const FOctreeNode& InNode, const FVector& InPoint)
+{
+	return std::abs(InPoint.X - InNode.Center.X) <= InNode.HalfSize &&
+		std::abs(InPoint.Y - InNode.Center.Y) <= InNode.HalfSize &&
+		std::abs(InPoint.Z - InNode.Center.Z) <= InNode.HalfSize;
+}
+
+int32 FOctree::GetOctant(const FVector& InNodeCenter, const FVector& InPoint)
+{
+	return (InPoint.X >= InNodeCenter.X ? 1 : 0) |
+		(InPoint.Y >= InNodeCenter.Y ? 2 : 0) |
+		(InPoint.Z >= InNodeCenter.Z ? 4 : 0);
 }
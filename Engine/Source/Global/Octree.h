@@ -4,46 +4,148 @@
 
 class UPrimitiveComponent;
 
-constexpr int MAX_PRIMITIVES = 16; 
-constexpr int MAX_DEPTH = 5;      
+/** @brief 리프 노드가 분할되기 전까지 보관할 수 있는 최대 프리미티브 개수 */
+constexpr int MAX_PRIMITIVES = 16;
+/** @brief 노드 셀의 최소 반경, 이보다 작은 셀로는 분할하지 않음 */
+constexpr float MIN_NODE_HALF_SIZE = 1.0f;
+/** @brief 느슨한 경계 배율, 노드의 실제 경계는 셀 크기의 LOOSE_FACTOR 배 */
+constexpr float LOOSE_FACTOR = 2.0f;
+/** @brief 루트가 월드 경계를 따라 확장될 수 있는 최대 횟수 (매 확장마다 크기 2배) */
+constexpr int MAX_ROOT_GROW_COUNT = 24;
 
+/**
+ * @brief 옥트리 안에서 프리미티브가 저장된 위치 (노드 인덱스와 노드 내 슬롯 인덱스)
+ * 소유자(보통 UPrimitiveComponent)가 보관하고, 요소가 옮겨질 때마다 FOctree가 직접 갱신한다.
+ */
+struct FOctreeElementId
+{
+	int32 NodeIndex = -1;
+	int32 ElementIndex = -1;
+
+	bool IsValid() const { return NodeIndex >= 0; }
+	void Reset() { NodeIndex = -1; ElementIndex = -1; }
+};
+
+/** @brief 옥트리 노드에 저장되는 프리미티브, 현재 월드 AABB, 위치를 되돌려 쓸 역참조 */
+struct FOctreeElement
+{
+	UPrimitiveComponent* Primitive = nullptr;
+	FVector Min;
+	FVector Max;
+	FOctreeElementId* ElementId = nullptr;
+};
+
+/** @brief FOctree::Relocate 일괄 처리 입력, 새 월드 AABB와 요소 위치 역참조 */
+struct FOctreeRelocation
+{
+	UPrimitiveComponent* Primitive = nullptr;
+	FVector Min;
+	FVector Max;
+	FOctreeElementId* ElementId = nullptr;
+};
+
+/**
+ * @brief 풀링된 노드 배열에 저장되는 느슨한 옥트리 노드
+ * 자식은 포인터 대신 노드 배열의 인덱스로 참조하고, 존재하는 자식은 ChildMask 비트로 표시한다.
+ */
+struct alignas(64) FOctreeNode
+{
+	// 삽입 시 하강 경로에서 읽는 필드를 첫 캐시 라인에 모아둔다
+	FVector Center;
+	float HalfSize = 0.0f;
+	int32 Children[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+	uint8 ChildMask = 0;
+	bool bIsInUse = false;
+	/** @brief 가득 찼지만 자식에 들어갈 요소가 없어 분할하지 못한 리프, 자식에 맞는 요소가 들어오거나 요소가 빠질 때까지 분할을 건너뛴다 */
+	bool bIsSplitBlocked = false;
+	int32 Parent = -1;
+
+	/** @brief 셀 크기의 LOOSE_FACTOR 배로 확장된 경계, 컬링/피킹은 이 경계를 사용 */
+	FAABB LooseBounds;
+	TArray<FOctreeElement> Elements;
+
+	FOctreeNode() = default;
+	FOctreeNode(const FOctreeNode&) = default;
+	FOctreeNode& operator=(const FOctreeNode&) = default;
+	/** @brief FVector의 복사 생성자가 noexcept가 아니므로, 풀 재할당 시 Elements가 복사되지 않도록 명시 */
+	FOctreeNode(FOctreeNode&&) noexcept = default;
+	FOctreeNode& operator=(FOctreeNode&&) noexcept = default;
+
+	bool IsLeaf() const { return ChildMask == 0; }
+	bool HasChild(int32 InOctant) const { return (ChildMask & (1 << InOctant)) != 0; }
+	FAABB GetCellBounds() const;
+};
+
+/**
+ * @brief 월드 경계에 맞춰 루트가 확장되는 느슨한(Loose) 옥트리
+ * 프리미티브는 중심이 속한 셀 중 크기가 충분한 가장 깊은 노드에 저장되며,
+ * 노드는 NodePool에 연속으로 저장되고 해제된 노드는 FreeNodeIndices로 재사용된다.
+ */
 class FOctree
 {
 public:
 	FOctree();
-	FOctree(const FVector& InPosition, float InSize, int InDepth);
-	FOctree(const FAABB& InBoundingBox, int InDepth);
+	FOctree(const FVector& InPosition, float InSize);
 	~FOctree();
 
+	FOctree(const FOctree&) = delete;
+	FOctree& operator=(const FOctree&) = delete;
+
 	bool Insert(UPrimitiveComponent* InPrimitive);
 	bool Remove(UPrimitiveComponent* InPrimitive);
-	void Clear();
+	bool Relocate(UPrimitiveComponent* InPrimitive);
+	/**
+	 * @brief 여러 프리미티브의 위치를 한 번에 갱신, 노드 병합은 모든 재삽입이 끝난 뒤 한 번만 수행
+	 * @param OutRejected 옥트리에 넣을 수 없는 프리미티브 (유효하지 않은 AABB 등)
+	 */
+	void Relocate(const TArray<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>& OutRejected);
 
-	void DeepCopy(FOctree* OutOctree) const;
+	/** @brief 요소 위치를 호출자가 보관하는 저수준 API, InOutElementId는 요소가 트리에 있는 동안 주소가 유지되어야 함 */
+	bool Insert(UPrimitiveComponent* InPrimitive, const FAABB& InBounds, FOctreeElementId& InOutElementId);
+	bool Remove(FOctreeElementId& InOutElementId);
+	bool Relocate(UPrimitiveComponent* InPrimitive, const FAABB& InBounds, FOctreeElementId& InOutElementId);
+	void Relocate(const TArray<FOctreeRelocation>& InRelocations, TArray<UPrimitiveComponent*>& OutRejected);
+
+	void Clear();
 
 	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
+	void GetAllPrimitives(int32 InNodeIndex, TArray<UPrimitiveComponent*>& OutPrimitives) const;
 	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount);
 
-	const FAABB& GetBoundingBox() const { return BoundingBox; }
-	void SetBoundingBox(const FAABB& InAABB) { BoundingBox = InAABB; }
-	bool IsLeafNode() const { return IsLeaf(); }
-	const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
-	TArray<FOctree*>& GetChildren() { return Children; }
-	const TArray<FOctree*>& GetChildren() const { return Children; } 
+	int32 GetRootIndex() const { return RootIndex; }
+	const FOctreeNode& GetNode(int32 InNodeIndex) const { return NodePool[InNodeIndex]; }
+	const TArray<FOctreeNode>& GetNodePool() const { return NodePool; }
+	const FAABB& GetBoundingBox() const { return NodePool[RootIndex].LooseBounds; }
+	uint32 GetNodeCount() const { return static_cast<uint32>(NodePool.size() - FreeNodeIndices.size()); }
+	uint32 GetPrimitiveCount() const { return PrimitiveCount; }
 
 private:
-	bool IsLeaf() const { return Children[0] == nullptr; }
-	void Subdivide(UPrimitiveComponent* InPrimitive);
-	void TryMerge();
-
-	FAABB BoundingBox;
-	int Depth;                       
-	TArray<UPrimitiveComponent*> Primitives;
-	TArray<FOctree*> Children;
+	int32 AllocateNode(const FVector& InCenter, float InHalfSize, int32 InParent);
+	void FreeNode(int32 InNodeIndex);
+	int32 GetOrCreateChild(int32 InNodeIndex, int32 InOctant);
+
+	bool GrowToFit(const FVector& InCenter, float InExtent);
+	void Subdivide(int32 InNodeIndex);
+	void TryMerge(int32 InNodeIndex);
+	bool IsElementIdValid(const FOctreeElementId& InElementId) const;
+	bool CanStayInNode(const FOctreeNode& InNode, const FVector& InCenter, float InExtent) const;
+	void RemoveElement(const FOctreeElementId& InElementId);
+	void UpdateElementIds(int32 InNodeIndex, size_t InFirstElement = 0);
+
+	static bool IsInsideCell(const FOctreeNode& InNode, const FVector& InPoint);
+	static int32 GetOctant(const FVector& InNodeCenter, const FVector& InPoint);
+
+	TArray<FOctreeNode> NodePool;
+	TArray<int32> FreeNodeIndices;
+	int32 RootIndex = -1;
+	uint32 PrimitiveCount = 0;
+
+	FVector InitialCenter;
+	float InitialHalfSize = 0.0f;
 };
 
 using FNodeQueue = std::priority_queue<
-	std::pair<float, FOctree*>,
-	std::vector<std::pair<float, FOctree*>>,
-	std::greater<std::pair<float, FOctree*>>
+	std::pair<float, int32>,
+	std::vector<std::pair<float, int32>>,
+	std::greater<std::pair<float, int32>>
 >;
@@ -2,6 +2,7 @@
 #include "Actor/Public/Actor.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Component/Light/Public/LightComponent.h"
+#include "Component/Mesh/Public/StaticBatchComponent.h"
 #include "Component/Public/HeightFogComponent.h"
 #include "Core/Public/Object.h"
 #include "Editor/Public/Editor.h"
@@ -9,6 +10,7 @@
 #include "Global/Octree.h"
 #include "Level/Public/Level.h"
 #include "Manager/Config/Public/ConfigManager.h"
+#include "Optimization/Public/TransformHierarchy.h"
 #include "Render/Renderer/Public/Renderer.h"
 #include "Utility/Public/JsonSerializer.h"
 #include <json.hpp>
@@ -17,11 +19,18 @@ IMPLEMENT_CLASS(ULevel, UObject)
 
 ULevel::ULevel()
 {
-	StaticOctree = new FOctree(FVector(0, 0, -5), 75, 0);
+	// 초기 루트는 시작 크기일 뿐이며, 범위를 벗어난 프리미티브가 삽입되면 월드 경계에 맞춰 확장된다
+	StaticOctree = new FOctree(FVector(0, 0, -5), 75);
 }
 
 ULevel::~ULevel()
 {
+	// 셀이 원본을 가리키므로 액터보다 먼저 지운다, 레벨이 사라지므로 원본은 다시 등록하지 않는다
+	while (!StaticBatches.empty())
+	{
+		DestroyStaticBatch(StaticBatches.back(), false);
+	}
+
 	// LevelActors 배열에 남아있는 모든 액터의 메모리를 해제합니다.
 	for (const auto& Actor : LevelActors)
 	{
@@ -37,38 +46,8 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 
-	// 불러오기
-	if (bInIsLoading)
-	{
-		// NOTE: 레벨 로드 시 NextUUID를 변경하면 UUID 충돌이 발생하므로 관련 기능 구현을 보류합니다.
-		uint32 NextUUID = 0;
-		FJsonSerializer::ReadUint32(InOutHandle, "NextUUID", NextUUID);
-
-		JSON PerspectiveCameraData;
-		if (FJsonSerializer::ReadArray(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
-		{
-			UConfigManager::GetInstance().SetCameraSettingsFromJson(PerspectiveCameraData);
-			URenderer::GetInstance().GetViewportClient()->ApplyAllCameraDataToViewportClients();
-		}
-		
-		JSON ActorsJson;
-		if (FJsonSerializer::ReadObject(InOutHandle, "Actors", ActorsJson))
-		{
-			for (auto& Pair : ActorsJson.ObjectRange())
-			{
-				JSON& ActorDataJson = Pair.second;
-
-				FString TypeString;
-				FJsonSerializer::ReadString(ActorDataJson, "Type", TypeString);
-				
-				UClass* ActorClass = UClass::FindClass(TypeString);
-				SpawnActorToLevel(ActorClass, &ActorDataJson); 
-			}
-		}
-	}
-
 	// 저장
-	else
+	if (!bInIsLoading)
 	{
 		// NOTE: 레벨 로드 시 NextUUID를 변경하면 UUID 충돌이 발생하므로 관련 기능 구현을 보류합니다.
 		InOutHandle["NextUUID"] = 0;
@@ -90,6 +69,36 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void ULevel::Deserialize(const FJsonValue& InHandle)
+{
+	Super::Deserialize(InHandle);
+
+	// NOTE: 레벨 로드 시 NextUUID를 변경하면 UUID 충돌이 발생하므로 관련 기능 구현을 보류합니다.
+	uint32 NextUUID = 0;
+	FJsonSerializer::ReadUint32(InHandle, "NextUUID", NextUUID);
+
+	FJsonValue PerspectiveCameraData;
+	if (FJsonSerializer::ReadArray(InHandle, "PerspectiveCamera", PerspectiveCameraData))
+	{
+		UConfigManager::GetInstance().SetCameraSettingsFromJson(PerspectiveCameraData);
+		URenderer::GetInstance().GetViewportClient()->ApplyAllCameraDataToViewportClients();
+	}
+
+	FJsonValue ActorsJson;
+	if (FJsonSerializer::ReadObject(InHandle, "Actors", ActorsJson))
+	{
+		LevelActors.reserve(LevelActors.size() + ActorsJson.Size());
+		for (const FJsonValue& ActorDataJson : ActorsJson.ObjectRange())
+		{
+			std::string_view TypeString;
+			FJsonSerializer::ReadStringView(ActorDataJson, "Type", TypeString);
+
+			UClass* ActorClass = UClass::FindClass(FString(TypeString));
+			SpawnActorToLevel(ActorClass, &ActorDataJson);
+		}
+	}
+}
+
 void ULevel::Init()
 {
 	for (AActor* Actor: LevelActors)
@@ -101,7 +110,7 @@ void ULevel::Init()
 	}
 }
 
-AActor* ULevel::SpawnActorToLevel(UClass* InActorClass, JSON* ActorJsonData)
+AActor* ULevel::SpawnActorToLevel(UClass* InActorClass, const FJsonValue* ActorJsonData)
 {
 	if (!InActorClass)
 	{
@@ -114,7 +123,7 @@ AActor* ULevel::SpawnActorToLevel(UClass* InActorClass, JSON* ActorJsonData)
 		LevelActors.push_back(NewActor);
 		if (ActorJsonData != nullptr)
 		{
-			NewActor->Serialize(true, *ActorJsonData);
+			NewActor->Deserialize(*ActorJsonData);
 		}
 		else
 		{
@@ -142,12 +151,7 @@ void ULevel::RegisterComponent(UActorComponent* InComponent)
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(InComponent))
 	{
-		// StaticOctree에 먼저 삽입 시도
-		if (!(StaticOctree->Insert(PrimitiveComponent)))
-		{
-			// 실패하면 DynamicPrimitiveQueue 목록에 추가
-			OnPrimitiveUpdated(PrimitiveComponent);
-		}
+		AddPrimitiveToOctree(PrimitiveComponent);
 	}
 	else if (auto LightComponent = Cast<ULightComponent>(InComponent))
 	{
@@ -171,6 +175,13 @@ void ULevel::UnregisterComponent(UActorComponent* InComponent)
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(InComponent))
 	{
+		// 셀에 합쳐진 원본은 컬링 구조에 없으므로 셀에서만 뺀다
+		if (PrimitiveComponent->bIsStaticBatched)
+		{
+			DetachFromStaticBatch(PrimitiveComponent);
+		}
+		PendingStaticBatchSplits.erase(PrimitiveComponent);
+
 		// StaticOctree에서 제거 시도
 		StaticOctree->Remove(PrimitiveComponent);
 	
@@ -197,7 +208,7 @@ void ULevel::AddLevelComponent(AActor* Actor)
 	{
 		if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
 		{
-			OnPrimitiveUpdated(PrimitiveComponent);			
+			AddPrimitiveToOctree(PrimitiveComponent);
 		}
 		else if (auto LightComponent = Cast<ULightComponent>(Component))
 		{
@@ -248,29 +259,50 @@ bool ULevel::DestroyActor(AActor* InActor)
 
 void ULevel::UpdatePrimitiveInOctree(UPrimitiveComponent* InComponent)
 {
-	// AABB가 실제로 변경되었는지 확인
-	FVector NewMin, NewMax;
-	InComponent->GetWorldAABB(NewMin, NewMax);
-	
-	// 이전 AABB와 비교 (허용 오차 범위 내면 업데이트 스킵)
-	static const float Threshold = 0.001f;
-	if (!InComponent->IsAABBCacheDirty())
-	{
-		FVector OldMin, OldMax;
-		InComponent->GetCachedWorldAABB(OldMin, OldMax);
-		
-		if ((NewMin - OldMin).LengthSquared() < Threshold && 
-			(NewMax - OldMax).LengthSquared() < Threshold)
+	// 셀에 합쳐진 원본이 움직이면 셀에서 빼고, UpdateOctree에서 최종 위치로 다시 등록한다
+	if (InComponent && InComponent->bIsStaticBatched)
+	{
+		if (StaticBatchOfSource.count(InComponent))
 		{
-			return; // AABB 변경 없음, 옥트리 업데이트 스킵
+			DetachFromStaticBatch(InComponent);
+			PendingStaticBatchSplits.insert(InComponent);
 		}
+		return;
 	}
-	
-	if (!StaticOctree->Remove(InComponent))
+
+	// 다른 레벨(PIE 등)에 속한 컴포넌트의 요청은 무시한다
+	if (!PrimitiveBounds.Contains(InComponent))
+	{
 		return;
+	}
+
+	// 같은 프레임에 여러 번 움직여도 UpdateOctree에서 최종 AABB로 한 번만 재배치한다
 	OnPrimitiveUpdated(InComponent);
 }
 
+void ULevel::UpdatePrimitiveRenderState(UPrimitiveComponent* InComponent)
+{
+	// 셀에 합쳐진 원본의 메시, 머티리얼, 가시성이 바뀌면 셀에서 빼고 개별로 다시 등록한다
+	if (InComponent && InComponent->bIsStaticBatched)
+	{
+		if (StaticBatchOfSource.count(InComponent))
+		{
+			DetachFromStaticBatch(InComponent);
+			PendingStaticBatchSplits.insert(InComponent);
+		}
+		return;
+	}
+
+	// 다른 레벨(PIE 등)에 속한 컴포넌트의 요청은 무시한다
+	const int32 Index = InComponent ? InComponent->RenderProxyIndex : -1;
+	if (Index < 0 || Index >= RenderProxies.Num() || RenderProxies.GetPrimitive(Index) != InComponent)
+	{
+		return;
+	}
+
+	PendingRenderProxyUpdates.insert(InComponent);
+}
+
 UObject* ULevel::Duplicate()
 {
 	ULevel* Level = Cast<ULevel>(Super::Duplicate());
@@ -297,80 +329,359 @@ void ULevel::DuplicateSubObjects(UObject* DuplicatedObject)
 
 void ULevel::UpdateOctree()
 {
-	if (!StaticOctree)
+	// 이번 프레임의 트랜스폼 변경을 깊이 순서로 한 번에 반영, 움직인 프리미티브는 OnUpdateTransform으로 재배치 목록에 들어온다
+	FTransformHierarchy::GetInstance().Update();
+
+	// 셀에서 빠진 원본은 트랜스폼이 확정된 뒤 등록해야 하므로 재배치 전에 처리한다
+	FlushStaticBatchChanges();
+
+	if (!StaticOctree || PendingOctreeRelocations.empty())
 	{
 		return;
 	}
-	
-	uint32 Count = 0;
-	FDynamicPrimitiveQueue NotInsertedQueue;
-	
-	while (!DynamicPrimitiveQueue.empty() && Count < MAX_OBJECTS_TO_INSERT_PER_FRAME)
+
+	TArray<UPrimitiveComponent*> Primitives(PendingOctreeRelocations.begin(), PendingOctreeRelocations.end());
+	PendingOctreeRelocations.clear();
+
+	// SoA 경계를 먼저 한 번에 갱신하고, 옥트리도 같은 값으로 재배치한다
+	PrimitiveBounds.Update(Primitives);
+
+	TArray<FOctreeRelocation> Relocations;
+	Relocations.reserve(Primitives.size());
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		if (!PrimitiveBounds.Contains(Primitive))
+		{
+			continue;
+		}
+
+		FOctreeRelocation Relocation;
+		Relocation.Primitive = Primitive;
+		PrimitiveBounds.GetBounds(Primitive->PrimitiveBoundsIndex, Relocation.Min, Relocation.Max);
+		Relocation.ElementId = &Primitive->OctreeElementId;
+		Relocations.push_back(Relocation);
+
+		// 정렬 키의 깊이 버킷은 경계 중심에서 카메라까지 거리로 정한다
+		RenderProxies.SetLocation(Primitive->RenderProxyIndex, (Relocation.Min + Relocation.Max) * 0.5f);
+	}
+
+	// 노드 내 위치를 역참조로 바로 찾으므로, 대부분은 경계만 갱신되고 셀을 벗어난 경우만 재삽입된다
+	TArray<UPrimitiveComponent*> Rejected;
+	StaticOctree->Relocate(Relocations, Rejected);
+
+	for (const FOctreeRelocation& Relocation : Relocations)
+	{
+		DynamicPrimitiveSet.erase(Relocation.Primitive);
+	}
+	for (UPrimitiveComponent* Primitive : Rejected)
+	{
+		DynamicPrimitiveSet.insert(Primitive);
+	}
+}
+
+void ULevel::PrepareForCulling()
+{
+	// 트랜스폼 갱신도 함께 하므로 이후 라이트와 프리미티브의 월드 행렬 읽기는 계산 없이 캐시만 읽는다
+	UpdateOctree();
+
+	// 새로 등록되었거나 메시/머티리얼이 바뀐 프리미티브만 렌더 정렬 키를 다시 만든다
+	for (UPrimitiveComponent* Primitive : PendingRenderProxyUpdates)
 	{
-		auto [Component, TimePoint] = DynamicPrimitiveQueue.front();
-		DynamicPrimitiveQueue.pop();
+		RenderProxies.UpdateSortKey(Primitive->RenderProxyIndex);
+	}
+	PendingRenderProxyUpdates.clear();
+
+	// Octree에 넣지 못한 프리미티브는 컬링 중 GetWorldAABB로 경계를 읽으므로 캐시를 미리 채워 둔다
+	FVector Min, Max;
+	for (UPrimitiveComponent* Primitive : DynamicPrimitiveSet)
+	{
+		Primitive->GetWorldAABB(Min, Max);
+	}
+}
+
+void ULevel::AddPrimitiveToOctree(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent || !StaticOctree)
+	{
+		return;
+	}
 
-		if (auto It = DynamicPrimitiveMap.find(Component); It != DynamicPrimitiveMap.end())
+	PrimitiveBounds.Add(InComponent);
+
+	FVector Min, Max;
+	PrimitiveBounds.GetBounds(InComponent->PrimitiveBoundsIndex, Min, Max);
+	RenderProxies.Add(InComponent, InComponent->RenderProxyIndex);
+	RenderProxies.SetLocation(InComponent->RenderProxyIndex, (Min + Max) * 0.5f);
+	PendingRenderProxyUpdates.insert(InComponent);
+
+	if (StaticOctree->Insert(InComponent))
+	{
+		DynamicPrimitiveSet.erase(InComponent);
+	}
+	else
+	{
+		DynamicPrimitiveSet.insert(InComponent);
+	}
+}
+
+void ULevel::OnPrimitiveUpdated(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent)
+	{
+		return;
+	}
+
+	PendingOctreeRelocations.insert(InComponent);
+}
+
+void ULevel::OnPrimitiveUnregistered(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent)
+	{
+		return;
+	}
+
+	PendingOctreeRelocations.erase(InComponent);
+	PendingRenderProxyUpdates.erase(InComponent);
+	DynamicPrimitiveSet.erase(InComponent);
+	PrimitiveBounds.Remove(InComponent);
+	RenderProxies.Remove(InComponent->RenderProxyIndex);
+}
+
+/*-----------------------------------------------------------------------------
+	Static Batching
+-----------------------------------------------------------------------------*/
+
+namespace
+{
+	/**
+	 * @brief 셀에 합칠 수 있는 원본인지 (보이고, 스크롤과 고정 LOD가 없고, 작은 메시에 섹션 머티리얼이 모두 있는)
+	 * 움직일 소품을 미리 알 방법이 없으므로 움직이면 셀에서 빼는 것으로 대신한다.
+	 */
+	bool CanStaticBatch(UStaticMeshComponent* InComponent)
+	{
+		if (!InComponent || InComponent->IsA(UStaticBatchComponent::StaticClass()) || !InComponent->IsVisible() || InComponent->IsScrollEnabled() || InComponent->GetForcedLOD() > 0)
+		{
+			return false;
+		}
+
+		UStaticMesh* StaticMesh = InComponent->GetStaticMesh();
+		const FStaticMesh* MeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (!MeshAsset || !FStaticMeshMerger::CanMerge(*MeshAsset))
+		{
+			return false;
+		}
+
+		// 머티리얼이 빠진 섹션은 기본 머티리얼로 그려지므로 셀 하나의 머티리얼 집합으로 표현할 수 없다
+		if (!MeshAsset->MaterialInfo.empty() && StaticMesh->GetNumMaterials() != 0)
 		{
-			if (It->second <= TimePoint)
+			for (const FMeshSection& Section : MeshAsset->Sections)
 			{
-				// 큐에 기록된 오브젝트의 마지막 변경 시간 이후로 변경이 없었다면 Octree에 재삽입한다.
-				if (StaticOctree->Insert(Component))
-				{
-					DynamicPrimitiveMap.erase(It);
-				}
-				// 삽입이 안됐다면 다시 Queue에 들어가기 위해 저장
-				else
+				if (!InComponent->GetMaterial(Section.MaterialSlot))
 				{
-					NotInsertedQueue.push({Component, It->second});
+					return false;
 				}
-				// TODO: 오브젝트의 유일성을 보장하기 위해 StaticOctree->Remove(Component)가 필요한가?
-				++Count;
 			}
-			else
+		}
+		return true;
+	}
+
+	/** @brief FStaticMeshPass와 같은 규칙으로 섹션 머티리얼을 모은다 */
+	FStaticMeshMergeSource MakeStaticMergeSource(UStaticMeshComponent* InComponent)
+	{
+		UStaticMesh* StaticMesh = InComponent->GetStaticMesh();
+		const FStaticMesh* MeshAsset = StaticMesh->GetStaticMeshAsset();
+
+		FStaticMeshMergeSource Source;
+		Source.Mesh = MeshAsset;
+		Source.World = InComponent->GetWorldTransformMatrix();
+		Source.WorldInverse = InComponent->GetWorldTransformMatrixInverse();
+		Source.bReceivesDecals = InComponent->bReceivesDecals;
+		if (!MeshAsset->MaterialInfo.empty() && StaticMesh->GetNumMaterials() != 0)
+		{
+			for (const FMeshSection& Section : MeshAsset->Sections)
 			{
-				// 큐에 기록된 오브젝트의 마지막 변경 이후 새로운 변경이 존재했다면 다시 큐에 삽입한다.
-				DynamicPrimitiveQueue.push({Component, It->second});
+				Source.SectionMaterials.push_back(InComponent->GetMaterial(Section.MaterialSlot));
 			}
 		}
+		return Source;
 	}
-	
-	DynamicPrimitiveQueue = NotInsertedQueue;
-	if (Count != 0)
+}
+
+void ULevel::BuildStaticBatches(float InCellSize)
+{
+	if (!StaticOctree)
+	{
+		return;
+	}
+
+	ReleaseStaticBatches();
+
+	// 셀 정점은 원본의 현재 월드 행렬로 굽기 때문에 대기 중인 트랜스폼 변경을 먼저 반영한다
+	UpdateOctree();
+
+	FScopeCycleCounter Counter;
+
+	TArray<UStaticMeshComponent*> Candidates;
+	TArray<FStaticMeshMergeSource> MergeSources;
+	for (AActor* Actor : LevelActors)
+	{
+		if (!Actor)
+		{
+			continue;
+		}
+
+		for (UActorComponent* Component : Actor->GetOwnedComponents())
+		{
+			UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Component);
+			if (MeshComponent && PrimitiveBounds.Contains(MeshComponent) && CanStaticBatch(MeshComponent))
+			{
+				Candidates.push_back(MeshComponent);
+				MergeSources.push_back(MakeStaticMergeSource(MeshComponent));
+			}
+		}
+	}
+
+	TArray<FStaticMeshMergedCell> Cells;
+	FStaticMeshMerger::BuildCells(MergeSources, InCellSize, Cells);
+
+	uint32 DrawsBefore = 0;
+	uint32 DrawsAfter = 0;
+	uint64 BufferSize = 0;
+	for (FStaticMeshMergedCell& Cell : Cells)
 	{
-		// UE_LOG("UpdateOctree: %d개의 컴포넌트가 업데이트 되었습니다.", Count);
+		TArray<UStaticMeshComponent*> CellSources;
+		CellSources.reserve(Cell.SourceIndices.size());
+		for (int32 SourceIndex : Cell.SourceIndices)
+		{
+			CellSources.push_back(Candidates[SourceIndex]);
+		}
+
+		UStaticBatchComponent* Batch = NewObject<UStaticBatchComponent>(this);
+		Batch->SetMergedCell(std::move(Cell), CellSources);
+
+		// 원본은 컬링 구조에서 빼고 셀만 등록한다
+		for (UStaticMeshComponent* Source : CellSources)
+		{
+			StaticOctree->Remove(Source);
+			OnPrimitiveUnregistered(Source);
+			Source->bIsStaticBatched = true;
+			StaticBatchOfSource[Source] = Batch;
+		}
+		AddPrimitiveToOctree(Batch);
+		StaticBatches.push_back(Batch);
+
+		DrawsBefore += Batch->GetSourceDrawCount();
+		DrawsAfter += Batch->GetDrawCount();
+		BufferSize += Batch->GetMergedBufferSize();
 	}
+
+	UE_LOG_SUCCESS("Level: 정적 배치 %zu cells <- %zu / %zu components | draws %u -> %u | merged buffers %.2f MB | %.3fms",
+		StaticBatches.size(), StaticBatchOfSource.size(), Candidates.size(), DrawsBefore, DrawsAfter,
+		static_cast<double>(BufferSize) / (1024.0 * 1024.0), Counter.Finish());
 }
 
-void ULevel::OnPrimitiveUpdated(UPrimitiveComponent* InComponent)
+void ULevel::ReleaseStaticBatches()
 {
-	if (!InComponent)
+	if (StaticBatches.empty())
 	{
 		return;
 	}
 
-	float GameTime = UTimeManager::GetInstance().GetGameTime();
-	if (auto It = DynamicPrimitiveMap.find(InComponent); It != DynamicPrimitiveMap.end())
+	while (!StaticBatches.empty())
 	{
-		It->second = GameTime;
+		DestroyStaticBatch(StaticBatches.back(), true);
 	}
-	else
+
+	// 이미 셀에서 빠져 등록을 기다리던 원본도 바로 등록한다
+	FlushStaticBatchChanges();
+
+	UE_LOG("Level: 정적 배치를 모두 풀었습니다");
+}
+
+void ULevel::DestroyStaticBatch(UStaticBatchComponent* InBatch, bool bInRestoreSources)
+{
+	for (UStaticMeshComponent* Source : InBatch->GetSources())
+	{
+		StaticBatchOfSource.erase(Source);
+		Source->bIsStaticBatched = false;
+		if (bInRestoreSources)
+		{
+			AddPrimitiveToOctree(Source);
+		}
+	}
+
+	StaticOctree->Remove(InBatch);
+	OnPrimitiveUnregistered(InBatch);
+	DirtyStaticBatches.erase(InBatch);
+	if (auto It = std::find(StaticBatches.begin(), StaticBatches.end(), InBatch); It != StaticBatches.end())
 	{
-		DynamicPrimitiveMap[InComponent] = UTimeManager::GetInstance().GetGameTime();
+		StaticBatches.erase(It);
+	}
 
-		DynamicPrimitiveQueue.push({InComponent, GameTime});
+	SafeDelete(InBatch);
+}
+
+void ULevel::DetachFromStaticBatch(UPrimitiveComponent* InComponent)
+{
+	auto It = StaticBatchOfSource.find(InComponent);
+	if (It == StaticBatchOfSource.end())
+	{
+		return;
 	}
+
+	UStaticBatchComponent* Batch = It->second;
+	StaticBatchOfSource.erase(It);
+	InComponent->bIsStaticBatched = false;
+
+	// 합친 메시는 같은 프레임에 빠지는 원본을 모아 FlushStaticBatchChanges에서 한 번만 다시 합친다
+	Batch->RemoveSource(static_cast<UStaticMeshComponent*>(InComponent));
+	DirtyStaticBatches.insert(Batch);
 }
 
-void ULevel::OnPrimitiveUnregistered(UPrimitiveComponent* InComponent)
+void ULevel::FlushStaticBatchChanges()
 {
-	if (!InComponent)
+	if (!PendingStaticBatchSplits.empty())
+	{
+		TArray<UPrimitiveComponent*> Splits(PendingStaticBatchSplits.begin(), PendingStaticBatchSplits.end());
+		PendingStaticBatchSplits.clear();
+		for (UPrimitiveComponent* Primitive : Splits)
+		{
+			AddPrimitiveToOctree(Primitive);
+		}
+	}
+
+	if (DirtyStaticBatches.empty())
 	{
 		return;
 	}
 
-	if (auto It = DynamicPrimitiveMap.find(InComponent); It != DynamicPrimitiveMap.end())
+	TArray<UStaticBatchComponent*> Batches(DirtyStaticBatches.begin(), DirtyStaticBatches.end());
+	DirtyStaticBatches.clear();
+	for (UStaticBatchComponent* Batch : Batches)
 	{
-		DynamicPrimitiveMap.erase(It);
+		// 하나만 남으면 셀로 그릴 이유가 없으므로 원본을 돌려놓는다
+		const TArray<UStaticMeshComponent*> Sources = Batch->GetSources();
+		if (static_cast<int32>(Sources.size()) < FStaticMeshMerger::MIN_SOURCES_PER_CELL)
+		{
+			DestroyStaticBatch(Batch, true);
+			continue;
+		}
+
+		// 남은 원본은 셀을 만들 때와 같은 머티리얼 집합이므로 그대로 한 셀로 다시 합친다
+		TArray<FStaticMeshMergeSource> MergeSources;
+		TArray<int32> SourceIndices;
+		for (UStaticMeshComponent* Source : Sources)
+		{
+			SourceIndices.push_back(static_cast<int32>(MergeSources.size()));
+			MergeSources.push_back(MakeStaticMergeSource(Source));
+		}
+
+		FStaticMeshMergedCell Cell;
+		FStaticMeshMerger::MergeCell(MergeSources, SourceIndices, Cell);
+		Batch->SetMergedCell(std::move(Cell), Sources);
+
+		// 경계가 줄었을 수 있으므로 다른 프리미티브와 함께 재배치한다
+		OnPrimitiveUpdated(Batch);
 	}
 }
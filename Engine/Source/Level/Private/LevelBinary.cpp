@@ -0,0 +1,625 @@
+#include "pch.h"
+
+#include "Level/Public/LevelBinary.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Public/SceneComponent.h"
+#include "Core/Public/Archive.h"
+#include "Core/Public/NewObject.h"
+#include "Editor/Public/Viewport.h"
+#include "Level/Public/Level.h"
+#include "Manager/Config/Public/ConfigManager.h"
+#include "Render/Renderer/Public/Renderer.h"
+#include "Utility/Public/JsonSerializer.h"
+
+#include <json.hpp>
+
+namespace
+{
+	/** @brief 변환 블록을 SIMD 로드에 맞춰 쓸 수 있도록 모든 섹션을 16바이트 경계에 둔다 */
+	constexpr size_t SECTION_ALIGNMENT = 16;
+
+	/** @brief 헤더 자리를 비워 두고 섹션을 정렬해 이어 붙인 뒤, 마지막에 문자열 테이블과 헤더를 채운다 */
+	class FLevelWriter
+	{
+	public:
+		FLevelWriter()
+		{
+			Blob.resize(sizeof(FLevelBinary::FHeader));
+		}
+
+		template<typename T>
+		FLevelBinary::FRange Append(const TArray<T>& InArray)
+		{
+			Blob.resize((Blob.size() + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT);
+
+			const FLevelBinary::FRange Range = { Blob.size(), InArray.size() };
+			if (!InArray.empty())
+			{
+				Blob.resize(Blob.size() + sizeof(T) * InArray.size());
+				memcpy(&Blob[Range.Offset], InArray.data(), sizeof(T) * InArray.size());
+			}
+			return Range;
+		}
+
+		/** @brief 같은 문자열은 한 번만 저장하고 같은 인덱스를 돌려준다 */
+		uint32 AddString(const FString& InString)
+		{
+			auto Found = StringIndices.find(InString);
+			if (Found != StringIndices.end())
+			{
+				return Found->second;
+			}
+
+			const uint32 Index = static_cast<uint32>(Strings.size());
+			Strings.push_back({ static_cast<uint32>(Characters.size()), static_cast<uint32>(InString.size()) });
+			Characters.insert(Characters.end(), InString.begin(), InString.end());
+			StringIndices.emplace(InString, Index);
+			return Index;
+		}
+
+		const TArray<uint8>& Finish(FLevelBinary::FHeader& InOutHeader)
+		{
+			InOutHeader.Characters = Append(Characters);
+			InOutHeader.Strings = Append(Strings);
+			InOutHeader.FileSize = Blob.size();
+			memcpy(Blob.data(), &InOutHeader, sizeof(FLevelBinary::FHeader));
+			return Blob;
+		}
+
+	private:
+		TArray<uint8> Blob;
+		TArray<char> Characters;
+		TArray<FLevelBinary::FStringRange> Strings;
+		TMap<FString, uint32> StringIndices;
+	};
+
+	/** @brief 컴포넌트 프로퍼티를 하나의 블록에 이어 쓰고, FName은 문자열 테이블 인덱스로 바꾼다 */
+	struct FPropertyWriter : public FArchive
+	{
+		FPropertyWriter(TArray<uint8>& InBlob, FLevelWriter& InWriter)
+			: Blob(InBlob), Writer(InWriter)
+		{
+		}
+
+		bool IsLoading() const override { return false; }
+
+		void Serialize(void* V, size_t Length) override
+		{
+			const uint8* Bytes = static_cast<const uint8*>(V);
+			Blob.insert(Blob.end(), Bytes, Bytes + Length);
+		}
+
+		void SerializeName(FName& Value) override
+		{
+			uint32 Index = Writer.AddString(Value.ToString());
+			*this << Index;
+		}
+
+	private:
+		TArray<uint8>& Blob;
+		FLevelWriter& Writer;
+	};
+
+	/** @brief 매핑된 프로퍼티 블록 하나를 읽는다, 범위를 넘으면 0으로 채우고 bIsValid가 false가 된다 */
+	struct FPropertyReader : public FArchive
+	{
+		FPropertyReader(const uint8* InData, size_t InSize, const TArray<FName>& InNames)
+			: Data(InData), Size(InSize), Names(InNames)
+		{
+		}
+
+		bool IsLoading() const override { return true; }
+
+		void Serialize(void* V, size_t Length) override
+		{
+			if (Length > Size - Position)
+			{
+				memset(V, 0, Length);
+				Position = Size;
+				bIsValid = false;
+				return;
+			}
+
+			memcpy(V, Data + Position, Length);
+			Position += Length;
+		}
+
+		void SerializeName(FName& Value) override
+		{
+			uint32 Index = 0;
+			*this << Index;
+
+			if (Index < Names.size())
+			{
+				Value = Names[Index];
+			}
+			else
+			{
+				Value = FName::GetNone();
+				bIsValid = false;
+			}
+		}
+
+		const uint8* Data;
+		size_t Size;
+		size_t Position = 0;
+		const TArray<FName>& Names;
+		bool bIsValid = true;
+	};
+
+	/** @brief 매핑된 파일에서 섹션을 복사 없이 가리키는 포인터를 꺼낸다, 범위를 벗어나면 bIsValid가 false가 된다 */
+	struct FSectionView
+	{
+		const uint8* Data;
+		size_t Size;
+		bool bIsValid = true;
+
+		template<typename T>
+		const T* Get(const FLevelBinary::FRange& InRange)
+		{
+			if (InRange.Count == 0)
+			{
+				return nullptr;
+			}
+
+			if (InRange.Offset % alignof(T) != 0 || InRange.Offset > Size || InRange.Count > (Size - InRange.Offset) / sizeof(T))
+			{
+				bIsValid = false;
+				return nullptr;
+			}
+			return reinterpret_cast<const T*>(Data + InRange.Offset);
+		}
+	};
+
+	/** @brief 모든 뷰포트 카메라의 스냅샷, Convert는 임시 레벨이 덮어쓴 카메라를 이것으로 되돌린다 */
+	struct FCameraSnapshot
+	{
+		FViewportCameraData Cameras[4];
+
+		FCameraSnapshot()
+		{
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				Cameras[Index] = UConfigManager::GetInstance().GetViewportCameraData(Index);
+			}
+		}
+
+		void Restore() const
+		{
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				UConfigManager::GetInstance().SetViewportCameraData(Index, Cameras[Index]);
+			}
+			URenderer::GetInstance().GetViewportClient()->ApplyAllCameraDataToViewportClients();
+		}
+	};
+}
+
+bool FLevelBinary::IsBinaryLevelPath(const std::filesystem::path& InFilePath)
+{
+	FString Extension = InFilePath.extension().string();
+	std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+	return Extension == ".scenebin";
+}
+
+bool FLevelBinary::Save(ULevel& InLevel, const std::filesystem::path& InFilePath)
+{
+	FLevelWriter Writer;
+	FHeader Header = {};
+	Header.Magic = MAGIC;
+	Header.Version = VERSION;
+
+	// JSON 저장과 같이 뷰포트 클라이언트의 최신 카메라를 ConfigManager로 동기화한 뒤 기록
+	URenderer::GetInstance().GetViewportClient()->UpdateCameraSettingsToConfig();
+	TArray<FCamera> Cameras;
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		const FViewportCameraData& Source = UConfigManager::GetInstance().GetViewportCameraData(Index);
+		FCamera Camera = {};
+		Camera.Location = Source.Location;
+		Camera.Rotation = Source.Rotation;
+		Camera.FovY = Source.FovY;
+		Camera.FarClip = Source.FarClip;
+		Camera.NearClip = Source.NearClip;
+		Camera.ViewportCameraType = static_cast<int32>(Source.ViewportCameraType);
+		Cameras.push_back(Camera);
+	}
+
+	const TArray<AActor*>& LevelActors = InLevel.GetLevelActors();
+
+	TMap<UClass*, uint32> ClassIndices;
+	TArray<uint32> ClassNames;
+	auto GetClassIndex = [&](UClass* InClass)
+	{
+		auto Found = ClassIndices.find(InClass);
+		if (Found != ClassIndices.end())
+		{
+			return Found->second;
+		}
+
+		const uint32 Index = static_cast<uint32>(ClassNames.size());
+		ClassNames.push_back(Writer.AddString(InClass->GetName().ToString()));
+		ClassIndices.emplace(InClass, Index);
+		return Index;
+	};
+
+	TArray<FActor> Actors;
+	TArray<FComponent> Components;
+	TArray<FVector> Locations;
+	TArray<FQuaternion> Rotations;
+	TArray<FVector> Scales;
+	TArray<uint8> Properties;
+	Actors.reserve(LevelActors.size());
+
+	FPropertyWriter PropertyWriter(Properties, Writer);
+	for (AActor* Actor : LevelActors)
+	{
+		if (!Actor)
+		{
+			continue;
+		}
+
+		FActor ActorRecord = {};
+		ActorRecord.ClassIndex = GetClassIndex(Actor->GetClass());
+		ActorRecord.FirstComponent = static_cast<uint32>(Components.size());
+		ActorRecord.Flags = (Actor->CanTick() ? ACTOR_CAN_EVER_TICK : 0) | (Actor->CanTickInEditor() ? ACTOR_TICK_IN_EDITOR : 0);
+
+		const TArray<UActorComponent*>& OwnedComponents = Actor->GetOwnedComponents();
+		for (UActorComponent* Component : OwnedComponents)
+		{
+			FComponent ComponentRecord = {};
+			ComponentRecord.ClassIndex = GetClassIndex(Component->GetClass());
+			ComponentRecord.NameIndex = Writer.AddString(Component->GetName().ToString());
+			ComponentRecord.ParentIndex = INDEX_NONE;
+			ComponentRecord.TransformIndex = INDEX_NONE;
+			ComponentRecord.PropertyOffset = static_cast<uint32>(Properties.size());
+
+			if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+			{
+				ComponentRecord.TransformIndex = static_cast<int32>(Locations.size());
+				Locations.push_back(SceneComponent->GetRelativeLocation());
+				Rotations.push_back(SceneComponent->GetRelativeRotation());
+				Scales.push_back(SceneComponent->GetRelativeScale3D());
+
+				if (USceneComponent* Parent = SceneComponent->GetAttachParent())
+				{
+					auto Found = std::find(OwnedComponents.begin(), OwnedComponents.end(), Parent);
+					if (Found != OwnedComponents.end())
+					{
+						ComponentRecord.ParentIndex = static_cast<int32>(Found - OwnedComponents.begin());
+					}
+					else
+					{
+						UE_LOG_WARNING("LevelBinary: %s의 부모가 같은 액터에 없어 루트로 저장합니다", Component->GetName().ToString().c_str());
+					}
+				}
+			}
+
+			Component->SerializeBinary(PropertyWriter);
+			ComponentRecord.PropertySize = static_cast<uint32>(Properties.size()) - ComponentRecord.PropertyOffset;
+			Components.push_back(ComponentRecord);
+		}
+
+		ActorRecord.ComponentCount = static_cast<uint32>(Components.size()) - ActorRecord.FirstComponent;
+		Actors.push_back(ActorRecord);
+	}
+
+	Header.Classes = Writer.Append(ClassNames);
+	Header.Cameras = Writer.Append(Cameras);
+	Header.Actors = Writer.Append(Actors);
+	Header.Components = Writer.Append(Components);
+	Header.Locations = Writer.Append(Locations);
+	Header.Rotations = Writer.Append(Rotations);
+	Header.Scales = Writer.Append(Scales);
+	Header.Properties = Writer.Append(Properties);
+
+	const TArray<uint8>& Blob = Writer.Finish(Header);
+
+	std::filesystem::path TempPath = InFilePath;
+	TempPath += ".tmp";
+	{
+		std::ofstream Stream(TempPath, std::ios::binary | std::ios::out | std::ios::trunc);
+		if (!Stream || !Stream.write(reinterpret_cast<const char*>(Blob.data()), static_cast<std::streamsize>(Blob.size())))
+		{
+			UE_LOG_ERROR("LevelBinary: 레벨 파일을 쓰지 못했습니다: %s", TempPath.string().c_str());
+			return false;
+		}
+	}
+
+	std::error_code Error;
+	std::filesystem::rename(TempPath, InFilePath, Error);
+	if (Error)
+	{
+		std::filesystem::remove(TempPath, Error);
+		UE_LOG_ERROR("LevelBinary: 레벨 파일을 교체하지 못했습니다: %s", InFilePath.string().c_str());
+		return false;
+	}
+	return true;
+}
+
+bool FLevelBinary::Convert(const std::filesystem::path& InSourcePath, const std::filesystem::path& InDestinationPath)
+{
+	const FCameraSnapshot CameraSnapshot;
+	ULevel* Level = NewObject<ULevel>();
+	bool bIsLoaded = false;
+	bool bIsSaved = false;
+
+	try
+	{
+		if (IsBinaryLevelPath(InSourcePath))
+		{
+			FLevelBinaryReader Reader;
+			bIsLoaded = Reader.Open(InSourcePath);
+			if (bIsLoaded)
+			{
+				Reader.Load(*Level);
+			}
+		}
+		else
+		{
+			FJsonDocument LevelDocument;
+			bIsLoaded = FJsonSerializer::LoadJsonFromFile(LevelDocument, InSourcePath.string());
+			if (bIsLoaded)
+			{
+				Level->Deserialize(LevelDocument.GetRoot());
+			}
+		}
+
+		if (bIsLoaded)
+		{
+			if (IsBinaryLevelPath(InDestinationPath))
+			{
+				bIsSaved = Save(*Level, InDestinationPath);
+			}
+			else
+			{
+				JSON LevelJson;
+				Level->Serialize(false, LevelJson);
+				bIsSaved = FJsonSerializer::SaveJsonToFile(LevelJson, InDestinationPath.string());
+			}
+		}
+	}
+	catch (const exception& Exception)
+	{
+		UE_LOG_ERROR("LevelBinary: 변환 중 예외 발생: %s", Exception.what());
+		bIsSaved = false;
+	}
+
+	const size_t ActorCount = Level->GetLevelActors().size();
+	SafeDelete(Level);
+	CameraSnapshot.Restore();
+
+	if (!bIsLoaded)
+	{
+		UE_LOG_ERROR("LevelBinary: 원본 레벨을 읽지 못했습니다: %s", InSourcePath.string().c_str());
+		return false;
+	}
+	if (!bIsSaved)
+	{
+		UE_LOG_ERROR("LevelBinary: 변환한 레벨을 저장하지 못했습니다: %s", InDestinationPath.string().c_str());
+		return false;
+	}
+
+	UE_LOG_SUCCESS("LevelBinary: %s -> %s (%zu actors)", InSourcePath.string().c_str(), InDestinationPath.string().c_str(), ActorCount);
+	return true;
+}
+
+bool FLevelBinaryReader::Open(const std::filesystem::path& InFilePath)
+{
+	Names.clear();
+	Classes.clear();
+
+	if (!File.Open(InFilePath) || File.GetSize() < sizeof(FLevelBinary::FHeader))
+	{
+		UE_LOG_ERROR("LevelBinary: 레벨 파일을 열지 못했습니다: %s", InFilePath.string().c_str());
+		return false;
+	}
+
+	memcpy(&Header, File.GetData(), sizeof(FLevelBinary::FHeader));
+	if (Header.Magic != FLevelBinary::MAGIC || Header.Version != FLevelBinary::VERSION || Header.FileSize != File.GetSize())
+	{
+		UE_LOG_ERROR("LevelBinary: 레벨 파일의 버전이 다릅니다. JSON에서 다시 변환해야 합니다: %s", InFilePath.string().c_str());
+		return false;
+	}
+
+	FSectionView View = { File.GetData(), File.GetSize() };
+	const char* Characters = View.Get<char>(Header.Characters);
+	const FLevelBinary::FStringRange* Strings = View.Get<FLevelBinary::FStringRange>(Header.Strings);
+	const uint32* ClassNames = View.Get<uint32>(Header.Classes);
+	Cameras = View.Get<FLevelBinary::FCamera>(Header.Cameras);
+	Actors = View.Get<FLevelBinary::FActor>(Header.Actors);
+	Components = View.Get<FLevelBinary::FComponent>(Header.Components);
+	Locations = View.Get<FVector>(Header.Locations);
+	Rotations = View.Get<FQuaternion>(Header.Rotations);
+	Scales = View.Get<FVector>(Header.Scales);
+	Properties = View.Get<uint8>(Header.Properties);
+
+	bool bIsValid = View.bIsValid &&
+		Header.Rotations.Count == Header.Locations.Count &&
+		Header.Scales.Count == Header.Locations.Count &&
+		Header.Cameras.Count <= 4;
+
+	for (uint64 Index = 0; bIsValid && Index < Header.Strings.Count; ++Index)
+	{
+		bIsValid = static_cast<uint64>(Strings[Index].Offset) + Strings[Index].Length <= Header.Characters.Count;
+	}
+	for (uint64 Index = 0; bIsValid && Index < Header.Classes.Count; ++Index)
+	{
+		bIsValid = ClassNames[Index] < Header.Strings.Count;
+	}
+
+	// 부모 인덱스는 액터 안의 컴포넌트 수로만 검증할 수 있으므로 액터 단위로 컴포넌트를 훑는다
+	for (uint64 ActorIndex = 0; bIsValid && ActorIndex < Header.Actors.Count; ++ActorIndex)
+	{
+		const FLevelBinary::FActor& Actor = Actors[ActorIndex];
+		bIsValid = Actor.ClassIndex < Header.Classes.Count &&
+			static_cast<uint64>(Actor.FirstComponent) + Actor.ComponentCount <= Header.Components.Count;
+
+		for (uint32 Local = 0; bIsValid && Local < Actor.ComponentCount; ++Local)
+		{
+			const FLevelBinary::FComponent& Component = Components[Actor.FirstComponent + Local];
+			bIsValid = Component.ClassIndex < Header.Classes.Count &&
+				Component.NameIndex < Header.Strings.Count &&
+				(Component.ParentIndex == FLevelBinary::INDEX_NONE || (Component.ParentIndex >= 0 && static_cast<uint32>(Component.ParentIndex) < Actor.ComponentCount)) &&
+				(Component.TransformIndex == FLevelBinary::INDEX_NONE || (Component.TransformIndex >= 0 && static_cast<uint64>(Component.TransformIndex) < Header.Locations.Count)) &&
+				static_cast<uint64>(Component.PropertyOffset) + Component.PropertySize <= Header.Properties.Count;
+		}
+	}
+
+	if (!bIsValid)
+	{
+		UE_LOG_ERROR("LevelBinary: 레벨 파일이 손상되었습니다: %s", InFilePath.string().c_str());
+		return false;
+	}
+
+	Names.reserve(Header.Strings.Count);
+	for (uint64 Index = 0; Index < Header.Strings.Count; ++Index)
+	{
+		Names.emplace_back(FString(Characters + Strings[Index].Offset, Strings[Index].Length));
+	}
+
+	Classes.reserve(Header.Classes.Count);
+	for (uint64 Index = 0; Index < Header.Classes.Count; ++Index)
+	{
+		UClass* Class = UClass::FindClass(Names[ClassNames[Index]]);
+		if (!Class)
+		{
+			UE_LOG_WARNING("LevelBinary: 클래스 %s를 찾지 못해 해당 객체를 건너뜁니다", Names[ClassNames[Index]].ToString().c_str());
+		}
+		Classes.push_back(Class);
+	}
+
+	// 클래스 테이블은 액터와 컴포넌트가 함께 쓰므로, 레코드마다 기대하는 기반 클래스의 하위인지 확인해야 Cast 실패로 객체가 새지 않는다
+	for (uint64 ActorIndex = 0; ActorIndex < Header.Actors.Count; ++ActorIndex)
+	{
+		const FLevelBinary::FActor& Actor = Actors[ActorIndex];
+		const UClass* ActorClass = Classes[Actor.ClassIndex];
+		if (ActorClass && !ActorClass->IsChildOf(AActor::StaticClass()))
+		{
+			UE_LOG_ERROR("LevelBinary: 액터 레코드의 클래스 %s가 액터가 아닙니다: %s", ActorClass->GetName().ToString().c_str(), InFilePath.string().c_str());
+			return false;
+		}
+
+		for (uint32 Local = 0; Local < Actor.ComponentCount; ++Local)
+		{
+			const UClass* ComponentClass = Classes[Components[Actor.FirstComponent + Local].ClassIndex];
+			if (ComponentClass && !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
+			{
+				UE_LOG_ERROR("LevelBinary: 컴포넌트 레코드의 클래스 %s가 컴포넌트가 아닙니다: %s", ComponentClass->GetName().ToString().c_str(), InFilePath.string().c_str());
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void FLevelBinaryReader::Load(ULevel& OutLevel)
+{
+	if (Header.Cameras.Count == 4)
+	{
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			const FLevelBinary::FCamera& Source = Cameras[Index];
+			FViewportCameraData Camera;
+			Camera.Location = Source.Location;
+			Camera.Rotation = Source.Rotation;
+			Camera.FovY = Source.FovY;
+			Camera.FarClip = Source.FarClip;
+			Camera.NearClip = Source.NearClip;
+			Camera.ViewportCameraType = static_cast<EViewportCameraType>(Source.ViewportCameraType);
+			UConfigManager::GetInstance().SetViewportCameraData(Index, Camera);
+		}
+		URenderer::GetInstance().GetViewportClient()->ApplyAllCameraDataToViewportClients();
+	}
+
+	GetUObjectArray().Reserve(static_cast<uint32>(Header.Actors.Count + Header.Components.Count));
+	OutLevel.LevelActors.reserve(OutLevel.LevelActors.size() + Header.Actors.Count);
+
+	for (uint64 Index = 0; Index < Header.Actors.Count; ++Index)
+	{
+		AActor* NewActor = LoadActor(Actors[Index]);
+		if (NewActor)
+		{
+			// ULevel::SpawnActorToLevel과 같은 순서
+			OutLevel.LevelActors.push_back(NewActor);
+			NewActor->BeginPlay();
+			OutLevel.AddLevelComponent(NewActor);
+		}
+	}
+}
+
+AActor* FLevelBinaryReader::LoadActor(const FLevelBinary::FActor& InActor)
+{
+	UClass* ActorClass = Classes[InActor.ClassIndex];
+	AActor* NewActor = ActorClass ? Cast<AActor>(NewObject(ActorClass)) : nullptr;
+	if (!NewActor)
+	{
+		return nullptr;
+	}
+
+	NewActor->SetCanTick((InActor.Flags & FLevelBinary::ACTOR_CAN_EVER_TICK) != 0);
+	NewActor->SetTickInEditor((InActor.Flags & FLevelBinary::ACTOR_TICK_IN_EDITOR) != 0);
+
+	TArray<UActorComponent*>& OwnedComponents = NewActor->GetOwnedComponents();
+	OwnedComponents.reserve(InActor.ComponentCount);
+
+	// 부모 인덱스로 바로 찾도록 레코드 순서 그대로 씬 컴포넌트를 모아 둔다 (씬 컴포넌트가 아니거나 생성 실패면 nullptr)
+	TArray<USceneComponent*> SceneComponents(InActor.ComponentCount, nullptr);
+	for (uint32 Local = 0; Local < InActor.ComponentCount; ++Local)
+	{
+		const FLevelBinary::FComponent& Record = Components[InActor.FirstComponent + Local];
+		UClass* ComponentClass = Classes[Record.ClassIndex];
+		UActorComponent* NewComponent = ComponentClass ? Cast<UActorComponent>(NewObject(ComponentClass)) : nullptr;
+		if (!NewComponent)
+		{
+			continue;
+		}
+
+		NewComponent->SetName(Names[Record.NameIndex]);
+		NewComponent->SetOwner(NewActor);
+		OwnedComponents.push_back(NewComponent);
+
+		FPropertyReader PropertyReader(Properties ? Properties + Record.PropertyOffset : nullptr, Record.PropertySize, Names);
+		NewComponent->SerializeBinary(PropertyReader);
+		if (!PropertyReader.bIsValid)
+		{
+			UE_LOG_WARNING("LevelBinary: %s의 프로퍼티가 손상되어 기본값으로 채웠습니다", Names[Record.NameIndex].ToString().c_str());
+		}
+
+		if (USceneComponent* SceneComponent = Cast<USceneComponent>(NewComponent))
+		{
+			if (Record.TransformIndex != FLevelBinary::INDEX_NONE)
+			{
+				SceneComponent->SetRelativeLocation(Locations[Record.TransformIndex]);
+				SceneComponent->SetRelativeRotation(Rotations[Record.TransformIndex]);
+				SceneComponent->SetRelativeScale3D(Scales[Record.TransformIndex]);
+			}
+			SceneComponents[Local] = SceneComponent;
+		}
+	}
+
+	for (uint32 Local = 0; Local < InActor.ComponentCount; ++Local)
+	{
+		USceneComponent* SceneComponent = SceneComponents[Local];
+		if (!SceneComponent)
+		{
+			continue;
+		}
+
+		const int32 ParentIndex = Components[InActor.FirstComponent + Local].ParentIndex;
+		if (ParentIndex == FLevelBinary::INDEX_NONE)
+		{
+			NewActor->SetRootComponent(SceneComponent);
+		}
+		else if (SceneComponents[ParentIndex])
+		{
+			SceneComponent->AttachToComponent(SceneComponents[ParentIndex], true);
+		}
+		else
+		{
+			UE_LOG("Failed to find parent component: %s", SceneComponent->GetName().ToString().c_str());
+		}
+	}
+
+	return NewActor;
+}
@@ -1,9 +1,11 @@
 #include "pch.h"
 #include "Level/Public/World.h"
 #include "Level/Public/Level.h"
+#include "Level/Public/LevelBinary.h"
 #include "Utility/Public/JsonSerializer.h"
 #include "Manager/Config/Public/ConfigManager.h"
 #include "Manager/Path/Public/PathManager.h"
+#include "Optimization/Public/StaticMeshMerger.h"
 
 IMPLEMENT_CLASS(UWorld, UObject)
 
@@ -120,7 +122,7 @@ ULevel* UWorld::GetLevel() const
 */
 bool UWorld::LoadLevel(path InLevelFilePath)
 {
-	JSON LevelJson;
+	FJsonDocument LevelDocument;
 	ULevel* NewLevel = nullptr;
 
 	try
@@ -129,7 +131,19 @@ bool UWorld::LoadLevel(path InLevelFilePath)
 		NewLevel = NewObject<ULevel>(this);
 		NewLevel->SetName(LevelNameString);
 
-		if (!FJsonSerializer::LoadJsonFromFile(LevelJson, InLevelFilePath.string()))
+		// 바이너리 레벨은 현재 레벨을 교체하기 전에 파일 전체를 검증한다
+		const bool bIsBinaryLevel = FLevelBinary::IsBinaryLevelPath(InLevelFilePath);
+		FLevelBinaryReader BinaryReader;
+		if (bIsBinaryLevel)
+		{
+			if (!BinaryReader.Open(InLevelFilePath))
+			{
+				UE_LOG_ERROR("World: Level 바이너리 로드에 실패했습니다: %s", InLevelFilePath.string().c_str());
+				SafeDelete(NewLevel);
+				return false;
+			}
+		}
+		else if (!FJsonSerializer::LoadJsonFromFile(LevelDocument, InLevelFilePath.string()))
 		{
 			UE_LOG_ERROR("World: Level JSON 로드에 실패했습니다: %s", InLevelFilePath.string().c_str());
 			SafeDelete(NewLevel);
@@ -138,7 +152,19 @@ bool UWorld::LoadLevel(path InLevelFilePath)
 
 		NewLevel->SetOuter(this);
 		SwitchToLevel(NewLevel);
-		NewLevel->Serialize(true, LevelJson);
+		if (bIsBinaryLevel)
+		{
+			BinaryReader.Load(*NewLevel);
+		}
+		else
+		{
+			NewLevel->Deserialize(LevelDocument.GetRoot());
+		}
+
+		if (bIsStaticBatchingEnabled)
+		{
+			NewLevel->BuildStaticBatches(FStaticMeshMerger::DEFAULT_CELL_SIZE);
+		}
 
 		UConfigManager::GetInstance().SetLastUsedLevelPath(InLevelFilePath.string());
 		BeginPlay();
@@ -178,6 +204,11 @@ bool UWorld::SaveCurrentLevel(path InLevelFilePath) const
 
 	try
 	{
+		if (FLevelBinary::IsBinaryLevelPath(InLevelFilePath))
+		{
+			return FLevelBinary::Save(*Level, InLevelFilePath);
+		}
+
 		JSON LevelJson;
 		Level->Serialize(false, LevelJson);
 
@@ -197,7 +228,7 @@ bool UWorld::SaveCurrentLevel(path InLevelFilePath) const
 	return true;
 }
 
-AActor* UWorld::SpawnActor(UClass* InActorClass, JSON* ActorJsonData)
+AActor* UWorld::SpawnActor(UClass* InActorClass, const FJsonValue* ActorJsonData)
 {
 	if (!Level)
 	{
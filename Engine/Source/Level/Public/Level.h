@@ -2,6 +2,8 @@
 #include "Core/Public/Object.h"
 #include "Editor/Public/Camera.h"
 #include "Global/Enum.h"
+#include "Optimization/Public/PrimitiveBoundsSoA.h"
+#include "Optimization/Public/RenderProxyList.h"
 
 class UHeightFogComponent;
 
@@ -11,6 +13,8 @@ using JSON = json::JSON;
 class UWorld;
 class AActor;
 class UPrimitiveComponent;
+class UStaticMeshComponent;
+class UStaticBatchComponent;
 class ULightComponent;
 class FOctree;
 
@@ -26,6 +30,7 @@ public:
 	virtual void Init();
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void Deserialize(const FJsonValue& InHandle) override;
 
 	const TArray<AActor*>& GetLevelActors() const { return LevelActors; }
 
@@ -39,22 +44,26 @@ public:
 	void SetShowFlags(uint64 InShowFlags) { ShowFlags = InShowFlags; }
 
 	void UpdatePrimitiveInOctree(UPrimitiveComponent* InComponent);
+	/** @brief 렌더 정렬 키를 PrepareForCulling에서 다시 만들도록 예약 */
+	void UpdatePrimitiveRenderState(UPrimitiveComponent* InComponent);
 
 	FOctree* GetStaticOctree() { return StaticOctree; }
 
-	/** @todo: 효율 개선을 위해 DirtyFlag와 캐시 도입 가능 */
+	/** @brief 등록된 모든 프리미티브의 월드 AABB (SoA), UpdateOctree 이후 최신 상태 */
+	const FPrimitiveBoundsSoA& GetPrimitiveBounds() const { return PrimitiveBounds; }
+
+	/** @brief 등록된 모든 프리미티브의 렌더 정렬 키와 위치, PrepareForCulling 이후 최신 상태 */
+	const FRenderProxyList& GetRenderProxies() const { return RenderProxies; }
+
+	/** @brief Octree에 넣지 못한 프리미티브 목록 (매 프레임 개별 컬링 대상) */
 	TArray<UPrimitiveComponent*>& GetDynamicPrimitives()
 	{
-		DynamicPrimitives.clear();
-
-		for (auto [Component, TimePoint] : DynamicPrimitiveMap)
-		{
-			DynamicPrimitives.push_back(Component);
-		}
+		DynamicPrimitives.assign(DynamicPrimitiveSet.begin(), DynamicPrimitiveSet.end());
 		return DynamicPrimitives;
 	}
 
 	friend class UWorld;
+	friend class FLevelBinaryReader;
 public:
 	virtual UObject* Duplicate() override;
 
@@ -62,7 +71,7 @@ protected:
 	virtual void DuplicateSubObjects(UObject* DuplicatedObject) override;
 
 private:
-	AActor* SpawnActorToLevel(UClass* InActorClass, JSON* ActorJsonData = nullptr);
+	AActor* SpawnActorToLevel(UClass* InActorClass, const FJsonValue* ActorJsonData = nullptr);
 
 	TArray<AActor*> LevelActors;	// 레벨이 보유하고 있는 모든 Actor를 배열로 저장합니다.
 
@@ -81,40 +90,82 @@ private:
 	-----------------------------------------------------------------------------*/
 public:
 	void UpdateOctree();
+
+	/**
+	 * @brief 뷰포트 컬링 작업을 병렬로 시작하기 전에 메인 스레드에서 호출
+	 * 대기 중인 옥트리 재배치를 반영하고 지연 계산되는 월드 변환 캐시를 채워서,
+	 * 컬링 작업 동안 옥트리, PrimitiveBounds, 라이트를 읽기 전용으로 다룰 수 있게 한다.
+	 */
+	void PrepareForCulling();
 	
 private:
+	/** @brief StaticOctree에 삽입하고, 실패하면 DynamicPrimitiveSet에 보관 */
+	void AddPrimitiveToOctree(UPrimitiveComponent* InComponent);
 
 	void OnPrimitiveUpdated(UPrimitiveComponent* InComponent);
 
 	void OnPrimitiveUnregistered(UPrimitiveComponent* InComponent);
-
-	/** @brief 한 프레임에 Octree에 삽입할 오브젝트의 최대 크기를 결정해서 부하를 여러 프레임에 분산함. */
-	static constexpr uint32 MAX_OBJECTS_TO_INSERT_PER_FRAME = 256;
-	
-	/** @brief 가장 오래전에 움직인 UPrimitiveComponent를 Octree에 삽입하기 위해 필요한 구조체. */
-	struct FDynamicPrimitiveData
-	{
-		UPrimitiveComponent* Primitive;
-		float LastMoveTimePoint;
-
-		bool operator>(const FDynamicPrimitiveData& Other) const
-		{
-			return LastMoveTimePoint > Other.LastMoveTimePoint;
-		}
-	};
-	
-	using FDynamicPrimitiveQueue = TQueue<FDynamicPrimitiveData>;
 	
 	FOctree* StaticOctree = nullptr;
 
+	/** @brief 프러스텀 컬링 커널이 읽는 월드 AABB 배열, 프리미티브 등록/해제와 UpdateOctree에서 갱신 */
+	FPrimitiveBoundsSoA PrimitiveBounds;
+
+	/** @brief 프리미티브마다 미리 계산한 렌더 정렬 키, 렌더러가 가시성 비트셋으로 명령 목록을 만든다 */
+	FRenderProxyList RenderProxies;
+
+	/** @brief 정렬 키를 다시 만들어야 하는 프리미티브 (새로 등록, 메시/머티리얼 변경) */
+	TSet<UPrimitiveComponent*> PendingRenderProxyUpdates;
+
 	/** @deprecated 기존 코드와의 호환성을 위해 유지, 직접 사용하거나 업데이트하는 것을 금지함 */
 	TArray<UPrimitiveComponent*> DynamicPrimitives;
 
-	/** @brief 가장 오래전에 움직인 UPrimitiveComponent부터 순서대로 Octree에 삽입할 수 있도록 보관 */
-	FDynamicPrimitiveQueue DynamicPrimitiveQueue;
+	/** @brief 이번 프레임에 움직인 프리미티브, UpdateOctree에서 FOctree::Relocate로 한 번에 재배치 */
+	TSet<UPrimitiveComponent*> PendingOctreeRelocations;
+
+	/** @brief Octree에 삽입되지 못한 프리미티브 (유효하지 않은 AABB, 루트 확장 한계 초과) */
+	TSet<UPrimitiveComponent*> DynamicPrimitiveSet;
+
+	/*-----------------------------------------------------------------------------
+		Static Batching
+	-----------------------------------------------------------------------------*/
+public:
+	/**
+	 * @brief 움직이지 않는 작은 스태틱 메시를 셀과 머티리얼 집합별로 합쳐 원본 대신 컬링 구조에 등록 (FStaticMeshMerger 참고)
+	 * 이미 있는 배치는 풀고 다시 만든다. 원본은 액터에 그대로 남아 저장, 피킹, 디테일 편집에 쓰이며,
+	 * 움직이거나 메시, 머티리얼, 가시성이 바뀌면 다음 UpdateOctree에서 셀에서 빠져 다시 개별로 등록된다.
+	 * @param InCellSize 셀 한 변의 길이 (월드 단위)
+	 */
+	void BuildStaticBatches(float InCellSize);
+
+	/** @brief 모든 셀을 지우고 원본을 다시 개별로 등록 */
+	void ReleaseStaticBatches();
+
+	const TArray<UStaticBatchComponent*>& GetStaticBatches() const { return StaticBatches; }
+
+	/** @brief 셀에 합쳐진 원본 수 */
+	int32 GetNumStaticBatchedSources() const { return static_cast<int32>(StaticBatchOfSource.size()); }
+
+private:
+	/** @brief 셀을 지운다, bInRestoreSources면 남은 원본을 다시 개별로 등록 */
+	void DestroyStaticBatch(UStaticBatchComponent* InBatch, bool bInRestoreSources);
+
+	/** @brief 원본을 셀에서 빼고 셀을 다시 합치도록 예약, 원본의 재등록은 호출자가 정한다 */
+	void DetachFromStaticBatch(UPrimitiveComponent* InComponent);
+
+	/** @brief 셀에서 빼기로 예약된 원본을 다시 등록하고, 원본이 빠진 셀을 남은 원본으로 다시 합친다 */
+	void FlushStaticBatchChanges();
+
+	TArray<UStaticBatchComponent*> StaticBatches;
+
+	/** @brief 원본 컴포넌트가 합쳐진 셀 */
+	TMap<UPrimitiveComponent*, UStaticBatchComponent*> StaticBatchOfSource;
+
+	/** @brief 움직였거나 렌더 상태가 바뀌어 셀에서 빠진 원본, UpdateOctree에서 다시 개별로 등록한다 */
+	TSet<UPrimitiveComponent*> PendingStaticBatchSplits;
 
-	/** @brief 각 UPrimitiveComponent가 움직인 가장 마지막 시간을 기록 */
-	TMap<UPrimitiveComponent*, float> DynamicPrimitiveMap;
+	/** @brief 원본이 빠져 다시 합쳐야 하는 셀 */
+	TSet<UStaticBatchComponent*> DirtyStaticBatches;
 	
 	/*-----------------------------------------------------------------------------
 		Lighting Management
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Core/Public/Name.h"
+#include "Core/Public/WindowsMappedFile.h"
+
+class AActor;
+class ULevel;
+class UClass;
+
+/**
+ * @brief 레벨을 한 파일로 저장하는 바이너리 레벨 포맷 (.scenebin)
+ * 헤더 뒤에 정렬된 섹션을 이어 붙인다.
+ * - 문자열 테이블: 클래스 이름, 컴포넌트 이름, 에셋 경로를 한 번씩만 저장하고 인덱스로 가리킨다
+ * - 클래스 테이블: 로드할 때 UClass::FindClass를 클래스마다 한 번만 부른다
+ * - 액터/컴포넌트 레코드: 컴포넌트의 부모는 이름 대신 액터 안의 인덱스로 저장한다
+ * - 변환 블록: 씬 컴포넌트의 Location / Rotation(쿼터니언) / Scale을 각각 연속 배열로 저장한다
+ * - 프로퍼티 블록: 컴포넌트마다 UObject::SerializeBinary가 쓴 값
+ * @note JSON(.scene)은 사람이 읽고 비교하는 용도로 그대로 유지하며, Convert로 서로 바꿀 수 있다
+ */
+struct FLevelBinary
+{
+	/** @brief 파일 맨 앞 4바이트 "GTLV" */
+	static constexpr uint32 MAGIC = 0x564C5447;
+	/** @brief 레코드 레이아웃이나 컴포넌트의 SerializeBinary 내용이 바뀌면 올린다 */
+	static constexpr uint32 VERSION = 2;
+
+	/** @brief 섹션 위치, Offset은 파일 시작 기준 바이트 위치이고 Count는 원소 수 */
+	struct FRange
+	{
+		uint64 Offset;
+		uint64 Count;
+	};
+
+	/** @brief 문자열 테이블 안의 위치 */
+	struct FStringRange
+	{
+		uint32 Offset;
+		uint32 Length;
+	};
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 FileSize;
+
+		FRange Characters;
+		FRange Strings;
+		FRange Classes;
+		FRange Cameras;
+		FRange Actors;
+		FRange Components;
+		FRange Locations;
+		FRange Rotations;
+		FRange Scales;
+		FRange Properties;
+	};
+
+	/** @brief UConfigManager의 뷰포트 카메라 4개, JSON의 PerspectiveCamera와 같은 값 */
+	struct FCamera
+	{
+		FVector Location;
+		FVector Rotation;
+		float FovY;
+		float FarClip;
+		float NearClip;
+		int32 ViewportCameraType;
+	};
+
+	struct FActor
+	{
+		uint32 ClassIndex;
+		uint32 FirstComponent;
+		uint32 ComponentCount;
+		uint32 Flags;
+	};
+
+	struct FComponent
+	{
+		uint32 ClassIndex;
+		uint32 NameIndex;
+		/** @brief 같은 액터 안에서 부모 컴포넌트의 인덱스, 씬 컴포넌트가 아니거나 루트면 INDEX_NONE */
+		int32 ParentIndex;
+		/** @brief 변환 블록의 인덱스, 씬 컴포넌트가 아니면 INDEX_NONE */
+		int32 TransformIndex;
+		uint32 PropertyOffset;
+		uint32 PropertySize;
+	};
+
+	static constexpr int32 INDEX_NONE = -1;
+	static constexpr uint32 ACTOR_CAN_EVER_TICK = 1 << 0;
+	static constexpr uint32 ACTOR_TICK_IN_EDITOR = 1 << 1;
+
+	/** @brief 확장자가 .scenebin이면 true, 나머지는 JSON으로 다룬다 */
+	static bool IsBinaryLevelPath(const std::filesystem::path& InFilePath);
+
+	/**
+	 * @brief 레벨을 바이너리로 저장, 임시 파일에 쓴 뒤 교체하므로 중간에 실패해도 깨진 파일이 남지 않는다
+	 * @note JSON 저장과 같이 저장 직전의 뷰포트 카메라를 함께 기록한다
+	 */
+	static bool Save(ULevel& InLevel, const std::filesystem::path& InFilePath);
+
+	/**
+	 * @brief 확장자에 따라 JSON(.scene)과 바이너리(.scenebin) 사이를 변환
+	 * 임시 레벨에 읽은 뒤 다른 포맷으로 저장하며, 에디터의 뷰포트 카메라는 변환 전 상태로 되돌린다
+	 */
+	static bool Convert(const std::filesystem::path& InSourcePath, const std::filesystem::path& InDestinationPath);
+};
+
+/**
+ * @brief 바이너리 레벨을 매핑해서 앞에서부터 순서대로 읽는 로더
+ * Open에서 헤더, 모든 섹션 범위, 레코드 인덱스를 검증하고 클래스와 이름을 미리 풀어 두므로,
+ * Load는 검증 없이 액터 레코드를 차례로 훑으며 객체를 만들기만 한다. 잘못된 파일은 레벨을 건드리기 전에 걸러진다.
+ */
+class FLevelBinaryReader
+{
+public:
+	bool Open(const std::filesystem::path& InFilePath);
+
+	/**
+	 * @brief 액터와 컴포넌트를 생성해 OutLevel에 추가하고 BeginPlay까지 호출, JSON 로드와 같이 뷰포트 카메라도 적용한다
+	 * 레벨 배열과 오브젝트 배열은 전체 개수만큼 한 번에 예약한다.
+	 */
+	void Load(ULevel& OutLevel);
+
+	uint32 GetActorCount() const { return static_cast<uint32>(Header.Actors.Count); }
+	uint32 GetComponentCount() const { return static_cast<uint32>(Header.Components.Count); }
+
+private:
+	AActor* LoadActor(const FLevelBinary::FActor& InActor);
+
+	FWindowsMappedFile File;
+	FLevelBinary::FHeader Header = {};
+
+	const FLevelBinary::FCamera* Cameras = nullptr;
+	const FLevelBinary::FActor* Actors = nullptr;
+	const FLevelBinary::FComponent* Components = nullptr;
+	const FVector* Locations = nullptr;
+	const FQuaternion* Rotations = nullptr;
+	const FVector* Scales = nullptr;
+	const uint8* Properties = nullptr;
+
+	/** @brief 문자열 테이블을 FName으로 한 번씩만 등록해 둔 것 */
+	TArray<FName> Names;
+	/** @brief 클래스 테이블을 푼 결과, 찾지 못한 클래스는 nullptr이며 해당 액터/컴포넌트는 건너뛴다 */
+	TArray<UClass*> Classes;
+};
@@ -7,6 +7,7 @@ class UEditor;
 class ULevel;
 class AActor;
 class UClass;
+class FJsonValue;
 
 namespace json { class JSON; }
 using JSON = json::JSON;
@@ -54,7 +55,7 @@ public:
 	bool SaveCurrentLevel(std::filesystem::path InLevelFilePath) const;
 
 	// Actor Spawn & Destroy
-	AActor* SpawnActor(UClass* InActorClass, JSON* ActorJsonData = nullptr);
+	AActor* SpawnActor(UClass* InActorClass, const FJsonValue* ActorJsonData = nullptr);
 	bool DestroyActor(AActor* InActor); // Level의 void MarkActorForDeletion(AActor * InActor) 기능을 DestroyActor가 가짐
 
 	// TODO: World Scope Query Entrypoint
@@ -63,10 +64,15 @@ public:
 	EWorldType GetWorldType() const;
 	void SetWorldType(EWorldType InWorldType);
 
+	/** @brief 켜져 있으면 LoadLevel이 로드 직후 ULevel::BuildStaticBatches로 정적 배치를 만든다 (콘솔 SCENE BATCH ON/OFF) */
+	bool IsStaticBatchingEnabled() const { return bIsStaticBatchingEnabled; }
+	void SetStaticBatchingEnabled(bool bInEnabled) { bIsStaticBatchingEnabled = bInEnabled; }
+
 private:
 	EWorldType WorldType;
 	ULevel* Level = nullptr; // Persistance Level. Sublevels are not considered in GTL.
 	bool bBegunPlay = false;
+	bool bIsStaticBatchingEnabled = false;
 	TArray<AActor*> PendingDestroyActors;
 
 	void FlushPendingDestroy(); // Destroy marking 된 액터들을 실제 삭제
@@ -0,0 +1,207 @@
+#include "pch.h"
+
+#include "Core/Public/JobSystem.h"
+#include "Manager/Asset/Public/AssetLoader.h"
+#include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Asset/Public/ObjManager.h"
+
+void FAssetLoader::Gather(const path& InMeshDirectory, const path& InTextureDirectory)
+{
+	StaticMeshTasks.clear();
+	TextureTasks.clear();
+	TextureTaskIndices.clear();
+
+	// UAssetManager::LoadAllObjStaticMesh와 같이 메시는 '/' 구분자의 상대 경로로 등록
+	if (std::filesystem::exists(InMeshDirectory) && std::filesystem::is_directory(InMeshDirectory))
+	{
+		for (const auto& Entry : std::filesystem::recursive_directory_iterator(InMeshDirectory))
+		{
+			if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+			{
+				FStaticMeshLoadTask& Task = StaticMeshTasks.emplace_back();
+				Task.FilePath = Entry.path().generic_string();
+				Task.Name = FName(Task.FilePath.string());
+				Task.FileSize = Entry.file_size();
+			}
+		}
+	}
+
+	if (std::filesystem::exists(InTextureDirectory) && std::filesystem::is_directory(InTextureDirectory))
+	{
+		for (const auto& Entry : std::filesystem::recursive_directory_iterator(InTextureDirectory))
+		{
+			if (Entry.is_regular_file() && FTextureManager::IsSupportedTextureFile(Entry.path()))
+			{
+				AddTextureTask(Entry.path(), false);
+			}
+		}
+	}
+
+	// 큰 메시부터 시작해야 마지막에 긴 작업 하나만 남는 상황이 줄어든다
+	std::stable_sort(StaticMeshTasks.begin(), StaticMeshTasks.end(),
+		[](const FStaticMeshLoadTask& InA, const FStaticMeshLoadTask& InB)
+		{
+			return InA.FileSize > InB.FileSize;
+		});
+}
+
+void FAssetLoader::Cook(const FObjImporter::Configuration& InMeshConfig, FJobSystem* InJobSystem)
+{
+	WorkerCount = InJobSystem ? InJobSystem->GetWorkerCount() : 0;
+
+	FScopeCycleCounter CookCounter;
+
+	// 메시와 텍스처를 하나의 인덱스 공간으로 묶어 같은 ParallelFor에서 처리
+	auto CookRange = [&](size_t InTextureBegin)
+	{
+		const size_t MeshCount = InTextureBegin == 0 ? StaticMeshTasks.size() : 0;
+		const size_t TaskCount = MeshCount + TextureTasks.size() - InTextureBegin;
+
+		auto CookTask = [&](int32 InIndex)
+		{
+			const size_t Index = static_cast<size_t>(InIndex);
+			if (Index < MeshCount)
+			{
+				CookStaticMesh(StaticMeshTasks[Index], InMeshConfig);
+			}
+			else
+			{
+				CookTexture(TextureTasks[InTextureBegin + Index - MeshCount]);
+			}
+		};
+
+		if (InJobSystem)
+		{
+			InJobSystem->ParallelFor(static_cast<int32>(TaskCount), CookTask);
+		}
+		else
+		{
+			for (size_t Index = 0; Index < TaskCount; ++Index)
+			{
+				CookTask(static_cast<int32>(Index));
+			}
+		}
+	};
+
+	/** #1. 모든 메시와 스캔된 텍스처 */
+	CookRange(0);
+
+	/** #2. 메시가 끝나야 알 수 있는 MTL → 텍스처 의존성 중 아직 없는 것 */
+	const size_t DependencyBegin = TextureTasks.size();
+	AddMissingTextureDependencies();
+	if (DependencyBegin < TextureTasks.size())
+	{
+		CookRange(DependencyBegin);
+	}
+
+	CookMilliseconds = CookCounter.Finish();
+}
+
+double FAssetLoader::GetCookWorkMilliseconds() const
+{
+	double Milliseconds = 0.0;
+	for (const FStaticMeshLoadTask& Task : StaticMeshTasks)
+	{
+		Milliseconds += Task.CookMilliseconds;
+	}
+	for (const FTextureLoadTask& Task : TextureTasks)
+	{
+		Milliseconds += Task.CookMilliseconds;
+	}
+	return Milliseconds;
+}
+
+void FAssetLoader::PrintReport() const
+{
+	auto ToMegabytes = [](uintmax_t InBytes)
+	{
+		return static_cast<double>(InBytes) / (1024.0 * 1024.0);
+	};
+
+	for (const FTextureLoadTask& Task : TextureTasks)
+	{
+		UE_LOG_INFO("AssetLoader: Texture %s | %.2f MB%s | Cook %.3fms | Upload %.3fms%s",
+			Task.FilePath.generic_string().c_str(), ToMegabytes(Task.FileSize), Task.bIsDependency ? " (MTL)" : "",
+			Task.CookMilliseconds, Task.UploadMilliseconds, Task.bIsCooked ? "" : " | 디코딩 실패");
+	}
+
+	for (const FStaticMeshLoadTask& Task : StaticMeshTasks)
+	{
+		UE_LOG_INFO("AssetLoader: Mesh %s | %.2f MB | %zu textures | Cook %.3fms | Upload %.3fms%s",
+			Task.FilePath.generic_string().c_str(), ToMegabytes(Task.FileSize), Task.TextureDependencies.size(),
+			Task.CookMilliseconds, Task.UploadMilliseconds, Task.bIsCooked ? "" : " | 빌드 실패");
+	}
+
+	const double CookWorkMilliseconds = GetCookWorkMilliseconds();
+	UE_LOG_SUCCESS("AssetLoader: %zu meshes, %zu textures | Cook %.3fms (work %.3fms, x%.1f, %u workers) | Upload %.3fms | Total %.3fms",
+		StaticMeshTasks.size(), TextureTasks.size(), CookMilliseconds, CookWorkMilliseconds,
+		CookMilliseconds > 0.0 ? CookWorkMilliseconds / CookMilliseconds : 0.0, WorkerCount,
+		UploadMilliseconds, CookMilliseconds + UploadMilliseconds);
+}
+
+/**
+ * @brief 디렉토리 스캔 경로와 MTL 기준 경로가 같은 파일을 가리키는지 비교할 수 있도록 정규화
+ */
+FString FAssetLoader::MakeTextureKey(const path& InFilePath)
+{
+	std::error_code ErrorCode;
+	path CanonicalPath = std::filesystem::weakly_canonical(std::filesystem::absolute(InFilePath, ErrorCode), ErrorCode);
+	return ErrorCode ? InFilePath.generic_string() : CanonicalPath.generic_string();
+}
+
+void FAssetLoader::AddTextureTask(const path& InFilePath, bool bInIsDependency)
+{
+	FString Key = MakeTextureKey(InFilePath);
+	if (TextureTaskIndices.count(Key))
+	{
+		return;
+	}
+
+	std::error_code ErrorCode;
+	FTextureLoadTask& Task = TextureTasks.emplace_back();
+	Task.FilePath = InFilePath;
+	Task.Name = FName(InFilePath.string());
+	Task.FileSize = std::filesystem::file_size(InFilePath, ErrorCode);
+	Task.bIsDependency = bInIsDependency;
+
+	TextureTaskIndices.emplace(std::move(Key), TextureTasks.size() - 1);
+}
+
+void FAssetLoader::AddMissingTextureDependencies()
+{
+	for (const FStaticMeshLoadTask& MeshTask : StaticMeshTasks)
+	{
+		for (const FString& TexturePath : MeshTask.TextureDependencies)
+		{
+			if (std::filesystem::exists(TexturePath))
+			{
+				AddTextureTask(TexturePath, true);
+			}
+		}
+	}
+}
+
+void FAssetLoader::CookStaticMesh(FStaticMeshLoadTask& InOutTask, const FObjImporter::Configuration& InMeshConfig)
+{
+	FScopeCycleCounter Counter;
+
+	InOutTask.StaticMesh = FObjManager::ImportStaticMesh(InOutTask.Name, InMeshConfig);
+	if (InOutTask.StaticMesh)
+	{
+		if (!InOutTask.StaticMesh->Vertices.empty())
+		{
+			InOutTask.Bounds = UAssetManager::CalculateAABB(InOutTask.StaticMesh->Vertices);
+		}
+		InOutTask.TextureDependencies = FObjManager::GetTextureDependencies(*InOutTask.StaticMesh, InOutTask.Name);
+		InOutTask.bIsCooked = true;
+	}
+
+	InOutTask.CookMilliseconds = Counter.Finish();
+}
+
+void FAssetLoader::CookTexture(FTextureLoadTask& InOutTask)
+{
+	FScopeCycleCounter Counter;
+	InOutTask.bIsCooked = FTextureManager::DecodeTextureFile(InOutTask.FilePath, InOutTask.DecodedTexture);
+	InOutTask.CookMilliseconds = Counter.Finish();
+}
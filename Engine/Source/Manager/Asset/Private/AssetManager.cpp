@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#include "Core/Public/JobSystem.h"
+#include "Manager/Asset/Public/AssetLoader.h"
 #include "Render/Renderer/Public/Renderer.h"
 #include "Component/Mesh/Public/VertexDatas.h"
 #include "Physics/Public/AABB.h"
@@ -18,9 +20,8 @@ UAssetManager::~UAssetManager() = default;
 
 void UAssetManager::Initialize()
 {
-	TextureManager->LoadAllTexturesFromDirectory(UPathManager::GetInstance().GetDataPath());
-	// Data 폴더 속 모든 .obj 파일 로드 및 캐싱
-	LoadAllObjStaticMesh();
+	// Data 폴더 속 모든 텍스처와 .obj 파일을 병렬로 로드 및 캐싱
+	LoadAllAssets();
 
 	VertexDatas.emplace(EPrimitiveType::Torus, &VerticesTorus);
 	VertexDatas.emplace(EPrimitiveType::Arrow, &VerticesArrow);
@@ -66,21 +67,6 @@ void UAssetManager::Initialize()
 
 		AABBs[Type] = CalculateAABB(*Vertices);
 	}
-
-	// Calculate AABB for each StaticMesh
-	for (const auto& MeshPair : StaticMeshCache)
-	{
-		const FName& ObjPath = MeshPair.first;
-		const auto& Mesh = MeshPair.second;
-		if (!Mesh || !Mesh->IsValid())
-			continue;
-
-		const auto& Vertices = Mesh->GetVertices();
-		if (Vertices.empty())
-			continue;
-
-		StaticMeshAABBs[ObjPath] = CalculateAABB(Vertices);
-	}
 }
 
 void UAssetManager::Release()
@@ -140,13 +126,7 @@ void UAssetManager::LoadAllObjStaticMesh()
 		}
 	}
 
-	// Enable winding order flip for this OBJ file
-	FObjImporter::Configuration Config;
-	Config.bFlipWindingOrder = false;
-	Config.bIsBinaryEnabled = true;
-	Config.bPositionToUEBasis = true;
-	Config.bNormalToUEBasis = true;
-	Config.bUVToUEBasis = true;
+	const FObjImporter::Configuration Config = GetStaticMeshImportConfig();
 
 	// 범위 기반 for문을 사용하여 배열의 모든 요소를 순회합니다.
 	for (const FName& ObjPath : ObjList)
@@ -159,12 +139,98 @@ void UAssetManager::LoadAllObjStaticMesh()
 		{
 			StaticMeshCache.emplace(ObjPath, LoadedMesh);
 
-			StaticMeshVertexBuffers.emplace(ObjPath, this->CreateVertexBuffer(LoadedMesh->GetVertices()));
-			StaticMeshIndexBuffers.emplace(ObjPath, this->CreateIndexBuffer(LoadedMesh->GetIndices()));
+			StaticMeshVertexBuffers.emplace(ObjPath, this->CreateStaticMeshVertexBuffer(LoadedMesh));
+			StaticMeshIndexBuffers.emplace(ObjPath, this->CreateStaticMeshIndexBuffer(LoadedMesh));
+
+			if (!LoadedMesh->GetVertices().empty())
+			{
+				StaticMeshAABBs[ObjPath] = CalculateAABB(LoadedMesh->GetVertices());
+			}
 		}
 	}
 }
 
+FObjImporter::Configuration UAssetManager::GetStaticMeshImportConfig()
+{
+	// Enable winding order flip for this OBJ file
+	FObjImporter::Configuration Config;
+	Config.bFlipWindingOrder = false;
+	Config.bIsBinaryEnabled = true;
+	Config.bPositionToUEBasis = true;
+	Config.bNormalToUEBasis = true;
+	Config.bUVToUEBasis = true;
+	// 켜면 정점 버퍼가 FPackedNormalVertex(20바이트)로 바뀐다, 설정이 캐시 해시에 들어가므로 다음 로드에 다시 쿠킹된다
+	Config.bIsVertexCompressionEnabled = false;
+	return Config;
+}
+
+/**
+ * @brief Data/ 경로 하위의 모든 텍스처와 .obj를 FAssetLoader로 로드한다
+ * 메시 빌드와 텍스처 디코딩은 잡 시스템에서 병렬로, 디바이스 리소스 생성만 메인 스레드에서 직렬로 처리한다
+ */
+void UAssetManager::LoadAllAssets()
+{
+	FAssetLoader Loader;
+	Loader.Gather("Data/", UPathManager::GetInstance().GetDataPath());
+	Loader.Cook(GetStaticMeshImportConfig(), &FJobSystem::GetInstance());
+
+	UploadLoadedAssets(Loader);
+	Loader.PrintReport();
+}
+
+/**
+ * @brief Cook이 끝난 작업으로 GPU 리소스와 UObject를 생성
+ * 머티리얼이 텍스처 캐시를 조회하므로 텍스처를 모두 올린 뒤에 메시를 등록한다
+ */
+void UAssetManager::UploadLoadedAssets(FAssetLoader& InLoader)
+{
+	FScopeCycleCounter UploadCounter;
+
+	for (FTextureLoadTask& Task : InLoader.GetTextureTasks())
+	{
+		FScopeCycleCounter Counter;
+
+		// 디코딩에 실패한 파일은 기존 경로로 다시 시도해 같은 에러 로그를 남긴다
+		if (Task.bIsCooked)
+		{
+			TextureManager->LoadTexture(Task.Name, Task.DecodedTexture);
+		}
+		else
+		{
+			TextureManager->LoadTexture(Task.Name);
+		}
+
+		Task.DecodedTexture.Data.clear();
+		Task.DecodedTexture.Data.shrink_to_fit();
+		Task.UploadMilliseconds = Counter.Finish();
+	}
+
+	for (FStaticMeshLoadTask& Task : InLoader.GetStaticMeshTasks())
+	{
+		if (!Task.bIsCooked || StaticMeshCache.count(Task.Name))
+		{
+			continue;
+		}
+
+		FScopeCycleCounter Counter;
+
+		UStaticMesh* LoadedMesh = FObjManager::RegisterStaticMesh(Task.Name, std::move(Task.StaticMesh));
+		if (LoadedMesh)
+		{
+			StaticMeshVertexBuffers.emplace(Task.Name, this->CreateStaticMeshVertexBuffer(LoadedMesh));
+			StaticMeshIndexBuffers.emplace(Task.Name, this->CreateStaticMeshIndexBuffer(LoadedMesh));
+			if (!LoadedMesh->GetVertices().empty())
+			{
+				StaticMeshAABBs[Task.Name] = Task.Bounds;
+			}
+		}
+
+		Task.UploadMilliseconds = Counter.Finish();
+	}
+
+	InLoader.SetUploadMilliseconds(UploadCounter.Finish());
+}
+
 ID3D11Buffer* UAssetManager::GetVertexBuffer(FName InObjPath)
 {
 	if (StaticMeshVertexBuffers.count(InObjPath))
@@ -188,11 +254,37 @@ ID3D11Buffer* UAssetManager::CreateVertexBuffer(TArray<FNormalVertex> InVertices
 	return FRenderResourceFactory::CreateVertexBuffer(InVertices.data(), static_cast<int>(InVertices.size()) * sizeof(FNormalVertex));
 }
 
+ID3D11Buffer* UAssetManager::CreateStaticMeshVertexBuffer(UStaticMesh* InStaticMesh)
+{
+	const FStaticMesh* StaticMeshAsset = InStaticMesh->GetStaticMeshAsset();
+	if (StaticMeshAsset && StaticMeshAsset->HasPackedVertices())
+	{
+		const TArray<FPackedNormalVertex>& PackedVertices = StaticMeshAsset->PackedVertices;
+		return FRenderResourceFactory::CreateVertexBuffer(PackedVertices.data(), static_cast<uint32>(PackedVertices.size() * sizeof(FPackedNormalVertex)));
+	}
+	return CreateVertexBuffer(InStaticMesh->GetVertices());
+}
+
 ID3D11Buffer* UAssetManager::CreateIndexBuffer(TArray<uint32> InIndices)
 {
 	return FRenderResourceFactory::CreateIndexBuffer(InIndices.data(), static_cast<int>(InIndices.size()) * sizeof(uint32));
 }
 
+ID3D11Buffer* UAssetManager::CreateStaticMeshIndexBuffer(UStaticMesh* InStaticMesh)
+{
+	const FStaticMesh* StaticMeshAsset = InStaticMesh->GetStaticMeshAsset();
+	if (!StaticMeshAsset || StaticMeshAsset->LODIndices.empty())
+	{
+		return CreateIndexBuffer(InStaticMesh->GetIndices());
+	}
+
+	TArray<uint32> BufferIndices;
+	BufferIndices.reserve(StaticMeshAsset->Indices.size() + StaticMeshAsset->LODIndices.size());
+	BufferIndices.insert(BufferIndices.end(), StaticMeshAsset->Indices.begin(), StaticMeshAsset->Indices.end());
+	BufferIndices.insert(BufferIndices.end(), StaticMeshAsset->LODIndices.begin(), StaticMeshAsset->LODIndices.end());
+	return FRenderResourceFactory::CreateIndexBuffer(BufferIndices.data(), static_cast<int>(BufferIndices.size()) * sizeof(uint32));
+}
+
 TArray<FNormalVertex>* UAssetManager::GetVertexData(EPrimitiveType InType)
 {
 	return VertexDatas[InType];
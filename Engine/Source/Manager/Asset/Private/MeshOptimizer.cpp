@@ -0,0 +1,412 @@
+#include "pch.h"
+#include "Manager/Asset/Public/MeshOptimizer.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+
+namespace
+{
+	/** @brief FIFO 캐시에 정점을 넣는다, 이미 있으면 순서를 바꾸지 않는다 @return 캐시 미스면 1 */
+	uint32 TouchCache(uint32 InVertex, uint32 InCacheSize, TArray<uint32>& InOutTimestamps, uint32& InOutTimestamp)
+	{
+		if (InOutTimestamp - InOutTimestamps[InVertex] > InCacheSize)
+		{
+			InOutTimestamps[InVertex] = InOutTimestamp++;
+			return 1;
+		}
+		return 0;
+	}
+
+	uint32 TouchTriangle(const uint32* InTriangle, uint32 InCacheSize, TArray<uint32>& InOutTimestamps, uint32& InOutTimestamp)
+	{
+		return TouchCache(InTriangle[0], InCacheSize, InOutTimestamps, InOutTimestamp) +
+			TouchCache(InTriangle[1], InCacheSize, InOutTimestamps, InOutTimestamp) +
+			TouchCache(InTriangle[2], InCacheSize, InOutTimestamps, InOutTimestamp);
+	}
+}
+
+void FMeshOptimizer::Optimize(FStaticMesh& InOutStaticMesh)
+{
+	if (InOutStaticMesh.Indices.size() < 3 || InOutStaticMesh.Vertices.empty())
+	{
+		return;
+	}
+
+	OptimizeSections(InOutStaticMesh.Indices, InOutStaticMesh.Sections, InOutStaticMesh.Vertices);
+	OptimizeVertexFetch(InOutStaticMesh.Vertices, InOutStaticMesh.Indices);
+}
+
+void FMeshOptimizer::OptimizeMeshlets(FStaticMesh& InOutStaticMesh)
+{
+	if (InOutStaticMesh.Meshlets.empty() || !InOutStaticMesh.LODIndices.empty())
+	{
+		return;
+	}
+
+	// 메시렛 구간을 섹션처럼 넘기면 삼각형이 메시렛 밖으로 나가지 않는다
+	TArray<FMeshSection> MeshletRanges;
+	MeshletRanges.reserve(InOutStaticMesh.Meshlets.size());
+	for (const FMeshlet& Meshlet : InOutStaticMesh.Meshlets)
+	{
+		MeshletRanges.push_back({ Meshlet.FirstIndex, Meshlet.IndexCount, 0 });
+	}
+
+	OptimizeSections(InOutStaticMesh.Indices, MeshletRanges, InOutStaticMesh.Vertices);
+	OptimizeVertexFetch(InOutStaticMesh.Vertices, InOutStaticMesh.Indices);
+}
+
+void FMeshOptimizer::OptimizeSections(TArray<uint32>& InOutIndices, const TArray<FMeshSection>& InSections, const TArray<FNormalVertex>& InVertices,
+	uint32 InIndexBase)
+{
+	const uint32 VertexCount = static_cast<uint32>(InVertices.size());
+
+	// 섹션이 쓰는 정점만 0부터 다시 번호를 매겨 섹션 크기에 비례하는 작업만 하도록 한다
+	TArray<uint32> GlobalToLocal(VertexCount, UINT32_MAX);
+	TArray<uint32> LocalToGlobal;
+	TArray<uint32> LocalIndices;
+	TArray<FNormalVertex> LocalVertices;
+
+	for (const FMeshSection& Section : InSections)
+	{
+		const size_t IndexCount = static_cast<size_t>(Section.IndexCount) / 3 * 3;
+		if (IndexCount < 3 || Section.StartIndex < InIndexBase || static_cast<size_t>(Section.StartIndex - InIndexBase) + IndexCount > InOutIndices.size())
+		{
+			continue;
+		}
+		uint32* SectionIndices = InOutIndices.data() + (Section.StartIndex - InIndexBase);
+
+		LocalToGlobal.clear();
+		LocalIndices.resize(IndexCount);
+		for (size_t Index = 0; Index < IndexCount; ++Index)
+		{
+			uint32& Local = GlobalToLocal[SectionIndices[Index]];
+			if (Local == UINT32_MAX)
+			{
+				Local = static_cast<uint32>(LocalToGlobal.size());
+				LocalToGlobal.push_back(SectionIndices[Index]);
+			}
+			LocalIndices[Index] = Local;
+		}
+
+		LocalVertices.resize(LocalToGlobal.size());
+		for (size_t Local = 0; Local < LocalToGlobal.size(); ++Local)
+		{
+			LocalVertices[Local] = InVertices[LocalToGlobal[Local]];
+		}
+
+		const uint32 LocalVertexCount = static_cast<uint32>(LocalToGlobal.size());
+		OptimizeVertexCache(LocalIndices.data(), IndexCount, LocalVertexCount);
+		OptimizeOverdraw(LocalIndices.data(), IndexCount, LocalVertices.data(), LocalVertexCount);
+
+		for (size_t Index = 0; Index < IndexCount; ++Index)
+		{
+			SectionIndices[Index] = LocalToGlobal[LocalIndices[Index]];
+		}
+		for (const uint32 Global : LocalToGlobal)
+		{
+			GlobalToLocal[Global] = UINT32_MAX;
+		}
+	}
+}
+
+void FMeshOptimizer::OptimizeVertexCache(uint32* InOutIndices, size_t InIndexCount, uint32 InVertexCount, uint32 InCacheSize)
+{
+	const size_t TriangleCount = InIndexCount / 3;
+	if (TriangleCount == 0 || InVertexCount == 0)
+	{
+		return;
+	}
+
+	// 정점 -> 인접 삼각형 목록 (CSR)
+	TArray<uint32> AdjacencyOffsets(static_cast<size_t>(InVertexCount) + 1, 0);
+	for (size_t Index = 0; Index < TriangleCount * 3; ++Index)
+	{
+		++AdjacencyOffsets[InOutIndices[Index] + 1];
+	}
+	for (uint32 Vertex = 0; Vertex < InVertexCount; ++Vertex)
+	{
+		AdjacencyOffsets[Vertex + 1] += AdjacencyOffsets[Vertex];
+	}
+
+	TArray<uint32> AdjacentTriangles(TriangleCount * 3);
+	TArray<uint32> FillCursors(AdjacencyOffsets.begin(), AdjacencyOffsets.end() - 1);
+	for (size_t Triangle = 0; Triangle < TriangleCount; ++Triangle)
+	{
+		for (size_t Corner = 0; Corner < 3; ++Corner)
+		{
+			AdjacentTriangles[FillCursors[InOutIndices[Triangle * 3 + Corner]]++] = static_cast<uint32>(Triangle);
+		}
+	}
+
+	// 정점마다 아직 내보내지 않은 삼각형 수
+	TArray<uint32> LiveTriangles(InVertexCount);
+	for (uint32 Vertex = 0; Vertex < InVertexCount; ++Vertex)
+	{
+		LiveTriangles[Vertex] = AdjacencyOffsets[Vertex + 1] - AdjacencyOffsets[Vertex];
+	}
+
+	TArray<uint32> CacheTimestamps(InVertexCount, 0);
+	TArray<uint8> Emitted(TriangleCount, 0);
+	TArray<uint32> DeadEndStack;
+	TArray<uint32> Candidates;
+	TArray<uint32> Output;
+	DeadEndStack.reserve(TriangleCount * 3);
+	Output.reserve(TriangleCount * 3);
+
+	uint32 Timestamp = InCacheSize + 1;
+	uint32 ScanCursor = 0;
+	int64 Fanning = 0;
+	while (Fanning >= 0)
+	{
+		// 팬 중심 정점의 남은 삼각형을 모두 내보낸다
+		Candidates.clear();
+		const uint32 FanningVertex = static_cast<uint32>(Fanning);
+		for (uint32 Adjacency = AdjacencyOffsets[FanningVertex]; Adjacency < AdjacencyOffsets[FanningVertex + 1]; ++Adjacency)
+		{
+			const uint32 Triangle = AdjacentTriangles[Adjacency];
+			if (Emitted[Triangle])
+			{
+				continue;
+			}
+			Emitted[Triangle] = 1;
+
+			for (size_t Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Vertex = InOutIndices[Triangle * 3 + Corner];
+				Output.push_back(Vertex);
+				DeadEndStack.push_back(Vertex);
+				Candidates.push_back(Vertex);
+				--LiveTriangles[Vertex];
+				TouchCache(Vertex, InCacheSize, CacheTimestamps, Timestamp);
+			}
+		}
+
+		// 다음 팬이 끝날 때까지 캐시에 남아 있을 후보 중 가장 오래된 정점, 없으면 0순위 후보라도 남은 삼각형이 있는 정점
+		Fanning = -1;
+		int64 BestPriority = -1;
+		for (const uint32 Vertex : Candidates)
+		{
+			if (LiveTriangles[Vertex] == 0)
+			{
+				continue;
+			}
+
+			const int64 Age = static_cast<int64>(Timestamp) - CacheTimestamps[Vertex];
+			const int64 Priority = Age + 2 * static_cast<int64>(LiveTriangles[Vertex]) <= InCacheSize ? Age : 0;
+			if (Priority > BestPriority)
+			{
+				BestPriority = Priority;
+				Fanning = Vertex;
+			}
+		}
+
+		// 막다른 곳: 최근에 쓴 정점부터 거꾸로 찾고, 그래도 없으면 아직 남은 정점을 순서대로 찾는다
+		while (Fanning < 0 && !DeadEndStack.empty())
+		{
+			const uint32 Vertex = DeadEndStack.back();
+			DeadEndStack.pop_back();
+			if (LiveTriangles[Vertex] > 0)
+			{
+				Fanning = Vertex;
+			}
+		}
+		while (Fanning < 0 && ScanCursor < InVertexCount)
+		{
+			if (LiveTriangles[ScanCursor] > 0)
+			{
+				Fanning = ScanCursor;
+			}
+			++ScanCursor;
+		}
+	}
+
+	std::copy(Output.begin(), Output.end(), InOutIndices);
+}
+
+void FMeshOptimizer::OptimizeOverdraw(uint32* InOutIndices, size_t InIndexCount, const FNormalVertex* InVertices, uint32 InVertexCount,
+	uint32 InCacheSize, float InThreshold)
+{
+	const size_t TriangleCount = InIndexCount / 3;
+	if (TriangleCount < 2 || InVertexCount == 0)
+	{
+		return;
+	}
+
+	TArray<uint32> CacheTimestamps(InVertexCount, 0);
+	uint32 Timestamp = InCacheSize + 1;
+
+	// 1. 세 정점이 모두 미스인 삼각형은 이전과 떨어진 새 패치로 보고 클러스터를 끊는다
+	TArray<uint32> HardBoundaries;
+	for (size_t Triangle = 0; Triangle < TriangleCount; ++Triangle)
+	{
+		const uint32 Misses = TouchTriangle(InOutIndices + Triangle * 3, InCacheSize, CacheTimestamps, Timestamp);
+		if (Triangle == 0 || Misses == 3)
+		{
+			HardBoundaries.push_back(static_cast<uint32>(Triangle));
+		}
+	}
+
+	// 2. 클러스터 ACMR의 InThreshold배 이내에 처음 들어오는 지점마다 더 잘게 끊는다 (캐시는 클러스터마다 비운다고 본다)
+	TArray<uint32> Clusters;
+	for (size_t Hard = 0; Hard < HardBoundaries.size(); ++Hard)
+	{
+		const uint32 Start = HardBoundaries[Hard];
+		const uint32 End = Hard + 1 < HardBoundaries.size() ? HardBoundaries[Hard + 1] : static_cast<uint32>(TriangleCount);
+
+		Timestamp += InCacheSize + 1;
+		uint32 ClusterMisses = 0;
+		for (uint32 Triangle = Start; Triangle < End; ++Triangle)
+		{
+			ClusterMisses += TouchTriangle(InOutIndices + Triangle * 3, InCacheSize, CacheTimestamps, Timestamp);
+		}
+		const float ClusterThreshold = InThreshold * static_cast<float>(ClusterMisses) / static_cast<float>(End - Start);
+
+		Clusters.push_back(Start);
+		Timestamp += InCacheSize + 1;
+		uint32 RunningMisses = 0;
+		uint32 RunningTriangles = 0;
+		for (uint32 Triangle = Start; Triangle < End; ++Triangle)
+		{
+			RunningMisses += TouchTriangle(InOutIndices + Triangle * 3, InCacheSize, CacheTimestamps, Timestamp);
+			++RunningTriangles;
+			if (static_cast<float>(RunningMisses) <= ClusterThreshold * static_cast<float>(RunningTriangles))
+			{
+				Clusters.push_back(Triangle + 1);
+				Timestamp += InCacheSize + 1;
+				RunningMisses = 0;
+				RunningTriangles = 0;
+			}
+		}
+
+		// 마지막 조각은 보통 ACMR이 나쁘므로 직전 클러스터에 합친다 (End에 딱 맞게 끊긴 경우도 빈 클러스터를 지운다)
+		if (Clusters.back() != Start)
+		{
+			Clusters.pop_back();
+		}
+	}
+
+	if (Clusters.size() < 2)
+	{
+		return;
+	}
+
+	// 3. 메시 중심에서 클러스터 중심으로 향하는 방향과 클러스터 평균 노멀의 내적이 클수록 바깥을 향하므로 먼저 그린다
+	FVector MeshCentroid(0.0f, 0.0f, 0.0f);
+	for (size_t Index = 0; Index < TriangleCount * 3; ++Index)
+	{
+		MeshCentroid += InVertices[InOutIndices[Index]].Position;
+	}
+	MeshCentroid = MeshCentroid / static_cast<float>(TriangleCount * 3);
+
+	TArray<float> SortKeys(Clusters.size());
+	for (size_t Cluster = 0; Cluster < Clusters.size(); ++Cluster)
+	{
+		const uint32 Start = Clusters[Cluster];
+		const uint32 End = Cluster + 1 < Clusters.size() ? Clusters[Cluster + 1] : static_cast<uint32>(TriangleCount);
+
+		FVector WeightedCentroid(0.0f, 0.0f, 0.0f);
+		FVector CornerSum(0.0f, 0.0f, 0.0f);
+		FVector NormalSum(0.0f, 0.0f, 0.0f);
+		float AreaSum = 0.0f;
+		for (uint32 Triangle = Start; Triangle < End; ++Triangle)
+		{
+			const FNormalVertex& V0 = InVertices[InOutIndices[Triangle * 3 + 0]];
+			const FNormalVertex& V1 = InVertices[InOutIndices[Triangle * 3 + 1]];
+			const FNormalVertex& V2 = InVertices[InOutIndices[Triangle * 3 + 2]];
+
+			// 감기 방향 규약에 의존하지 않도록 면 노멀을 정점 노멀 쪽으로 맞춘다
+			FVector FaceNormal = (V1.Position - V0.Position).Cross(V2.Position - V0.Position);
+			if (FaceNormal.Dot(V0.Normal + V1.Normal + V2.Normal) < 0.0f)
+			{
+				FaceNormal = -FaceNormal;
+			}
+
+			const float Area = FaceNormal.Length();
+			const FVector Corners = V0.Position + V1.Position + V2.Position;
+			WeightedCentroid += Corners * (Area / 3.0f);
+			CornerSum += Corners;
+			NormalSum += FaceNormal;
+			AreaSum += Area;
+		}
+
+		const FVector ClusterCentroid = AreaSum > 0.0f ? WeightedCentroid / AreaSum : CornerSum / static_cast<float>((End - Start) * 3);
+		const float NormalLength = NormalSum.Length();
+		const FVector ClusterNormal = NormalLength > 0.0f ? NormalSum / NormalLength : NormalSum;
+		SortKeys[Cluster] = (ClusterCentroid - MeshCentroid).Dot(ClusterNormal);
+	}
+
+	TArray<uint32> ClusterOrder(Clusters.size());
+	for (uint32 Cluster = 0; Cluster < ClusterOrder.size(); ++Cluster)
+	{
+		ClusterOrder[Cluster] = Cluster;
+	}
+	std::stable_sort(ClusterOrder.begin(), ClusterOrder.end(), [&SortKeys](uint32 InA, uint32 InB)
+	{
+		return SortKeys[InA] > SortKeys[InB];
+	});
+
+	TArray<uint32> Output;
+	Output.reserve(TriangleCount * 3);
+	for (const uint32 Cluster : ClusterOrder)
+	{
+		const uint32 Start = Clusters[Cluster];
+		const uint32 End = Cluster + 1 < Clusters.size() ? Clusters[Cluster + 1] : static_cast<uint32>(TriangleCount);
+		Output.insert(Output.end(), InOutIndices + Start * 3, InOutIndices + End * 3);
+	}
+	std::copy(Output.begin(), Output.end(), InOutIndices);
+}
+
+void FMeshOptimizer::OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices)
+{
+	const uint32 VertexCount = static_cast<uint32>(InOutVertices.size());
+	TArray<uint32> Remap(VertexCount, UINT32_MAX);
+	uint32 NextVertex = 0;
+	for (uint32& Index : InOutIndices)
+	{
+		if (Remap[Index] == UINT32_MAX)
+		{
+			Remap[Index] = NextVertex++;
+		}
+		Index = Remap[Index];
+	}
+
+	for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+	{
+		if (Remap[Vertex] == UINT32_MAX)
+		{
+			Remap[Vertex] = NextVertex++;
+		}
+	}
+
+	TArray<FNormalVertex> Reordered(VertexCount);
+	for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+	{
+		Reordered[Remap[Vertex]] = InOutVertices[Vertex];
+	}
+	InOutVertices = std::move(Reordered);
+}
+
+FVertexCacheStatistics FMeshOptimizer::AnalyzeVertexCache(const uint32* InIndices, size_t InIndexCount, uint32 InVertexCount, uint32 InCacheSize)
+{
+	FVertexCacheStatistics Statistics;
+	const size_t TriangleCount = InIndexCount / 3;
+	if (TriangleCount == 0 || InVertexCount == 0)
+	{
+		return Statistics;
+	}
+
+	TArray<uint32> CacheTimestamps(InVertexCount, 0);
+	TArray<uint8> Referenced(InVertexCount, 0);
+	uint32 Timestamp = InCacheSize + 1;
+	uint32 ReferencedCount = 0;
+	for (size_t Index = 0; Index < TriangleCount * 3; ++Index)
+	{
+		const uint32 Vertex = InIndices[Index];
+		Statistics.TransformCount += TouchCache(Vertex, InCacheSize, CacheTimestamps, Timestamp);
+		ReferencedCount += Referenced[Vertex] ? 0 : 1;
+		Referenced[Vertex] = 1;
+	}
+
+	Statistics.ACMR = static_cast<float>(Statistics.TransformCount) / static_cast<float>(TriangleCount);
+	Statistics.ATVR = static_cast<float>(Statistics.TransformCount) / static_cast<float>(ReferencedCount);
+	return Statistics;
+}
@@ -0,0 +1,777 @@
+#include "pch.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+
+namespace
+{
+	enum class EVertexKind : uint8
+	{
+		/** @brief 속성까지 닫힌 내부 정점, 이웃 어느 정점으로든 접을 수 있다 */
+		Manifold,
+		/** @brief 열린 경계 위의 정점, 경계 간선을 따라서만 접는다 */
+		Border,
+		/** @brief 위치가 같고 속성이 다른 정점 두 개의 이음매, 이음매 간선을 따라 두 쪽을 함께 접는다 */
+		Seam,
+		/** @brief 섹션 경계, 이음매 끝, 복잡한 위상, 움직이지 않는다 */
+		Locked,
+	};
+
+	/** @brief 열린 경계와 이음매를 지키기 위해 간선에 세우는 수직 평면의 가중치 (간선 길이 제곱 배) */
+	constexpr double BORDER_WEIGHT = 10.0;
+	/** @brief 노멀이 직각으로 다른 정점을 합칠 때 더하는 비용, 정규화 좌표에서 1% 이동의 오차 제곱과 같다 */
+	constexpr double NORMAL_WEIGHT = 1e-4;
+	/** @brief collapse 전후 면 노멀 사이 각의 코사인이 이보다 작으면 버린다 (60도) */
+	constexpr float MIN_FACE_NORMAL_COS = 0.5f;
+
+	/** @brief 평면까지 거리 제곱에 가중치를 곱해 더한 대칭 4x4 행렬 */
+	struct FQuadric
+	{
+		double A00 = 0.0, A11 = 0.0, A22 = 0.0, A01 = 0.0, A02 = 0.0, A12 = 0.0;
+		double B0 = 0.0, B1 = 0.0, B2 = 0.0;
+		double C = 0.0;
+		double Weight = 0.0;
+
+		/** @param InNormal 단위 노멀, 평면은 InNormal · P + InDistance = 0 */
+		void AddPlane(const FVector& InNormal, float InDistance, double InWeight)
+		{
+			const double X = InNormal.X, Y = InNormal.Y, Z = InNormal.Z, D = InDistance;
+			A00 += InWeight * X * X; A11 += InWeight * Y * Y; A22 += InWeight * Z * Z;
+			A01 += InWeight * X * Y; A02 += InWeight * X * Z; A12 += InWeight * Y * Z;
+			B0 += InWeight * X * D; B1 += InWeight * Y * D; B2 += InWeight * Z * D;
+			C += InWeight * D * D;
+			Weight += InWeight;
+		}
+
+		void Add(const FQuadric& InOther)
+		{
+			A00 += InOther.A00; A11 += InOther.A11; A22 += InOther.A22;
+			A01 += InOther.A01; A02 += InOther.A02; A12 += InOther.A12;
+			B0 += InOther.B0; B1 += InOther.B1; B2 += InOther.B2;
+			C += InOther.C;
+			Weight += InOther.Weight;
+		}
+
+		/** @return 가중 평균한 평면 거리 제곱 */
+		double Evaluate(const FVector& InPoint) const
+		{
+			const double X = InPoint.X, Y = InPoint.Y, Z = InPoint.Z;
+			const double Error = A00 * X * X + A11 * Y * Y + A22 * Z * Z
+				+ 2.0 * (A01 * X * Y + A02 * X * Z + A12 * Y * Z)
+				+ 2.0 * (B0 * X + B1 * Y + B2 * Z) + C;
+			return Weight > 0.0 ? std::max(Error, 0.0) / Weight : 0.0;
+		}
+	};
+
+	struct FCollapse
+	{
+		uint32 Vertex;
+		uint32 Target;
+		/** @brief 정렬에 쓰는 비용 (위치 오차 + 노멀 벌점) */
+		double Cost;
+		/** @brief 위치 오차만, 허용치와 결과 오차에 쓴다 */
+		double Error;
+	};
+
+	/** @brief 표준 외적 (FVector::Cross는 부호가 반대) */
+	FVector CrossProduct(const FVector& InA, const FVector& InB)
+	{
+		return FVector(InA.Y * InB.Z - InA.Z * InB.Y, InA.Z * InB.X - InA.X * InB.Z, InA.X * InB.Y - InA.Y * InB.X);
+	}
+
+	bool IsPositionLess(const FVector& InA, const FVector& InB)
+	{
+		if (InA.X != InB.X) { return InA.X < InB.X; }
+		if (InA.Y != InB.Y) { return InA.Y < InB.Y; }
+		return InA.Z < InB.Z;
+	}
+
+	bool IsSamePosition(const FVector& InA, const FVector& InB)
+	{
+		return InA.X == InB.X && InA.Y == InB.Y && InA.Z == InB.Z;
+	}
+
+	/**
+	 * @brief 위치가 정확히 같은 정점끼리 묶는다
+	 * @param OutRemap 묶음의 대표 정점 (InUsed가 0인 정점은 자기 자신)
+	 * @param OutWedge 같은 묶음의 다음 정점을 가리키는 원형 목록
+	 */
+	void BuildPositionGroups(const FNormalVertex* InVertices, uint32 InVertexCount, const TArray<uint8>& InUsed,
+		TArray<uint32>& OutRemap, TArray<uint32>& OutWedge)
+	{
+		TArray<uint32> Order;
+		Order.reserve(InVertexCount);
+		OutRemap.resize(InVertexCount);
+		OutWedge.resize(InVertexCount);
+		for (uint32 Vertex = 0; Vertex < InVertexCount; ++Vertex)
+		{
+			OutRemap[Vertex] = Vertex;
+			OutWedge[Vertex] = Vertex;
+			if (InUsed[Vertex])
+			{
+				Order.push_back(Vertex);
+			}
+		}
+
+		std::sort(Order.begin(), Order.end(), [InVertices](uint32 InA, uint32 InB)
+		{
+			return IsPositionLess(InVertices[InA].Position, InVertices[InB].Position);
+		});
+
+		for (size_t Begin = 0; Begin < Order.size();)
+		{
+			size_t End = Begin + 1;
+			while (End < Order.size() && IsSamePosition(InVertices[Order[Begin]].Position, InVertices[Order[End]].Position))
+			{
+				++End;
+			}
+			for (size_t Index = Begin; Index < End; ++Index)
+			{
+				OutRemap[Order[Index]] = Order[Begin];
+				OutWedge[Order[Index]] = Order[Index + 1 < End ? Index + 1 : Begin];
+			}
+			Begin = End;
+		}
+	}
+
+	/** @brief 정점마다 그 정점을 쓰는 삼각형 목록 (CSR) */
+	struct FVertexAdjacency
+	{
+		TArray<uint32> Offsets;
+		TArray<uint32> Triangles;
+
+		void Build(const uint32* InIndices, size_t InIndexCount, uint32 InVertexCount)
+		{
+			Offsets.assign(InVertexCount + 1, 0);
+			for (size_t Index = 0; Index < InIndexCount; ++Index)
+			{
+				++Offsets[InIndices[Index] + 1];
+			}
+			for (uint32 Vertex = 0; Vertex < InVertexCount; ++Vertex)
+			{
+				Offsets[Vertex + 1] += Offsets[Vertex];
+			}
+
+			Triangles.resize(InIndexCount);
+			TArray<uint32> Cursor(Offsets.begin(), Offsets.end() - 1);
+			for (size_t Index = 0; Index < InIndexCount; ++Index)
+			{
+				Triangles[Cursor[InIndices[Index]]++] = static_cast<uint32>(Index / 3);
+			}
+		}
+	};
+
+	/** @brief 한 인덱스 구간의 단순화 상태 */
+	class FSimplifier
+	{
+	public:
+		FSimplifier(uint32* InIndices, size_t InIndexCount, const FNormalVertex* InVertices, uint32 InVertexCount, const uint8* InLockedVertices)
+			: Indices(InIndices), IndexCount(InIndexCount), VertexCount(InVertexCount)
+		{
+			TArray<uint8> Used(VertexCount, 0);
+			for (size_t Index = 0; Index < IndexCount; ++Index)
+			{
+				Used[Indices[Index]] = 1;
+			}
+			BuildPositionGroups(InVertices, VertexCount, Used, Remap, Wedge);
+
+			// 오차를 크기와 무관하게 다루도록 쓰이는 정점의 AABB를 단위 크기로 맞춘다
+			FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+			FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+			for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+			{
+				if (Used[Vertex])
+				{
+					const FVector& Position = InVertices[Vertex].Position;
+					Min = FVector(std::min(Min.X, Position.X), std::min(Min.Y, Position.Y), std::min(Min.Z, Position.Z));
+					Max = FVector(std::max(Max.X, Position.X), std::max(Max.Y, Position.Y), std::max(Max.Z, Position.Z));
+				}
+			}
+			const float Extent = std::max({ Max.X - Min.X, Max.Y - Min.Y, Max.Z - Min.Z, 0.0f });
+			Scale = Extent > 0.0f ? 1.0f / Extent : 1.0f;
+
+			Positions.resize(VertexCount);
+			Normals.resize(VertexCount);
+			for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+			{
+				Positions[Vertex] = (InVertices[Vertex].Position - Min) * Scale;
+				const float Length = InVertices[Vertex].Normal.Length();
+				Normals[Vertex] = Length > 0.0f ? InVertices[Vertex].Normal / Length : FVector(0.0f, 0.0f, 0.0f);
+			}
+
+			Adjacency.Build(Indices, IndexCount, VertexCount);
+			ClassifyVertices(InLockedVertices);
+			ComputeQuadrics();
+		}
+
+		size_t Run(size_t InTargetIndexCount, float InMaxError, float& OutError)
+		{
+			const double MaxErrorSquared = static_cast<double>(InMaxError) * Scale * InMaxError * Scale;
+			double ResultError = 0.0;
+
+			TArray<FCollapse> Collapses;
+			TArray<uint32> CollapseRemap(VertexCount);
+			TArray<uint8> PassLocked(VertexCount);
+
+			while (IndexCount > InTargetIndexCount)
+			{
+				GatherCollapses(Collapses);
+				if (Collapses.empty())
+				{
+					break;
+				}
+				std::sort(Collapses.begin(), Collapses.end(), [](const FCollapse& InA, const FCollapse& InB)
+				{
+					return InA.Cost < InB.Cost;
+				});
+
+				for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+				{
+					CollapseRemap[Vertex] = Vertex;
+				}
+				std::fill(PassLocked.begin(), PassLocked.end(), 0);
+
+				// 한 패스에서 서로의 1-ring을 건드리지 않는 collapse만 하므로 뒤집힘 검사가 정확하다
+				const size_t TrianglesToRemove = std::max<size_t>((IndexCount - InTargetIndexCount) / 3, 1);
+				size_t RemovedTriangles = 0;
+				size_t PerformedCount = 0;
+				for (const FCollapse& Collapse : Collapses)
+				{
+					if (Collapse.Error > MaxErrorSquared || RemovedTriangles >= TrianglesToRemove)
+					{
+						break;
+					}
+
+					const uint32 Vertex = Collapse.Vertex;
+					const uint32 Target = Collapse.Target;
+					if (PassLocked[Remap[Vertex]] || PassLocked[Remap[Target]] || HasTriangleFlip(Vertex, Target))
+					{
+						continue;
+					}
+
+					CollapseRemap[Vertex] = Target;
+					if (Kinds[Vertex] == EVertexKind::Seam)
+					{
+						CollapseRemap[Wedge[Vertex]] = Wedge[Target];
+					}
+					Quadrics[Remap[Target]].Add(Quadrics[Remap[Vertex]]);
+
+					PassLocked[Remap[Target]] = 1;
+					ForEachWedgeTriangle(Vertex, [&](const uint32* InTriangle, uint32)
+					{
+						bool bContainsTarget = false;
+						for (int32 Corner = 0; Corner < 3; ++Corner)
+						{
+							PassLocked[Remap[InTriangle[Corner]]] = 1;
+							bContainsTarget |= Remap[InTriangle[Corner]] == Remap[Target];
+						}
+						RemovedTriangles += bContainsTarget ? 1 : 0;
+					});
+
+					ResultError = std::max(ResultError, Collapse.Error);
+					++PerformedCount;
+				}
+
+				if (PerformedCount == 0)
+				{
+					break;
+				}
+
+				// 위치가 겹친 삼각형을 지우고 남은 삼각형의 순서는 유지한다
+				size_t WriteIndex = 0;
+				for (size_t Index = 0; Index < IndexCount; Index += 3)
+				{
+					const uint32 A = CollapseRemap[Indices[Index]];
+					const uint32 B = CollapseRemap[Indices[Index + 1]];
+					const uint32 C = CollapseRemap[Indices[Index + 2]];
+					if (Remap[A] != Remap[B] && Remap[B] != Remap[C] && Remap[C] != Remap[A])
+					{
+						Indices[WriteIndex++] = A;
+						Indices[WriteIndex++] = B;
+						Indices[WriteIndex++] = C;
+					}
+				}
+				IndexCount = WriteIndex;
+				Adjacency.Build(Indices, IndexCount, VertexCount);
+			}
+
+			OutError = static_cast<float>(std::sqrt(ResultError)) / Scale;
+			return IndexCount;
+		}
+
+	private:
+		/** @brief InVertex와 같은 위치의 모든 정점이 쓰는 삼각형마다 (삼각형, InVertex 위치 정점의 모서리 번호)로 호출 */
+		template<typename FunctionType>
+		void ForEachWedgeTriangle(uint32 InVertex, FunctionType&& InFunction) const
+		{
+			uint32 Current = InVertex;
+			do
+			{
+				for (uint32 Offset = Adjacency.Offsets[Current]; Offset < Adjacency.Offsets[Current + 1]; ++Offset)
+				{
+					const uint32* Triangle = Indices + Adjacency.Triangles[Offset] * 3;
+					const uint32 Corner = Triangle[0] == Current ? 0 : (Triangle[1] == Current ? 1 : 2);
+					InFunction(Triangle, Corner);
+				}
+				Current = Wedge[Current];
+			} while (Current != InVertex);
+		}
+
+		/** @return 속성(인덱스) 기준으로 InFrom -> InTo 방향 간선이 있는지 */
+		bool HasEdge(uint32 InFrom, uint32 InTo) const
+		{
+			for (uint32 Offset = Adjacency.Offsets[InFrom]; Offset < Adjacency.Offsets[InFrom + 1]; ++Offset)
+			{
+				const uint32* Triangle = Indices + Adjacency.Triangles[Offset] * 3;
+				if ((Triangle[0] == InFrom && Triangle[1] == InTo) || (Triangle[1] == InFrom && Triangle[2] == InTo) ||
+					(Triangle[2] == InFrom && Triangle[0] == InTo))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/** @return 위치 기준으로 InFrom -> InTo 방향 간선이 있는지 */
+		bool HasPositionEdge(uint32 InFrom, uint32 InTo) const
+		{
+			bool bFound = false;
+			ForEachWedgeTriangle(InFrom, [&](const uint32* InTriangle, uint32 InCorner)
+			{
+				bFound |= Remap[InTriangle[(InCorner + 1) % 3]] == Remap[InTo];
+			});
+			return bFound;
+		}
+
+		void ClassifyVertices(const uint8* InLockedVertices)
+		{
+			Kinds.assign(VertexCount, EVertexKind::Locked);
+			for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+			{
+				if (Remap[Vertex] != Vertex || Adjacency.Offsets[Vertex] == Adjacency.Offsets[Vertex + 1])
+				{
+					continue;
+				}
+
+				uint32 WedgeCount = 0;
+				bool bIsLocked = false;
+				uint32 PositionOpenCount = 0;
+				bool bHasSimpleAttributeBorder = true;
+				uint32 AttributeOpenCount = 0;
+				uint32 Current = Vertex;
+				do
+				{
+					++WedgeCount;
+					bIsLocked |= InLockedVertices && InLockedVertices[Current];
+
+					uint32 OpenOut = 0;
+					uint32 OpenIn = 0;
+					for (uint32 Offset = Adjacency.Offsets[Current]; Offset < Adjacency.Offsets[Current + 1]; ++Offset)
+					{
+						const uint32* Triangle = Indices + Adjacency.Triangles[Offset] * 3;
+						const uint32 Corner = Triangle[0] == Current ? 0 : (Triangle[1] == Current ? 1 : 2);
+						const uint32 Next = Triangle[(Corner + 1) % 3];
+						const uint32 Prev = Triangle[(Corner + 2) % 3];
+						OpenOut += HasEdge(Next, Current) ? 0 : 1;
+						OpenIn += HasEdge(Current, Prev) ? 0 : 1;
+						PositionOpenCount += HasPositionEdge(Next, Current) ? 0 : 1;
+						PositionOpenCount += HasPositionEdge(Current, Prev) ? 0 : 1;
+					}
+					bHasSimpleAttributeBorder &= OpenOut == 1 && OpenIn == 1;
+					AttributeOpenCount += OpenOut + OpenIn;
+					Current = Wedge[Current];
+				} while (Current != Vertex);
+
+				EVertexKind Kind = EVertexKind::Locked;
+				if (bIsLocked)
+				{
+					Kind = EVertexKind::Locked;
+				}
+				else if (WedgeCount == 1)
+				{
+					// 속성만 열린 정점(이음매 끝)은 어느 쪽으로 접어도 반대쪽 UV가 틀어지므로 고정
+					if (AttributeOpenCount == 0)
+					{
+						Kind = EVertexKind::Manifold;
+					}
+					else if (bHasSimpleAttributeBorder && PositionOpenCount == 2)
+					{
+						Kind = EVertexKind::Border;
+					}
+				}
+				else if (WedgeCount == 2 && PositionOpenCount == 0 && bHasSimpleAttributeBorder)
+				{
+					Kind = EVertexKind::Seam;
+				}
+
+				Current = Vertex;
+				do
+				{
+					Kinds[Current] = Kind;
+					Current = Wedge[Current];
+				} while (Current != Vertex);
+			}
+		}
+
+		void ComputeQuadrics()
+		{
+			Quadrics.assign(VertexCount, FQuadric());
+			for (size_t Index = 0; Index < IndexCount; Index += 3)
+			{
+				const uint32* Triangle = Indices + Index;
+				const FVector& P0 = Positions[Triangle[0]];
+				const FVector& P1 = Positions[Triangle[1]];
+				const FVector& P2 = Positions[Triangle[2]];
+				FVector Normal = CrossProduct(P1 - P0, P2 - P0);
+				const float DoubleArea = Normal.Length();
+				if (DoubleArea <= 0.0f)
+				{
+					continue;
+				}
+				Normal = Normal / DoubleArea;
+
+				const float Distance = -Normal.Dot(P0);
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					Quadrics[Remap[Triangle[Corner]]].AddPlane(Normal, Distance, DoubleArea * 0.5);
+				}
+
+				// 반대 간선이 없는 간선(열린 경계, 이음매)에는 면에 수직인 평면을 세워 간선 모양을 지킨다
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					const uint32 From = Triangle[Corner];
+					const uint32 To = Triangle[(Corner + 1) % 3];
+					if (HasEdge(To, From))
+					{
+						continue;
+					}
+
+					const FVector Edge = Positions[To] - Positions[From];
+					FVector EdgeNormal = CrossProduct(Edge, Normal);
+					const float EdgeNormalLength = EdgeNormal.Length();
+					if (EdgeNormalLength <= 0.0f)
+					{
+						continue;
+					}
+					EdgeNormal = EdgeNormal / EdgeNormalLength;
+
+					const double EdgeWeight = BORDER_WEIGHT * Edge.LengthSquared();
+					const float EdgeDistance = -EdgeNormal.Dot(Positions[From]);
+					Quadrics[Remap[From]].AddPlane(EdgeNormal, EdgeDistance, EdgeWeight);
+					Quadrics[Remap[To]].AddPlane(EdgeNormal, EdgeDistance, EdgeWeight);
+				}
+			}
+		}
+
+		/** @return InVertex를 InTarget 자리로 접을 수 있는지 (두 정점은 간선으로 이어져 있다) */
+		bool CanCollapse(uint32 InVertex, uint32 InTarget) const
+		{
+			switch (Kinds[InVertex])
+			{
+			case EVertexKind::Manifold:
+				return true;
+			case EVertexKind::Border:
+				// 경계 간선을 따라 경계나 고정 정점으로만
+				return (Kinds[InTarget] == EVertexKind::Border || Kinds[InTarget] == EVertexKind::Locked) &&
+					(HasEdge(InVertex, InTarget) != HasEdge(InTarget, InVertex));
+			case EVertexKind::Seam:
+			{
+				// 이음매 간선을 따라 다른 이음매 정점으로, 반대쪽 쌍도 같은 간선으로 이어져 있어야 한다
+				if (Kinds[InTarget] != EVertexKind::Seam || HasEdge(InVertex, InTarget) == HasEdge(InTarget, InVertex))
+				{
+					return false;
+				}
+				const uint32 OtherVertex = Wedge[InVertex];
+				const uint32 OtherTarget = Wedge[InTarget];
+				return HasEdge(OtherVertex, OtherTarget) != HasEdge(OtherTarget, OtherVertex);
+			}
+			default:
+				return false;
+			}
+		}
+
+		double ComputeNormalPenalty(uint32 InVertex, uint32 InTarget) const
+		{
+			double Penalty = NORMAL_WEIGHT * (1.0 - Normals[InVertex].Dot(Normals[InTarget]));
+			if (Kinds[InVertex] == EVertexKind::Seam)
+			{
+				Penalty += NORMAL_WEIGHT * (1.0 - Normals[Wedge[InVertex]].Dot(Normals[Wedge[InTarget]]));
+			}
+			return Penalty;
+		}
+
+		void GatherCollapses(TArray<FCollapse>& OutCollapses) const
+		{
+			OutCollapses.clear();
+			for (size_t Index = 0; Index < IndexCount; ++Index)
+			{
+				const uint32 A = Indices[Index];
+				const uint32 B = Indices[Index - Index % 3 + (Index + 1) % 3];
+
+				// 양방향으로 있는 간선은 한 번만 본다
+				if (A > B && HasEdge(B, A))
+				{
+					continue;
+				}
+
+				FCollapse Best = { 0, 0, DBL_MAX, 0.0 };
+				if (CanCollapse(A, B))
+				{
+					const double Error = Quadrics[Remap[A]].Evaluate(Positions[B]);
+					Best = { A, B, Error + ComputeNormalPenalty(A, B), Error };
+				}
+				if (CanCollapse(B, A))
+				{
+					const double Error = Quadrics[Remap[B]].Evaluate(Positions[A]);
+					const double Cost = Error + ComputeNormalPenalty(B, A);
+					if (Cost < Best.Cost)
+					{
+						Best = { B, A, Cost, Error };
+					}
+				}
+				if (Best.Cost < DBL_MAX)
+				{
+					OutCollapses.push_back(Best);
+				}
+			}
+		}
+
+		/** @return InVertex 위치를 InTarget 위치로 옮겼을 때 남는 삼각형 중 뒤집히거나 크게 꺾이는 것이 있는지 */
+		bool HasTriangleFlip(uint32 InVertex, uint32 InTarget) const
+		{
+			const FVector& NewPosition = Positions[InTarget];
+			bool bFlipped = false;
+			ForEachWedgeTriangle(InVertex, [&](const uint32* InTriangle, uint32 InCorner)
+			{
+				const uint32 B = InTriangle[(InCorner + 1) % 3];
+				const uint32 C = InTriangle[(InCorner + 2) % 3];
+				if (bFlipped || Remap[B] == Remap[InTarget] || Remap[C] == Remap[InTarget])
+				{
+					return;
+				}
+
+				const FVector& PositionA = Positions[InTriangle[InCorner]];
+				const FVector OldNormal = CrossProduct(Positions[B] - PositionA, Positions[C] - PositionA);
+				const FVector NewNormal = CrossProduct(Positions[B] - NewPosition, Positions[C] - NewPosition);
+				const float Dot = OldNormal.Dot(NewNormal);
+				bFlipped = Dot <= MIN_FACE_NORMAL_COS * std::sqrt(OldNormal.LengthSquared() * NewNormal.LengthSquared());
+			});
+			return bFlipped;
+		}
+
+		uint32* Indices;
+		size_t IndexCount;
+		uint32 VertexCount;
+
+		float Scale = 1.0f;
+		TArray<FVector> Positions;
+		TArray<FVector> Normals;
+		TArray<uint32> Remap;
+		TArray<uint32> Wedge;
+		TArray<EVertexKind> Kinds;
+		TArray<FQuadric> Quadrics;
+		FVertexAdjacency Adjacency;
+	};
+
+	/** @return 정점마다 둘 이상의 섹션이 같은 위치를 쓰면 1, 이 정점들을 고정하면 섹션 경계에 틈이 생기지 않는다 */
+	TArray<uint8> FindSectionBoundaryVertices(const FStaticMesh& InStaticMesh)
+	{
+		const uint32 VertexCount = static_cast<uint32>(InStaticMesh.Vertices.size());
+		TArray<uint8> Locked(VertexCount, 0);
+		if (InStaticMesh.Sections.size() < 2)
+		{
+			return Locked;
+		}
+
+		constexpr uint32 NO_SECTION = UINT32_MAX;
+		constexpr uint32 MANY_SECTIONS = UINT32_MAX - 1;
+		TArray<uint32> VertexSection(VertexCount, NO_SECTION);
+		for (uint32 SectionIndex = 0; SectionIndex < InStaticMesh.Sections.size(); ++SectionIndex)
+		{
+			const FMeshSection& Section = InStaticMesh.Sections[SectionIndex];
+			for (uint32 Index = Section.StartIndex; Index < Section.StartIndex + Section.IndexCount; ++Index)
+			{
+				uint32& Owner = VertexSection[InStaticMesh.Indices[Index]];
+				Owner = Owner == NO_SECTION || Owner == SectionIndex ? SectionIndex : MANY_SECTIONS;
+			}
+		}
+
+		TArray<uint8> Used(VertexCount);
+		for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+		{
+			Used[Vertex] = VertexSection[Vertex] != NO_SECTION ? 1 : 0;
+		}
+		TArray<uint32> Remap;
+		TArray<uint32> Wedge;
+		BuildPositionGroups(InStaticMesh.Vertices.data(), VertexCount, Used, Remap, Wedge);
+
+		for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+		{
+			if (!Used[Vertex] || Remap[Vertex] != Vertex)
+			{
+				continue;
+			}
+
+			bool bIsShared = false;
+			uint32 Current = Vertex;
+			do
+			{
+				bIsShared |= VertexSection[Current] != VertexSection[Vertex] || VertexSection[Current] == MANY_SECTIONS;
+				Current = Wedge[Current];
+			} while (Current != Vertex);
+
+			do
+			{
+				Locked[Current] = bIsShared ? 1 : 0;
+				Current = Wedge[Current];
+			} while (Current != Vertex);
+		}
+		return Locked;
+	}
+}
+
+size_t FMeshSimplifier::Simplify(uint32* InOutIndices, size_t InIndexCount, const FNormalVertex* InVertices, uint32 InVertexCount,
+	size_t InTargetIndexCount, float InMaxError, const uint8* InLockedVertices, float* OutError)
+{
+	const size_t IndexCount = InIndexCount / 3 * 3;
+	float Error = 0.0f;
+	size_t ResultCount = IndexCount;
+	if (IndexCount > InTargetIndexCount && InVertexCount > 0)
+	{
+		FSimplifier Simplifier(InOutIndices, IndexCount, InVertices, InVertexCount, InLockedVertices);
+		ResultCount = Simplifier.Run(InTargetIndexCount, InMaxError, Error);
+	}
+
+	if (OutError)
+	{
+		*OutError = Error;
+	}
+	return ResultCount;
+}
+
+void FMeshSimplifier::BuildLODs(FStaticMesh& InOutStaticMesh, int32 InLODCount)
+{
+	InOutStaticMesh.LODIndices.clear();
+	InOutStaticMesh.LODs.clear();
+
+	const TArray<FNormalVertex>& Vertices = InOutStaticMesh.Vertices;
+	const TArray<uint32>& Indices = InOutStaticMesh.Indices;
+	TArray<uint32>& LODIndices = InOutStaticMesh.LODIndices;
+	const uint32 VertexCount = static_cast<uint32>(Vertices.size());
+	if (InLODCount < 2 || VertexCount == 0 || Indices.size() / 3 < MIN_LOD_TRIANGLES)
+	{
+		return;
+	}
+
+	FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (const FNormalVertex& Vertex : Vertices)
+	{
+		Min = FVector(std::min(Min.X, Vertex.Position.X), std::min(Min.Y, Vertex.Position.Y), std::min(Min.Z, Vertex.Position.Z));
+		Max = FVector(std::max(Max.X, Vertex.Position.X), std::max(Max.Y, Vertex.Position.Y), std::max(Max.Z, Vertex.Position.Z));
+	}
+	const float Diagonal = (Max - Min).Length();
+	if (Diagonal <= 0.0f)
+	{
+		return;
+	}
+
+	const TArray<uint8> SectionBoundary = FindSectionBoundaryVertices(InOutStaticMesh);
+
+	// 섹션이 쓰는 정점만 0부터 다시 번호를 매겨 섹션 크기에 비례하는 작업만 하도록 한다
+	TArray<uint32> GlobalToLocal(VertexCount, UINT32_MAX);
+	TArray<uint32> LocalToGlobal;
+	TArray<uint32> LocalIndices;
+	TArray<FNormalVertex> LocalVertices;
+	TArray<uint8> LocalLocked;
+
+	// 앞 LOD의 섹션은 GPU 인덱스 버퍼(Indices 뒤에 LODIndices) 기준이다
+	auto GetIndex = [&Indices, &LODIndices](uint32 InBufferIndex)
+	{
+		return InBufferIndex < Indices.size() ? Indices[InBufferIndex] : LODIndices[InBufferIndex - Indices.size()];
+	};
+
+	TArray<FMeshSection> PrevSections = InOutStaticMesh.Sections;
+	size_t PrevTriangleCount = Indices.size() / 3;
+	float PrevScreenSize = 1.0f / MAX_SCREEN_SIZE_STEP;
+	float AccumulatedError = 0.0f;
+
+	for (int32 LODIndex = 1; LODIndex < InLODCount; ++LODIndex)
+	{
+		FStaticMeshLOD LOD;
+		LOD.FirstIndex = static_cast<uint32>(Indices.size() + LODIndices.size());
+		float LODError = 0.0f;
+
+		for (const FMeshSection& PrevSection : PrevSections)
+		{
+			const uint32 SectionIndexCount = PrevSection.IndexCount / 3 * 3;
+
+			LocalToGlobal.clear();
+			LocalIndices.resize(SectionIndexCount);
+			for (uint32 Index = 0; Index < SectionIndexCount; ++Index)
+			{
+				const uint32 Global = GetIndex(PrevSection.StartIndex + Index);
+				uint32& Local = GlobalToLocal[Global];
+				if (Local == UINT32_MAX)
+				{
+					Local = static_cast<uint32>(LocalToGlobal.size());
+					LocalToGlobal.push_back(Global);
+				}
+				LocalIndices[Index] = Local;
+			}
+
+			LocalVertices.resize(LocalToGlobal.size());
+			LocalLocked.resize(LocalToGlobal.size());
+			for (size_t Local = 0; Local < LocalToGlobal.size(); ++Local)
+			{
+				LocalVertices[Local] = Vertices[LocalToGlobal[Local]];
+				LocalLocked[Local] = SectionBoundary[LocalToGlobal[Local]];
+			}
+
+			const size_t TargetIndexCount = static_cast<size_t>(SectionIndexCount / 3 * LOD_TRIANGLE_RATIO) * 3;
+			float SectionError = 0.0f;
+			const size_t NewIndexCount = Simplify(LocalIndices.data(), SectionIndexCount, LocalVertices.data(),
+				static_cast<uint32>(LocalToGlobal.size()), TargetIndexCount, MAX_LOD_ERROR * Diagonal, LocalLocked.data(), &SectionError);
+			LODError = std::max(LODError, SectionError);
+
+			FMeshSection Section;
+			Section.StartIndex = static_cast<uint32>(Indices.size() + LODIndices.size());
+			Section.IndexCount = static_cast<uint32>(NewIndexCount);
+			Section.MaterialSlot = PrevSection.MaterialSlot;
+			LOD.Sections.push_back(Section);
+
+			for (size_t Index = 0; Index < NewIndexCount; ++Index)
+			{
+				LODIndices.push_back(LocalToGlobal[LocalIndices[Index]]);
+			}
+			for (const uint32 Global : LocalToGlobal)
+			{
+				GlobalToLocal[Global] = UINT32_MAX;
+			}
+		}
+
+		LOD.IndexCount = static_cast<uint32>(Indices.size() + LODIndices.size()) - LOD.FirstIndex;
+		const size_t TriangleCount = LOD.IndexCount / 3;
+		if (TriangleCount == 0 || TriangleCount > PrevTriangleCount * MIN_LOD_REDUCTION)
+		{
+			LODIndices.resize(LOD.FirstIndex - Indices.size());
+			break;
+		}
+
+		// 앞 LOD에서 이어 단순화하므로 LOD0 대비 오차는 단계별 오차의 합으로 잡는다
+		AccumulatedError += LODError;
+		const float RelativeError = std::max(AccumulatedError / Diagonal, 1e-6f);
+		LOD.Error = AccumulatedError;
+		LOD.ScreenSize = std::min(PrevScreenSize * MAX_SCREEN_SIZE_STEP, MAX_PIXEL_ERROR / (REFERENCE_SCREEN_HEIGHT * RelativeError));
+
+		PrevSections = LOD.Sections;
+		PrevTriangleCount = TriangleCount;
+		PrevScreenSize = LOD.ScreenSize;
+		InOutStaticMesh.LODs.push_back(std::move(LOD));
+
+		if (TriangleCount < MIN_LOD_TRIANGLES)
+		{
+			break;
+		}
+	}
+}
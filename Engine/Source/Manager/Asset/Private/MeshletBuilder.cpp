@@ -0,0 +1,303 @@
+#include "pch.h"
+#include "Manager/Asset/Public/MeshletBuilder.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+
+namespace
+{
+	/** @brief 노멀이 이보다 넓게 퍼진 메시렛(콘 반각 약 84도 초과)은 콘으로 컬링할 수 있는 시점이 거의 없으므로 콘을 끈다 */
+	constexpr float MIN_CONE_DOT = 0.1f;
+	/** @brief 부동소수 오차로 앞면 삼각형을 버리지 않도록 콘과 꼭짓점에 두는 여유 */
+	constexpr float CONE_EPSILON = 1e-3f;
+
+	/**
+	 * @brief 래스터라이저가 앞면으로 보는 쪽의 면 노멀 (정규화 전)
+	 * FrontCounterClockwise 상태의 왼손 좌표계에서는 표준 외적 (P2 - P0) x (P1 - P0) 방향이 카메라를 향하며,
+	 * 부호가 반대인 FVector::Cross로는 (P1 - P0).Cross(P2 - P0)와 같다.
+	 */
+	FVector FrontFaceNormal(const FVector& InP0, const FVector& InP1, const FVector& InP2)
+	{
+		return (InP1 - InP0).Cross(InP2 - InP0);
+	}
+}
+
+void FMeshletBuilder::BuildMeshlets(FStaticMesh& InOutStaticMesh)
+{
+	InOutStaticMesh.Meshlets.clear();
+
+	TArray<uint32>& Indices = InOutStaticMesh.Indices;
+	const uint32 VertexCount = static_cast<uint32>(InOutStaticMesh.Vertices.size());
+	if (VertexCount == 0 || Indices.size() / 3 < MIN_MESH_TRIANGLES)
+	{
+		return;
+	}
+
+	// 섹션이 없는 메시는 인덱스 버퍼 전체를 섹션 0으로 본다
+	if (InOutStaticMesh.Sections.empty())
+	{
+		BuildSectionMeshlets(Indices.data(), static_cast<uint32>(Indices.size()), 0, 0,
+			InOutStaticMesh.Vertices.data(), VertexCount, InOutStaticMesh.Meshlets);
+		return;
+	}
+
+	for (uint32 SectionIndex = 0; SectionIndex < InOutStaticMesh.Sections.size(); ++SectionIndex)
+	{
+		const FMeshSection& Section = InOutStaticMesh.Sections[SectionIndex];
+		if (static_cast<uint64>(Section.StartIndex) + Section.IndexCount > Indices.size())
+		{
+			continue;
+		}
+		BuildSectionMeshlets(Indices.data() + Section.StartIndex, Section.IndexCount, Section.StartIndex, SectionIndex,
+			InOutStaticMesh.Vertices.data(), VertexCount, InOutStaticMesh.Meshlets);
+	}
+}
+
+void FMeshletBuilder::BuildSectionMeshlets(uint32* InOutIndices, uint32 InIndexCount, uint32 InIndexBase, uint32 InSectionIndex,
+	const FNormalVertex* InVertices, uint32 InVertexCount, TArray<FMeshlet>& OutMeshlets)
+{
+	const uint32 TriangleCount = InIndexCount / 3;
+	if (TriangleCount == 0)
+	{
+		return;
+	}
+
+	// 삼각형마다 단위 면 노멀, 퇴화 삼각형의 노멀은 0
+	TArray<FVector> Normals(TriangleCount);
+	for (uint32 Triangle = 0; Triangle < TriangleCount; ++Triangle)
+	{
+		const FVector& P0 = InVertices[InOutIndices[Triangle * 3 + 0]].Position;
+		const FVector& P1 = InVertices[InOutIndices[Triangle * 3 + 1]].Position;
+		const FVector& P2 = InVertices[InOutIndices[Triangle * 3 + 2]].Position;
+
+		const FVector Normal = FrontFaceNormal(P0, P1, P2);
+		const float Length = Normal.Length();
+		Normals[Triangle] = Length > 0.0f ? Normal / Length : FVector();
+	}
+
+	// 정점마다 아직 내보내지 않은 삼각형 목록, 내보낸 삼각형은 목록 끝과 바꿔 지운다
+	TArray<uint32> AdjacencyOffsets(InVertexCount + 1, 0);
+	TArray<uint32> AdjacencyCounts(InVertexCount, 0);
+	for (uint32 Index = 0; Index < TriangleCount * 3; ++Index)
+	{
+		++AdjacencyCounts[InOutIndices[Index]];
+	}
+	for (uint32 Vertex = 0; Vertex < InVertexCount; ++Vertex)
+	{
+		AdjacencyOffsets[Vertex + 1] = AdjacencyOffsets[Vertex] + AdjacencyCounts[Vertex];
+		AdjacencyCounts[Vertex] = 0;
+	}
+	TArray<uint32> AdjacencyTriangles(TriangleCount * 3);
+	for (uint32 Index = 0; Index < TriangleCount * 3; ++Index)
+	{
+		const uint32 Vertex = InOutIndices[Index];
+		AdjacencyTriangles[AdjacencyOffsets[Vertex] + AdjacencyCounts[Vertex]++] = Index / 3;
+	}
+
+	TArray<uint8> bIsEmitted(TriangleCount, 0);
+	TArray<uint8> bIsInMeshlet(InVertexCount, 0);
+	TArray<uint32> MeshletVertices;
+	TArray<uint32> MeshletTriangles;
+	FVector NormalSum;
+	TArray<uint32> Reordered;
+	Reordered.reserve(TriangleCount * 3);
+
+	auto CountNewVertices = [&](uint32 InTriangle)
+	{
+		const uint32 A = InOutIndices[InTriangle * 3 + 0];
+		const uint32 B = InOutIndices[InTriangle * 3 + 1];
+		const uint32 C = InOutIndices[InTriangle * 3 + 2];
+		return static_cast<uint32>(!bIsInMeshlet[A]) + static_cast<uint32>(B != A && !bIsInMeshlet[B]) +
+			static_cast<uint32>(C != A && C != B && !bIsInMeshlet[C]);
+	};
+
+	auto Emit = [&](uint32 InTriangle)
+	{
+		bIsEmitted[InTriangle] = 1;
+		MeshletTriangles.push_back(InTriangle);
+		NormalSum += Normals[InTriangle];
+
+		for (uint32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const uint32 Vertex = InOutIndices[InTriangle * 3 + Corner];
+			if (!bIsInMeshlet[Vertex])
+			{
+				bIsInMeshlet[Vertex] = 1;
+				MeshletVertices.push_back(Vertex);
+			}
+
+			uint32* List = &AdjacencyTriangles[AdjacencyOffsets[Vertex]];
+			uint32& Count = AdjacencyCounts[Vertex];
+			for (uint32 Slot = 0; Slot < Count; ++Slot)
+			{
+				if (List[Slot] == InTriangle)
+				{
+					List[Slot] = List[--Count];
+					break;
+				}
+			}
+		}
+	};
+
+	auto Flush = [&]()
+	{
+		if (MeshletTriangles.empty())
+		{
+			return;
+		}
+
+		FMeshlet Meshlet;
+		Meshlet.SectionIndex = InSectionIndex;
+		Meshlet.FirstIndex = InIndexBase + static_cast<uint32>(Reordered.size());
+		Meshlet.IndexCount = static_cast<uint32>(MeshletTriangles.size() * 3);
+		for (uint32 Triangle : MeshletTriangles)
+		{
+			Reordered.insert(Reordered.end(), InOutIndices + Triangle * 3, InOutIndices + Triangle * 3 + 3);
+		}
+		ComputeBounds(Reordered.data() + (Meshlet.FirstIndex - InIndexBase), Meshlet.IndexCount, InVertices, Meshlet);
+		OutMeshlets.push_back(Meshlet);
+
+		for (uint32 Vertex : MeshletVertices)
+		{
+			bIsInMeshlet[Vertex] = 0;
+		}
+		MeshletVertices.clear();
+		MeshletTriangles.clear();
+		NormalSum = FVector();
+	};
+
+	// 이어진 삼각형이 없을 때 다음 씨앗은 입력 순서에서 잡는다, FMeshOptimizer가 정한 오버드로 클러스터 순서가 메시렛 순서로 이어진다
+	uint32 SeedCursor = 0;
+	for (uint32 EmittedCount = 0; EmittedCount < TriangleCount; ++EmittedCount)
+	{
+		// 메시렛 정점에 붙은 삼각형 중 새 정점이 적고 노멀이 평균에 가까운 것
+		int64 Best = -1;
+		if (!MeshletTriangles.empty())
+		{
+			const float AxisLength = NormalSum.Length();
+			const FVector Axis = AxisLength > 0.0f ? NormalSum / AxisLength : FVector();
+			float BestScore = FLT_MAX;
+			for (uint32 Vertex : MeshletVertices)
+			{
+				const uint32* List = &AdjacencyTriangles[AdjacencyOffsets[Vertex]];
+				for (uint32 Slot = 0; Slot < AdjacencyCounts[Vertex]; ++Slot)
+				{
+					const uint32 Triangle = List[Slot];
+					const uint32 NewVertices = CountNewVertices(Triangle);
+					if (MeshletVertices.size() + NewVertices > MAX_VERTICES)
+					{
+						continue;
+					}
+
+					const float Score = static_cast<float>(NewVertices) + CONE_WEIGHT * (1.0f - Normals[Triangle].Dot(Axis));
+					if (Score < BestScore)
+					{
+						BestScore = Score;
+						Best = Triangle;
+					}
+				}
+			}
+		}
+
+		if (Best < 0)
+		{
+			while (bIsEmitted[SeedCursor])
+			{
+				++SeedCursor;
+			}
+			Best = SeedCursor;
+
+			// 반 이상 찬 메시렛에 떨어진 조각을 붙이면 경계 구만 커지므로 여기서 끊는다
+			if (MeshletTriangles.size() >= MAX_TRIANGLES / 2 || MeshletVertices.size() + CountNewVertices(static_cast<uint32>(Best)) > MAX_VERTICES)
+			{
+				Flush();
+			}
+		}
+
+		Emit(static_cast<uint32>(Best));
+		if (MeshletTriangles.size() >= MAX_TRIANGLES)
+		{
+			Flush();
+		}
+	}
+	Flush();
+
+	std::copy(Reordered.begin(), Reordered.end(), InOutIndices);
+}
+
+void FMeshletBuilder::ComputeBounds(const uint32* InIndices, uint32 InIndexCount, const FNormalVertex* InVertices, FMeshlet& OutMeshlet)
+{
+	// 경계 구는 AABB 중심에서 가장 먼 정점까지
+	FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (uint32 Index = 0; Index < InIndexCount; ++Index)
+	{
+		const FVector& Position = InVertices[InIndices[Index]].Position;
+		Min = FVector(std::min(Min.X, Position.X), std::min(Min.Y, Position.Y), std::min(Min.Z, Position.Z));
+		Max = FVector(std::max(Max.X, Position.X), std::max(Max.Y, Position.Y), std::max(Max.Z, Position.Z));
+	}
+	const FVector Center = (Min + Max) * 0.5f;
+	float RadiusSquared = 0.0f;
+	for (uint32 Index = 0; Index < InIndexCount; ++Index)
+	{
+		RadiusSquared = std::max(RadiusSquared, (InVertices[InIndices[Index]].Position - Center).LengthSquared());
+	}
+
+	OutMeshlet.Center = Center;
+	OutMeshlet.Radius = sqrtf(RadiusSquared);
+	OutMeshlet.ConeApex = Center;
+	OutMeshlet.ConeAxis = FVector();
+	OutMeshlet.ConeCutoff = 1.0f;
+
+	// 콘 축은 단위 면 노멀의 평균, 반각은 축과 가장 멀리 벌어진 노멀까지
+	FVector NormalSum;
+	for (uint32 Index = 0; Index + 2 < InIndexCount; Index += 3)
+	{
+		const FVector Normal = FrontFaceNormal(InVertices[InIndices[Index]].Position, InVertices[InIndices[Index + 1]].Position, InVertices[InIndices[Index + 2]].Position);
+		const float Length = Normal.Length();
+		if (Length > 0.0f)
+		{
+			NormalSum += Normal / Length;
+		}
+	}
+	const float AxisLength = NormalSum.Length();
+	if (AxisLength <= MATH_EPSILON)
+	{
+		return;
+	}
+	const FVector Axis = NormalSum / AxisLength;
+
+	float MinDot = 1.0f;
+	for (uint32 Index = 0; Index + 2 < InIndexCount; Index += 3)
+	{
+		const FVector Normal = FrontFaceNormal(InVertices[InIndices[Index]].Position, InVertices[InIndices[Index + 1]].Position, InVertices[InIndices[Index + 2]].Position);
+		const float Length = Normal.Length();
+		if (Length > 0.0f)
+		{
+			MinDot = std::min(MinDot, Axis.Dot(Normal / Length));
+		}
+	}
+	if (MinDot < MIN_CONE_DOT)
+	{
+		return;
+	}
+
+	// 꼭짓점은 축을 따라 중심 뒤로 물려 모든 삼각형 평면의 뒤쪽(또는 평면 위)에 둔다: (P0 - Apex) · N >= 0
+	float MaxT = 0.0f;
+	for (uint32 Index = 0; Index + 2 < InIndexCount; Index += 3)
+	{
+		const FVector& P0 = InVertices[InIndices[Index]].Position;
+		const FVector Normal = FrontFaceNormal(P0, InVertices[InIndices[Index + 1]].Position, InVertices[InIndices[Index + 2]].Position);
+		const float Length = Normal.Length();
+		if (Length > 0.0f)
+		{
+			const FVector UnitNormal = Normal / Length;
+			MaxT = std::max(MaxT, (Center - P0).Dot(UnitNormal) / Axis.Dot(UnitNormal));
+		}
+	}
+
+	// 카메라에서 꼭짓점으로의 방향이 축과 (90도 - 반각) 이내면 모든 삼각형이 뒷면이다, 반각의 코사인이 MinDot이므로 기준은 그 사인
+	const float ConservativeDot = MinDot - CONE_EPSILON;
+	OutMeshlet.ConeApex = Center - Axis * (MaxT + CONE_EPSILON * OutMeshlet.Radius);
+	OutMeshlet.ConeAxis = Axis;
+	OutMeshlet.ConeCutoff = sqrtf(1.0f - ConservativeDot * ConservativeDot);
+}
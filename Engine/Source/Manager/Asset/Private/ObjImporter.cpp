@@ -1,42 +1,241 @@
 #include "pch.h"
 
-#include "Core/Public/WindowsBinReader.h"
-#include "Core/Public/WindowsBinWriter.h"
+#include <charconv>
+#include <string_view>
+
+#include "Core/Public/JobSystem.h"
+#include "Core/Public/WindowsMappedFile.h"
 #include "Manager/Asset/Public/ObjImporter.h"
 
-bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config)
+namespace
 {
-	if (!OutObjInfo)
+	/** Chunks smaller than this are not worth a job of their own. */
+	constexpr size_t MIN_OBJ_CHUNK_BYTES = 256 * 1024;
+
+	/** State-dependent lines recorded by FObjImporter::ParseObjChunk and replayed in file order. */
+	enum class EObjEventType : uint8
 	{
-		return false;
+		Faces,
+		Object,
+		Group,
+		Material,
+		MaterialLibrary,
+		Error,
+	};
+
+	struct FObjEvent
+	{
+		EObjEventType Type;
+
+		/** Object, Group, Material, MaterialLibrary: the name token, points into the mapped file. */
+		std::string_view Name;
+
+		/** Error: the message the line-by-line path would log. */
+		const char* ErrorMessage;
+
+		/** Faces: triangle count of the run and the end of the run in each index list of the chunk. */
+		size_t FaceCount;
+		size_t VertexIndexEnd;
+		size_t TexCoordIndexEnd;
+		size_t NormalIndexEnd;
+	};
+
+	struct FObjCorner
+	{
+		size_t VertexIndex;
+		size_t TexCoordIndex;
+		size_t NormalIndex;
+		bool bHasTexCoord;
+		bool bHasNormal;
+	};
+
+	/** Same characters std::istream treats as whitespace in the "C" locale. */
+	bool IsSpace(char InChar)
+	{
+		return InChar == ' ' || InChar == '\t' || InChar == '\r' || InChar == '\n' || InChar == '\v' || InChar == '\f';
 	}
 
-	if (!std::filesystem::exists(FilePath))
+	void SkipSpace(const char*& InOutCursor, const char* InEnd)
 	{
-		UE_LOG_ERROR("파일을 찾지 못했습니다: %s", FilePath.string().c_str());
-		return false;
+		while (InOutCursor < InEnd && IsSpace(*InOutCursor))
+		{
+			++InOutCursor;
+		}
 	}
 
-	std::filesystem::path BinFilePath = FilePath;
-	BinFilePath.replace_extension(".objbin");
+	/** Equivalent of 'Stream >> FString', returns an empty view at the end of the line. */
+	std::string_view ReadToken(const char*& InOutCursor, const char* InEnd)
+	{
+		SkipSpace(InOutCursor, InEnd);
+		const char* Begin = InOutCursor;
+		while (InOutCursor < InEnd && !IsSpace(*InOutCursor))
+		{
+			++InOutCursor;
+		}
+		return std::string_view(Begin, static_cast<size_t>(InOutCursor - Begin));
+	}
 
-	if (Config.bIsBinaryEnabled && std::filesystem::exists(BinFilePath))
+	/** Equivalent of 'Stream >> float': skips whitespace, accepts a leading '+' and stops right after the number. */
+	bool ReadFloat(const char*& InOutCursor, const char* InEnd, float& OutValue)
 	{
-		auto ObjTime = std::filesystem::last_write_time(FilePath);
-		auto BinTime = std::filesystem::last_write_time(BinFilePath);
+		SkipSpace(InOutCursor, InEnd);
+		const char* Begin = InOutCursor;
+		if (Begin < InEnd && *Begin == '+')
+		{
+			++Begin;
+			if (Begin < InEnd && *Begin == '-')
+			{
+				return false;
+			}
+		}
 
-		if (BinTime >= ObjTime)
+		const std::from_chars_result Result = std::from_chars(Begin, InEnd, OutValue);
+		if (Result.ec != std::errc())
 		{
-			UE_LOG("바이너리 파일이 존재합니다: %s", BinFilePath.string().c_str());
-			FWindowsBinReader WindowsBinReader(BinFilePath);
-			WindowsBinReader << *OutObjInfo;
+			return false;
+		}
 
-			return true;
+		InOutCursor = Result.ptr;
+		return true;
+	}
+
+	/** Equivalent of 'std::stoull(Text) - 1', including the wrap-around of a leading '-'. */
+	bool ParseIndex(std::string_view InText, size_t& OutIndex)
+	{
+		const char* Begin = InText.data();
+		const char* End = Begin + InText.size();
+
+		bool bIsNegative = false;
+		if (Begin < End && (*Begin == '+' || *Begin == '-'))
+		{
+			bIsNegative = *Begin == '-';
+			++Begin;
 		}
-		else
+
+		unsigned long long Value = 0;
+		const std::from_chars_result Result = std::from_chars(Begin, End, Value);
+		if (Result.ec != std::errc())
 		{
-			UE_LOG("바이너리 파일이 원본보다 오래되었습니다. 무시합니다: %s", BinFilePath.string().c_str());
+			return false;
 		}
+
+		OutIndex = static_cast<size_t>((bIsNegative ? 0ULL - Value : Value) - 1);
+		return true;
+	}
+
+	/**
+	 * @brief Same rules as FObjImporter::ParseFaceBuffer without the string allocations.
+	 * Splits on '/' like std::getline, which does not produce a trailing empty part.
+	 * @return nullptr on success, otherwise the message ParseFaceBuffer would log
+	 */
+	const char* ParseCorner(std::string_view InToken, FObjCorner& OutCorner)
+	{
+		std::string_view Parts[3];
+		size_t PartCount = 0;
+		size_t PartBegin = 0;
+		for (size_t Index = 0; Index <= InToken.size(); ++Index)
+		{
+			if (Index < InToken.size() && InToken[Index] != '/')
+			{
+				continue;
+			}
+
+			if (Index == InToken.size() && Index == PartBegin)
+			{
+				break;
+			}
+
+			if (PartCount < 3)
+			{
+				Parts[PartCount] = InToken.substr(PartBegin, Index - PartBegin);
+			}
+			++PartCount;
+			PartBegin = Index + 1;
+		}
+
+		OutCorner = {};
+		if (PartCount == 0)
+		{
+			return "면 형식이 잘못되었습니다";
+		}
+
+		if (Parts[0].empty())
+		{
+			return "정점 위치 형식이 잘못되었습니다";
+		}
+
+		if (!ParseIndex(Parts[0], OutCorner.VertexIndex))
+		{
+			return "정점 위치 인덱스 형식이 잘못되었습니다";
+		}
+
+		switch (PartCount)
+		{
+		case 1:
+			break;
+		case 2:
+			if (Parts[1].empty() || !ParseIndex(Parts[1], OutCorner.TexCoordIndex))
+			{
+				return "정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다";
+			}
+			OutCorner.bHasTexCoord = true;
+			break;
+		case 3:
+			if (Parts[1].empty())
+			{
+				if (Parts[2].empty() || !ParseIndex(Parts[2], OutCorner.NormalIndex))
+				{
+					return "정점 법선 인덱스 형식이 잘못되었습니다";
+				}
+				OutCorner.bHasNormal = true;
+			}
+			else
+			{
+				if (Parts[2].empty() || !ParseIndex(Parts[1], OutCorner.TexCoordIndex) || !ParseIndex(Parts[2], OutCorner.NormalIndex))
+				{
+					return "정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다";
+				}
+				OutCorner.bHasTexCoord = true;
+				OutCorner.bHasNormal = true;
+			}
+			break;
+		default:
+			/** Like ParseFaceBuffer, only the position index of 'v/vt/vn/...' is used */
+			break;
+		}
+
+		return nullptr;
+	}
+}
+
+struct FObjImporter::FObjChunk
+{
+	TArray<FVector> VertexList;
+	TArray<FVector> NormalList;
+	TArray<FVector2> TexCoordList;
+
+	TArray<size_t> VertexIndexList;
+	TArray<size_t> NormalIndexList;
+	TArray<size_t> TexCoordIndexList;
+
+	TArray<FObjEvent> Events;
+
+	/** Scratch buffers reused by every face line so that parsing a face does not allocate. */
+	TArray<std::string_view> FaceTokens;
+	TArray<FObjCorner> FaceCorners;
+};
+
+bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config)
+{
+	if (!OutObjInfo)
+	{
+		return false;
+	}
+
+	if (!std::filesystem::exists(FilePath))
+	{
+		UE_LOG_ERROR("파일을 찾지 못했습니다: %s", FilePath.string().c_str());
+		return false;
 	}
 
 	if (FilePath.extension() != ".obj")
@@ -45,6 +244,11 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		return false;
 	}
 
+	if (Config.bIsParallelParsingEnabled)
+	{
+		return LoadObjParallel(FilePath, OutObjInfo, Config);
+	}
+
 	std::ifstream File(FilePath);
 	if (!File)
 	{
@@ -256,6 +460,7 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 			std::filesystem::path MaterialFilePath = FilePath.parent_path() / MaterialFileName;
 
 			MaterialFilePath = std::filesystem::weakly_canonical(MaterialFilePath);
+			OutObjInfo->MaterialFileList.emplace_back(MaterialFilePath.generic_string());
 
 			if (!LoadMaterial(MaterialFilePath, OutObjInfo))
 			{
@@ -285,12 +490,6 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
 	}
 
-	if (Config.bIsBinaryEnabled)
-	{
-		FWindowsBinWriter WindowsBinWriter(BinFilePath);
-		WindowsBinWriter << *OutObjInfo;
-	}
-
 	return true;
 }
 
@@ -664,3 +863,320 @@ bool FObjImporter::ParseFaceBuffer(const FString& FaceBuffer, FObjectInfo* OutOb
 
 	return true;
 }
+
+bool FObjImporter::LoadObjParallel(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const Configuration& Config)
+{
+	/** An empty file cannot be mapped, and parses to nothing anyway */
+	std::error_code ErrorCode;
+	if (std::filesystem::file_size(FilePath, ErrorCode) == 0 && !ErrorCode)
+	{
+		return true;
+	}
+
+	FWindowsMappedFile File(FilePath);
+	if (!File.IsValid())
+	{
+		UE_LOG_ERROR("파일을 열지 못했습니다: %s", FilePath.string().c_str());
+		return false;
+	}
+
+	const char* Data = reinterpret_cast<const char*>(File.GetData());
+	const size_t Size = File.GetSize();
+
+	/** #1. Split the file at line starts, a few chunks per thread so that stealing can even out dense regions */
+	FJobSystem& JobSystem = FJobSystem::GetInstance();
+	const size_t MaxChunkCount = (static_cast<size_t>(JobSystem.GetWorkerCount()) + 1) * 4;
+	const size_t ChunkCount = std::clamp<size_t>(Size / MIN_OBJ_CHUNK_BYTES, 1, MaxChunkCount);
+
+	TArray<const char*> Boundaries;
+	Boundaries.reserve(ChunkCount + 1);
+	Boundaries.push_back(Data);
+	for (size_t ChunkIndex = 1; ChunkIndex < ChunkCount; ++ChunkIndex)
+	{
+		const char* Split = std::max(Data + Size / ChunkCount * ChunkIndex, Boundaries.back());
+		const char* NewLine = static_cast<const char*>(memchr(Split, '\n', static_cast<size_t>(Data + Size - Split)));
+		Boundaries.push_back(NewLine ? NewLine + 1 : Data + Size);
+	}
+	Boundaries.push_back(Data + Size);
+
+	/** #2. Parse every chunk independently */
+	TArray<FObjChunk> Chunks(ChunkCount);
+	JobSystem.ParallelFor(static_cast<int32>(ChunkCount), [&](int32 InChunkIndex)
+	{
+		ParseObjChunk(Boundaries[InChunkIndex], Boundaries[InChunkIndex + 1], Config, Chunks[InChunkIndex]);
+	});
+
+	/** #3. Concatenate vertex data, which does not depend on parser state */
+	size_t VertexCount = 0;
+	size_t NormalCount = 0;
+	size_t TexCoordCount = 0;
+	for (const FObjChunk& Chunk : Chunks)
+	{
+		VertexCount += Chunk.VertexList.size();
+		NormalCount += Chunk.NormalList.size();
+		TexCoordCount += Chunk.TexCoordList.size();
+	}
+
+	OutObjInfo->VertexList.reserve(OutObjInfo->VertexList.size() + VertexCount);
+	OutObjInfo->NormalList.reserve(OutObjInfo->NormalList.size() + NormalCount);
+	OutObjInfo->TexCoordList.reserve(OutObjInfo->TexCoordList.size() + TexCoordCount);
+	for (const FObjChunk& Chunk : Chunks)
+	{
+		OutObjInfo->VertexList.insert(OutObjInfo->VertexList.end(), Chunk.VertexList.begin(), Chunk.VertexList.end());
+		OutObjInfo->NormalList.insert(OutObjInfo->NormalList.end(), Chunk.NormalList.begin(), Chunk.NormalList.end());
+		OutObjInfo->TexCoordList.insert(OutObjInfo->TexCoordList.end(), Chunk.TexCoordList.begin(), Chunk.TexCoordList.end());
+	}
+
+	/** #4. Replay objects, groups, materials and face runs in file order with the running face count */
+	TOptional<FObjectInfo> OptObjectInfo;
+	size_t FaceCount = 0;
+
+	auto EnsureObject = [&OptObjectInfo, &Config]()
+	{
+		if (!OptObjectInfo)
+		{
+			OptObjectInfo.emplace();
+			OptObjectInfo->Name = Config.DefaultName;
+		}
+	};
+
+	for (const FObjChunk& Chunk : Chunks)
+	{
+		size_t VertexIndexBegin = 0;
+		size_t TexCoordIndexBegin = 0;
+		size_t NormalIndexBegin = 0;
+
+		for (const FObjEvent& Event : Chunk.Events)
+		{
+			switch (Event.Type)
+			{
+			case EObjEventType::Faces:
+				EnsureObject();
+				OptObjectInfo->VertexIndexList.insert(OptObjectInfo->VertexIndexList.end(),
+					Chunk.VertexIndexList.begin() + VertexIndexBegin, Chunk.VertexIndexList.begin() + Event.VertexIndexEnd);
+				OptObjectInfo->TexCoordIndexList.insert(OptObjectInfo->TexCoordIndexList.end(),
+					Chunk.TexCoordIndexList.begin() + TexCoordIndexBegin, Chunk.TexCoordIndexList.begin() + Event.TexCoordIndexEnd);
+				OptObjectInfo->NormalIndexList.insert(OptObjectInfo->NormalIndexList.end(),
+					Chunk.NormalIndexList.begin() + NormalIndexBegin, Chunk.NormalIndexList.begin() + Event.NormalIndexEnd);
+				VertexIndexBegin = Event.VertexIndexEnd;
+				TexCoordIndexBegin = Event.TexCoordIndexEnd;
+				NormalIndexBegin = Event.NormalIndexEnd;
+				FaceCount += Event.FaceCount;
+				break;
+
+			case EObjEventType::Object:
+				if (OptObjectInfo)
+				{
+					OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
+				}
+				OptObjectInfo.emplace();
+				OptObjectInfo->Name = FString(Event.Name);
+				FaceCount = 0;
+				break;
+
+			case EObjEventType::Group:
+				EnsureObject();
+				OptObjectInfo->GroupNameList.emplace_back(Event.Name);
+				OptObjectInfo->GroupIndexList.emplace_back(FaceCount);
+				break;
+
+			case EObjEventType::Material:
+				EnsureObject();
+				OptObjectInfo->MaterialNameList.emplace_back(Event.Name);
+				OptObjectInfo->MaterialIndexList.emplace_back(FaceCount);
+				break;
+
+			case EObjEventType::MaterialLibrary:
+			{
+				std::filesystem::path MaterialFilePath = FilePath.parent_path() / FString(Event.Name);
+				MaterialFilePath = std::filesystem::weakly_canonical(MaterialFilePath);
+				OutObjInfo->MaterialFileList.emplace_back(MaterialFilePath.generic_string());
+
+				if (!LoadMaterial(MaterialFilePath, OutObjInfo))
+				{
+					UE_LOG_ERROR("머티리얼을 불러오는데 실패했습니다: %s", MaterialFilePath.string().c_str());
+					return false;
+				}
+				break;
+			}
+
+			case EObjEventType::Error:
+				UE_LOG_ERROR("%s", Event.ErrorMessage);
+				return false;
+			}
+		}
+	}
+
+	if (OptObjectInfo)
+	{
+		OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
+	}
+
+	return true;
+}
+
+void FObjImporter::ParseObjChunk(const char* Begin, const char* End, const Configuration& Config, FObjChunk& OutChunk)
+{
+	auto AddEvent = [&OutChunk](EObjEventType InType, std::string_view InName = {}, const char* InErrorMessage = nullptr)
+	{
+		FObjEvent Event = {};
+		Event.Type = InType;
+		Event.Name = InName;
+		Event.ErrorMessage = InErrorMessage;
+		OutChunk.Events.push_back(Event);
+	};
+
+	const char* LineBegin = Begin;
+	while (LineBegin < End)
+	{
+		const char* LineEnd = static_cast<const char*>(memchr(LineBegin, '\n', static_cast<size_t>(End - LineBegin)));
+		if (!LineEnd)
+		{
+			LineEnd = End;
+		}
+
+		const char* Cursor = LineBegin;
+		LineBegin = LineEnd + 1;
+
+		const std::string_view Prefix = ReadToken(Cursor, LineEnd);
+
+		// ========================== Vertex Information ============================ //
+
+		if (Prefix == "v")
+		{
+			FVector Position;
+			if (!ReadFloat(Cursor, LineEnd, Position.X) || !ReadFloat(Cursor, LineEnd, Position.Y) || !ReadFloat(Cursor, LineEnd, Position.Z))
+			{
+				AddEvent(EObjEventType::Error, {}, "정점 위치 형식이 잘못되었습니다");
+				return;
+			}
+			OutChunk.VertexList.emplace_back(Config.bPositionToUEBasis ? PositionToUEBasis(Position) : Position);
+		}
+		else if (Prefix == "vn")
+		{
+			FVector Normal;
+			if (!ReadFloat(Cursor, LineEnd, Normal.X) || !ReadFloat(Cursor, LineEnd, Normal.Y) || !ReadFloat(Cursor, LineEnd, Normal.Z))
+			{
+				AddEvent(EObjEventType::Error, {}, "정점 법선 형식이 잘못되었습니다");
+				return;
+			}
+			OutChunk.NormalList.emplace_back(Config.bNormalToUEBasis ? NormalToUEBasis(Normal) : Normal);
+		}
+		else if (Prefix == "vt")
+		{
+			FVector2 TexCoord;
+			if (!ReadFloat(Cursor, LineEnd, TexCoord.X) || !ReadFloat(Cursor, LineEnd, TexCoord.Y))
+			{
+				AddEvent(EObjEventType::Error, {}, "정점 텍스쳐 좌표 형식이 잘못되었습니다");
+				return;
+			}
+			OutChunk.TexCoordList.emplace_back(Config.bUVToUEBasis ? UVToUEBasis(TexCoord) : TexCoord);
+		}
+
+		// =========================== Group Information ============================ //
+
+		else if (Prefix == "o")
+		{
+			if (!Config.bIsObjectEnabled)
+			{
+				continue;
+			}
+
+			const std::string_view ObjectName = ReadToken(Cursor, LineEnd);
+			if (ObjectName.empty())
+			{
+				AddEvent(EObjEventType::Error, {}, "오브젝트 이름 형식이 잘못되었습니다");
+				return;
+			}
+			AddEvent(EObjEventType::Object, ObjectName);
+		}
+		else if (Prefix == "g")
+		{
+			const std::string_view GroupName = ReadToken(Cursor, LineEnd);
+			if (GroupName.empty())
+			{
+				AddEvent(EObjEventType::Error, {}, "잘못된 그룹 이름 형식입니다");
+				return;
+			}
+			AddEvent(EObjEventType::Group, GroupName);
+		}
+
+		// ============================ Face Information ============================ //
+
+		else if (Prefix == "f")
+		{
+			OutChunk.FaceTokens.clear();
+			for (std::string_view Token = ReadToken(Cursor, LineEnd); !Token.empty(); Token = ReadToken(Cursor, LineEnd))
+			{
+				OutChunk.FaceTokens.push_back(Token);
+			}
+
+			if (OutChunk.FaceTokens.size() < 2)
+			{
+				AddEvent(EObjEventType::Error, {}, "면 형식이 잘못되었습니다");
+				return;
+			}
+
+			/** A two-corner face yields no triangle and therefore parses no corner, as in the line-by-line path */
+			OutChunk.FaceCorners.clear();
+			if (OutChunk.FaceTokens.size() >= 3)
+			{
+				for (const std::string_view& Token : OutChunk.FaceTokens)
+				{
+					FObjCorner Corner;
+					if (const char* ErrorMessage = ParseCorner(Token, Corner))
+					{
+						AddEvent(EObjEventType::Error, {}, ErrorMessage);
+						return;
+					}
+					OutChunk.FaceCorners.push_back(Corner);
+				}
+			}
+
+			auto AddCorner = [&OutChunk](const FObjCorner& InCorner)
+			{
+				OutChunk.VertexIndexList.push_back(InCorner.VertexIndex);
+				if (InCorner.bHasTexCoord)
+				{
+					OutChunk.TexCoordIndexList.push_back(InCorner.TexCoordIndex);
+				}
+				if (InCorner.bHasNormal)
+				{
+					OutChunk.NormalIndexList.push_back(InCorner.NormalIndex);
+				}
+			};
+
+			size_t TriangleCount = 0;
+			for (size_t i = 1; i + 1 < OutChunk.FaceCorners.size(); ++i)
+			{
+				AddCorner(OutChunk.FaceCorners[0]);
+				AddCorner(OutChunk.FaceCorners[Config.bFlipWindingOrder ? i + 1 : i]);
+				AddCorner(OutChunk.FaceCorners[Config.bFlipWindingOrder ? i : i + 1]);
+				++TriangleCount;
+			}
+
+			/** Consecutive face lines form one run so the merge appends them in bulk */
+			if (OutChunk.Events.empty() || OutChunk.Events.back().Type != EObjEventType::Faces)
+			{
+				AddEvent(EObjEventType::Faces);
+			}
+
+			FObjEvent& Run = OutChunk.Events.back();
+			Run.FaceCount += TriangleCount;
+			Run.VertexIndexEnd = OutChunk.VertexIndexList.size();
+			Run.TexCoordIndexEnd = OutChunk.TexCoordIndexList.size();
+			Run.NormalIndexEnd = OutChunk.NormalIndexList.size();
+		}
+
+		// ============================ Material Information ============================ //
+
+		else if (Prefix == "mtllib")
+		{
+			AddEvent(EObjEventType::MaterialLibrary, ReadToken(Cursor, LineEnd));
+		}
+		else if (Prefix == "usemtl")
+		{
+			AddEvent(EObjEventType::Material, ReadToken(Cursor, LineEnd));
+		}
+	}
+}
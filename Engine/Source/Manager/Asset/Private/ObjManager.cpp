@@ -4,6 +4,11 @@
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Asset/Public/ObjImporter.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Asset/Public/MeshletBuilder.h"
+#include "Manager/Asset/Public/MeshOptimizer.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
+#include "Manager/Asset/Public/StaticMeshCache.h"
+#include "Manager/Asset/Public/VertexQuantizer.h"
 #include "Texture/Public/Material.h"
 #include "Texture/Public/Texture.h"
 #include <filesystem>
@@ -162,9 +167,35 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		return Iter->second.get();
 	}
 
+	std::unique_ptr<FStaticMesh> StaticMesh = ImportStaticMesh(PathFileName, Config);
+	if (!StaticMesh)
+	{
+		return nullptr;
+	}
+
+	FStaticMesh* Result = StaticMesh.get();
+	ObjFStaticMeshMap.emplace(PathFileName, std::move(StaticMesh));
+	return Result;
+}
+
+std::unique_ptr<FStaticMesh> FObjManager::ImportStaticMesh(const FName& PathFileName, const FObjImporter::Configuration& Config)
+{
+	const std::filesystem::path SourcePath = PathFileName.ToString();
+
+	/** #0. 원본과 일치하는 쿠킹 캐시가 있으면 파싱과 빌드를 모두 건너뜀 */
+	if (Config.bIsBinaryEnabled)
+	{
+		auto CachedMesh = std::make_unique<FStaticMesh>();
+		if (FStaticMeshCache::Load(SourcePath, Config, *CachedMesh))
+		{
+			CachedMesh->PathFileName = PathFileName;
+			return CachedMesh;
+		}
+	}
+
 	/** #1. '.obj' 파일로부터 오브젝트 정보를 로드 */
 	FObjInfo ObjInfo;
-	if (!FObjImporter::LoadObj(PathFileName.ToString(), &ObjInfo, Config))
+	if (!FObjImporter::LoadObj(SourcePath, &ObjInfo, Config))
 	{
 		UE_LOG_ERROR("파일 정보를 읽어오는데 실패했습니다: %s", PathFileName.ToString());
 		return nullptr;
@@ -374,10 +405,90 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		}
 	}
 
-	// StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축
-	ObjFStaticMeshMap.emplace(PathFileName, std::move(StaticMesh));
+	/** #4.2. 섹션별 정점 캐시/오버드로 순서로 인덱스를 재배치하고 정점을 처음 쓰이는 순서로 정렬 (BVH는 이 순서로 만든다) */
+	if (Config.bIsMeshOptimizationEnabled)
+	{
+		const uint32 VertexCount = static_cast<uint32>(StaticMesh->Vertices.size());
+		const FVertexCacheStatistics Before = FMeshOptimizer::AnalyzeVertexCache(StaticMesh->Indices.data(), StaticMesh->Indices.size(), VertexCount);
+
+		FScopeCycleCounter OptimizeCounter;
+		FMeshOptimizer::Optimize(*StaticMesh);
+		const double OptimizeMilliseconds = OptimizeCounter.Finish();
+
+		const FVertexCacheStatistics After = FMeshOptimizer::AnalyzeVertexCache(StaticMesh->Indices.data(), StaticMesh->Indices.size(), VertexCount);
+		UE_LOG("ObjManager: 메시 최적화 %s | ACMR %.3f -> %.3f | ATVR %.3f -> %.3f | %.3fms",
+			PathFileName.ToString().c_str(), Before.ACMR, After.ACMR, Before.ATVR, After.ATVR, OptimizeMilliseconds);
+	}
+
+	/**
+	 * #4.3. LOD0 섹션을 최적화된 순서에서 메시렛으로 나누고 경계 구와 노멀 콘을 구한 뒤,
+	 * 메시렛 안에서 캐시/오버드로 순서와 정점 순서를 다시 잡는다 (정점 번호가 바뀌므로 LOD 생성 전)
+	 */
+	if (Config.bIsMeshletEnabled)
+	{
+		const uint32 VertexCount = static_cast<uint32>(StaticMesh->Vertices.size());
+		const FVertexCacheStatistics Before = FMeshOptimizer::AnalyzeVertexCache(StaticMesh->Indices.data(), StaticMesh->Indices.size(), VertexCount);
 
-	return ObjFStaticMeshMap[PathFileName].get();
+		FScopeCycleCounter MeshletCounter;
+		FMeshletBuilder::BuildMeshlets(*StaticMesh);
+		if (Config.bIsMeshOptimizationEnabled)
+		{
+			FMeshOptimizer::OptimizeMeshlets(*StaticMesh);
+		}
+		const double MeshletMilliseconds = MeshletCounter.Finish();
+
+		if (!StaticMesh->Meshlets.empty())
+		{
+			const FVertexCacheStatistics After = FMeshOptimizer::AnalyzeVertexCache(StaticMesh->Indices.data(), StaticMesh->Indices.size(), VertexCount);
+			UE_LOG("ObjManager: 메시렛 생성 %s | %zu meshlets | ACMR %.3f -> %.3f | %.3fms",
+				PathFileName.ToString().c_str(), StaticMesh->Meshlets.size(), Before.ACMR, After.ACMR, MeshletMilliseconds);
+		}
+	}
+
+	/** #4.4. 최적화된 LOD0을 단순화해 LOD 체인을 만들고, LOD 인덱스도 섹션별 캐시 순서로 재배치 */
+	if (Config.LODCount > 1)
+	{
+		FScopeCycleCounter LODCounter;
+		FMeshSimplifier::BuildLODs(*StaticMesh, Config.LODCount);
+		if (Config.bIsMeshOptimizationEnabled)
+		{
+			for (const FStaticMeshLOD& LOD : StaticMesh->LODs)
+			{
+				FMeshOptimizer::OptimizeSections(StaticMesh->LODIndices, LOD.Sections, StaticMesh->Vertices, static_cast<uint32>(StaticMesh->Indices.size()));
+			}
+		}
+		const double LODMilliseconds = LODCounter.Finish();
+
+		FString TriangleCounts = std::to_string(StaticMesh->Indices.size() / 3);
+		for (const FStaticMeshLOD& LOD : StaticMesh->LODs)
+		{
+			TriangleCounts += " -> " + std::to_string(LOD.IndexCount / 3);
+		}
+		UE_LOG("ObjManager: LOD 생성 %s | %d LODs | Tris %s | %.3fms",
+			PathFileName.ToString().c_str(), StaticMesh->GetNumLODs(), TriangleCounts.c_str(), LODMilliseconds);
+	}
+
+	StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축 (Binned SAH)
+
+	/** #4.5. 압축 정점 포맷이면 GPU에 올릴 정점을 양자화하고 오차를 남긴다 */
+	if (Config.bIsVertexCompressionEnabled)
+	{
+		FVertexQuantizer::Quantize(*StaticMesh);
+
+		const FVertexQuantizationError Error = FVertexQuantizer::MeasureError(*StaticMesh);
+		UE_LOG("ObjManager: 정점 압축 %s | %zu -> %zu bytes | 위치 오차 %.6f | 노멀 오차 %.4f도 | 탄젠트 오차 %.4f도 | UV 오차 %.6f",
+			PathFileName.ToString().c_str(),
+			StaticMesh->Vertices.size() * sizeof(FNormalVertex), StaticMesh->PackedVertices.size() * sizeof(FPackedNormalVertex),
+			Error.MaxPositionError, Error.MaxNormalErrorDegrees, Error.MaxTangentErrorDegrees, Error.MaxTexCoordError);
+	}
+
+	/** #5. 다음 실행부터는 매핑만으로 읽도록 최종 결과를 쿠킹 */
+	if (Config.bIsBinaryEnabled)
+	{
+		FStaticMeshCache::Save(SourcePath, Config, *StaticMesh, ObjInfo.MaterialFileList);
+	}
+
+	return StaticMesh;
 }
 
 /**
@@ -468,6 +579,31 @@ void FObjManager::CreateMaterialsFromMTL(UStaticMesh* StaticMesh, FStaticMesh* S
 	}
 }
 
+TArray<FString> FObjManager::GetTextureDependencies(const FStaticMesh& StaticMeshAsset, const FName& ObjFilePath)
+{
+	TArray<FString> TexturePaths;
+	std::filesystem::path ObjDirectory = std::filesystem::path(ObjFilePath.ToString()).parent_path();
+
+	for (const FMaterial& MaterialInfo : StaticMeshAsset.MaterialInfo)
+	{
+		for (const FString* TextureMap : { &MaterialInfo.KdMap, &MaterialInfo.KaMap, &MaterialInfo.KsMap, &MaterialInfo.DMap })
+		{
+			if (TextureMap->empty())
+			{
+				continue;
+			}
+
+			FString TexturePathStr = (ObjDirectory / *TextureMap).generic_string();
+			if (std::find(TexturePaths.begin(), TexturePaths.end(), TexturePathStr) == TexturePaths.end())
+			{
+				TexturePaths.emplace_back(std::move(TexturePathStr));
+			}
+		}
+	}
+
+	return TexturePaths;
+}
+
 UStaticMesh* FObjManager::LoadObjStaticMesh(const FName& PathFileName, const FObjImporter::Configuration& Config)
 {
 	// 1) Try AssetManager cache first (non-owning lookup)
@@ -481,18 +617,45 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FName& PathFileName, const FOb
 	FStaticMesh* StaticMeshAsset = FObjManager::LoadObjStaticMeshAsset(PathFileName, Config);
 	if (StaticMeshAsset)
 	{
-		// Create runtime UStaticMesh and register to AssetManager cache (ownership there)
-		UStaticMesh* StaticMesh = new UStaticMesh();
-		StaticMesh->SetStaticMeshAsset(StaticMeshAsset);
+		return CreateStaticMesh(PathFileName, StaticMeshAsset);
+	}
 
-		// Create materials based on MTL information
-		CreateMaterialsFromMTL(StaticMesh, StaticMeshAsset, PathFileName);
+	return nullptr;
+}
 
-		// Register into AssetManager's cache (takes ownership)
-		AssetManager.AddStaticMeshToCache(PathFileName, StaticMesh);
+UStaticMesh* FObjManager::RegisterStaticMesh(const FName& PathFileName, std::unique_ptr<FStaticMesh> StaticMeshAsset)
+{
+	UAssetManager& AssetManager = UAssetManager::GetInstance();
+	if (UStaticMesh* Cached = AssetManager.GetStaticMeshFromCache(PathFileName))
+	{
+		return Cached;
+	}
 
-		return StaticMesh;
+	if (!StaticMeshAsset)
+	{
+		return nullptr;
 	}
 
-	return nullptr;
+	auto Iter = ObjFStaticMeshMap.find(PathFileName);
+	if (Iter == ObjFStaticMeshMap.end())
+	{
+		Iter = ObjFStaticMeshMap.emplace(PathFileName, std::move(StaticMeshAsset)).first;
+	}
+
+	return CreateStaticMesh(PathFileName, Iter->second.get());
+}
+
+UStaticMesh* FObjManager::CreateStaticMesh(const FName& PathFileName, FStaticMesh* StaticMeshAsset)
+{
+	// Create runtime UStaticMesh and register to AssetManager cache (ownership there)
+	UStaticMesh* StaticMesh = new UStaticMesh();
+	StaticMesh->SetStaticMeshAsset(StaticMeshAsset);
+
+	// Create materials based on MTL information
+	CreateMaterialsFromMTL(StaticMesh, StaticMeshAsset, PathFileName);
+
+	// Register into AssetManager's cache (takes ownership)
+	UAssetManager::GetInstance().AddStaticMeshToCache(PathFileName, StaticMesh);
+
+	return StaticMesh;
 }
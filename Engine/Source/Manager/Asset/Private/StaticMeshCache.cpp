@@ -0,0 +1,684 @@
+#include "pch.h"
+
+#include "Manager/Asset/Public/StaticMeshCache.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Core/Public/WindowsMappedFile.h"
+#include "Manager/Asset/Public/MeshletBuilder.h"
+#include "Manager/Asset/Public/MeshOptimizer.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
+#include "Manager/Asset/Public/VertexQuantizer.h"
+#include "Texture/Public/Material.h"
+
+namespace
+{
+	/** @brief 섹션 위치, Offset은 파일 시작 기준 바이트 위치이고 Count는 원소 수 */
+	struct FCacheRange
+	{
+		uint64 Offset;
+		uint64 Count;
+	};
+
+	/** @brief 문자열 테이블 안의 위치 */
+	struct FCacheString
+	{
+		uint32 Offset;
+		uint32 Length;
+	};
+
+	struct FCacheHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 SourceHash;
+		uint64 FileSize;
+
+		FCacheRange Strings;
+		FCacheRange Dependencies;
+		FCacheRange Vertices;
+		FCacheRange PackedVertices;
+		FCacheRange Indices;
+		FCacheRange Sections;
+		FCacheRange Materials;
+		FCacheRange Nodes;
+		FCacheRange TriangleBaseIndices;
+		FCacheRange WideNodes;
+		FCacheRange LeafTriangleVertices;
+		FCacheRange LODIndices;
+		FCacheRange LODSections;
+		FCacheRange LODs;
+		FCacheRange Meshlets;
+
+		int32 RootIndex;
+		int32 LeafCount;
+		int32 MaxDepth;
+		float Cost;
+
+		FVector PackedPositionMin;
+		FVector PackedPositionExtent;
+	};
+
+	/** @brief FMaterial의 FString을 문자열 테이블 위치로 바꾼 레코드 */
+	struct FCacheMaterial
+	{
+		FCacheString Name;
+		FVector Ka;
+		FVector Kd;
+		FVector Ks;
+		FVector Ke;
+		float Ns;
+		float Ni;
+		float D;
+		int32 Illumination;
+		FCacheString KaMap;
+		FCacheString KdMap;
+		FCacheString KsMap;
+		FCacheString NsMap;
+		FCacheString DMap;
+		FCacheString BumpMap;
+	};
+
+	/** @brief FStaticMeshLOD의 섹션 배열을 LODSections 안의 구간으로 바꾼 레코드 */
+	struct FCacheLOD
+	{
+		float ScreenSize;
+		float Error;
+		uint32 FirstIndex;
+		uint32 IndexCount;
+		uint32 FirstSection;
+		uint32 SectionCount;
+	};
+
+	/** @brief 가상 함수 테이블이 있는 FAABB 대신 Min/Max를 풀어 쓴 FNode 레코드 */
+	struct FCacheNode
+	{
+		int32 ObjectIndex;
+		int32 ParentIndex;
+		int32 Child1;
+		int32 Child2;
+		int32 bIsLeaf;
+		FVector Min;
+		FVector Max;
+		int32 FirstTriangle;
+		int32 TriangleCount;
+	};
+
+	/** @brief 매핑된 뷰의 시작은 페이지 경계이므로, 섹션을 FWideNode 정렬에 맞추면 모든 섹션을 포인터로 바로 읽을 수 있다 */
+	constexpr size_t SECTION_ALIGNMENT = alignof(FWideNode);
+
+	/** @brief FNV-1a 64비트 */
+	void HashBytes(uint64& InOutHash, const void* InData, size_t InSize)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(InData);
+		for (size_t Index = 0; Index < InSize; ++Index)
+		{
+			InOutHash ^= Bytes[Index];
+			InOutHash *= 0x100000001B3ULL;
+		}
+	}
+
+	template<typename T>
+	void HashValue(uint64& InOutHash, const T& InValue)
+	{
+		HashBytes(InOutHash, &InValue, sizeof(T));
+	}
+
+	/** @brief 파일 내용 대신 경로, 크기, 수정 시각만 해시해 검증 비용을 파일 크기와 무관하게 유지 */
+	void HashFile(uint64& InOutHash, const FString& InPath)
+	{
+		HashBytes(InOutHash, InPath.data(), InPath.size());
+
+		std::error_code Error;
+		const uintmax_t FileSize = std::filesystem::file_size(InPath, Error);
+		HashValue(InOutHash, Error ? static_cast<uint64>(-1) : static_cast<uint64>(FileSize));
+
+		const auto WriteTime = std::filesystem::last_write_time(InPath, Error);
+		HashValue(InOutHash, Error ? static_cast<int64>(0) : static_cast<int64>(WriteTime.time_since_epoch().count()));
+	}
+
+	uint64 ComputeSourceHash(const std::filesystem::path& InSourcePath, const FObjImporter::Configuration& InConfig,
+		const TArray<FString>& InDependencies)
+	{
+		uint64 Hash = 0xCBF29CE484222325ULL;
+
+		// 캐시를 해석하는 쪽의 레이아웃이 바뀌어도 다시 쿠킹되도록 구조체 크기와 BVH 빌드 파라미터를 함께 넣는다
+		HashValue(Hash, FStaticMeshCache::VERSION);
+		HashValue(Hash, static_cast<uint32>(sizeof(FCacheHeader)));
+		HashValue(Hash, static_cast<uint32>(sizeof(FNormalVertex)));
+		HashValue(Hash, static_cast<uint32>(sizeof(FPackedNormalVertex)));
+		HashValue(Hash, static_cast<uint32>(sizeof(FMeshSection)));
+		HashValue(Hash, static_cast<uint32>(sizeof(FWideNode)));
+		HashValue(Hash, static_cast<uint32>(sizeof(FMeshlet)));
+		HashValue(Hash, FBVH::SAH_BIN_COUNT);
+		HashValue(Hash, FBVH::MAX_LEAF_TRIANGLES);
+		HashValue(Hash, FMeshOptimizer::CACHE_SIZE);
+		HashValue(Hash, FMeshOptimizer::OVERDRAW_THRESHOLD);
+		HashValue(Hash, FMeshSimplifier::LOD_TRIANGLE_RATIO);
+		HashValue(Hash, FMeshSimplifier::MIN_LOD_REDUCTION);
+		HashValue(Hash, FMeshSimplifier::MIN_LOD_TRIANGLES);
+		HashValue(Hash, FMeshSimplifier::MAX_LOD_ERROR);
+		HashValue(Hash, FMeshSimplifier::REFERENCE_SCREEN_HEIGHT);
+		HashValue(Hash, FMeshSimplifier::MAX_PIXEL_ERROR);
+		HashValue(Hash, FMeshSimplifier::MAX_SCREEN_SIZE_STEP);
+		HashValue(Hash, FMeshletBuilder::MAX_VERTICES);
+		HashValue(Hash, FMeshletBuilder::MAX_TRIANGLES);
+		HashValue(Hash, FMeshletBuilder::CONE_WEIGHT);
+		HashValue(Hash, FMeshletBuilder::MIN_MESH_TRIANGLES);
+
+		HashBytes(Hash, InConfig.DefaultName.data(), InConfig.DefaultName.size());
+		HashValue(Hash, InConfig.bIsObjectEnabled);
+		HashValue(Hash, InConfig.bIsVertexCompressionEnabled);
+		HashValue(Hash, InConfig.bIsMeshOptimizationEnabled);
+		HashValue(Hash, InConfig.LODCount);
+		HashValue(Hash, InConfig.bIsMeshletEnabled);
+		// 메시렛이 켜지면 LOD0 인덱스와 정점 순서가 FMeshOptimizer::OptimizeMeshlets의 결과로 바뀐다
+		HashValue(Hash, InConfig.bIsMeshletEnabled && InConfig.bIsMeshOptimizationEnabled);
+		HashValue(Hash, InConfig.bFlipWindingOrder);
+		HashValue(Hash, InConfig.bPositionToUEBasis);
+		HashValue(Hash, InConfig.bNormalToUEBasis);
+		HashValue(Hash, InConfig.bUVToUEBasis);
+
+		HashFile(Hash, InSourcePath.generic_string());
+		for (const FString& Dependency : InDependencies)
+		{
+			HashFile(Hash, Dependency);
+		}
+		return Hash;
+	}
+
+	/** @brief 헤더 자리를 비워 두고 섹션을 정렬해 이어 붙인 뒤, 마지막에 문자열 테이블과 헤더를 채운다 */
+	class FCacheWriter
+	{
+	public:
+		FCacheWriter()
+		{
+			Blob.resize(sizeof(FCacheHeader));
+		}
+
+		template<typename T>
+		FCacheRange Append(const T* InData, size_t InCount)
+		{
+			Blob.resize((Blob.size() + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT);
+
+			const FCacheRange Range = { Blob.size(), InCount };
+			if (InCount > 0)
+			{
+				Blob.resize(Blob.size() + sizeof(T) * InCount);
+				memcpy(&Blob[Range.Offset], InData, sizeof(T) * InCount);
+			}
+			return Range;
+		}
+
+		template<typename T>
+		FCacheRange Append(const TArray<T>& InArray)
+		{
+			return Append(InArray.data(), InArray.size());
+		}
+
+		FCacheString AddString(const FString& InString)
+		{
+			const FCacheString Result = { static_cast<uint32>(StringTable.size()), static_cast<uint32>(InString.size()) };
+			StringTable.insert(StringTable.end(), InString.begin(), InString.end());
+			return Result;
+		}
+
+		const TArray<uint8>& Finish(FCacheHeader& InOutHeader)
+		{
+			InOutHeader.Strings = Append(StringTable);
+			InOutHeader.FileSize = Blob.size();
+			memcpy(Blob.data(), &InOutHeader, sizeof(FCacheHeader));
+			return Blob;
+		}
+
+	private:
+		TArray<uint8> Blob;
+		TArray<char> StringTable;
+	};
+
+	/** @brief 매핑된 파일에서 섹션을 복사 없이 가리키는 뷰를 꺼낸다, 범위를 벗어나면 bIsValid가 false가 된다 */
+	struct FCacheReader
+	{
+		const uint8* Data;
+		size_t Size;
+		const char* Strings = nullptr;
+		uint64 StringCount = 0;
+		bool bIsValid = true;
+
+		template<typename T>
+		const T* Get(const FCacheRange& InRange)
+		{
+			if (InRange.Count == 0)
+			{
+				return nullptr;
+			}
+
+			if (InRange.Offset % alignof(T) != 0 || InRange.Offset > Size || InRange.Count > (Size - InRange.Offset) / sizeof(T))
+			{
+				bIsValid = false;
+				return nullptr;
+			}
+			return reinterpret_cast<const T*>(Data + InRange.Offset);
+		}
+
+		FString GetString(const FCacheString& InString)
+		{
+			if (static_cast<uint64>(InString.Offset) + InString.Length > StringCount)
+			{
+				bIsValid = false;
+				return FString();
+			}
+			return FString(Strings + InString.Offset, InString.Length);
+		}
+	};
+
+	/**
+	 * @brief 캐시의 BVH가 가리키는 노드, 삼각형 구간이 모두 범위 안에 있는지 검사
+	 * @note 빌드는 DFS 전위 순서로 노드를 배치하므로 자식 인덱스가 부모보다 크지 않으면 순환으로 보고 거부한다
+	 */
+	bool IsCachedBVHValid(const FCacheHeader& InHeader, const FCacheNode* InNodes, const int32* InTriangleBaseIndices,
+		const FWideNode* InWideNodes)
+	{
+		const int64 NodeCount = static_cast<int64>(InHeader.Nodes.Count);
+		const int64 TriangleCount = static_cast<int64>(InHeader.TriangleBaseIndices.Count);
+		const int64 WideNodeCount = static_cast<int64>(InHeader.WideNodes.Count);
+
+		if (NodeCount == 0)
+		{
+			return InHeader.RootIndex == -1 && TriangleCount == 0 && WideNodeCount == 0 && InHeader.LeafTriangleVertices.Count == 0;
+		}
+		if (InHeader.RootIndex < 0 || InHeader.RootIndex >= NodeCount || WideNodeCount == 0 ||
+			InHeader.LeafTriangleVertices.Count != InHeader.TriangleBaseIndices.Count * 3)
+		{
+			return false;
+		}
+
+		// 삼각형 시작 위치는 LOD0 인덱스 버퍼 안의 삼각형 경계여야 한다
+		for (int64 Index = 0; Index < TriangleCount; ++Index)
+		{
+			const int32 BaseIndex = InTriangleBaseIndices[Index];
+			if (BaseIndex < 0 || BaseIndex % 3 != 0 || static_cast<uint64>(BaseIndex) + 3 > InHeader.Indices.Count)
+			{
+				return false;
+			}
+		}
+
+		for (int64 Index = 0; Index < NodeCount; ++Index)
+		{
+			const FCacheNode& Node = InNodes[Index];
+			if (Node.ParentIndex < -1 || Node.ParentIndex >= NodeCount)
+			{
+				return false;
+			}
+
+			if (Node.bIsLeaf)
+			{
+				if (Node.Child1 != -1 || Node.Child2 != -1 || Node.TriangleCount <= 0 || Node.FirstTriangle < 0 ||
+					static_cast<int64>(Node.FirstTriangle) + Node.TriangleCount > TriangleCount)
+				{
+					return false;
+				}
+			}
+			else if (Node.Child1 <= Index || Node.Child1 >= NodeCount || Node.Child2 <= Index || Node.Child2 >= NodeCount)
+			{
+				return false;
+			}
+		}
+
+		for (int64 Index = 0; Index < WideNodeCount; ++Index)
+		{
+			const FWideNode& Node = InWideNodes[Index];
+			if (Node.NumChildren < 1 || Node.NumChildren > 4)
+			{
+				return false;
+			}
+
+			for (int32 Slot = 0; Slot < Node.NumChildren; ++Slot)
+			{
+				const int32 ChildIndex = Node.ChildIndex[Slot];
+				const int32 ChildTriangleCount = Node.TriangleCount[Slot];
+				if (ChildTriangleCount > 0)
+				{
+					if (ChildIndex < 0 || static_cast<int64>(ChildIndex) + ChildTriangleCount > TriangleCount)
+					{
+						return false;
+					}
+				}
+				else if (ChildTriangleCount < 0 || ChildIndex <= Index || ChildIndex >= WideNodeCount)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+}
+
+std::filesystem::path FStaticMeshCache::GetCachePath(const std::filesystem::path& InSourcePath)
+{
+	std::filesystem::path CachePath = InSourcePath;
+	CachePath.replace_extension(".meshcache");
+	return CachePath;
+}
+
+bool FStaticMeshCache::Load(const std::filesystem::path& InSourcePath, const FObjImporter::Configuration& InConfig, FStaticMesh& OutStaticMesh)
+{
+	const std::filesystem::path CachePath = GetCachePath(InSourcePath);
+
+	std::error_code Error;
+	if (!std::filesystem::exists(CachePath, Error) || !std::filesystem::exists(InSourcePath, Error))
+	{
+		return false;
+	}
+
+	FWindowsMappedFile File;
+	if (!File.Open(CachePath) || File.GetSize() < sizeof(FCacheHeader))
+	{
+		UE_LOG_WARNING("메시 캐시를 열지 못했습니다: %s", CachePath.string().c_str());
+		return false;
+	}
+
+	FCacheHeader Header;
+	memcpy(&Header, File.GetData(), sizeof(FCacheHeader));
+	if (Header.Magic != MAGIC || Header.Version != VERSION || Header.FileSize != File.GetSize())
+	{
+		UE_LOG("메시 캐시 버전이 다릅니다. 다시 쿠킹합니다: %s", CachePath.string().c_str());
+		return false;
+	}
+
+	FCacheReader Reader = { File.GetData(), File.GetSize() };
+	Reader.Strings = Reader.Get<char>(Header.Strings);
+	Reader.StringCount = Header.Strings.Count;
+
+	const FCacheString* Dependencies = Reader.Get<FCacheString>(Header.Dependencies);
+	TArray<FString> DependencyList;
+	DependencyList.reserve(Header.Dependencies.Count);
+	for (uint64 Index = 0; Reader.bIsValid && Index < Header.Dependencies.Count; ++Index)
+	{
+		DependencyList.emplace_back(Reader.GetString(Dependencies[Index]));
+	}
+
+	const FNormalVertex* Vertices = Reader.Get<FNormalVertex>(Header.Vertices);
+	const FPackedNormalVertex* PackedVertices = Reader.Get<FPackedNormalVertex>(Header.PackedVertices);
+	const uint32* Indices = Reader.Get<uint32>(Header.Indices);
+	const FMeshSection* Sections = Reader.Get<FMeshSection>(Header.Sections);
+	const FCacheMaterial* Materials = Reader.Get<FCacheMaterial>(Header.Materials);
+	const FCacheNode* Nodes = Reader.Get<FCacheNode>(Header.Nodes);
+	const int32* TriangleBaseIndices = Reader.Get<int32>(Header.TriangleBaseIndices);
+	const FWideNode* WideNodes = Reader.Get<FWideNode>(Header.WideNodes);
+	const FVector* LeafTriangleVertices = Reader.Get<FVector>(Header.LeafTriangleVertices);
+	const uint32* LODIndices = Reader.Get<uint32>(Header.LODIndices);
+	const FMeshSection* LODSections = Reader.Get<FMeshSection>(Header.LODSections);
+	const FCacheLOD* LODs = Reader.Get<FCacheLOD>(Header.LODs);
+	const FMeshlet* Meshlets = Reader.Get<FMeshlet>(Header.Meshlets);
+	if (!Reader.bIsValid)
+	{
+		UE_LOG_WARNING("메시 캐시가 손상되었습니다. 다시 쿠킹합니다: %s", CachePath.string().c_str());
+		return false;
+	}
+
+	if (ComputeSourceHash(InSourcePath, InConfig, DependencyList) != Header.SourceHash)
+	{
+		UE_LOG("메시 캐시가 원본과 다릅니다. 다시 쿠킹합니다: %s", CachePath.string().c_str());
+		return false;
+	}
+
+	// 렌더러가 그대로 GPU 버퍼로 올리는 인덱스와 섹션은 범위를 한 번 더 확인
+	if (Header.PackedVertices.Count != 0 && Header.PackedVertices.Count != Header.Vertices.Count)
+	{
+		UE_LOG_WARNING("메시 캐시의 압축 정점 수가 잘못되었습니다: %s", CachePath.string().c_str());
+		return false;
+	}
+	for (uint64 Index = 0; Index < Header.Indices.Count; ++Index)
+	{
+		if (Indices[Index] >= Header.Vertices.Count)
+		{
+			UE_LOG_WARNING("메시 캐시의 인덱스가 잘못되었습니다: %s", CachePath.string().c_str());
+			return false;
+		}
+	}
+	for (uint64 Index = 0; Index < Header.Sections.Count; ++Index)
+	{
+		if (static_cast<uint64>(Sections[Index].StartIndex) + Sections[Index].IndexCount > Header.Indices.Count)
+		{
+			UE_LOG_WARNING("메시 캐시의 섹션이 잘못되었습니다: %s", CachePath.string().c_str());
+			return false;
+		}
+	}
+
+	// LOD 구간은 Indices 뒤에 LODIndices를 이어 붙인 GPU 인덱스 버퍼 기준
+	const uint64 BufferIndexCount = Header.Indices.Count + Header.LODIndices.Count;
+	for (uint64 Index = 0; Index < Header.LODIndices.Count; ++Index)
+	{
+		if (LODIndices[Index] >= Header.Vertices.Count)
+		{
+			UE_LOG_WARNING("메시 캐시의 LOD 인덱스가 잘못되었습니다: %s", CachePath.string().c_str());
+			return false;
+		}
+	}
+	for (uint64 Index = 0; Index < Header.LODSections.Count; ++Index)
+	{
+		if (static_cast<uint64>(LODSections[Index].StartIndex) + LODSections[Index].IndexCount > BufferIndexCount)
+		{
+			UE_LOG_WARNING("메시 캐시의 LOD 섹션이 잘못되었습니다: %s", CachePath.string().c_str());
+			return false;
+		}
+	}
+	for (uint64 Index = 0; Index < Header.LODs.Count; ++Index)
+	{
+		if (static_cast<uint64>(LODs[Index].FirstIndex) + LODs[Index].IndexCount > BufferIndexCount ||
+			static_cast<uint64>(LODs[Index].FirstSection) + LODs[Index].SectionCount > Header.LODSections.Count)
+		{
+			UE_LOG_WARNING("메시 캐시의 LOD가 잘못되었습니다: %s", CachePath.string().c_str());
+			return false;
+		}
+	}
+
+	// 메시렛은 LOD0 인덱스 구간, 섹션 없는 메시는 섹션 0 하나로 본다
+	for (uint64 Index = 0; Index < Header.Meshlets.Count; ++Index)
+	{
+		if (static_cast<uint64>(Meshlets[Index].FirstIndex) + Meshlets[Index].IndexCount > Header.Indices.Count ||
+			Meshlets[Index].SectionIndex >= std::max<uint64>(Header.Sections.Count, 1))
+		{
+			UE_LOG_WARNING("메시 캐시의 메시렛이 잘못되었습니다: %s", CachePath.string().c_str());
+			return false;
+		}
+	}
+
+	if (!IsCachedBVHValid(Header, Nodes, TriangleBaseIndices, WideNodes))
+	{
+		UE_LOG_WARNING("메시 캐시의 BVH가 잘못되었습니다: %s", CachePath.string().c_str());
+		return false;
+	}
+
+	OutStaticMesh.Vertices.assign(Vertices, Vertices + Header.Vertices.Count);
+	OutStaticMesh.PackedVertices.assign(PackedVertices, PackedVertices + Header.PackedVertices.Count);
+	OutStaticMesh.PackedPositionMin = Header.PackedPositionMin;
+	OutStaticMesh.PackedPositionExtent = Header.PackedPositionExtent;
+	OutStaticMesh.PackedPositionToLocal = FVertexQuantizer::MakePositionToLocal(Header.PackedPositionMin, Header.PackedPositionExtent);
+	OutStaticMesh.Indices.assign(Indices, Indices + Header.Indices.Count);
+	OutStaticMesh.Sections.assign(Sections, Sections + Header.Sections.Count);
+	OutStaticMesh.LODIndices.assign(LODIndices, LODIndices + Header.LODIndices.Count);
+	OutStaticMesh.LODs.resize(Header.LODs.Count);
+	for (uint64 Index = 0; Index < Header.LODs.Count; ++Index)
+	{
+		const FCacheLOD& Source = LODs[Index];
+		FStaticMeshLOD& LOD = OutStaticMesh.LODs[Index];
+		LOD.ScreenSize = Source.ScreenSize;
+		LOD.Error = Source.Error;
+		LOD.FirstIndex = Source.FirstIndex;
+		LOD.IndexCount = Source.IndexCount;
+		LOD.Sections.assign(LODSections + Source.FirstSection, LODSections + Source.FirstSection + Source.SectionCount);
+	}
+	OutStaticMesh.Meshlets.assign(Meshlets, Meshlets + Header.Meshlets.Count);
+
+	OutStaticMesh.MaterialInfo.resize(Header.Materials.Count);
+	for (uint64 Index = 0; Index < Header.Materials.Count; ++Index)
+	{
+		const FCacheMaterial& Source = Materials[Index];
+		FMaterial& Material = OutStaticMesh.MaterialInfo[Index];
+		Material.Name = Reader.GetString(Source.Name);
+		Material.Ka = Source.Ka;
+		Material.Kd = Source.Kd;
+		Material.Ks = Source.Ks;
+		Material.Ke = Source.Ke;
+		Material.Ns = Source.Ns;
+		Material.Ni = Source.Ni;
+		Material.D = Source.D;
+		Material.Illumination = Source.Illumination;
+		Material.KaMap = Reader.GetString(Source.KaMap);
+		Material.KdMap = Reader.GetString(Source.KdMap);
+		Material.KsMap = Reader.GetString(Source.KsMap);
+		Material.NsMap = Reader.GetString(Source.NsMap);
+		Material.DMap = Reader.GetString(Source.DMap);
+		Material.BumpMap = Reader.GetString(Source.BumpMap);
+	}
+
+	FBVH& BVH = OutStaticMesh.BVH;
+	BVH.Mesh = &OutStaticMesh;
+	BVH.Nodes.resize(Header.Nodes.Count);
+	for (uint64 Index = 0; Index < Header.Nodes.Count; ++Index)
+	{
+		const FCacheNode& Source = Nodes[Index];
+		FNode& Node = BVH.Nodes[Index];
+		Node.ObjectIndex = Source.ObjectIndex;
+		Node.ParentIndex = Source.ParentIndex;
+		Node.Child1 = Source.Child1;
+		Node.Child2 = Source.Child2;
+		Node.bIsLeaf = Source.bIsLeaf != 0;
+		Node.Box = FAABB(Source.Min, Source.Max);
+		Node.FirstTriangle = Source.FirstTriangle;
+		Node.TriangleCount = Source.TriangleCount;
+	}
+	BVH.TriangleBaseIndices.assign(TriangleBaseIndices, TriangleBaseIndices + Header.TriangleBaseIndices.Count);
+	BVH.WideNodes.assign(WideNodes, WideNodes + Header.WideNodes.Count);
+	BVH.LeafTriangleVertices.assign(LeafTriangleVertices, LeafTriangleVertices + Header.LeafTriangleVertices.Count);
+	BVH.RootIndex = Header.RootIndex;
+	BVH.LeafCount = Header.LeafCount;
+	BVH.MaxDepth = Header.MaxDepth;
+	BVH.Cost = Header.Cost;
+
+	if (!Reader.bIsValid)
+	{
+		UE_LOG_WARNING("메시 캐시가 손상되었습니다. 다시 쿠킹합니다: %s", CachePath.string().c_str());
+		return false;
+	}
+	return true;
+}
+
+bool FStaticMeshCache::Save(const std::filesystem::path& InSourcePath, const FObjImporter::Configuration& InConfig,
+	const FStaticMesh& InStaticMesh, const TArray<FString>& InDependencies)
+{
+	FCacheWriter Writer;
+	FCacheHeader Header = {};
+	Header.Magic = MAGIC;
+	Header.Version = VERSION;
+	Header.SourceHash = ComputeSourceHash(InSourcePath, InConfig, InDependencies);
+
+	TArray<FCacheString> Dependencies;
+	Dependencies.reserve(InDependencies.size());
+	for (const FString& Dependency : InDependencies)
+	{
+		Dependencies.push_back(Writer.AddString(Dependency));
+	}
+	Header.Dependencies = Writer.Append(Dependencies);
+
+	Header.Vertices = Writer.Append(InStaticMesh.Vertices);
+	Header.PackedVertices = Writer.Append(InStaticMesh.PackedVertices);
+	Header.PackedPositionMin = InStaticMesh.PackedPositionMin;
+	Header.PackedPositionExtent = InStaticMesh.PackedPositionExtent;
+	Header.Indices = Writer.Append(InStaticMesh.Indices);
+	Header.Sections = Writer.Append(InStaticMesh.Sections);
+
+	TArray<FMeshSection> LODSections;
+	TArray<FCacheLOD> LODs;
+	LODs.reserve(InStaticMesh.LODs.size());
+	for (const FStaticMeshLOD& Source : InStaticMesh.LODs)
+	{
+		FCacheLOD LOD = {};
+		LOD.ScreenSize = Source.ScreenSize;
+		LOD.Error = Source.Error;
+		LOD.FirstIndex = Source.FirstIndex;
+		LOD.IndexCount = Source.IndexCount;
+		LOD.FirstSection = static_cast<uint32>(LODSections.size());
+		LOD.SectionCount = static_cast<uint32>(Source.Sections.size());
+		LODSections.insert(LODSections.end(), Source.Sections.begin(), Source.Sections.end());
+		LODs.push_back(LOD);
+	}
+	Header.LODIndices = Writer.Append(InStaticMesh.LODIndices);
+	Header.LODSections = Writer.Append(LODSections);
+	Header.LODs = Writer.Append(LODs);
+	Header.Meshlets = Writer.Append(InStaticMesh.Meshlets);
+
+	TArray<FCacheMaterial> Materials;
+	Materials.reserve(InStaticMesh.MaterialInfo.size());
+	for (const FMaterial& Source : InStaticMesh.MaterialInfo)
+	{
+		FCacheMaterial Material = {};
+		Material.Name = Writer.AddString(Source.Name);
+		Material.Ka = Source.Ka;
+		Material.Kd = Source.Kd;
+		Material.Ks = Source.Ks;
+		Material.Ke = Source.Ke;
+		Material.Ns = Source.Ns;
+		Material.Ni = Source.Ni;
+		Material.D = Source.D;
+		Material.Illumination = Source.Illumination;
+		Material.KaMap = Writer.AddString(Source.KaMap);
+		Material.KdMap = Writer.AddString(Source.KdMap);
+		Material.KsMap = Writer.AddString(Source.KsMap);
+		Material.NsMap = Writer.AddString(Source.NsMap);
+		Material.DMap = Writer.AddString(Source.DMap);
+		Material.BumpMap = Writer.AddString(Source.BumpMap);
+		Materials.push_back(Material);
+	}
+	Header.Materials = Writer.Append(Materials);
+
+	const FBVH& BVH = InStaticMesh.BVH;
+	TArray<FCacheNode> Nodes;
+	Nodes.reserve(BVH.Nodes.size());
+	for (const FNode& Source : BVH.Nodes)
+	{
+		FCacheNode Node = {};
+		Node.ObjectIndex = Source.ObjectIndex;
+		Node.ParentIndex = Source.ParentIndex;
+		Node.Child1 = Source.Child1;
+		Node.Child2 = Source.Child2;
+		Node.bIsLeaf = Source.bIsLeaf ? 1 : 0;
+		Node.Min = Source.Box.Min;
+		Node.Max = Source.Box.Max;
+		Node.FirstTriangle = Source.FirstTriangle;
+		Node.TriangleCount = Source.TriangleCount;
+		Nodes.push_back(Node);
+	}
+	Header.Nodes = Writer.Append(Nodes);
+	Header.TriangleBaseIndices = Writer.Append(BVH.TriangleBaseIndices);
+	Header.WideNodes = Writer.Append(BVH.WideNodes);
+	Header.LeafTriangleVertices = Writer.Append(BVH.LeafTriangleVertices);
+	Header.RootIndex = BVH.RootIndex;
+	Header.LeafCount = BVH.LeafCount;
+	Header.MaxDepth = BVH.MaxDepth;
+	Header.Cost = BVH.Cost;
+
+	const TArray<uint8>& Blob = Writer.Finish(Header);
+
+	const std::filesystem::path CachePath = GetCachePath(InSourcePath);
+	std::filesystem::path TempPath = CachePath;
+	TempPath += ".tmp";
+	{
+		std::ofstream Stream(TempPath, std::ios::binary | std::ios::out | std::ios::trunc);
+		if (!Stream || !Stream.write(reinterpret_cast<const char*>(Blob.data()), static_cast<std::streamsize>(Blob.size())))
+		{
+			UE_LOG_ERROR("메시 캐시를 쓰지 못했습니다: %s", TempPath.string().c_str());
+			return false;
+		}
+	}
+
+	std::error_code Error;
+	std::filesystem::rename(TempPath, CachePath, Error);
+	if (Error)
+	{
+		std::filesystem::remove(TempPath, Error);
+		UE_LOG_ERROR("메시 캐시를 교체하지 못했습니다: %s", CachePath.string().c_str());
+		return false;
+	}
+	return true;
+}
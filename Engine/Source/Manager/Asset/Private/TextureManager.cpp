@@ -4,6 +4,7 @@
 #include "Texture/Public/Texture.h"
 #include <DirectXTK/DDSTextureLoader.h>
 #include <DirectXTK/WICTextureLoader.h>
+#include <wincodec.h>
 
 #include "Manager/Path/Public/PathManager.h"
 
@@ -22,37 +23,69 @@ FTextureManager::~FTextureManager()
 }
 
 UTexture* FTextureManager::LoadTexture(const FName& InFilePath)
+{
+    path AbsolutePath;
+    FName CacheKey = MakeCacheKey(InFilePath, AbsolutePath);
+
+    // Check Cached
+    if (UTexture* CachedTexture = FindCachedTexture(CacheKey))
+    {
+        return CachedTexture;
+    }
+
+    // Not Cached
+    ComPtr<ID3D11ShaderResourceView> SRV = CreateTextureFromFile(AbsolutePath.string());
+    return AddTextureToCache(CacheKey, SRV);
+}
+
+UTexture* FTextureManager::LoadTexture(const FName& InFilePath, const FDecodedTexture& InDecodedTexture)
+{
+    path AbsolutePath;
+    FName CacheKey = MakeCacheKey(InFilePath, AbsolutePath);
+
+    if (UTexture* CachedTexture = FindCachedTexture(CacheKey))
+    {
+        return CachedTexture;
+    }
+
+    ComPtr<ID3D11ShaderResourceView> SRV = CreateTextureFromDecoded(InDecodedTexture);
+    return AddTextureToCache(CacheKey, SRV);
+}
+
+/**
+ * @brief 사용자가 넘긴 경로를 루트 기준 상대 경로의 캐시 키로 정규화
+ * @param OutAbsolutePath 실제 파일을 찾을 때 사용할 절대 경로
+ */
+FName FTextureManager::MakeCacheKey(const FName& InFilePath, path& OutAbsolutePath) const
 {
     // Path 정규화
     path InputPath(InFilePath.ToString());  // 사용자의 원본 입력
-    path AbsolutePath;                            // 실제 파일을 찾을 때 사용할 절대 경로
     path RelativeKeyPath;                         // 캐시맵의 키로 사용할 상대 경로
 
     // 절대 경로 생성
     path RootPath = UPathManager::GetInstance().GetRootPath();
-    InputPath.is_relative() ? AbsolutePath = RootPath / InputPath : AbsolutePath = InputPath;
+    InputPath.is_relative() ? OutAbsolutePath = RootPath / InputPath : OutAbsolutePath = InputPath;
 
     try
     {
-        path CanonicalPath = canonical(AbsolutePath);
+        path CanonicalPath = canonical(OutAbsolutePath);
         RelativeKeyPath = relative(CanonicalPath, RootPath);
     }
     catch (const filesystem::filesystem_error& Error)
     {
         RelativeKeyPath = InputPath;
     }
-    FName CacheKey(RelativeKeyPath.string());
-
-    // Check Cached
-    const auto& It = TextureCaches.find(CacheKey);
-    if (It != TextureCaches.end())
-    {
-        return It->second;
-    }
+    return FName(RelativeKeyPath.string());
+}
 
-    // Not Cached
-    ComPtr<ID3D11ShaderResourceView> SRV = CreateTextureFromFile(AbsolutePath.string());
+UTexture* FTextureManager::FindCachedTexture(const FName& InCacheKey) const
+{
+    const auto& It = TextureCaches.find(InCacheKey);
+    return It != TextureCaches.end() ? It->second : nullptr;
+}
 
+UTexture* FTextureManager::AddTextureToCache(const FName& InCacheKey, const ComPtr<ID3D11ShaderResourceView>& InSRV)
+{
     if (!DefaultSampler)
     {
         DefaultSampler = FRenderResourceFactory::CreateSamplerState(D3D11_FILTER_MIN_MAG_MIP_LINEAR, D3D11_TEXTURE_ADDRESS_WRAP);
@@ -60,15 +93,15 @@ UTexture* FTextureManager::LoadTexture(const FName& InFilePath)
     }
     
     UTexture* Texture = NewObject<UTexture>();
-    Texture->SetFilePath(CacheKey);
-    Texture->CreateRenderProxy(SRV, DefaultSampler);
+    Texture->SetFilePath(InCacheKey);
+    Texture->CreateRenderProxy(InSRV, DefaultSampler);
 
-    if (TextureCaches.find(CacheKey) != TextureCaches.end())
+    if (TextureCaches.find(InCacheKey) != TextureCaches.end())
     {
-        SafeDelete(TextureCaches[CacheKey]);
+        SafeDelete(TextureCaches[InCacheKey]);
     }
 
-    TextureCaches[CacheKey] = Texture;
+    TextureCaches[InCacheKey] = Texture;
     return Texture;
 }
 
@@ -82,9 +115,6 @@ void FTextureManager::LoadAllTexturesFromDirectory(const path& InDirectoryPath)
 
     UE_LOG("[TextureManager] %ls 디렉토리에서 텍스처 로드를 시작합니다...", InDirectoryPath.c_str());
 
-    // 가져올 확장자 목록
-    const TSet<FString> SupportedExtensions = { ".png", ".dds", ".jpg", ".jpeg", ".bmp", ".tiff" };
-
     // 디렉토리의 모든 파일 순회
     for (const auto& Entry : std::filesystem::recursive_directory_iterator(InDirectoryPath))
     {
@@ -92,10 +122,7 @@ void FTextureManager::LoadAllTexturesFromDirectory(const path& InDirectoryPath)
         if (!Entry.is_regular_file()) { continue; }
 
         const path& FilePath = Entry.path();
-        FString Extension = FilePath.extension().string();
-        std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
-
-        if (SupportedExtensions.count(Extension))
+        if (IsSupportedTextureFile(FilePath))
         {
             FName TextureName(FilePath.string());
             UTexture* Texture = LoadTexture(TextureName);
@@ -113,6 +140,16 @@ const TMap<FName, UTexture*>& FTextureManager::GetTextureCache() const
     return TextureCaches;
 }
 
+bool FTextureManager::IsSupportedTextureFile(const path& InFilePath)
+{
+    // 가져올 확장자 목록
+    static const TSet<FString> SupportedExtensions = { ".png", ".dds", ".jpg", ".jpeg", ".bmp", ".tiff" };
+
+    FString Extension = InFilePath.extension().string();
+    std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+    return SupportedExtensions.count(Extension) > 0;
+}
+
 ComPtr<ID3D11ShaderResourceView> FTextureManager::CreateTextureFromFile(const path& InFilePath)
 {
     URenderer& Renderer = URenderer::GetInstance();
@@ -171,3 +208,153 @@ ComPtr<ID3D11ShaderResourceView> FTextureManager::CreateTextureFromFile(const pa
     }
     return SUCCEEDED(ResultHandle) ? TextureSRV : nullptr;
 }
+
+bool FTextureManager::DecodeTextureFile(const path& InFilePath, FDecodedTexture& OutDecodedTexture)
+{
+    OutDecodedTexture = {};
+    OutDecodedTexture.FilePath = InFilePath;
+
+    FString FileExtension = InFilePath.extension().string();
+    transform(FileExtension.begin(), FileExtension.end(), FileExtension.begin(), ::tolower);
+    OutDecodedTexture.bIsDDS = FileExtension == ".dds";
+
+    // 파일 전체를 메모리로 읽기
+    ifstream File(InFilePath, std::ios::binary | std::ios::ate);
+    if (!File)
+    {
+        return false;
+    }
+
+    const streamsize FileSize = File.tellg();
+    if (FileSize <= 0)
+    {
+        return false;
+    }
+
+    TArray<uint8> FileData(static_cast<size_t>(FileSize));
+    File.seekg(0, std::ios::beg);
+    if (!File.read(reinterpret_cast<char*>(FileData.data()), FileSize))
+    {
+        return false;
+    }
+
+    // DDS는 이미 GPU 포맷이므로 업로드 단계에서 메모리로부터 바로 생성
+    if (OutDecodedTexture.bIsDDS)
+    {
+        OutDecodedTexture.Data = std::move(FileData);
+        return true;
+    }
+
+    // PNG, JPG, BMP, TIFF 등은 WIC로 RGBA8 픽셀까지 디코딩
+    const HRESULT InitializeResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+    const bool bShouldUninitialize = SUCCEEDED(InitializeResult);
+
+    bool bIsDecoded = false;
+    {
+        ComPtr<IWICImagingFactory> Factory;
+        ComPtr<IWICStream> Stream;
+        ComPtr<IWICBitmapDecoder> Decoder;
+        ComPtr<IWICBitmapFrameDecode> Frame;
+        ComPtr<IWICFormatConverter> Converter;
+        UINT Width = 0;
+        UINT Height = 0;
+
+        if (SUCCEEDED(CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&Factory))) &&
+            SUCCEEDED(Factory->CreateStream(&Stream)) &&
+            SUCCEEDED(Stream->InitializeFromMemory(FileData.data(), static_cast<DWORD>(FileData.size()))) &&
+            SUCCEEDED(Factory->CreateDecoderFromStream(Stream.Get(), nullptr, WICDecodeMetadataCacheOnDemand, &Decoder)) &&
+            SUCCEEDED(Decoder->GetFrame(0, &Frame)) &&
+            SUCCEEDED(Frame->GetSize(&Width, &Height)) && Width > 0 && Height > 0 &&
+            SUCCEEDED(Factory->CreateFormatConverter(&Converter)) &&
+            SUCCEEDED(Converter->Initialize(Frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone,
+                nullptr, 0.0, WICBitmapPaletteTypeMedianCut)))
+        {
+            const UINT RowPitch = Width * 4;
+            OutDecodedTexture.Data.resize(static_cast<size_t>(RowPitch) * Height);
+            if (SUCCEEDED(Converter->CopyPixels(nullptr, RowPitch, static_cast<UINT>(OutDecodedTexture.Data.size()),
+                OutDecodedTexture.Data.data())))
+            {
+                OutDecodedTexture.Width = Width;
+                OutDecodedTexture.Height = Height;
+                bIsDecoded = true;
+            }
+        }
+    }
+
+    if (bShouldUninitialize)
+    {
+        CoUninitialize();
+    }
+
+    if (!bIsDecoded)
+    {
+        OutDecodedTexture.Data.clear();
+    }
+    return bIsDecoded;
+}
+
+/**
+ * @brief 디코딩된 데이터로 SRV 생성, WIC 로더와 같이 RGBA8 텍스처에 밉맵을 자동 생성한다
+ */
+ComPtr<ID3D11ShaderResourceView> FTextureManager::CreateTextureFromDecoded(const FDecodedTexture& InDecodedTexture)
+{
+    URenderer& Renderer = URenderer::GetInstance();
+    ID3D11Device* Device = Renderer.GetDevice();
+    ID3D11DeviceContext* DeviceContext = Renderer.GetDeviceContext();
+
+    if (!Device || !DeviceContext)
+    {
+        UE_LOG_ERROR("TextureManager: Texture 생성 실패 - Device 또는 DeviceContext가 null입니다");
+        return nullptr;
+    }
+
+    if (InDecodedTexture.Data.empty())
+    {
+        UE_LOG_ERROR("TextureManager: 디코딩된 데이터가 없습니다 - %ls", InDecodedTexture.FilePath.c_str());
+        return nullptr;
+    }
+
+    ComPtr<ID3D11ShaderResourceView> TextureSRV = nullptr;
+
+    // DDS
+    if (InDecodedTexture.bIsDDS)
+    {
+        HRESULT ResultHandle = DirectX::CreateDDSTextureFromMemory(Device, DeviceContext,
+            InDecodedTexture.Data.data(), InDecodedTexture.Data.size(), nullptr, TextureSRV.GetAddressOf());
+        if (FAILED(ResultHandle))
+        {
+            UE_LOG_ERROR("TextureManager: DDS 텍스처 로드 실패 - %ls (HRESULT: 0x%08lX)", InDecodedTexture.FilePath.c_str(), ResultHandle);
+            return nullptr;
+        }
+        return TextureSRV;
+    }
+
+    // WIC로 디코딩한 RGBA8 픽셀
+    D3D11_TEXTURE2D_DESC TextureDesc = {};
+    TextureDesc.Width = InDecodedTexture.Width;
+    TextureDesc.Height = InDecodedTexture.Height;
+    TextureDesc.MipLevels = 0;
+    TextureDesc.ArraySize = 1;
+    TextureDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    TextureDesc.SampleDesc.Count = 1;
+    TextureDesc.Usage = D3D11_USAGE_DEFAULT;
+    TextureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+    TextureDesc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
+
+    ComPtr<ID3D11Texture2D> Texture;
+    HRESULT ResultHandle = Device->CreateTexture2D(&TextureDesc, nullptr, Texture.GetAddressOf());
+    if (SUCCEEDED(ResultHandle))
+    {
+        ResultHandle = Device->CreateShaderResourceView(Texture.Get(), nullptr, TextureSRV.GetAddressOf());
+    }
+
+    if (FAILED(ResultHandle))
+    {
+        UE_LOG_ERROR("TextureManager: WIC 텍스처 로드 실패 - %ls (HRESULT: 0x%08lX)", InDecodedTexture.FilePath.c_str(), ResultHandle);
+        return nullptr;
+    }
+
+    DeviceContext->UpdateSubresource(Texture.Get(), 0, nullptr, InDecodedTexture.Data.data(), InDecodedTexture.Width * 4, 0);
+    DeviceContext->GenerateMips(TextureSRV.Get());
+    return TextureSRV;
+}
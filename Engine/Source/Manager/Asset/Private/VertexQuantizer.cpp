@@ -0,0 +1,269 @@
+#include "pch.h"
+#include "Manager/Asset/Public/VertexQuantizer.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+
+namespace
+{
+	constexpr float UNORM16_MAX = 65535.0f;
+	constexpr float SNORM16_MAX = 32767.0f;
+
+	float SignNotZero(float InValue)
+	{
+		return InValue >= 0.0f ? 1.0f : -1.0f;
+	}
+
+	float AngleDegrees(const FVector& InA, const FVector& InB)
+	{
+		const float LengthA = InA.Length();
+		const float LengthB = InB.Length();
+		if (LengthA < 1e-6f || LengthB < 1e-6f)
+		{
+			return 0.0f;
+		}
+
+		// acos는 1 근처에서 float 정밀도가 부족해 0.01도 단위 오차를 가리므로 atan2로 잰다
+		return std::atan2(InA.Cross(InB).Length(), InA.Dot(InB)) * ToDeg;
+	}
+
+	/** @brief 엔진 FVector::Cross 규약의 N x T, FObjManager가 바이텐전트를 만드는 식과 같다 */
+	FVector BitangentFrom(const FVector& InNormal, const FVector& InTangent, float InSign)
+	{
+		FVector Bitangent = InNormal.Cross(InTangent);
+		const float Length = Bitangent.Length();
+		return Length > 1e-6f ? Bitangent * (InSign / Length) : Bitangent;
+	}
+}
+
+void FVertexQuantizer::Quantize(FStaticMesh& InOutStaticMesh)
+{
+	const TArray<FNormalVertex>& Vertices = InOutStaticMesh.Vertices;
+	InOutStaticMesh.PackedVertices.clear();
+	if (Vertices.empty())
+	{
+		return;
+	}
+
+	FVector Min = Vertices[0].Position;
+	FVector Max = Vertices[0].Position;
+	for (const FNormalVertex& Vertex : Vertices)
+	{
+		Min = FVector(std::min(Min.X, Vertex.Position.X), std::min(Min.Y, Vertex.Position.Y), std::min(Min.Z, Vertex.Position.Z));
+		Max = FVector(std::max(Max.X, Vertex.Position.X), std::max(Max.Y, Vertex.Position.Y), std::max(Max.Z, Vertex.Position.Z));
+	}
+	const FVector Extent = Max - Min;
+
+	// 범위가 0인 축은 모두 0으로 저장하고 Min만으로 복원한다
+	const FVector InverseExtent(
+		Extent.X > 0.0f ? UNORM16_MAX / Extent.X : 0.0f,
+		Extent.Y > 0.0f ? UNORM16_MAX / Extent.Y : 0.0f,
+		Extent.Z > 0.0f ? UNORM16_MAX / Extent.Z : 0.0f);
+
+	auto QuantizeUnorm = [](float InValue)
+	{
+		return static_cast<uint16>(std::clamp(std::lround(InValue), 0L, 65535L));
+	};
+
+	InOutStaticMesh.PackedVertices.resize(Vertices.size());
+	for (size_t Index = 0; Index < Vertices.size(); ++Index)
+	{
+		const FNormalVertex& Source = Vertices[Index];
+		FPackedNormalVertex& Packed = InOutStaticMesh.PackedVertices[Index];
+
+		const FVector Offset = Source.Position - Min;
+		Packed.Position[0] = QuantizeUnorm(Offset.X * InverseExtent.X);
+		Packed.Position[1] = QuantizeUnorm(Offset.Y * InverseExtent.Y);
+		Packed.Position[2] = QuantizeUnorm(Offset.Z * InverseExtent.Z);
+
+		// 바이텐전트는 N x T와 같은 방향인지만 남긴다
+		const bool bIsBitangentPositive = Source.Normal.Cross(Source.Tangent).Dot(Source.Bitangent) >= 0.0f;
+		Packed.Position[3] = bIsBitangentPositive ? 65535 : 0;
+
+		EncodeOctahedral(Source.Normal, Packed.Normal);
+		EncodeOctahedral(Source.Tangent, Packed.Tangent);
+
+		Packed.TexCoord[0] = FloatToHalf(Source.TexCoord.X);
+		Packed.TexCoord[1] = FloatToHalf(Source.TexCoord.Y);
+	}
+
+	InOutStaticMesh.PackedPositionMin = Min;
+	InOutStaticMesh.PackedPositionExtent = Extent;
+	InOutStaticMesh.PackedPositionToLocal = MakePositionToLocal(Min, Extent);
+}
+
+FMatrix FVertexQuantizer::MakePositionToLocal(const FVector& InPositionMin, const FVector& InPositionExtent)
+{
+	return FMatrix::ScaleMatrix(InPositionExtent) * FMatrix::TranslationMatrix(InPositionMin);
+}
+
+FNormalVertex FVertexQuantizer::Dequantize(const FPackedNormalVertex& InPacked, const FVector& InPositionMin, const FVector& InPositionExtent)
+{
+	FNormalVertex Vertex = {};
+	Vertex.Position = FVector(
+		InPositionMin.X + InPacked.Position[0] / UNORM16_MAX * InPositionExtent.X,
+		InPositionMin.Y + InPacked.Position[1] / UNORM16_MAX * InPositionExtent.Y,
+		InPositionMin.Z + InPacked.Position[2] / UNORM16_MAX * InPositionExtent.Z);
+	Vertex.Normal = DecodeOctahedral(InPacked.Normal);
+	Vertex.Tangent = DecodeOctahedral(InPacked.Tangent);
+	Vertex.Bitangent = BitangentFrom(Vertex.Normal, Vertex.Tangent, InPacked.Position[3] >= 32768 ? 1.0f : -1.0f);
+	Vertex.TexCoord = FVector2(HalfToFloat(InPacked.TexCoord[0]), HalfToFloat(InPacked.TexCoord[1]));
+	return Vertex;
+}
+
+FVertexQuantizationError FVertexQuantizer::MeasureError(const FStaticMesh& InStaticMesh)
+{
+	FVertexQuantizationError Error;
+	if (InStaticMesh.PackedVertices.size() != InStaticMesh.Vertices.size())
+	{
+		return Error;
+	}
+
+	for (size_t Index = 0; Index < InStaticMesh.Vertices.size(); ++Index)
+	{
+		const FNormalVertex& Source = InStaticMesh.Vertices[Index];
+		const FNormalVertex Decoded = Dequantize(InStaticMesh.PackedVertices[Index], InStaticMesh.PackedPositionMin, InStaticMesh.PackedPositionExtent);
+
+		Error.MaxPositionError = std::max(Error.MaxPositionError, (Decoded.Position - Source.Position).Length());
+		Error.MaxNormalErrorDegrees = std::max(Error.MaxNormalErrorDegrees, AngleDegrees(Source.Normal, Decoded.Normal));
+		Error.MaxTangentErrorDegrees = std::max(Error.MaxTangentErrorDegrees, AngleDegrees(Source.Tangent, Decoded.Tangent));
+		Error.MaxTexCoordError = std::max({ Error.MaxTexCoordError,
+			std::abs(Decoded.TexCoord.X - Source.TexCoord.X), std::abs(Decoded.TexCoord.Y - Source.TexCoord.Y) });
+
+		if (Source.Bitangent.Dot(Decoded.Bitangent) < 0.0f)
+		{
+			++Error.BitangentFlipCount;
+		}
+	}
+	return Error;
+}
+
+void FVertexQuantizer::EncodeOctahedral(const FVector& InDirection, int16 OutEncoded[2])
+{
+	const float L1Norm = std::abs(InDirection.X) + std::abs(InDirection.Y) + std::abs(InDirection.Z);
+	if (L1Norm < 1e-12f)
+	{
+		// (0, 0)은 +Z로 복원된다
+		OutEncoded[0] = 0;
+		OutEncoded[1] = 0;
+		return;
+	}
+
+	// 팔면체에 투영하고 아래쪽 반구는 바깥 삼각형으로 접는다
+	float X = InDirection.X / L1Norm;
+	float Y = InDirection.Y / L1Norm;
+	if (InDirection.Z < 0.0f)
+	{
+		const float FoldedX = (1.0f - std::abs(Y)) * SignNotZero(X);
+		const float FoldedY = (1.0f - std::abs(X)) * SignNotZero(Y);
+		X = FoldedX;
+		Y = FoldedY;
+	}
+
+	const FVector Direction = InDirection / InDirection.Length();
+	const int32 BaseX = static_cast<int32>(std::floor(X * SNORM16_MAX));
+	const int32 BaseY = static_cast<int32>(std::floor(Y * SNORM16_MAX));
+
+	float BestCosine = -2.0f;
+	for (int32 OffsetY = 0; OffsetY <= 1; ++OffsetY)
+	{
+		for (int32 OffsetX = 0; OffsetX <= 1; ++OffsetX)
+		{
+			const int16 Candidate[2] = {
+				static_cast<int16>(std::clamp(BaseX + OffsetX, -32767, 32767)),
+				static_cast<int16>(std::clamp(BaseY + OffsetY, -32767, 32767)) };
+
+			const float Cosine = DecodeOctahedral(Candidate).Dot(Direction);
+			if (Cosine > BestCosine)
+			{
+				BestCosine = Cosine;
+				OutEncoded[0] = Candidate[0];
+				OutEncoded[1] = Candidate[1];
+			}
+		}
+	}
+}
+
+FVector FVertexQuantizer::DecodeOctahedral(const int16 InEncoded[2])
+{
+	// SNORM 변환 규칙: -32768도 -1로 본다
+	float X = std::max(InEncoded[0] / SNORM16_MAX, -1.0f);
+	float Y = std::max(InEncoded[1] / SNORM16_MAX, -1.0f);
+	const float Z = 1.0f - std::abs(X) - std::abs(Y);
+
+	const float Fold = std::max(-Z, 0.0f);
+	X += X >= 0.0f ? -Fold : Fold;
+	Y += Y >= 0.0f ? -Fold : Fold;
+
+	const FVector Direction(X, Y, Z);
+	return Direction / Direction.Length();
+}
+
+uint16 FVertexQuantizer::FloatToHalf(float InValue)
+{
+	uint32 Bits;
+	memcpy(&Bits, &InValue, sizeof(Bits));
+
+	const uint32 Sign = (Bits >> 16) & 0x8000;
+	const uint32 FloatExponent = (Bits >> 23) & 0xFF;
+	uint32 Mantissa = Bits & 0x7FFFFF;
+
+	if (FloatExponent == 0xFF)
+	{
+		return static_cast<uint16>(Sign | 0x7C00 | (Mantissa ? 0x200 : 0));
+	}
+
+	const int32 Exponent = static_cast<int32>(FloatExponent) - 127 + 15;
+	if (Exponent >= 31)
+	{
+		return static_cast<uint16>(Sign | 0x7C00);
+	}
+
+	if (Exponent <= 0)
+	{
+		// half 비정규 수, 2^-24 단위로 반올림
+		if (Exponent < -10)
+		{
+			return static_cast<uint16>(Sign);
+		}
+		Mantissa |= 0x800000;
+		const uint32 Shift = static_cast<uint32>(14 - Exponent);
+		uint32 Half = Mantissa >> Shift;
+		const uint32 Remainder = Mantissa & ((1u << Shift) - 1);
+		const uint32 HalfWay = 1u << (Shift - 1);
+		if (Remainder > HalfWay || (Remainder == HalfWay && (Half & 1)))
+		{
+			++Half;
+		}
+		return static_cast<uint16>(Sign | Half);
+	}
+
+	// 가수 반올림이 넘치면 지수로 올라가고, 최대 지수에서는 무한대가 된다
+	uint32 Half = (static_cast<uint32>(Exponent) << 10) | (Mantissa >> 13);
+	const uint32 Remainder = Mantissa & 0x1FFF;
+	if (Remainder > 0x1000 || (Remainder == 0x1000 && (Half & 1)))
+	{
+		++Half;
+	}
+	return static_cast<uint16>(Sign | Half);
+}
+
+float FVertexQuantizer::HalfToFloat(uint16 InValue)
+{
+	const uint32 Sign = static_cast<uint32>(InValue & 0x8000) << 16;
+	const uint32 Exponent = (InValue >> 10) & 0x1F;
+	const uint32 Mantissa = InValue & 0x3FF;
+
+	if (Exponent == 0)
+	{
+		const float Magnitude = std::ldexp(static_cast<float>(Mantissa), -24);
+		return Sign ? -Magnitude : Magnitude;
+	}
+
+	const uint32 Bits = Exponent == 31
+		? Sign | 0x7F800000 | (Mantissa << 13)
+		: Sign | ((Exponent + 112) << 23) | (Mantissa << 13);
+
+	float Result;
+	memcpy(&Result, &Bits, sizeof(Result));
+	return Result;
+}
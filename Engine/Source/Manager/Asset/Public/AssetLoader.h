@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Manager/Asset/Public/ObjImporter.h"
+#include "Manager/Asset/Public/TextureManager.h"
+#include "Physics/Public/AABB.h"
+
+class FJobSystem;
+struct FStaticMesh;
+
+/** @brief 시작 시 로드하는 에셋 하나의 작업, CPU 단계 결과와 단계별 소요 시간을 함께 보관 */
+struct FAssetLoadTask
+{
+	FName Name;
+	path FilePath;
+	uintmax_t FileSize = 0;
+	bool bIsCooked = false;
+
+	/** @brief Cook 단계에 걸린 시간 (메시: 파싱/용접/탄젠트/BVH/AABB, 텍스처: 파일 읽기와 디코딩) */
+	double CookMilliseconds = 0.0;
+	/** @brief Upload 단계에 걸린 시간 (디바이스 리소스와 UObject 생성) */
+	double UploadMilliseconds = 0.0;
+};
+
+struct FStaticMeshLoadTask : FAssetLoadTask
+{
+	std::unique_ptr<FStaticMesh> StaticMesh;
+	FAABB Bounds;
+
+	/** @brief MTL이 참조하는 텍스처 파일의 정규화된 경로, 업로드 단계에서 이 메시보다 먼저 올라간다 */
+	TArray<FString> TextureDependencies;
+};
+
+struct FTextureLoadTask : FAssetLoadTask
+{
+	FDecodedTexture DecodedTexture;
+	/** @brief 디렉토리 스캔이 아닌 메시의 MTL 의존성으로 추가된 텍스처 */
+	bool bIsDependency = false;
+};
+
+/**
+ * @brief 시작 시 Data/의 메시와 텍스처를 잡 시스템으로 병렬 로드하는 태스크 그래프 로더
+ * #1 Gather: 디렉토리를 스캔해 메시/텍스처 작업을 만든다 (메인 스레드, FName 생성 포함)
+ * #2 Cook: 메시 빌드와 텍스처 디코딩을 워커에서 병렬 처리한다.
+ *    메시의 MTL이 참조하지만 스캔에 없던 텍스처는 의존성 작업으로 추가해 한 번 더 병렬 디코딩한다.
+ * #3 Upload: 디바이스 리소스와 UObject 생성은 UAssetManager가 메인 스레드에서 텍스처 → 메시 순으로 직렬 처리한다.
+ * @note Cook까지만 호출하면 디바이스 없이 CPU 시간만 측정할 수 있다 (assetload 벤치마크)
+ */
+class FAssetLoader
+{
+public:
+	void Gather(const path& InMeshDirectory, const path& InTextureDirectory);
+
+	/**
+	 * @param InJobSystem nullptr이면 모든 작업을 호출 스레드에서 순서대로 처리 (비교 측정용)
+	 * @note 메시 임포트 내부의 병렬 파싱은 설정에 따라 여전히 전역 잡 시스템을 사용한다
+	 */
+	void Cook(const FObjImporter::Configuration& InMeshConfig, FJobSystem* InJobSystem);
+
+	/** @brief 에셋별 Cook/Upload 시간과 전체 요약을 출력 */
+	void PrintReport() const;
+
+	TArray<FStaticMeshLoadTask>& GetStaticMeshTasks() { return StaticMeshTasks; }
+	TArray<FTextureLoadTask>& GetTextureTasks() { return TextureTasks; }
+
+	/** @brief Cook 단계 전체의 벽시계 시간 */
+	double GetCookMilliseconds() const { return CookMilliseconds; }
+	/** @brief 작업별 Cook 시간의 합, 직렬로 처리했을 때의 추정치 */
+	double GetCookWorkMilliseconds() const;
+	void SetUploadMilliseconds(double InMilliseconds) { UploadMilliseconds = InMilliseconds; }
+
+private:
+	static FString MakeTextureKey(const path& InFilePath);
+
+	void AddTextureTask(const path& InFilePath, bool bInIsDependency);
+	void AddMissingTextureDependencies();
+
+	static void CookStaticMesh(FStaticMeshLoadTask& InOutTask, const FObjImporter::Configuration& InMeshConfig);
+	static void CookTexture(FTextureLoadTask& InOutTask);
+
+	TArray<FStaticMeshLoadTask> StaticMeshTasks;
+	TArray<FTextureLoadTask> TextureTasks;
+
+	/** @brief 정규화한 텍스처 경로 → TextureTasks 인덱스, 의존성 중복 추가 방지 */
+	TMap<FString, size_t> TextureTaskIndices;
+
+	uint32 WorkerCount = 0;
+	double CookMilliseconds = 0.0;
+	double UploadMilliseconds = 0.0;
+};
@@ -5,6 +5,7 @@
 #include "Component/Mesh/Public/StaticMesh.h"
 
 struct FAABB;
+class FAssetLoader;
 
 /**
  * @brief 전역의 On-Memory Asset을 관리하는 매니저 클래스
@@ -31,6 +32,8 @@ public:
 
 	// StaticMesh 관련 함수
 	void LoadAllObjStaticMesh();
+	/** @brief 시작 시 Data/의 .obj를 임포트할 때 쓰는 설정, 같은 조건을 재현하는 벤치마크도 사용 */
+	static FObjImporter::Configuration GetStaticMeshImportConfig();
 	ID3D11Buffer* GetVertexBuffer(FName InObjPath);
 	ID3D11Buffer* GetIndexBuffer(FName InObjPath);
 
@@ -41,6 +44,7 @@ public:
 	// Bounding Box
 	FAABB& GetAABB(EPrimitiveType InType);
 	FAABB& GetStaticMeshAABB(FName InName);
+	static FAABB CalculateAABB(const TArray<FNormalVertex>& Vertices);
 
 private:
 	// Vertex Resource
@@ -62,8 +66,15 @@ private:
 
 	// Helper Functions
 	ID3D11Buffer* CreateVertexBuffer(TArray<FNormalVertex> InVertices);
+	/** @brief 압축 정점이 있으면 FPackedNormalVertex로, 없으면 FNormalVertex로 정점 버퍼를 만든다 */
+	ID3D11Buffer* CreateStaticMeshVertexBuffer(UStaticMesh* InStaticMesh);
 	ID3D11Buffer* CreateIndexBuffer(TArray<uint32> InIndices);
-	FAABB CalculateAABB(const TArray<FNormalVertex>& Vertices);
+	/** @brief LOD가 있으면 LOD0 인덱스 뒤에 LOD 인덱스를 이어 붙인 하나의 인덱스 버퍼를 만든다 */
+	ID3D11Buffer* CreateStaticMeshIndexBuffer(UStaticMesh* InStaticMesh);
+
+	// Startup Loading
+	void LoadAllAssets();
+	void UploadLoadedAssets(FAssetLoader& InLoader);
 
 	// AABB Resource
 	TMap<EPrimitiveType, FAABB> AABBs;		// 각 타입별 AABB 저장
@@ -0,0 +1,64 @@
+#pragma once
+
+struct FMeshSection;
+struct FStaticMesh;
+
+/** @brief FIFO 후처리 정점 캐시 시뮬레이션 결과 */
+struct FVertexCacheStatistics
+{
+	/** @brief 삼각형당 정점 셰이더 실행 수 (0.5~3, 낮을수록 좋다) */
+	float ACMR = 0.0f;
+	/** @brief 참조된 정점 하나당 정점 셰이더 실행 수 (1 이상, 1이 이상적) */
+	float ATVR = 0.0f;
+	uint32 TransformCount = 0;
+};
+
+/**
+ * @brief 쿠킹 단계의 인덱스/정점 순서 최적화
+ * 섹션마다 Tipsify로 정점 캐시 순서를 만들고, 캐시 효율을 크게 해치지 않는 선에서 클러스터를 바깥쪽을 향하는 순서로 정렬해
+ * 오버드로를 줄인 뒤, 마지막으로 정점을 처음 쓰이는 순서로 재배치한다.
+ * 삼각형은 자기 섹션 구간 안에서만 움직이고 감기 순서도 유지하므로 FMeshSection과 머티리얼 슬롯은 그대로다.
+ */
+struct FMeshOptimizer
+{
+	/** @brief 최적화 대상 캐시 크기, 데스크톱 GPU의 후처리 캐시를 보수적으로 가정 */
+	static constexpr uint32 CACHE_SIZE = 16;
+	/** @brief 오버드로 정렬을 위해 클러스터를 나눌 때 허용하는 ACMR 증가 비율 */
+	static constexpr float OVERDRAW_THRESHOLD = 1.05f;
+
+	/** @brief 섹션별 캐시/오버드로 최적화 후 전체 정점 순서를 재배치, BVH와 양자화보다 먼저 호출해야 한다 */
+	static void Optimize(FStaticMesh& InOutStaticMesh);
+
+	/**
+	 * @brief 섹션마다 캐시/오버드로 순서로 삼각형을 재배치, 정점 순서는 건드리지 않는다
+	 * @param InIndexBase InSections의 StartIndex 기준 버퍼에서 InOutIndices[0]의 위치 (LOD 인덱스는 LOD0 인덱스 수)
+	 */
+	static void OptimizeSections(TArray<uint32>& InOutIndices, const TArray<FMeshSection>& InSections, const TArray<FNormalVertex>& InVertices,
+		uint32 InIndexBase = 0);
+
+	/**
+	 * @brief Tipsify (Sander et al. 2007), 인덱스는 [0, InVertexCount) 범위여야 한다
+	 * 캐시에 남아 있을 정점을 팬 중심으로 골라 그 정점의 남은 삼각형을 한꺼번에 내보내므로 O(삼각형 수)다.
+	 */
+	static void OptimizeVertexCache(uint32* InOutIndices, size_t InIndexCount, uint32 InVertexCount, uint32 InCacheSize = CACHE_SIZE);
+
+	/**
+	 * @brief 캐시 순서가 잡힌 인덱스를 클러스터로 나눠 바깥을 향하는 클러스터부터 그리도록 정렬
+	 * 세 정점이 모두 캐시 미스인 삼각형에서 클러스터를 끊고, 클러스터 ACMR이 InThreshold배 이내로 유지되는 지점에서 더 잘게 나눈다.
+	 * @param InVertices 방향 판정에 쓸 위치와 노멀, 면 노멀은 정점 노멀 쪽으로 맞춘다
+	 */
+	static void OptimizeOverdraw(uint32* InOutIndices, size_t InIndexCount, const FNormalVertex* InVertices, uint32 InVertexCount,
+		uint32 InCacheSize = CACHE_SIZE, float InThreshold = OVERDRAW_THRESHOLD);
+
+	/**
+	 * @brief 메시렛마다 구간 안에서 캐시/오버드로 순서로 삼각형을 재배치한 뒤 정점을 다시 처음 쓰이는 순서로 정렬
+	 * 메시렛 구간과 경계는 그대로이므로 FMeshletBuilder::BuildMeshlets 바로 뒤에 호출한다.
+	 * @note 정점 번호가 바뀌므로 LODIndices가 만들어지기 전(LOD 생성 전)에 호출해야 한다
+	 */
+	static void OptimizeMeshlets(FStaticMesh& InOutStaticMesh);
+
+	/** @brief 정점을 인덱스 버퍼에서 처음 쓰이는 순서로 재배치, 쓰이지 않는 정점은 원래 순서대로 뒤에 남긴다 */
+	static void OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices);
+
+	static FVertexCacheStatistics AnalyzeVertexCache(const uint32* InIndices, size_t InIndexCount, uint32 InVertexCount, uint32 InCacheSize = CACHE_SIZE);
+};
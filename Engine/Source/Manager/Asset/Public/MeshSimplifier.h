@@ -0,0 +1,44 @@
+#pragma once
+
+struct FStaticMesh;
+
+/**
+ * @brief 쿠킹 단계의 LOD 체인 생성, 이차 오차 행렬(Garland-Heckbert QEM) 기반 edge collapse
+ * 정점을 이웃한 기존 정점 자리로만 합치므로(half-edge collapse) 모든 LOD가 LOD0의 정점 버퍼(압축 정점 포함)를 그대로 쓰고 인덱스만 따로 가진다.
+ * - UV나 노멀이 갈라진 이음매는 이음매를 따라서만, 열린 경계는 경계를 따라서만 접고 이음매 양쪽 정점을 함께 옮긴다
+ * - 섹션마다 따로 단순화하고 다른 섹션과 위치를 공유하는 정점은 고정해 머티리얼 경계에 틈이 생기지 않게 한다
+ * - 노멀이 크게 다른 정점끼리 합치는 비용을 올리고, 면이 뒤집히거나 크게 꺾이는 collapse는 버린다
+ */
+struct FMeshSimplifier
+{
+	/** @brief LOD마다 이전 LOD 대비 목표 삼각형 비율 */
+	static constexpr float LOD_TRIANGLE_RATIO = 0.5f;
+	/** @brief 새 LOD가 이전 LOD 삼각형 수의 이 비율보다 많이 남으면 거기서 체인을 끝낸다 */
+	static constexpr float MIN_LOD_REDUCTION = 0.8f;
+	/** @brief 이보다 적은 삼각형의 메시나 LOD에서는 더 만들지 않는다 */
+	static constexpr uint32 MIN_LOD_TRIANGLES = 64;
+	/** @brief LOD 하나를 만들 때 허용하는 collapse 오차, 메시 AABB 대각선 대비 */
+	static constexpr float MAX_LOD_ERROR = 0.05f;
+	/** @brief LOD 전환 화면 크기는 이 높이의 화면에서 오차가 MAX_PIXEL_ERROR 픽셀이 되는 크기 */
+	static constexpr float REFERENCE_SCREEN_HEIGHT = 1080.0f;
+	static constexpr float MAX_PIXEL_ERROR = 1.0f;
+	/** @brief 이웃한 LOD 전환 화면 크기 비율의 상한, UStaticMeshComponent::LOD_HYSTERESIS 구간끼리 겹치지 않게 한다 */
+	static constexpr float MAX_SCREEN_SIZE_STEP = 0.75f;
+
+	/**
+	 * @brief LOD0(Indices, Sections)에서 LOD를 최대 InLODCount - 1개 만들어 LODIndices와 LODs를 채운다
+	 * 각 LOD는 바로 앞 LOD를 단순화해 만들고, 목표만큼 줄지 않거나 너무 작아지면 거기서 멈춘다.
+	 * @note 정점 순서를 바꾸는 FMeshOptimizer::Optimize 뒤에 호출해야 한다
+	 */
+	static void BuildLODs(FStaticMesh& InOutStaticMesh, int32 InLODCount);
+
+	/**
+	 * @brief 인덱스 구간 하나를 목표 인덱스 수 가까이 단순화, 인덱스는 [0, InVertexCount) 범위여야 한다
+	 * @param InMaxError collapse 하나가 허용하는 오차 (모델 단위 거리), 이를 넘으면 목표에 못 미쳐도 멈춘다
+	 * @param InLockedVertices 0이 아니면 움직이지 않는 정점 (nullptr 가능)
+	 * @param OutError 수행한 collapse의 최대 오차 (모델 단위 거리)
+	 * @return 남은 인덱스 수, 남은 삼각형은 입력의 감기 순서와 정점 번호를 그대로 쓴다
+	 */
+	static size_t Simplify(uint32* InOutIndices, size_t InIndexCount, const FNormalVertex* InVertices, uint32 InVertexCount,
+		size_t InTargetIndexCount, float InMaxError, const uint8* InLockedVertices = nullptr, float* OutError = nullptr);
+};
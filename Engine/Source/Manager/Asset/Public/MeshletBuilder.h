@@ -0,0 +1,39 @@
+#pragma once
+
+struct FMeshlet;
+struct FStaticMesh;
+
+/**
+ * @brief 쿠킹 단계의 메시렛 분할, LOD0 섹션마다 삼각형을 작은 묶음으로 나눠 묶음별로 인덱스 구간을 모은다
+ * 정점을 공유하는 삼각형을 우선으로 노멀이 비슷한 쪽을 골라 키우고, 이어진 삼각형이 없으면 입력 순서에서 다음 씨앗을 잡는다.
+ * 메시렛 안의 삼각형 순서는 캐시 효율을 따지지 않으므로, 최적화가 켜져 있으면 FMeshOptimizer::OptimizeMeshlets로 다시 잡는다.
+ * 삼각형은 자기 섹션 구간 안에서만 움직이고 감기 순서도 유지하므로 FMeshSection, LOD, 정점 버퍼는 그대로다.
+ * 메시렛마다 경계 구와 노멀 콘을 구하며, 콘은 래스터라이저의 앞면 판정(FrontCounterClockwise, 왼손 좌표계)과 같은 감기 방향의 면 노멀로 만든다.
+ */
+struct FMeshletBuilder
+{
+	/** @brief 메시렛 하나의 정점 상한 */
+	static constexpr uint32 MAX_VERTICES = 64;
+	/** @brief 메시렛 하나의 삼각형 상한 */
+	static constexpr uint32 MAX_TRIANGLES = 124;
+	/** @brief 이어진 삼각형을 고를 때 노멀 차이(1 - 내적)에 곱하는 가중치, 새 정점 하나의 비용이 1이다 */
+	static constexpr float CONE_WEIGHT = 0.5f;
+	/** @brief 이보다 삼각형이 적은 메시는 컴포넌트 단위 컬링으로 충분하므로 나누지 않는다 */
+	static constexpr uint32 MIN_MESH_TRIANGLES = 4 * MAX_TRIANGLES;
+
+	/**
+	 * @brief LOD0 인덱스를 섹션별로 메시렛 순서로 재배치하고 Meshlets를 채운다
+	 * @note FMeshOptimizer::Optimize 뒤(씨앗을 최적화된 순서로 잡는다), LOD 생성과 BVH 빌드 전에 호출해야 한다
+	 */
+	static void BuildMeshlets(FStaticMesh& InOutStaticMesh);
+
+	/**
+	 * @brief 인덱스 구간 하나를 메시렛으로 나눠 제자리에서 재배치하고 OutMeshlets 뒤에 덧붙인다
+	 * @param InIndexBase InOutIndices[0]의 인덱스 버퍼 내 위치, 메시렛의 FirstIndex에 더해진다
+	 */
+	static void BuildSectionMeshlets(uint32* InOutIndices, uint32 InIndexCount, uint32 InIndexBase, uint32 InSectionIndex,
+		const FNormalVertex* InVertices, uint32 InVertexCount, TArray<FMeshlet>& OutMeshlets);
+
+	/** @brief 삼각형 목록의 경계 구와 노멀 콘, 퇴화 삼각형은 콘에서 뺀다 */
+	static void ComputeBounds(const uint32* InIndices, uint32 InIndexCount, const FNormalVertex* InVertices, FMeshlet& OutMeshlet);
+};
@@ -24,6 +24,9 @@ struct FObjInfo
 	TArray<FVector> VertexList;
 	TArray<FVector> NormalList;
 	TArray<FVector2> TexCoordList;
+
+	/** Paths of the .mtl files referenced by 'mtllib', used to invalidate cooked mesh caches. */
+	TArray<FString> MaterialFileList;
 };
 
 inline FArchive& operator<<(FArchive& Ar, FObjInfo& ObjInfo)
@@ -35,6 +38,8 @@ inline FArchive& operator<<(FArchive& Ar, FObjInfo& ObjInfo)
 	Ar << ObjInfo.NormalList;
 	Ar << ObjInfo.TexCoordList;
 
+	Ar << ObjInfo.MaterialFileList;
+
 	return Ar;
 }
 
@@ -153,11 +158,22 @@ struct FObjImporter
 	{
 		FString DefaultName = "DefaultObject";
 		bool bIsObjectEnabled = false;
+		/** Read and write the cooked mesh cache (see FStaticMeshCache) instead of rebuilding the mesh on every load. */
 		bool bIsBinaryEnabled = false;
+		/** Also cook FPackedNormalVertex data (see FVertexQuantizer) and upload it instead of FNormalVertex for static meshes. */
+		bool bIsVertexCompressionEnabled = false;
+		/** Reorder indices per section for the post-transform cache and overdraw, then vertices by first use (see FMeshOptimizer). */
+		bool bIsMeshOptimizationEnabled = true;
+		/** Number of LODs including LOD0 to generate by QEM simplification (see FMeshSimplifier), 1 disables LOD generation. */
+		int32 LODCount = 4;
+		/** Partition LOD0 sections into meshlets with bounding spheres and normal cones for per-cluster CPU culling (see FMeshletBuilder). */
+		bool bIsMeshletEnabled = true;
 		bool bFlipWindingOrder = false;
 		bool bPositionToUEBasis = true;
 		bool bNormalToUEBasis = true;
 		bool bUVToUEBasis = true;
+		/** Parse newline-aligned chunks of the file on the job system instead of reading it line by line through iostreams. */
+		bool bIsParallelParsingEnabled = true;
 		// ...
 	};
 
@@ -189,6 +205,22 @@ private:
 	 */
 	static bool ParseFaceBuffer(const FString& FaceBuffer, FObjectInfo* OutObjectInfo);
 
+	/** Parse result of one chunk in the parallel path, defined in ObjImporter.cpp. */
+	struct FObjChunk;
+
+	/**
+	 * @brief Fast path of LoadObj. Maps the file, parses newline-aligned chunks in parallel and merges them in file order.
+	 * @note Produces the same FObjInfo as the line-by-line path.
+	 */
+	static bool LoadObjParallel(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const Configuration& Config);
+
+	/**
+	 * @brief Parses the bytes [Begin, End) without touching shared state.
+	 * Vertex data is appended to the chunk directly, while faces and the 'o', 'g', 'usemtl', 'mtllib' directives
+	 * are recorded as events because their meaning depends on the parser state left by the previous chunks.
+	 */
+	static void ParseObjChunk(const char* Begin, const char* End, const Configuration& Config, FObjChunk& OutChunk);
+
 	static FVector PositionToUEBasis(const FVector& InVector)
 	{
 		return FVector(InVector.X, -InVector.Y, InVector.Z);
@@ -9,11 +9,28 @@ class FObjManager
 {
 public:
 	static FStaticMesh* LoadObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
+
+	/**
+	 * @brief 쿠킹 캐시(Config.bIsBinaryEnabled)가 원본과 일치하면 그대로 읽고, 아니면 .obj로 FStaticMesh를 빌드한 뒤 캐시를 갱신
+	 * @note ObjFStaticMeshMap에 등록하지 않으므로 같은 파일을 여러 번 읽는 로드 벤치마크에서도 사용
+	 */
+	static std::unique_ptr<FStaticMesh> ImportStaticMesh(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
 	static UStaticMesh* LoadObjStaticMesh(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
+
+	/**
+	 * @brief 워커에서 미리 빌드한 FStaticMesh를 등록하고 UStaticMesh와 머티리얼을 생성 (메인 스레드 전용)
+	 * @note 같은 경로가 이미 등록되어 있으면 새 메시는 버리고 기존 것을 사용
+	 */
+	static UStaticMesh* RegisterStaticMesh(const FName& PathFileName, std::unique_ptr<FStaticMesh> StaticMeshAsset);
 	static void CreateMaterialsFromMTL(UStaticMesh* StaticMesh, FStaticMesh* StaticMeshAsset, const FName& ObjFilePath);
 
+	/** @brief CreateMaterialsFromMTL이 불러올 텍스처 파일 경로 목록 (map_Kd, map_Ka, map_Ks, map_d), 워커에서 호출 가능 */
+	static TArray<FString> GetTextureDependencies(const FStaticMesh& StaticMeshAsset, const FName& ObjFilePath);
+
 	static constexpr size_t INVALID_INDEX = SIZE_MAX;
 	
 private:
+	static UStaticMesh* CreateStaticMesh(const FName& PathFileName, FStaticMesh* StaticMeshAsset);
+
 	static TMap<FName, std::unique_ptr<FStaticMesh>> ObjFStaticMeshMap;
 };
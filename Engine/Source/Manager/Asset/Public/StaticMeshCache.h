@@ -0,0 +1,37 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Manager/Asset/Public/ObjImporter.h"
+
+struct FStaticMesh;
+
+/**
+ * @brief FObjManager가 빌드한 최종 FStaticMesh를 한 파일로 저장하는 쿠킹 메시 캐시 (.meshcache)
+ * 용접된 정점, (압축 정점 포맷이면) FPackedNormalVertex, uint32 인덱스, 섹션, 머티리얼 테이블, 평탄화된 BVH, LOD 인덱스와 섹션을 정렬된 섹션으로 이어 붙이고 앞에 헤더를 둔다.
+ * 로드는 파일을 매핑한 뒤 헤더의 범위를 검증하고 섹션마다 한 번씩 통째로 복사하므로, 정점 용접/탄젠트 계산/메시 최적화/LOD 생성/BVH 빌드를 모두 건너뛴다.
+ * @note 헤더의 SourceHash는 포맷 버전, 정점/노드 레이아웃, 임포트 설정, 원본 .obj와 참조한 .mtl의 크기와 수정 시각으로 만든다.
+ * 어느 하나라도 바뀌면 캐시를 무시하고 다시 쿠킹한다.
+ */
+struct FStaticMeshCache
+{
+	/** @brief 파일 맨 앞 4바이트 "GTLM" */
+	static constexpr uint32 MAGIC = 0x4D4C5447;
+	/** @brief 캐시 레이아웃이나 FObjManager의 빌드 결과가 바뀌면 올린다 */
+	static constexpr uint32 VERSION = 5;
+
+	static std::filesystem::path GetCachePath(const std::filesystem::path& InSourcePath);
+
+	/**
+	 * @brief 원본과 일치하는 캐시가 있으면 OutStaticMesh를 채운다 (PathFileName은 호출자가 설정)
+	 * @return 캐시가 없거나, 버전/원본 해시가 다르거나, 범위 검증에 실패하면 false
+	 */
+	static bool Load(const std::filesystem::path& InSourcePath, const FObjImporter::Configuration& InConfig, FStaticMesh& OutStaticMesh);
+
+	/**
+	 * @brief 빌드된 메시를 캐시 파일로 저장, 임시 파일에 쓴 뒤 교체하므로 중간에 실패해도 깨진 캐시가 남지 않는다
+	 * @param InDependencies 원본 .obj 외에 결과에 영향을 준 파일 (.mtl)
+	 */
+	static bool Save(const std::filesystem::path& InSourcePath, const FObjImporter::Configuration& InConfig,
+		const FStaticMesh& InStaticMesh, const TArray<FString>& InDependencies);
+};
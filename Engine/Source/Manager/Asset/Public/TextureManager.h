@@ -1,5 +1,18 @@
 ﻿#pragma once
 
+/**
+ * @brief GPU 리소스를 만들기 전까지 워커 스레드에서 끝낼 수 있는 텍스처 파일의 CPU 데이터
+ * DDS는 이미 GPU 포맷이므로 파일 내용을 그대로, 그 외(WIC) 포맷은 RGBA8 픽셀로 디코딩해서 보관한다
+ */
+struct FDecodedTexture
+{
+    path FilePath;
+    bool bIsDDS = false;
+    uint32 Width = 0;
+    uint32 Height = 0;
+    TArray<uint8> Data;
+};
+
 class FTextureManager
 {
 public:
@@ -7,11 +20,26 @@ public:
     ~FTextureManager();
     
     UTexture* LoadTexture(const FName& InFilePath);
+    /** @brief 미리 디코딩한 데이터로 SRV를 만들어 캐싱, 이미 캐싱된 경로면 기존 텍스처를 반환 */
+    UTexture* LoadTexture(const FName& InFilePath, const FDecodedTexture& InDecodedTexture);
     void LoadAllTexturesFromDirectory(const path& InDirectoryPath);
     const TMap<FName, UTexture*>& GetTextureCache() const;
+
+    static bool IsSupportedTextureFile(const path& InFilePath);
+
+    /**
+     * @brief 디바이스 없이 파일을 읽고 디코딩, 전역 상태를 건드리지 않으므로 잡 시스템 워커에서 호출해도 된다
+     * @note WIC 디코딩을 위해 호출한 스레드에 COM을 초기화하고 반환 전에 해제한다
+     */
+    static bool DecodeTextureFile(const path& InFilePath, FDecodedTexture& OutDecodedTexture);
     
 private:
+    FName MakeCacheKey(const FName& InFilePath, path& OutAbsolutePath) const;
+    UTexture* FindCachedTexture(const FName& InCacheKey) const;
+    UTexture* AddTextureToCache(const FName& InCacheKey, const ComPtr<ID3D11ShaderResourceView>& InSRV);
+
     ComPtr<ID3D11ShaderResourceView> CreateTextureFromFile(const path& InFilePath);
+    ComPtr<ID3D11ShaderResourceView> CreateTextureFromDecoded(const FDecodedTexture& InDecodedTexture);
 	
     TMap<FName, UTexture*> TextureCaches;
     ID3D11SamplerState* DefaultSampler; // 추후 샘플러 종류가 많아지면 매핑 형태로 캐싱 후 사용
@@ -0,0 +1,43 @@
+#pragma once
+
+struct FStaticMesh;
+
+/** @brief 압축 정점을 원본 FNormalVertex와 비교한 최대 오차 */
+struct FVertexQuantizationError
+{
+	/** @brief 로컬 공간 거리 */
+	float MaxPositionError = 0.0f;
+	float MaxNormalErrorDegrees = 0.0f;
+	float MaxTangentErrorDegrees = 0.0f;
+	float MaxTexCoordError = 0.0f;
+	/** @brief 바이텐전트 방향이 원본과 반대로 복원된 정점 수 */
+	int32 BitangentFlipCount = 0;
+};
+
+/**
+ * @brief FNormalVertex(72바이트)를 FPackedNormalVertex(20바이트)로 양자화하는 쿠킹 단계
+ * 위치는 메시 AABB 기준 16비트, 노멀/탄젠트는 8면체 인코딩 16비트 x2, 바이텐전트는 N x T 부호 1비트, UV는 half로 줄인다.
+ * 정점 색은 OBJ 임포터가 채우지 않고 UberShader도 읽지 않으므로 압축 포맷에서는 뺀다.
+ */
+struct FVertexQuantizer
+{
+	/** @brief InOutStaticMesh.Vertices로 PackedVertices, 위치 범위, PackedPositionToLocal을 채운다 */
+	static void Quantize(FStaticMesh& InOutStaticMesh);
+
+	/** @brief [0,1] 위치를 로컬 위치로 되돌리는 행렬 (축별 Extent 스케일 후 Min 이동, 행 벡터 기준) */
+	static FMatrix MakePositionToLocal(const FVector& InPositionMin, const FVector& InPositionExtent);
+
+	/** @brief 셰이더의 PACKED_VERTEX 디코딩과 같은 계산으로 원래 정점을 복원 (색은 0) */
+	static FNormalVertex Dequantize(const FPackedNormalVertex& InPacked, const FVector& InPositionMin, const FVector& InPositionExtent);
+
+	/** @brief PackedVertices를 복원해 Vertices와 비교, 압축 정점이 없으면 모두 0 */
+	static FVertexQuantizationError MeasureError(const FStaticMesh& InStaticMesh);
+
+	/** @brief 단위 벡터를 8면체 인코딩, 반올림 후보 4개 중 복원 오차가 가장 작은 값을 고른다 */
+	static void EncodeOctahedral(const FVector& InDirection, int16 OutEncoded[2]);
+	static FVector DecodeOctahedral(const int16 InEncoded[2]);
+
+	/** @brief IEEE 754 binary16 변환, 가장 가까운 짝수로 반올림하고 범위를 넘으면 무한대 */
+	static uint16 FloatToHalf(float InValue);
+	static float HalfToFloat(uint16 InValue);
+};
@@ -90,18 +90,18 @@ JSON UConfigManager::GetCameraSettingsAsJson()
 	return cameraArray;
 }
 
-void UConfigManager::SetCameraSettingsFromJson(const JSON& InData)
+void UConfigManager::SetCameraSettingsFromJson(const FJsonValue& InData)
 {
-	if (InData.JSONType() != JSON::Class::Array || InData.size() != 4)
+	if (!InData.IsArray() || InData.Size() != 4)
 	{
 		return;
 	}
 
 	int i = 0;
-	for (const JSON& cameraObject : InData.ArrayRange())
+	for (const FJsonValue& cameraObject : InData.ArrayRange())
 	{
 		if (i >= 4) break; // 안전장치
-		if (cameraObject.JSONType() != JSON::Class::Object) continue;
+		if (!cameraObject.IsObject()) continue;
 
 		FJsonSerializer::ReadVector(cameraObject, "Location", ViewportCameraSettings[i].Location);
 		FJsonSerializer::ReadVector(cameraObject, "Rotation", ViewportCameraSettings[i].Rotation);
@@ -110,9 +110,10 @@ void UConfigManager::SetCameraSettingsFromJson(const JSON& InData)
 		FJsonSerializer::ReadArrayFloat(cameraObject, "NearClip", ViewportCameraSettings[i].NearClip);
 		
 		// ReadInt32 대신 더 안전한 방식으로 enum 값을 읽어옵니다.
-		if (cameraObject.hasKey("ViewportCameraType") && cameraObject.at("ViewportCameraType").JSONType() == JSON::Class::Integral)
+		const FJsonValue CameraTypeJson = cameraObject.Find("ViewportCameraType");
+		if (CameraTypeJson.IsInteger())
 		{
-			ViewportCameraSettings[i].ViewportCameraType = static_cast<EViewportCameraType>(cameraObject.at("ViewportCameraType").ToInt());
+			ViewportCameraSettings[i].ViewportCameraType = static_cast<EViewportCameraType>(CameraTypeJson.GetInteger());
 		}
 		else
 		{
@@ -6,6 +6,7 @@
 
 namespace json { class JSON; }
 using JSON = json::JSON;
+class FJsonValue;
 
 /**
  * @brief 뷰포트 클라이언트의 카메라 정보
@@ -57,7 +58,7 @@ public:
 	void LoadEditorSetting();
 
 	JSON GetCameraSettingsAsJson();
-	void SetCameraSettingsFromJson(const JSON& InData);
+	void SetCameraSettingsFromJson(const FJsonValue& InData);
 
 	float GetCellSize() const
 	{
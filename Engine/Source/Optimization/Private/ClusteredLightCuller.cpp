@@ -0,0 +1,537 @@
+#include "pch.h"
+#include "Optimization/Public/ClusteredLightCuller.h"
+
+#include "Core/Public/JobSystem.h"
+
+#include <emmintrin.h>
+
+namespace
+{
+	/** @brief 이보다 좁은 스포트라이트(45도 이하)는 꼭짓점과 밑면 원을 지나는 구가 더 작다 */
+	constexpr float COS_QUARTER_PI = 0.70710678f;
+
+	/** @brief 행 벡터 규약(p * M)으로 위치(InW = 1) 또는 방향(InW = 0)을 변환 */
+	void TransformByView(const FMatrix& InView, float InX, float InY, float InZ, float InW, float& OutX, float& OutY, float& OutZ)
+	{
+		OutX = InX * InView.Data[0][0] + InY * InView.Data[1][0] + InZ * InView.Data[2][0] + InW * InView.Data[3][0];
+		OutY = InX * InView.Data[0][1] + InY * InView.Data[1][1] + InZ * InView.Data[2][1] + InW * InView.Data[3][1];
+		OutZ = InX * InView.Data[0][2] + InY * InView.Data[1][2] + InZ * InView.Data[2][2] + InW * InView.Data[3][2];
+	}
+
+	/** @brief (InPosition * InN + InZ * InPlaneZ) + InD, 스칼라 판정과 같은 순서로 레인 4개를 계산 */
+	inline __m128 PlaneDistance4(__m128 InPosition, __m128 InDepth, const float* InN, const float* InPlaneZ, const float* InD)
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(InPosition, _mm_loadu_ps(InN)), _mm_mul_ps(InDepth, _mm_loadu_ps(InPlaneZ))),
+			_mm_loadu_ps(InD));
+	}
+}
+
+void FClusteredLightCuller::ParallelFor(FJobSystem* InJobSystem, int32 InCount, const TFunction<void(int32)>& InBody, int32 InBatchSize)
+{
+	if (InJobSystem)
+	{
+		InJobSystem->ParallelFor(InCount, InBody, InBatchSize);
+		return;
+	}
+
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		InBody(Index);
+	}
+}
+
+void FClusteredLightCuller::Build(const FCullingParams& InParams, const TArray<FLightParams>& InLights, FJobSystem* InJobSystem)
+{
+	SetUpGrid(InParams, InJobSystem);
+
+	const int32 LightCount = static_cast<int32>(InLights.size());
+	const uint32 ClusterCount = GetClusterCount();
+
+	/** #1. 라이트를 뷰 공간으로 옮기고 열/행/슬라이스 마스크 계산 */
+	CullLights.resize(LightCount);
+	ColumnMasks.resize(static_cast<size_t>(LightCount) * ClusterCountX);
+	RowMasks.resize(static_cast<size_t>(LightCount) * ClusterCountY);
+	SliceMasks.resize(static_cast<size_t>(LightCount) * CLUSTER_SIZE_Z);
+
+	ParallelFor(InJobSystem, LightCount, [&](int32 InLightIndex)
+	{
+		PrepareLight(InLights[InLightIndex], InParams.View, CullLights[InLightIndex]);
+		ComputeLightMasks(InLightIndex);
+	}, 256);
+
+	/** #2. (슬라이스, 행)마다 걸친 라이트 목록, 인덱스 순서를 유지해야 클러스터 목록도 정렬된 상태가 된다 */
+	const int32 RowCount = static_cast<int32>(CLUSTER_SIZE_Z * ClusterCountY);
+	RowScratches.resize(RowCount);
+	ParallelFor(InJobSystem, static_cast<int32>(CLUSTER_SIZE_Z), [&](int32 InSlice)
+	{
+		FRowScratch* SliceRows = RowScratches.data() + static_cast<size_t>(InSlice) * ClusterCountY;
+		for (uint32 Row = 0; Row < ClusterCountY; ++Row)
+		{
+			SliceRows[Row].Lights.clear();
+		}
+
+		for (int32 LightIndex = 0; LightIndex < LightCount; ++LightIndex)
+		{
+			const FCullLight& Light = CullLights[LightIndex];
+			if (InSlice < Light.MinZ || InSlice > Light.MaxZ || !SliceMasks[static_cast<size_t>(LightIndex) * CLUSTER_SIZE_Z + InSlice])
+			{
+				continue;
+			}
+
+			const uint8* Rows = RowMasks.data() + static_cast<size_t>(LightIndex) * ClusterCountY;
+			for (int32 Row = Light.MinY; Row <= Light.MaxY; ++Row)
+			{
+				if (Rows[Row])
+				{
+					SliceRows[Row].Lights.push_back(static_cast<uint32>(LightIndex));
+				}
+			}
+		}
+	});
+
+	/** #3. (슬라이스, 행)마다 클러스터별 목록 */
+	ParallelFor(InJobSystem, RowCount, [&](int32 InRowIndex)
+	{
+		BuildRow(InRowIndex / static_cast<int32>(ClusterCountY), InRowIndex % static_cast<int32>(ClusterCountY));
+	}, 4);
+
+	/** #4. 클러스터 순서의 접두사 합, 실제 배정 수만큼만 인덱스 공간을 잡는다 */
+	ClusterLightInfo.resize(ClusterCount);
+	OverflowClusterCount = 0;
+	uint32 TotalCount = 0;
+	for (int32 RowIndex = 0; RowIndex < RowCount; ++RowIndex)
+	{
+		const FRowScratch& Scratch = RowScratches[RowIndex];
+		for (uint32 Column = 0; Column < ClusterCountX; ++Column)
+		{
+			const uint32 Count = static_cast<uint32>(Scratch.ColumnLights[Column].size());
+			FClusterLightInfo& Info = ClusterLightInfo[static_cast<size_t>(RowIndex) * ClusterCountX + Column];
+			Info.Offset = TotalCount;
+			Info.Count = std::min(Count, MAX_LIGHTS_PER_CLUSTER);
+			OverflowClusterCount += Count > MAX_LIGHTS_PER_CLUSTER ? 1 : 0;
+			TotalCount += Info.Count;
+		}
+	}
+
+	/** #5. 클러스터 목록을 제자리에 복사, 상한을 넘은 목록은 앞쪽(인덱스가 작은 라이트)만 남는다 */
+	LightIndices.resize(TotalCount);
+	ParallelFor(InJobSystem, RowCount, [&](int32 InRowIndex)
+	{
+		const FRowScratch& Scratch = RowScratches[InRowIndex];
+		for (uint32 Column = 0; Column < ClusterCountX; ++Column)
+		{
+			const FClusterLightInfo& Info = ClusterLightInfo[static_cast<size_t>(InRowIndex) * ClusterCountX + Column];
+			if (Info.Count > 0)
+			{
+				memcpy(LightIndices.data() + Info.Offset, Scratch.ColumnLights[Column].data(), sizeof(uint32) * Info.Count);
+			}
+		}
+	}, 4);
+}
+
+void FClusteredLightCuller::BuildReference(const FCullingParams& InParams, const TArray<FLightParams>& InLights)
+{
+	SetUpGrid(InParams, nullptr);
+
+	const size_t LightCount = InLights.size();
+	CullLights.resize(LightCount);
+	for (size_t LightIndex = 0; LightIndex < LightCount; ++LightIndex)
+	{
+		PrepareLight(InLights[LightIndex], InParams.View, CullLights[LightIndex]);
+	}
+
+	const uint32 ClusterCount = GetClusterCount();
+	ClusterLightInfo.resize(ClusterCount);
+	LightIndices.clear();
+	OverflowClusterCount = 0;
+
+	for (uint32 ClusterIndex = 0; ClusterIndex < ClusterCount; ++ClusterIndex)
+	{
+		const int32 X = static_cast<int32>(ClusterIndex % ClusterCountX);
+		const int32 Y = static_cast<int32>(ClusterIndex / ClusterCountX % ClusterCountY);
+		const int32 Z = static_cast<int32>(ClusterIndex / (ClusterCountX * ClusterCountY));
+
+		FClusterLightInfo& Info = ClusterLightInfo[ClusterIndex];
+		Info.Offset = static_cast<uint32>(LightIndices.size());
+		Info.Count = 0;
+
+		uint32 Count = 0;
+		for (size_t LightIndex = 0; LightIndex < LightCount; ++LightIndex)
+		{
+			const FCullLight& Light = CullLights[LightIndex];
+			bool bIsVisible = Light.Shape == ECullShape::Global;
+			if (Light.Shape == ECullShape::Sphere || Light.Shape == ECullShape::Cone)
+			{
+				bIsVisible = IsColumnVisible(Light, X) && IsRowVisible(Light, Y) && IsSliceVisible(Light, Z) &&
+					(Light.Shape != ECullShape::Cone || IsConeVisible(Light, ClusterIndex));
+			}
+
+			if (bIsVisible)
+			{
+				if (Count < MAX_LIGHTS_PER_CLUSTER)
+				{
+					LightIndices.push_back(static_cast<uint32>(LightIndex));
+				}
+				++Count;
+			}
+		}
+
+		Info.Count = std::min(Count, MAX_LIGHTS_PER_CLUSTER);
+		OverflowClusterCount += Count > MAX_LIGHTS_PER_CLUSTER ? 1 : 0;
+	}
+}
+
+void FClusteredLightCuller::SetUpGrid(const FCullingParams& InParams, FJobSystem* InJobSystem)
+{
+	const uint32 Width = InParams.ViewportSize[0];
+	const uint32 Height = InParams.ViewportSize[1];
+	ClusterCountX = (Width + CLUSTER_SIZE_X - 1) / CLUSTER_SIZE_X;
+	ClusterCountY = (Height + CLUSTER_SIZE_Y - 1) / CLUSTER_SIZE_Y;
+
+	const FMatrix& Projection = InParams.Projection;
+	const bool bIsOrthographic = Projection.Data[2][3] == 0.0f && Projection.Data[3][3] == 1.0f;
+
+	// 경계의 뷰 공간 좌표는 Slope * z + Offset (원근: NDC * tan(fov / 2), 직교: 깊이와 무관한 상수)
+	TArray<float> ColumnSlope(ClusterCountX + 1);
+	TArray<float> ColumnOffset(ClusterCountX + 1);
+	TArray<float> RowSlope(ClusterCountY + 1);
+	TArray<float> RowOffset(ClusterCountY + 1);
+
+	// 마스크 계산이 경계 i + 1 ~ i + 4를 한 번에 읽으므로 끝에 레인 4개만큼 여유를 둔다
+	ColumnPlaneN.assign(ClusterCountX + 5, 0.0f);
+	ColumnPlaneZ.assign(ClusterCountX + 5, 0.0f);
+	ColumnPlaneD.assign(ClusterCountX + 5, 0.0f);
+	RowPlaneN.assign(ClusterCountY + 5, 0.0f);
+	RowPlaneZ.assign(ClusterCountY + 5, 0.0f);
+	RowPlaneD.assign(ClusterCountY + 5, 0.0f);
+
+	for (uint32 Boundary = 0; Boundary <= ClusterCountX; ++Boundary)
+	{
+		const float Ndc = static_cast<float>(Boundary * CLUSTER_SIZE_X) / static_cast<float>(Width) * 2.0f - 1.0f;
+		ColumnSlope[Boundary] = bIsOrthographic ? 0.0f : Ndc / Projection.Data[0][0];
+		ColumnOffset[Boundary] = bIsOrthographic ? (Ndc - Projection.Data[3][0]) / Projection.Data[0][0] : 0.0f;
+
+		// 오른쪽(+x)을 향하는 평면: (x - (Slope * z + Offset)) / |(1, -Slope)|
+		const float InvLength = 1.0f / std::sqrt(1.0f + ColumnSlope[Boundary] * ColumnSlope[Boundary]);
+		ColumnPlaneN[Boundary] = InvLength;
+		ColumnPlaneZ[Boundary] = -ColumnSlope[Boundary] * InvLength;
+		ColumnPlaneD[Boundary] = -ColumnOffset[Boundary] * InvLength;
+	}
+
+	for (uint32 Boundary = 0; Boundary <= ClusterCountY; ++Boundary)
+	{
+		const float Ndc = 1.0f - static_cast<float>(Boundary * CLUSTER_SIZE_Y) / static_cast<float>(Height) * 2.0f;
+		RowSlope[Boundary] = bIsOrthographic ? 0.0f : Ndc / Projection.Data[1][1];
+		RowOffset[Boundary] = bIsOrthographic ? (Ndc - Projection.Data[3][1]) / Projection.Data[1][1] : 0.0f;
+
+		// 화면 아래(-y)를 향하는 평면: ((Slope * z + Offset) - y) / |(1, -Slope)|
+		const float InvLength = 1.0f / std::sqrt(1.0f + RowSlope[Boundary] * RowSlope[Boundary]);
+		RowPlaneN[Boundary] = -InvLength;
+		RowPlaneZ[Boundary] = RowSlope[Boundary] * InvLength;
+		RowPlaneD[Boundary] = RowOffset[Boundary] * InvLength;
+	}
+
+	const float NearClip = std::max(InParams.NearClip, MIN_NEAR_CLIP);
+	const float FarClip = std::max(InParams.FarClip, NearClip);
+	for (uint32 Slice = 0; Slice < CLUSTER_SIZE_Z; ++Slice)
+	{
+		if (bIsOrthographic)
+		{
+			SliceNear[Slice] = NearClip;
+			SliceFar[Slice] = FarClip;
+			continue;
+		}
+
+		// LightingCommon.hlsli의 GetClusterIndexFromSVPos와 같은 지수 분포: Near * (Far / Near)^(k / CLUSTER_SIZE_Z)
+		const double Ratio = static_cast<double>(FarClip) / static_cast<double>(NearClip);
+		SliceNear[Slice] = Slice == 0 ? NearClip :
+			static_cast<float>(NearClip * std::pow(Ratio, static_cast<double>(Slice) / CLUSTER_SIZE_Z));
+		SliceFar[Slice] = Slice + 1 == CLUSTER_SIZE_Z ? FarClip :
+			static_cast<float>(NearClip * std::pow(Ratio, static_cast<double>(Slice + 1) / CLUSTER_SIZE_Z));
+	}
+
+	/** 스포트라이트 원뿔 판정에 쓰는 클러스터 경계 구, 경계 위치가 깊이에 선형이므로 양 끝 깊이만 보면 된다 */
+	const uint32 ClusterCount = GetClusterCount();
+	ClusterCenterX.assign(ClusterCount + 4, 0.0f);
+	ClusterCenterY.assign(ClusterCount + 4, 0.0f);
+	ClusterCenterZ.assign(ClusterCount + 4, 0.0f);
+	ClusterRadius.assign(ClusterCount + 4, 0.0f);
+
+	ParallelFor(InJobSystem, static_cast<int32>(CLUSTER_SIZE_Z), [&](int32 InSlice)
+	{
+		const float NearZ = SliceNear[InSlice];
+		const float FarZ = SliceFar[InSlice];
+
+		auto GetExtent = [NearZ, FarZ](const TArray<float>& InSlope, const TArray<float>& InOffset, uint32 InBoundary,
+			float& OutMin, float& OutMax)
+		{
+			const float Values[4] =
+			{
+				InSlope[InBoundary] * NearZ + InOffset[InBoundary],
+				InSlope[InBoundary] * FarZ + InOffset[InBoundary],
+				InSlope[InBoundary + 1] * NearZ + InOffset[InBoundary + 1],
+				InSlope[InBoundary + 1] * FarZ + InOffset[InBoundary + 1],
+			};
+			OutMin = std::min(std::min(Values[0], Values[1]), std::min(Values[2], Values[3]));
+			OutMax = std::max(std::max(Values[0], Values[1]), std::max(Values[2], Values[3]));
+		};
+
+		for (uint32 Row = 0; Row < ClusterCountY; ++Row)
+		{
+			float MinY, MaxY;
+			GetExtent(RowSlope, RowOffset, Row, MinY, MaxY);
+
+			for (uint32 Column = 0; Column < ClusterCountX; ++Column)
+			{
+				float MinX, MaxX;
+				GetExtent(ColumnSlope, ColumnOffset, Column, MinX, MaxX);
+
+				const size_t ClusterIndex = (static_cast<size_t>(InSlice) * ClusterCountY + Row) * ClusterCountX + Column;
+				const float HalfX = (MaxX - MinX) * 0.5f;
+				const float HalfY = (MaxY - MinY) * 0.5f;
+				const float HalfZ = (FarZ - NearZ) * 0.5f;
+				ClusterCenterX[ClusterIndex] = MinX + HalfX;
+				ClusterCenterY[ClusterIndex] = MinY + HalfY;
+				ClusterCenterZ[ClusterIndex] = NearZ + HalfZ;
+				ClusterRadius[ClusterIndex] = std::sqrt(HalfX * HalfX + HalfY * HalfY + HalfZ * HalfZ);
+			}
+		}
+	});
+}
+
+void FClusteredLightCuller::PrepareLight(const FLightParams& InLight, const FMatrix& InView, FCullLight& OutLight) const
+{
+	OutLight = FCullLight();
+
+	const ELightType LightType = static_cast<ELightType>(static_cast<uint32>(InLight.Direction.W));
+	if (LightType == ELightType::Ambient || LightType == ELightType::Directional)
+	{
+		OutLight.Shape = ECullShape::Global;
+		return;
+	}
+
+	if ((LightType != ELightType::Point && LightType != ELightType::Spot) || !(InLight.Position.W >= 0.0f))
+	{
+		return;
+	}
+
+	TransformByView(InView, InLight.Position.X, InLight.Position.Y, InLight.Position.Z, 1.0f,
+		OutLight.ApexX, OutLight.ApexY, OutLight.ApexZ);
+	OutLight.CenterX = OutLight.ApexX;
+	OutLight.CenterY = OutLight.ApexY;
+	OutLight.CenterZ = OutLight.ApexZ;
+	OutLight.Radius = InLight.Position.W;
+	OutLight.Shape = ECullShape::Sphere;
+
+	if (LightType == ELightType::Point)
+	{
+		return;
+	}
+
+	// 스포트라이트: 90도 이상 벌어지거나 방향이 없으면 점 광원처럼 구로만 판정
+	float DirX, DirY, DirZ;
+	TransformByView(InView, InLight.Direction.X, InLight.Direction.Y, InLight.Direction.Z, 0.0f, DirX, DirY, DirZ);
+	const float DirLength = std::sqrt(DirX * DirX + DirY * DirY + DirZ * DirZ);
+	const float CosAngle = InLight.Angles.Y;
+	if (!(DirLength > 0.0f) || !(CosAngle > 0.0f))
+	{
+		return;
+	}
+
+	OutLight.Shape = ECullShape::Cone;
+	OutLight.DirX = DirX / DirLength;
+	OutLight.DirY = DirY / DirLength;
+	OutLight.DirZ = DirZ / DirLength;
+	OutLight.CosAngle = std::min(CosAngle, 1.0f);
+	OutLight.SinAngle = std::sqrt(std::max(1.0f - OutLight.CosAngle * OutLight.CosAngle, 0.0f));
+	OutLight.Range = InLight.Position.W;
+
+	// 원뿔(밑면은 반지름 Range인 구면)을 감싸는 가장 작은 구
+	const float CenterDistance = OutLight.CosAngle >= COS_QUARTER_PI ?
+		OutLight.Range * 0.5f / OutLight.CosAngle : OutLight.Range * OutLight.CosAngle;
+	OutLight.Radius = OutLight.CosAngle >= COS_QUARTER_PI ? CenterDistance : OutLight.Range * OutLight.SinAngle;
+	OutLight.CenterX = OutLight.ApexX + OutLight.DirX * CenterDistance;
+	OutLight.CenterY = OutLight.ApexY + OutLight.DirY * CenterDistance;
+	OutLight.CenterZ = OutLight.ApexZ + OutLight.DirZ * CenterDistance;
+}
+
+void FClusteredLightCuller::ComputeLightMasks(int32 InLightIndex)
+{
+	FCullLight& Light = CullLights[InLightIndex];
+	if (Light.Shape == ECullShape::None)
+	{
+		return;
+	}
+
+	uint8* Columns = ColumnMasks.data() + static_cast<size_t>(InLightIndex) * ClusterCountX;
+	uint8* Rows = RowMasks.data() + static_cast<size_t>(InLightIndex) * ClusterCountY;
+	uint8* Slices = SliceMasks.data() + static_cast<size_t>(InLightIndex) * CLUSTER_SIZE_Z;
+
+	if (Light.Shape == ECullShape::Global)
+	{
+		memset(Columns, 1, ClusterCountX);
+		memset(Rows, 1, ClusterCountY);
+		memset(Slices, 1, CLUSTER_SIZE_Z);
+		Light.MinX = 0;
+		Light.MaxX = static_cast<int32>(ClusterCountX) - 1;
+		Light.MinY = 0;
+		Light.MaxY = static_cast<int32>(ClusterCountY) - 1;
+		Light.MinZ = 0;
+		Light.MaxZ = static_cast<int32>(CLUSTER_SIZE_Z) - 1;
+		return;
+	}
+
+	const __m128 Radius = _mm_set1_ps(Light.Radius);
+	const __m128 NegativeRadius = _mm_set1_ps(-Light.Radius);
+	const __m128 Depth = _mm_set1_ps(Light.CenterZ);
+
+	// 칸 i는 경계 i 쪽 거리 >= -r, 경계 i + 1 쪽 거리 <= r이면 구와 겹친다 (IsColumnVisible과 같은 판정)
+	auto FillAxisMask = [&](float InPosition, uint32 InCount, const TArray<float>& InN, const TArray<float>& InZ,
+		const TArray<float>& InD, uint8* OutMask, int32& OutMin, int32& OutMax)
+	{
+		const __m128 Position = _mm_set1_ps(InPosition);
+		OutMin = static_cast<int32>(InCount);
+		OutMax = -1;
+		for (uint32 Index = 0; Index < InCount; Index += 4)
+		{
+			const __m128 Low = PlaneDistance4(Position, Depth, &InN[Index], &InZ[Index], &InD[Index]);
+			const __m128 High = PlaneDistance4(Position, Depth, &InN[Index + 1], &InZ[Index + 1], &InD[Index + 1]);
+			const int32 Bits = _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(Low, NegativeRadius), _mm_cmple_ps(High, Radius)));
+
+			const uint32 LaneCount = std::min(4u, InCount - Index);
+			for (uint32 Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				const uint8 bIsVisible = static_cast<uint8>((Bits >> Lane) & 1);
+				OutMask[Index + Lane] = bIsVisible;
+				if (bIsVisible)
+				{
+					OutMin = std::min(OutMin, static_cast<int32>(Index + Lane));
+					OutMax = static_cast<int32>(Index + Lane);
+				}
+			}
+		}
+	};
+
+	FillAxisMask(Light.CenterX, ClusterCountX, ColumnPlaneN, ColumnPlaneZ, ColumnPlaneD, Columns, Light.MinX, Light.MaxX);
+	FillAxisMask(Light.CenterY, ClusterCountY, RowPlaneN, RowPlaneZ, RowPlaneD, Rows, Light.MinY, Light.MaxY);
+
+	Light.MinZ = static_cast<int32>(CLUSTER_SIZE_Z);
+	Light.MaxZ = -1;
+	for (int32 Slice = 0; Slice < static_cast<int32>(CLUSTER_SIZE_Z); ++Slice)
+	{
+		Slices[Slice] = IsSliceVisible(Light, Slice) ? 1 : 0;
+		if (Slices[Slice])
+		{
+			Light.MinZ = std::min(Light.MinZ, Slice);
+			Light.MaxZ = Slice;
+		}
+	}
+}
+
+void FClusteredLightCuller::BuildRow(int32 InSlice, int32 InRow)
+{
+	FRowScratch& Scratch = RowScratches[static_cast<size_t>(InSlice) * ClusterCountY + InRow];
+	Scratch.ColumnLights.resize(ClusterCountX);
+	for (TArray<uint32>& Lights : Scratch.ColumnLights)
+	{
+		Lights.clear();
+	}
+
+	const size_t FirstCluster = (static_cast<size_t>(InSlice) * ClusterCountY + InRow) * ClusterCountX;
+	const __m128 Zero = _mm_setzero_ps();
+
+	for (const uint32 LightIndex : Scratch.Lights)
+	{
+		const FCullLight& Light = CullLights[LightIndex];
+		const uint8* Columns = ColumnMasks.data() + static_cast<size_t>(LightIndex) * ClusterCountX;
+		if (Light.Shape != ECullShape::Cone)
+		{
+			for (int32 Column = Light.MinX; Column <= Light.MaxX; ++Column)
+			{
+				if (Columns[Column])
+				{
+					Scratch.ColumnLights[Column].push_back(LightIndex);
+				}
+			}
+			continue;
+		}
+
+		// 원뿔 - 클러스터 경계 구 판정을 가로로 인접한 클러스터 4개씩 (IsConeVisible과 같은 연산 순서)
+		const __m128 ApexX = _mm_set1_ps(Light.ApexX);
+		const __m128 ApexY = _mm_set1_ps(Light.ApexY);
+		const __m128 ApexZ = _mm_set1_ps(Light.ApexZ);
+		const __m128 DirX = _mm_set1_ps(Light.DirX);
+		const __m128 DirY = _mm_set1_ps(Light.DirY);
+		const __m128 DirZ = _mm_set1_ps(Light.DirZ);
+		const __m128 CosAngle = _mm_set1_ps(Light.CosAngle);
+		const __m128 SinAngle = _mm_set1_ps(Light.SinAngle);
+		const __m128 Range = _mm_set1_ps(Light.Range);
+
+		for (int32 Column = Light.MinX; Column <= Light.MaxX; Column += 4)
+		{
+			const size_t ClusterIndex = FirstCluster + Column;
+			const __m128 SphereRadius = _mm_loadu_ps(&ClusterRadius[ClusterIndex]);
+			const __m128 ToX = _mm_sub_ps(_mm_loadu_ps(&ClusterCenterX[ClusterIndex]), ApexX);
+			const __m128 ToY = _mm_sub_ps(_mm_loadu_ps(&ClusterCenterY[ClusterIndex]), ApexY);
+			const __m128 ToZ = _mm_sub_ps(_mm_loadu_ps(&ClusterCenterZ[ClusterIndex]), ApexZ);
+
+			const __m128 LengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ToX, ToX), _mm_mul_ps(ToY, ToY)), _mm_mul_ps(ToZ, ToZ));
+			const __m128 AxisDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ToX, DirX), _mm_mul_ps(ToY, DirY)), _mm_mul_ps(ToZ, DirZ));
+			const __m128 PerpendicularSquared = _mm_max_ps(_mm_sub_ps(LengthSquared, _mm_mul_ps(AxisDistance, AxisDistance)), Zero);
+			const __m128 ClosestDistance = _mm_sub_ps(_mm_mul_ps(CosAngle, _mm_sqrt_ps(PerpendicularSquared)),
+				_mm_mul_ps(AxisDistance, SinAngle));
+
+			const __m128 Culled = _mm_or_ps(_mm_or_ps(_mm_cmpgt_ps(ClosestDistance, SphereRadius),
+				_mm_cmpgt_ps(AxisDistance, _mm_add_ps(SphereRadius, Range))),
+				_mm_cmplt_ps(AxisDistance, _mm_sub_ps(Zero, SphereRadius)));
+			const int32 VisibleBits = ~_mm_movemask_ps(Culled);
+
+			const int32 LaneCount = std::min(4, Light.MaxX - Column + 1);
+			for (int32 Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				if (((VisibleBits >> Lane) & 1) && Columns[Column + Lane])
+				{
+					Scratch.ColumnLights[Column + Lane].push_back(LightIndex);
+				}
+			}
+		}
+	}
+}
+
+bool FClusteredLightCuller::IsColumnVisible(const FCullLight& InLight, int32 InX) const
+{
+	const float Low = (InLight.CenterX * ColumnPlaneN[InX] + InLight.CenterZ * ColumnPlaneZ[InX]) + ColumnPlaneD[InX];
+	const float High = (InLight.CenterX * ColumnPlaneN[InX + 1] + InLight.CenterZ * ColumnPlaneZ[InX + 1]) + ColumnPlaneD[InX + 1];
+	return Low >= -InLight.Radius && High <= InLight.Radius;
+}
+
+bool FClusteredLightCuller::IsRowVisible(const FCullLight& InLight, int32 InY) const
+{
+	const float Low = (InLight.CenterY * RowPlaneN[InY] + InLight.CenterZ * RowPlaneZ[InY]) + RowPlaneD[InY];
+	const float High = (InLight.CenterY * RowPlaneN[InY + 1] + InLight.CenterZ * RowPlaneZ[InY + 1]) + RowPlaneD[InY + 1];
+	return Low >= -InLight.Radius && High <= InLight.Radius;
+}
+
+bool FClusteredLightCuller::IsSliceVisible(const FCullLight& InLight, int32 InZ) const
+{
+	return InLight.CenterZ + InLight.Radius >= SliceNear[InZ] && InLight.CenterZ - InLight.Radius <= SliceFar[InZ];
+}
+
+bool FClusteredLightCuller::IsConeVisible(const FCullLight& InLight, uint32 InClusterIndex) const
+{
+	const float SphereRadius = ClusterRadius[InClusterIndex];
+	const float ToX = ClusterCenterX[InClusterIndex] - InLight.ApexX;
+	const float ToY = ClusterCenterY[InClusterIndex] - InLight.ApexY;
+	const float ToZ = ClusterCenterZ[InClusterIndex] - InLight.ApexZ;
+
+	const float LengthSquared = (ToX * ToX + ToY * ToY) + ToZ * ToZ;
+	const float AxisDistance = (ToX * InLight.DirX + ToY * InLight.DirY) + ToZ * InLight.DirZ;
+	const float Difference = LengthSquared - AxisDistance * AxisDistance;
+	const float PerpendicularSquared = Difference > 0.0f ? Difference : 0.0f;
+	const float ClosestDistance = InLight.CosAngle * std::sqrt(PerpendicularSquared) - AxisDistance * InLight.SinAngle;
+
+	// 원뿔 측면 밖, 밑면 구 너머, 꼭짓점 뒤 중 하나면 겹치지 않음
+	const bool bIsCulled = ClosestDistance > SphereRadius || AxisDistance > SphereRadius + InLight.Range ||
+		AxisDistance < 0.0f - SphereRadius;
+	return !bIsCulled;
+}
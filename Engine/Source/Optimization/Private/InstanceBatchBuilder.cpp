@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "Optimization/Public/InstanceBatchBuilder.h"
+
+void FInstanceBatchBuilder::Reset()
+{
+	FirstBatchOfMesh.clear();
+	NextBatchOfMesh.clear();
+	Batches.clear();
+	PendingInstances.clear();
+	InstanceData.clear();
+
+	LastMesh = nullptr;
+	LastMaterialSetIndex = -1;
+	LastLODIndex = 0;
+	LastBatchIndex = -1;
+}
+
+size_t FInstanceBatchBuilder::HashMaterials(UMaterial* const* InMaterials, int32 InCount)
+{
+	size_t Hash = static_cast<size_t>(InCount);
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		Hash ^= std::hash<const void*>()(InMaterials[Index]) + 0x9e3779b97f4a7c15ULL + (Hash << 6) + (Hash >> 2);
+	}
+	return Hash;
+}
+
+int32 FInstanceBatchBuilder::FindOrAddMaterialSet(UMaterial* const* InMaterials, int32 InCount)
+{
+	const size_t Hash = HashMaterials(InMaterials, InCount);
+
+	auto BucketIt = MaterialSetBuckets.find(Hash);
+	const int32 BucketHead = BucketIt != MaterialSetBuckets.end() ? BucketIt->second : -1;
+	for (int32 SetIndex = BucketHead; SetIndex >= 0; SetIndex = MaterialSets[SetIndex].NextInBucket)
+	{
+		const FMaterialSetRange& Range = MaterialSets[SetIndex];
+		if (Range.Count == InCount && std::equal(InMaterials, InMaterials + InCount, MaterialSetStorage.begin() + Range.Offset))
+		{
+			return SetIndex;
+		}
+	}
+
+	const int32 NewSetIndex = static_cast<int32>(MaterialSets.size());
+	MaterialSets.push_back({ static_cast<uint32>(MaterialSetStorage.size()), InCount, BucketHead });
+	MaterialSetStorage.insert(MaterialSetStorage.end(), InMaterials, InMaterials + InCount);
+	MaterialSetBuckets[Hash] = NewSetIndex;
+	return NewSetIndex;
+}
+
+int32 FInstanceBatchBuilder::FindOrAddBatch(const FStaticMesh* InMesh, int32 InMaterialSetIndex, int32 InLODIndex, uint32 InSourceIndex, const FMatrix* InPositionToLocal)
+{
+	auto HeadIt = FirstBatchOfMesh.try_emplace(InMesh, -1).first;
+	int32 PrevBatchIndex = -1;
+	for (int32 BatchIndex = HeadIt->second; BatchIndex >= 0; BatchIndex = NextBatchOfMesh[BatchIndex])
+	{
+		if (Batches[BatchIndex].MaterialSetIndex == InMaterialSetIndex && Batches[BatchIndex].LODIndex == InLODIndex)
+		{
+			return BatchIndex;
+		}
+		PrevBatchIndex = BatchIndex;
+	}
+
+	const int32 NewBatchIndex = static_cast<int32>(Batches.size());
+	FInstanceBatch& Batch = Batches.emplace_back();
+	Batch.Mesh = InMesh;
+	Batch.MaterialSetIndex = InMaterialSetIndex;
+	Batch.LODIndex = InLODIndex;
+	Batch.FirstSourceIndex = InSourceIndex;
+	Batch.PositionToLocal = InPositionToLocal;
+	NextBatchOfMesh.push_back(-1);
+
+	if (PrevBatchIndex >= 0)
+	{
+		NextBatchOfMesh[PrevBatchIndex] = NewBatchIndex;
+	}
+	else
+	{
+		HeadIt->second = NewBatchIndex;
+	}
+	return NewBatchIndex;
+}
+
+int32 FInstanceBatchBuilder::AddInstance(const FStaticMesh* InMesh, int32 InMaterialSetIndex, const FMatrix* InWorld, const FMatrix* InWorldInverse,
+	const FMatrix* InPositionToLocal, int32 InLODIndex)
+{
+	// 호출하는 쪽이 메시 순으로 정렬해 넘기므로 대부분 직전 배치에 그대로 들어간다
+	if (InMesh != LastMesh || InMaterialSetIndex != LastMaterialSetIndex || InLODIndex != LastLODIndex)
+	{
+		LastBatchIndex = FindOrAddBatch(InMesh, InMaterialSetIndex, InLODIndex, static_cast<uint32>(PendingInstances.size()), InPositionToLocal);
+		LastMesh = InMesh;
+		LastMaterialSetIndex = InMaterialSetIndex;
+		LastLODIndex = InLODIndex;
+	}
+
+	++Batches[LastBatchIndex].InstanceCount;
+	PendingInstances.push_back({ InWorld, InWorldInverse, LastBatchIndex });
+	return LastBatchIndex;
+}
+
+void FInstanceBatchBuilder::Build()
+{
+	TArray<uint32> Cursors(Batches.size());
+	uint32 Offset = 0;
+	for (size_t BatchIndex = 0; BatchIndex < Batches.size(); ++BatchIndex)
+	{
+		Batches[BatchIndex].FirstInstance = Offset;
+		Cursors[BatchIndex] = Offset;
+		Offset += Batches[BatchIndex].InstanceCount;
+	}
+
+	InstanceData.resize(PendingInstances.size());
+	for (const FPendingInstance& Pending : PendingInstances)
+	{
+		FInstanceData& Instance = InstanceData[Cursors[Pending.BatchIndex]++];
+		// 노멀은 셰이더에서 로컬 방향으로 복원되므로 역전치는 원래 World 기준 그대로 둔다
+		const FMatrix* PositionToLocal = Batches[Pending.BatchIndex].PositionToLocal;
+		Instance.World = PositionToLocal ? *PositionToLocal * *Pending.World : *Pending.World;
+		Instance.WorldInverseTranspose = Pending.WorldInverse->Transpose();
+	}
+}
@@ -0,0 +1,112 @@
+#include "pch.h"
+#include "Optimization/Public/MeshletCuller.h"
+
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+FMeshletCullView FMeshletCuller::MakeView(const FFrustum& InFrustum, const FCameraConstants& InCamera,
+	const FMatrix& InWorld, const FMatrix& InWorldInverse, bool bInBackfaceCulling)
+{
+	FMeshletCullView View;
+
+	// 행 벡터 규약에서 월드 점은 (p, 1) * World이므로 로컬 평면은 World * 평면
+	for (int32 PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+	{
+		const FVector4& Plane = InFrustum.Planes[PlaneIndex];
+		float Local[4];
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			Local[Row] = InWorld.Data[Row][0] * Plane.X + InWorld.Data[Row][1] * Plane.Y + InWorld.Data[Row][2] * Plane.Z + InWorld.Data[Row][3] * Plane.W;
+		}
+		View.Planes[PlaneIndex] = FVector4(Local[0], Local[1], Local[2], Local[3]);
+		View.PlaneNormalLengths[PlaneIndex] = sqrtf(Local[0] * Local[0] + Local[1] * Local[1] + Local[2] * Local[2]);
+	}
+
+	View.bIsOrthographic = InCamera.Projection.Data[3][3] == 1.0f;
+	const FVector4 LocalCamera = FVector4(InCamera.ViewWorldLocation, 1.0f) * InWorldInverse;
+	View.CameraLocation = FVector(LocalCamera.X, LocalCamera.Y, LocalCamera.Z);
+
+	// 뷰 행렬 3x3의 세 번째 열이 월드 공간 시선 방향
+	const FVector4 LocalForward = FVector4(FVector(InCamera.View.Data[0][2], InCamera.View.Data[1][2], InCamera.View.Data[2][2]), 0.0f) * InWorldInverse;
+	View.ViewDirection = FVector(LocalForward.X, LocalForward.Y, LocalForward.Z);
+	const float ForwardLength = View.ViewDirection.Length();
+	View.ViewDirection = ForwardLength > 0.0f ? View.ViewDirection / ForwardLength : FVector();
+
+	const float Determinant =
+		InWorld.Data[0][0] * (InWorld.Data[1][1] * InWorld.Data[2][2] - InWorld.Data[1][2] * InWorld.Data[2][1]) -
+		InWorld.Data[0][1] * (InWorld.Data[1][0] * InWorld.Data[2][2] - InWorld.Data[1][2] * InWorld.Data[2][0]) +
+		InWorld.Data[0][2] * (InWorld.Data[1][0] * InWorld.Data[2][1] - InWorld.Data[1][1] * InWorld.Data[2][0]);
+	View.bIsConeCullingEnabled = bInBackfaceCulling && Determinant > 0.0f && (!View.bIsOrthographic || ForwardLength > 0.0f);
+	return View;
+}
+
+EMeshletVisibility FMeshletCuller::TestMeshlet(const FMeshlet& InMeshlet, const FMeshletCullView& InView)
+{
+	for (int32 PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+	{
+		const FVector4& Plane = InView.Planes[PlaneIndex];
+		if (Plane.Dot3(InMeshlet.Center) + Plane.W > InMeshlet.Radius * InView.PlaneNormalLengths[PlaneIndex])
+		{
+			return EMeshletVisibility::FrustumCulled;
+		}
+	}
+
+	if (InView.bIsConeCullingEnabled && InMeshlet.ConeCutoff < 1.0f)
+	{
+		// 꼭짓점에서 본 카메라 반대 방향이 축과 충분히 가까우면 카메라는 모든 삼각형 평면의 뒤쪽이다
+		if (InView.bIsOrthographic)
+		{
+			if (InView.ViewDirection.Dot(InMeshlet.ConeAxis) >= InMeshlet.ConeCutoff)
+			{
+				return EMeshletVisibility::ConeCulled;
+			}
+		}
+		else
+		{
+			const FVector ToApex = InMeshlet.ConeApex - InView.CameraLocation;
+			const float Distance = ToApex.Length();
+			if (Distance > 0.0f && ToApex.Dot(InMeshlet.ConeAxis) >= InMeshlet.ConeCutoff * Distance)
+			{
+				return EMeshletVisibility::ConeCulled;
+			}
+		}
+	}
+
+	return EMeshletVisibility::Visible;
+}
+
+uint32 FMeshletCuller::Cull(const FStaticMesh& InMesh, const FMeshletCullView& InView, TArray<FMeshletDrawRange>& OutRanges,
+	FMeshletCullStats* OutStats)
+{
+	const size_t FirstRange = OutRanges.size();
+	for (const FMeshlet& Meshlet : InMesh.Meshlets)
+	{
+		const EMeshletVisibility Visibility = TestMeshlet(Meshlet, InView);
+		if (OutStats)
+		{
+			++OutStats->TotalMeshlets;
+			OutStats->TotalTriangles += Meshlet.IndexCount / 3;
+			OutStats->FrustumCulled += Visibility == EMeshletVisibility::FrustumCulled ? 1 : 0;
+			OutStats->ConeCulled += Visibility == EMeshletVisibility::ConeCulled ? 1 : 0;
+		}
+		if (Visibility != EMeshletVisibility::Visible)
+		{
+			continue;
+		}
+		if (OutStats)
+		{
+			OutStats->VisibleTriangles += Meshlet.IndexCount / 3;
+		}
+
+		if (OutRanges.size() > FirstRange)
+		{
+			FMeshletDrawRange& Last = OutRanges.back();
+			if (Last.SectionIndex == Meshlet.SectionIndex && Last.StartIndex + Last.IndexCount == Meshlet.FirstIndex)
+			{
+				Last.IndexCount += Meshlet.IndexCount;
+				continue;
+			}
+		}
+		OutRanges.push_back({ Meshlet.SectionIndex, Meshlet.FirstIndex, Meshlet.IndexCount });
+	}
+	return static_cast<uint32>(OutRanges.size() - FirstRange);
+}
@@ -1,416 +1,611 @@
 ﻿#include "pch.h"
 #include "Optimization/Public/OcclusionCuller.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
+#include "Core/Public/JobSystem.h"
+#include "Core/Public/Object.h"
+#include "Optimization/Public/PrimitiveBoundsSoA.h"
+#include "Texture/Public/Material.h"
 
-#include "Level/Public/Level.h"
-#include "Global/Octree.h"
+#include <emmintrin.h>
 
-COcclusionCuller::COcclusionCuller()
-{ 
-    CPU_ZBuffer.resize(Z_BUFFER_SIZE);
+namespace
+{
+	/** @brief 이보다 작은 W(카메라 앞 거리)는 근평면을 넘은 것으로 보고 오클루더/오클루디 모두 보수적으로 처리 */
+	constexpr float MIN_CLIP_W = 1e-5f;
+
+	/** @brief 화면 좌표가 이 범위를 넘는 삼각형은 엣지 함수의 float 정밀도가 떨어지므로 오클루더에서 제외 */
+	constexpr float GUARD_BAND = 16384.0f;
+
+	/** @brief 오클루디의 최근접 깊이를 이만큼 당겨 비교, 맞닿거나 같은 평면의 오클루더 보간 오차로 스스로 가려지지 않도록 한다 */
+	constexpr float DEPTH_BIAS = 1e-5f;
+
+	/** @brief 행 벡터 규약(p * M)의 4x4 행렬을 열 단위로 레인 4개에 복제 */
+	struct FMatrix4
+	{
+		__m128 M[4][4];
+
+		explicit FMatrix4(const FMatrix& InMatrix)
+		{
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Column = 0; Column < 4; ++Column)
+				{
+					M[Row][Column] = _mm_set1_ps(InMatrix.Data[Row][Column]);
+				}
+			}
+		}
+
+		__m128 Transform(__m128 InX, __m128 InY, __m128 InZ, int32 InColumn) const
+		{
+			return _mm_add_ps(_mm_add_ps(_mm_mul_ps(InX, M[0][InColumn]), _mm_mul_ps(InY, M[1][InColumn])),
+				_mm_add_ps(_mm_mul_ps(InZ, M[2][InColumn]), M[3][InColumn]));
+		}
+	};
+
+	inline float HorizontalMin(__m128 InValue)
+	{
+		InValue = _mm_min_ps(InValue, _mm_shuffle_ps(InValue, InValue, _MM_SHUFFLE(1, 0, 3, 2)));
+		InValue = _mm_min_ps(InValue, _mm_shuffle_ps(InValue, InValue, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_cvtss_f32(InValue);
+	}
+
+	inline float HorizontalMax(__m128 InValue)
+	{
+		InValue = _mm_max_ps(InValue, _mm_shuffle_ps(InValue, InValue, _MM_SHUFFLE(1, 0, 3, 2)));
+		InValue = _mm_max_ps(InValue, _mm_shuffle_ps(InValue, InValue, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_cvtss_f32(InValue);
+	}
+
+	/** @brief 박스 8개 꼭짓점(비트 0 = X, 1 = Y, 2 = Z가 Max)으로 만든 12개 삼각형, 바깥에서 볼 때 반시계 방향 */
+	constexpr uint32 BOX_INDICES[36] =
+	{
+		0, 1, 2, 1, 3, 2, // -Z
+		4, 6, 5, 5, 6, 7, // +Z
+		0, 4, 1, 1, 4, 5, // -Y
+		2, 3, 6, 3, 7, 6, // +Y
+		0, 2, 4, 2, 6, 4, // -X
+		1, 5, 3, 3, 5, 7, // +X
+	};
+
+	/** @brief 오클루더로 쓸 수 있는 불투명 스태틱 메시면 메시를, 아니면 nullptr 반환 */
+	UStaticMesh* GetOccluderMesh(UPrimitiveComponent* InPrimitive)
+	{
+		UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(InPrimitive);
+		if (!MeshComponent || !MeshComponent->IsVisible())
+		{
+			return nullptr;
+		}
+
+		UStaticMesh* StaticMesh = MeshComponent->GetStaticMesh();
+		if (!StaticMesh)
+		{
+			return nullptr;
+		}
+
+		// 반투명하거나 알파 텍스처가 있는 재질은 뒤를 완전히 가리지 않는다
+		for (int32 MaterialIndex = 0; MaterialIndex < StaticMesh->GetNumMaterials(); ++MaterialIndex)
+		{
+			const UMaterial* Material = MeshComponent->GetMaterial(MaterialIndex);
+			if (Material && (Material->GetAlphaTexture() || Material->GetDissolveFactor() < 1.0f))
+			{
+				return nullptr;
+			}
+		}
+
+		return StaticMesh;
+	}
 }
 
-void COcclusionCuller::InitializeCuller(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix)
+COcclusionCuller::COcclusionCuller()
 {
-    fill(CPU_ZBuffer.begin(), CPU_ZBuffer.end(), 1.0f);
-    CurrentViewProj = ViewMatrix * ProjectionMatrix;
+	DepthBuffer.resize(TILE_COUNT * TILE_PIXEL_COUNT, 1.0f);
+	TileMinDepth.resize(TILE_COUNT, 1.0f);
+	TileMaxDepth.resize(TILE_COUNT, 1.0f);
+	TileBins.resize(TILE_COUNT);
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
-{    
-    Frame++;
-    // 0. Primitive AABB 데이터 채우기
-    CachedAABBs.clear();
-    for (int32 i = 0; i < AllPrimitives.size(); ++i)
-    {
-        UPrimitiveComponent* PrimitiveComp = AllPrimitives[i];
-        if (!PrimitiveComp) continue;
-
-        FWorldAABBData Data;
-        Data.Prim = PrimitiveComp;
-        PrimitiveComp->GetWorldAABB(Data.Min, Data.Max);
-        Data.Center = (Data.Min + Data.Max) * 0.5f;
-        CachedAABBs.push_back(Data);
-
-        // 인덱스를 컴포넌트에 직접 캐시
-        PrimitiveComp->CachedAABBIndex = i;
-        PrimitiveComp->CachedFrame = Frame;
-    }
-
-
-    // 1. 오클루더 동적 선택
-    ULevel* CurrentLevel = GWorld->GetLevel();
-    TArray<UPrimitiveComponent*> OccluderCandidates = CurrentLevel->GetStaticOctree()->FindNearestPrimitives(CameraPos, AllPrimitives.size() / 10);
-    TArray<UPrimitiveComponent*> SelectedOccluders = SelectOccluders(OccluderCandidates, CameraPos);
-
-    // 2. CPU Z-Buffer 구성
-    RasterizeOccluders(SelectedOccluders, CameraPos);
-
-    // 3. 가시성 테스트
-    VisibleMeshComponents.clear();
-    for (auto& AABBData : CachedAABBs)
-    {
-        if (IsMeshVisible(AABBData))
-        {
-            VisibleMeshComponents.push_back(AABBData.Prim);
-        }
-    }
-
-    return VisibleMeshComponents;
+void COcclusionCuller::Cull(TArray<UPrimitiveComponent*>& InOutPrimitives, const FCameraConstants& InViewProjConstants,
+	const FPrimitiveBoundsSoA* InPrimitiveBounds, FJobSystem* InJobSystem)
+{
+	const int32 CandidateCount = static_cast<int32>(InOutPrimitives.size());
+	LastTestedCount = CandidateCount;
+	LastOccludedCount = 0;
+
+	// 가릴 대상과 가리는 물체가 모두 있어야 의미가 있다
+	if (CandidateCount < 2)
+	{
+		return;
+	}
+
+	BeginFrame(InViewProjConstants.View * InViewProjConstants.Projection);
+
+	// 1. 후보 경계를 한 번만 읽어 두고, 화면에서 크게 보이는 불투명 스태틱 메시를 오클루더 후보로 모은다
+	CandidateMin.resize(CandidateCount);
+	CandidateMax.resize(CandidateCount);
+	CandidateHasBounds.assign(CandidateCount, 0);
+	CandidateIsOccluder.assign(CandidateCount, 0);
+	OccluderCandidates.clear();
+
+	const FVector& CameraLocation = InViewProjConstants.ViewWorldLocation;
+	for (int32 Index = 0; Index < CandidateCount; ++Index)
+	{
+		// 레벨에 등록되지 않은 프리미티브는 경계를 믿을 수 없으므로 검사하지 않고 항상 그린다
+		UPrimitiveComponent* Primitive = InOutPrimitives[Index];
+		if (!InPrimitiveBounds || !InPrimitiveBounds->Contains(Primitive))
+		{
+			continue;
+		}
+
+		InPrimitiveBounds->GetBounds(Primitive->PrimitiveBoundsIndex, CandidateMin[Index], CandidateMax[Index]);
+		CandidateHasBounds[Index] = 1;
+
+		if (!GetOccluderMesh(Primitive))
+		{
+			continue;
+		}
+
+		const FVector Center = (CandidateMin[Index] + CandidateMax[Index]) * 0.5f;
+		const float RadiusSquared = ((CandidateMax[Index] - CandidateMin[Index]) * 0.5f).LengthSquared();
+		const float DistanceSquared = FVector::DistSquared(CameraLocation, Center);
+
+		// 카메라가 경계 안에 있으면 삼각형 대부분이 근평면에 걸려 버려지므로 후보에서 뺀다
+		if (DistanceSquared <= RadiusSquared)
+		{
+			continue;
+		}
+
+		const float ScreenSize = RadiusSquared / DistanceSquared;
+		if (ScreenSize >= MIN_OCCLUDER_SCREEN_SIZE)
+		{
+			OccluderCandidates.emplace_back(ScreenSize, Index);
+		}
+	}
+
+	if (OccluderCandidates.empty())
+	{
+		return;
+	}
+
+	// 2. 화면에서 큰 오클루더부터 삼각형 예산이 찰 때까지 투영하고 래스터화
+	std::sort(OccluderCandidates.begin(), OccluderCandidates.end(),
+		[](const std::pair<float, int32>& A, const std::pair<float, int32>& B) { return A.first > B.first; });
+
+	for (const std::pair<float, int32>& Candidate : OccluderCandidates)
+	{
+		if (GetOccluderTriangleCount() >= OCCLUDER_TRIANGLE_BUDGET)
+		{
+			break;
+		}
+
+		UPrimitiveComponent* Primitive = InOutPrimitives[Candidate.second];
+		const UStaticMesh* StaticMesh = GetOccluderMesh(Primitive);
+		const TArray<FNormalVertex>& Vertices = StaticMesh->GetVertices();
+		const TArray<uint32>& Indices = StaticMesh->GetIndices();
+
+		if (Indices.size() / 3 > MAX_OCCLUDER_MESH_TRIANGLES)
+		{
+			continue;
+		}
+
+		if (AddOccluderMesh(Vertices.data(), static_cast<int32>(Vertices.size()), Indices.data(), static_cast<int32>(Indices.size()),
+			Primitive->GetWorldTransformMatrix(), true) > 0)
+		{
+			CandidateIsOccluder[Candidate.second] = 1;
+		}
+	}
+
+	if (Triangles.empty())
+	{
+		return;
+	}
+
+	RasterizeOccluders(InJobSystem);
+
+	// 3. 보이는 후보만 앞으로 당겨 원래 순서를 유지한다
+	// 래스터화된 오클루더는 자기 깊이와 비교하게 되므로 검사하지 않고 남긴다
+	int32 VisibleCount = 0;
+	for (int32 Index = 0; Index < CandidateCount; ++Index)
+	{
+		if (!CandidateHasBounds[Index] || CandidateIsOccluder[Index] || IsVisible(CandidateMin[Index], CandidateMax[Index]))
+		{
+			InOutPrimitives[VisibleCount++] = InOutPrimitives[Index];
+		}
+	}
+
+	InOutPrimitives.resize(VisibleCount);
+	LastOccludedCount = CandidateCount - VisibleCount;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::SelectOccluders(const TArray<UPrimitiveComponent*>& Candidates, const FVector& CameraPos)
+void COcclusionCuller::BeginFrame(const FMatrix& InViewProj)
 {
-    FilteredOccluders.clear();
-
-    for (UPrimitiveComponent* Occluder : Candidates)
-    {
-        if (Occluder->CachedFrame != Frame) { continue; }
-        FWorldAABBData& Data = CachedAABBs[Occluder->CachedAABBIndex];
-
-        float AABB_Diagonal_LengthSq = FVector::DistSquared(Data.Min, Data.Max);
-        float DistanceToOccluderSq = FVector::DistSquared(CameraPos, Data.Center);
-
-        if (DistanceToOccluderSq < AABB_Diagonal_LengthSq) { continue; }
-
-        FilteredOccluders.push_back(Occluder);
-    }
-    return FilteredOccluders;
+	ViewProj = InViewProj;
+	Triangles.clear();
+	for (TArray<int32>& Bin : TileBins)
+	{
+		Bin.clear();
+	}
 }
 
-void COcclusionCuller::RasterizeOccluders(const TArray<UPrimitiveComponent*>& SelectedOccluders, const FVector& CameraPos)
+int32 COcclusionCuller::AddOccluderMesh(const FNormalVertex* InVertices, int32 InVertexCount, const uint32* InIndices, int32 InIndexCount,
+	const FMatrix& InWorld, bool bInCullBackFace)
 {
-    for (UPrimitiveComponent* OccluderComp : SelectedOccluders)
-    {
-        if (OccluderComp->CachedFrame != Frame) { continue; }
-        // 1. AABB를 12개 삼각형의 월드 정점 리스트로 변환
-        TArray<FVector> BoxTriangles = ConvertAABBToTriangles(OccluderComp);
-
-        // 2. CPU 래스터라이징
-        for (uint32 Idx = 0; Idx < BoxTriangles.size(); Idx += 3)
-        {
-            // 삼각형의 세 정점 (월드 좌표)
-            const FVector& P1_World = BoxTriangles[Idx];
-            const FVector& P2_World = BoxTriangles[Idx + 1];
-            const FVector& P3_World = BoxTriangles[Idx + 2];
-
-            // 정점을 화면 좌표로 투영
-            FVector P1_Screen = Project(P1_World);
-            FVector P2_Screen = Project(P2_World);
-            FVector P3_Screen = Project(P3_World);
-
-            // Backface Culling
-            FVector2 V1(P2_Screen.X - P1_Screen.X, P2_Screen.Y - P1_Screen.Y);
-            FVector2 V2(P3_Screen.X - P1_Screen.X, P3_Screen.Y - P1_Screen.Y);
-
-            // 2D 외적 (Z 성분만)
-            float CrossZ = V1.X * V2.Y - V1.Y * V2.X;
-            if (CrossZ < 0.0f) { continue; }
-
-            // Z-Buffer에 깊이 쓰기
-            RasterizeTriangle(P1_Screen, P2_Screen, P3_Screen, CPU_ZBuffer);
-        }
-    }
+	if (!InVertices || !InIndices || InVertexCount <= 0)
+	{
+		return 0;
+	}
+
+	ProjectVertices(reinterpret_cast<const uint8*>(&InVertices[0].Position), sizeof(FNormalVertex), InVertexCount, InWorld * ViewProj);
+
+	int32 AddedCount = 0;
+	for (int32 Index = 0; Index + 2 < InIndexCount; Index += 3)
+	{
+		const uint32 Index0 = InIndices[Index];
+		const uint32 Index1 = InIndices[Index + 1];
+		const uint32 Index2 = InIndices[Index + 2];
+		if (Index0 >= static_cast<uint32>(InVertexCount) || Index1 >= static_cast<uint32>(InVertexCount) ||
+			Index2 >= static_cast<uint32>(InVertexCount))
+		{
+			continue;
+		}
+
+		AddedCount += AddTriangle(Index0, Index1, Index2, bInCullBackFace) ? 1 : 0;
+	}
+	return AddedCount;
 }
 
-FVector COcclusionCuller::Project(const FVector& WorldPos) const
+int32 COcclusionCuller::AddOccluderBox(const FVector& InMin, const FVector& InMax)
 {
-    FVector4 WorldPos4(WorldPos.X, WorldPos.Y, WorldPos.Z, 1.0f);
-    FVector4 ClipPos = WorldPos4 * CurrentViewProj;
-
-    if (ClipPos.W != 0.0f)
-    {
-        ClipPos.X /= ClipPos.W;
-        ClipPos.Y /= ClipPos.W;
-        ClipPos.Z /= ClipPos.W;
-    }
-
-    // NDC to Screen
-    float ScreenX = (ClipPos.X + 1.0f) * 0.5f * Z_BUFFER_WIDTH;
-    float ScreenY = (1.0f - ClipPos.Y) * 0.5f * Z_BUFFER_HEIGHT;
-    float ScreenZ = ClipPos.Z;
-
-    return FVector(ScreenX, ScreenY, ScreenZ);
+	FVector Corners[8];
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		Corners[Corner] = FVector(
+			(Corner & 1) ? InMax.X : InMin.X,
+			(Corner & 2) ? InMax.Y : InMin.Y,
+			(Corner & 4) ? InMax.Z : InMin.Z);
+	}
+
+	ProjectVertices(reinterpret_cast<const uint8*>(Corners), sizeof(FVector), 8, ViewProj);
+
+	int32 AddedCount = 0;
+	for (int32 Index = 0; Index < 36; Index += 3)
+	{
+		AddedCount += AddTriangle(BOX_INDICES[Index], BOX_INDICES[Index + 1], BOX_INDICES[Index + 2], true) ? 1 : 0;
+	}
+	return AddedCount;
 }
 
-bool COcclusionCuller::IsMeshVisible(const FWorldAABBData& AABBData)
+void COcclusionCuller::ProjectVertices(const uint8* InFirstPosition, int32 InStride, int32 InCount, const FMatrix& InMatrix)
 {
-    const FVector& WorldMin = AABBData.Min;
-    const FVector& WorldMax = AABBData.Max;
-    const FVector& WorldCenter = AABBData.Center;
-
-    constexpr int32 NumSamples = 19;
-    FVector OriginalSamplesArray[NumSamples];
-    int32 Index = 0; // 배열 인덱스 카운터
-
-    // 1개 중심점
-    OriginalSamplesArray[Index++] = WorldCenter;
-
-    // 6개 면 중심
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldCenter.Y, WorldMax.Z);
-
-    // 12개 엣지 중심
-    // X 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldMax.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldMax.Z);
-
-    // Y 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldMax.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldMax.Z);
-
-    // Z 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldMax.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldMax.Y, WorldCenter.Z);
-
-    // SIMD 배치 처리를 위해 20개로 패딩
-    const int32 BatchCount = (NumSamples + 3) / 4;
-
-    for (int32 i = 0; i < 19; ++i)
-    {
-        SampleCoords[0][i] = OriginalSamplesArray[i].X;  // X
-        SampleCoords[1][i] = OriginalSamplesArray[i].Y;  // Y
-        SampleCoords[2][i] = OriginalSamplesArray[i].Z;  // Z
-    }
-
-    // 패딩
-    for (int32 i = 19; i < 20; ++i)
-    {
-        SampleCoords[0][i] = 1e30f;
-        SampleCoords[1][i] = 1e30f;
-        SampleCoords[2][i] = 1e30f;
-    }
-
-    constexpr float Z_TOLERANCE = 0.001f;
-    for (int32 BatchIdx = 0; BatchIdx < BatchCount; ++BatchIdx)
-    {
-        BatchProjectionInput Input;
-        Input.WorldX = _mm_load_ps(&SampleCoords[0][BatchIdx * 4]);
-        Input.WorldY = _mm_load_ps(&SampleCoords[1][BatchIdx * 4]);
-        Input.WorldZ = _mm_load_ps(&SampleCoords[2][BatchIdx * 4]);
-
-        BatchProjectionResult ProjectionResult = BatchProject4(Input);
-
-        // 멤버 배열에 저장
-        _mm_store_si128((__m128i*)TempPixelCoords[0], ProjectionResult.PixelX);
-        _mm_store_si128((__m128i*)TempPixelCoords[1], ProjectionResult.PixelY);
-        _mm_store_ps(TempScreenZ, ProjectionResult.ScreenZ);
-
-        for (int32 i = 0; i < 4; ++i)
-        {
-            int32 SampleIdx = BatchIdx * 4 + i;
-            if (SampleIdx >= 19) break;
-
-            int32 X = TempPixelCoords[0][i];  // PixelX
-            int32 Y = TempPixelCoords[1][i];  // PixelY
-
-            if (X >= 0 && X < Z_BUFFER_WIDTH && Y >= 0 && Y < Z_BUFFER_HEIGHT)
-            {
-                int32 Index = Y * Z_BUFFER_WIDTH + X;
-                if (TempScreenZ[i] < CPU_ZBuffer[Index] + Z_TOLERANCE)
-                {
-                    return true;
-                }
-            }
-        }
-    }
-    return false;
-}
+	// 4개 묶음 저장이 배열 끝을 넘지 않도록 여유를 둔다
+	const size_t PaddedCount = static_cast<size_t>(InCount + 3);
+	ScreenX.resize(PaddedCount);
+	ScreenY.resize(PaddedCount);
+	ScreenZ.resize(PaddedCount);
+	ClipW.resize(PaddedCount);
+
+	const FMatrix4 Matrix(InMatrix);
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 MinW = _mm_set1_ps(MIN_CLIP_W);
+	const __m128 HalfWidth = _mm_set1_ps(Z_BUFFER_WIDTH * 0.5f);
+	const __m128 HalfHeight = _mm_set1_ps(Z_BUFFER_HEIGHT * 0.5f);
+
+	auto GetPosition = [InFirstPosition, InStride, InCount](int32 InIndex) -> const FVector&
+	{
+		return *reinterpret_cast<const FVector*>(InFirstPosition + static_cast<size_t>(std::min(InIndex, InCount - 1)) * InStride);
+	};
+
+	for (int32 First = 0; First < InCount; First += 4)
+	{
+		const FVector& P0 = GetPosition(First);
+		const FVector& P1 = GetPosition(First + 1);
+		const FVector& P2 = GetPosition(First + 2);
+		const FVector& P3 = GetPosition(First + 3);
+
+		const __m128 X = _mm_setr_ps(P0.X, P1.X, P2.X, P3.X);
+		const __m128 Y = _mm_setr_ps(P0.Y, P1.Y, P2.Y, P3.Y);
+		const __m128 Z = _mm_setr_ps(P0.Z, P1.Z, P2.Z, P3.Z);
+
+		const __m128 ClipX = Matrix.Transform(X, Y, Z, 0);
+		const __m128 ClipY = Matrix.Transform(X, Y, Z, 1);
+		const __m128 ClipZ = Matrix.Transform(X, Y, Z, 2);
+		const __m128 W = Matrix.Transform(X, Y, Z, 3);
+
+		// 근평면 앞(W > 0, Z >= 0)인 정점만 유효, 나머지는 W를 -1로 표시하고 0으로 나누지 않도록 1로 나눈다
+		const __m128 Valid = _mm_and_ps(_mm_cmpgt_ps(W, MinW), _mm_cmpge_ps(ClipZ, Zero));
+		const __m128 InvW = _mm_div_ps(One, _mm_or_ps(_mm_and_ps(Valid, W), _mm_andnot_ps(Valid, One)));
+
+		_mm_storeu_ps(&ScreenX[First], _mm_mul_ps(_mm_add_ps(_mm_mul_ps(ClipX, InvW), One), HalfWidth));
+		_mm_storeu_ps(&ScreenY[First], _mm_mul_ps(_mm_sub_ps(One, _mm_mul_ps(ClipY, InvW)), HalfHeight));
+		_mm_storeu_ps(&ScreenZ[First], _mm_mul_ps(ClipZ, InvW));
+		_mm_storeu_ps(&ClipW[First], _mm_or_ps(_mm_and_ps(Valid, W), _mm_andnot_ps(Valid, _mm_sub_ps(Zero, One))));
+	}
 
-BatchProjectionResult COcclusionCuller::BatchProject4(const BatchProjectionInput& Input) const
-{    
-    // 1. 4개 월드 좌표를 동질 좌표로 변환 (W = 1.0f)
-    __m128 Ones = _mm_set1_ps(1.0f);
-
-    // 2. ViewProjection 행렬 접근
-    const float* MatrixData = (const float*)&CurrentViewProj;
-
-    __m128 Row0 = _mm_load_ps(&MatrixData[0]);
-    __m128 Row1 = _mm_load_ps(&MatrixData[4]);
-    __m128 Row2 = _mm_load_ps(&MatrixData[8]);
-    __m128 Row3 = _mm_load_ps(&MatrixData[12]);
-
-    __m128 ClipX = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0x00)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0x00))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0x00))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0x00)));
-
-    __m128 ClipY = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0x55)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0x55))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0x55))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0x55)));
-
-    __m128 ClipZ = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0xAA)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0xAA))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0xAA))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0xAA)));
-
-    __m128 ClipW = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0xFF)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0xFF))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0xFF))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0xFF)));
-
-    // -----------------------------------------------------------
-    // 3. Perspective divide 안전성 체크 및 수행
-    // -----------------------------------------------------------
-
-    // 3-1. W > 0 (프러스텀 앞)인 항목만 유효하게 만듦
-    __m128 W_is_positive = _mm_cmpgt_ps(ClipW, _mm_set1_ps(1e-6f)); // W > 0.000001f
-
-    // 3-2. 역수 (InvW) 계산
-    __m128 SafeW = _mm_or_ps(ClipW, _mm_andnot_ps(W_is_positive, Ones));
-    // W > 0이면 ClipW, 아니면 1.0f (0으로 나누는 것을 방지)
-
-    __m128 InvW = _mm_div_ps(Ones, SafeW);
-
-    // 3-3. W <= 0 (Near Plane 뒤)인 항목은 InvW를 0으로 마스킹
-    InvW = _mm_and_ps(InvW, W_is_positive);
-
-    // 역투영
-    ClipX = _mm_mul_ps(ClipX, InvW);
-    ClipY = _mm_mul_ps(ClipY, InvW);
-    ClipZ = _mm_mul_ps(ClipZ, InvW);
-    // W <= 0인 좌표는 ClipX/Y/Z = 0이 되므로, NDC 밖(-1 또는 1)으로 튀어나가지 않음
-
-    // -----------------------------------------------------------
-    // 4. NDC to Screen coordinates (4개 동시)
-    // -----------------------------------------------------------
-    __m128 HalfWidth = _mm_set1_ps(Z_BUFFER_WIDTH * 0.5f);
-    __m128 HalfHeight = _mm_set1_ps(Z_BUFFER_HEIGHT * 0.5f);
-
-    BatchProjectionResult Result;
-    // X: (ClipX + 1.0) * 0.5 * Width
-    Result.ScreenX = _mm_mul_ps(_mm_add_ps(ClipX, Ones), HalfWidth);
-    // Y: (1.0 - ClipY) * 0.5 * Height
-    Result.ScreenY = _mm_mul_ps(_mm_sub_ps(Ones, ClipY), HalfHeight);
-    Result.ScreenZ = ClipZ; // ScreenZ (NDC Z)
-
-    // 5. 정수형 픽셀 좌표로 변환
-    // _mm_cvtps_epi32는 기본적으로 TRUNCATE (버림)을 수행
-    Result.PixelX = _mm_cvtps_epi32(Result.ScreenX);
-    Result.PixelY = _mm_cvtps_epi32(Result.ScreenY);
-
-    return Result;
 }
 
-void COcclusionCuller::RasterizeTriangle(const FVector& P1, const FVector& P2, const FVector& P3, TArray<float>& ZBuffer)
-{        
-    // 1. 바운딩 박스 계산
-    int32 MinX = max(0, (int32)min({ P1.X, P2.X, P3.X }));
-    int32 MaxX = min(Z_BUFFER_WIDTH - 1, (int32)max({ P1.X, P2.X, P3.X }));
-    int32 MinY = max(0, (int32)min({ P1.Y, P2.Y, P3.Y }));
-    int32 MaxY = min(Z_BUFFER_HEIGHT - 1, (int32)max({ P1.Y, P2.Y, P3.Y }));
-
-    // 3. 삼각형 면적 계산 (degenerate triangle 체크용)
-    float Area = 0.5f * abs((P2.X - P1.X) * (P3.Y - P1.Y) - (P3.X - P1.X) * (P2.Y - P1.Y));
-    if (Area < 0.001f) { return; }
-
-    // 4. Barycentric 좌표 계산을 위한 분모 미리 계산 (최적화)
-    float Denom1 = (P2.X - P3.X) * (P1.Y - P3.Y) - (P2.Y - P3.Y) * (P1.X - P3.X);
-    float Denom2 = (P3.X - P1.X) * (P2.Y - P1.Y) - (P3.Y - P1.Y) * (P2.X - P1.X);
-
-    // 5. 분모가 0에 가까우면 degenerate triangle
-    if (abs(Denom1) < 0.0001f || abs(Denom2) < 0.0001f) { return; }
-
-    // 6. 역수 미리 계산
-    float InvDenom1 = 1.0f / Denom1;
-    float InvDenom2 = 1.0f / Denom2;
-
-    // 7. 바운딩 박스 내의 모든 픽셀에 대해 검사
-    for (int32 Y = MinY; Y <= MaxY; ++Y)
-    {
-        for (int32 X = MinX; X <= MaxX; ++X)
-        {
-            // 픽셀 중심점
-            float PixelX = X + 0.5f;
-            float PixelY = Y + 0.5f;
-
-            // Barycentric coordinates 계산 (최적화된 버전)
-            float W1 = ((P2.X - P3.X) * (PixelY - P3.Y) - (P2.Y - P3.Y) * (PixelX - P3.X)) * InvDenom1;
-            float W2 = ((P3.X - P1.X) * (PixelY - P1.Y) - (P3.Y - P1.Y) * (PixelX - P1.X)) * InvDenom2;
-            float W3 = 1.0f - W1 - W2;
-
-            const float EPSILON = -0.0001f; // 경계 케이스 처리
-            if (W1 >= EPSILON && W2 >= EPSILON && W3 >= EPSILON)
-            {
-                // 깊이값 보간
-                float InterpolatedZ = W1 * P1.Z + W2 * P2.Z + W3 * P3.Z;
-
-                int32 Index = Y * Z_BUFFER_WIDTH + X;
-
-                // 깊이 테스트 및 업데이트
-                if (InterpolatedZ < ZBuffer[Index])
-                {
-                    ZBuffer[Index] = InterpolatedZ;
-                }
-            }
-        }
-    }
+bool COcclusionCuller::AddTriangle(int32 InIndex0, int32 InIndex1, int32 InIndex2, bool bInCullBackFace)
+{
+	if (GetOccluderTriangleCount() >= OCCLUDER_TRIANGLE_BUDGET)
+	{
+		return false;
+	}
+
+	// 근평면을 넘는 삼각형은 클리핑하지 않고 버린다 (오클루더가 줄어들 뿐 잘못 가리지는 않음)
+	if (ClipW[InIndex0] <= 0.0f || ClipW[InIndex1] <= 0.0f || ClipW[InIndex2] <= 0.0f)
+	{
+		return false;
+	}
+
+	int32 Index[3] = { InIndex0, InIndex1, InIndex2 };
+	for (int32 Vertex = 0; Vertex < 3; ++Vertex)
+	{
+		if (std::abs(ScreenX[Index[Vertex]]) > GUARD_BAND || std::abs(ScreenY[Index[Vertex]]) > GUARD_BAND)
+		{
+			return false;
+		}
+	}
+
+	// Y가 아래로 증가하는 화면에서의 외적, FrontCounterClockwise 래스터라이저 상태에서는 음수가 앞면이다
+	float Area = (ScreenX[Index[1]] - ScreenX[Index[0]]) * (ScreenY[Index[2]] - ScreenY[Index[0]]) -
+		(ScreenY[Index[1]] - ScreenY[Index[0]]) * (ScreenX[Index[2]] - ScreenX[Index[0]]);
+	if (std::abs(Area) < 1e-6f || (bInCullBackFace && Area > 0.0f))
+	{
+		return false;
+	}
+
+	// 엣지 함수가 안쪽에서 양수가 되도록 항상 같은 감김 방향으로 맞춘다
+	if (Area < 0.0f)
+	{
+		std::swap(Index[1], Index[2]);
+		Area = -Area;
+	}
+
+	const float X[3] = { ScreenX[Index[0]], ScreenX[Index[1]], ScreenX[Index[2]] };
+	const float Y[3] = { ScreenY[Index[0]], ScreenY[Index[1]], ScreenY[Index[2]] };
+	const float Z[3] = { ScreenZ[Index[0]], ScreenZ[Index[1]], ScreenZ[Index[2]] };
+
+	// 픽셀 중심(i + 0.5)이 삼각형 경계 상자 안에 드는 픽셀 범위
+	FOccluderTriangle Triangle;
+	Triangle.MinX = std::max(0, static_cast<int32>(std::ceil(std::min({ X[0], X[1], X[2] }) - 0.5f)));
+	Triangle.MaxX = std::min(Z_BUFFER_WIDTH - 1, static_cast<int32>(std::floor(std::max({ X[0], X[1], X[2] }) - 0.5f)));
+	Triangle.MinY = std::max(0, static_cast<int32>(std::ceil(std::min({ Y[0], Y[1], Y[2] }) - 0.5f)));
+	Triangle.MaxY = std::min(Z_BUFFER_HEIGHT - 1, static_cast<int32>(std::floor(std::max({ Y[0], Y[1], Y[2] }) - 0.5f)));
+	if (Triangle.MinX > Triangle.MaxX || Triangle.MinY > Triangle.MaxY)
+	{
+		return false;
+	}
+
+	// 엣지 Edge(i -> i + 1)는 맞은편 정점에서 Area, 두 끝점에서 0이 되는 A * x + B * y + C
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		const int32 Next = (Edge + 1) % 3;
+		Triangle.EdgeA[Edge] = Y[Edge] - Y[Next];
+		Triangle.EdgeB[Edge] = X[Next] - X[Edge];
+		Triangle.EdgeC[Edge] = -(Triangle.EdgeA[Edge] * X[Edge] + Triangle.EdgeB[Edge] * Y[Edge]);
+	}
+
+	// 깊이 평면 Z = Z0 + (Z1 - Z0) * Edge2 / Area + (Z2 - Z0) * Edge0 / Area
+	const float InvArea = 1.0f / Area;
+	const float DeltaZ1 = (Z[1] - Z[0]) * InvArea;
+	const float DeltaZ2 = (Z[2] - Z[0]) * InvArea;
+	Triangle.DepthA = DeltaZ1 * Triangle.EdgeA[2] + DeltaZ2 * Triangle.EdgeA[0];
+	Triangle.DepthB = DeltaZ1 * Triangle.EdgeB[2] + DeltaZ2 * Triangle.EdgeB[0];
+	Triangle.DepthC = Z[0] + DeltaZ1 * Triangle.EdgeC[2] + DeltaZ2 * Triangle.EdgeC[0];
+
+	const int32 TriangleIndex = GetOccluderTriangleCount();
+	Triangles.push_back(Triangle);
+
+	for (int32 TileY = Triangle.MinY / TILE_SIZE; TileY <= Triangle.MaxY / TILE_SIZE; ++TileY)
+	{
+		for (int32 TileX = Triangle.MinX / TILE_SIZE; TileX <= Triangle.MaxX / TILE_SIZE; ++TileX)
+		{
+			TileBins[TileY * TILE_COUNT_X + TileX].push_back(TriangleIndex);
+		}
+	}
+	return true;
 }
 
-TArray<FVector> COcclusionCuller::ConvertAABBToTriangles(UPrimitiveComponent* Prim)
+void COcclusionCuller::RasterizeOccluders(FJobSystem* InJobSystem)
 {
-    Triangles.clear();
-
-    if (!Prim) { return Triangles; }
-
-    FWorldAABBData& Data = CachedAABBs[Prim->CachedAABBIndex];
-    const FVector& WorldCenter = Data.Center;
-    FVector Extent = (Data.Min - Data.Max) * 0.5f;
-
-    constexpr float OccluderScale = 0.5f;
-
-    FVector WorldMin = WorldCenter - Extent * OccluderScale;
-    FVector WorldMax = WorldCenter + Extent * OccluderScale;
-
-    // AABB의 8개 정점 계산
-    FVector Vertices[8];
-    Vertices[0] = FVector(WorldMin.X, WorldMin.Y, WorldMin.Z); // 000
-    Vertices[1] = FVector(WorldMax.X, WorldMin.Y, WorldMin.Z); // 100
-    Vertices[2] = FVector(WorldMax.X, WorldMax.Y, WorldMin.Z); // 110
-    Vertices[3] = FVector(WorldMin.X, WorldMax.Y, WorldMin.Z); // 010
-    Vertices[4] = FVector(WorldMin.X, WorldMin.Y, WorldMax.Z); // 001
-    Vertices[5] = FVector(WorldMax.X, WorldMin.Y, WorldMax.Z); // 101
-    Vertices[6] = FVector(WorldMax.X, WorldMax.Y, WorldMax.Z); // 111
-    Vertices[7] = FVector(WorldMin.X, WorldMax.Y, WorldMax.Z); // 011
-
-    // Front face (Z = Min)
-    Triangles.push_back(Vertices[0]); Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[2]);
-    Triangles.push_back(Vertices[0]); Triangles.push_back(Vertices[2]); Triangles.push_back(Vertices[3]);
-
-    // Back face (Z = Max)
-    Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[7]);
-    Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[7]); Triangles.push_back(Vertices[6]);
-
-    // Left face (X = Min)
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[0]); Triangles.push_back(Vertices[3]);
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[3]); Triangles.push_back(Vertices[7]);
-
-    // Right face (X = Max)
-    Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[6]);
-    Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[6]); Triangles.push_back(Vertices[2]);
-
-    // Bottom face (Y = Min)
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[1]);
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[0]);
+	if (InJobSystem)
+	{
+		InJobSystem->ParallelFor(TILE_COUNT_Y, [this](int32 InTileY)
+		{
+			for (int32 TileX = 0; TileX < TILE_COUNT_X; ++TileX)
+			{
+				RasterizeTile(InTileY * TILE_COUNT_X + TileX);
+			}
+		});
+	}
+	else
+	{
+		for (int32 TileIndex = 0; TileIndex < TILE_COUNT; ++TileIndex)
+		{
+			RasterizeTile(TileIndex);
+		}
+	}
+}
 
-    // Top face (Y = Max)
-    Triangles.push_back(Vertices[3]); Triangles.push_back(Vertices[2]); Triangles.push_back(Vertices[6]);
-    Triangles.push_back(Vertices[3]); Triangles.push_back(Vertices[6]); Triangles.push_back(Vertices[7]);
+void COcclusionCuller::RasterizeTile(int32 InTileIndex)
+{
+	float* TileDepth = &DepthBuffer[static_cast<size_t>(InTileIndex) * TILE_PIXEL_COUNT];
+	const int32 TileX = (InTileIndex % TILE_COUNT_X) * TILE_SIZE;
+	const int32 TileY = (InTileIndex / TILE_COUNT_X) * TILE_SIZE;
+
+	const __m128 Far = _mm_set1_ps(1.0f);
+	for (int32 Offset = 0; Offset < TILE_PIXEL_COUNT; Offset += 4)
+	{
+		_mm_storeu_ps(TileDepth + Offset, Far);
+	}
+
+	// 타일 한 행의 픽셀 8개를 SSE 레인 4개짜리 묶음 두 개로 처리한다
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 PixelX[2] =
+	{
+		_mm_add_ps(_mm_set1_ps(static_cast<float>(TileX)), _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f)),
+		_mm_add_ps(_mm_set1_ps(static_cast<float>(TileX)), _mm_setr_ps(4.5f, 5.5f, 6.5f, 7.5f))
+	};
+
+	for (int32 TriangleIndex : TileBins[InTileIndex])
+	{
+		const FOccluderTriangle& Triangle = Triangles[TriangleIndex];
+		const int32 RowBegin = std::max(Triangle.MinY, TileY) - TileY;
+		const int32 RowEnd = std::min(Triangle.MaxY, TileY + TILE_SIZE - 1) - TileY;
+
+		// 경계 상자에 걸치지 않는 4픽셀 묶음은 건너뛴다
+		const bool bHalfCovered[2] =
+		{
+			Triangle.MinX <= TileX + 3 && Triangle.MaxX >= TileX,
+			Triangle.MinX <= TileX + 7 && Triangle.MaxX >= TileX + 4
+		};
+
+		__m128 EdgeX[3][2];
+		__m128 DepthX[2];
+		for (int32 Half = 0; Half < 2; ++Half)
+		{
+			for (int32 Edge = 0; Edge < 3; ++Edge)
+			{
+				EdgeX[Edge][Half] = _mm_mul_ps(_mm_set1_ps(Triangle.EdgeA[Edge]), PixelX[Half]);
+			}
+			DepthX[Half] = _mm_mul_ps(_mm_set1_ps(Triangle.DepthA), PixelX[Half]);
+		}
+
+		for (int32 Row = RowBegin; Row <= RowEnd; ++Row)
+		{
+			const float PixelY = static_cast<float>(TileY + Row) + 0.5f;
+			const __m128 Edge0Y = _mm_set1_ps(Triangle.EdgeB[0] * PixelY + Triangle.EdgeC[0]);
+			const __m128 Edge1Y = _mm_set1_ps(Triangle.EdgeB[1] * PixelY + Triangle.EdgeC[1]);
+			const __m128 Edge2Y = _mm_set1_ps(Triangle.EdgeB[2] * PixelY + Triangle.EdgeC[2]);
+			const __m128 DepthY = _mm_set1_ps(Triangle.DepthB * PixelY + Triangle.DepthC);
+
+			for (int32 Half = 0; Half < 2; ++Half)
+			{
+				if (!bHalfCovered[Half])
+				{
+					continue;
+				}
+
+				const __m128 Coverage = _mm_and_ps(
+					_mm_and_ps(_mm_cmpge_ps(_mm_add_ps(EdgeX[0][Half], Edge0Y), Zero), _mm_cmpge_ps(_mm_add_ps(EdgeX[1][Half], Edge1Y), Zero)),
+					_mm_cmpge_ps(_mm_add_ps(EdgeX[2][Half], Edge2Y), Zero));
+				if (_mm_movemask_ps(Coverage) == 0)
+				{
+					continue;
+				}
+
+				float* Pixels = TileDepth + Row * TILE_SIZE + Half * 4;
+				const __m128 OldDepth = _mm_loadu_ps(Pixels);
+				const __m128 NewDepth = _mm_min_ps(OldDepth, _mm_add_ps(DepthX[Half], DepthY));
+				_mm_storeu_ps(Pixels, _mm_or_ps(_mm_and_ps(Coverage, NewDepth), _mm_andnot_ps(Coverage, OldDepth)));
+			}
+		}
+	}
+
+	__m128 MinDepth = _mm_loadu_ps(TileDepth);
+	__m128 MaxDepth = MinDepth;
+	for (int32 Offset = 4; Offset < TILE_PIXEL_COUNT; Offset += 4)
+	{
+		const __m128 Depth = _mm_loadu_ps(TileDepth + Offset);
+		MinDepth = _mm_min_ps(MinDepth, Depth);
+		MaxDepth = _mm_max_ps(MaxDepth, Depth);
+	}
+
+	TileMinDepth[InTileIndex] = HorizontalMin(MinDepth);
+	TileMaxDepth[InTileIndex] = HorizontalMax(MaxDepth);
+}
 
-    return Triangles;
+bool COcclusionCuller::IsVisible(const FVector& InMin, const FVector& InMax) const
+{
+	// 1. 꼭짓점 8개를 Z가 Min인 4개, Max인 4개로 나눠 투영
+	const FMatrix4 Matrix(ViewProj);
+	const __m128 X = _mm_setr_ps(InMin.X, InMax.X, InMin.X, InMax.X);
+	const __m128 Y = _mm_setr_ps(InMin.Y, InMin.Y, InMax.Y, InMax.Y);
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 One = _mm_set1_ps(1.0f);
+
+	__m128 MinScreenX = _mm_set1_ps(FLT_MAX), MaxScreenX = _mm_set1_ps(-FLT_MAX);
+	__m128 MinScreenY = _mm_set1_ps(FLT_MAX), MaxScreenY = _mm_set1_ps(-FLT_MAX);
+	__m128 MinScreenZ = _mm_set1_ps(FLT_MAX);
+
+	for (float CornerZ : { InMin.Z, InMax.Z })
+	{
+		const __m128 Z = _mm_set1_ps(CornerZ);
+		const __m128 ClipZ = Matrix.Transform(X, Y, Z, 2);
+		const __m128 W = Matrix.Transform(X, Y, Z, 3);
+
+		// 근평면에 걸치면 화면 사각형을 정의할 수 없으므로 보이는 것으로 본다
+		if (_mm_movemask_ps(_mm_or_ps(_mm_cmple_ps(W, _mm_set1_ps(MIN_CLIP_W)), _mm_cmplt_ps(ClipZ, Zero))) != 0)
+		{
+			return true;
+		}
+
+		const __m128 InvW = _mm_div_ps(One, W);
+		const __m128 ScreenXs = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(Matrix.Transform(X, Y, Z, 0), InvW), One), _mm_set1_ps(Z_BUFFER_WIDTH * 0.5f));
+		const __m128 ScreenYs = _mm_mul_ps(_mm_sub_ps(One, _mm_mul_ps(Matrix.Transform(X, Y, Z, 1), InvW)), _mm_set1_ps(Z_BUFFER_HEIGHT * 0.5f));
+
+		MinScreenX = _mm_min_ps(MinScreenX, ScreenXs);
+		MaxScreenX = _mm_max_ps(MaxScreenX, ScreenXs);
+		MinScreenY = _mm_min_ps(MinScreenY, ScreenYs);
+		MaxScreenY = _mm_max_ps(MaxScreenY, ScreenYs);
+		MinScreenZ = _mm_min_ps(MinScreenZ, _mm_mul_ps(ClipZ, InvW));
+	}
+
+	// 깊이는 뷰 공간 Z에 대해 단조 증가하므로 꼭짓점 최소 깊이가 박스의 가장 가까운 깊이다
+	const float NearestDepth = HorizontalMin(MinScreenZ) - DEPTH_BIAS;
+	const float RectMinX = HorizontalMin(MinScreenX);
+	const float RectMaxX = HorizontalMax(MaxScreenX);
+	const float RectMinY = HorizontalMin(MinScreenY);
+	const float RectMaxY = HorizontalMax(MaxScreenY);
+
+	if (RectMaxX < 0.0f || RectMinX >= Z_BUFFER_WIDTH || RectMaxY < 0.0f || RectMinY >= Z_BUFFER_HEIGHT)
+	{
+		return false;
+	}
+
+	const int32 PixelMinX = std::max(0, static_cast<int32>(std::floor(RectMinX)));
+	const int32 PixelMaxX = std::min(Z_BUFFER_WIDTH - 1, static_cast<int32>(std::floor(RectMaxX)));
+	const int32 PixelMinY = std::max(0, static_cast<int32>(std::floor(RectMinY)));
+	const int32 PixelMaxY = std::min(Z_BUFFER_HEIGHT - 1, static_cast<int32>(std::floor(RectMaxY)));
+
+	// 2. 타일 계층: 최대 깊이보다 멀면 타일 전체가 가리고, 최소 깊이보다 가까우면 타일 어딘가에서 보인다
+	const __m128 Nearest = _mm_set1_ps(NearestDepth);
+	for (int32 TileY = PixelMinY / TILE_SIZE; TileY <= PixelMaxY / TILE_SIZE; ++TileY)
+	{
+		for (int32 TileX = PixelMinX / TILE_SIZE; TileX <= PixelMaxX / TILE_SIZE; ++TileX)
+		{
+			const int32 TileIndex = TileY * TILE_COUNT_X + TileX;
+			if (NearestDepth > TileMaxDepth[TileIndex])
+			{
+				continue;
+			}
+			if (NearestDepth <= TileMinDepth[TileIndex])
+			{
+				return true;
+			}
+
+			// 3. 사각형이 걸친 픽셀만 행 단위로 비교
+			const int32 ColumnBegin = std::max(PixelMinX, TileX * TILE_SIZE) - TileX * TILE_SIZE;
+			const int32 ColumnEnd = std::min(PixelMaxX, TileX * TILE_SIZE + TILE_SIZE - 1) - TileX * TILE_SIZE;
+			const int32 RowBegin = std::max(PixelMinY, TileY * TILE_SIZE) - TileY * TILE_SIZE;
+			const int32 RowEnd = std::min(PixelMaxY, TileY * TILE_SIZE + TILE_SIZE - 1) - TileY * TILE_SIZE;
+			const int32 ColumnMask = ((1 << (ColumnEnd + 1)) - 1) & ~((1 << ColumnBegin) - 1);
+
+			const float* TileDepth = &DepthBuffer[static_cast<size_t>(TileIndex) * TILE_PIXEL_COUNT];
+			for (int32 Row = RowBegin; Row <= RowEnd; ++Row)
+			{
+				const float* Pixels = TileDepth + Row * TILE_SIZE;
+				const int32 VisibleMask = _mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(Pixels), Nearest)) |
+					(_mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(Pixels + 4), Nearest)) << 4);
+				if (VisibleMask & ColumnMask)
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
 }
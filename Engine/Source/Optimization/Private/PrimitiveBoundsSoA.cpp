@@ -0,0 +1,349 @@
+#include "pch.h"
+#include "Optimization/Public/PrimitiveBoundsSoA.h"
+
+#include "Component/Public/PrimitiveComponent.h"
+#include "Physics/Public/AABB.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+namespace
+{
+	/** @brief 절두체 6개 평면의 각 성분을 레인 4개에 복제해 둔 형태 */
+	struct FFrustumPlanes4
+	{
+		__m128 NormalX[6];
+		__m128 NormalY[6];
+		__m128 NormalZ[6];
+		__m128 W[6];
+	};
+
+	FFrustumPlanes4 BroadcastPlanes(const FFrustum& InFrustum)
+	{
+		FFrustumPlanes4 Planes;
+		for (int32 PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+		{
+			const FVector4& Plane = InFrustum.Planes[PlaneIndex];
+			Planes.NormalX[PlaneIndex] = _mm_set1_ps(Plane.X);
+			Planes.NormalY[PlaneIndex] = _mm_set1_ps(Plane.Y);
+			Planes.NormalZ[PlaneIndex] = _mm_set1_ps(Plane.Z);
+			Planes.W[PlaneIndex] = _mm_set1_ps(Plane.W);
+		}
+		return Planes;
+	}
+
+	/**
+	 * @brief 박스 4개를 6개 평면과 검사해서 절두체 밖이 아닌 레인을 4비트 마스크로 반환
+	 * 평면 법선 쪽으로 가장 뒤에 있는 꼭짓점은 축마다 min(N * Min, N * Max)로 분기 없이 고르며,
+	 * FFrustum::CheckIntersection의 Closest 검사와 같은 순서로 더해서 스칼라 경로와 결과가 일치한다.
+	 */
+	inline int32 TestBoxes4(const FFrustumPlanes4& InPlanes,
+		__m128 InMinX, __m128 InMinY, __m128 InMinZ, __m128 InMaxX, __m128 InMaxY, __m128 InMaxZ)
+	{
+		const __m128 Zero = _mm_setzero_ps();
+		int32 OutsideMask = 0;
+
+		for (int32 PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+		{
+			const __m128 NormalX = InPlanes.NormalX[PlaneIndex];
+			const __m128 NormalY = InPlanes.NormalY[PlaneIndex];
+			const __m128 NormalZ = InPlanes.NormalZ[PlaneIndex];
+
+			const __m128 ClosestX = _mm_min_ps(_mm_mul_ps(NormalX, InMinX), _mm_mul_ps(NormalX, InMaxX));
+			const __m128 ClosestY = _mm_min_ps(_mm_mul_ps(NormalY, InMinY), _mm_mul_ps(NormalY, InMaxY));
+			const __m128 ClosestZ = _mm_min_ps(_mm_mul_ps(NormalZ, InMinZ), _mm_mul_ps(NormalZ, InMaxZ));
+			const __m128 Distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(ClosestX, ClosestY), ClosestZ), InPlanes.W[PlaneIndex]);
+
+			OutsideMask |= _mm_movemask_ps(_mm_cmpgt_ps(Distance, Zero));
+			if (OutsideMask == 0xF)
+			{
+				break;
+			}
+		}
+
+		return ~OutsideMask & 0xF;
+	}
+
+	inline uint64 GetLaneMask(int32 InRemaining)
+	{
+		return InRemaining >= FPrimitiveBoundsSoA::LANE_COUNT ? 0xFull : ((1ull << InRemaining) - 1);
+	}
+}
+
+int32 FPrimitiveBoundsSoA::Add(UPrimitiveComponent* InPrimitive)
+{
+	if (!InPrimitive)
+	{
+		return -1;
+	}
+
+	FVector Min, Max;
+	InPrimitive->GetWorldAABB(Min, Max);
+	return Add(InPrimitive, Min, Max, InPrimitive->PrimitiveBoundsIndex);
+}
+
+bool FPrimitiveBoundsSoA::Remove(UPrimitiveComponent* InPrimitive)
+{
+	if (!Contains(InPrimitive))
+	{
+		return false;
+	}
+
+	return Remove(InPrimitive->PrimitiveBoundsIndex);
+}
+
+bool FPrimitiveBoundsSoA::Update(UPrimitiveComponent* InPrimitive)
+{
+	if (!Contains(InPrimitive))
+	{
+		return false;
+	}
+
+	FVector Min, Max;
+	InPrimitive->GetWorldAABB(Min, Max);
+	SetBounds(InPrimitive->PrimitiveBoundsIndex, Min, Max);
+	return true;
+}
+
+void FPrimitiveBoundsSoA::Update(const TArray<UPrimitiveComponent*>& InPrimitives)
+{
+	TArray<int32> Slots;
+	TArray<const FMatrix*> WorldMatrices;
+	TArray<FVector> LocalMins;
+	TArray<FVector> LocalMaxs;
+	TArray<UPrimitiveComponent*> BatchedPrimitives;
+	Slots.reserve(InPrimitives.size());
+	WorldMatrices.reserve(InPrimitives.size());
+	LocalMins.reserve(InPrimitives.size());
+	LocalMaxs.reserve(InPrimitives.size());
+	BatchedPrimitives.reserve(InPrimitives.size());
+
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		if (!Contains(Primitive))
+		{
+			continue;
+		}
+
+		const FAABB* LocalAABB = Primitive->GetLocalAABB();
+		if (!LocalAABB)
+		{
+			Update(Primitive);
+			continue;
+		}
+
+		Slots.push_back(Primitive->PrimitiveBoundsIndex);
+		WorldMatrices.push_back(&Primitive->GetWorldTransformMatrix());
+		LocalMins.push_back(LocalAABB->Min);
+		LocalMaxs.push_back(LocalAABB->Max);
+		BatchedPrimitives.push_back(Primitive);
+	}
+
+	TransformBounds(Slots.data(), WorldMatrices.data(), LocalMins.data(), LocalMaxs.data(), static_cast<int32>(Slots.size()));
+
+	// 컬링 밖의 코드(피킹, 데칼, 에디터)가 읽는 컴포넌트 캐시도 같은 값으로 맞춘다
+	FVector Min, Max;
+	for (size_t Index = 0; Index < BatchedPrimitives.size(); ++Index)
+	{
+		GetBounds(Slots[Index], Min, Max);
+		BatchedPrimitives[Index]->SetCachedWorldAABB(Min, Max);
+	}
+}
+
+bool FPrimitiveBoundsSoA::Contains(const UPrimitiveComponent* InPrimitive) const
+{
+	if (!InPrimitive)
+	{
+		return false;
+	}
+
+	// 다른 레벨의 슬롯 인덱스를 들고 있을 수 있으므로 인덱스 범위와 소유자를 함께 확인한다
+	const int32 Index = InPrimitive->PrimitiveBoundsIndex;
+	return Index >= 0 && Index < Count && Primitives[Index] == InPrimitive;
+}
+
+int32 FPrimitiveBoundsSoA::Add(UPrimitiveComponent* InPrimitive, const FVector& InMin, const FVector& InMax, int32& InOutIndex)
+{
+	if (InOutIndex >= 0 && InOutIndex < Count && IndexRefs[InOutIndex] == &InOutIndex)
+	{
+		SetBounds(InOutIndex, InMin, InMax);
+		return InOutIndex;
+	}
+
+	Reserve(Count + 1);
+
+	const int32 Index = Count++;
+	Primitives[Index] = InPrimitive;
+	IndexRefs[Index] = &InOutIndex;
+	SetBounds(Index, InMin, InMax);
+
+	InOutIndex = Index;
+	return Index;
+}
+
+bool FPrimitiveBoundsSoA::Remove(int32& InOutIndex)
+{
+	const int32 Index = InOutIndex;
+	if (Index < 0 || Index >= Count || IndexRefs[Index] != &InOutIndex)
+	{
+		return false;
+	}
+
+	// 마지막 슬롯을 빈자리로 옮겨 배열을 연속으로 유지한다
+	const int32 LastIndex = Count - 1;
+	if (Index != LastIndex)
+	{
+		MinX[Index] = MinX[LastIndex];
+		MinY[Index] = MinY[LastIndex];
+		MinZ[Index] = MinZ[LastIndex];
+		MaxX[Index] = MaxX[LastIndex];
+		MaxY[Index] = MaxY[LastIndex];
+		MaxZ[Index] = MaxZ[LastIndex];
+		Primitives[Index] = Primitives[LastIndex];
+		IndexRefs[Index] = IndexRefs[LastIndex];
+		*IndexRefs[Index] = Index;
+	}
+
+	Primitives[LastIndex] = nullptr;
+	IndexRefs[LastIndex] = nullptr;
+	--Count;
+
+	InOutIndex = -1;
+	return true;
+}
+
+void FPrimitiveBoundsSoA::SetBounds(int32 InIndex, const FVector& InMin, const FVector& InMax)
+{
+	MinX[InIndex] = InMin.X;
+	MinY[InIndex] = InMin.Y;
+	MinZ[InIndex] = InMin.Z;
+	MaxX[InIndex] = InMax.X;
+	MaxY[InIndex] = InMax.Y;
+	MaxZ[InIndex] = InMax.Z;
+}
+
+void FPrimitiveBoundsSoA::TransformBounds(const int32* InSlots, const FMatrix* const* InWorldMatrices,
+	const FVector* InLocalMins, const FVector* InLocalMaxs, int32 InCount)
+{
+	alignas(16) float MinLanes[4];
+	alignas(16) float MaxLanes[4];
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		__m128 Min, Max;
+		TransformAABB(*InWorldMatrices[Index], InLocalMins[Index], InLocalMaxs[Index], Min, Max);
+		_mm_store_ps(MinLanes, Min);
+		_mm_store_ps(MaxLanes, Max);
+
+		const int32 Slot = InSlots[Index];
+		MinX[Slot] = MinLanes[0];
+		MinY[Slot] = MinLanes[1];
+		MinZ[Slot] = MinLanes[2];
+		MaxX[Slot] = MaxLanes[0];
+		MaxY[Slot] = MaxLanes[1];
+		MaxZ[Slot] = MaxLanes[2];
+	}
+}
+
+void FPrimitiveBoundsSoA::GetBounds(int32 InIndex, FVector& OutMin, FVector& OutMax) const
+{
+	OutMin = FVector(MinX[InIndex], MinY[InIndex], MinZ[InIndex]);
+	OutMax = FVector(MaxX[InIndex], MaxY[InIndex], MaxZ[InIndex]);
+}
+
+void FPrimitiveBoundsSoA::Clear()
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		*IndexRefs[Index] = -1;
+	}
+
+	MinX.clear();
+	MinY.clear();
+	MinZ.clear();
+	MaxX.clear();
+	MaxY.clear();
+	MaxZ.clear();
+	Primitives.clear();
+	IndexRefs.clear();
+	Count = 0;
+}
+
+void FPrimitiveBoundsSoA::Reserve(int32 InCount)
+{
+	// 마지막 슬롯에서 시작하는 4개 묶음 로드가 배열 끝을 넘지 않도록 레인 수만큼 여유를 둔다
+	const size_t RequiredSize = static_cast<size_t>(InCount + LANE_COUNT - 1);
+	if (MinX.size() >= RequiredSize)
+	{
+		return;
+	}
+
+	const size_t NewSize = std::max(RequiredSize, MinX.size() * 2);
+	MinX.resize(NewSize, 0.0f);
+	MinY.resize(NewSize, 0.0f);
+	MinZ.resize(NewSize, 0.0f);
+	MaxX.resize(NewSize, 0.0f);
+	MaxY.resize(NewSize, 0.0f);
+	MaxZ.resize(NewSize, 0.0f);
+	Primitives.resize(NewSize, nullptr);
+	IndexRefs.resize(NewSize, nullptr);
+}
+
+void FPrimitiveBoundsSoA::CullRange(const FFrustum& InFrustum, int32 InFirst, int32 InCount, TArray<uint64>& OutVisibilityMask) const
+{
+	InFirst = std::clamp(InFirst, 0, Count);
+	InCount = std::clamp(InCount, 0, Count - InFirst);
+	OutVisibilityMask.assign((InCount + 63) / 64, 0);
+
+	const FFrustumPlanes4 Planes = BroadcastPlanes(InFrustum);
+
+	for (int32 Offset = 0; Offset < InCount; Offset += LANE_COUNT)
+	{
+		const int32 Slot = InFirst + Offset;
+		const int32 VisibleLanes = TestBoxes4(Planes,
+			_mm_loadu_ps(&MinX[Slot]), _mm_loadu_ps(&MinY[Slot]), _mm_loadu_ps(&MinZ[Slot]),
+			_mm_loadu_ps(&MaxX[Slot]), _mm_loadu_ps(&MaxY[Slot]), _mm_loadu_ps(&MaxZ[Slot]));
+
+		// Offset은 4의 배수이므로 4비트 묶음이 64비트 워드 경계를 넘지 않는다
+		OutVisibilityMask[Offset >> 6] |= (static_cast<uint64>(VisibleLanes) & GetLaneMask(InCount - Offset)) << (Offset & 63);
+	}
+}
+
+void FPrimitiveBoundsSoA::CullIndices(const FFrustum& InFrustum, const TArray<int32>& InIndices, TArray<uint64>& OutVisibilityMask) const
+{
+	const int32 IndexCount = static_cast<int32>(InIndices.size());
+	OutVisibilityMask.assign((IndexCount + 63) / 64, 0);
+
+	const FFrustumPlanes4 Planes = BroadcastPlanes(InFrustum);
+	const int32* Indices = InIndices.data();
+
+	for (int32 Offset = 0; Offset < IndexCount; Offset += LANE_COUNT)
+	{
+		// 남는 레인은 첫 인덱스로 채운 뒤 결과에서 마스킹한다
+		const int32 Remaining = IndexCount - Offset;
+		const int32 I0 = Indices[Offset];
+		const int32 I1 = Remaining > 1 ? Indices[Offset + 1] : I0;
+		const int32 I2 = Remaining > 2 ? Indices[Offset + 2] : I0;
+		const int32 I3 = Remaining > 3 ? Indices[Offset + 3] : I0;
+
+		const int32 VisibleLanes = TestBoxes4(Planes,
+			_mm_setr_ps(MinX[I0], MinX[I1], MinX[I2], MinX[I3]),
+			_mm_setr_ps(MinY[I0], MinY[I1], MinY[I2], MinY[I3]),
+			_mm_setr_ps(MinZ[I0], MinZ[I1], MinZ[I2], MinZ[I3]),
+			_mm_setr_ps(MaxX[I0], MaxX[I1], MaxX[I2], MaxX[I3]),
+			_mm_setr_ps(MaxY[I0], MaxY[I1], MaxY[I2], MaxY[I3]),
+			_mm_setr_ps(MaxZ[I0], MaxZ[I1], MaxZ[I2], MaxZ[I3]));
+
+		OutVisibilityMask[Offset >> 6] |= (static_cast<uint64>(VisibleLanes) & GetLaneMask(Remaining)) << (Offset & 63);
+	}
+}
+
+uint32 FPrimitiveBoundsSoA::CountVisible(const TArray<uint64>& InVisibilityMask)
+{
+	uint32 VisibleCount = 0;
+	for (uint64 Word : InVisibilityMask)
+	{
+		for (; Word != 0; Word &= Word - 1)
+		{
+			++VisibleCount;
+		}
+	}
+	return VisibleCount;
+}
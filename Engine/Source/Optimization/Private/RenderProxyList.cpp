@@ -0,0 +1,240 @@
+#include "pch.h"
+#include "Optimization/Public/RenderProxyList.h"
+
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Public/BillBoardComponent.h"
+#include "Component/Public/DecalComponent.h"
+#include "Component/Public/TextComponent.h"
+#include "Component/Public/UUIDTextComponent.h"
+#include "Texture/Public/Material.h"
+
+uint32 FRenderSortKey::QuantizeDepth(float InDistanceSquared)
+{
+	// 양수 float의 비트 패턴은 값과 같은 순서이므로 (지수 8비트 | 가수 상위 2비트)가 로그 눈금 버킷이 된다
+	constexpr int32 MIN_BUCKET = 120 << 2; // 2^-7, 거리 약 0.09
+	uint32 Bits;
+	memcpy(&Bits, &InDistanceSquared, sizeof(Bits));
+	const int32 Bucket = static_cast<int32>(Bits >> 21) - MIN_BUCKET;
+	return static_cast<uint32>(std::clamp(Bucket, 0, static_cast<int32>(DEPTH_MASK)));
+}
+
+void RadixSortKeyValues(TArray<uint64>& InOutKeys, TArray<uint32>& InOutValues, TArray<uint64>& InScratchKeys, TArray<uint32>& InScratchValues)
+{
+	constexpr int32 RADIX_BITS = 8;
+	constexpr int32 BUCKET_COUNT = 1 << RADIX_BITS;
+	constexpr int32 DIGIT_COUNT = 64 / RADIX_BITS;
+
+	const size_t Count = InOutKeys.size();
+	if (Count < 2)
+	{
+		return;
+	}
+
+	// 모든 자리의 히스토그램을 한 번에 센다
+	uint32 Histograms[DIGIT_COUNT][BUCKET_COUNT] = {};
+	for (const uint64 Key : InOutKeys)
+	{
+		for (int32 Digit = 0; Digit < DIGIT_COUNT; ++Digit)
+		{
+			++Histograms[Digit][(Key >> (Digit * RADIX_BITS)) & (BUCKET_COUNT - 1)];
+		}
+	}
+
+	InScratchKeys.resize(Count);
+	InScratchValues.resize(Count);
+	uint64* SourceKeys = InOutKeys.data();
+	uint32* SourceValues = InOutValues.data();
+	uint64* DestKeys = InScratchKeys.data();
+	uint32* DestValues = InScratchValues.data();
+
+	for (int32 Digit = 0; Digit < DIGIT_COUNT; ++Digit)
+	{
+		const int32 Shift = Digit * RADIX_BITS;
+		uint32* Histogram = Histograms[Digit];
+
+		// 한 버킷에 모두 몰린 자리는 순서를 바꾸지 않으므로 건너뛴다
+		if (Histogram[(SourceKeys[0] >> Shift) & (BUCKET_COUNT - 1)] == Count)
+		{
+			continue;
+		}
+
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < BUCKET_COUNT; ++Bucket)
+		{
+			const uint32 BucketCount = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += BucketCount;
+		}
+
+		for (size_t Index = 0; Index < Count; ++Index)
+		{
+			const uint32 Position = Histogram[(SourceKeys[Index] >> Shift) & (BUCKET_COUNT - 1)]++;
+			DestKeys[Position] = SourceKeys[Index];
+			DestValues[Position] = SourceValues[Index];
+		}
+
+		std::swap(SourceKeys, DestKeys);
+		std::swap(SourceValues, DestValues);
+	}
+
+	// 홀수 번 옮겼으면 결과가 작업 버퍼 쪽에 있다
+	if (SourceKeys != InOutKeys.data())
+	{
+		InOutKeys.swap(InScratchKeys);
+		InOutValues.swap(InScratchValues);
+	}
+}
+
+int32 FRenderProxyList::Add(UPrimitiveComponent* InPrimitive, int32& InOutIndex)
+{
+	if (InOutIndex >= 0 && InOutIndex < Num() && Primitives[InOutIndex] == InPrimitive)
+	{
+		return InOutIndex;
+	}
+
+	InOutIndex = Num();
+	Primitives.push_back(InPrimitive);
+	IndexRefs.push_back(&InOutIndex);
+	SortKeys.push_back(FRenderSortKey::Make(ERenderProxyPass::None, 0, 0, 0));
+	Locations.push_back(FVector::ZeroVector());
+	return InOutIndex;
+}
+
+bool FRenderProxyList::Remove(int32& InOutIndex)
+{
+	const int32 Index = InOutIndex;
+	if (Index < 0 || Index >= Num() || IndexRefs[Index] != &InOutIndex)
+	{
+		return false;
+	}
+
+	const int32 LastIndex = Num() - 1;
+	if (Index != LastIndex)
+	{
+		Primitives[Index] = Primitives[LastIndex];
+		IndexRefs[Index] = IndexRefs[LastIndex];
+		SortKeys[Index] = SortKeys[LastIndex];
+		Locations[Index] = Locations[LastIndex];
+		*IndexRefs[Index] = Index;
+	}
+
+	Primitives.pop_back();
+	IndexRefs.pop_back();
+	SortKeys.pop_back();
+	Locations.pop_back();
+	InOutIndex = -1;
+	return true;
+}
+
+void FRenderProxyList::Clear()
+{
+	for (int32* IndexRef : IndexRefs)
+	{
+		*IndexRef = -1;
+	}
+	Primitives.clear();
+	IndexRefs.clear();
+	SortKeys.clear();
+	Locations.clear();
+}
+
+uint32 FRenderProxyList::FindOrAddId(TMap<const void*, uint32>& InOutIds, const void* InPointer)
+{
+	if (!InPointer)
+	{
+		return 0;
+	}
+
+	// 0은 nullptr 몫, 16비트를 넘으면 ID가 겹치지만 정렬 순서에만 영향이 있다
+	const uint32 NewId = static_cast<uint32>(InOutIds.size()) + 1;
+	return InOutIds.try_emplace(InPointer, NewId).first->second & FRenderSortKey::ID_MASK;
+}
+
+void FRenderProxyList::UpdateSortKey(int32 InIndex)
+{
+	UPrimitiveComponent* Primitive = Primitives[InIndex];
+	uint64 SortKey = FRenderSortKey::Make(ERenderProxyPass::None, 0, 0, 0);
+
+	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Primitive))
+	{
+		UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+		FStaticMesh* MeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+
+		// 여러 섹션이면 첫 섹션의 머티리얼로 묶는다, 노멀 맵 유무가 픽셀 셰이더를 가른다
+		UMaterial* Material = nullptr;
+		if (MeshAsset && !MeshAsset->Sections.empty() && !MeshAsset->MaterialInfo.empty() && StaticMesh->GetNumMaterials() != 0)
+		{
+			Material = StaticMeshComponent->GetMaterial(MeshAsset->Sections[0].MaterialSlot);
+		}
+		const uint32 Permutation = Material && Material->GetNormalTexture() ? 1 : 0;
+		SortKey = FRenderSortKey::Make(ERenderProxyPass::StaticMesh, Permutation, FindOrAddMaterialId(Material), FindOrAddMeshId(MeshAsset));
+	}
+	else if (UBillBoardComponent* BillBoard = Cast<UBillBoardComponent>(Primitive))
+	{
+		SortKey = FRenderSortKey::Make(ERenderProxyPass::BillBoard, 0, FindOrAddMaterialId(BillBoard->GetSprite()), 0);
+	}
+	else if (UTextComponent* Text = Cast<UTextComponent>(Primitive))
+	{
+		const ERenderProxyPass Pass = Text->IsExactly(UUUIDTextComponent::StaticClass()) ? ERenderProxyPass::UUID : ERenderProxyPass::Text;
+		SortKey = FRenderSortKey::Make(Pass, 0, 0, 0);
+	}
+	else if (UDecalComponent* Decal = Cast<UDecalComponent>(Primitive))
+	{
+		SortKey = FRenderSortKey::Make(ERenderProxyPass::Decal, 0, FindOrAddMaterialId(Decal->GetTexture()), 0);
+	}
+
+	SortKeys[InIndex] = SortKey;
+}
+
+void FRenderProxyList::BuildCommandList(const TArray<uint64>& InVisibility, const FVector& InViewLocation, FRenderCommandList& OutList) const
+{
+	OutList.Keys.clear();
+	OutList.ProxyIndices.clear();
+
+	// 비트셋에서 켜진 프록시의 키만 모으면서 깊이 버킷을 채운다
+	const size_t WordCount = std::min(InVisibility.size(), (Primitives.size() + 63) / 64);
+	for (size_t WordIndex = 0; WordIndex < WordCount; ++WordIndex)
+	{
+		uint64 Word = InVisibility[WordIndex];
+		while (Word != 0)
+		{
+			unsigned long Bit;
+			_BitScanForward64(&Bit, Word);
+			Word &= Word - 1;
+
+			const uint32 Index = static_cast<uint32>(WordIndex * 64 + Bit);
+			if (Index >= Primitives.size())
+			{
+				break;
+			}
+
+			const uint64 SortKey = SortKeys[Index];
+			if (FRenderSortKey::GetPass(SortKey) == ERenderProxyPass::None)
+			{
+				continue;
+			}
+
+			const float DistanceSquared = (Locations[Index] - InViewLocation).LengthSquared();
+			OutList.Keys.push_back(FRenderSortKey::WithDepthBucket(SortKey, FRenderSortKey::QuantizeDepth(DistanceSquared)));
+			OutList.ProxyIndices.push_back(Index);
+		}
+	}
+
+	RadixSortKeyValues(OutList.Keys, OutList.ProxyIndices, OutList.ScratchKeys, OutList.ScratchProxyIndices);
+
+	const size_t CommandCount = OutList.Keys.size();
+	OutList.Commands.resize(CommandCount);
+	for (int32& PassOffset : OutList.PassOffsets)
+	{
+		PassOffset = 0;
+	}
+	for (size_t Command = 0; Command < CommandCount; ++Command)
+	{
+		OutList.Commands[Command] = { Primitives[OutList.ProxyIndices[Command]], OutList.Keys[Command] };
+		++OutList.PassOffsets[static_cast<int32>(FRenderSortKey::GetPass(OutList.Keys[Command])) + 1];
+	}
+	for (int32 Pass = 1; Pass <= static_cast<int32>(ERenderProxyPass::Count); ++Pass)
+	{
+		OutList.PassOffsets[Pass] += OutList.PassOffsets[Pass - 1];
+	}
+}
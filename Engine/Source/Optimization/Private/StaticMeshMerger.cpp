@@ -0,0 +1,238 @@
+#include "pch.h"
+#include "Optimization/Public/StaticMeshMerger.h"
+
+namespace
+{
+	/** @brief 소스를 묶는 기준, 셀 좌표와 정렬된 고유 머티리얼 목록과 데칼 수신 여부가 모두 같아야 같은 묶음 */
+	struct FMergeKey
+	{
+		int32 CellX = 0;
+		int32 CellY = 0;
+		int32 CellZ = 0;
+		bool bReceivesDecals = true;
+		TArray<UMaterial*> Materials;
+
+		bool operator<(const FMergeKey& InOther) const
+		{
+			if (CellX != InOther.CellX) { return CellX < InOther.CellX; }
+			if (CellY != InOther.CellY) { return CellY < InOther.CellY; }
+			if (CellZ != InOther.CellZ) { return CellZ < InOther.CellZ; }
+			if (bReceivesDecals != InOther.bReceivesDecals) { return bReceivesDecals < InOther.bReceivesDecals; }
+			return std::lexicographical_compare(Materials.begin(), Materials.end(), InOther.Materials.begin(), InOther.Materials.end(),
+				std::less<const UMaterial*>());
+		}
+
+		bool operator==(const FMergeKey& InOther) const
+		{
+			return CellX == InOther.CellX && CellY == InOther.CellY && CellZ == InOther.CellZ &&
+				bReceivesDecals == InOther.bReceivesDecals && Materials == InOther.Materials;
+		}
+	};
+
+	TArray<UMaterial*> GetMaterialSet(const FStaticMeshMergeSource& InSource)
+	{
+		TArray<UMaterial*> Materials = InSource.SectionMaterials;
+		std::sort(Materials.begin(), Materials.end(), std::less<UMaterial*>());
+		Materials.erase(std::unique(Materials.begin(), Materials.end()), Materials.end());
+		return Materials;
+	}
+
+	/** @brief 행 벡터 규약의 방향 변환 (이동 제외) */
+	FVector TransformDirection(const FVector& InDirection, const FMatrix& InMatrix)
+	{
+		return FVector(
+			InDirection.X * InMatrix.Data[0][0] + InDirection.Y * InMatrix.Data[1][0] + InDirection.Z * InMatrix.Data[2][0],
+			InDirection.X * InMatrix.Data[0][1] + InDirection.Y * InMatrix.Data[1][1] + InDirection.Z * InMatrix.Data[2][1],
+			InDirection.X * InMatrix.Data[0][2] + InDirection.Y * InMatrix.Data[1][2] + InDirection.Z * InMatrix.Data[2][2]);
+	}
+
+	/** @brief 역행렬의 전치로 노멀을 변환, 비균등 스케일에서도 면에 수직으로 남는다 */
+	FVector TransformNormal(const FVector& InNormal, const FMatrix& InInverse)
+	{
+		return FVector(
+			InNormal.X * InInverse.Data[0][0] + InNormal.Y * InInverse.Data[0][1] + InNormal.Z * InInverse.Data[0][2],
+			InNormal.X * InInverse.Data[1][0] + InNormal.Y * InInverse.Data[1][1] + InNormal.Z * InInverse.Data[1][2],
+			InNormal.X * InInverse.Data[2][0] + InNormal.Y * InInverse.Data[2][1] + InNormal.Z * InInverse.Data[2][2]);
+	}
+
+	float Determinant3x3(const FMatrix& InMatrix)
+	{
+		const auto& M = InMatrix.Data;
+		return M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]) -
+			M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0]) +
+			M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0]);
+	}
+
+	void AppendTriangles(const TArray<uint32>& InIndices, uint32 InStart, uint32 InCount, uint32 InBaseVertex, bool bInFlipWinding, TArray<uint32>& OutIndices)
+	{
+		const uint32 End = std::min(InStart + InCount, static_cast<uint32>(InIndices.size()));
+		for (uint32 Index = InStart; Index + 2 < End; Index += 3)
+		{
+			OutIndices.push_back(InBaseVertex + InIndices[Index]);
+			OutIndices.push_back(InBaseVertex + InIndices[Index + (bInFlipWinding ? 2 : 1)]);
+			OutIndices.push_back(InBaseVertex + InIndices[Index + (bInFlipWinding ? 1 : 2)]);
+		}
+	}
+}
+
+bool FStaticMeshMerger::CanMerge(const FStaticMesh& InMesh)
+{
+	return !InMesh.Indices.empty() && !InMesh.Vertices.empty() && InMesh.Indices.size() / 3 <= MAX_SOURCE_TRIANGLES;
+}
+
+void FStaticMeshMerger::BuildCells(const TArray<FStaticMeshMergeSource>& InSources, float InCellSize, TArray<FStaticMeshMergedCell>& OutCells)
+{
+	OutCells.clear();
+
+	const float InverseCellSize = 1.0f / std::max(InCellSize, MATH_EPSILON);
+	TArray<FMergeKey> Keys;
+	TArray<int32> Order;
+	Keys.reserve(InSources.size());
+	Order.reserve(InSources.size());
+
+	for (int32 SourceIndex = 0; SourceIndex < static_cast<int32>(InSources.size()); ++SourceIndex)
+	{
+		const FStaticMeshMergeSource& Source = InSources[SourceIndex];
+		FMergeKey Key;
+		if (Source.Mesh && CanMerge(*Source.Mesh))
+		{
+			// 셀은 로컬 AABB 중심의 월드 위치로 정한다, 경계가 셀을 넘어도 셀 AABB가 넓어질 뿐이다
+			FVector LocalMin(FLT_MAX, FLT_MAX, FLT_MAX);
+			FVector LocalMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+			for (const FNormalVertex& Vertex : Source.Mesh->Vertices)
+			{
+				LocalMin = FVector(std::min(LocalMin.X, Vertex.Position.X), std::min(LocalMin.Y, Vertex.Position.Y), std::min(LocalMin.Z, Vertex.Position.Z));
+				LocalMax = FVector(std::max(LocalMax.X, Vertex.Position.X), std::max(LocalMax.Y, Vertex.Position.Y), std::max(LocalMax.Z, Vertex.Position.Z));
+			}
+			const FVector4 Center = FVector4((LocalMin + LocalMax) * 0.5f, 1.0f) * Source.World;
+			Key.CellX = static_cast<int32>(std::floor(Center.X * InverseCellSize));
+			Key.CellY = static_cast<int32>(std::floor(Center.Y * InverseCellSize));
+			Key.CellZ = static_cast<int32>(std::floor(Center.Z * InverseCellSize));
+			Key.bReceivesDecals = Source.bReceivesDecals;
+			Key.Materials = GetMaterialSet(Source);
+			Order.push_back(SourceIndex);
+		}
+		Keys.push_back(std::move(Key));
+	}
+
+	// 같은 묶음 안에서는 입력 순서를 유지해서 결과가 실행마다 같게 한다
+	std::stable_sort(Order.begin(), Order.end(), [&Keys](int32 A, int32 B) { return Keys[A] < Keys[B]; });
+
+	TArray<int32> CellSources;
+	auto FlushCell = [&]()
+	{
+		if (static_cast<int32>(CellSources.size()) >= MIN_SOURCES_PER_CELL)
+		{
+			OutCells.emplace_back();
+			MergeCell(InSources, CellSources, OutCells.back());
+		}
+		CellSources.clear();
+	};
+
+	uint32 CellVertexCount = 0;
+	for (size_t OrderIndex = 0; OrderIndex < Order.size(); ++OrderIndex)
+	{
+		const int32 SourceIndex = Order[OrderIndex];
+		const uint32 VertexCount = static_cast<uint32>(InSources[SourceIndex].Mesh->Vertices.size());
+		const bool bIsNewGroup = OrderIndex == 0 || !(Keys[Order[OrderIndex - 1]] == Keys[SourceIndex]);
+		if (bIsNewGroup || CellVertexCount + VertexCount > MAX_CELL_VERTICES)
+		{
+			FlushCell();
+			CellVertexCount = 0;
+		}
+		CellSources.push_back(SourceIndex);
+		CellVertexCount += VertexCount;
+	}
+	FlushCell();
+}
+
+void FStaticMeshMerger::MergeCell(const TArray<FStaticMeshMergeSource>& InSources, const TArray<int32>& InSourceIndices, FStaticMeshMergedCell& OutCell)
+{
+	OutCell = FStaticMeshMergedCell();
+	OutCell.SourceIndices = InSourceIndices;
+	OutCell.Min = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+	OutCell.Max = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	if (InSourceIndices.empty())
+	{
+		return;
+	}
+
+	const FStaticMeshMergeSource& FirstSource = InSources[InSourceIndices[0]];
+	OutCell.Materials = GetMaterialSet(FirstSource);
+	OutCell.bReceivesDecals = FirstSource.bReceivesDecals;
+
+	FStaticMesh& Mesh = OutCell.Mesh;
+	size_t VertexCount = 0;
+	size_t IndexCount = 0;
+	for (const int32 SourceIndex : InSourceIndices)
+	{
+		VertexCount += InSources[SourceIndex].Mesh->Vertices.size();
+		IndexCount += InSources[SourceIndex].Mesh->Indices.size();
+	}
+	Mesh.Vertices.reserve(VertexCount);
+	Mesh.Indices.reserve(IndexCount);
+
+	// 1. 정점을 소스 순서대로 월드 공간으로 옮겨 이어 붙인다
+	TArray<uint32> BaseVertices(InSourceIndices.size());
+	TArray<uint8> FlipWindings(InSourceIndices.size());
+	for (size_t Slot = 0; Slot < InSourceIndices.size(); ++Slot)
+	{
+		const FStaticMeshMergeSource& Source = InSources[InSourceIndices[Slot]];
+		BaseVertices[Slot] = static_cast<uint32>(Mesh.Vertices.size());
+		FlipWindings[Slot] = Determinant3x3(Source.World) < 0.0f ? 1 : 0;
+		OutCell.SourceDrawCount += static_cast<uint32>(std::max<size_t>(Source.Mesh->Sections.size(), 1));
+
+		for (const FNormalVertex& LocalVertex : Source.Mesh->Vertices)
+		{
+			FNormalVertex Vertex = LocalVertex;
+			const FVector4 Position = FVector4(LocalVertex.Position, 1.0f) * Source.World;
+			Vertex.Position = FVector(Position.X, Position.Y, Position.Z);
+			Vertex.Normal = TransformNormal(LocalVertex.Normal, Source.WorldInverse);
+			Vertex.Normal.Normalize();
+			Vertex.Tangent = TransformDirection(LocalVertex.Tangent, Source.World);
+			Vertex.Tangent.Normalize();
+			Vertex.Bitangent = TransformDirection(LocalVertex.Bitangent, Source.World);
+			Vertex.Bitangent.Normalize();
+			Mesh.Vertices.push_back(Vertex);
+
+			OutCell.Min = FVector(std::min(OutCell.Min.X, Vertex.Position.X), std::min(OutCell.Min.Y, Vertex.Position.Y), std::min(OutCell.Min.Z, Vertex.Position.Z));
+			OutCell.Max = FVector(std::max(OutCell.Max.X, Vertex.Position.X), std::max(OutCell.Max.Y, Vertex.Position.Y), std::max(OutCell.Max.Z, Vertex.Position.Z));
+		}
+	}
+
+	// 2. 머티리얼마다 모든 소스에서 그 머티리얼 섹션의 삼각형을 모아 섹션 하나로 만든다
+	const int32 SlotCount = std::max(1, static_cast<int32>(OutCell.Materials.size()));
+	for (int32 MaterialSlot = 0; MaterialSlot < SlotCount; ++MaterialSlot)
+	{
+		FMeshSection Section;
+		Section.StartIndex = static_cast<uint32>(Mesh.Indices.size());
+		Section.MaterialSlot = static_cast<uint32>(MaterialSlot);
+
+		for (size_t Slot = 0; Slot < InSourceIndices.size(); ++Slot)
+		{
+			const FStaticMeshMergeSource& Source = InSources[InSourceIndices[Slot]];
+			const FStaticMesh& SourceMesh = *Source.Mesh;
+			if (OutCell.Materials.empty())
+			{
+				AppendTriangles(SourceMesh.Indices, 0, static_cast<uint32>(SourceMesh.Indices.size()), BaseVertices[Slot], FlipWindings[Slot] != 0, Mesh.Indices);
+				continue;
+			}
+
+			const size_t SectionCount = std::min(SourceMesh.Sections.size(), Source.SectionMaterials.size());
+			for (size_t SectionIndex = 0; SectionIndex < SectionCount; ++SectionIndex)
+			{
+				if (Source.SectionMaterials[SectionIndex] == OutCell.Materials[MaterialSlot])
+				{
+					const FMeshSection& SourceSection = SourceMesh.Sections[SectionIndex];
+					AppendTriangles(SourceMesh.Indices, SourceSection.StartIndex, SourceSection.IndexCount, BaseVertices[Slot], FlipWindings[Slot] != 0, Mesh.Indices);
+				}
+			}
+		}
+
+		Section.IndexCount = static_cast<uint32>(Mesh.Indices.size()) - Section.StartIndex;
+		Mesh.Sections.push_back(Section);
+	}
+
+	// 섹션 슬롯이 머티리얼 인덱스와 일치해야 StaticMeshPass가 머티리얼 세트를 섹션 순서로 만든다
+	Mesh.MaterialInfo.resize(OutCell.Materials.size());
+}
@@ -0,0 +1,228 @@
+#include "pch.h"
+#include "Optimization/Public/TransformHierarchy.h"
+#include "Component/Public/SceneComponent.h"
+
+FTransformHierarchy& FTransformHierarchy::GetInstance()
+{
+	static FTransformHierarchy Instance;
+	return Instance;
+}
+
+int32 FTransformHierarchy::Add(USceneComponent* InComponent)
+{
+	const int32 Index = static_cast<int32>(Components.size());
+	LocalMatrices.push_back(FMatrix::Identity());
+	WorldMatrices.push_back(FMatrix::Identity());
+	ParentIndices.push_back(-1);
+	WorldVersions.push_back(0);
+	ParentVersions.push_back(0);
+	Depths.push_back(0);
+	Flags.push_back(FLAG_DIRTY);
+	Components.push_back(InComponent);
+
+	bHasPendingChanges = true;
+	return Index;
+}
+
+void FTransformHierarchy::Remove(int32 InIndex)
+{
+	if (InIndex < 0 || InIndex >= Num())
+	{
+		return;
+	}
+
+	// 자식이 아직 이 슬롯을 가리킬 수 있으므로 자리는 SortByDepth에서 정리한다
+	Components[InIndex] = nullptr;
+	Flags[InIndex] = FLAG_NONE;
+	bIsOrderDirty = true;
+}
+
+void FTransformHierarchy::SetParent(int32 InIndex, int32 InParentIndex)
+{
+	ParentIndices[InIndex] = InParentIndex;
+	bIsOrderDirty = true;
+	MarkDirty(InIndex);
+}
+
+void FTransformHierarchy::MarkDirty(int32 InIndex)
+{
+	Flags[InIndex] |= FLAG_DIRTY;
+	bHasPendingChanges = true;
+}
+
+void FTransformHierarchy::ResolveChain(int32 InIndex)
+{
+	const int32 Parent = GetLiveParent(InIndex);
+	if (Parent >= 0)
+	{
+		ResolveChain(Parent);
+	}
+
+	if (NeedsUpdate(InIndex, Parent))
+	{
+		UpdateWorld(InIndex, Parent);
+	}
+}
+
+/**
+ * @brief 로컬 행렬(더티일 때만)과 월드 행렬을 다시 계산해 컴포넌트에 알린다
+ * World = Local * ParentWorld는 FMatrix의 SSE 곱을 그대로 쓴다.
+ */
+void FTransformHierarchy::UpdateWorld(int32 InIndex, int32 InParent)
+{
+	USceneComponent* Component = Components[InIndex];
+
+	if (Flags[InIndex] & FLAG_DIRTY)
+	{
+		LocalMatrices[InIndex] = FMatrix::GetModelMatrix(Component->GetRelativeLocation(), Component->GetRelativeRotation(), Component->GetRelativeScale3D());
+		Flags[InIndex] &= ~FLAG_DIRTY;
+	}
+
+	if (InParent >= 0)
+	{
+		WorldMatrices[InIndex] = LocalMatrices[InIndex] * WorldMatrices[InParent];
+		ParentVersions[InIndex] = WorldVersions[InParent];
+	}
+	else
+	{
+		WorldMatrices[InIndex] = LocalMatrices[InIndex];
+	}
+	++WorldVersions[InIndex];
+
+	Component->WorldTransformMatrix = WorldMatrices[InIndex];
+	Component->OnUpdateTransform();
+}
+
+/**
+ * @brief 깊이별 계수 정렬, 같은 깊이 안에서는 기존 순서를 유지한다
+ * 깊이는 부모 체인을 따라 올라가며 계산하고, 이미 계산한 조상에서 멈춘다.
+ */
+void FTransformHierarchy::SortByDepth()
+{
+	const int32 Count = Num();
+
+	constexpr uint16 UNKNOWN_DEPTH = UINT16_MAX;
+	TArray<uint16> NewDepths(Count, UNKNOWN_DEPTH);
+	TArray<int32> Chain;
+	uint16 MaxDepth = 0;
+	int32 LiveCount = 0;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		if (!Components[Index])
+		{
+			continue;
+		}
+		++LiveCount;
+
+		Chain.clear();
+		int32 Current = Index;
+		while (Current >= 0 && NewDepths[Current] == UNKNOWN_DEPTH)
+		{
+			Chain.push_back(Current);
+			Current = GetLiveParent(Current);
+		}
+
+		uint16 Depth = Current >= 0 ? static_cast<uint16>(NewDepths[Current] + 1) : 0;
+		for (auto It = Chain.rbegin(); It != Chain.rend(); ++It)
+		{
+			NewDepths[*It] = Depth++;
+		}
+		MaxDepth = std::max<uint16>(MaxDepth, NewDepths[Index]);
+	}
+
+	TArray<int32> DepthOffsets(static_cast<size_t>(MaxDepth) + 2, 0);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		if (Components[Index])
+		{
+			++DepthOffsets[NewDepths[Index] + 1];
+		}
+	}
+	for (size_t Depth = 1; Depth < DepthOffsets.size(); ++Depth)
+	{
+		DepthOffsets[Depth] += DepthOffsets[Depth - 1];
+	}
+
+	TArray<int32> NewIndices(Count, -1);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		if (Components[Index])
+		{
+			NewIndices[Index] = DepthOffsets[NewDepths[Index]]++;
+		}
+	}
+
+	TArray<FMatrix> SortedLocalMatrices(LiveCount);
+	TArray<FMatrix> SortedWorldMatrices(LiveCount);
+	TArray<int32> SortedParentIndices(LiveCount);
+	TArray<uint32> SortedWorldVersions(LiveCount);
+	TArray<uint32> SortedParentVersions(LiveCount);
+	TArray<uint16> SortedDepths(LiveCount);
+	TArray<uint8> SortedFlags(LiveCount);
+	TArray<USceneComponent*> SortedComponents(LiveCount);
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const int32 NewIndex = NewIndices[Index];
+		if (NewIndex < 0)
+		{
+			continue;
+		}
+
+		const int32 Parent = GetLiveParent(Index);
+		SortedLocalMatrices[NewIndex] = LocalMatrices[Index];
+		SortedWorldMatrices[NewIndex] = WorldMatrices[Index];
+		SortedParentIndices[NewIndex] = Parent >= 0 ? NewIndices[Parent] : -1;
+		SortedWorldVersions[NewIndex] = WorldVersions[Index];
+		SortedParentVersions[NewIndex] = ParentVersions[Index];
+		SortedDepths[NewIndex] = NewDepths[Index];
+		// 부모가 제거되어 루트가 된 슬롯은 로컬 행렬만으로 다시 계산해야 한다
+		SortedFlags[NewIndex] = Flags[Index] | (ParentIndices[Index] >= 0 && Parent < 0 ? FLAG_DIRTY : FLAG_NONE);
+		SortedComponents[NewIndex] = Components[Index];
+
+		Components[Index]->TransformIndex = NewIndex;
+	}
+
+	LocalMatrices = std::move(SortedLocalMatrices);
+	WorldMatrices = std::move(SortedWorldMatrices);
+	ParentIndices = std::move(SortedParentIndices);
+	WorldVersions = std::move(SortedWorldVersions);
+	ParentVersions = std::move(SortedParentVersions);
+	Depths = std::move(SortedDepths);
+	Flags = std::move(SortedFlags);
+	Components = std::move(SortedComponents);
+
+	bIsOrderDirty = false;
+	bHasPendingChanges = true;
+}
+
+/**
+ * @brief 부모가 항상 자식보다 앞에 있으므로 한 번의 선형 순회로 변경이 자손까지 전파된다
+ * 변경이 없는 슬롯은 플래그와 부모 버전 비교만 하고 지나간다.
+ */
+void FTransformHierarchy::Update()
+{
+	if (bIsOrderDirty)
+	{
+		SortByDepth();
+	}
+
+	LastUpdatedCount = 0;
+	if (!bHasPendingChanges)
+	{
+		return;
+	}
+
+	const int32 Count = Num();
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const int32 Parent = ParentIndices[Index];
+		if (NeedsUpdate(Index, Parent))
+		{
+			UpdateWorld(Index, Parent);
+			++LastUpdatedCount;
+		}
+	}
+
+	bHasPendingChanges = false;
+}
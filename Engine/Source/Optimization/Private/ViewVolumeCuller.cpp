@@ -3,9 +3,12 @@
 
 #include "Component/Light/Public/AmbientLightComponent.h"
 #include "Component/Light/Public/DirectionalLightComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Core/Public/Object.h"
 #include "Global/Octree.h"
 #include "Level/Public/Level.h"
+#include "Optimization/Public/PrimitiveBoundsSoA.h"
+#include "Optimization/Public/RenderProxyList.h"
 
 namespace
 {
@@ -19,10 +22,11 @@ namespace
 }
 
 void ViewVolumeCuller::Cull (
-	FOctree* StaticOctree,
+	const FOctree* StaticOctree,
 	const TArray<UPrimitiveComponent*>& DynamicPrimitives,
 	const TArray<ULightComponent*>& Lights,
-	const FCameraConstants& ViewProjConstants)
+	const FCameraConstants& ViewProjConstants,
+	const FPrimitiveBoundsSoA* PrimitiveBounds)
 {
 	// 이전의 Cull했던 정보를 지운다.
 	RenderableObjects.clear();
@@ -50,19 +54,39 @@ void ViewVolumeCuller::Cull (
 	}
 
 	// 2. 옥트리를 이용해 보이는 객체만 RenderableObjects에 저장한다.
+	CandidateIndices.clear();
 	if (StaticOctree)
 	{
-		CullOctree(StaticOctree);
+		CullOctree(StaticOctree, PrimitiveBounds);
 	}
 
 	for (UPrimitiveComponent* Primitive : DynamicPrimitives)
 	{
-		if (Primitive && CurrentFrustum.CheckIntersection(GetPrimitiveBoundingBox(Primitive)) != EBoundCheckResult::Outside)
+		if (Primitive && !AddCullCandidate(Primitive, PrimitiveBounds) &&
+			CurrentFrustum.CheckIntersection(GetPrimitiveBoundingBox(Primitive)) != EBoundCheckResult::Outside)
 		{
 			RenderableObjects.push_back(Primitive);
 		}
 	}
 
+	// 3. 부분적으로 겹친 노드의 프리미티브를 SoA 커널로 4개씩 검사하고, 비트마스크에서 보이는 것만 꺼낸다.
+	if (PrimitiveBounds && !CandidateIndices.empty())
+	{
+		PrimitiveBounds->CullIndices(CurrentFrustum, CandidateIndices, VisibilityMask);
+
+		for (size_t WordIndex = 0; WordIndex < VisibilityMask.size(); ++WordIndex)
+		{
+			uint64 Word = VisibilityMask[WordIndex];
+			for (size_t Bit = 0; Word != 0; ++Bit, Word >>= 1)
+			{
+				if (Word & 1)
+				{
+					RenderableObjects.push_back(PrimitiveBounds->GetPrimitive(CandidateIndices[WordIndex * 64 + Bit]));
+				}
+			}
+		}
+	}
+
 	for (ULightComponent* Light : Lights)
 	{
 		if (Light)
@@ -80,12 +104,11 @@ void ViewVolumeCuller::Cull (
 	//UE_LOG("전체 Light: %d , Frustum Cull 후 Light: %d", static_cast<int32>(Lights.size()),static_cast<int32>(RenderableLights.size()));
 }
 
-const TArray<UPrimitiveComponent*>& ViewVolumeCuller::GetRenderableObjects()
+void ViewVolumeCuller::AppendDynamicPrimitives()
 {
 	// Octree에 없는 DynamicPrimitives들 추가
 	TArray<UPrimitiveComponent*>& DynamicPrimitives = GWorld->GetLevel()->GetDynamicPrimitives();
 	RenderableObjects.insert(RenderableObjects.end(), DynamicPrimitives.begin(), DynamicPrimitives.end());
-	return RenderableObjects;
 }
 
 const TArray<ULightComponent*>& ViewVolumeCuller::GetRenderableLights()
@@ -93,21 +116,83 @@ const TArray<ULightComponent*>& ViewVolumeCuller::GetRenderableLights()
 	return RenderableLights;
 }
 
-void ViewVolumeCuller::CullOctree(FOctree* Octree)
+void ViewVolumeCuller::EmitProxyVisibility(int32 InProxyCount, TArray<uint64>& OutVisibility) const
+{
+	OutVisibility.assign((static_cast<size_t>(InProxyCount) + 63) / 64, 0);
+	for (const UPrimitiveComponent* Primitive : RenderableObjects)
+	{
+		const int32 Index = Primitive->RenderProxyIndex;
+		if (Index >= 0 && Index < InProxyCount)
+		{
+			OutVisibility[Index >> 6] |= 1ull << (Index & 63);
+		}
+	}
+}
+
+void ViewVolumeCuller::SelectLODs(const FCameraConstants& ViewProjConstants, const FRenderProxyList& RenderProxies)
+{
+	const int32 ProxyCount = RenderProxies.Num();
+	ProxyLODs.resize(ProxyCount);
+
+	for (UPrimitiveComponent* Primitive : RenderableObjects)
+	{
+		const int32 Index = Primitive->RenderProxyIndex;
+		if (Index < 0 || Index >= ProxyCount ||
+			FRenderSortKey::GetPass(RenderProxies.GetSortKey(Index)) != ERenderProxyPass::StaticMesh)
+		{
+			continue;
+		}
+
+		FVector Min, Max;
+		Primitive->GetWorldAABB(Min, Max);
+		const float ScreenSize = ComputeScreenSize(Min, Max, ViewProjConstants);
+		FProxyLOD& Entry = ProxyLODs[Index];
+		if (Entry.Primitive != Primitive)
+		{
+			// 스왑 제거로 옮겨 왔거나 새로 추가된 프록시, 다른 프리미티브가 남긴 LOD를 이어받지 않는다
+			Entry.Primitive = Primitive;
+			Entry.LOD = 0;
+		}
+		Entry.LOD = static_cast<uint8>(static_cast<UStaticMeshComponent*>(Primitive)->SelectLOD(ScreenSize, Entry.LOD));
+	}
+}
+
+float ViewVolumeCuller::ComputeScreenSize(const FVector& InMin, const FVector& InMax, const FCameraConstants& ViewProjConstants)
+{
+	const FVector Center = (InMin + InMax) * 0.5f;
+	const float Radius = (InMax - InMin).Length() * 0.5f;
+
+	// 투영 행렬의 배율은 NDC 기준(화면 높이 = 2)이므로 반으로 나눠 화면 높이 비율로 맞춘다
+	const FMatrix& Projection = ViewProjConstants.Projection;
+	const float ScreenMultiple = std::max(0.5f * Projection.Data[0][0], 0.5f * Projection.Data[1][1]);
+
+	// 직교 투영은 거리와 무관하게 크기가 같다
+	if (Projection.Data[3][3] == 1.0f)
+	{
+		return 2.0f * ScreenMultiple * Radius;
+	}
+
+	// 카메라가 경계 구 안에 있으면 화면을 덮는 것으로 본다
+	const float Distance = (Center - ViewProjConstants.ViewWorldLocation).Length();
+	return 2.0f * ScreenMultiple * Radius / std::max(Distance, Radius);
+}
+
+void ViewVolumeCuller::CullOctree(const FOctree* Octree, const FPrimitiveBoundsSoA* PrimitiveBounds)
 {
 	if (!Octree) { return; }
 
 	// 0. 탐색할 노드를 추가합니다.
-	TDeque<FOctree*> VisitngNodes;
-	VisitngNodes.push_back(Octree);
+	TArray<int32> VisitingNodes;
+	VisitingNodes.push_back(Octree->GetRootIndex());
 
-	while (VisitngNodes.empty() == false)
+	while (VisitingNodes.empty() == false)
 	{
-		FOctree* CurrentNode = VisitngNodes.back();
-		VisitngNodes.pop_back();
+		const int32 CurrentNodeIndex = VisitingNodes.back();
+		const FOctreeNode& CurrentNode = Octree->GetNode(CurrentNodeIndex);
+		VisitingNodes.pop_back();
 
-		// 현재 옥트리 노드(자신)의 경계와 절두체의 관계를 확인합니다.
-		EBoundCheckResult result = CurrentFrustum.CheckIntersection(CurrentNode->GetBoundingBox());
+		// 현재 옥트리 노드(자신)의 느슨한 경계와 절두체의 관계를 확인합니다.
+		EBoundCheckResult result = CurrentFrustum.CheckIntersection(CurrentNode.LooseBounds);
 	
 		// Case 1. 노드가 절두체 밖에 있다면, 즉시 다음 노드로 넘어갑니다. 
 		if (result == EBoundCheckResult::Outside)
@@ -117,36 +202,40 @@ void ViewVolumeCuller::CullOctree(FOctree* Octree)
 		// Case 2. 노드가 절두체 안에 완전히 포함된다면, 전부 포함하고 다음 노드로 넘어갑니다.
 		else if (result == EBoundCheckResult::Inside)
 		{
-			TArray<UPrimitiveComponent*> Primitives;
-			CurrentNode->GetAllPrimitives(Primitives);
-			RenderableObjects.insert(RenderableObjects.end(), Primitives.begin(), Primitives.end());
+			Octree->GetAllPrimitives(CurrentNodeIndex, RenderableObjects);
 			continue;
 		}
 		// Case 3. 노드가 절두체와 부분적으로 겹쳐진다면, 개별 검사를 합니다.
 		else if (result == EBoundCheckResult::Intersect)
 		{
-			// 노드가 겹치면, 현재 노드에 있는 프리미티브들만 개별적으로 검사합니다.
-			for (UPrimitiveComponent* Primitive : CurrentNode->GetPrimitives())
+			// 노드가 겹치면, 현재 노드에 있는 프리미티브들만 개별 검사 대상으로 모읍니다.
+			for (const FOctreeElement& Element : CurrentNode.Elements)
 			{
-				if (Primitive && 
-					CurrentFrustum.CheckIntersection(GetPrimitiveBoundingBox(Primitive)) != EBoundCheckResult::Outside)
+				if (Element.Primitive && !AddCullCandidate(Element.Primitive, PrimitiveBounds) &&
+					CurrentFrustum.CheckIntersection(FAABB(Element.Min, Element.Max)) != EBoundCheckResult::Outside)
 				{
-					RenderableObjects.push_back(Primitive);
+					RenderableObjects.push_back(Element.Primitive);
 				}
 			}
 
 			// 2. 자식 노드들을 탐색 대상에 추가합니다.
-			if (CurrentNode->IsLeafNode() == false)
+			for (int32 Octant = 0; Octant < 8; ++Octant)
 			{
-				const TArray<FOctree*>& Children = CurrentNode->GetChildren();
-				for (FOctree* Child : Children)
-				{
-					if (Child != nullptr) { VisitngNodes.push_back(Child); }
-				}
+				if (CurrentNode.HasChild(Octant)) { VisitingNodes.push_back(CurrentNode.Children[Octant]); }
 			}
-
 		}
 
 	}
 
 }
+
+bool ViewVolumeCuller::AddCullCandidate(UPrimitiveComponent* Primitive, const FPrimitiveBoundsSoA* PrimitiveBounds)
+{
+	if (!PrimitiveBounds || !PrimitiveBounds->Contains(Primitive))
+	{
+		return false;
+	}
+
+	CandidateIndices.push_back(Primitive->PrimitiveBoundsIndex);
+	return true;
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Render/RenderPass/Public/LightCullingPass.h"
+
+class FJobSystem;
+
+/** @brief LightingCommon.hlsli의 ClusterLightInfo(uint2)와 같은 배치, 클러스터 라이트 목록의 위치 */
+struct FClusterLightInfo
+{
+	uint32 Offset = 0;
+	uint32 Count = 0;
+};
+
+/**
+ * @brief 뷰포트를 32x32 픽셀 타일과 지수 분포 깊이 슬라이스로 나눈 클러스터마다 영향을 주는 라이트 목록을 CPU에서 만든다
+ * 1. 라이트를 뷰 공간 구(스포트라이트는 원뿔을 감싸는 구)로 바꾸고, 열/행 경계 평면까지의 거리를 SSE로 4개씩 계산해
+ *    라이트마다 통과하는 열/행/슬라이스 마스크를 만든다. 측면 평면이 열과 행에 각각 하나씩이라 판정이 축별로 분리된다.
+ * 2. 라이트를 걸친 (슬라이스, 행) 칸에 나눠 담은 뒤, 칸마다 열 마스크로 클러스터별 목록을 만들고,
+ *    스포트라이트는 클러스터 경계 구와의 원뿔 판정을 가로로 인접한 클러스터 4개씩 SSE로 한 번 더 한다.
+ * 3. 클러스터별 개수를 접두사 합으로 이어 붙여 빈틈 없는 인덱스 목록과 (Offset, Count)를 만든다.
+ * 각 클러스터의 목록은 라이트 인덱스 오름차순이므로 결과는 워커 수와 무관하게 BuildReference와 비트 단위로 같다.
+ * @note 앰비언트/디렉셔널 라이트는 모든 클러스터에 들어간다. 직교 투영에서는 깊이 슬라이스를 나누지 않고 모든 슬라이스가 Near ~ Far 전체를 덮는다.
+ */
+class FClusteredLightCuller
+{
+public:
+	/**
+	 * @brief InLights를 클러스터에 배정하고 결과 목록을 갱신
+	 * @param InParams View, Projection, ViewportSize, NearClip, FarClip만 사용 (NumLights 대신 InLights 크기를 쓴다)
+	 * @param InJobSystem 주어지면 라이트 준비와 (슬라이스, 행) 작업을 나눠 병렬 실행
+	 */
+	void Build(const FCullingParams& InParams, const TArray<FLightParams>& InLights, FJobSystem* InJobSystem);
+
+	/** @brief 모든 클러스터와 라이트 쌍을 스칼라로 검사하는 검증용 구현, Build와 같은 결과를 만든다 */
+	void BuildReference(const FCullingParams& InParams, const TArray<FLightParams>& InLights);
+
+	/** @brief 클러스터 인덱스(z * X * Y + y * X + x) 순서의 (Offset, Count) */
+	const TArray<FClusterLightInfo>& GetClusterLightInfo() const { return ClusterLightInfo; }
+	/** @brief 클러스터 순서로 이어 붙인 라이트 인덱스, 크기는 실제 배정 수의 합과 같다 */
+	const TArray<uint32>& GetLightIndices() const { return LightIndices; }
+
+	uint32 GetClusterCountX() const { return ClusterCountX; }
+	uint32 GetClusterCountY() const { return ClusterCountY; }
+	uint32 GetClusterCount() const { return ClusterCountX * ClusterCountY * CLUSTER_SIZE_Z; }
+	/** @brief MAX_LIGHTS_PER_CLUSTER를 넘어 목록이 잘린 클러스터 수 */
+	uint32 GetOverflowClusterCount() const { return OverflowClusterCount; }
+
+	/** @brief 셰이더 정의(ShaderDefines.hlsli)와 같은 클러스터 크기 */
+	static constexpr uint32 CLUSTER_SIZE_X = 32;
+	static constexpr uint32 CLUSTER_SIZE_Y = 32;
+	static constexpr uint32 CLUSTER_SIZE_Z = 16;
+	/** @brief 로그 분포 슬라이스가 0 깊이에서 무너지지 않도록 Near를 이 값 이상으로 본다 (셰이더의 CLUSTER_MIN_NEAR_CLIP과 같음) */
+	static constexpr float MIN_NEAR_CLIP = 1e-4f;
+
+	/** @brief 클러스터 하나에 담는 라이트 상한, 넘으면 인덱스가 작은 라이트부터 남긴다 (기존 컴퓨트 셰이더의 groupshared 한도와 같음) */
+	static constexpr uint32 MAX_LIGHTS_PER_CLUSTER = 1024;
+
+private:
+	enum class ECullShape : uint8
+	{
+		None,
+		Global,
+		Sphere,
+		Cone
+	};
+
+	/** @brief 뷰 공간으로 옮긴 라이트, 구는 모든 라이트의 경계이고 원뿔 값은 Cone일 때만 쓴다 */
+	struct FCullLight
+	{
+		ECullShape Shape = ECullShape::None;
+		float CenterX = 0.0f, CenterY = 0.0f, CenterZ = 0.0f, Radius = 0.0f;
+		float ApexX = 0.0f, ApexY = 0.0f, ApexZ = 0.0f;
+		float DirX = 0.0f, DirY = 0.0f, DirZ = 0.0f;
+		float CosAngle = 0.0f, SinAngle = 0.0f, Range = 0.0f;
+
+		/** @brief 통과한 열/행/슬라이스의 범위, 범위 안에서도 마스크로 한 번 더 확인한다 */
+		int32 MinX = 0, MaxX = -1;
+		int32 MinY = 0, MaxY = -1;
+		int32 MinZ = 0, MaxZ = -1;
+	};
+
+	/** @brief (슬라이스, 행) 작업 하나의 입력과 결과, 모두 라이트 인덱스 오름차순이며 용량은 프레임 간 재사용한다 */
+	struct FRowScratch
+	{
+		/** @brief 이 슬라이스와 행에 걸친 라이트 */
+		TArray<uint32> Lights;
+		/** @brief 열(클러스터)마다 최종 판정을 통과한 라이트 */
+		TArray<TArray<uint32>> ColumnLights;
+	};
+
+	/** @brief 열/행 경계 평면과 슬라이스 깊이, 클러스터 경계 구를 계산 */
+	void SetUpGrid(const FCullingParams& InParams, FJobSystem* InJobSystem);
+	void PrepareLight(const FLightParams& InLight, const FMatrix& InView, FCullLight& OutLight) const;
+	/** @brief 라이트 하나의 열/행/슬라이스 마스크를 SSE로 채우고 범위를 기록 */
+	void ComputeLightMasks(int32 InLightIndex);
+	void BuildRow(int32 InSlice, int32 InRow);
+
+	static void ParallelFor(FJobSystem* InJobSystem, int32 InCount, const TFunction<void(int32)>& InBody, int32 InBatchSize = 1);
+
+	/** @brief 스칼라 판정, BuildReference와 마스크가 같은 연산 순서를 써야 결과가 비트 단위로 일치한다 */
+	bool IsColumnVisible(const FCullLight& InLight, int32 InX) const;
+	bool IsRowVisible(const FCullLight& InLight, int32 InY) const;
+	bool IsSliceVisible(const FCullLight& InLight, int32 InZ) const;
+	bool IsConeVisible(const FCullLight& InLight, uint32 InClusterIndex) const;
+
+	uint32 ClusterCountX = 0;
+	uint32 ClusterCountY = 0;
+
+	/**
+	 * @brief 열 경계 i(픽셀 x = i * 32)의 평면 (Nx * x + Nz * z + D), 열이 커지는 방향이 양수
+	 * 행 경계도 같은 형태 (Ny * y + Nz * z + D)이며 행이 커지는(화면 아래) 방향이 양수
+	 */
+	TArray<float> ColumnPlaneN, ColumnPlaneZ, ColumnPlaneD;
+	TArray<float> RowPlaneN, RowPlaneZ, RowPlaneD;
+	/** @brief 슬라이스 k의 뷰 공간 깊이 범위, 원근 투영에서는 Near * (Far / Near)^(k / CLUSTER_SIZE_Z) 경계 */
+	float SliceNear[CLUSTER_SIZE_Z] = {};
+	float SliceFar[CLUSTER_SIZE_Z] = {};
+
+	/** @brief 클러스터 인덱스 순서의 경계 구 (SoA), 스포트라이트 원뿔 판정에 쓴다 */
+	TArray<float> ClusterCenterX, ClusterCenterY, ClusterCenterZ, ClusterRadius;
+
+	TArray<FCullLight> CullLights;
+	TArray<uint8> ColumnMasks;
+	TArray<uint8> RowMasks;
+	TArray<uint8> SliceMasks;
+	TArray<FRowScratch> RowScratches;
+
+	TArray<FClusterLightInfo> ClusterLightInfo;
+	TArray<uint32> LightIndices;
+	uint32 OverflowClusterCount = 0;
+};
@@ -0,0 +1,102 @@
+#pragma once
+
+struct FStaticMesh;
+class UMaterial;
+
+/**
+ * @brief 인스턴스 버퍼의 원소 하나, UberShader INSTANCED 퍼뮤테이션의 INSTANCE_WORLD / INSTANCE_NORMAL 입력과 같은 배치
+ */
+struct FInstanceData
+{
+	FMatrix World;
+	FMatrix WorldInverseTranspose;
+};
+
+/**
+ * @brief 같은 메시의 같은 LOD를 같은 머티리얼 세트로 그리는 인스턴스 묶음, 인스턴스 버퍼의 [FirstInstance, FirstInstance + InstanceCount) 구간
+ */
+struct FInstanceBatch
+{
+	const FStaticMesh* Mesh = nullptr;
+	int32 MaterialSetIndex = -1;
+	/** @brief FStaticMesh::GetLODSections로 그릴 섹션을 고른다 */
+	int32 LODIndex = 0;
+	uint32 FirstInstance = 0;
+	uint32 InstanceCount = 0;
+	/** @brief 이 배치에 처음 추가된 인스턴스의 AddInstance 호출 순번, 배치 대표 컴포넌트를 찾을 때 사용 */
+	uint32 FirstSourceIndex = 0;
+	/** @brief 압축 정점 메시의 [0,1] 위치 -> 로컬 행렬, Build가 인스턴스 World 앞에 곱한다 (일반 메시는 nullptr) */
+	const FMatrix* PositionToLocal = nullptr;
+};
+
+/**
+ * @brief 스태틱 메시 인스턴스를 (메시, LOD, 머티리얼 세트) 배치로 묶고 인스턴스 행렬을 배치 순서대로 한 배열에 채우는 CPU 모듈
+ * - 머티리얼 세트는 섹션 순서의 머티리얼 목록으로, 내용이 같으면 같은 인덱스를 돌려준다
+ * - AddInstance는 배치 인덱스만 정하고 행렬 포인터를 기록한다. 직전과 같은 (메시, LOD, 세트)는 맵을 보지 않는다
+ * - Build는 배치별 개수의 누적합으로 자리를 정해 한 번에 흩어 쓰므로 정렬 없이 O(N)이고, 배치 안의 순서는 추가 순서를 따른다
+ * D3D에 의존하지 않으며, 결과 배열을 그대로 인스턴스 정점 버퍼에 올리면 배치마다 한 번의 DrawIndexedInstanced로 그릴 수 있다.
+ * @note AddInstance에 넘긴 행렬은 Build가 끝날 때까지 유효해야 한다
+ */
+class FInstanceBatchBuilder
+{
+public:
+	/** @brief 인스턴스와 배치를 비운다, 머티리얼 세트와 배열 용량은 프레임 사이에 유지 */
+	void Reset();
+
+	/** @return InMaterials[0, InCount)와 같은 목록의 세트 인덱스, 처음 보는 목록이면 새로 등록 */
+	int32 FindOrAddMaterialSet(UMaterial* const* InMaterials, int32 InCount);
+	int32 GetMaterialSetSize(int32 InSetIndex) const { return MaterialSets[InSetIndex].Count; }
+	UMaterial* const* GetMaterialSet(int32 InSetIndex) const { return MaterialSetStorage.data() + MaterialSets[InSetIndex].Offset; }
+	int32 GetMaterialSetCount() const { return static_cast<int32>(MaterialSets.size()); }
+
+	/**
+	 * @return 인스턴스가 들어갈 배치 인덱스, 역행렬은 Build에서 전치해 기록한다
+	 * @param InPositionToLocal 메시 단위 위치 복원 행렬, 같은 메시면 배치를 처음 만들 때 넘긴 값을 쓴다
+	 * @param InLODIndex 이 인스턴스를 그릴 LOD, LOD가 다르면 같은 메시와 세트라도 다른 배치가 된다
+	 */
+	int32 AddInstance(const FStaticMesh* InMesh, int32 InMaterialSetIndex, const FMatrix* InWorld, const FMatrix* InWorldInverse,
+		const FMatrix* InPositionToLocal = nullptr, int32 InLODIndex = 0);
+
+	/** @brief 배치별 구간을 정하고 인스턴스 데이터를 배치 순서로 채운다 */
+	void Build();
+
+	/** @brief 처음 등장한 순서의 배치 목록 */
+	const TArray<FInstanceBatch>& GetBatches() const { return Batches; }
+	const TArray<FInstanceData>& GetInstanceData() const { return InstanceData; }
+	int32 GetInstanceCount() const { return static_cast<int32>(PendingInstances.size()); }
+
+private:
+	struct FMaterialSetRange
+	{
+		uint32 Offset;
+		int32 Count;
+		/** @brief 같은 해시 버킷의 다음 세트, 없으면 -1 */
+		int32 NextInBucket;
+	};
+
+	struct FPendingInstance
+	{
+		const FMatrix* World;
+		const FMatrix* WorldInverse;
+		int32 BatchIndex;
+	};
+
+	int32 FindOrAddBatch(const FStaticMesh* InMesh, int32 InMaterialSetIndex, int32 InLODIndex, uint32 InSourceIndex, const FMatrix* InPositionToLocal);
+	static size_t HashMaterials(UMaterial* const* InMaterials, int32 InCount);
+
+	TArray<UMaterial*> MaterialSetStorage;
+	TArray<FMaterialSetRange> MaterialSets;
+	TMap<size_t, int32> MaterialSetBuckets;
+
+	/** @brief 메시별 첫 배치, 같은 메시의 다른 (LOD, 세트) 배치는 NextBatchOfMesh로 잇는다 */
+	TMap<const FStaticMesh*, int32> FirstBatchOfMesh;
+	TArray<int32> NextBatchOfMesh;
+	TArray<FInstanceBatch> Batches;
+	TArray<FPendingInstance> PendingInstances;
+	TArray<FInstanceData> InstanceData;
+
+	const FStaticMesh* LastMesh = nullptr;
+	int32 LastMaterialSetIndex = -1;
+	int32 LastLODIndex = 0;
+	int32 LastBatchIndex = -1;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Component/Mesh/Public/StaticMesh.h"
+
+struct FCameraConstants;
+struct FFrustum;
+
+/** @brief 그릴 인덱스 구간 하나, 이어진 보이는 메시렛은 한 구간으로 합쳐진다 */
+struct FMeshletDrawRange
+{
+	uint32 SectionIndex = 0;
+	uint32 StartIndex = 0;
+	uint32 IndexCount = 0;
+};
+
+/** @brief 메시렛 컬링 누적 통계 (벤치마크와 디버그 출력용) */
+struct FMeshletCullStats
+{
+	uint64 TotalMeshlets = 0;
+	uint64 FrustumCulled = 0;
+	uint64 ConeCulled = 0;
+	uint64 TotalTriangles = 0;
+	uint64 VisibleTriangles = 0;
+};
+
+/**
+ * @brief 메시 로컬 공간으로 옮긴 시점, 인스턴스마다 한 번 만들어 모든 메시렛에 쓴다
+ * 메시렛 경계를 월드로 옮기는 대신 평면과 카메라를 로컬로 옮기므로 비균등 스케일에서도 판정이 정확하다.
+ */
+struct FMeshletCullView
+{
+	/** @brief 로컬 공간 절두체 평면 (바깥쪽 노멀, 정규화하지 않음) */
+	FVector4 Planes[6];
+	/** @brief 평면 노멀의 길이, 경계 구 반지름에 곱한다 */
+	float PlaneNormalLengths[6] = {};
+	/** @brief 로컬 공간 카메라 위치 (원근) 또는 시선 방향 (직교) */
+	FVector CameraLocation;
+	FVector ViewDirection;
+	bool bIsOrthographic = false;
+	/** @brief 뒷면 컬링이 꺼졌거나 음수 스케일로 감기 순서가 뒤집힌 인스턴스는 콘 컬링을 하지 않는다 */
+	bool bIsConeCullingEnabled = false;
+};
+
+enum class EMeshletVisibility : uint8
+{
+	Visible,
+	FrustumCulled,
+	ConeCulled
+};
+
+/**
+ * @brief FMeshletBuilder가 만든 메시렛을 매 프레임 절두체와 노멀 콘으로 걸러 그릴 인덱스 구간을 만드는 CPU 모듈
+ * - 절두체: 경계 구가 한 평면이라도 완전히 바깥이면 버린다
+ * - 콘: 카메라가 모든 삼각형의 뒤쪽에 있으면 버린다, 판정은 보수적이라 보이는 삼각형은 버리지 않는다
+ * D3D에 의존하지 않으며, FStaticMeshPass가 LOD0으로 하나만 그리는 인스턴스에 쓴다.
+ */
+struct FMeshletCuller
+{
+	/**
+	 * @param InFrustum 월드 공간 절두체 (ViewVolumeCuller::GetFrustum)
+	 * @param bInBackfaceCulling 래스터라이저가 뒷면을 버리는지, 아니면 콘 컬링을 하지 않는다
+	 */
+	static FMeshletCullView MakeView(const FFrustum& InFrustum, const FCameraConstants& InCamera,
+		const FMatrix& InWorld, const FMatrix& InWorldInverse, bool bInBackfaceCulling);
+
+	static EMeshletVisibility TestMeshlet(const FMeshlet& InMeshlet, const FMeshletCullView& InView);
+
+	/**
+	 * @brief 보이는 메시렛의 인덱스 구간을 OutRanges 뒤에 덧붙인다, 같은 섹션에서 이어진 메시렛은 하나로 합친다
+	 * @return 덧붙인 구간 수
+	 */
+	static uint32 Cull(const FStaticMesh& InMesh, const FMeshletCullView& InView, TArray<FMeshletDrawRange>& OutRanges,
+		FMeshletCullStats* OutStats = nullptr);
+};
@@ -1,100 +1,114 @@
 ﻿#pragma once
 
-/**
- * @brief Occlusion Culling 을 담당하는 클래스
- */
+class FJobSystem;
+class FPrimitiveBoundsSoA;
 class UPrimitiveComponent;
+struct FCameraConstants;
+struct FNormalVertex;
 
+/**
+ * @brief 절두체 컬링 이후 다른 물체에 가려진 프리미티브를 걸러내는 CPU 소프트웨어 오클루전 컬러
+ * 1. 화면에서 크게 보이는 불투명 스태틱 메시를 오클루더로 골라, 정점을 SSE로 4개씩 투영하고 삼각형을 8x8 타일에 비닝한다.
+ * 2. 타일마다 엣지 함수를 4픽셀씩 평가한 커버리지 마스크로 깊이를 기록하고, 타일별 최소/최대 깊이 계층을 만든다.
+ * 3. 오클루디 AABB는 화면 사각형과 최근접 깊이로 타일 계층을 먼저 보고, 판단이 안 되는 타일만 픽셀 단위로 검사한다.
+ * 타일끼리는 쓰는 메모리가 겹치지 않으므로 래스터화는 작업 시스템에서 타일 행 단위로 병렬 실행된다.
+ * @note 카메라마다 하나씩 두고, URenderer::CullViewports가 뷰포트 작업 안에서 절두체 컬링 직후 호출한다.
+ */
 class COcclusionCuller
 {
 public:
-    COcclusionCuller();
-
-    /**
-     * @brief 컬링 프로세스를 위한 환경을 초기화하고 View/Projection 행렬을 설정.
-     * 매 프레임 컬링을 시작하기 전에 호출되어야 함
-     */
-    void InitializeCuller(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix);
-
-     /**
-     * @brief 오클루전 컬링의 전체 프로세스를 실행하고 최종 가시 오브젝트 목록을 반환
-     * @param AllStaticMeshes 프러스텀 컬링을 통과한 모든 스태틱 메시 목록
-     * @param CameraPos 현재 카메라 위치
-     * @return 렌더링되어야 할 UPrimitiveComponent 목록
-     */
-    TArray<UPrimitiveComponent*> PerformCulling(const TArray<UPrimitiveComponent*>& AllStaticMeshes, const FVector& CameraPos);
-
-    // Constants
-    static constexpr int Z_BUFFER_WIDTH = 256;
-    static constexpr int Z_BUFFER_HEIGHT = 256;
-    static constexpr int Z_BUFFER_SIZE = Z_BUFFER_WIDTH * Z_BUFFER_HEIGHT;
+	COcclusionCuller();
+
+	/**
+	 * @brief 절두체 컬링 결과에서 가려진 프리미티브를 순서를 유지한 채 제거
+	 * @param InOutPrimitives ViewVolumeCuller의 절두체 컬링 결과, 가려진 프리미티브가 빠진 목록으로 바뀜
+	 * @param InPrimitiveBounds 레벨의 SoA 월드 AABB, 여기에 없는 프리미티브는 검사하지 않고 남겨 둠
+	 * @param InJobSystem 주어지면 래스터화를 타일 행 단위 작업으로 나눠 실행
+	 * @note 오클루더의 월드 행렬은 읽기만 하므로 호출 전에 갱신되어 있어야 한다 (ULevel::PrepareForCulling).
+	 */
+	void Cull(TArray<UPrimitiveComponent*>& InOutPrimitives, const FCameraConstants& InViewProjConstants,
+		const FPrimitiveBoundsSoA* InPrimitiveBounds, FJobSystem* InJobSystem);
+
+	/** @brief 깊이 버퍼와 오클루더 목록을 비우고 이번 프레임의 View * Projection을 설정 */
+	void BeginFrame(const FMatrix& InViewProj);
+
+	/**
+	 * @brief 메시 삼각형을 화면 공간으로 투영해 오클루더 목록에 추가
+	 * @param bInCullBackFace 렌더러처럼 뒷면(화면에서 시계 방향)을 버릴지 여부
+	 * @return 실제로 추가된 삼각형 수 (근평면을 넘거나 화면 밖인 삼각형은 보수적으로 버림)
+	 */
+	int32 AddOccluderMesh(const FNormalVertex* InVertices, int32 InVertexCount, const uint32* InIndices, int32 InIndexCount,
+		const FMatrix& InWorld, bool bInCullBackFace);
+
+	/** @brief 월드 AABB를 박스 메시(삼각형 12개)로 오클루더 목록에 추가 */
+	int32 AddOccluderBox(const FVector& InMin, const FVector& InMax);
+
+	/** @brief 추가된 오클루더를 타일별로 래스터화하고 타일 최소/최대 깊이를 갱신 */
+	void RasterizeOccluders(FJobSystem* InJobSystem);
+
+	/** @brief 월드 AABB가 래스터화된 오클루더에 완전히 가려지지 않았으면 true */
+	bool IsVisible(const FVector& InMin, const FVector& InMax) const;
+
+	int32 GetOccluderTriangleCount() const { return static_cast<int32>(Triangles.size()); }
+	int32 GetLastTestedCount() const { return LastTestedCount; }
+	int32 GetLastOccludedCount() const { return LastOccludedCount; }
+
+	static constexpr int32 Z_BUFFER_WIDTH = 256;
+	static constexpr int32 Z_BUFFER_HEIGHT = 256;
+	static constexpr int32 TILE_SIZE = 8;
+	static constexpr int32 TILE_COUNT_X = Z_BUFFER_WIDTH / TILE_SIZE;
+	static constexpr int32 TILE_COUNT_Y = Z_BUFFER_HEIGHT / TILE_SIZE;
+	static constexpr int32 TILE_COUNT = TILE_COUNT_X * TILE_COUNT_Y;
+	static constexpr int32 TILE_PIXEL_COUNT = TILE_SIZE * TILE_SIZE;
+
+	/** @brief 프레임당 래스터화할 오클루더 삼각형 상한, 큰 오클루더부터 채운다 */
+	static constexpr int32 OCCLUDER_TRIANGLE_BUDGET = 32768;
+	/** @brief 이보다 삼각형이 많은 메시는 오클루더로 쓰지 않음 (한 메시가 예산을 독차지하지 않도록) */
+	static constexpr int32 MAX_OCCLUDER_MESH_TRIANGLES = 8192;
+	/** @brief 오클루더 후보가 되는 최소 화면 크기, (AABB 반지름 / 카메라 거리)^2 */
+	static constexpr float MIN_OCCLUDER_SCREEN_SIZE = 0.01f;
 
 private:
-    /**
-    * @brief 카메라에서 과도하게 가까운 애들 제외
-    * @param AllCandidates 가까운 곳의 Occluders 후보
-    * @return 오클루더로 선정된 UPrimitiveComponent 목록
-    */
-    TArray<UPrimitiveComponent*> SelectOccluders(const TArray<UPrimitiveComponent*>& AllCandidates, const FVector& CameraPos);
-
-    void RasterizeOccluders(const TArray<UPrimitiveComponent*>& SelectedOccluders, const FVector& CameraPos);
-
-    /**
-     * @brief World Pos > Clip Space > Screen Coordinate
-     * @return 스크린 좌표 (X, Y)와 NDC Depth (Z)를 담은 FVector
-     */
-    FVector Project(const FVector& WorldPos) const;
-
-    /**
-     * @brief 해당 메시 컴포넌트가 Z-Buffer에 의해 가려지는지 테스트합니다.
-     * @return 바운딩 박스의 코너 중 하나라도 보이면 true를 반환합니다.
-     */
-    bool IsMeshVisible(const struct FWorldAABBData& AABBData);
-
-    struct BatchProjectionResult BatchProject4(const struct BatchProjectionInput& Input) const;
-
-
-    /**
-     * @brief CPU Z-Buffer에 삼각형을 래스터라이징, 깊이 테스트 수행
-     */
-    void RasterizeTriangle(const FVector& P1, const FVector& P2, const FVector& P3, TArray<float>& ZBuffer);
-
-    /**
-     * @brief PrimitiveComponent의 AABB를 12개의 삼각형 정점으로 변환
-     */
-    TArray<FVector> ConvertAABBToTriangles(class UPrimitiveComponent* PrimitiveComp);
-
-    TArray<float> CPU_ZBuffer;
-    FMatrix CurrentViewProj;
-
-    TArray<struct FWorldAABBData> CachedAABBs;
-    TArray<FVector> Triangles;
-    TArray<UPrimitiveComponent*> FilteredOccluders;    
-    TArray<UPrimitiveComponent*> VisibleMeshComponents;
-    uint32 Frame = 0;
-
-    // For SIMD
-    alignas(16) float SampleCoords[3][20];     // [0]=X, [1]=Y, [2]=Z
-    alignas(16) int32 TempPixelCoords[2][4];   // [0]=X, [1]=Y  
-    alignas(16) float TempScreenZ[4];
-};
-
-struct FWorldAABBData
-{
-    UPrimitiveComponent* Prim;
-    FVector Min;
-    FVector Max;
-    FVector Center; // 자주 사용되는 Center 값도 저장하여 계산 오버헤드 제거
-};
-
-struct alignas(16) BatchProjectionInput
-{
-    __m128 WorldX, WorldY, WorldZ; // 4개 점의 X, Y, Z 좌표
-};
-
-struct alignas(16) BatchProjectionResult
-{
-    __m128 ScreenX, ScreenY, ScreenZ; // 4개 점의 스크린 좌표
-    __m128i PixelX, PixelY;          // 정수형 픽셀 좌표
-    __m128 InBoundsMask;             // 화면 경계 내부 마스크
+	/** @brief 화면 공간 삼각형의 엣지 함수 3개와 깊이 평면, 픽셀 바운딩 박스 */
+	struct FOccluderTriangle
+	{
+		float EdgeA[3];
+		float EdgeB[3];
+		float EdgeC[3];
+		float DepthA;
+		float DepthB;
+		float DepthC;
+		int32 MinX, MaxX, MinY, MaxY;
+	};
+
+	/** @brief 정점 위치를 InMatrix로 4개씩 변환해 ScreenX/Y/Z에 기록하고, 근평면 뒤 정점은 ClipW를 0 이하로 남긴다 */
+	void ProjectVertices(const uint8* InFirstPosition, int32 InStride, int32 InCount, const FMatrix& InMatrix);
+	bool AddTriangle(int32 InIndex0, int32 InIndex1, int32 InIndex2, bool bInCullBackFace);
+	void RasterizeTile(int32 InTileIndex);
+
+	FMatrix ViewProj;
+
+	/** @brief 타일 순서로 저장한 픽셀 깊이 (타일 하나의 64픽셀이 연속), 가장 가까운 오클루더 깊이를 보관 */
+	TArray<float> DepthBuffer;
+	TArray<float> TileMinDepth;
+	TArray<float> TileMaxDepth;
+
+	TArray<FOccluderTriangle> Triangles;
+	TArray<TArray<int32>> TileBins;
+
+	TArray<float> ScreenX;
+	TArray<float> ScreenY;
+	TArray<float> ScreenZ;
+	TArray<float> ClipW;
+
+	/** @brief Cull에서 재사용하는 후보별 경계(SoA에 있을 때만 유효)와 오클루더 후보 (점수, 후보 인덱스) */
+	TArray<FVector> CandidateMin;
+	TArray<FVector> CandidateMax;
+	TArray<uint8> CandidateHasBounds;
+	/** @brief 이번 프레임 삼각형이 하나라도 래스터화된 후보, 자기 깊이에 가려지지 않도록 가시성 검사를 건너뛴다 */
+	TArray<uint8> CandidateIsOccluder;
+	TArray<std::pair<float, int32>> OccluderCandidates;
+
+	int32 LastTestedCount = 0;
+	int32 LastOccludedCount = 0;
 };
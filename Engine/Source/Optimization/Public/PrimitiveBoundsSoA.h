@@ -0,0 +1,77 @@
+#pragma once
+
+class UPrimitiveComponent;
+struct FFrustum;
+
+/**
+ * @brief 레벨에 등록된 프리미티브의 월드 AABB를 축별 배열(SoA)로 보관하는 컨테이너
+ * MinX[] ... MaxZ[]를 따로 저장해서 절두체 컬링 커널이 SSE로 박스 4개를 한 번에 읽는다.
+ * 슬롯 위치는 소유자가 보관하는 인덱스(UPrimitiveComponent::PrimitiveBoundsIndex)에 기록되고,
+ * 제거 시 마지막 슬롯을 빈자리로 옮기면서 옮겨진 소유자의 인덱스도 함께 갱신한다.
+ */
+class FPrimitiveBoundsSoA
+{
+public:
+	/** @brief 컴포넌트의 현재 월드 AABB로 슬롯을 추가, 이미 등록된 경우 경계만 갱신 */
+	int32 Add(UPrimitiveComponent* InPrimitive);
+	bool Remove(UPrimitiveComponent* InPrimitive);
+	/** @brief 컴포넌트의 현재 월드 AABB를 슬롯에 다시 기록 */
+	bool Update(UPrimitiveComponent* InPrimitive);
+	/**
+	 * @brief 이번 프레임에 움직인 프리미티브들의 월드 AABB를 한 번에 다시 계산 (UpdateOctree에서 호출)
+	 * 로컬 AABB가 있는 프리미티브는 모아서 TransformBounds로 변환하고 컴포넌트의 AABB 캐시도 같은 값으로 채운다.
+	 * 나머지(OBB, 빌보드)와 등록되지 않은 프리미티브는 개별 경로를 쓰거나 건너뛴다.
+	 */
+	void Update(const TArray<UPrimitiveComponent*>& InPrimitives);
+	bool Contains(const UPrimitiveComponent* InPrimitive) const;
+
+	/** @brief 슬롯 인덱스를 호출자가 보관하는 저수준 API, InOutIndex는 슬롯이 살아있는 동안 주소가 유지되어야 함 */
+	int32 Add(UPrimitiveComponent* InPrimitive, const FVector& InMin, const FVector& InMax, int32& InOutIndex);
+	bool Remove(int32& InOutIndex);
+	void SetBounds(int32 InIndex, const FVector& InMin, const FVector& InMax);
+
+	/**
+	 * @brief 로컬 AABB InCount개를 각자의 월드 행렬로 변환해 InSlots 슬롯에 기록하는 저수준 커널
+	 * 박스마다 중심/반경 방식(TransformAABB)을 SSE로 계산하므로 꼭짓점 8개를 변환하지 않는다.
+	 */
+	void TransformBounds(const int32* InSlots, const FMatrix* const* InWorldMatrices,
+		const FVector* InLocalMins, const FVector* InLocalMaxs, int32 InCount);
+
+	void Clear();
+
+	int32 Num() const { return Count; }
+	UPrimitiveComponent* GetPrimitive(int32 InIndex) const { return Primitives[InIndex]; }
+	void GetBounds(int32 InIndex, FVector& OutMin, FVector& OutMax) const;
+
+	/**
+	 * @brief [InFirst, InFirst + InCount) 슬롯을 절두체와 검사해 가시성 비트마스크를 기록
+	 * @param OutVisibilityMask 비트 i가 슬롯 InFirst + i에 대응, 절두체 밖이 아니면 1
+	 */
+	void CullRange(const FFrustum& InFrustum, int32 InFirst, int32 InCount, TArray<uint64>& OutVisibilityMask) const;
+
+	/**
+	 * @brief 임의의 슬롯 목록(옥트리의 Intersect 노드 요소 등)을 검사해 가시성 비트마스크를 기록
+	 * @param OutVisibilityMask 비트 i가 InIndices[i]에 대응
+	 */
+	void CullIndices(const FFrustum& InFrustum, const TArray<int32>& InIndices, TArray<uint64>& OutVisibilityMask) const;
+
+	/** @brief 비트마스크에서 켜진 비트 수 */
+	static uint32 CountVisible(const TArray<uint64>& InVisibilityMask);
+
+	/** @brief 한 번에 검사하는 박스 개수 (SSE 레인 수), 축별 배열은 항상 이 배수 크기로 유지 */
+	static constexpr int32 LANE_COUNT = 4;
+
+private:
+	void Reserve(int32 InCount);
+
+	TArray<float> MinX;
+	TArray<float> MinY;
+	TArray<float> MinZ;
+	TArray<float> MaxX;
+	TArray<float> MaxY;
+	TArray<float> MaxZ;
+
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<int32*> IndexRefs;
+	int32 Count = 0;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+class UPrimitiveComponent;
+
+/** @brief 렌더 프록시가 그려지는 패스, 정렬 키의 최상위 비트라서 명령 목록에서 패스별로 연속 구간이 된다 */
+enum class ERenderProxyPass : uint8
+{
+	StaticMesh,
+	BillBoard,
+	Text,
+	UUID,
+	Decal,
+	Count,
+	/** @brief 어느 패스도 그리지 않는 프리미티브, 명령 목록에서 빠진다 */
+	None = 0xF,
+};
+
+/**
+ * @brief 64비트 렌더 정렬 키
+ * | 63..60 패스 | 59..56 셰이더 퍼뮤테이션 | 55..40 머티리얼 | 39..24 메시 | 23..16 깊이 버킷 | 15..0 예약 |
+ * 깊이 버킷을 뺀 부분은 상태가 바뀔 때만 다시 만들고, 깊이 버킷은 프레임마다 카메라 거리로 채운다.
+ * 같은 패스, 셰이더, 머티리얼, 메시끼리 붙고 그 안에서는 가까운 것부터 그려진다.
+ */
+struct FRenderSortKey
+{
+	static constexpr uint32 PASS_SHIFT = 60;
+	static constexpr uint32 PERMUTATION_SHIFT = 56;
+	static constexpr uint32 MATERIAL_SHIFT = 40;
+	static constexpr uint32 MESH_SHIFT = 24;
+	static constexpr uint32 DEPTH_SHIFT = 16;
+
+	static constexpr uint32 PERMUTATION_MASK = 0xF;
+	static constexpr uint32 ID_MASK = 0xFFFF;
+	static constexpr uint32 DEPTH_MASK = 0xFF;
+
+	static uint64 Make(ERenderProxyPass InPass, uint32 InPermutation, uint32 InMaterialId, uint32 InMeshId)
+	{
+		return (static_cast<uint64>(InPass) << PASS_SHIFT) |
+			(static_cast<uint64>(InPermutation & PERMUTATION_MASK) << PERMUTATION_SHIFT) |
+			(static_cast<uint64>(InMaterialId & ID_MASK) << MATERIAL_SHIFT) |
+			(static_cast<uint64>(InMeshId & ID_MASK) << MESH_SHIFT);
+	}
+
+	static uint64 WithDepthBucket(uint64 InKey, uint32 InDepthBucket)
+	{
+		return (InKey & ~(static_cast<uint64>(DEPTH_MASK) << DEPTH_SHIFT)) | (static_cast<uint64>(InDepthBucket & DEPTH_MASK) << DEPTH_SHIFT);
+	}
+
+	static ERenderProxyPass GetPass(uint64 InKey) { return static_cast<ERenderProxyPass>(InKey >> PASS_SHIFT); }
+	static uint32 GetPermutation(uint64 InKey) { return static_cast<uint32>(InKey >> PERMUTATION_SHIFT) & PERMUTATION_MASK; }
+	static uint32 GetMaterialId(uint64 InKey) { return static_cast<uint32>(InKey >> MATERIAL_SHIFT) & ID_MASK; }
+	static uint32 GetMeshId(uint64 InKey) { return static_cast<uint32>(InKey >> MESH_SHIFT) & ID_MASK; }
+	static uint32 GetDepthBucket(uint64 InKey) { return static_cast<uint32>(InKey >> DEPTH_SHIFT) & DEPTH_MASK; }
+
+	/**
+	 * @brief 카메라까지 거리 제곱을 8비트 버킷으로, 부동소수 비트 패턴의 지수와 가수 상위 2비트를 쓰는 로그 눈금
+	 * 거리 0.1 ~ 10만 범위가 버킷 안에 들어가고 범위 밖은 양 끝 버킷으로 모인다.
+	 */
+	static uint32 QuantizeDepth(float InDistanceSquared);
+};
+
+/**
+ * @brief 키를 정렬하면서 같은 자리의 값도 함께 옮기는 LSD 기수 정렬 (8비트씩 8번, 안정 정렬)
+ * 히스토그램 8개를 한 번에 세고, 모든 키가 같은 바이트를 가진 자리(예약 비트, 단일 패스 등)는 건너뛴다.
+ * @param InScratchKeys, InScratchValues 결과와 같은 크기로 맞춰지는 작업 버퍼, 프레임 사이에 재사용
+ */
+void RadixSortKeyValues(TArray<uint64>& InOutKeys, TArray<uint32>& InOutValues, TArray<uint64>& InScratchKeys, TArray<uint32>& InScratchValues);
+
+struct FRenderCommand
+{
+	UPrimitiveComponent* Primitive;
+	uint64 SortKey;
+};
+
+/**
+ * @brief 한 뷰의 정렬된 렌더 명령 목록, 패스마다 [GetPassBegin, GetPassEnd) 구간을 소비한다
+ * 정렬용 작업 배열을 함께 들고 있어서 프레임마다 같은 객체를 다시 쓰면 할당이 생기지 않는다.
+ */
+struct FRenderCommandList
+{
+	TArray<FRenderCommand> Commands;
+	int32 PassOffsets[static_cast<int32>(ERenderProxyPass::Count) + 1] = {};
+
+	int32 GetPassBegin(ERenderProxyPass InPass) const { return PassOffsets[static_cast<int32>(InPass)]; }
+	int32 GetPassEnd(ERenderProxyPass InPass) const { return PassOffsets[static_cast<int32>(InPass) + 1]; }
+
+	TArray<uint64> Keys;
+	TArray<uint32> ProxyIndices;
+	TArray<uint64> ScratchKeys;
+	TArray<uint32> ScratchProxyIndices;
+};
+
+/**
+ * @brief 레벨에 등록된 프리미티브마다 정렬 키와 위치를 보관하는 렌더 프록시 목록
+ * - 프리미티브 등록/해제 시 추가/제거 (FPrimitiveBoundsSoA처럼 마지막 슬롯을 빈자리로 옮기고 소유자 인덱스를 갱신)
+ * - 메시, 머티리얼, 스프라이트가 바뀌면 ULevel이 UpdateSortKey로 키를 다시 만든다. 매 프레임 Cast와 재분류를 하지 않는다
+ * - BuildCommandList는 컬러가 만든 가시성 비트셋에서 보이는 프록시의 키만 모아 깊이 버킷을 채우고 기수 정렬한다
+ * 머티리얼과 메시 포인터는 처음 본 순서대로 16비트 ID를 발급한다.
+ * @note 메인 스레드 전용, BuildCommandList는 const라서 뷰포트마다 다른 FRenderCommandList로 호출할 수 있다
+ */
+class FRenderProxyList
+{
+public:
+	/** @brief 슬롯을 추가하고 InOutIndex에 기록, InOutIndex는 슬롯이 살아있는 동안 주소가 유지되어야 함 */
+	int32 Add(UPrimitiveComponent* InPrimitive, int32& InOutIndex);
+	bool Remove(int32& InOutIndex);
+	void Clear();
+
+	void SetSortKey(int32 InIndex, uint64 InSortKey) { SortKeys[InIndex] = InSortKey; }
+	void SetLocation(int32 InIndex, const FVector& InLocation) { Locations[InIndex] = InLocation; }
+
+	/** @brief 프리미티브의 종류, 메시, 머티리얼에서 정렬 키(깊이 버킷 제외)를 다시 만든다 */
+	void UpdateSortKey(int32 InIndex);
+
+	/** @return 포인터별 16비트 ID, nullptr은 0 */
+	uint32 FindOrAddMaterialId(const void* InMaterial) { return FindOrAddId(MaterialIds, InMaterial); }
+	uint32 FindOrAddMeshId(const void* InMesh) { return FindOrAddId(MeshIds, InMesh); }
+
+	/**
+	 * @brief 보이는 프록시의 명령 목록을 정렬 키 순서로 만든다
+	 * @param InVisibility 비트 i가 프록시 i에 대응하는 가시성 비트셋
+	 */
+	void BuildCommandList(const TArray<uint64>& InVisibility, const FVector& InViewLocation, FRenderCommandList& OutList) const;
+
+	int32 Num() const { return static_cast<int32>(Primitives.size()); }
+	UPrimitiveComponent* GetPrimitive(int32 InIndex) const { return Primitives[InIndex]; }
+	uint64 GetSortKey(int32 InIndex) const { return SortKeys[InIndex]; }
+	const FVector& GetLocation(int32 InIndex) const { return Locations[InIndex]; }
+
+private:
+	static uint32 FindOrAddId(TMap<const void*, uint32>& InOutIds, const void* InPointer);
+
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<int32*> IndexRefs;
+	TArray<uint64> SortKeys;
+	TArray<FVector> Locations;
+
+	TMap<const void*, uint32> MaterialIds;
+	TMap<const void*, uint32> MeshIds;
+};
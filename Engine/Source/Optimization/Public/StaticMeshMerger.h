@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Component/Mesh/Public/StaticMesh.h"
+
+class UMaterial;
+
+/**
+ * @brief 정적 배치에 넣을 스태틱 메시 인스턴스 하나
+ */
+struct FStaticMeshMergeSource
+{
+	const FStaticMesh* Mesh = nullptr;
+	FMatrix World;
+	/** @brief 노멀을 월드로 옮길 때 전치해서 쓴다 */
+	FMatrix WorldInverse;
+	/** @brief Mesh->Sections 순서의 머티리얼, 비어 있으면 머티리얼 없는 메시로 기본 머티리얼로 그린다 */
+	TArray<UMaterial*> SectionMaterials;
+	bool bReceivesDecals = true;
+};
+
+/**
+ * @brief 같은 공간 셀과 같은 머티리얼 집합의 소스를 월드 공간 정점으로 합친 결과
+ * Mesh는 항등 월드 행렬로 그리며, 머티리얼마다 섹션 하나를 가진다 (MaterialSlot = Materials 인덱스).
+ */
+struct FStaticMeshMergedCell
+{
+	FStaticMesh Mesh;
+	/** @brief 슬롯별 머티리얼, 머티리얼 없는 소스끼리 합친 셀은 비어 있다 */
+	TArray<UMaterial*> Materials;
+	FVector Min;
+	FVector Max;
+	/** @brief 합쳐진 소스의 입력 배열 인덱스 */
+	TArray<int32> SourceIndices;
+	bool bReceivesDecals = true;
+	/** @brief 소스마다 따로 그렸을 때의 드로우 수 (소스 섹션 수의 합) */
+	uint32 SourceDrawCount = 0;
+};
+
+/**
+ * @brief 레벨 로드 후 움직이지 않는 소품들을 정적 배치로 합치는 CPU 모듈 (ULevel::BuildStaticBatches 참고)
+ * - 소스를 월드 AABB 중심이 속한 정육면체 셀과 머티리얼 집합(정렬된 고유 머티리얼, 데칼 수신 여부 포함)으로 묶는다
+ * - 묶음마다 정점을 월드 공간으로 미리 변환해 이어 붙이고, 인덱스는 머티리얼별로 모아 셀당 머티리얼 수만큼의 섹션을 만든다
+ * - 음수 스케일로 뒤집힌 소스는 감기 순서를 바꿔 앞면 방향을 유지한다
+ * D3D와 UObject에 의존하지 않으며, LOD와 압축 정점은 합치지 않는다 (셀은 항상 LOD0의 FNormalVertex로 그린다).
+ */
+struct FStaticMeshMerger
+{
+	/** @brief 셀 한 변의 기본 길이 (월드 단위) */
+	static constexpr float DEFAULT_CELL_SIZE = 32.0f;
+	/** @brief 이보다 삼각형이 많은 메시는 합치지 않고 인스턴싱과 LOD에 맡긴다 */
+	static constexpr uint32 MAX_SOURCE_TRIANGLES = 4096;
+	/** @brief 셀 하나의 정점 상한, 넘으면 같은 묶음을 여러 셀로 나눈다 */
+	static constexpr uint32 MAX_CELL_VERTICES = 1u << 18;
+	/** @brief 소스가 이보다 적은 묶음은 합치지 않는다 */
+	static constexpr int32 MIN_SOURCES_PER_CELL = 2;
+
+	/** @brief 정적 배치에 넣을 수 있는 메시인지 (크기, 인덱스 유무) */
+	static bool CanMerge(const FStaticMesh& InMesh);
+
+	/**
+	 * @brief 소스를 (셀, 머티리얼 집합)으로 묶어 MIN_SOURCES_PER_CELL 이상인 묶음만 합친다
+	 * @param InCellSize 셀 한 변의 길이 (월드 단위)
+	 * @param OutCells 합친 셀, 어느 셀에도 없는 소스는 따로 그려야 한다
+	 */
+	static void BuildCells(const TArray<FStaticMeshMergeSource>& InSources, float InCellSize, TArray<FStaticMeshMergedCell>& OutCells);
+
+	/**
+	 * @brief 주어진 소스들을 셀 하나로 합친다, 머티리얼 집합과 데칼 수신 여부가 같아야 한다
+	 * 셀에서 소스 하나가 빠졌을 때 나머지로 다시 합치는 데도 쓴다.
+	 */
+	static void MergeCell(const TArray<FStaticMeshMergeSource>& InSources, const TArray<int32>& InSourceIndices, FStaticMeshMergedCell& OutCell);
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+class USceneComponent;
+
+/**
+ * @brief 모든 USceneComponent의 로컬/월드 행렬을 계층 깊이 순서로 연속 배열에 보관하는 변환 시스템
+ * - SetRelative* / AttachToComponent는 자기 슬롯에 더티 표시만 하고 자식을 따라 내려가지 않는다
+ * - Update는 프레임마다 한 번 깊이 순서대로 배열을 훑어, 더티이거나 부모가 다시 계산된 슬롯만 SSE 행렬곱으로 갱신한다
+ * - 갱신된 컴포넌트마다 OnUpdateTransform을 불러 AABB 캐시 무효화와 옥트리 재배치 예약을 한 곳에서 처리한다
+ * Update 전에 월드 행렬을 읽으면 그 컴포넌트와 조상 체인만 바로 계산한다. 부모보다 늦게 계산된 자식은
+ * 부모 월드 버전을 비교해 알아내므로, 형제를 모두 표시하지 않아도 낡은 행렬을 돌려주지 않는다.
+ * @note 메인 스레드 전용, 컬링 작업을 시작하기 전(ULevel::PrepareForCulling)에 Update로 대기 중인 변경을 모두 반영한다
+ */
+class FTransformHierarchy
+{
+public:
+	static FTransformHierarchy& GetInstance();
+
+	/** @return 새 슬롯 인덱스, 슬롯은 다음 Update에서 깊이 순서로 재배치되며 컴포넌트의 TransformIndex도 함께 바뀐다 */
+	int32 Add(USceneComponent* InComponent);
+	void Remove(int32 InIndex);
+
+	/** @brief 부모를 바꾸고 자신을 더티로 표시, 깊이 순서는 다음 Update에서 다시 정렬한다 */
+	void SetParent(int32 InIndex, int32 InParentIndex);
+	void MarkDirty(int32 InIndex);
+
+	/** @brief InIndex와 조상의 대기 중인 변경을 반영, 대기 중인 변경이 없으면 아무 일도 하지 않는다 */
+	void Resolve(int32 InIndex)
+	{
+		if (bHasPendingChanges)
+		{
+			ResolveChain(InIndex);
+		}
+	}
+
+	/** @brief 월드 행렬이 다시 계산될 때마다 증가, 역행렬처럼 월드 행렬에서 파생된 캐시의 유효성 검사에 사용 */
+	uint32 GetWorldVersion(int32 InIndex) const { return WorldVersions[InIndex]; }
+	const FMatrix& GetWorldMatrix(int32 InIndex) const { return WorldMatrices[InIndex]; }
+	int32 GetParentIndex(int32 InIndex) const { return ParentIndices[InIndex]; }
+	uint16 GetDepth(int32 InIndex) const { return Depths[InIndex]; }
+
+	/** @brief 깊이 순서 재정렬과 대기 중인 모든 월드 행렬 갱신 */
+	void Update();
+
+	bool HasPendingChanges() const { return bHasPendingChanges; }
+	int32 Num() const { return static_cast<int32>(Components.size()); }
+	/** @brief 마지막 Update에서 다시 계산한 슬롯 수 */
+	int32 GetLastUpdatedCount() const { return LastUpdatedCount; }
+
+private:
+	enum : uint8
+	{
+		FLAG_NONE = 0,
+		/** @brief 상대 트랜스폼이 바뀌어 로컬 행렬부터 다시 계산해야 함 */
+		FLAG_DIRTY = 1 << 0,
+	};
+
+	/** @brief 제거된 부모는 루트로 취급 */
+	int32 GetLiveParent(int32 InIndex) const
+	{
+		const int32 Parent = ParentIndices[InIndex];
+		return Parent >= 0 && Components[Parent] ? Parent : -1;
+	}
+
+	bool NeedsUpdate(int32 InIndex, int32 InParent) const
+	{
+		return (Flags[InIndex] & FLAG_DIRTY) || (InParent >= 0 && ParentVersions[InIndex] != WorldVersions[InParent]);
+	}
+
+	void ResolveChain(int32 InIndex);
+	void UpdateWorld(int32 InIndex, int32 InParent);
+	/** @brief 제거된 슬롯을 빼고 깊이 순서(부모가 항상 자식보다 앞)로 배열을 다시 배치 */
+	void SortByDepth();
+
+	TArray<FMatrix> LocalMatrices;
+	TArray<FMatrix> WorldMatrices;
+	TArray<int32> ParentIndices;
+	TArray<uint32> WorldVersions;
+	/** @brief 마지막으로 월드 행렬을 계산할 때 본 부모의 WorldVersions */
+	TArray<uint32> ParentVersions;
+	TArray<uint16> Depths;
+	TArray<uint8> Flags;
+	/** @brief 제거된 슬롯은 nullptr, SortByDepth 전까지 재사용하지 않는다 */
+	TArray<USceneComponent*> Components;
+
+	bool bHasPendingChanges = false;
+	bool bIsOrderDirty = false;
+	int32 LastUpdatedCount = 0;
+};
@@ -8,6 +8,8 @@
 #include "Physics/Public/AABB.h"
 
 class FOctree;
+class FPrimitiveBoundsSoA;
+class FRenderProxyList;
 class ULightComponent;
 
 enum class EBoundCheckResult
@@ -91,19 +93,74 @@ public:
     ViewVolumeCuller(const ViewVolumeCuller& Other) = default;
 	ViewVolumeCuller& operator=(const ViewVolumeCuller& Other) = default;
 
+	/**
+	 * @param PrimitiveBounds 레벨의 SoA 월드 AABB, 주어지면 개별 프리미티브 검사를 SIMD 커널로 일괄 처리
+	 * @note 옥트리, PrimitiveBounds, 프리미티브와 라이트는 읽기만 하므로 서로 다른 컬러끼리 병렬로 호출할 수 있다.
+	 * 단 PrimitiveBounds에 없는 프리미티브와 라이트의 월드 변환은 호출 전에 갱신되어 있어야 한다 (ULevel::PrepareForCulling).
+	 */
 	void Cull(
-        FOctree* StaticOctree,
+        const FOctree* StaticOctree,
         const TArray<UPrimitiveComponent*>& DynamicPrimitives,
         const TArray<ULightComponent*>& Lights,
-		const FCameraConstants& ViewProjConstants
+		const FCameraConstants& ViewProjConstants,
+		const FPrimitiveBoundsSoA* PrimitiveBounds = nullptr
 	);
 
-	const TArray<UPrimitiveComponent*>& GetRenderableObjects();
+	/** @brief 옥트리에 없는 레벨의 동적 프리미티브를 컬링 결과 뒤에 덧붙인다, 오클루전 컬링이 끝난 뒤 뷰마다 한 번 호출 */
+	void AppendDynamicPrimitives();
+	/** @brief AppendDynamicPrimitives 뒤에 호출하면 렌더할 전체 프리미티브 */
+	const TArray<UPrimitiveComponent*>& GetRenderableObjects() const { return RenderableObjects; }
+	/** @brief 동적 프리미티브를 덧붙이기 전의 절두체 컬링 결과, COcclusionCuller가 제자리에서 걸러낸다 */
+	TArray<UPrimitiveComponent*>& GetFrustumVisibleObjects() { return RenderableObjects; }
     const TArray<ULightComponent*>& GetRenderableLights();
+
+	/**
+	 * @brief 보이는 프리미티브를 레벨 렌더 프록시 인덱스의 비트셋으로 기록, FRenderProxyList::BuildCommandList의 입력
+	 * @note AppendDynamicPrimitives로 동적 프리미티브까지 덧붙인 뒤에 호출, 여러 번 들어간 프리미티브도 비트 하나로 합쳐진다
+	 */
+	void EmitProxyVisibility(int32 InProxyCount, TArray<uint64>& OutVisibility) const;
+
+	/**
+	 * @brief 보이는 스태틱 메시마다 화면 크기로 LOD를 골라 프록시 인덱스별로 기록, 이전 프레임의 선택을 이어받아 히스테리시스를 적용한다
+	 * 프록시 제거로 인덱스가 다른 프리미티브에게 넘어간 슬롯은 이전 선택을 버리고 새 프록시처럼 0부터 고른다.
+	 * @note AppendDynamicPrimitives 뒤에 호출, 결과는 컬러(뷰포트)마다 따로 유지된다
+	 */
+	void SelectLODs(const FCameraConstants& ViewProjConstants, const FRenderProxyList& RenderProxies);
+	/** @brief SelectLODs가 고른 LOD, 고른 적 없는 프록시는 0 */
+	int32 GetProxyLOD(int32 InProxyIndex) const
+	{
+		return InProxyIndex >= 0 && InProxyIndex < static_cast<int32>(ProxyLODs.size()) ? ProxyLODs[InProxyIndex].LOD : 0;
+	}
+
+	/**
+	 * @brief 월드 AABB의 경계 구 지름이 화면 높이에서 차지하는 비율 (1이면 화면 높이와 같다)
+	 * 투영 행렬에서 배율을 읽으므로 원근과 직교 투영 모두 쓸 수 있다.
+	 */
+	static float ComputeScreenSize(const FVector& InMin, const FVector& InMax, const FCameraConstants& ViewProjConstants);
+
+	/** @brief 마지막 Cull에 쓴 월드 공간 절두체, FStaticMeshPass가 메시렛 컬링에 쓴다 */
+	const FFrustum& GetFrustum() const { return CurrentFrustum; }
 private:
-    void CullOctree(FOctree* Octree);
+    void CullOctree(const FOctree* Octree, const FPrimitiveBoundsSoA* PrimitiveBounds);
+
+    /** @brief SoA 배열에 있으면 후보 슬롯으로 모으고 true를 반환, 없으면 호출자가 스칼라 경로로 검사 */
+    bool AddCullCandidate(UPrimitiveComponent* Primitive, const FPrimitiveBoundsSoA* PrimitiveBounds);
 
     FFrustum CurrentFrustum{};
     TArray<UPrimitiveComponent*> RenderableObjects{};
     TArray<ULightComponent*> RenderableLights{};
+
+    /** @brief 개별 검사가 필요한 프리미티브의 SoA 슬롯과 SIMD 커널의 결과 비트마스크 */
+    TArray<int32> CandidateIndices{};
+    TArray<uint64> VisibilityMask{};
+
+    /** @brief 마지막에 고른 LOD와 그때의 프리미티브, FRenderProxyList::Remove가 슬롯을 옮기면 Primitive가 달라진다 */
+    struct FProxyLOD
+    {
+        const UPrimitiveComponent* Primitive = nullptr;
+        uint8 LOD = 0;
+    };
+
+    /** @brief 렌더 프록시 인덱스별 LOD 선택 기록 */
+    TArray<FProxyLOD> ProxyLODs{};
 };
\ No newline at end of file
@@ -1,6 +1,19 @@
 #include "pch.h"
 #include "Physics/Public/AABB.h"
 
+void TransformAABB(const FMatrix& InMatrix, const FVector& InMin, const FVector& InMax, FVector& OutMin, FVector& OutMax)
+{
+    __m128 Min, Max;
+    TransformAABB(InMatrix, InMin, InMax, Min, Max);
+
+    alignas(16) float MinLanes[4];
+    alignas(16) float MaxLanes[4];
+    _mm_store_ps(MinLanes, Min);
+    _mm_store_ps(MaxLanes, Max);
+    OutMin = FVector(MinLanes[0], MinLanes[1], MinLanes[2]);
+    OutMax = FVector(MaxLanes[0], MaxLanes[1], MaxLanes[2]);
+}
+
 float FAABB::GetCenterDistanceSquared(const FVector& Point) const
 {
     FVector Center = GetCenter();
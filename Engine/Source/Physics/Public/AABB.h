@@ -29,4 +29,32 @@ struct FAABB : public IBoundingVolume
 
 bool CheckIntersectionRayBox(const FRay& Ray, const FAABB& Box);
 
+/**
+ * @brief 로컬 AABB를 아핀 행렬로 변환한 월드 AABB를 SSE 레지스터로 반환 (w 레인은 쓰지 않음)
+ * 꼭짓점 8개를 변환하는 대신 중심은 행렬로, 반경은 행렬 성분의 절댓값으로 변환한다.
+ * 행 벡터 규약(v * M)이므로 반경의 축 i 성분은 |M[0][i]| * Ex + |M[1][i]| * Ey + |M[2][i]| * Ez.
+ */
+inline void TransformAABB(const FMatrix& InMatrix, const FVector& InMin, const FVector& InMax, __m128& OutMin, __m128& OutMax)
+{
+	const __m128 SignMask = _mm_set1_ps(-0.0f);
+
+	const float CenterX = (InMin.X + InMax.X) * 0.5f, ExtentX = (InMax.X - InMin.X) * 0.5f;
+	const float CenterY = (InMin.Y + InMax.Y) * 0.5f, ExtentY = (InMax.Y - InMin.Y) * 0.5f;
+	const float CenterZ = (InMin.Z + InMax.Z) * 0.5f, ExtentZ = (InMax.Z - InMin.Z) * 0.5f;
+
+	const __m128 Center = _mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(_mm_set1_ps(CenterX), InMatrix.V[0]), _mm_mul_ps(_mm_set1_ps(CenterY), InMatrix.V[1])),
+		_mm_add_ps(_mm_mul_ps(_mm_set1_ps(CenterZ), InMatrix.V[2]), InMatrix.V[3]));
+
+	const __m128 Extent = _mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(_mm_set1_ps(ExtentX), _mm_andnot_ps(SignMask, InMatrix.V[0])),
+			_mm_mul_ps(_mm_set1_ps(ExtentY), _mm_andnot_ps(SignMask, InMatrix.V[1]))),
+		_mm_mul_ps(_mm_set1_ps(ExtentZ), _mm_andnot_ps(SignMask, InMatrix.V[2])));
+
+	OutMin = _mm_sub_ps(Center, Extent);
+	OutMax = _mm_add_ps(Center, Extent);
+}
+
+void TransformAABB(const FMatrix& InMatrix, const FVector& InMin, const FVector& InMax, FVector& OutMin, FVector& OutMax);
+
 FAABB Union(const FAABB& Box1, const FAABB& Box2);
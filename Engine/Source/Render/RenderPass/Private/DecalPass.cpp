@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "Component/Public/DecalComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Editor/Public/Camera.h"
 #include "Global/Octree.h"
 #include "Level/Public/Level.h"
 #include "Manager/Asset/Public/AssetManager.h"
@@ -149,6 +151,8 @@ void FDecalPass::PreExecute(FRenderingContext& Context)
 	ID3D11RenderTargetView* RTV = DeviceResources->GetSceneColorRenderTargetView();
 	ID3D11DepthStencilView* DSV = DeviceResources->GetDepthStencilView();
     // TODO: Set VS and PS from Renderer
+    PackedVS = Renderer.GetDecalPackedVertexShader();
+    PackedInputLayout = Renderer.GetDecalPackedInputLayout();
 
 	// DecalPass only writes to SceneColor, not to Normal buffer (it reads from it)
 	Pipeline->SetRenderTargets(1, &RTV, DSV);
@@ -164,6 +168,7 @@ void FDecalPass::Execute(FRenderingContext& Context)
     FPipelineInfo PipelineInfo = { InputLayout, VS, FRenderResourceFactory::GetRasterizerState({ ECullMode::Back, EFillMode::Solid }),
         DS_Read, PS, BlendState, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST };
     Pipeline->UpdatePipeline(PipelineInfo);
+    bool bIsPackedPipeline = false;
     Pipeline->SetConstantBuffer(1, true, ConstantBufferCamera);
 
     // Set up lighting buffers once for all passes
@@ -228,6 +233,7 @@ void FDecalPass::Execute(FRenderingContext& Context)
         TArray<UPrimitiveComponent*> Primitives;
         // --- Enable Octree Optimization --- 
         ULevel* CurrentLevel = GWorld->GetLevel();
+        const FPrimitiveBoundsSoA& PrimitiveBounds = CurrentLevel->GetPrimitiveBounds();
 
         Query(CurrentLevel->GetStaticOctree(), Decal, Primitives);
         Primitives.insert(Primitives.end(), DynamicPrimitives.begin(), DynamicPrimitives.end());
@@ -239,7 +245,10 @@ void FDecalPass::Execute(FRenderingContext& Context)
             if (!Prim || !Prim->IsVisible() || Prim->IsVisualizationComponent() || !Prim->bReceivesDecals) { continue; }
             const IBoundingVolume* PrimBV = Prim->GetBoundingBox();
             if (!PrimBV || PrimBV->GetType() != EBoundingVolumeType::AABB) { continue; }
-            FVector WorldMin, WorldMax; Prim->GetWorldAABB(WorldMin, WorldMax);
+            // 레벨에 등록된 프리미티브는 UpdateOctree에서 갱신된 SoA 경계를 그대로 읽는다
+            FVector WorldMin, WorldMax;
+            if (PrimitiveBounds.Contains(Prim)) { PrimitiveBounds.GetBounds(Prim->PrimitiveBoundsIndex, WorldMin, WorldMax); }
+            else { Prim->GetWorldAABB(WorldMin, WorldMax); }
             const FAABB WorldAABB(WorldMin, WorldMax);
             if (!Intersects(*DecalOBB, WorldAABB))
             {
@@ -247,14 +256,44 @@ void FDecalPass::Execute(FRenderingContext& Context)
             }
             CollidedComps++;
             
+            // 압축 정점 메시는 위치 복원 행렬을 World 앞에 곱하고 PACKED_VERTEX 셰이더로 바꿔 그린다
+            const FStaticMesh* PackedMesh = nullptr;
+            const FStaticMesh* LODMesh = nullptr;
+            if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Prim))
+            {
+                const FStaticMesh* MeshAsset = StaticMeshComp->GetStaticMesh() ? StaticMeshComp->GetStaticMesh()->GetStaticMeshAsset() : nullptr;
+                PackedMesh = MeshAsset && MeshAsset->HasPackedVertices() ? MeshAsset : nullptr;
+                LODMesh = MeshAsset;
+            }
+            if (bIsPackedPipeline != (PackedMesh != nullptr))
+            {
+                bIsPackedPipeline = PackedMesh != nullptr;
+                PipelineInfo.InputLayout = bIsPackedPipeline ? PackedInputLayout : InputLayout;
+                PipelineInfo.VertexShader = bIsPackedPipeline ? PackedVS : VS;
+                Pipeline->UpdatePipeline(PipelineInfo);
+            }
+
             FModelConstants ModelConstants{ Prim->GetWorldTransformMatrix(), Prim->GetWorldTransformMatrixInverse().Transpose() };
+            if (PackedMesh)
+            {
+                ModelConstants.World = PackedMesh->PackedPositionToLocal * ModelConstants.World;
+            }
             FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferPrim, ModelConstants);
             Pipeline->SetConstantBuffer(0, true, ConstantBufferPrim);
-            Pipeline->SetVertexBuffer(Prim->GetVertexBuffer(), sizeof(FNormalVertex));
+            Pipeline->SetVertexBuffer(Prim->GetVertexBuffer(), PackedMesh ? sizeof(FPackedNormalVertex) : sizeof(FNormalVertex));
             if (Prim->GetIndexBuffer() && Prim->GetIndicesData())
             {
                 Pipeline->SetIndexBuffer(Prim->GetIndexBuffer(), 0);
-                Pipeline->DrawIndexed(Prim->GetNumIndices(), 0, 0);
+                if (LODMesh)
+                {
+                    // StaticMeshPass가 그린 LOD와 같은 삼각형에 투영해야 깊이가 어긋나지 않는다
+                    const int32 LODIndex = std::min(Context.CurrentCamera->GetViewVolumeCuller().GetProxyLOD(Prim->RenderProxyIndex), LODMesh->GetNumLODs() - 1);
+                    Pipeline->DrawIndexed(LODMesh->GetLODIndexCount(LODIndex), LODMesh->GetLODFirstIndex(LODIndex), 0);
+                }
+                else
+                {
+                    Pipeline->DrawIndexed(Prim->GetNumIndices(), 0, 0);
+                }
             }
             else
             {
@@ -300,20 +339,27 @@ void FDecalPass::Query(FOctree* InOctree, UDecalComponent* InDecal, TArray<UPrim
     /** @todo Use polymorphism to gracefully handle collsion between decal and octree. For now, use explicit casting. */
     auto BoundingBox = static_cast<const FOBB*>(InDecal->GetBoundingBox());
 
-    if (!BoundingBox->Intersects(InOctree->GetBoundingBox()))
-    {
-        return;
-    }
+    TArray<int32> VisitingNodes;
+    VisitingNodes.push_back(InOctree->GetRootIndex());
 
-    auto Primitives = InOctree->GetPrimitives();
-    OutPrimitives.insert(OutPrimitives.end(), Primitives.begin(), Primitives.end());
-    if (InOctree->IsLeafNode())
+    while (!VisitingNodes.empty())
     {
-        return;
-    }
-    
-    for (auto Child : InOctree->GetChildren())
-    {
-        Query(Child, InDecal, OutPrimitives);
+        const FOctreeNode& Node = InOctree->GetNode(VisitingNodes.back());
+        VisitingNodes.pop_back();
+
+        if (!BoundingBox->Intersects(Node.LooseBounds))
+        {
+            continue;
+        }
+
+        for (const FOctreeElement& Element : Node.Elements)
+        {
+            OutPrimitives.push_back(Element.Primitive);
+        }
+
+        for (int32 Octant = 0; Octant < 8; ++Octant)
+        {
+            if (Node.HasChild(Octant)) { VisitingNodes.push_back(Node.Children[Octant]); }
+        }
     }
 }
\ No newline at end of file
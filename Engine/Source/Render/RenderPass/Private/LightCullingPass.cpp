@@ -2,7 +2,9 @@
 #include "Render/RenderPass/Public/LightCullingPass.h"
 #include "Component/Light/Public/PointLightComponent.h"
 #include "Component/Light/Public/SpotLightComponent.h"
+#include "Core/Public/JobSystem.h"
 #include "Editor/Public/Camera.h"
+#include "Optimization/Public/ClusteredLightCuller.h"
 #include "Render/Renderer/Public/Pipeline.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
 #include "Render/Renderer/Public/DeviceResources.h"
@@ -13,98 +15,22 @@
 FLightCullingPass::FLightCullingPass(UPipeline* InPipeline, UDeviceResources* InDeviceResources)
     : FRenderPass(InPipeline, nullptr, nullptr)
     , DeviceResources(InDeviceResources)
+    , LightCuller(new FClusteredLightCuller())
 {
-    CreateResources();
 }
 
 FLightCullingPass::~FLightCullingPass()
 {
-    ReleaseResources();
-}
-
-void FLightCullingPass::CreateResources()
-{
-    HRESULT hr;
-    ID3DBlob* pBlobCS = nullptr;
-
-    // Debug flags for shader compilation
-    UINT CompileFlags = 0;
-#if defined(_DEBUG)
-    CompileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-#endif
-    
-    // 셰이더 컴파일
-    hr = D3DCompileFromFile(
-        L"Asset/Shader/LightCulling.hlsl",
-        nullptr,
-        nullptr,
-        "CSMain",
-        "cs_5_0",
-        CompileFlags,
-        0,
-        &pBlobCS,
-        nullptr);
-    assert(SUCCEEDED(hr) && "LightCulling.hlsl 컴퓨트 셰이더 컴파일 실패");
-
-    // 컴퓨트 셰이더 생성
-    hr = DeviceResources->GetDevice()->CreateComputeShader(
-        pBlobCS->GetBufferPointer(),
-        pBlobCS->GetBufferSize(),
-        nullptr,
-        &CullingCS);
-    assert(SUCCEEDED(hr) && "LightCulling.hlsl 컴퓨트 셰이더 생성 실패");
-
-    SafeRelease(pBlobCS);
-
-    // 컵링 파라미터 상수 버퍼 생성
-    CullingParamsCB = FRenderResourceFactory::CreateConstantBuffer<FCullingParams>();
-}
-
-void FLightCullingPass::ReleaseResources()
-{
-    SafeRelease(CullingCS);
-    SafeRelease(CullingParamsCB);
+    SafeDelete(LightCuller);
 }
 
 void FLightCullingPass::PreExecute(FRenderingContext& Context)
 {
     URenderer& Renderer = URenderer::GetInstance();
-    ID3D11DeviceContext* DeviceContext = DeviceResources->GetDeviceContext();
 
-    LightIndexBufferUAV = Renderer.GetLightIndexBufferUAV();
-    ClusterLightInfoUAV = Renderer.GetClusterLightInfoUAV();
-    
-    AllLightsBuffer = Renderer.GetAllLightsBuffer();
-    AllLightsSRV = Renderer.GetAllLightsSRV();
-    
-    // 상수 버퍼 업데이트
-    // Clear UAVs
-    const UINT clearValues[4] = { 0, 0, 0, 0 };
-    DeviceContext->ClearUnorderedAccessViewUint(ClusterLightInfoUAV, clearValues);
-    DeviceContext->ClearUnorderedAccessViewUint(LightIndexBufferUAV, clearValues);
-    
-    FCullingParams cullingParams;
-    cullingParams.View = Context.CurrentCamera->GetFViewProjConstants().View;
-    cullingParams.Projection = Context.CurrentCamera->GetFViewProjConstants().Projection;
-    // 뷰포트 오프셋 및 크기 전달
-    cullingParams.ViewportOffset[0] = static_cast<uint32>(Context.Viewport.TopLeftX);
-    cullingParams.ViewportOffset[1] = static_cast<uint32>(Context.Viewport.TopLeftY);
-    cullingParams.ViewportSize[0] = static_cast<uint32>(Context.Viewport.Width);
-    cullingParams.ViewportSize[1] = static_cast<uint32>(Context.Viewport.Height);
-    // 리소스 크기 체크 및 라이트 데이터 준비
-    const uint32 totalLights = static_cast<uint32>(Context.Lights.size());
-    cullingParams.NumLights = totalLights;
-    
-    // Near/Far 클리핑 평면
-    cullingParams.NearClip = Context.CurrentCamera->GetFViewProjConstants().NearClip;
-    cullingParams.FarClip = Context.CurrentCamera->GetFViewProjConstants().FarClip;
-    
-    // 패딩 필드 초기화
-    cullingParams.Padding = 0;
-    
     // 라이트 데이터 배열 준비 (AllLights 버퍼용)
-    TArray<FLightParams> allLights;
-    allLights.reserve(totalLights);
+    AllLights.clear();
+    AllLights.reserve(Context.Lights.size());
     
     // 포인트 라이트 추가
     for (const auto& Light : Context.Lights)
@@ -143,89 +69,60 @@ void FLightCullingPass::PreExecute(FRenderingContext& Context)
             lightData.Direction = FVector4(spotInfo.Direction.X, spotInfo.Direction.Y, spotInfo.Direction.Z, static_cast<float>(ELightType::Spot));
             lightData.Angles = FVector4(spotInfo.CosInner, spotInfo.CosOuter, spotInfo.Falloff, spotInfo.InvRange2);
         }
-        allLights.push_back(lightData);
+        AllLights.push_back(lightData);
     }
     
-    // 라이트 데이터 업데이트 (DYNAMIC 버퍼 사용)
-    if (totalLights > 0 && totalLights <= MAX_LIGHTS)
-    {
-        D3D11_MAPPED_SUBRESOURCE mappedResource;
-        HRESULT hr = DeviceContext->Map(AllLightsBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-        if (SUCCEEDED(hr))
-        {
-            // 전체 버퍼 클리어 (이전 프레임의 데이터 제거)
-            memset(mappedResource.pData, 0, sizeof(FLightParams) * MAX_LIGHTS);
-            // 실제 라이트 데이터 복사
-            if (totalLights > 0)
-            {
-                memcpy(mappedResource.pData, allLights.data(), sizeof(FLightParams) * totalLights);
-            }
-            DeviceContext->Unmap(AllLightsBuffer, 0);
-        }
-        else
-        {
-            assert(false && "AllLightsBuffer 맵핑 실패");
-        }
-    }
-    else if (totalLights > MAX_LIGHTS)
-    {
-        // 경고: 최대 라이트 개수 초과
-        UE_LOG_WARNING("라이트 개수가 최대치를 초과했습니다: %d > %d", static_cast<int>(totalLights), static_cast<int>(MAX_LIGHTS));
-        cullingParams.NumLights = MAX_LIGHTS; // 최대치로 제한
-    }
-    
-    // 상수 버퍼 데이터 업데이트
-    FRenderResourceFactory::UpdateConstantBufferData(CullingParamsCB, cullingParams);
-
+    // 라이트 데이터 업데이트 (DYNAMIC 버퍼, 라이트 수가 늘면 버퍼도 다시 만든다)
+    Renderer.ReserveLightBuffers(static_cast<uint32>(AllLights.size()));
+    FRenderResourceFactory::UpdateStructuredBufferData(Renderer.GetAllLightsBuffer(), AllLights);
 }
 
 void FLightCullingPass::Execute(FRenderingContext& Context)
 {
     // Light Culling 플래그 확인
-    if (!(Context.ShowFlags & EEngineShowFlags::SF_LightCulling))
+    if (!(Context.ShowFlags & EEngineShowFlags::SF_LightCulling) || !LightCuller)
     {
         return;
     }
 
     TIME_PROFILE(LightCullingPass)
-    ID3D11DeviceContext* DeviceContext = DeviceResources->GetDeviceContext();
+    URenderer& Renderer = URenderer::GetInstance();
 
-    // 리소스 바인딩
-    DeviceContext->CSSetShader(CullingCS, nullptr, 0);
-    DeviceContext->CSSetConstantBuffers(0, 1, &CullingParamsCB);
-    DeviceContext->CSSetShaderResources(0, 1, &AllLightsSRV);
+    FCullingParams cullingParams = {};
+    cullingParams.View = Context.CurrentCamera->GetFViewProjConstants().View;
+    cullingParams.Projection = Context.CurrentCamera->GetFViewProjConstants().Projection;
+    // 뷰포트 오프셋 및 크기 전달
+    cullingParams.ViewportOffset[0] = static_cast<uint32>(Context.Viewport.TopLeftX);
+    cullingParams.ViewportOffset[1] = static_cast<uint32>(Context.Viewport.TopLeftY);
+    cullingParams.ViewportSize[0] = static_cast<uint32>(Context.Viewport.Width);
+    cullingParams.ViewportSize[1] = static_cast<uint32>(Context.Viewport.Height);
+    cullingParams.NumLights = static_cast<uint32>(AllLights.size());
+    // Near/Far 클리핑 평면
+    cullingParams.NearClip = Context.CurrentCamera->GetFViewProjConstants().NearClip;
+    cullingParams.FarClip = Context.CurrentCamera->GetFViewProjConstants().FarClip;
 
-    // UAVs 바인딩
-    DeviceContext->CSSetUnorderedAccessViews(0, 1, &LightIndexBufferUAV, nullptr);
-    DeviceContext->CSSetUnorderedAccessViews(1, 1, &ClusterLightInfoUAV, nullptr);
+    // 클러스터 배정 (지수 깊이 슬라이스, 라이트 준비와 클러스터 행을 작업 시스템에 분배)
+    LightCuller->Build(cullingParams, AllLights, &FJobSystem::GetInstance());
 
-    // 컴퓨트 셰이더 디스패치 (클러스터 3D 그리드 기반)
-    const uint32 viewportWidth = static_cast<uint32>(Context.Viewport.Width);
-    const uint32 viewportHeight = static_cast<uint32>(Context.Viewport.Height);
-    
-    const uint32 numClustersX = (viewportWidth + CLUSTER_SIZE_X - 1) / CLUSTER_SIZE_X;
-    const uint32 numClustersY = (viewportHeight + CLUSTER_SIZE_Y - 1) / CLUSTER_SIZE_Y;
-    const uint32 numClustersZ = CLUSTER_SIZE_Z;
+    const TArray<FClusterLightInfo>& ClusterLightInfo = LightCuller->GetClusterLightInfo();
+    const TArray<uint32>& LightIndices = LightCuller->GetLightIndices();
+    if (LightCuller->GetOverflowClusterCount() > 0)
+    {
+        UE_LOG_WARNING("클러스터 라이트 개수가 최대치를 초과했습니다: %u개 클러스터 > %u", LightCuller->GetOverflowClusterCount(),
+            FClusteredLightCuller::MAX_LIGHTS_PER_CLUSTER);
+    }
 
-    DeviceContext->Dispatch(numClustersX, numClustersY, numClustersZ);
+    // 실제 배정 결과 크기만큼만 버퍼를 유지하고 업로드
+    Renderer.ReserveLightCullBuffers(static_cast<uint32>(ClusterLightInfo.size()), static_cast<uint32>(LightIndices.size()));
+    FRenderResourceFactory::UpdateStructuredBufferData(Renderer.GetClusterLightInfoBuffer(), ClusterLightInfo);
+    FRenderResourceFactory::UpdateStructuredBufferData(Renderer.GetLightIndexBuffer(), LightIndices);
 }
 
 void FLightCullingPass::PostExecute(FRenderingContext& Context)
 {
-    const auto& Renderer = URenderer::GetInstance();
-    const auto& DeviceResources = Renderer.GetDeviceResources();
-    ID3D11DeviceContext* DeviceContext = DeviceResources->GetDeviceContext();
-
-    ID3D11UnorderedAccessView* nullUAVs[2] = { nullptr, nullptr };
-    DeviceContext->CSSetUnorderedAccessViews(0, 2, nullUAVs, nullptr);
-    ID3D11ShaderResourceView* nullSRVs[1] = { nullptr };
-    DeviceContext->CSSetShaderResources(0, 1, nullSRVs);
-    ID3D11Buffer* nullCB = nullptr;
-    DeviceContext->CSSetConstantBuffers(0, 1, &nullCB);
-    DeviceContext->CSSetShader(nullptr, nullptr, 0);
 }
 
 void FLightCullingPass::Release()
 {
-    ReleaseResources();
+    SafeDelete(LightCuller);
 }
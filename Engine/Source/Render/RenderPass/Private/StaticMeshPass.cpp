@@ -6,6 +6,8 @@
 #include "Component/Light/Public/DirectionalLightComponent.h"
 #include "Component/Light/Public/PointLightComponent.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Editor/Public/Camera.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
 #include "Render/Renderer/Public/Pipeline.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
 #include "Texture/Public/Texture.h"
@@ -33,6 +35,10 @@ void FStaticMeshPass::PreExecute(FRenderingContext& Context)
 	PS = InPS;
 	PSWithNormalMap = InNormalPS;
 	VS = InVS;
+	InstancedVS = Renderer.GetInstancedVertexShaderForLightingModel();
+	InstancedInputLayout = Renderer.GetInstancedTextureInputLayout();
+	PackedInstancedVS = Renderer.GetInstancedVertexShaderForLightingModel(true);
+	PackedInstancedInputLayout = Renderer.GetInstancedTextureInputLayout(true);
 }
 
 void FStaticMeshPass::Execute(FRenderingContext& Context)
@@ -46,6 +52,7 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 		RenderState.FillMode = EFillMode::WireFrame;
 	}
 	ID3D11RasterizerState* RS = FRenderResourceFactory::GetRasterizerState(RenderState);
+	const bool bIsBackfaceCulling = RenderState.CullMode == ECullMode::Back;
 	// Set a default sampler to slot 0 to ensure one is always bound
 	Pipeline->SetSamplerState(0, false, URenderer::GetInstance().GetDefaultSampler());
 	Pipeline->SetConstantBuffer(0, true, ConstantBufferModel);
@@ -56,42 +63,106 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 	URenderer::GetInstance().SetUpTiledLighting(Context);
 	URenderer::GetInstance().BindTiledLightingBuffers();
 
-	// Sort Static Mesh Components
-	if (!(Context.ShowFlags & EEngineShowFlags::SF_StaticMesh)) { return; }
-	TArray<UStaticMeshComponent*>& MeshComponents = Context.StaticMeshes;
-	sort(MeshComponents.begin(), MeshComponents.end(),
-		[](UStaticMeshComponent* A, UStaticMeshComponent* B) {
-			int32 MeshA = A->GetStaticMesh() ? A->GetStaticMesh()->GetAssetPathFileName().GetComparisonIndex() : 0;
-			int32 MeshB = B->GetStaticMesh() ? B->GetStaticMesh()->GetAssetPathFileName().GetComparisonIndex() : 0;
-			return MeshA < MeshB;
-		});
-
-	FStaticMesh* CurrentMeshAsset = nullptr;
-	UMaterial* CurrentMaterial = nullptr;
+	// Context.StaticMeshes는 이미 렌더 정렬 키(셰이더, 머티리얼, 메시, 깊이) 순서
+	const TArray<UStaticMeshComponent*>& MeshComponents = Context.StaticMeshes;
 
-	// --- RTVs Setup End ---
+	// LOD는 Renderer::RenderLevel에서 카메라 컬러가 골라 두었다
+	const ViewVolumeCuller& Culler = Context.CurrentCamera->GetViewVolumeCuller();
 
+	// (메시, LOD, 섹션별 머티리얼) 배치를 만들고 인스턴스 행렬을 한 버퍼에 모은다
+	BatchBuilder.Reset();
+	BatchedComponents.clear();
 	for (UStaticMeshComponent* MeshComp : MeshComponents) 
 	{
 		if (!MeshComp->GetStaticMesh()) { continue; }
 		FStaticMesh* MeshAsset = MeshComp->GetStaticMesh()->GetStaticMeshAsset();
 		if (!MeshAsset) { continue; }
 
+		// Material이 없는 메시는 빈 세트로 묶여 기본 Material로 그린다
+		SectionMaterials.clear();
+		if (!MeshAsset->MaterialInfo.empty() && MeshComp->GetStaticMesh()->GetNumMaterials() != 0)
+		{
+			if (MeshComp->IsScrollEnabled()) 
+			{
+				MeshComp->SetElapsedTime(MeshComp->GetElapsedTime() + UTimeManager::GetInstance().GetDeltaTime());
+			}
+
+			for (const FMeshSection& Section : MeshAsset->Sections)
+			{
+				SectionMaterials.push_back(MeshComp->GetMaterial(Section.MaterialSlot));
+			}
+		}
+
+		const int32 MaterialSetIndex = BatchBuilder.FindOrAddMaterialSet(SectionMaterials.data(), static_cast<int32>(SectionMaterials.size()));
+		const int32 LODIndex = std::min(Culler.GetProxyLOD(MeshComp->RenderProxyIndex), MeshAsset->GetNumLODs() - 1);
+		BatchBuilder.AddInstance(MeshAsset, MaterialSetIndex, &MeshComp->GetWorldTransformMatrix(), &MeshComp->GetWorldTransformMatrixInverse(),
+			MeshAsset->HasPackedVertices() ? &MeshAsset->PackedPositionToLocal : nullptr, LODIndex);
+		BatchedComponents.push_back(MeshComp);
+	}
+	BatchBuilder.Build();
+
+	const TArray<FInstanceData>& Instances = BatchBuilder.GetInstanceData();
+	if (Instances.empty()) { return; }
+	ReserveInstanceBuffer(static_cast<uint32>(Instances.size()));
+	FRenderResourceFactory::UpdateVertexBufferData(InstanceBuffer, Instances);
+	Pipeline->SetInstanceBuffer(InstanceBuffer, sizeof(FInstanceData));
+
+	const FStaticMesh* CurrentMeshAsset = nullptr;
+	UMaterial* CurrentMaterial = nullptr;
+	ID3D11VertexShader* BatchVS = InstancedVS;
+	ID3D11InputLayout* BatchInputLayout = InstancedInputLayout;
+
+	for (const FInstanceBatch& Batch : BatchBuilder.GetBatches())
+	{
+		// 버퍼와 Material 상수는 배치에 처음 들어온 컴포넌트 기준
+		UStaticMeshComponent* MeshComp = BatchedComponents[Batch.FirstSourceIndex];
+		const FStaticMesh* MeshAsset = Batch.Mesh;
+
 		if (CurrentMeshAsset != MeshAsset)
 		{
-			Pipeline->SetVertexBuffer(MeshComp->GetVertexBuffer(), sizeof(FNormalVertex));
+			const bool bIsPacked = Batch.PositionToLocal != nullptr;
+			Pipeline->SetVertexBuffer(MeshComp->GetVertexBuffer(), bIsPacked ? sizeof(FPackedNormalVertex) : sizeof(FNormalVertex));
 			Pipeline->SetIndexBuffer(MeshComp->GetIndexBuffer(), 0);
 			CurrentMeshAsset = MeshAsset;
+
+			// 정점 포맷이 바뀌면 같은 Material이어도 파이프라인을 다시 설정해야 한다
+			ID3D11VertexShader* MeshVS = bIsPacked ? PackedInstancedVS : InstancedVS;
+			if (BatchVS != MeshVS)
+			{
+				BatchVS = MeshVS;
+				BatchInputLayout = bIsPacked ? PackedInstancedInputLayout : InstancedInputLayout;
+				CurrentMaterial = nullptr;
+			}
 		}
-		
-		FModelConstants ModelConstants{ MeshComp->GetWorldTransformMatrix(), MeshComp->GetWorldTransformMatrixInverse().Transpose() };
-		FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, ModelConstants);
-		Pipeline->SetConstantBuffer(0, true, ConstantBufferModel);
 
-		if (MeshAsset->MaterialInfo.empty() || MeshComp->GetStaticMesh()->GetNumMaterials() == 0)
+		// 하나만 LOD0으로 그리는 인스턴스는 메시렛을 절두체와 노멀 콘으로 걸러 보이는 구간만 그린다
+		const bool bHasMaterials = !MeshAsset->MaterialInfo.empty() && MeshComp->GetStaticMesh()->GetNumMaterials() != 0;
+		DrawRanges.clear();
+		if (Batch.InstanceCount == 1 && Batch.LODIndex == 0 && !MeshAsset->Meshlets.empty())
+		{
+			const FMeshletCullView MeshletView = FMeshletCuller::MakeView(Culler.GetFrustum(), Context.CurrentCamera->GetFViewProjConstants(),
+				MeshComp->GetWorldTransformMatrix(), MeshComp->GetWorldTransformMatrixInverse(), bIsBackfaceCulling);
+			if (FMeshletCuller::Cull(*MeshAsset, MeshletView, DrawRanges) == 0) { continue; }
+		}
+		else if (bHasMaterials)
+		{
+			// LOD 섹션은 LOD0과 같은 순서라 머티리얼 세트를 그대로 쓰고, 단순화로 다 사라진 섹션은 건너뛴다
+			const TArray<FMeshSection>& Sections = MeshAsset->GetLODSections(Batch.LODIndex);
+			for (size_t SectionIndex = 0; SectionIndex < Sections.size(); ++SectionIndex)
+			{
+				if (Sections[SectionIndex].IndexCount == 0) { continue; }
+				DrawRanges.push_back({ static_cast<uint32>(SectionIndex), Sections[SectionIndex].StartIndex, Sections[SectionIndex].IndexCount });
+			}
+		}
+		else
+		{
+			DrawRanges.push_back({ 0, MeshAsset->GetLODFirstIndex(Batch.LODIndex), MeshAsset->GetLODIndexCount(Batch.LODIndex) });
+		}
+
+		if (!bHasMaterials)
 		{
 			// Material이 없어도 파이프라인은 설정해야 함
-			FPipelineInfo PipelineInfo = { InputLayout, VS, RS, DS, PS, nullptr, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST };
+			FPipelineInfo PipelineInfo = { BatchInputLayout, BatchVS, RS, DS, PS, nullptr, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST };
 			Pipeline->UpdatePipeline(PipelineInfo);
 
 			// 기본 Material 상수 설정
@@ -102,23 +173,24 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 			Pipeline->SetConstantBuffer(2, false, ConstantBufferMaterial);
 			Pipeline->SetConstantBuffer(2, true, ConstantBufferMaterial);
 
-			Pipeline->DrawIndexed(MeshAsset->Indices.size(), 0, 0);
+			for (const FMeshletDrawRange& Range : DrawRanges)
+			{
+				Pipeline->DrawIndexedInstanced(Range.IndexCount, Batch.InstanceCount, Range.StartIndex, 0, Batch.FirstInstance);
+			}
+			// 기본 Material 상수로 덮어썼으므로 다음 배치에서 Material을 다시 바인딩
+			CurrentMaterial = nullptr;
 			continue;
 		}
 
-		if (MeshComp->IsScrollEnabled()) 
+		UMaterial* const* Materials = BatchBuilder.GetMaterialSet(Batch.MaterialSetIndex);
+		for (const FMeshletDrawRange& Range : DrawRanges)
 		{
-			MeshComp->SetElapsedTime(MeshComp->GetElapsedTime() + UTimeManager::GetInstance().GetDeltaTime());
-		}
-
-		for (const FMeshSection& Section : MeshAsset->Sections)
-		{
-			UMaterial* Material = MeshComp->GetMaterial(Section.MaterialSlot);
+			UMaterial* Material = Materials[Range.SectionIndex];
 			if (CurrentMaterial != Material) 
 			{
 				// Select appropriate pixel shader based on normal map presence
 				ID3D11PixelShader* SelectedPS = (Material->GetNormalTexture()) ? PSWithNormalMap : PS;
-				FPipelineInfo PipelineInfo = { InputLayout, VS, RS, DS, SelectedPS, nullptr, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST };
+				FPipelineInfo PipelineInfo = { BatchInputLayout, BatchVS, RS, DS, SelectedPS, nullptr, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST };
 				Pipeline->UpdatePipeline(PipelineInfo);
 
 				FMaterialConstants MaterialConstants = CreateMaterialConstants(Material, MeshComp);
@@ -130,7 +202,7 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 
 				CurrentMaterial = Material;
 			}
-			Pipeline->DrawIndexed(Section.IndexCount, Section.StartIndex, 0);
+			Pipeline->DrawIndexedInstanced(Range.IndexCount, Batch.InstanceCount, Range.StartIndex, 0, Batch.FirstInstance);
 		}
 	}
 }
@@ -157,6 +229,20 @@ void FStaticMeshPass::PostExecute(FRenderingContext& Context)
 void FStaticMeshPass::Release()
 {
 	SafeRelease(ConstantBufferMaterial);
+	SafeRelease(InstanceBuffer);
+	InstanceBufferCapacity = 0;
+}
+
+void FStaticMeshPass::ReserveInstanceBuffer(uint32 InInstanceCount)
+{
+	if (InstanceBuffer && InInstanceCount <= InstanceBufferCapacity)
+	{
+		return;
+	}
+
+	SafeRelease(InstanceBuffer);
+	InstanceBufferCapacity = std::max({ InInstanceCount, InstanceBufferCapacity * 2, 256u });
+	InstanceBuffer = FRenderResourceFactory::CreateDynamicVertexBuffer(InstanceBufferCapacity * sizeof(FInstanceData));
 }
 
 FMaterialConstants FStaticMeshPass::CreateMaterialConstants(UMaterial* Material, UStaticMeshComponent* MeshComp)
@@ -37,6 +37,9 @@ private:
     ID3D11VertexShader* VS = nullptr;
     ID3D11PixelShader* PS = nullptr;
     ID3D11InputLayout* InputLayout = nullptr;
+    /** @brief FPackedNormalVertex 메시용 PACKED_VERTEX 퍼뮤테이션, PreExecute에서 렌더러에게 받는다 */
+    ID3D11VertexShader* PackedVS = nullptr;
+    ID3D11InputLayout* PackedInputLayout = nullptr;
     ID3D11DepthStencilState* DS_Read = nullptr;
     ID3D11BlendState* BlendState = nullptr;
 
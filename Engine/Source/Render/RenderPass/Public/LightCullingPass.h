@@ -2,10 +2,11 @@
 #include "Render/RenderPass/Public/RenderPass.h"
 
 // Forward declarations
+class FClusteredLightCuller;
 class UDeviceResources;
 class UPipeline;
 
-// Must match the cbuffer in LightCulling.hlsl
+// 클러스터 라이트 배정(FClusteredLightCuller)에 넘기는 뷰포트 정보
 struct FCullingParams
 {
     FMatrix View;                // 64 bytes
@@ -36,6 +37,10 @@ struct FLightParams
     FVector4 Angles;      // x: inner cone angle (cos), y: outer cone angle (cos), z: falloff extent/falloff, w: InvRange2 (spot only)
 };
 
+/**
+ * @brief 뷰포트마다 라이트를 AllLights 버퍼에 올리고, CPU에서 클러스터별 라이트 목록을 만들어 업로드하는 패스
+ * 목록은 실제 배정 수만큼만 이어 붙인 인덱스와 클러스터별 (Offset, Count)이며, URenderer가 그 크기에 맞춰 버퍼를 유지한다.
+ */
 class FLightCullingPass : public FRenderPass
 {
 public:
@@ -47,30 +52,12 @@ public:
     void PostExecute(FRenderingContext& Context) override;
 
     void Release() override;
-private:
-    void CreateResources();
-    void ReleaseResources();
 
 private:
     UDeviceResources* DeviceResources = nullptr;
 
-    // Shader
-    ID3D11ComputeShader* CullingCS = nullptr;
-
-    // Constant Buffer
-    ID3D11Buffer* CullingParamsCB = nullptr;
+    FClusteredLightCuller* LightCuller = nullptr;
 
-    // UAV Buffers for light lists
-    ID3D11UnorderedAccessView* LightIndexBufferUAV = nullptr;
-    ID3D11UnorderedAccessView* ClusterLightInfoUAV = nullptr;
-    
-    // 라이트 데이터 버퍼 (고정 크기)
-    ID3D11Buffer* AllLightsBuffer = nullptr;
-    ID3D11ShaderResourceView* AllLightsSRV = nullptr;
-    static constexpr uint32 MAX_LIGHTS = 1024; // 최대 라이트 개수
-    
-    // 클러스터 그리드 상수
-    static constexpr uint32 CLUSTER_SIZE_X = 32;
-    static constexpr uint32 CLUSTER_SIZE_Y = 32;
-    static constexpr uint32 CLUSTER_SIZE_Z = 16;
+    // 이번 뷰포트의 라이트 데이터 (AllLights 버퍼와 같은 순서, 용량은 프레임 간 재사용)
+    TArray<FLightParams> AllLights;
 };
@@ -15,6 +15,8 @@ struct FRenderingContext
     FVector2 RenderTargetSize;
 
     TArray<class UPrimitiveComponent*> AllPrimitives;
+    /** @brief 정렬 키 순서의 렌더 명령, 아래 패스별 배열은 이 목록의 패스 구간을 같은 순서로 담는다 */
+    const struct FRenderCommandList* RenderCommands = nullptr;
     // Components By Render Pass
     TArray<class UStaticMeshComponent*> StaticMeshes;
     TArray<class UBillBoardComponent*> BillBoards;
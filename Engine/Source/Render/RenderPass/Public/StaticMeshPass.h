@@ -1,5 +1,7 @@
 #pragma once
 #include "Render/RenderPass/Public/RenderPass.h"
+#include "Optimization/Public/InstanceBatchBuilder.h"
+#include "Optimization/Public/MeshletCuller.h"
 
 class FStaticMeshPass : public FRenderPass
 {
@@ -15,11 +17,28 @@ public:
     void BindMaterialTextures(UMaterial* Material);
 
 private:
+    /** @brief 이번 프레임 인스턴스 수가 용량을 넘으면 인스턴스 버퍼를 두 배씩 키워 다시 만든다 */
+    void ReserveInstanceBuffer(uint32 InInstanceCount);
+
     ID3D11VertexShader* VS = nullptr;
     ID3D11PixelShader* PS = nullptr;
     ID3D11PixelShader* PSWithNormalMap = nullptr;
     ID3D11InputLayout* InputLayout = nullptr;
+    ID3D11VertexShader* InstancedVS = nullptr;
+    ID3D11InputLayout* InstancedInputLayout = nullptr;
+    /** @brief FPackedNormalVertex 메시용 PACKED_VERTEX 퍼뮤테이션 */
+    ID3D11VertexShader* PackedInstancedVS = nullptr;
+    ID3D11InputLayout* PackedInstancedInputLayout = nullptr;
     ID3D11DepthStencilState* DS = nullptr;
 
     ID3D11Buffer* ConstantBufferMaterial = nullptr;
+
+    /** @brief (메시, 머티리얼 세트) 배치와 프레임 단위 인스턴스 행렬 */
+    FInstanceBatchBuilder BatchBuilder;
+    TArray<UStaticMeshComponent*> BatchedComponents;
+    TArray<UMaterial*> SectionMaterials;
+    /** @brief 배치 하나에서 그릴 인덱스 구간, 메시렛 컬링 결과이거나 섹션 그대로 */
+    TArray<FMeshletDrawRange> DrawRanges;
+    ID3D11Buffer* InstanceBuffer = nullptr;
+    uint32 InstanceBufferCapacity = 0;
 };
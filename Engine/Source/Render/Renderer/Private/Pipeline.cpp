@@ -73,6 +73,13 @@ void UPipeline::SetVertexBuffer(ID3D11Buffer* VertexBuffer, uint32 Stride)
 	DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
 }
 
+/// @brief 인스턴스 버퍼를 1번 정점 버퍼 슬롯에 바인딩
+void UPipeline::SetInstanceBuffer(ID3D11Buffer* InstanceBuffer, uint32 Stride)
+{
+	uint32 Offset = 0;
+	DeviceContext->IASetVertexBuffers(1, 1, &InstanceBuffer, &Stride, &Offset);
+}
+
 /// @brief 상수 버퍼를 설정
 void UPipeline::SetConstantBuffer(uint32 Slot, bool bIsVS, ID3D11Buffer* ConstantBuffer)
 {
@@ -152,3 +159,10 @@ void UPipeline::DrawIndexed(uint32 IndexCount, uint32 StartIndexLocation, int32
 {
 	DeviceContext->DrawIndexed(IndexCount, StartIndexLocation, BaseVertexLocation);
 }
+
+/// @brief 인스턴스 버퍼의 [StartInstanceLocation, StartInstanceLocation + InstanceCount) 구간으로 인덱스 드로우
+void UPipeline::DrawIndexedInstanced(uint32 IndexCount, uint32 InstanceCount, uint32 StartIndexLocation, int32 BaseVertexLocation,
+	uint32 StartInstanceLocation)
+{
+	DeviceContext->DrawIndexedInstanced(IndexCount, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation);
+}
@@ -10,6 +10,15 @@ ID3D11Buffer* FRenderResourceFactory::CreateVertexBuffer(FNormalVertex* InVertic
 	return VertexBuffer;
 }
 
+ID3D11Buffer* FRenderResourceFactory::CreateVertexBuffer(const FPackedNormalVertex* InVertices, uint32 InByteWidth)
+{
+	D3D11_BUFFER_DESC Desc = { InByteWidth, D3D11_USAGE_IMMUTABLE, D3D11_BIND_VERTEX_BUFFER, 0, 0, 0 };
+	D3D11_SUBRESOURCE_DATA InitData = { InVertices, 0, 0 };
+	ID3D11Buffer* VertexBuffer = nullptr;
+	URenderer::GetInstance().GetDevice()->CreateBuffer(&Desc, &InitData, &VertexBuffer);
+	return VertexBuffer;
+}
+
 ID3D11Buffer* FRenderResourceFactory::CreateVertexBuffer(FVector* InVertices, uint32 InByteWidth, bool bCpuAccess)
 {
 	D3D11_BUFFER_DESC Desc = { InByteWidth, D3D11_USAGE_IMMUTABLE, D3D11_BIND_VERTEX_BUFFER, 0, 0, 0 };
@@ -33,6 +42,39 @@ ID3D11Buffer* FRenderResourceFactory::CreateIndexBuffer(const void* InIndices, u
 	return IndexBuffer;
 }
 
+ID3D11Buffer* FRenderResourceFactory::CreateDynamicVertexBuffer(uint32 InByteWidth)
+{
+	D3D11_BUFFER_DESC Desc = { InByteWidth, D3D11_USAGE_DYNAMIC, D3D11_BIND_VERTEX_BUFFER, D3D11_CPU_ACCESS_WRITE, 0, 0 };
+	ID3D11Buffer* VertexBuffer = nullptr;
+	URenderer::GetInstance().GetDevice()->CreateBuffer(&Desc, nullptr, &VertexBuffer);
+	return VertexBuffer;
+}
+
+void FRenderResourceFactory::CreateDynamicStructuredBuffer(uint32 InStride, uint32 InCount, ID3D11Buffer** OutBuffer,
+	ID3D11ShaderResourceView** OutSRV)
+{
+	D3D11_BUFFER_DESC Desc = {};
+	Desc.ByteWidth = InStride * InCount;
+	Desc.Usage = D3D11_USAGE_DYNAMIC;
+	Desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	Desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+	Desc.StructureByteStride = InStride;
+
+	ID3D11Device* Device = URenderer::GetInstance().GetDevice();
+	HRESULT hr = Device->CreateBuffer(&Desc, nullptr, OutBuffer);
+	assert(SUCCEEDED(hr) && "StructuredBuffer 생성 실패");
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
+	SRVDesc.Format = DXGI_FORMAT_UNKNOWN;
+	SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+	SRVDesc.Buffer.FirstElement = 0;
+	SRVDesc.Buffer.NumElements = InCount;
+
+	hr = Device->CreateShaderResourceView(*OutBuffer, &SRVDesc, OutSRV);
+	assert(SUCCEEDED(hr) && "StructuredBuffer SRV 생성 실패");
+}
+
 void FRenderResourceFactory::CreateVertexShaderAndInputLayout(const wstring& InFilePath,
 	const TArray<D3D11_INPUT_ELEMENT_DESC>& InInputLayoutDescs, ID3D11VertexShader** OutVertexShader,
 	ID3D11InputLayout** OutInputLayout, const D3D_SHADER_MACRO* InDefines)
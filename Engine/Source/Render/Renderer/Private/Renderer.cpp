@@ -9,6 +9,7 @@
 #include "Component/Public/HeightFogComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Component/Public/UUIDTextComponent.h"
+#include "Core/Public/JobSystem.h"
 #include "Editor/Public/Camera.h"
 #include "Editor/Public/Editor.h"
 #include "Editor/Public/Viewport.h"
@@ -233,6 +234,40 @@ void URenderer::CreateTextureShader()
 	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/UberShader.hlsl", TextureLayout, &TextureVertexShader, &TextureInputLayout);
 	UberShaderVertexPermutations.Default = TextureVertexShader;
 
+	// 인스턴스 버퍼(1번 슬롯)의 FInstanceData: World, WorldInverseTranspose 행 4개씩
+	TArray<D3D11_INPUT_ELEMENT_DESC> InstancedTextureLayout = TextureLayout;
+	for (uint32 Row = 0; Row < 4; ++Row)
+	{
+		InstancedTextureLayout.push_back({ "INSTANCE_WORLD", Row, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	}
+	for (uint32 Row = 0; Row < 4; ++Row)
+	{
+		InstancedTextureLayout.push_back({ "INSTANCE_NORMAL", Row, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	}
+	D3D_SHADER_MACRO InstancedDefines[] = {
+		{ "INSTANCED", "1" },
+		{ nullptr, nullptr }
+	};
+	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/UberShader.hlsl", InstancedTextureLayout,
+		&UberShaderVertexPermutations.Instanced, &InstancedTextureInputLayout, InstancedDefines);
+
+	// 쿠킹 시 양자화된 FPackedNormalVertex, 위치 복원은 인스턴스 World에 접혀 들어온다
+	TArray<D3D11_INPUT_ELEMENT_DESC> PackedInstancedTextureLayout =
+	{
+		{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, offsetof(FPackedNormalVertex, Position), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, offsetof(FPackedNormalVertex, Normal), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TANGENT", 0, DXGI_FORMAT_R16G16_SNORM, 0, offsetof(FPackedNormalVertex, Tangent), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, offsetof(FPackedNormalVertex, TexCoord), D3D11_INPUT_PER_VERTEX_DATA, 0 }
+	};
+	PackedInstancedTextureLayout.insert(PackedInstancedTextureLayout.end(), InstancedTextureLayout.begin() + TextureLayout.size(), InstancedTextureLayout.end());
+	D3D_SHADER_MACRO PackedInstancedDefines[] = {
+		{ "PACKED_VERTEX", "1" },
+		{ "INSTANCED", "1" },
+		{ nullptr, nullptr }
+	};
+	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/UberShader.hlsl", PackedInstancedTextureLayout,
+		&UberShaderVertexPermutations.PackedInstanced, &PackedInstancedTextureInputLayout, PackedInstancedDefines);
+
 	UE_LOG("URenderer: Compiling UberShader permutations...");
 
 	D3D_SHADER_MACRO UnlitDefines[] = {
@@ -248,6 +283,21 @@ void URenderer::CreateTextureShader()
 	FRenderResourceFactory::CreatePixelShader(L"Asset/Shader/UberShader.hlsl", &UberShaderPermutations.Gouraud, GouraudDefines);
 	FRenderResourceFactory::CreateVertexShader(L"Asset/Shader/UberShader.hlsl", &UberShaderVertexPermutations.Gouraud, GouraudDefines);
 
+	D3D_SHADER_MACRO GouraudInstancedDefines[] = {
+		{ "LIGHTING_MODEL_GOURAUD", "1" },
+		{ "INSTANCED", "1" },
+		{ nullptr, nullptr }
+	};
+	FRenderResourceFactory::CreateVertexShader(L"Asset/Shader/UberShader.hlsl", &UberShaderVertexPermutations.GouraudInstanced, GouraudInstancedDefines);
+
+	D3D_SHADER_MACRO GouraudPackedInstancedDefines[] = {
+		{ "LIGHTING_MODEL_GOURAUD", "1" },
+		{ "PACKED_VERTEX", "1" },
+		{ "INSTANCED", "1" },
+		{ nullptr, nullptr }
+	};
+	FRenderResourceFactory::CreateVertexShader(L"Asset/Shader/UberShader.hlsl", &UberShaderVertexPermutations.GouraudPackedInstanced, GouraudPackedInstancedDefines);
+
 	D3D_SHADER_MACRO GouraudNormalDefines[] = {
 		{ "LIGHTING_MODEL_GOURAUD", "1" },
 		{ "HAS_NORMAL_MAP", "1" },
@@ -310,6 +360,19 @@ void URenderer::CreateDecalShader()
 		{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, offsetof(FNormalVertex, TexCoord), D3D11_INPUT_PER_VERTEX_DATA, 0	}
 	};
 	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/DecalShader.hlsl", DecalLayout, &DecalVertexShader, &DecalInputLayout);
+
+	TArray<D3D11_INPUT_ELEMENT_DESC> DecalPackedLayout =
+	{
+		{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, offsetof(FPackedNormalVertex, Position), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, offsetof(FPackedNormalVertex, Normal), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, offsetof(FPackedNormalVertex, TexCoord), D3D11_INPUT_PER_VERTEX_DATA, 0 }
+	};
+	D3D_SHADER_MACRO DecalPackedDefines[] = {
+		{ "PACKED_VERTEX", "1" },
+		{ nullptr, nullptr }
+	};
+	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/DecalShader.hlsl", DecalPackedLayout,
+		&DecalPackedVertexShader, &DecalPackedInputLayout, DecalPackedDefines);
 	FRenderResourceFactory::CreatePixelShader(L"Asset/Shader/DecalShader.hlsl", &DecalPixelShader);
 }
 
@@ -400,9 +463,15 @@ void URenderer::ReleaseShader()
 	SafeRelease(TextureInputLayout);
 	SafeRelease(TextureVertexShader);
 	UberShaderVertexPermutations.Default = nullptr;
+	SafeRelease(InstancedTextureInputLayout);
+	SafeRelease(PackedInstancedTextureInputLayout);
 	
 	// Release all UberShader permutations
 	SafeRelease(UberShaderVertexPermutations.Gouraud);
+	SafeRelease(UberShaderVertexPermutations.Instanced);
+	SafeRelease(UberShaderVertexPermutations.GouraudInstanced);
+	SafeRelease(UberShaderVertexPermutations.PackedInstanced);
+	SafeRelease(UberShaderVertexPermutations.GouraudPackedInstanced);
 	
 	SafeRelease(UberShaderPermutations.Unlit);
 	SafeRelease(UberShaderPermutations.Gouraud);
@@ -417,6 +486,8 @@ void URenderer::ReleaseShader()
 	SafeRelease(DecalVertexShader);
 	SafeRelease(DecalPixelShader);
 	SafeRelease(DecalInputLayout);
+	SafeRelease(DecalPackedVertexShader);
+	SafeRelease(DecalPackedInputLayout);
 	
 	SafeRelease(PointLightVertexShader);
 	SafeRelease(PointLightPixelShader);
@@ -450,6 +521,13 @@ ID3D11VertexShader* URenderer::GetVertexShaderForLightingModel() const
 	return UberShaderVertexPermutations.Default;
 }
 
+ID3D11VertexShader* URenderer::GetInstancedVertexShaderForLightingModel(bool bInPackedVertex) const
+{
+	if (CurrentLightingModel == ELightingModel::Gouraud)
+		return bInPackedVertex ? UberShaderVertexPermutations.GouraudPackedInstanced : UberShaderVertexPermutations.GouraudInstanced;
+	return bInPackedVertex ? UberShaderVertexPermutations.PackedInstanced : UberShaderVertexPermutations.Instanced;
+}
+
 ID3D11PixelShader* URenderer::GetPixelShaderForLightingModel(bool bHasNormalMap) const
 {
 	if (bHasNormalMap)
@@ -520,14 +598,27 @@ void URenderer::Update()
 
     RenderBegin();
 
+    // 카메라 행렬을 먼저 갱신하고, 모든 뷰포트의 컬링을 병렬로 끝낸 뒤 순서대로 렌더링한다
+    TArray<FViewportClient*> ActiveViewports;
     for (FViewportClient& ViewportClient : ViewportClient->GetViewports())
     {
         if (ViewportClient.GetViewportInfo().Width < 1.0f || ViewportClient.GetViewportInfo().Height < 1.0f) { continue; }
 
+        ViewportClient.Camera.Update(ViewportClient.GetViewportInfo());
+        ActiveViewports.push_back(&ViewportClient);
+    }
+
+    {
+        TIME_PROFILE(CullViewports)
+        CullViewports(ActiveViewports);
+    }
+
+    for (FViewportClient* ActiveViewport : ActiveViewports)
+    {
+        FViewportClient& ViewportClient = *ActiveViewport;
         ViewportClient.Apply(GetDeviceContext());
 
         UCamera* CurrentCamera = &ViewportClient.Camera;
-        CurrentCamera->Update(ViewportClient.GetViewportInfo());
         FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferViewProj, CurrentCamera->GetFViewProjConstants());
         Pipeline->SetConstantBuffer(1, true, ConstantBufferViewProj);
 	    
@@ -556,6 +647,42 @@ void URenderer::Update()
     RenderEnd();
 }
 
+void URenderer::CullViewports(const TArray<FViewportClient*>& InViewports)
+{
+	ULevel* CurrentLevel = GWorld->GetLevel();
+	if (!CurrentLevel || InViewports.empty())
+	{
+		return;
+	}
+
+	// 컬링 작업 동안 옥트리와 프리미티브 경계는 읽기 전용이므로, 대기 중인 이동은 메인 스레드에서 먼저 반영한다
+	CurrentLevel->PrepareForCulling();
+
+	const FOctree* StaticOctree = CurrentLevel->GetStaticOctree();
+	const TArray<UPrimitiveComponent*>& DynamicPrimitives = CurrentLevel->GetDynamicPrimitives();
+	const TArray<ULightComponent*>& Lights = CurrentLevel->GetLights();
+	const FPrimitiveBoundsSoA* PrimitiveBounds = &CurrentLevel->GetPrimitiveBounds();
+
+	// 와이어프레임은 가려진 면도 그리므로 오클루전 컬링을 하지 않는다
+	const bool bUseOcclusionCulling = bIsOcclusionCullingEnabled &&
+		GEditor->GetEditorModule()->GetViewMode() != EViewModeIndex::VMI_Wireframe;
+
+	// 뷰포트마다 자신의 컬러에만 결과를 쓰므로 뷰포트 하나를 작업 하나로 제출하고,
+	// 오클루전 컬러는 같은 작업 안에서 절두체 컬링 결과를 받아 타일 래스터화를 다시 작업으로 나눈다
+	FJobSystem& JobSystem = FJobSystem::GetInstance();
+	JobSystem.ParallelFor(static_cast<int32>(InViewports.size()), [&](int32 InIndex)
+	{
+		UCamera& Camera = InViewports[InIndex]->Camera;
+		ViewVolumeCuller& FrustumCuller = Camera.GetViewVolumeCuller();
+		FrustumCuller.Cull(StaticOctree, DynamicPrimitives, Lights, Camera.GetFViewProjConstants(), PrimitiveBounds);
+
+		if (bUseOcclusionCulling)
+		{
+			Camera.GetOcclusionCuller().Cull(FrustumCuller.GetFrustumVisibleObjects(), Camera.GetFViewProjConstants(), PrimitiveBounds, &JobSystem);
+		}
+	});
+}
+
 void URenderer::RenderBegin() const
 {
 	// Clear sRGB RTV (for normal rendering and UI)
@@ -621,17 +748,17 @@ void URenderer::RenderLevel(FViewportClient& InViewportClient)
 	const ULevel* CurrentLevel = GWorld->GetLevel();
 	if (!CurrentLevel) { return; }
 
-	// 오클루전 컬링
-	TIME_PROFILE(Occlusion)
-	// static COcclusionCuller Culler;
+	// 절두체 컬링과 오클루전 컬링은 CullViewports에서 끝났으므로 결과만 가져온다
 	const FCameraConstants& ViewProj = InViewportClient.Camera.GetFViewProjConstants();
-	// Culler.InitializeCuller(ViewProj.View, ViewProj.Projection);
-	TArray<UPrimitiveComponent*> FinalVisiblePrims = InViewportClient.Camera.GetViewVolumeCuller().GetRenderableObjects();
-	// Culler.PerformCulling(
-	// 	InCurrentCamera->GetViewVolumeCuller().GetRenderableObjects(),
-	// 	InCurrentCamera->GetLocation()
-	// );
-	TIME_PROFILE_END(Occlusion)
+	ViewVolumeCuller& Culler = InViewportClient.Camera.GetViewVolumeCuller();
+	Culler.AppendDynamicPrimitives();
+
+	// 컬러의 가시성 비트셋에서 보이는 프록시의 정렬 키만 모아 기수 정렬, 키는 상태가 바뀔 때만 다시 만든다
+	const FRenderProxyList& RenderProxies = CurrentLevel->GetRenderProxies();
+	Culler.EmitProxyVisibility(RenderProxies.Num(), ProxyVisibility);
+	// 보이는 스태틱 메시의 LOD는 뷰마다 고르고, 패스는 컬러에서 프록시 인덱스로 읽는다
+	Culler.SelectLODs(ViewProj, RenderProxies);
+	RenderProxies.BuildCommandList(ProxyVisibility, ViewProj.ViewWorldLocation, RenderCommands);
 
 	FRenderingContext RenderingContext(
 		&ViewProj,
@@ -641,28 +768,34 @@ void URenderer::RenderLevel(FViewportClient& InViewportClient)
 		InViewportClient.ViewportInfo,
 		{DeviceResources->GetViewportInfo().Width, DeviceResources->GetViewportInfo().Height}
 		);
-	// 1. Sort visible primitive components
-	RenderingContext.AllPrimitives = FinalVisiblePrims;
-	for (auto& Prim : FinalVisiblePrims)
+	// 1. 정렬된 명령 목록을 패스별 배열로 나눈다, 패스는 키에 들어 있으므로 Cast하지 않는다
+	RenderingContext.RenderCommands = &RenderCommands;
+	RenderingContext.AllPrimitives.reserve(RenderCommands.Commands.size());
+	for (const FRenderCommand& Command : RenderCommands.Commands)
 	{
+		UPrimitiveComponent* Prim = Command.Primitive;
 		if (!Prim->IsVisible())	continue;
 
-		if (auto StaticMesh = Cast<UStaticMeshComponent>(Prim))
-		{
-			RenderingContext.StaticMeshes.push_back(StaticMesh);
-		}
-		else if (auto BillBoard = Cast<UBillBoardComponent>(Prim))
-		{
-			RenderingContext.BillBoards.push_back(BillBoard);
-		}
-		else if (auto Text = Cast<UTextComponent>(Prim))
+		RenderingContext.AllPrimitives.push_back(Prim);
+		switch (FRenderSortKey::GetPass(Command.SortKey))
 		{
-			if (!Text->IsExactly(UUUIDTextComponent::StaticClass())) { RenderingContext.Texts.push_back(Text); }
-			else { RenderingContext.UUIDs.push_back(Cast<UUUIDTextComponent>(Text)); }
-		}
-		else if (auto Decal = Cast<UDecalComponent>(Prim))
-		{
-			RenderingContext.Decals.push_back(Decal);
+		case ERenderProxyPass::StaticMesh:
+			RenderingContext.StaticMeshes.push_back(static_cast<UStaticMeshComponent*>(Prim));
+			break;
+		case ERenderProxyPass::BillBoard:
+			RenderingContext.BillBoards.push_back(static_cast<UBillBoardComponent*>(Prim));
+			break;
+		case ERenderProxyPass::Text:
+			RenderingContext.Texts.push_back(static_cast<UTextComponent*>(Prim));
+			break;
+		case ERenderProxyPass::UUID:
+			RenderingContext.UUIDs.push_back(static_cast<UUUIDTextComponent*>(Prim));
+			break;
+		case ERenderProxyPass::Decal:
+			RenderingContext.Decals.push_back(static_cast<UDecalComponent*>(Prim));
+			break;
+		default:
+			break;
 		}
 	}
 	
@@ -758,7 +891,6 @@ void URenderer::OnResize(uint32 InWidth, uint32 InHeight)
 	DeviceResources->ReleaseDepthBuffer();
 	DeviceResources->ReleaseNormalBuffer();
 	GetDeviceContext()->OMSetRenderTargets(0, nullptr, nullptr);
-	ReleaseLightCullBuffers();
 	
     if (FAILED(GetSwapChain()->ResizeBuffers(2, InWidth, InHeight, DXGI_FORMAT_UNKNOWN, 0)))
     {
@@ -771,7 +903,6 @@ void URenderer::OnResize(uint32 InWidth, uint32 InHeight)
 	DeviceResources->CreateFrameBuffer();
 	DeviceResources->CreateDepthBuffer();
 	DeviceResources->CreateNormalBuffer();
-	CreateLightCullBuffers();
 
     ID3D11RenderTargetView* targetView = DeviceResources->GetSceneColorRenderTargetView();
     ID3D11RenderTargetView* targetViews[] = { targetView };
@@ -789,102 +920,65 @@ void URenderer::CreateConstantBuffers()
 
 void URenderer::CreateLightBuffers()
 {
-	HRESULT hr;
-
-	// 고정 크기 라이트 버퍼 생성 (DYNAMIC 사용)
-	D3D11_BUFFER_DESC bufferDesc = {};
-	bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-	bufferDesc.ByteWidth = sizeof(FLightParams) * MAX_LIGHTS;
-	bufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-	bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-	bufferDesc.StructureByteStride = sizeof(FLightParams);
-	bufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
-    
-	hr = DeviceResources->GetDevice()->CreateBuffer(&bufferDesc, nullptr, &AllLightsBuffer);
-	assert(SUCCEEDED(hr) && "AllLightsBuffer 생성 실패");
-    
-	// SRV 생성 (최대 크기로)
-	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-	srvDesc.Format = DXGI_FORMAT_UNKNOWN;
-	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
-	srvDesc.Buffer.FirstElement = 0;
-	srvDesc.Buffer.NumElements = MAX_LIGHTS;
-    
-	hr = DeviceResources->GetDevice()->CreateShaderResourceView(AllLightsBuffer, &srvDesc, &AllLightsSRV);
-	assert(SUCCEEDED(hr) && "AllLightsSRV 생성 실패");
+	ReserveLightBuffers(0);
 }
 
 void URenderer::CreateLightCullBuffers()
 {
-	HRESULT hr;
-	const uint32 MAX_SCENE_LIGHTS = 1024;
-	const uint32 CLUSTER_SIZE_X = 32;
-	const uint32 CLUSTER_SIZE_Y = 32;
-	const uint32 CLUSTER_SIZE_Z = 16;
-	const uint32 numClustersX = (DeviceResources->GetWidth() + CLUSTER_SIZE_X - 1) / CLUSTER_SIZE_X;
-	const uint32 numClustersY = (DeviceResources->GetHeight() + CLUSTER_SIZE_Y - 1) / CLUSTER_SIZE_Y;
-	const uint32 numClustersZ = CLUSTER_SIZE_Z;
-	const uint32 MAX_CLUSTERS = numClustersX * numClustersY * numClustersZ;
-	const uint32 MAX_TOTAL_LIGHT_INDICES = MAX_SCENE_LIGHTS * MAX_CLUSTERS * 8;
-        
-	// LightIndexBuffer 생성
-	D3D11_BUFFER_DESC lightIndexBufferDesc = {};
-	lightIndexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-	lightIndexBufferDesc.ByteWidth = sizeof(uint32) * (MAX_TOTAL_LIGHT_INDICES + 1);
-	lightIndexBufferDesc.BindFlags = D3D11_BIND_UNORDERED_ACCESS | D3D11_BIND_SHADER_RESOURCE;
-	lightIndexBufferDesc.StructureByteStride = sizeof(uint32);
-	lightIndexBufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
-        
-	hr = DeviceResources->GetDevice()->CreateBuffer(&lightIndexBufferDesc, nullptr, &LightIndexBuffer);
-	assert(SUCCEEDED(hr) && "LightIndexBuffer 생성 실패");
-        
-	D3D11_UNORDERED_ACCESS_VIEW_DESC lightIndexUAVDesc = {};
-	lightIndexUAVDesc.Format = DXGI_FORMAT_UNKNOWN;
-	lightIndexUAVDesc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
-	lightIndexUAVDesc.Buffer.FirstElement = 0;
-	lightIndexUAVDesc.Buffer.NumElements = MAX_TOTAL_LIGHT_INDICES + 1;
-	lightIndexUAVDesc.Buffer.Flags = D3D11_BUFFER_UAV_FLAG_COUNTER;
-        
-	hr = DeviceResources->GetDevice()->CreateUnorderedAccessView(LightIndexBuffer, &lightIndexUAVDesc, &LightIndexBufferUAV);
-	assert(SUCCEEDED(hr) && "LightIndexBufferUAV 생성 실패");
-        
-	D3D11_SHADER_RESOURCE_VIEW_DESC lightIndexSRVDesc = {};
-	lightIndexSRVDesc.Format = DXGI_FORMAT_UNKNOWN;
-	lightIndexSRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
-	lightIndexSRVDesc.Buffer.FirstElement = 0;
-	lightIndexSRVDesc.Buffer.NumElements = MAX_TOTAL_LIGHT_INDICES + 1;
-        
-	hr = DeviceResources->GetDevice()->CreateShaderResourceView(LightIndexBuffer, &lightIndexSRVDesc, &LightIndexBufferSRV);
-	assert(SUCCEEDED(hr) && "LightIndexBufferSRV 생성 실패");
-        
-	// ClusterLightInfoBuffer 재생성
-	D3D11_BUFFER_DESC clusterLightInfoBufferDesc = {};
-	clusterLightInfoBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-	clusterLightInfoBufferDesc.ByteWidth = sizeof(uint32) * 2 * MAX_CLUSTERS;
-	clusterLightInfoBufferDesc.BindFlags = D3D11_BIND_UNORDERED_ACCESS | D3D11_BIND_SHADER_RESOURCE;
-	clusterLightInfoBufferDesc.StructureByteStride = sizeof(uint32) * 2;
-	clusterLightInfoBufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
-        
-	hr = DeviceResources->GetDevice()->CreateBuffer(&clusterLightInfoBufferDesc, nullptr, &ClusterLightInfoBuffer);
-	assert(SUCCEEDED(hr) && "ClusterLightInfoBuffer 생성 실패");
-        
-	D3D11_UNORDERED_ACCESS_VIEW_DESC clusterLightInfoUAVDesc = {};
-	clusterLightInfoUAVDesc.Format = DXGI_FORMAT_UNKNOWN;
-	clusterLightInfoUAVDesc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
-	clusterLightInfoUAVDesc.Buffer.FirstElement = 0;
-	clusterLightInfoUAVDesc.Buffer.NumElements = MAX_CLUSTERS;
-        
-	hr = DeviceResources->GetDevice()->CreateUnorderedAccessView(ClusterLightInfoBuffer, &clusterLightInfoUAVDesc, &ClusterLightInfoUAV);
-	assert(SUCCEEDED(hr) && "ClusterLightInfoUAV 생성 실패");
-        
-	D3D11_SHADER_RESOURCE_VIEW_DESC clusterLightInfoSRVDesc = {};
-	clusterLightInfoSRVDesc.Format = DXGI_FORMAT_UNKNOWN;
-	clusterLightInfoSRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
-	clusterLightInfoSRVDesc.Buffer.FirstElement = 0;
-	clusterLightInfoSRVDesc.Buffer.NumElements = MAX_CLUSTERS;
-        
-	hr = DeviceResources->GetDevice()->CreateShaderResourceView(ClusterLightInfoBuffer, &clusterLightInfoSRVDesc, &ClusterLightInfoSRV);
-	assert(SUCCEEDED(hr) && "ClusterLightInfoSRV 생성 실패");
+	ReserveLightCullBuffers(0, 0);
+}
+
+namespace
+{
+	/**
+	 * @brief 라이트 버퍼의 새 용량, 다시 만들 필요가 없으면 InCapacity를 그대로 반환
+	 * 부족하면 1.5배 여유를 두고 늘리고, 사용량이 4분의 1 아래로 떨어지면 줄여서 메모리가 실제 사용량을 따라가게 한다.
+	 */
+	uint32 GetLightBufferCapacity(uint32 InCapacity, uint32 InRequired, uint32 InMinimum)
+	{
+		const bool bIsTooSmall = InRequired > InCapacity;
+		const bool bIsTooLarge = InCapacity > InMinimum && InRequired < InCapacity / 4;
+		if (InCapacity > 0 && !bIsTooSmall && !bIsTooLarge)
+		{
+			return InCapacity;
+		}
+		return std::max(InMinimum, InRequired + InRequired / 2);
+	}
+}
+
+void URenderer::ReserveLightBuffers(uint32 InLightCount)
+{
+	const uint32 Capacity = GetLightBufferCapacity(AllLightsCapacity, InLightCount, MIN_LIGHT_BUFFER_CAPACITY);
+	if (Capacity == AllLightsCapacity)
+	{
+		return;
+	}
+
+	ReleaseLightBuffers();
+	FRenderResourceFactory::CreateDynamicStructuredBuffer(sizeof(FLightParams), Capacity, &AllLightsBuffer, &AllLightsSRV);
+	AllLightsCapacity = Capacity;
+}
+
+void URenderer::ReserveLightCullBuffers(uint32 InClusterCount, uint32 InLightIndexCount)
+{
+	// 기존처럼 최악의 경우(라이트 수 x 클러스터 수)로 잡지 않고, CPU 배정 결과의 실제 크기만 따라간다
+	const uint32 ClusterCapacity = GetLightBufferCapacity(ClusterLightInfoCapacity, InClusterCount, MIN_LIGHT_BUFFER_CAPACITY);
+	if (ClusterCapacity != ClusterLightInfoCapacity)
+	{
+		SafeRelease(ClusterLightInfoBuffer);
+		SafeRelease(ClusterLightInfoSRV);
+		FRenderResourceFactory::CreateDynamicStructuredBuffer(sizeof(uint32) * 2, ClusterCapacity, &ClusterLightInfoBuffer, &ClusterLightInfoSRV);
+		ClusterLightInfoCapacity = ClusterCapacity;
+	}
+
+	const uint32 IndexCapacity = GetLightBufferCapacity(LightIndexCapacity, InLightIndexCount, MIN_LIGHT_BUFFER_CAPACITY);
+	if (IndexCapacity != LightIndexCapacity)
+	{
+		SafeRelease(LightIndexBuffer);
+		SafeRelease(LightIndexBufferSRV);
+		FRenderResourceFactory::CreateDynamicStructuredBuffer(sizeof(uint32), IndexCapacity, &LightIndexBuffer, &LightIndexBufferSRV);
+		LightIndexCapacity = IndexCapacity;
+	}
 }
 
 void URenderer::ReleaseConstantBuffers()
@@ -899,16 +993,17 @@ void URenderer::ReleaseLightBuffers()
 {
 	SafeRelease(AllLightsBuffer);
 	SafeRelease(AllLightsSRV);
+	AllLightsCapacity = 0;
 }
 
 void URenderer::ReleaseLightCullBuffers()
 {
 	SafeRelease(LightIndexBuffer);
-	SafeRelease(LightIndexBufferUAV);
 	SafeRelease(LightIndexBufferSRV);
 	SafeRelease(ClusterLightInfoBuffer);
-	SafeRelease(ClusterLightInfoUAV);
 	SafeRelease(ClusterLightInfoSRV);
+	LightIndexCapacity = 0;
+	ClusterLightInfoCapacity = 0;
 }
 
 // ========================================
@@ -928,8 +1023,8 @@ void URenderer::InitializeShaderHotReload()
 	ShaderHotReload->RegisterShader(L"Asset/Shader/FXAAShader.hlsl", "FXAAShader");
 	ShaderHotReload->RegisterShader(L"Asset/Shader/BillboardShader.hlsl", "BillboardShader");
 	ShaderHotReload->RegisterShader(L"Asset/Shader/SampleShader.hlsl", "DefaultShader");
-	ShaderHotReload->RegisterShader(L"Asset/Shader/LightCulling.hlsl", "LightCullingShader");
 	ShaderHotReload->RegisterShader(L"Asset/Shader/LightingCommon.hlsli", "LightCommon");
+	ShaderHotReload->RegisterShader(L"Asset/Shader/VertexFormat.hlsli", "VertexFormat");
 
 	UE_LOG("ShaderHotReload: Initialized and tracking shader files");
 }
@@ -951,6 +1046,13 @@ void URenderer::ReloadUberShader()
 	// SafeRelease(TextureInputLayout);
 	UberShaderVertexPermutations.Default = nullptr;
 	SafeRelease(UberShaderVertexPermutations.Gouraud);
+	// 인스턴스 레이아웃은 FStaticMeshPass가 매 프레임 다시 가져가므로 함께 다시 만든다
+	SafeRelease(InstancedTextureInputLayout);
+	SafeRelease(PackedInstancedTextureInputLayout);
+	SafeRelease(UberShaderVertexPermutations.Instanced);
+	SafeRelease(UberShaderVertexPermutations.GouraudInstanced);
+	SafeRelease(UberShaderVertexPermutations.PackedInstanced);
+	SafeRelease(UberShaderVertexPermutations.GouraudPackedInstanced);
 	SafeRelease(UberShaderPermutations.Unlit);
 	SafeRelease(UberShaderPermutations.Gouraud);
 	SafeRelease(UberShaderPermutations.Lambert);
@@ -974,6 +1076,8 @@ void URenderer::ReloadDecalShader()
 	SafeRelease(DecalVertexShader);
 	SafeRelease(DecalPixelShader);
 	SafeRelease(DecalInputLayout);
+	SafeRelease(DecalPackedVertexShader);
+	SafeRelease(DecalPackedInputLayout);
 
 	CreateDecalShader();
 
@@ -1066,27 +1170,3 @@ void URenderer::ReloadDefaultShader()
 
 	UE_LOG("ShaderHotReload: DefaultShader reloaded successfully!");
 }
-
-void URenderer::ReloadLightCullingShader()
-{
-	UE_LOG("ShaderHotReload: Reloading LightCullingShader...");
-
-	// LightCullingPass에서 컴파일하므로 해당 패스를 찾아서 재로드
-	for (auto RenderPass : RenderPasses)
-	{
-		FLightCullingPass* LightCullPass = dynamic_cast<FLightCullingPass*>(RenderPass);
-		if (LightCullPass)
-		{
-			// LightCullingPass의 재로드 메서드 호출 필요
-			// 현재는 로그만 출력
-			UE_LOG("ShaderHotReload: Found LightCullingPass - manual reload required");
-			break;
-		}
-	}
-
-	UE_LOG("ShaderHotReload: LightCullingShader reload requested!");
-}
-
-
-
-
@@ -111,11 +111,7 @@ void FShaderHotReload::RecompileShader(const FString& InShaderName)
 	{
 		Renderer.ReloadDefaultShader();
 	}
-	else if (InShaderName == "LightCullingShader")
-	{
-		Renderer.ReloadLightCullingShader();
-	}
-	else if (InShaderName == "LightCommon")
+	else if (InShaderName == "LightCommon" || InShaderName == "VertexFormat")
 	{
 		Renderer.ReloadUberShader();
 		Renderer.ReloadDecalShader();
@@ -22,6 +22,9 @@ public:
 
 	void SetVertexBuffer(ID3D11Buffer* VertexBuffer, uint32 Stride);
 
+	/** @brief 인스턴스 단위 데이터를 담은 정점 버퍼를 1번 슬롯에 바인딩 */
+	void SetInstanceBuffer(ID3D11Buffer* InstanceBuffer, uint32 Stride);
+
 	void SetConstantBuffer(uint32 Slot, bool bIsVS, ID3D11Buffer* ConstantBuffer);
 
 	void SetTexture(uint32 Slot, bool bIsVS, ID3D11ShaderResourceView* Srv);
@@ -35,6 +38,8 @@ public:
 
 	void DrawIndexed(uint32 IndexCount, uint32 IndexLocation, int32 BaseVertexLocation);
 
+	void DrawIndexedInstanced(uint32 IndexCount, uint32 InstanceCount, uint32 IndexLocation, int32 BaseVertexLocation, uint32 InstanceLocation);
+
 private:
 	FPipelineInfo LastPipelineInfo;
 	ID3D11DeviceContext* DeviceContext;
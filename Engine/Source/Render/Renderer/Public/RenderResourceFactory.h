@@ -5,8 +5,13 @@ class FRenderResourceFactory
 {
 public:
 	static ID3D11Buffer* CreateVertexBuffer(FNormalVertex* InVertices, uint32 InByteWidth);
+	static ID3D11Buffer* CreateVertexBuffer(const FPackedNormalVertex* InVertices, uint32 InByteWidth);
 	static ID3D11Buffer* CreateVertexBuffer(FVector* InVertices, uint32 InByteWidth, bool bCpuAccess);
 	static ID3D11Buffer* CreateIndexBuffer(const void* InIndices, uint32 InByteWidth);
+	/** @brief CPU가 매 프레임 WRITE_DISCARD로 채우는 정점 버퍼, 인스턴스 버퍼 용도 */
+	static ID3D11Buffer* CreateDynamicVertexBuffer(uint32 InByteWidth);
+	/** @brief CPU가 매 프레임 WRITE_DISCARD로 채우는 StructuredBuffer와 전체 범위 SRV */
+	static void CreateDynamicStructuredBuffer(uint32 InStride, uint32 InCount, ID3D11Buffer** OutBuffer, ID3D11ShaderResourceView** OutSRV);
 	static void CreateVertexShaderAndInputLayout(const wstring& InFilePath,
 		const TArray<D3D11_INPUT_ELEMENT_DESC>& InInputLayoutDescs, ID3D11VertexShader** OutVertexShader,
 		ID3D11InputLayout** OutInputLayout, const D3D_SHADER_MACRO* InDefines =nullptr);
@@ -59,6 +64,18 @@ public:
 		URenderer::GetInstance().GetDeviceContext()->Unmap(InVertexBuffer, 0);
 	}
 
+	template<typename T>
+	static void UpdateStructuredBufferData(ID3D11Buffer* InBuffer, const TArray<T>& InElements)
+	{
+		if (!URenderer::GetInstance().GetDeviceContext() || !InBuffer || InElements.empty()) return;
+
+		D3D11_MAPPED_SUBRESOURCE MappedResource = {};
+		if (FAILED(URenderer::GetInstance().GetDeviceContext()->Map(InBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource))) return;
+
+		memcpy(MappedResource.pData, InElements.data(), sizeof(T) * InElements.size());
+		URenderer::GetInstance().GetDeviceContext()->Unmap(InBuffer, 0);
+	}
+
 private:
 	struct FRasterKey
 	{
@@ -4,6 +4,7 @@
 #include "Component/Public/PrimitiveComponent.h"
 #include "Editor/Public/EditorPrimitive.h"
 #include "Render/Renderer/Public/Pipeline.h"
+#include "Optimization/Public/RenderProxyList.h"
 
 class FViewport;
 class UCamera;
@@ -58,6 +59,8 @@ public:
 	void Update();
 	void RenderBegin() const;
 	void RenderLevel(FViewportClient& InViewportClient);
+	/** @brief 모든 뷰포트의 프러스텀 컬링과 오클루전 컬링을 작업 시스템에서 병렬로 실행하고, RenderLevel 전에 모두 합류시킨다 */
+	void CullViewports(const TArray<FViewportClient*>& InViewports);
 	void RenderEnd() const;
 	void RenderEditorPrimitive(const FEditorPrimitive& InPrimitive, const FRenderState& InRenderState, uint32 InStride = 0, uint32 InIndexBufferStride = 0, bool bKeepCurrentTargets = false);
 
@@ -78,6 +81,7 @@ public:
 	FViewport* GetViewportClient() const { return ViewportClient; }
 	UPipeline* GetPipeline() const { return Pipeline; }
 	bool GetIsResizing() const { return bIsResizing; }
+	bool IsOcclusionCullingEnabled() const { return bIsOcclusionCullingEnabled; }
 
 	ID3D11DepthStencilState* GetDefaultDepthStencilState() const { return DefaultDepthStencilState; }
 	ID3D11DepthStencilState* GetDisabledDepthStencilState() const { return DisabledDepthStencilState; }
@@ -90,25 +94,41 @@ public:
 	ID3D11InputLayout* GetGizmoInputLayout() const { return GizmoInputLayout; }
 
 	ID3D11Buffer* GetLightIndexBuffer() const { return LightIndexBuffer; }
-	ID3D11UnorderedAccessView* GetLightIndexBufferUAV() const { return LightIndexBufferUAV; }
 	ID3D11ShaderResourceView* GetLightIndexBufferSRV() const { return LightIndexBufferSRV; }
 	ID3D11Buffer* GetClusterLightInfoBuffer() const { return ClusterLightInfoBuffer; }
-	ID3D11UnorderedAccessView* GetClusterLightInfoUAV() const { return ClusterLightInfoUAV; }
 	ID3D11ShaderResourceView* GetClusterLightInfoSRV() const { return ClusterLightInfoSRV; }
 	ID3D11Buffer* GetAllLightsBuffer() const { return AllLightsBuffer; }
 	ID3D11ShaderResourceView* GetAllLightsSRV() const { return AllLightsSRV; }
 
 	void SetIsResizing(bool isResizing) { bIsResizing = isResizing; }
+	void SetOcclusionCullingEnabled(bool bInEnabled) { bIsOcclusionCullingEnabled = bInEnabled; }
 
 	// Lighting Model
 	ELightingModel GetLightingModel() const { return CurrentLightingModel; }
 	void SetLightingModel(ELightingModel InModel) { CurrentLightingModel = InModel; }
 	ID3D11VertexShader* GetVertexShaderForLightingModel() const;
+	/**
+	 * @brief INSTANCED 퍼뮤테이션, 인스턴스 행렬을 1번 정점 버퍼 슬롯에서 읽는다
+	 * @param bInPackedVertex true면 FPackedNormalVertex를 읽는 PACKED_VERTEX 퍼뮤테이션
+	 */
+	ID3D11VertexShader* GetInstancedVertexShaderForLightingModel(bool bInPackedVertex = false) const;
+	ID3D11InputLayout* GetInstancedTextureInputLayout(bool bInPackedVertex = false) const
+	{
+		return bInPackedVertex ? PackedInstancedTextureInputLayout : InstancedTextureInputLayout;
+	}
 	ID3D11PixelShader* GetPixelShaderForLightingModel(bool bHasNormalMap) const;
+	/** @brief FPackedNormalVertex를 읽는 데칼 VS, 압축 정점 메시에 데칼을 투영할 때 쓴다 */
+	ID3D11VertexShader* GetDecalPackedVertexShader() const { return DecalPackedVertexShader; }
+	ID3D11InputLayout* GetDecalPackedInputLayout() const { return DecalPackedInputLayout; }
 	
 	void SetUpTiledLighting(const FRenderingContext& Context);
 	void BindTiledLightingBuffers();
 
+	/** @brief AllLights 버퍼가 InLightCount개를 담도록 필요할 때만 다시 만든다 */
+	void ReserveLightBuffers(uint32 InLightCount);
+	/** @brief ClusterLightInfo와 LightIndexBuffer가 실제 클러스터 수와 배정된 인덱스 수를 담도록 필요할 때만 다시 만든다 */
+	void ReserveLightCullBuffers(uint32 InClusterCount, uint32 InLightIndexCount);
+
 	// Shader Hot Reload
 	void InitializeShaderHotReload();
 	void CheckShaderHotReload();
@@ -120,7 +140,6 @@ public:
 	void ReloadFXAAShader();
 	void ReloadBillboardShader();
 	void ReloadDefaultShader();
-	void ReloadLightCullingShader();
 
 private:
 	UPipeline* Pipeline = nullptr;
@@ -141,19 +160,22 @@ private:
 	ID3D11Buffer* ConstantBufferColor = nullptr;
 	ID3D11Buffer* ConstantBufferTiledLighting = nullptr;
 	
-	// UAV Buffers for light lists
+	// 클러스터 라이트 목록 (FLightCullingPass가 CPU에서 배정해 매 프레임 업로드)
 	ID3D11Buffer* LightIndexBuffer = nullptr;
-	ID3D11UnorderedAccessView* LightIndexBufferUAV = nullptr;
 	ID3D11ShaderResourceView* LightIndexBufferSRV = nullptr;
+	uint32 LightIndexCapacity = 0;
 
 	ID3D11Buffer* ClusterLightInfoBuffer = nullptr;
-	ID3D11UnorderedAccessView* ClusterLightInfoUAV = nullptr;
 	ID3D11ShaderResourceView* ClusterLightInfoSRV = nullptr;
+	uint32 ClusterLightInfoCapacity = 0;
     
-	// ?�이???�이??버퍼 (고정 ?�기)
+	// 라이트 데이터 버퍼 (라이트 수에 맞춰 증가)
 	ID3D11Buffer* AllLightsBuffer = nullptr;
 	ID3D11ShaderResourceView* AllLightsSRV = nullptr;
-	static constexpr uint32 MAX_LIGHTS = 1024; // 최�? ?�이??개수
+	uint32 AllLightsCapacity = 0;
+
+	/** @brief 라이트 관련 StructuredBuffer의 최소 원소 수, 작은 씬에서 프레임마다 다시 만들지 않도록 한다 */
+	static constexpr uint32 MIN_LIGHT_BUFFER_CAPACITY = 1024;
 
 	
 	FLOAT ClearColor[4] = {0.0f, 0.0f, 0.0f, 1.0f};
@@ -185,6 +207,8 @@ private:
 	ID3D11PixelShader* TexturePixelShader = nullptr;
 	ID3D11PixelShader* TexturePixelShaderWithNormalMap = nullptr;
 	ID3D11InputLayout* TextureInputLayout = nullptr;
+	ID3D11InputLayout* InstancedTextureInputLayout = nullptr;
+	ID3D11InputLayout* PackedInstancedTextureInputLayout = nullptr;
 
 	// Gizmo Shaders
 	ID3D11VertexShader* GizmoVertexShader = nullptr;
@@ -196,6 +220,10 @@ private:
 	{
 		ID3D11VertexShader* Default = nullptr;
 		ID3D11VertexShader* Gouraud = nullptr;
+		ID3D11VertexShader* Instanced = nullptr;
+		ID3D11VertexShader* GouraudInstanced = nullptr;
+		ID3D11VertexShader* PackedInstanced = nullptr;
+		ID3D11VertexShader* GouraudPackedInstanced = nullptr;
 	} UberShaderVertexPermutations;
 	
 	struct FUberShaderPixelPermutations
@@ -220,6 +248,8 @@ private:
 	ID3D11VertexShader* DecalVertexShader = nullptr;
 	ID3D11PixelShader* DecalPixelShader = nullptr;
 	ID3D11InputLayout* DecalInputLayout = nullptr;
+	ID3D11VertexShader* DecalPackedVertexShader = nullptr;
+	ID3D11InputLayout* DecalPackedInputLayout = nullptr;
 
 	// Point Light Shaders
 	ID3D11VertexShader* PointLightVertexShader = nullptr;
@@ -243,9 +273,14 @@ private:
 	FViewport* ViewportClient = nullptr;
 	
 	bool bIsResizing = false;
+	bool bIsOcclusionCullingEnabled = true;
 
 	TArray<class FRenderPass*> RenderPasses;
 
+	/** @brief RenderLevel에서 뷰포트마다 다시 채우는 가시성 비트셋과 정렬된 렌더 명령, 할당을 재사용하려고 멤버로 둔다 */
+	TArray<uint64> ProxyVisibility;
+	FRenderCommandList RenderCommands;
+
 	FCopyPass* CopyPass = nullptr;
 	FFXAAPass* FXAAPass = nullptr;
 
@@ -3,6 +3,11 @@
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Utility/Public/UELogParser.h"
 #include "Utility/Public/ScopeCycleCounter.h"
+#include "Benchmark/Public/Benchmark.h"
+#include "Level/Public/LevelBinary.h"
+#include "Level/Public/Level.h"
+#include "Level/Public/World.h"
+#include "Component/Mesh/Public/StaticBatchComponent.h"
 
 IMPLEMENT_SINGLETON_CLASS(UConsoleWidget, UWidget)
 
@@ -89,6 +94,7 @@ void UConsoleWidget::RenderWidget()
 	                      ImGuiWindowFlags_HorizontalScrollbar))
 	{
 		// 로그 리스트 출력
+		std::lock_guard<std::mutex> Lock(LogMutex);
 		for (const auto& LogEntry : LogItems)
 		{
 			// ELogType을 기반으로 색상 결정
@@ -155,6 +161,7 @@ void UConsoleWidget::Update()
 
 void UConsoleWidget::ClearLog()
 {
+	std::lock_guard<std::mutex> Lock(LogMutex);
 	LogItems.clear();
 }
 
@@ -247,6 +254,7 @@ void UConsoleWidget::AddLogInternal(ELogType InType, const char* fmt, va_list In
 	LogEntry.Message = FString(Buffer);
 	delete[] Buffer;
 
+	std::lock_guard<std::mutex> Lock(LogMutex);
 	LogItems.push_back(LogEntry);
 
 	// Auto Scroll
@@ -284,6 +292,7 @@ void UConsoleWidget::AddSystemLog(const char* InText, bool bInIsError)
 		LogEntry.Message.pop_back();
 	}
 
+	std::lock_guard<std::mutex> Lock(LogMutex);
 	LogItems.push_back(LogEntry);
 
 	// Auto Scroll
@@ -439,6 +448,22 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		HandleStatCommand(StatCommand);
 	}
 
+	// Bench 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "bench" || (CommandLower.length() > 6 && CommandLower.substr(0, 6) == "bench "))
+	{
+		HandleBenchCommand(CommandLower.length() > 6 ? CommandLower.substr(6) : FString());
+	}
+
+	// Scene 명령어 처리 (경로는 대소문자를 유지해야 하므로 원본 입력에서 인자를 자른다)
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 6 && CommandLower.substr(0, 6) == "scene ")
+	{
+		HandleSceneCommand(FString(InCommand).substr(6));
+	}
+
 	// Help 명령어 입력
 	else if (FString CommandLower = InCommand;
 		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
@@ -451,6 +476,10 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  STAT MEMORY - Show memory overlay");
 		AddLog(ELogType::Info, "  STAT PICK - Show picking performance overlay");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
+		AddLog(ELogType::Info, "  BENCH LIST - Show CPU benchmarks");
+		AddLog(ELogType::Info, "  BENCH <name> [args...] - Run CPU benchmark");
+		AddLog(ELogType::Info, "  SCENE CONVERT <src> <dst> - Convert a level between .scene (JSON) and .scenebin (binary)");
+		AddLog(ELogType::Info, "  SCENE BATCH [ON|OFF] - Merge static props into per-cell batches on level load, or show batch stats");
 		AddLog(ELogType::Info, "  UE_LOG(\"String with format\", Args...) - Enhanced printf Formatting");
 		AddLog(ELogType::Debug, "    기본 예제: UE_LOG(\"Hello World %%d\", 2025)");
 		AddLog(ELogType::Debug, "    문자열: UE_LOG(\"User: %%s\", \"John\")");
@@ -522,6 +551,96 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 	}
 }
 
+void UConsoleWidget::HandleBenchCommand(const FString& BenchCommand)
+{
+	TArray<FString> Tokens;
+	std::istringstream Stream(BenchCommand);
+	FString Token;
+	while (Stream >> Token)
+	{
+		Tokens.push_back(Token);
+	}
+
+	if (Tokens.empty() || Tokens[0] == "list")
+	{
+		FBenchmarkRegistry::PrintList();
+		return;
+	}
+
+	const FString Name = Tokens[0];
+	Tokens.erase(Tokens.begin());
+	if (!FBenchmarkRegistry::Run(Name, Tokens))
+	{
+		AddLog(ELogType::Error, "Unknown bench command: %s", Name.c_str());
+		AddLog(ELogType::Info, "Type BENCH LIST to see available benchmarks");
+	}
+}
+
+void UConsoleWidget::HandleSceneCommand(const FString& SceneCommand)
+{
+	TArray<FString> Tokens;
+	std::istringstream Stream(SceneCommand);
+	FString Token;
+	while (Stream >> Token)
+	{
+		Tokens.push_back(Token);
+	}
+
+	FString SubCommand = Tokens.empty() ? FString() : Tokens[0];
+	std::transform(SubCommand.begin(), SubCommand.end(), SubCommand.begin(), ::tolower);
+
+	if (SubCommand == "batch" && Tokens.size() <= 2)
+	{
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		if (!CurrentLevel)
+		{
+			AddLog(ELogType::Error, "SCENE BATCH: No level loaded");
+			return;
+		}
+
+		FString Option = Tokens.size() == 2 ? Tokens[1] : FString();
+		std::transform(Option.begin(), Option.end(), Option.begin(), ::tolower);
+		if (Option == "on")
+		{
+			GWorld->SetStaticBatchingEnabled(true);
+			CurrentLevel->BuildStaticBatches(FStaticMeshMerger::DEFAULT_CELL_SIZE);
+		}
+		else if (Option == "off")
+		{
+			GWorld->SetStaticBatchingEnabled(false);
+			CurrentLevel->ReleaseStaticBatches();
+		}
+		else if (!Option.empty())
+		{
+			AddLog(ELogType::Error, "Usage: SCENE BATCH [ON|OFF]");
+			return;
+		}
+
+		uint32 DrawsBefore = 0;
+		uint32 DrawsAfter = 0;
+		uint64 BufferSize = 0;
+		for (const UStaticBatchComponent* Batch : CurrentLevel->GetStaticBatches())
+		{
+			DrawsBefore += Batch->GetSourceDrawCount();
+			DrawsAfter += Batch->GetDrawCount();
+			BufferSize += Batch->GetMergedBufferSize();
+		}
+		AddLog(ELogType::Info, "Static batching %s | %zu cells, %d components | draws %u -> %u | merged buffers %.2f MB",
+			GWorld->IsStaticBatchingEnabled() ? "ON" : "OFF", CurrentLevel->GetStaticBatches().size(), CurrentLevel->GetNumStaticBatchedSources(),
+			DrawsBefore, DrawsAfter, static_cast<double>(BufferSize) / (1024.0 * 1024.0));
+		return;
+	}
+
+	if (SubCommand != "convert" || Tokens.size() != 3)
+	{
+		AddLog(ELogType::Error, "Usage: SCENE CONVERT <src> <dst> | SCENE BATCH [ON|OFF]");
+		AddLog(ELogType::Info, "Extension decides the format: .scene (JSON) or .scenebin (binary)");
+		return;
+	}
+
+	FLevelBinary::Convert(Tokens[1], Tokens[2]);
+}
+
 /**
  * @brief 실제 터미널 명령어를 실행하고 결과를 콘솔에 표시하는 함수
  * @param InCommand 실행할 터미널 명령어
@@ -743,6 +743,7 @@ path UMainBarWidget::OpenSaveFileDialog()
 			// 파일 타입 필터 설정
 			COMDLG_FILTERSPEC SpecificationRange[] = {
 				{L"Scene Files (*.scene)", L"*.scene"},
+				{L"Binary Scene Files (*.scenebin)", L"*.scenebin"},
 				{L"All Files (*.*)", L"*.*"}
 			};
 			FileSaveDialogPtr->SetFileTypes(ARRAYSIZE(SpecificationRange), SpecificationRange);
@@ -829,6 +830,7 @@ path UMainBarWidget::OpenLoadFileDialog()
 			// 파일 타입 필터 설정
 			COMDLG_FILTERSPEC SpecificationRange[] = {
 				{L"Scene Files (*.scene)", L"*.scene"},
+				{L"Binary Scene Files (*.scenebin)", L"*.scenebin"},
 				{L"All Files (*.*)", L"*.*"}
 			};
 
@@ -209,6 +209,7 @@ path USceneIOWidget::OpenSaveFileDialog()
 			// 파일 타입 필터 설정
 			COMDLG_FILTERSPEC SpecificationRange[] = {
 				{L"Scene Files (*.scene)", L"*.scene"},
+				{L"Binary Scene Files (*.scenebin)", L"*.scenebin"},
 				{L"All Files (*.*)", L"*.*"}
 			};
 			FileSaveDialogPtr->SetFileTypes(ARRAYSIZE(SpecificationRange), SpecificationRange);
@@ -295,6 +296,7 @@ path USceneIOWidget::OpenLoadFileDialog()
 			// 파일 타입 필터 설정
 			COMDLG_FILTERSPEC SpecificationRange[] = {
 				{L"Scene Files (*.scene)", L"*.scene"},
+				{L"Binary Scene Files (*.scenebin)", L"*.scenebin"},
 				{L"All Files (*.*)", L"*.*"}
 			};
 
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Render/UI/Widget/Public/StaticMeshComponentWidget.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Mesh/Public/StaticBatchComponent.h"
 #include "Component/Mesh/Public/StaticMesh.h"
 
 #include "Level/Public/Level.h"
@@ -85,6 +86,8 @@ void UStaticMeshComponentWidget::RenderStaticMeshSelector()
 		{
 			UStaticMesh* MeshInList = *It;
 			if (!MeshInList) continue;
+			// 정적 배치 셀의 합친 메시는 에셋이 아니다
+			if (UStaticBatchComponent::IsStaticBatchMesh(MeshInList)) continue;
 
 			// 현재 선택된 항목인지 확인합니다.
 			const bool bIsSelected = (CurrentStaticMesh == MeshInList);
@@ -176,6 +179,17 @@ void UStaticMeshComponentWidget::RenderOptions()
 			StaticMeshComponent->DisableScroll();
 		}
 	}
+
+	// LOD 고정, -1은 화면 크기에 따른 자동 선택
+	const FStaticMesh* MeshAsset = StaticMeshComponent->GetStaticMesh() ? StaticMeshComponent->GetStaticMesh()->GetStaticMeshAsset() : nullptr;
+	if (MeshAsset && MeshAsset->GetNumLODs() > 1)
+	{
+		int32 ForcedLOD = StaticMeshComponent->GetForcedLOD();
+		if (ImGui::SliderInt("Forced LOD", &ForcedLOD, -1, MeshAsset->GetNumLODs() - 1))
+		{
+			StaticMeshComponent->SetForcedLOD(ForcedLOD);
+		}
+	}
 }
 
 void UStaticMeshComponentWidget::RenderMaterialTextureEditor(UMaterial* Material)
@@ -1,4 +1,6 @@
 #pragma once
+#include <mutex>
+
 #include "Widget.h"
 
 using std::streambuf;
@@ -60,6 +62,8 @@ public:
 	// Console command
 	void ProcessCommand(const char* InCommand);
 	void HandleStatCommand(const FString& StatCommand);
+	void HandleBenchCommand(const FString& BenchCommand);
+	void HandleSceneCommand(const FString& SceneCommand);
 	void ExecuteTerminalCommand(const char* InCommand);
 
 	// Use external terminal
@@ -78,6 +82,8 @@ private:
 
 	// Log output
 	TArray<FLogEntry> LogItems;
+	/** 에셋 로딩처럼 잡 시스템 워커에서도 UE_LOG를 호출하므로 LogItems 접근을 보호 */
+	std::mutex LogMutex;
 	bool bIsAutoScroll;
 	bool bIsScrollToBottom;
 
@@ -0,0 +1,656 @@
+#include "pch.h"
+#include "Utility/Public/JsonReader.h"
+
+#include <charconv>
+#include <emmintrin.h>
+
+namespace
+{
+	constexpr size_t BLOCK_SIZE = 64;
+
+	/** @brief 64바이트 블록의 문자 종류별 비트 마스크, 비트 i가 블록의 i번째 바이트 */
+	struct FBlockMasks
+	{
+		uint64 Quote = 0;
+		uint64 Backslash = 0;
+		uint64 Operator = 0;
+		uint64 Whitespace = 0;
+	};
+
+	FBlockMasks ScanBlock(const char* InBlock)
+	{
+		const __m128i QuoteChar = _mm_set1_epi8('"');
+		const __m128i BackslashChar = _mm_set1_epi8('\\');
+
+		FBlockMasks Masks;
+		for (int32 Chunk = 0; Chunk < 4; ++Chunk)
+		{
+			const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InBlock + Chunk * 16));
+			const uint32 Shift = Chunk * 16;
+
+			const __m128i Operator = _mm_or_si128(
+				_mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(Bytes, _mm_set1_epi8('{')), _mm_cmpeq_epi8(Bytes, _mm_set1_epi8('}'))),
+					_mm_or_si128(_mm_cmpeq_epi8(Bytes, _mm_set1_epi8('[')), _mm_cmpeq_epi8(Bytes, _mm_set1_epi8(']')))),
+				_mm_or_si128(_mm_cmpeq_epi8(Bytes, _mm_set1_epi8(':')), _mm_cmpeq_epi8(Bytes, _mm_set1_epi8(','))));
+			const __m128i Whitespace = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(Bytes, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(Bytes, _mm_set1_epi8('\t'))),
+				_mm_or_si128(_mm_cmpeq_epi8(Bytes, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(Bytes, _mm_set1_epi8('\r'))));
+
+			Masks.Quote |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, QuoteChar)))) << Shift;
+			Masks.Backslash |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, BackslashChar)))) << Shift;
+			Masks.Operator |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(Operator))) << Shift;
+			Masks.Whitespace |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(Whitespace))) << Shift;
+		}
+		return Masks;
+	}
+
+	/** @brief 각 비트를 그 위치까지의 XOR로 바꾼다, 따옴표 마스크를 문자열 내부 마스크로 만들 때 사용 */
+	uint64 PrefixXor(uint64 InBits)
+	{
+		InBits ^= InBits << 1;
+		InBits ^= InBits << 2;
+		InBits ^= InBits << 4;
+		InBits ^= InBits << 8;
+		InBits ^= InBits << 16;
+		InBits ^= InBits << 32;
+		return InBits;
+	}
+
+	/**
+	 * @brief 홀수 길이 백슬래시 열 바로 다음 문자(이스케이프된 문자)의 마스크
+	 * 짝수 비트에서 시작하는 열과 홀수 비트에서 시작하는 열을 덧셈 자리올림으로 구분한다
+	 * @param InOutPrevEscaped 이전 블록 마지막 문자가 이스케이프를 시작했으면 1, 다음 블록으로 넘긴다
+	 */
+	uint64 FindEscaped(uint64 InBackslash, uint64& InOutPrevEscaped)
+	{
+		constexpr uint64 EVEN_BITS = 0x5555555555555555ull;
+
+		InBackslash &= ~InOutPrevEscaped;
+		const uint64 FollowsEscape = (InBackslash << 1) | InOutPrevEscaped;
+		const uint64 OddSequenceStarts = InBackslash & ~EVEN_BITS & ~FollowsEscape;
+
+		const uint64 SequencesStartingOnEvenBits = OddSequenceStarts + InBackslash;
+		InOutPrevEscaped = SequencesStartingOnEvenBits < OddSequenceStarts ? 1 : 0;
+
+		const uint64 InvertMask = SequencesStartingOnEvenBits << 1;
+		return (EVEN_BITS ^ InvertMask) & FollowsEscape;
+	}
+
+	void AppendUtf8(TArray<char>& OutArena, uint32 InCodePoint)
+	{
+		if (InCodePoint < 0x80)
+		{
+			OutArena.push_back(static_cast<char>(InCodePoint));
+		}
+		else if (InCodePoint < 0x800)
+		{
+			OutArena.push_back(static_cast<char>(0xC0 | (InCodePoint >> 6)));
+			OutArena.push_back(static_cast<char>(0x80 | (InCodePoint & 0x3F)));
+		}
+		else if (InCodePoint < 0x10000)
+		{
+			OutArena.push_back(static_cast<char>(0xE0 | (InCodePoint >> 12)));
+			OutArena.push_back(static_cast<char>(0x80 | ((InCodePoint >> 6) & 0x3F)));
+			OutArena.push_back(static_cast<char>(0x80 | (InCodePoint & 0x3F)));
+		}
+		else
+		{
+			OutArena.push_back(static_cast<char>(0xF0 | (InCodePoint >> 18)));
+			OutArena.push_back(static_cast<char>(0x80 | ((InCodePoint >> 12) & 0x3F)));
+			OutArena.push_back(static_cast<char>(0x80 | ((InCodePoint >> 6) & 0x3F)));
+			OutArena.push_back(static_cast<char>(0x80 | (InCodePoint & 0x3F)));
+		}
+	}
+
+	bool ParseHex4(const char* InText, uint32& OutValue)
+	{
+		OutValue = 0;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			const char Char = InText[Index];
+			uint32 Digit;
+			if (Char >= '0' && Char <= '9') { Digit = Char - '0'; }
+			else if (Char >= 'a' && Char <= 'f') { Digit = Char - 'a' + 10; }
+			else if (Char >= 'A' && Char <= 'F') { Digit = Char - 'A' + 10; }
+			else { return false; }
+			OutValue = (OutValue << 4) | Digit;
+		}
+		return true;
+	}
+
+	bool IsNumberChar(char InChar)
+	{
+		return (InChar >= '0' && InChar <= '9') || InChar == '-' || InChar == '+' || InChar == '.' || InChar == 'e' || InChar == 'E';
+	}
+}
+
+bool FJsonDocument::LoadFromFile(const std::filesystem::path& InFilePath)
+{
+	OwnedText.clear();
+	if (!File.Open(InFilePath))
+	{
+		Tape.clear();
+		Error = "파일을 열지 못했습니다: " + InFilePath.string();
+		return false;
+	}
+	return ParseBuffer(reinterpret_cast<const char*>(File.GetData()), File.GetSize());
+}
+
+bool FJsonDocument::Parse(FString InText)
+{
+	File.Close();
+	OwnedText = std::move(InText);
+	return ParseBuffer(OwnedText.data(), OwnedText.size());
+}
+
+bool FJsonDocument::ParseBuffer(const char* InData, size_t InSize)
+{
+	Tape.clear();
+	StringArena.clear();
+	Error.clear();
+
+	// UTF-8 BOM은 건너뛴다
+	if (InSize >= 3 && static_cast<uint8>(InData[0]) == 0xEF && static_cast<uint8>(InData[1]) == 0xBB && static_cast<uint8>(InData[2]) == 0xBF)
+	{
+		InData += 3;
+		InSize -= 3;
+	}
+
+	Data = InData;
+	Size = InSize;
+	if (Size >= UINT32_MAX)
+	{
+		return Fail("4GB 이상의 문서는 지원하지 않습니다", 0);
+	}
+
+	ScanStructurals();
+	if (!Error.empty())
+	{
+		Tape.clear();
+		return false;
+	}
+	if (StructuralIndices.empty())
+	{
+		return Fail("빈 문서입니다", 0);
+	}
+
+	// 값 하나는 구조 인덱스를 최소 하나 쓰므로 테이프는 인덱스 수보다 커지지 않는다
+	Tape.reserve(StructuralIndices.size());
+
+	size_t Cursor = 0;
+	if (!ParseValue(Cursor, 0))
+	{
+		Tape.clear();
+		return false;
+	}
+	if (Cursor != StructuralIndices.size())
+	{
+		Fail("최상위 값 뒤에 문자가 남아 있습니다", StructuralIndices[Cursor]);
+		Tape.clear();
+		return false;
+	}
+	return true;
+}
+
+void FJsonDocument::ScanStructurals()
+{
+	StructuralIndices.clear();
+	// 일반적인 .scene 파일은 대략 6바이트당 구조 인덱스 하나
+	StructuralIndices.reserve(Size / 6 + 16);
+
+	uint64 PrevEscaped = 0;
+	uint64 PrevInString = 0;
+	uint64 PrevScalar = 0;
+
+	auto ProcessBlock = [&](const char* InBlock, size_t InBase, uint64 InValidMask)
+	{
+		const FBlockMasks Masks = ScanBlock(InBlock);
+
+		const uint64 Escaped = FindEscaped(Masks.Backslash, PrevEscaped);
+		const uint64 Quote = Masks.Quote & ~Escaped;
+		const uint64 InString = PrefixXor(Quote) ^ PrevInString;
+		PrevInString = static_cast<uint64>(static_cast<int64>(InString) >> 63);
+
+		// 연산자나 공백이 아닌 문자 중 앞 문자가 따옴표 밖 스칼라가 아닌 곳이 값의 시작이다
+		const uint64 Scalar = ~(Masks.Operator | Masks.Whitespace);
+		const uint64 NonQuoteScalar = Scalar & ~Quote;
+		const uint64 FollowsNonQuoteScalar = (NonQuoteScalar << 1) | PrevScalar;
+		PrevScalar = NonQuoteScalar >> 63;
+
+		// 여는 따옴표만 남기고 문자열 내부와 닫는 따옴표는 지운다
+		const uint64 StringTail = InString ^ Quote;
+		uint64 Structurals = (Masks.Operator | (Scalar & ~FollowsNonQuoteScalar)) & ~StringTail & InValidMask;
+
+		while (Structurals)
+		{
+			unsigned long Bit;
+			_BitScanForward64(&Bit, Structurals);
+			StructuralIndices.push_back(static_cast<uint32>(InBase + Bit));
+			Structurals &= Structurals - 1;
+		}
+	};
+
+	size_t Base = 0;
+	for (; Base + BLOCK_SIZE <= Size; Base += BLOCK_SIZE)
+	{
+		ProcessBlock(Data + Base, Base, ~0ull);
+	}
+
+	// 마지막 부분 블록은 공백으로 채운 복사본에서 읽는다
+	if (Base < Size)
+	{
+		alignas(16) char Tail[BLOCK_SIZE];
+		memset(Tail, ' ', BLOCK_SIZE);
+		memcpy(Tail, Data + Base, Size - Base);
+		ProcessBlock(Tail, Base, (1ull << (Size - Base)) - 1);
+	}
+
+	if (PrevInString)
+	{
+		Fail("닫히지 않은 문자열이 있습니다", static_cast<uint32>(Size));
+	}
+}
+
+bool FJsonDocument::ParseValue(size_t& InOutCursor, uint32 InDepth)
+{
+	if (InOutCursor >= StructuralIndices.size())
+	{
+		return Fail("값이 필요한 위치에서 문서가 끝났습니다", static_cast<uint32>(Size));
+	}
+
+	const uint32 Position = StructuralIndices[InOutCursor++];
+	const char Char = Data[Position];
+
+	if (Char == '{' || Char == '[')
+	{
+		if (InDepth >= MAX_DEPTH)
+		{
+			return Fail("중첩이 너무 깊습니다", Position);
+		}
+
+		const bool bIsObject = Char == '{';
+		const char CloseChar = bIsObject ? '}' : ']';
+		const uint32 ContainerIndex = static_cast<uint32>(Tape.size());
+		Tape.push_back({ bIsObject ? EJsonType::Object : EJsonType::Array, 0 });
+
+		uint32 Count = 0;
+		if (InOutCursor < StructuralIndices.size() && Data[StructuralIndices[InOutCursor]] == CloseChar)
+		{
+			++InOutCursor;
+		}
+		else
+		{
+			while (true)
+			{
+				if (bIsObject)
+				{
+					if (InOutCursor >= StructuralIndices.size() || Data[StructuralIndices[InOutCursor]] != '"')
+					{
+						return Fail("객체 키가 필요합니다", InOutCursor < StructuralIndices.size() ? StructuralIndices[InOutCursor] : static_cast<uint32>(Size));
+					}
+					if (!ParseString(StructuralIndices[InOutCursor++]))
+					{
+						return false;
+					}
+					if (InOutCursor >= StructuralIndices.size() || Data[StructuralIndices[InOutCursor]] != ':')
+					{
+						return Fail("':'가 필요합니다", InOutCursor < StructuralIndices.size() ? StructuralIndices[InOutCursor] : static_cast<uint32>(Size));
+					}
+					++InOutCursor;
+				}
+
+				if (!ParseValue(InOutCursor, InDepth + 1))
+				{
+					return false;
+				}
+				++Count;
+
+				if (InOutCursor >= StructuralIndices.size())
+				{
+					return Fail("닫히지 않은 컨테이너가 있습니다", Position);
+				}
+
+				const char Separator = Data[StructuralIndices[InOutCursor++]];
+				if (Separator == CloseChar)
+				{
+					break;
+				}
+				if (Separator != ',')
+				{
+					return Fail("','가 필요합니다", StructuralIndices[InOutCursor - 1]);
+				}
+			}
+		}
+
+		Tape[ContainerIndex].Count = Count;
+		Tape[ContainerIndex].Next = Tape.size();
+		return true;
+	}
+
+	if (Char == '"')
+	{
+		return ParseString(Position);
+	}
+	if (Char == '-' || (Char >= '0' && Char <= '9'))
+	{
+		return ParseNumber(Position);
+	}
+	return ParseLiteral(Position);
+}
+
+bool FJsonDocument::ParseString(uint32 InPosition)
+{
+	const char* Begin = Data + InPosition + 1;
+	const char* End = Data + Size;
+	const char* Cursor = Begin;
+
+	// 이스케이프가 없는 대부분의 문자열은 닫는 따옴표까지 16바이트씩 훑고 원본을 그대로 가리킨다
+	const __m128i QuoteChar = _mm_set1_epi8('"');
+	const __m128i BackslashChar = _mm_set1_epi8('\\');
+	while (Cursor + 16 <= End)
+	{
+		const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Cursor));
+		const int32 Mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(Bytes, QuoteChar), _mm_cmpeq_epi8(Bytes, BackslashChar)));
+		if (Mask != 0)
+		{
+			unsigned long Bit;
+			_BitScanForward(&Bit, static_cast<unsigned long>(Mask));
+			Cursor += Bit;
+			break;
+		}
+		Cursor += 16;
+	}
+	while (Cursor < End && *Cursor != '"' && *Cursor != '\\')
+	{
+		++Cursor;
+	}
+
+	if (Cursor >= End)
+	{
+		return Fail("닫히지 않은 문자열이 있습니다", InPosition);
+	}
+
+	FTapeEntry Entry = { EJsonType::String, 0 };
+	if (*Cursor == '"')
+	{
+		Entry.Count = static_cast<uint32>(Cursor - Begin);
+		Entry.String = Begin;
+		Tape.push_back(Entry);
+		return true;
+	}
+
+	// 이스케이프가 있으면 버퍼에 풀어 쓴다, 풀린 문자열은 원본보다 길지 않으므로 입력 크기만큼 예약하면 재할당이 없다
+	if (StringArena.capacity() == 0)
+	{
+		StringArena.reserve(Size);
+	}
+
+	const size_t ArenaBegin = StringArena.size();
+	StringArena.insert(StringArena.end(), Begin, Cursor);
+	while (Cursor < End && *Cursor != '"')
+	{
+		if (*Cursor != '\\')
+		{
+			StringArena.push_back(*Cursor++);
+			continue;
+		}
+
+		if (Cursor + 1 >= End)
+		{
+			return Fail("잘못된 이스케이프입니다", static_cast<uint32>(Cursor - Data));
+		}
+
+		const char Escape = Cursor[1];
+		Cursor += 2;
+		switch (Escape)
+		{
+		case '"': StringArena.push_back('"'); break;
+		case '\\': StringArena.push_back('\\'); break;
+		case '/': StringArena.push_back('/'); break;
+		case 'b': StringArena.push_back('\b'); break;
+		case 'f': StringArena.push_back('\f'); break;
+		case 'n': StringArena.push_back('\n'); break;
+		case 'r': StringArena.push_back('\r'); break;
+		case 't': StringArena.push_back('\t'); break;
+		case 'u':
+		{
+			uint32 CodePoint;
+			if (Cursor + 4 > End || !ParseHex4(Cursor, CodePoint))
+			{
+				return Fail("잘못된 유니코드 이스케이프입니다", static_cast<uint32>(Cursor - Data));
+			}
+			Cursor += 4;
+
+			// 서로게이트 쌍은 하나의 코드 포인트로 합친다
+			uint32 LowSurrogate;
+			if (CodePoint >= 0xD800 && CodePoint < 0xDC00 && Cursor + 6 <= End && Cursor[0] == '\\' && Cursor[1] == 'u' &&
+				ParseHex4(Cursor + 2, LowSurrogate) && LowSurrogate >= 0xDC00 && LowSurrogate < 0xE000)
+			{
+				CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+				Cursor += 6;
+			}
+			AppendUtf8(StringArena, CodePoint);
+			break;
+		}
+		default:
+			return Fail("잘못된 이스케이프입니다", static_cast<uint32>(Cursor - Data - 2));
+		}
+	}
+
+	if (Cursor >= End)
+	{
+		return Fail("닫히지 않은 문자열이 있습니다", InPosition);
+	}
+
+	Entry.Count = static_cast<uint32>(StringArena.size() - ArenaBegin);
+	Entry.String = StringArena.data() + ArenaBegin;
+	Tape.push_back(Entry);
+	return true;
+}
+
+bool FJsonDocument::ParseNumber(uint32 InPosition)
+{
+	const char* Begin = Data + InPosition;
+	const char* End = Begin;
+	bool bIsFloat = false;
+	while (End < Data + Size && IsNumberChar(*End))
+	{
+		bIsFloat |= (*End == '.' || *End == 'e' || *End == 'E');
+		++End;
+	}
+
+	FTapeEntry Entry = { EJsonType::Integer, 0 };
+	if (!bIsFloat)
+	{
+		const std::from_chars_result Result = std::from_chars(Begin, End, Entry.Integer);
+		if (Result.ec == std::errc() && Result.ptr == End)
+		{
+			Tape.push_back(Entry);
+			return true;
+		}
+	}
+
+	// 소수점/지수가 있거나 int64 범위를 넘는 정수는 실수로 읽는다
+	Entry.Type = EJsonType::Float;
+	const std::from_chars_result Result = std::from_chars(Begin, End, Entry.Float);
+	if (Result.ec != std::errc() || Result.ptr != End)
+	{
+		return Fail("잘못된 숫자입니다", InPosition);
+	}
+	Tape.push_back(Entry);
+	return true;
+}
+
+bool FJsonDocument::ParseLiteral(uint32 InPosition)
+{
+	const std::string_view Rest(Data + InPosition, Size - InPosition);
+	FTapeEntry Entry = { EJsonType::Null, 0 };
+	size_t Length;
+
+	if (Rest.substr(0, 4) == "true")
+	{
+		Entry.Type = EJsonType::Boolean;
+		Entry.bValue = true;
+		Length = 4;
+	}
+	else if (Rest.substr(0, 5) == "false")
+	{
+		Entry.Type = EJsonType::Boolean;
+		Entry.bValue = false;
+		Length = 5;
+	}
+	else if (Rest.substr(0, 4) == "null")
+	{
+		Entry.Next = 0;
+		Length = 4;
+	}
+	else
+	{
+		return Fail("알 수 없는 값입니다", InPosition);
+	}
+
+	// "trueX"처럼 리터럴 뒤에 스칼라 문자가 붙은 경우
+	if (Length < Rest.size())
+	{
+		const char Next = Rest[Length];
+		if (Next != ',' && Next != '}' && Next != ']' && Next != ' ' && Next != '\t' && Next != '\n' && Next != '\r')
+		{
+			return Fail("알 수 없는 값입니다", InPosition);
+		}
+	}
+
+	Tape.push_back(Entry);
+	return true;
+}
+
+bool FJsonDocument::Fail(const char* InMessage, uint32 InPosition)
+{
+	if (Error.empty())
+	{
+		Error = FString(InMessage) + " (offset " + std::to_string(InPosition) + ")";
+	}
+	return false;
+}
+
+EJsonType FJsonValue::GetType() const
+{
+	return Document->Tape[Index].Type;
+}
+
+bool FJsonValue::GetBool() const
+{
+	return IsBoolean() && Document->Tape[Index].bValue;
+}
+
+int64 FJsonValue::GetInteger() const
+{
+	if (!IsValid())
+	{
+		return 0;
+	}
+
+	const FJsonDocument::FTapeEntry& Entry = Document->Tape[Index];
+	if (Entry.Type == EJsonType::Integer)
+	{
+		return Entry.Integer;
+	}
+	return Entry.Type == EJsonType::Float ? static_cast<int64>(Entry.Float) : 0;
+}
+
+double FJsonValue::GetNumber() const
+{
+	if (!IsValid())
+	{
+		return 0.0;
+	}
+
+	const FJsonDocument::FTapeEntry& Entry = Document->Tape[Index];
+	if (Entry.Type == EJsonType::Float)
+	{
+		return Entry.Float;
+	}
+	return Entry.Type == EJsonType::Integer ? static_cast<double>(Entry.Integer) : 0.0;
+}
+
+std::string_view FJsonValue::GetString() const
+{
+	if (!IsString())
+	{
+		return {};
+	}
+
+	const FJsonDocument::FTapeEntry& Entry = Document->Tape[Index];
+	return std::string_view(Entry.String, Entry.Count);
+}
+
+uint32 FJsonValue::Size() const
+{
+	return (IsArray() || IsObject()) ? Document->Tape[Index].Count : 0;
+}
+
+FJsonValue FJsonValue::Find(std::string_view InKey) const
+{
+	if (!IsObject())
+	{
+		return FJsonValue();
+	}
+
+	for (FIterator It = ObjectRange().Begin, End = ObjectRange().End; It != End; ++It)
+	{
+		if (It.GetKey() == InKey)
+		{
+			return It.GetValue();
+		}
+	}
+	return FJsonValue();
+}
+
+FJsonValue FJsonValue::operator[](uint32 InIndex) const
+{
+	if (!IsArray() || InIndex >= Size())
+	{
+		return FJsonValue();
+	}
+
+	uint32 Element = Index + 1;
+	for (uint32 Skip = 0; Skip < InIndex; ++Skip)
+	{
+		Element = Document->GetNext(Element);
+	}
+	return FJsonValue(Document, Element);
+}
+
+FJsonValue::FIterator& FJsonValue::FIterator::operator++()
+{
+	// 객체는 키 하나와 값 하나를 건너뛴다
+	Index = Document->GetNext(bIsObject ? Index + 1 : Index);
+	return *this;
+}
+
+std::string_view FJsonValue::FIterator::GetKey() const
+{
+	const FJsonDocument::FTapeEntry& Entry = Document->Tape[Index];
+	return std::string_view(Entry.String, Entry.Count);
+}
+
+FJsonValue::FRange FJsonValue::MakeRange(bool bInIsObject) const
+{
+	if (!IsValid() || GetType() != (bInIsObject ? EJsonType::Object : EJsonType::Array))
+	{
+		return { FIterator(nullptr, 0, bInIsObject), FIterator(nullptr, 0, bInIsObject) };
+	}
+
+	const uint32 End = static_cast<uint32>(Document->Tape[Index].Next);
+	return { FIterator(Document, Index + 1, bInIsObject), FIterator(Document, End, bInIsObject) };
+}
+
+FJsonValue::FRange FJsonValue::ArrayRange() const
+{
+	return MakeRange(false);
+}
+
+FJsonValue::FRange FJsonValue::ObjectRange() const
+{
+	return MakeRange(true);
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <string_view>
+
+#include "Core/Public/WindowsMappedFile.h"
+
+class FJsonDocument;
+
+enum class EJsonType : uint8
+{
+	Null,
+	Boolean,
+	Integer,
+	Float,
+	String,
+	Array,
+	Object
+};
+
+/**
+ * @brief FJsonDocument의 테이프 위치 하나를 가리키는 읽기 전용 뷰, 복사 비용은 포인터 두 개
+ * 문서가 살아 있는 동안만 유효하며, 문자열은 원본 버퍼(또는 이스케이프를 푼 문서 내부 버퍼)를 그대로 가리킨다
+ */
+class FJsonValue
+{
+public:
+	FJsonValue() = default;
+
+	/** @brief Find로 찾지 못했거나 기본 생성된 값이면 false */
+	bool IsValid() const { return Document != nullptr; }
+
+	EJsonType GetType() const;
+	bool IsNull() const { return IsValid() && GetType() == EJsonType::Null; }
+	bool IsBoolean() const { return IsValid() && GetType() == EJsonType::Boolean; }
+	bool IsInteger() const { return IsValid() && GetType() == EJsonType::Integer; }
+	bool IsNumber() const { return IsValid() && (GetType() == EJsonType::Integer || GetType() == EJsonType::Float); }
+	bool IsString() const { return IsValid() && GetType() == EJsonType::String; }
+	bool IsArray() const { return IsValid() && GetType() == EJsonType::Array; }
+	bool IsObject() const { return IsValid() && GetType() == EJsonType::Object; }
+
+	bool GetBool() const;
+	int64 GetInteger() const;
+	/** @brief 정수와 실수 모두 double로 돌려준다 */
+	double GetNumber() const;
+	std::string_view GetString() const;
+
+	/** @brief 배열의 원소 수 또는 객체의 멤버 수 */
+	uint32 Size() const;
+
+	/** @brief 객체에서 키로 멤버를 찾는다, 멤버 수에 비례하는 선형 탐색 */
+	FJsonValue Find(std::string_view InKey) const;
+	/** @brief 배열의 InIndex번째 원소, 앞 원소를 건너뛰며 찾는다 */
+	FJsonValue operator[](uint32 InIndex) const;
+
+	/** @brief 배열 원소 또는 객체 멤버를 앞에서부터 순회, 객체의 멤버는 키 다음 테이프 위치에 값이 있다 */
+	class FIterator
+	{
+	public:
+		FIterator(const FJsonDocument* InDocument, uint32 InIndex, bool bInIsObject)
+			: Document(InDocument), Index(InIndex), bIsObject(bInIsObject)
+		{
+		}
+
+		FIterator& operator++();
+		bool operator!=(const FIterator& InOther) const { return Index != InOther.Index; }
+
+		/** @brief 배열이면 원소, 객체면 멤버의 값 */
+		FJsonValue operator*() const { return GetValue(); }
+		FJsonValue GetValue() const { return FJsonValue(Document, bIsObject ? Index + 1 : Index); }
+		std::string_view GetKey() const;
+
+	private:
+		const FJsonDocument* Document;
+		uint32 Index;
+		bool bIsObject;
+	};
+
+	struct FRange
+	{
+		FIterator Begin;
+		FIterator End;
+
+		FIterator begin() const { return Begin; }
+		FIterator end() const { return End; }
+	};
+
+	/** @brief 배열이 아니면 빈 범위 */
+	FRange ArrayRange() const;
+	/** @brief 객체가 아니면 빈 범위, 반복자의 GetKey / GetValue로 멤버를 읽는다 */
+	FRange ObjectRange() const;
+
+private:
+	friend class FJsonDocument;
+
+	FJsonValue(const FJsonDocument* InDocument, uint32 InIndex)
+		: Document(InDocument), Index(InIndex)
+	{
+	}
+
+	FRange MakeRange(bool bInIsObject) const;
+
+	const FJsonDocument* Document = nullptr;
+	uint32 Index = 0;
+};
+
+/**
+ * @brief DOM을 만들지 않는 JSON 리더, json::JSON 대신 로드 경로에서 사용한다
+ * 1. 구조 스캔: 64바이트 블록마다 SSE2로 따옴표/백슬래시/구조 문자/공백 비트 마스크를 만들고,
+ *    이스케이프와 문자열 내부를 비트 연산으로 걸러 구조 문자와 값 시작 위치의 인덱스 목록을 만든다.
+ * 2. 테이프 구성: 인덱스를 앞에서부터 훑어 값 하나당 16바이트 항목 하나를 한 번에 예약한 배열에 기록한다.
+ *    컨테이너 항목은 끝 다음 위치를 저장하므로 형제 값으로 바로 건너뛸 수 있고, 숫자는 이때 한 번만 변환한다.
+ * 문자열은 이스케이프가 없으면 원본을 그대로 가리키고, 있을 때만 입력 크기만큼 한 번 예약한 버퍼에 풀어 쓴다.
+ * @note 파일은 매핑해서 읽으므로 문서가 살아 있는 동안 매핑도 유지된다. 문자열의 UTF-8 유효성은 검사하지 않는다.
+ */
+class FJsonDocument
+{
+public:
+	FJsonDocument() = default;
+	FJsonDocument(const FJsonDocument&) = delete;
+	FJsonDocument& operator=(const FJsonDocument&) = delete;
+
+	/** @brief 파일을 매핑해서 파싱, 실패하면 false이고 GetError로 이유를 확인할 수 있다 */
+	bool LoadFromFile(const std::filesystem::path& InFilePath);
+	/** @brief 문자열을 문서가 소유하도록 옮겨 와서 파싱 */
+	bool Parse(FString InText);
+
+	/** @brief 파싱에 실패했거나 아직 파싱하지 않았으면 유효하지 않은 값 */
+	FJsonValue GetRoot() const { return Tape.empty() ? FJsonValue() : FJsonValue(this, 0); }
+	const FString& GetError() const { return Error; }
+
+	/** @brief 구조 스캔이 찾은 인덱스 수와 테이프 항목 수 (벤치마크 보고용) */
+	size_t GetStructuralCount() const { return StructuralIndices.size(); }
+	size_t GetTapeSize() const { return Tape.size(); }
+
+private:
+	friend class FJsonValue;
+
+	/** @brief 컨테이너는 Next에 끝 다음 테이프 위치, Count에 원소/멤버 수를 저장한다 */
+	struct FTapeEntry
+	{
+		EJsonType Type;
+		uint32 Count;
+		union
+		{
+			uint64 Next;
+			int64 Integer;
+			double Float;
+			bool bValue;
+			const char* String;
+		};
+	};
+
+	bool ParseBuffer(const char* InData, size_t InSize);
+	void ScanStructurals();
+	bool ParseValue(size_t& InOutCursor, uint32 InDepth);
+	bool ParseString(uint32 InPosition);
+	bool ParseNumber(uint32 InPosition);
+	bool ParseLiteral(uint32 InPosition);
+	bool Fail(const char* InMessage, uint32 InPosition);
+
+	/** @brief 테이프 항목 다음의 형제 위치 */
+	uint32 GetNext(uint32 InIndex) const
+	{
+		const FTapeEntry& Entry = Tape[InIndex];
+		return (Entry.Type == EJsonType::Array || Entry.Type == EJsonType::Object) ? static_cast<uint32>(Entry.Next) : InIndex + 1;
+	}
+
+	FWindowsMappedFile File;
+	FString OwnedText;
+	const char* Data = nullptr;
+	size_t Size = 0;
+
+	TArray<uint32> StructuralIndices;
+	TArray<FTapeEntry> Tape;
+	/** @brief 이스케이프를 푼 문자열, 처음 필요할 때 입력 크기만큼 예약하므로 재할당이 없어 포인터가 안정적이다 */
+	TArray<char> StringArena;
+	FString Error;
+
+	/** @brief 깊게 중첩된 입력이 호출 스택을 넘치지 않도록 제한 */
+	static constexpr uint32 MAX_DEPTH = 1024;
+};
@@ -13,6 +13,7 @@
 // #include "Core/Public/CoreTypes.h" 
 // #include "Core/Public/Object.h" // UE_LOG 등
 #include "json.hpp" // 사용하는 JSON 라이브러리
+#include "Utility/Public/JsonReader.h"
 
 namespace json { class JSON; }
 using JSON = JSON;
@@ -287,6 +288,212 @@ public:
 		return false;
 	}
 
+	//====================================================================================
+	// Reading from FJsonValue
+	// FJsonDocument 테이프에서 DOM 없이 읽는다, 키는 복사하지 않고 비교만 한다
+	// 숫자는 정수/실수를 구분하지 않고 읽으며, 실패 시 동작은 위의 JSON 버전과 같다
+	//====================================================================================
+
+	static bool ReadInt64(const FJsonValue& InJson, std::string_view InKey, int64& OutValue, int64 InDefaultValue = 0, bool bInUseLog = true)
+	{
+		const FJsonValue Value = InJson.Find(InKey);
+		if (Value.IsInteger())
+		{
+			OutValue = Value.GetInteger();
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s int64 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadInt32(const FJsonValue& InJson, std::string_view InKey, int32& OutValue, int32 InDefaultValue = 0, bool bInUseLog = true)
+	{
+		int64 Value_i64;
+		if (ReadInt64(InJson, InKey, Value_i64, 0, false) && Value_i64 >= INT32_MIN && Value_i64 <= INT32_MAX)
+		{
+			OutValue = static_cast<int32>(Value_i64);
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s int32 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadUint32(const FJsonValue& InJson, std::string_view InKey, uint32& OutValue, uint32 InDefaultValue = 0, bool bInUseLog = true)
+	{
+		int64 Value_i64;
+		if (ReadInt64(InJson, InKey, Value_i64, 0, false) && Value_i64 >= 0 && Value_i64 <= UINT32_MAX)
+		{
+			OutValue = static_cast<uint32>(Value_i64);
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s uint32 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadFloat(const FJsonValue& InJson, std::string_view InKey, float& OutValue, float InDefaultValue = 0.0f, bool bInUseLog = true)
+	{
+		const FJsonValue Value = InJson.Find(InKey);
+		if (Value.IsNumber())
+		{
+			OutValue = static_cast<float>(Value.GetNumber());
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s float 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	/** @brief 문자열을 FString으로 복사해서 읽는다, 비교만 할 때는 ReadStringView를 사용 */
+	static bool ReadString(const FJsonValue& InJson, std::string_view InKey, FString& OutValue, const FString& InDefaultValue = "", bool bInUseLog = true)
+	{
+		std::string_view View;
+		if (ReadStringView(InJson, InKey, View, {}, false))
+		{
+			OutValue.assign(View.data(), View.size());
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s String 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	/** @brief 문자열을 복사 없이 읽는다, 결과는 문서가 살아 있는 동안만 유효하다 */
+	static bool ReadStringView(const FJsonValue& InJson, std::string_view InKey, std::string_view& OutValue, std::string_view InDefaultValue = {}, bool bInUseLog = true)
+	{
+		const FJsonValue Value = InJson.Find(InKey);
+		if (Value.IsString())
+		{
+			OutValue = Value.GetString();
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s String 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	/**
+	 * @brief bool 값을 읽는다, 레벨 파일은 bool을 "true" / "false" 문자열로 저장하므로 문자열과 JSON bool을 모두 받는다
+	 */
+	static bool ReadBool(const FJsonValue& InJson, std::string_view InKey, bool& OutValue, bool InDefaultValue = false, bool bInUseLog = true)
+	{
+		const FJsonValue Value = InJson.Find(InKey);
+		if (Value.IsBoolean())
+		{
+			OutValue = Value.GetBool();
+			return true;
+		}
+		if (Value.IsString())
+		{
+			OutValue = Value.GetString() == "true";
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s bool 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadObject(const FJsonValue& InJson, std::string_view InKey, FJsonValue& OutValue, bool bInUseLog = true)
+	{
+		OutValue = InJson.Find(InKey);
+		if (OutValue.IsObject())
+		{
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s Object 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = FJsonValue();
+		return false;
+	}
+
+	static bool ReadArray(const FJsonValue& InJson, std::string_view InKey, FJsonValue& OutValue, bool bInUseLog = true)
+	{
+		OutValue = InJson.Find(InKey);
+		if (OutValue.IsArray())
+		{
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s Array 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = FJsonValue();
+		return false;
+	}
+
+	static bool ReadArrayFloat(const FJsonValue& InJson, std::string_view InKey, float& OutValue, const float& InDefaultValue = 0.0f, bool bInUseLog = true)
+	{
+		float Value[1];
+		if (ReadFloatArray(InJson, InKey, Value, 1))
+		{
+			OutValue = Value[0];
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s Array Float 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadVector(const FJsonValue& InJson, std::string_view InKey, FVector& OutValue, const FVector& InDefaultValue = FVector::Zero(), bool bInUseLog = true)
+	{
+		float Value[3];
+		if (ReadFloatArray(InJson, InKey, Value, 3))
+		{
+			OutValue = { Value[0], Value[1], Value[2] };
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s Vector 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadVector4(const FJsonValue& InJson, std::string_view InKey, FVector4& OutValue, const FVector4& InDefaultValue = FVector4(0.0f, 0.0f, 0.0f, 0.0f), bool bInUseLog = true)
+	{
+		float Value[4];
+		if (ReadFloatArray(InJson, InKey, Value, 4))
+		{
+			OutValue = { Value[0], Value[1], Value[2], Value[3] };
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG_ERROR("[JsonSerializer] %.*s Vector4 파싱에 실패했습니다 (기본값 사용)", static_cast<int32>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
 	//====================================================================================
 	// Converting To JSON
 	//====================================================================================
@@ -360,6 +567,17 @@ public:
 	}
 
 
+	/** @brief 파일을 매핑해서 DOM 없이 파싱, 로드 경로에서는 JSON 대신 이것을 사용한다 */
+	static bool LoadJsonFromFile(FJsonDocument& OutDocument, const FString& InFilePath)
+	{
+		if (!OutDocument.LoadFromFile(InFilePath))
+		{
+			UE_LOG_ERROR("[JsonSerializer] %s 파싱에 실패했습니다: %s", InFilePath.c_str(), OutDocument.GetError().c_str());
+			return false;
+		}
+		return true;
+	}
+
 	//====================================================================================
 	// Utility & Analysis Functions
 	//====================================================================================
@@ -374,4 +592,26 @@ public:
 		uint32 TotalPrimitives = 0;
 		TMap<EPrimitiveType, uint32> PrimitiveCountByType;
 	};
+
+private:
+	/** @brief 키의 값이 숫자 InCount개짜리 배열이면 OutValues에 채운다 */
+	static bool ReadFloatArray(const FJsonValue& InJson, std::string_view InKey, float* OutValues, uint32 InCount)
+	{
+		const FJsonValue Array = InJson.Find(InKey);
+		if (!Array.IsArray() || Array.Size() != InCount)
+		{
+			return false;
+		}
+
+		uint32 Index = 0;
+		for (const FJsonValue Element : Array.ArrayRange())
+		{
+			if (!Element.IsNumber())
+			{
+				return false;
+			}
+			OutValues[Index++] = static_cast<float>(Element.GetNumber());
+		}
+		return true;
+	}
 };
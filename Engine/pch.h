@@ -91,4 +91,5 @@ using filesystem::create_directories;
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dxgi")
 #pragma comment(lib, "dwrite")
+#pragma comment(lib, "windowscodecs")
 #pragma comment(lib, DIRECTX_TOOL_KIT)